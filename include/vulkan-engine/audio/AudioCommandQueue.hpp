@@ -0,0 +1,116 @@
+/**
+ * @file AudioCommandQueue.hpp
+ * @brief Lock-free SPSC command queue feeding the audio mixer thread
+ *
+ * The main thread (single producer) pushes playback and parameter commands;
+ * the audio mixer thread (single consumer) drains them at the top of every
+ * mix quantum. Neither side ever blocks: a full queue drops the command
+ * (the producer logs it), and an empty queue simply yields nothing — so a
+ * long render frame can never stall mixing, and the mixer can never stall
+ * the frame loop.
+ *
+ * Key Queue Concepts:
+ * - SPSC Ring: one producer index, one consumer index, no locks or CAS
+ * - Acquire/Release: the producer publishes a slot with a release store;
+ *   the consumer observes it with an acquire load
+ * - POD Commands: trivially copyable payloads, no allocation on either side
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace vkeng {
+
+    /** @brief Everything the mixer thread can be asked to do. */
+    enum class AudioCommandType : uint32_t {
+        Play,               ///< Start the source's clip (clipId, value = volume, refDistance/maxDistance)
+        Pause,              ///< Pause the source's voice
+        Stop,               ///< Stop the voice and reset playback position
+        SetVolume,          ///< value = volume multiplier [0, 1]
+        SetPitch,           ///< value = pitch multiplier (1 = normal)
+        SetLooping,         ///< flag = loop continuously
+        SetPosition,        ///< position = source world position
+        SetListener,        ///< position + forward = listener pose
+        SetMasterVolume,    ///< value = master gain [0, 1]
+        PauseAll,           ///< Pause every active voice
+        ResumeAll           ///< Resume every paused voice
+    };
+
+    /**
+     * @struct AudioCommand
+     * @brief One trivially-copyable unit of work for the mixer thread
+     *
+     * Not every field is meaningful for every type; see AudioCommandType.
+     */
+    struct AudioCommand {
+        AudioCommandType type = AudioCommandType::Stop;
+        uint32_t sourceId = 0;      ///< Voice the command addresses (0 = none/global)
+        uint32_t clipId = 0;        ///< Clip for Play commands
+        uint32_t flag = 0;          ///< Boolean payload (SetLooping)
+        float position[3] = {};     ///< Source or listener world position
+        float forward[3] = {};      ///< Listener forward vector (SetListener)
+        float value = 0.0f;         ///< Scalar payload (volume, pitch)
+        float refDistance = 1.0f;   ///< Attenuation reference distance (Play)
+        float maxDistance = 100.0f; ///< Audibility limit (Play)
+    };
+
+    /**
+     * @class AudioCommandQueue
+     * @brief Fixed-capacity lock-free single-producer single-consumer ring
+     *
+     * Capacity is a power of two so indices wrap with a mask. Indices are
+     * monotonically increasing 64-bit counters; the difference between them
+     * is the fill level.
+     */
+    class AudioCommandQueue {
+    public:
+        /** @brief Slots in the ring — generous for one frame's worth of commands. */
+        static constexpr size_t CAPACITY = 1024;
+
+        /**
+         * @brief Producer side: enqueue one command.
+         * @return false if the queue is full (command dropped)
+         */
+        bool push(const AudioCommand& command) {
+            const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+            const uint64_t head = m_head.load(std::memory_order_acquire);
+            if (tail - head >= CAPACITY) {
+                return false;
+            }
+            m_buffer[tail & (CAPACITY - 1)] = command;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Consumer side: dequeue one command.
+         * @return false if the queue is empty
+         */
+        bool pop(AudioCommand& out) {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+            const uint64_t tail = m_tail.load(std::memory_order_acquire);
+            if (head == tail) {
+                return false;
+            }
+            out = m_buffer[head & (CAPACITY - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Approximate fill level (exact only on the calling side). */
+        size_t size() const {
+            return static_cast<size_t>(m_tail.load(std::memory_order_acquire) -
+                                       m_head.load(std::memory_order_acquire));
+        }
+
+    private:
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+        AudioCommand m_buffer[CAPACITY];
+        alignas(64) std::atomic<uint64_t> m_head{0};    ///< Consumer index (own cache line)
+        alignas(64) std::atomic<uint64_t> m_tail{0};    ///< Producer index (own cache line)
+    };
+
+} // namespace vkeng
@@ -3,8 +3,11 @@
  * @brief Core audio system managing playback, mixing, and spatial audio
  *
  * AudioEngine initializes the audio backend (e.g., miniaudio, OpenAL),
- * manages loaded audio clips, and processes spatial audio each frame
- * based on AudioSource and AudioListener components in the scene.
+ * manages loaded audio clips, and runs mixing on a dedicated high-priority
+ * thread so a long render frame can never starve playback. The main thread
+ * talks to the mixer exclusively through a lock-free SPSC command queue
+ * (see AudioCommandQueue.hpp); update() pushes only positions that
+ * actually changed instead of walking the scene graph.
  *
  * Future backend candidates:
  *   - miniaudio (single-header, cross-platform, low-level)
@@ -13,14 +16,22 @@
  */
 #pragma once
 
+#include "vulkan-engine/audio/AudioCommandQueue.hpp"
+
+#include <glm/glm.hpp>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <memory>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 #include <cstdint>
 
 namespace vkeng {
 
     class SceneNode;
+    class AudioStreamingClip;
 
     /** @brief Handle to a loaded audio clip. */
     using AudioClipId = uint32_t;
@@ -30,10 +41,13 @@ namespace vkeng {
 
     /**
      * @class AudioEngine
-     * @brief Manages audio initialization, clip loading, and per-frame update
+     * @brief Manages audio initialization, clip loading, and the mixer thread
      *
-     * Create one AudioEngine at startup. Each frame, call update() with the
-     * scene root so that AudioSource positions are synced to the listener.
+     * Create one AudioEngine at startup. Mixing and voice state live on a
+     * dedicated thread started by initialize(); playback control from
+     * AudioSource components and position updates from update() cross over
+     * via the lock-free command queue, so main-thread hitches are never
+     * audible and the mixer never touches scene data.
      */
     class AudioEngine {
     public:
@@ -62,6 +76,12 @@ namespace vkeng {
          * @param name Logical name for the clip (used for lookup).
          * @param filepath Path to the audio file (WAV, OGG, MP3).
          * @return Clip ID on success, INVALID_AUDIO_CLIP on failure.
+         *
+         * Short files are decoded fully resident; files above the streaming
+         * threshold get a chunk ring refilled by the background decode
+         * thread instead (see AudioStreamingClip), so minutes-long tracks
+         * cost a fixed few hundred KB rather than their decoded size.
+         * Callers see the same AudioClipId either way.
          */
         AudioClipId loadClip(const std::string& name, const std::string& filepath);
 
@@ -71,7 +91,12 @@ namespace vkeng {
          */
         AudioClipId getClip(const std::string& name) const;
 
-        /** @brief Unload a clip and free its memory. */
+        /**
+         * @brief Unload a clip and free its memory.
+         *
+         * Streaming clips reclaim immediately: the record is dropped here
+         * and the decode thread releases its reference on the next pass.
+         */
         void unloadClip(AudioClipId clipId);
 
         /** @brief Unload all clips. */
@@ -82,14 +107,43 @@ namespace vkeng {
         // ============================================================================
 
         /**
-         * @brief Update spatial audio positions from the scene graph.
-         * @param sceneRoot Root of the scene to scan for AudioSource/AudioListener.
+         * @brief Push changed spatial positions to the mixer thread.
+         * @param sceneRoot Unused; kept for signature stability.
          *
-         * Walks the scene, finds the active AudioListener, and updates
-         * all AudioSource 3D positions relative to it.
+         * Scans the packed AudioSource pool and enqueues SetPosition only
+         * for playing spatial sources whose world position moved since the
+         * last push — an idle scene sends zero commands. The first active
+         * AudioListener's pose is pushed the same way. This replaces the
+         * old per-frame scene graph traversal.
          */
         void update(SceneNode* sceneRoot);
 
+        // ============================================================================
+        // Mixer thread interface
+        // ============================================================================
+
+        /**
+         * @brief Enqueue a command for the mixer thread (main thread only).
+         * @return false if the queue was full (command dropped and logged)
+         *
+         * The queue is single-producer: only the main thread may call this.
+         */
+        bool enqueue(const AudioCommand& command);
+
+        /** @brief Hand out a unique voice ID for a new AudioSource. */
+        uint32_t acquireSourceId() { return m_nextSourceId.fetch_add(1, std::memory_order_relaxed); }
+
+        /**
+         * @brief The engine instance AudioSource components route through.
+         * @return The initialized engine, or nullptr before initialize()
+         *
+         * Components can't hold an engine reference (they are created long
+         * after scene construction APIs are fixed), so the single active
+         * instance registers itself here, mirroring the engine's other
+         * manager access patterns.
+         */
+        static AudioEngine* active() { return s_active; }
+
         // ============================================================================
         // Global controls
         // ============================================================================
@@ -110,6 +164,55 @@ namespace vkeng {
         bool isInitialized() const { return m_initialized; }
 
     private:
+        /**
+         * @brief Mixer-thread-owned state for one playing source.
+         *
+         * Only mixerLoop() reads or writes voices; the main thread's view
+         * of playback state lives in the AudioSource components.
+         */
+        struct Voice {
+            AudioClipId clipId = INVALID_AUDIO_CLIP;
+            float volume = 1.0f;
+            float pitch = 1.0f;
+            bool looping = false;
+            bool playing = false;
+            bool paused = false;
+            glm::vec3 position{0.0f};
+            float refDistance = 1.0f;   ///< Attenuation reference distance
+            float maxDistance = 100.0f; ///< Audibility limit
+        };
+
+        /**
+         * @brief How one loaded clip's samples live in memory.
+         *
+         * Resident clips (short SFX) will hold decoded samples directly once
+         * a backend lands; streaming clips hold only their chunk ring.
+         */
+        struct ClipRecord {
+            std::string filepath;
+            bool streaming = false;
+            std::shared_ptr<AudioStreamingClip> stream;  ///< Set for streaming clips
+        };
+
+        /** @brief Mixer thread entry: drain commands, mix, submit, repeat. */
+        void mixerLoop();
+
+        /** @brief Decode thread entry: keep every streaming clip's ring filled. */
+        void decodeLoop();
+
+        /** @brief Apply one dequeued command to the voice table (mixer thread). */
+        void applyCommand(const AudioCommand& command);
+
+        /**
+         * @brief Batch-compute per-voice stereo gains with the SIMD kernels.
+         *
+         * Repacks audible voices into SoA scratch arrays and runs one
+         * AudioMixKernels::computeSpatialGains call over all of them, so
+         * attenuation and pan for the whole voice set cost a handful of
+         * vector iterations per quantum (mixer thread only).
+         */
+        void computeVoiceGains();
+
         bool m_initialized = false;
         float m_masterVolume = 1.0f;
 
@@ -117,6 +220,36 @@ namespace vkeng {
         std::unordered_map<std::string, AudioClipId> m_clipNames;
 
         AudioClipId m_nextClipId = 1;
+
+        // --- Clip table (main thread + decode thread, guarded) ---
+        std::mutex m_clipMutex;                             ///< Guards m_clips
+        std::unordered_map<AudioClipId, ClipRecord> m_clips;
+        std::thread m_decodeThread;                         ///< Streaming refill thread
+
+        // --- Main-thread side ---
+        AudioCommandQueue m_commands;                   ///< SPSC: main thread -> mixer thread
+        std::atomic<uint32_t> m_nextSourceId{1};        ///< Voice ID allocator (0 = invalid)
+        glm::vec3 m_lastListenerPos{0.0f};              ///< Last pushed listener position
+        glm::vec3 m_lastListenerForward{0.0f, 0.0f, -1.0f};  ///< Last pushed listener forward
+        bool m_listenerPushed = false;                  ///< Per-update latch: first active listener wins
+
+        // --- Mixer-thread side ---
+        std::thread m_mixerThread;                      ///< Dedicated mixing/submission thread
+        std::atomic<bool> m_running{false};             ///< Mixer loop keep-alive
+        std::unordered_map<uint32_t, Voice> m_voices;   ///< Voice table (mixer thread only)
+        float m_mixerMasterVolume = 1.0f;               ///< Mixer-side master gain (mixer thread only)
+        glm::vec3 m_listenerPos{0.0f};                  ///< Mixer-side listener position
+        glm::vec3 m_listenerForward{0.0f, 0.0f, -1.0f}; ///< Mixer-side listener forward
+
+        // SoA scratch for computeVoiceGains() — persists across quanta so a
+        // steady voice count allocates nothing (mixer thread only)
+        std::vector<float> m_soaX, m_soaY, m_soaZ;      ///< Voice positions
+        std::vector<float> m_soaGain;                   ///< Voice base gains
+        std::vector<float> m_soaRef, m_soaMax;          ///< Attenuation parameters
+        std::vector<float> m_gainL, m_gainR;            ///< Kernel output: per-ear gains
+        std::vector<uint32_t> m_soaVoiceIds;            ///< Voice ID per SoA slot
+
+        static AudioEngine* s_active;                   ///< The initialized instance (see active())
     };
 
 } // namespace vkeng
@@ -10,6 +10,8 @@
 #include "vulkan-engine/components/Component.hpp"
 #include "vulkan-engine/audio/AudioEngine.hpp"
 
+#include <glm/glm.hpp>
+
 namespace vkeng {
 
     /**
@@ -53,15 +55,15 @@ namespace vkeng {
 
         /** @brief Volume multiplier [0.0, 1.0]. */
         float getVolume() const { return m_volume; }
-        void setVolume(float v) { m_volume = v; }
+        void setVolume(float v);
 
         /** @brief Pitch multiplier (1.0 = normal). */
         float getPitch() const { return m_pitch; }
-        void setPitch(float p) { m_pitch = p; }
+        void setPitch(float p);
 
         /** @brief Whether the clip loops continuously. */
         bool isLooping() const { return m_loop; }
-        void setLooping(bool loop) { m_loop = loop; }
+        void setLooping(bool loop);
 
         /** @brief Whether to play on component initialization. */
         bool isPlayOnAwake() const { return m_playOnAwake; }
@@ -85,7 +87,34 @@ namespace vkeng {
 
         void initialize(SceneNode* owner) override;
 
+        // ============================================================================
+        // Mixer thread plumbing
+        // ============================================================================
+
+        /** @brief Voice ID this source addresses on the mixer thread. */
+        uint32_t getSourceId() const { return m_sourceId; }
+
+        /**
+         * @brief Records the position last pushed to the mixer thread.
+         * @param position Current world position of the owning node
+         * @return true if the position changed and should be (re)pushed
+         *
+         * Called by AudioEngine::update(); keeps the dirty check on the
+         * source so a static scene enqueues nothing.
+         */
+        bool updatePushedPosition(const glm::vec3& position) {
+            if (m_hasPushedPosition && position == m_lastPushedPosition) {
+                return false;
+            }
+            m_lastPushedPosition = position;
+            m_hasPushedPosition = true;
+            return true;
+        }
+
     private:
+        /** @brief Enqueue a parameter command if the engine is live. */
+        void pushCommand(AudioCommandType type, float value, uint32_t flag = 0) const;
+
         AudioClipId m_clipId = INVALID_AUDIO_CLIP;
         float m_volume = 1.0f;
         float m_pitch = 1.0f;
@@ -96,6 +125,10 @@ namespace vkeng {
 
         float m_maxDistance = 100.0f;
         float m_referenceDistance = 1.0f;
+
+        uint32_t m_sourceId = 0;                ///< Mixer voice ID (assigned in initialize())
+        glm::vec3 m_lastPushedPosition{0.0f};   ///< Position last sent to the mixer
+        bool m_hasPushedPosition = false;       ///< Whether any position was sent yet
     };
 
 } // namespace vkeng
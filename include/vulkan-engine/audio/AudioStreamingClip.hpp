@@ -0,0 +1,109 @@
+/**
+ * @file AudioStreamingClip.hpp
+ * @brief Chunked decode-ahead streaming for long audio clips
+ *
+ * Long tracks (ambient beds, music) are never resident in full: a small
+ * ring of decoded chunks is kept filled by the engine's background decode
+ * thread a few chunks ahead of the mixer's play cursor, so memory cost is
+ * a fixed few hundred KB per stream regardless of track length. Short SFX
+ * stay fully resident and never come through here.
+ *
+ * Key Streaming Concepts:
+ * - Chunk Ring: fixed-size SPSC ring — the decode thread produces chunks,
+ *   the mixer thread consumes them; monotonic counters, no locks
+ * - Decode-Ahead: the decode thread refills whenever the ring has space,
+ *   so the mixer always finds the next chunk ready unless decode is
+ *   genuinely outpaced
+ * - Instant Unload: markUnloaded() flips an atomic; the decode thread
+ *   drops its reference on the next pass and the last shared_ptr frees
+ *   the ring immediately
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class AudioStreamingClip
+     * @brief One streaming clip's file handle and decoded chunk ring
+     *
+     * Thread roles are strict: decodeNextChunk() is decode-thread-only,
+     * currentChunk()/consumeChunk() are mixer-thread-only, markUnloaded()
+     * is main-thread-only. The ring counters are the only shared state.
+     */
+    class AudioStreamingClip {
+    public:
+        /** @brief Frames per decoded chunk (~0.34 s at 48 kHz mono). */
+        static constexpr size_t CHUNK_FRAMES = 16384;
+
+        /** @brief Chunks in the ring — the decode-ahead depth. */
+        static constexpr size_t RING_CHUNKS = 4;
+
+        /** @brief Opens the file; check isOpen() before registering. */
+        explicit AudioStreamingClip(const std::string& filepath);
+
+        /** @brief Whether the backing file opened successfully. */
+        bool isOpen() const { return m_file.is_open(); }
+
+        // ============================================================================
+        // Decode thread
+        // ============================================================================
+
+        /** @brief Whether the ring has space and the file has data left. */
+        bool needsDecode() const;
+
+        /**
+         * @brief Decode one chunk into the next ring slot.
+         * @return true if a chunk was produced, false if ring full or EOF
+         */
+        bool decodeNextChunk();
+
+        // ============================================================================
+        // Mixer thread
+        // ============================================================================
+
+        /**
+         * @brief Peek the oldest undrained chunk.
+         * @param frameCount Receives the chunk's frame count
+         * @return Chunk samples, or nullptr if the decode thread is behind
+         */
+        const float* currentChunk(size_t& frameCount) const;
+
+        /** @brief Retire the current chunk, freeing its ring slot for refill. */
+        void consumeChunk();
+
+        /** @brief Whether the file is fully decoded and fully consumed. */
+        bool isExhausted() const;
+
+        // ============================================================================
+        // Main thread
+        // ============================================================================
+
+        /** @brief Flag for the decode thread to drop this clip on its next pass. */
+        void markUnloaded() { m_unloaded.store(true, std::memory_order_release); }
+
+        /** @brief Whether unloadClip() retired this stream. */
+        bool isUnloaded() const { return m_unloaded.load(std::memory_order_acquire); }
+
+    private:
+        struct Chunk {
+            std::vector<float> samples;
+            size_t frames = 0;
+        };
+
+        std::ifstream m_file;           ///< Decode thread only after construction
+        bool m_endOfFile = false;       ///< Decode thread only
+
+        Chunk m_ring[RING_CHUNKS];
+        alignas(64) std::atomic<uint64_t> m_produced{0};    ///< Chunks decoded (decode thread writes)
+        alignas(64) std::atomic<uint64_t> m_consumed{0};    ///< Chunks retired (mixer thread writes)
+        std::atomic<bool> m_unloaded{false};                ///< Set by unloadClip()
+    };
+
+} // namespace vkeng
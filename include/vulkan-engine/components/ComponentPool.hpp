@@ -0,0 +1,212 @@
+/**
+ * @file ComponentPool.hpp
+ * @brief Type-segregated block storage for scene components
+ *
+ * Components attached through SceneNode::addComponent() live in per-type
+ * pools instead of individual heap allocations. Each pool owns fixed-size
+ * blocks of slots, so same-type components sit packed in memory and the
+ * per-frame consumers (draw-call collection, light gathering) can scan
+ * them linearly instead of chasing a shared_ptr per node.
+ *
+ * Key Pool Concepts:
+ * - Block Storage: slots never move, so component addresses are stable
+ *   for the component's lifetime (shared_ptrs handed out stay valid)
+ * - Free List: released slots are recycled before new blocks are added
+ * - Packed Iteration: forEach() walks live slots block by block in
+ *   memory order — the cache-friendly path for per-frame gathers
+ * - Ownership: SceneNode's shared_ptr releases the slot via a custom
+ *   deleter; the pool itself never outlives its live components' owners
+ */
+#pragma once
+
+#include "vulkan-engine/components/Component.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class IComponentPool
+     * @brief Type-erased base so the registry can hold pools by type ID.
+     */
+    class IComponentPool {
+    public:
+        virtual ~IComponentPool() = default;
+
+        /** @brief Number of live components in the pool. */
+        virtual size_t size() const = 0;
+    };
+
+    /**
+     * @class TypedComponentPool
+     * @brief Contiguous block storage for one component type
+     * @tparam T The concrete component type (must derive from Component)
+     *
+     * Slots are grouped into blocks of BLOCK_SIZE; a slot's address never
+     * changes once allocated, and released slots are recycled through a
+     * free list. Iteration order is slot order, i.e. memory order.
+     */
+    template<typename T>
+    class TypedComponentPool : public IComponentPool {
+    public:
+        /** @brief Slots per block — one block spans a few cache pages. */
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        ~TypedComponentPool() override {
+            // Live components are owned by SceneNodes via shared_ptr; by
+            // the time the pool dies (static teardown) they must be gone.
+            // Destroy any stragglers defensively so we never leak dtors.
+            for (size_t slot = 0; slot < m_slotCount; slot++) {
+                Block& block = *m_blocks[slot / BLOCK_SIZE];
+                size_t offset = slot % BLOCK_SIZE;
+                if (block.live[offset]) {
+                    block.at(offset)->~T();
+                    block.live[offset] = false;
+                }
+            }
+        }
+
+        /**
+         * @brief Constructs a component in the next free slot.
+         * @return Pointer to the constructed component (stable address)
+         */
+        template<typename... Args>
+        T* allocate(Args&&... args) {
+            size_t slot;
+            if (!m_freeList.empty()) {
+                slot = m_freeList.back();
+                m_freeList.pop_back();
+            } else {
+                slot = m_slotCount++;
+                if (slot / BLOCK_SIZE >= m_blocks.size()) {
+                    m_blocks.push_back(std::make_unique<Block>());
+                }
+            }
+
+            Block& block = *m_blocks[slot / BLOCK_SIZE];
+            size_t offset = slot % BLOCK_SIZE;
+            T* component = new (block.at(offset)) T(std::forward<Args>(args)...);
+            block.live[offset] = true;
+            m_liveCount++;
+            return component;
+        }
+
+        /**
+         * @brief Destroys a component and returns its slot to the free list.
+         * @param component Pointer previously returned by allocate()
+         */
+        void release(T* component) {
+            for (size_t b = 0; b < m_blocks.size(); b++) {
+                Block& block = *m_blocks[b];
+                T* first = block.at(0);
+                if (component < first || component >= first + BLOCK_SIZE) continue;
+
+                size_t offset = static_cast<size_t>(component - first);
+                component->~T();
+                block.live[offset] = false;
+                m_freeList.push_back(b * BLOCK_SIZE + offset);
+                m_liveCount--;
+                return;
+            }
+        }
+
+        /**
+         * @brief Invokes fn on every live component in memory order.
+         * @param fn Callable taking (T&)
+         *
+         * This is the frame-time path: a linear scan over packed slots,
+         * no pointer chasing through per-node maps.
+         */
+        template<typename Fn>
+        void forEach(Fn&& fn) {
+            size_t visited = 0;
+            for (size_t b = 0; b < m_blocks.size() && visited < m_liveCount; b++) {
+                Block& block = *m_blocks[b];
+                size_t slotsInBlock = std::min(BLOCK_SIZE, m_slotCount - b * BLOCK_SIZE);
+                for (size_t offset = 0; offset < slotsInBlock; offset++) {
+                    if (!block.live[offset]) continue;
+                    fn(*block.at(offset));
+                    visited++;
+                }
+            }
+        }
+
+        size_t size() const override { return m_liveCount; }
+
+    private:
+        /** @brief One fixed-size run of slots; never reallocated. */
+        struct Block {
+            alignas(T) unsigned char storage[sizeof(T) * BLOCK_SIZE];
+            bool live[BLOCK_SIZE] = {};
+
+            T* at(size_t offset) { return reinterpret_cast<T*>(storage) + offset; }
+        };
+
+        std::vector<std::unique_ptr<Block>> m_blocks;   ///< Stable block storage
+        std::vector<size_t> m_freeList;                 ///< Recyclable slot indices
+        size_t m_slotCount = 0;                         ///< High-water slot mark
+        size_t m_liveCount = 0;                         ///< Currently constructed slots
+    };
+
+    /**
+     * @class ComponentPools
+     * @brief Registry of per-type component pools (engine-wide singleton)
+     *
+     * Matches the engine's other manager singletons: access via get(),
+     * pools are created lazily on first use of a type.
+     */
+    class ComponentPools {
+    public:
+        static ComponentPools& get() {
+            static ComponentPools instance;
+            return instance;
+        }
+
+        ComponentPools(const ComponentPools&) = delete;
+        ComponentPools& operator=(const ComponentPools&) = delete;
+
+        /** @brief The pool for component type T (created on first use). */
+        template<typename T>
+        TypedComponentPool<T>& pool() {
+            static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
+            ComponentTypeId typeId = getComponentTypeId<T>();
+            auto it = m_pools.find(typeId);
+            if (it == m_pools.end()) {
+                it = m_pools.emplace(typeId, std::make_unique<TypedComponentPool<T>>()).first;
+            }
+            return static_cast<TypedComponentPool<T>&>(*it->second);
+        }
+
+        /**
+         * @brief Linear scan over every live component of type T.
+         * @param fn Callable taking (T&)
+         *
+         * The component's owning node is reachable via getOwner(); callers
+         * that need hierarchy state (active flags, world transform) read it
+         * from there.
+         */
+        template<typename T, typename Fn>
+        void forEachComponent(Fn&& fn) {
+            pool<T>().forEach(std::forward<Fn>(fn));
+        }
+
+        /** @brief Number of live components of type T. */
+        template<typename T>
+        size_t count() {
+            return pool<T>().size();
+        }
+
+    private:
+        ComponentPools() = default;
+        ~ComponentPools() = default;
+
+        std::unordered_map<ComponentTypeId, std::unique_ptr<IComponentPool>> m_pools;
+    };
+
+} // namespace vkeng
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "vulkan-engine/components/Component.hpp"
+#include <atomic>
+#include <cstdint>
 #include <glm/glm.hpp>
 
 namespace vkeng {
@@ -43,13 +45,15 @@ namespace vkeng {
         float getOuterConeAngle() const { return m_outerConeAngle; }
 
         // ================== Mutators ==================
+        // Every mutator bumps the global light revision so cached gathers
+        // (the renderer's GpuLight array) know a rebuild is due.
 
-        void setType(LightType type) { m_type = type; }
-        void setColor(const glm::vec3& color) { m_color = color; }
-        void setIntensity(float intensity) { m_intensity = intensity; }
+        void setType(LightType type) { m_type = type; bumpGlobalRevision(); }
+        void setColor(const glm::vec3& color) { m_color = color; bumpGlobalRevision(); }
+        void setIntensity(float intensity) { m_intensity = intensity; bumpGlobalRevision(); }
 
         /** @brief Set attenuation range (Point and Spot lights only). */
-        void setRange(float range) { m_range = range; }
+        void setRange(float range) { m_range = range; bumpGlobalRevision(); }
 
         /**
          * @brief Set spotlight cone angles (Spot lights only).
@@ -59,9 +63,41 @@ namespace vkeng {
         void setConeAngles(float inner, float outer) {
             m_innerConeAngle = inner;
             m_outerConeAngle = outer;
+            bumpGlobalRevision();
+        }
+
+        // ================== Lifecycle ==================
+
+        /** @brief Attaching a light changes the gathered set. */
+        void initialize(SceneNode* owner) override {
+            Component::initialize(owner);
+            bumpGlobalRevision();
+        }
+
+        /** @brief Detaching a light changes the gathered set. */
+        void destroy() override { bumpGlobalRevision(); }
+
+        // ================== Change Detection ==================
+
+        /**
+         * @brief Counter bumped by every light property or lifecycle change.
+         *
+         * Consumers caching data derived from the light set compare this
+         * (together with owner transform versions and enabled/active flags)
+         * against the value their cache was built at.
+         */
+        static uint64_t getGlobalRevision() {
+            return s_revision.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Record a light change (any property, attach, or detach). */
+        static void bumpGlobalRevision() {
+            s_revision.fetch_add(1, std::memory_order_relaxed);
         }
 
     private:
+        static std::atomic<uint64_t> s_revision;
+
         LightType m_type = LightType::Directional;
         glm::vec3 m_color{1.0f, 1.0f, 1.0f};
         float m_intensity = 1.0f;
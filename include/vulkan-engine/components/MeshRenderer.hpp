@@ -19,6 +19,7 @@
 #include "vulkan-engine/components/Component.hpp"
 #include "vulkan-engine/resources/Material.hpp"
 #include "vulkan-engine/resources/Mesh.hpp"
+#include <cstdint>
 #include <memory>
 
 namespace vkeng {
@@ -74,6 +75,27 @@ namespace vkeng {
          * @return Shared pointer to the current material resource, or nullptr.
          */
         std::shared_ptr<Material> getMaterial() const { return m_material; }
+
+        /**
+         * @brief Select the mesh LOD to render for a given camera distance.
+         * @param distanceToCamera World-space distance from camera to this mesh.
+         * @return The mesh for the chosen reduction level (the base mesh when
+         *         no LOD chain is attached).
+         *
+         * Levels switch on projected size (bounding radius over distance) so
+         * large objects hold detail further out than small ones. The current
+         * level only changes when the projected size crosses a threshold by a
+         * hysteresis margin, preventing popping when hovering near a boundary.
+         *
+         * @note Called by the renderer during draw-call collection each frame
+         */
+        const std::shared_ptr<Mesh>& selectLod(float distanceToCamera);
+
+        /**
+         * @brief Currently selected LOD level (0 = full detail).
+         * @return Level index chosen by the last selectLod() call.
+         */
+        uint32_t getCurrentLodLevel() const { return m_currentLod; }
         
         /**
          * @brief Set a new mesh resource for this renderer
@@ -83,15 +105,28 @@ namespace vkeng {
          * changing of geometry without recreating the component.
          * 
          * @note Previous mesh reference is released automatically
+         * @note Bumps the scene structure version so retained draw lists rebuild
          * @warning Passing nullptr will result in undefined rendering behavior
          */
-        void setMesh(std::shared_ptr<Mesh> mesh) { m_mesh = mesh; }
+        void setMesh(std::shared_ptr<Mesh> mesh);
 
         /**
          * @brief Set a new material resource for this renderer.
          * @param material New material resource to associate with this renderer.
+         * @note Bumps the scene structure version so retained draw lists rebuild
          */
-        void setMaterial(std::shared_ptr<Material> material) { m_material = material; }
+        void setMaterial(std::shared_ptr<Material> material);
+
+        /**
+         * @brief Set the global LOD threshold multiplier (live tunable).
+         *
+         * Scales every LOD switch size: values above 1 drop to coarser
+         * levels sooner (cheaper frames), below 1 hold detail longer.
+         * Takes effect at the next selectLod() call, i.e. next frame.
+         */
+        static void setLodBias(float bias) { s_lodBias = bias; }
+        /** @brief Current global LOD threshold multiplier (1 = as authored). */
+        static float getLodBias() { return s_lodBias; }
 
     private:
         // ============================================================================
@@ -100,6 +135,9 @@ namespace vkeng {
         
         std::shared_ptr<Mesh> m_mesh;            ///< Shared mesh resource for rendering
         std::shared_ptr<Material> m_material;    ///< Optional material resource for future shading systems
+        uint32_t m_currentLod = 0;               ///< LOD level chosen last frame (hysteresis state)
+
+        static float s_lodBias;                  ///< Global switch-threshold multiplier (see setLodBias)
     };
 
 } // namespace vkeng
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file ParticleEmitter.hpp
+ * @brief Particle emitter component for scene graph effects
+ *
+ * Describes a continuous particle source attached to a SceneNode: spawn
+ * rate, lifetime range, initial velocity and spread, gravity, and the
+ * color/size ramp particles follow over their lives. The ParticleSystem
+ * scans the emitter pool each frame and simulates every enabled emitter —
+ * the component itself holds only the description, no per-particle state.
+ */
+#pragma once
+
+#include "vulkan-engine/components/Component.hpp"
+#include <glm/glm.hpp>
+
+namespace vkeng {
+
+    /**
+     * @class ParticleEmitter
+     * @brief Component that adds a particle source to a SceneNode
+     *
+     * Particles spawn at the owning node's world position and simulate in
+     * world space, so a moving emitter leaves its particles behind (smoke
+     * trails, sparks). Capacity picks the simulation path: small emitters
+     * run on the CPU, emitters at or above the ParticleSystem's GPU
+     * threshold simulate in a compute pass.
+     *
+     * @note Capacity is fixed once the ParticleSystem first sees the
+     *       emitter; changing it afterwards re-allocates the emitter's
+     *       particle storage on the next update.
+     */
+    class ParticleEmitter : public Component {
+    public:
+        /** @brief Construct a default emitter (small upward ember burst). */
+        ParticleEmitter();
+
+        // ================== Accessors ==================
+
+        uint32_t getMaxParticles() const { return m_maxParticles; }
+        float getSpawnRate() const { return m_spawnRate; }
+        float getLifetimeMin() const { return m_lifetimeMin; }
+        float getLifetimeMax() const { return m_lifetimeMax; }
+        const glm::vec3& getInitialVelocity() const { return m_initialVelocity; }
+        const glm::vec3& getVelocityVariance() const { return m_velocityVariance; }
+        const glm::vec3& getGravity() const { return m_gravity; }
+        const glm::vec4& getStartColor() const { return m_startColor; }
+        const glm::vec4& getEndColor() const { return m_endColor; }
+        float getStartSize() const { return m_startSize; }
+        float getEndSize() const { return m_endSize; }
+
+        // ================== Mutators ==================
+
+        /** @brief Set the particle pool capacity (also selects CPU vs GPU simulation). */
+        void setMaxParticles(uint32_t maxParticles) { m_maxParticles = maxParticles; }
+
+        /** @brief Set the steady-state spawn rate in particles per second. */
+        void setSpawnRate(float spawnRate) { m_spawnRate = spawnRate; }
+
+        /** @brief Set the particle lifetime range in seconds (uniform random per particle). */
+        void setLifetime(float minSeconds, float maxSeconds) {
+            m_lifetimeMin = minSeconds;
+            m_lifetimeMax = maxSeconds;
+        }
+
+        /**
+         * @brief Set the spawn velocity distribution.
+         * @param velocity Mean initial velocity in world space
+         * @param variance Per-axis uniform random spread added to the mean
+         */
+        void setVelocity(const glm::vec3& velocity, const glm::vec3& variance) {
+            m_initialVelocity = velocity;
+            m_velocityVariance = variance;
+        }
+
+        /** @brief Set the constant acceleration applied to live particles. */
+        void setGravity(const glm::vec3& gravity) { m_gravity = gravity; }
+
+        /** @brief Set the color ramp from spawn (start) to death (end). */
+        void setColorRamp(const glm::vec4& start, const glm::vec4& end) {
+            m_startColor = start;
+            m_endColor = end;
+        }
+
+        /** @brief Set the billboard size ramp from spawn to death, in world units. */
+        void setSizeRamp(float start, float end) {
+            m_startSize = start;
+            m_endSize = end;
+        }
+
+    private:
+        uint32_t m_maxParticles;        ///< Particle pool capacity
+        float m_spawnRate;              ///< Particles spawned per second
+        float m_lifetimeMin;            ///< Shortest particle lifetime (seconds)
+        float m_lifetimeMax;            ///< Longest particle lifetime (seconds)
+        glm::vec3 m_initialVelocity;    ///< Mean spawn velocity (world space)
+        glm::vec3 m_velocityVariance;   ///< Per-axis random velocity spread
+        glm::vec3 m_gravity;            ///< Constant acceleration on live particles
+        glm::vec4 m_startColor;         ///< Color at spawn (premultiplied alpha ramp start)
+        glm::vec4 m_endColor;           ///< Color at death
+        float m_startSize;              ///< Billboard size at spawn (world units)
+        float m_endSize;                ///< Billboard size at death
+    };
+
+} // namespace vkeng
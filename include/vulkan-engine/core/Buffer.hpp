@@ -34,8 +34,10 @@ namespace vkeng {
         Index,       ///< Index data for indexed drawing
         Uniform,     ///< Uniform buffer for shader constants
         Storage,     ///< Storage buffer for compute operations
-        TransferSrc, ///< Source buffer for transfer operations
-        TransferDst  ///< Destination buffer for transfer operations
+        TransferSrc,  ///< Source buffer for transfer operations
+        TransferDst,  ///< Destination buffer for transfer operations
+        StorageVertex,///< Storage buffer also bound as a vertex buffer (GPU-compacted instance data)
+        Indirect      ///< Indirect draw command buffer writable from compute
     };
 
     /**
@@ -143,7 +145,25 @@ namespace vkeng {
          * @note For device-local buffers, use MemoryManager::uploadToBuffer()
          */
         Result<void> copyData(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
-        
+
+        /**
+         * @brief Writes through the persistent mapping — the per-frame fast path
+         *
+         * Host-visible buffers are persistently mapped at creation, so this
+         * is a plain memcpy into write-combined memory with no map/unmap
+         * calls, and no flush at all when the memory type is host-coherent
+         * (the common case on desktop GPUs). Use this for data rewritten
+         * every frame (uniform buffers, instance scratch).
+         *
+         * @param data Source data pointer
+         * @param size Number of bytes to write
+         * @param offset Byte offset in buffer (default: 0)
+         * @return Result indicating success or error
+         *
+         * @warning Only works with host-visible (persistently mapped) buffers
+         */
+        Result<void> write(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
         // ============================================================================
         // Buffer Properties
         // ============================================================================
@@ -165,11 +185,28 @@ namespace vkeng {
          * @return true if buffer can be mapped for CPU access
          */
         bool isHostVisible() const { return m_hostVisible; }
-        
+
+        /**
+         * @brief Check if the backing memory is host-coherent
+         * @return true if CPU writes are visible to the GPU without flushes
+         */
+        bool isCoherent() const { return m_coherent; }
+
+        /**
+         * @brief Get the persistent mapping, if any
+         * @return Mapped pointer, or nullptr for device-local buffers
+         */
+        void* getMappedData() const { return m_mappedData; }
+
     private:
         // ============================================================================
         // Internal Buffer State
         // ============================================================================
+
+        /// Defragmentation swaps the handle/allocation/mapping in place, so
+        /// every shared_ptr holder sees the new location on its next
+        /// getHandle() call — no pointer fixups anywhere else.
+        friend class MemoryManager;
         
         /**
          * @brief Private constructor for internal buffer creation
@@ -189,7 +226,9 @@ namespace vkeng {
         VkBuffer m_buffer = VK_NULL_HANDLE;           ///< Vulkan buffer object
         VmaAllocation m_allocation = VK_NULL_HANDLE;  ///< VMA memory allocation
         VkDeviceSize m_size = 0;                      ///< Buffer size in bytes
+        VkBufferUsageFlags m_usageFlags = 0;          ///< Creation usage (replacement buffers match it)
         bool m_hostVisible = false;                   ///< CPU accessibility flag
+        bool m_coherent = false;                      ///< Memory type is host-coherent (no flushes)
         void* m_mappedData = nullptr;                 ///< Cached mapped pointer
     };
 
@@ -230,8 +269,10 @@ namespace vkeng {
          * @param format Pixel format (e.g., VK_FORMAT_R8G8B8A8_UNORM)
          * @param usage Image usage flags (sampling, color attachment, etc.)
          * @param hostVisible Whether image should be CPU accessible (rare)
+         * @param mipLevels Number of mip levels; the view covers all of them
+         * @param arrayLayers Number of array layers; a 2D_ARRAY view is created when > 1
          * @return Result containing the created image or error
-         * 
+         *
          * @note Automatically creates color aspect image view for shader access
          * @warning Host-visible images have limited format support
          */
@@ -241,7 +282,9 @@ namespace vkeng {
             uint32_t width, uint32_t height,
             VkFormat format,
             VkImageUsageFlags usage,
-            bool hostVisible = false);
+            bool hostVisible = false,
+            uint32_t mipLevels = 1,
+            uint32_t arrayLayers = 1);
         
         /**
          * @brief Destroys image, image view, and frees VMA memory allocation
@@ -287,12 +330,25 @@ namespace vkeng {
          * @return Image height in pixels
          */
         uint32_t getHeight() const { return m_height; }
-        
+
+        /**
+         * @brief Get the number of mip levels in the image
+         * @return Mip level count (1 for non-mipmapped images)
+         */
+        uint32_t getMipLevels() const { return m_mipLevels; }
+
+        /**
+         * @brief Get the number of array layers in the image
+         * @return Array layer count (1 for plain 2D images)
+         */
+        uint32_t getArrayLayers() const { return m_arrayLayers; }
+
     private:
-        Image(VkDevice device, VmaAllocator allocator, 
+        Image(VkDevice device, VmaAllocator allocator,
             VkImage image, VmaAllocation allocation,
             VkImageView imageView,
-            uint32_t width, uint32_t height, VkFormat format);
+            uint32_t width, uint32_t height, VkFormat format,
+            uint32_t mipLevels, uint32_t arrayLayers);
         
         VkDevice m_device = VK_NULL_HANDLE;
         VmaAllocator m_allocator = VK_NULL_HANDLE;
@@ -301,6 +357,8 @@ namespace vkeng {
         VkImageView m_imageView = VK_NULL_HANDLE;
         uint32_t m_width, m_height;
         VkFormat m_format;
+        uint32_t m_mipLevels = 1;
+        uint32_t m_arrayLayers = 1;
     };
 
 } // namespace vkeng
\ No newline at end of file
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include <cstdint>
 
 namespace vkeng {
@@ -32,6 +33,14 @@ namespace vkeng {
             bool resizable = true;                  ///< Allow user to resize window
         } window;
 
+        /**
+         * @struct Input
+         * @brief Input sampling configuration
+         */
+        struct Input {
+            bool lateLatch = false;             ///< Re-poll input just before the view-matrix upload to cut up to a frame of camera latency
+        } input;
+
         /**
          * @struct Render
          * @brief Rendering configuration
@@ -39,6 +48,15 @@ namespace vkeng {
         struct Render {
             std::string vertexShaderPath = "shaders/vert.spv";      ///< Relative paths prefer build-staged shader output when available
             std::string fragmentShaderPath = "shaders/frag.spv";    ///< Relative paths prefer build-staged shader output when available
+            bool bindlessTextures = false;          ///< Opt-in bindless texture array; ignored when the device lacks descriptor indexing
+            bool indirectDraws = false;             ///< Opt-in indirect multi-draw path; requires bindlessTextures and device support
+            bool depthPrePass = false;              ///< Depth-only pre-pass so opaque pixels shade once; skip for vertex-bound scenes
+            std::string presentMode = "auto";       ///< "auto", "fifo", "fifo_relaxed", "mailbox", or "immediate"
+            uint32_t fpsLimit = 0;                  ///< Frame rate cap with hybrid sleep/spin pacing (0 = uncapped)
+            bool renderThread = false;              ///< Opt-in render thread: record/submit frame N while the update thread builds N+1
+            bool defragmentation = false;           ///< Incremental VMA defragmentation during frame-limiter headroom
+            bool dynamicResolution = false;         ///< Opt-in dynamic resolution: main pass extent scales with GPU frame time
+            float minRenderScale = 0.5f;            ///< Lower bound for the dynamic resolution scale (per axis)
         } render;
 
         /**
@@ -49,13 +67,119 @@ namespace vkeng {
             std::string assetsPath = "assets/";     ///< Relative paths prefer build-staged assets when available
         } assets;
 
+        /**
+         * @struct Jobs
+         * @brief Job system worker pool configuration
+         */
+        struct Jobs {
+            uint32_t workerThreads = 0;             ///< Worker count; 0 = hardware threads - 1
+            std::string affinity = "none";          ///< Worker pinning: "none", "compact" (fill one socket before the next), "spread" (alternate sockets), "physical" (skip SMT siblings)
+        } jobs;
+
+        /**
+         * @struct Logging
+         * @brief Logger backend configuration
+         */
+        struct Logging {
+            bool async = true;                      ///< Route log output through the background thread
+        } logging;
+
+        /**
+         * @struct Memory
+         * @brief Allocator configuration
+         */
+        struct Memory {
+            uint64_t frameArenaBytes = 4ull * 1024 * 1024;  ///< Per-frame bump arena for transient render data
+        } memory;
+
+        /**
+         * @struct Meshes
+         * @brief Mesh residency configuration
+         */
+        struct Meshes {
+            uint64_t vramBudgetBytes = 1ull << 30;  ///< Mesh VRAM budget before least-recently-drawn meshes are evicted (0 = unlimited)
+        } meshes;
+
+        /**
+         * @struct Textures
+         * @brief Texture upload and residency configuration
+         */
+        struct Textures {
+            bool generateMipmaps = true;            ///< Blit-generate full mip chains at upload
+            bool atlasSmallTextures = true;         ///< Pack small textures into shared atlas pages at load
+            uint64_t vramBudgetBytes = 2ull << 30;  ///< Texture VRAM budget before distant textures are demoted (0 = unlimited)
+        } textures;
+
+        /**
+         * @struct Tunables
+         * @brief Live-tunable settings control surface
+         *
+         * Subsystems register runtime-adjustable parameters with the
+         * Tunables registry (see core/Tunables.hpp); pointing controlFile
+         * at a path lets a running engine be tuned by editing that file.
+         */
+        struct Tunables {
+            std::string controlFile;            ///< Watched "name = value" file for live adjustments (empty = disabled)
+        } tunables;
+
+        /**
+         * @struct Watchdog
+         * @brief Frame hitch detection and capture configuration
+         *
+         * When enabled the engine keeps the CPU profiler rings recording
+         * in the background and writes a forensic report (recent CPU zones,
+         * GPU pass timings, scene and memory summary) whenever a frame
+         * blows past the threshold. Cheap enough to leave on in production.
+         */
+        struct Watchdog {
+            bool enabled = false;                   ///< Arm the hitch detector
+            float hitchThresholdMs = 33.4f;         ///< Frames slower than this trigger a report (~2 vsync periods at 60 Hz)
+            uint32_t maxReports = 16;               ///< Rotating report file count; oldest is overwritten
+            std::string reportDir = "hitches/";     ///< Directory for hitch_NNN.log reports
+        } watchdog;
+
+        /**
+         * @struct Telemetry
+         * @brief Fleet metrics export configuration
+         *
+         * When enabled the engine aggregates frame-time percentiles, GPU
+         * pass timings, draw counters, and VRAM usage over each interval
+         * and publishes them from a background thread: a local HTTP
+         * endpoint serving Prometheus text format, plus an optional
+         * rotating CSV for installations without a scraper.
+         */
+        struct Telemetry {
+            bool enabled = false;                   ///< Start the exporter thread
+            uint16_t httpPort = 9464;               ///< Prometheus text endpoint port (0 = HTTP disabled)
+            float intervalSeconds = 10.0f;          ///< Aggregation window per published snapshot
+            std::string csvPath;                    ///< Rotating metrics CSV path (empty = disabled)
+            uint64_t csvMaxBytes = 4ull << 20;      ///< CSV size that triggers rotation to csvPath.1, .2, ...
+            uint32_t csvMaxFiles = 4;               ///< Rotated CSV files kept before the oldest is dropped
+        } telemetry;
+
         /**
          * @struct Viewer
          * @brief Model viewer application configuration
          */
         struct Viewer {
             std::string modelPath = "cube.obj";     ///< Startup model path; relative paths prefer staged assets
+            std::vector<std::string> playlist;      ///< Exhibit rotation; the next entry prefetches in the background
+            uint32_t prefetchBudgetMb = 512;        ///< VRAM cap for prefetched/warm models (current model excluded)
         } viewer;
+
+        /**
+         * @struct Headless
+         * @brief Offscreen rendering mode for benchmarks and CI soak tests
+         *
+         * When enabled the engine skips GLFW entirely and renders into
+         * offscreen images sized by Config::Window; frame-time stats are
+         * printed on exit and optionally written per-frame to a CSV file.
+         */
+        struct Headless {
+            bool enabled = false;                   ///< Render offscreen without a display
+            uint32_t frameCount = 0;                ///< Stop after N rendered frames (0 = run until closed)
+            std::string statsCsvPath;               ///< Per-frame time CSV output path (empty = stdout summary only)
+        } headless;
     };
 
 } // namespace vkeng
@@ -0,0 +1,112 @@
+/**
+ * @file DeletionQueue.hpp
+ * @brief Frame-tagged deferred destruction of GPU resources
+ *
+ * Destroying a buffer or image the moment its last owner drops it is only
+ * safe after every frame that referenced it has finished on the GPU, so
+ * mid-session unloads used to choose between a vkDeviceWaitIdle stall and
+ * validation errors. The deletion queue removes that choice: destruction
+ * work is tagged with the frame it was requested in and executed once
+ * enough frames have retired that no in-flight command buffer can still
+ * reference the resource.
+ *
+ * Key Deferral Concepts:
+ * - Frame Tagging: each deferred destroy records the current frame tick
+ *   plus the frames-in-flight count as its earliest safe execution point
+ * - Retirement: the renderer calls retire() once per frame, right after
+ *   waiting this frame's fence/timeline value — at that point work
+ *   deferred a full frames-in-flight ago is provably GPU-idle
+ * - Transparent Integration: Buffer, Image, and DescriptorPool
+ *   destructors route through the queue automatically while it is
+ *   active, so owners keep plain shared_ptr lifetimes
+ * - Shutdown: flushAll() after vkDeviceWaitIdle runs everything pending;
+ *   before initialize() and after shutdown() destroys run inline
+ *
+ * @note Access via DeletionQueue::get(); Engine initializes and shuts it
+ *       down around the device's lifetime
+ */
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace vkeng {
+
+    /**
+     * @class DeletionQueue
+     * @brief Engine-wide queue of frame-tagged destruction callbacks
+     *
+     * Thread-safe: loaders and residency managers drop resources from
+     * worker threads while the render thread retires frames.
+     */
+    class DeletionQueue {
+    public:
+        /** @brief Gets the singleton instance. */
+        static DeletionQueue& get();
+
+        DeletionQueue(const DeletionQueue&) = delete;
+        DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+        /**
+         * @brief Activates deferral.
+         * @param framesInFlight Frames that may reference a resource
+         *        concurrently (Renderer::MAX_FRAMES_IN_FLIGHT)
+         */
+        void initialize(uint32_t framesInFlight);
+
+        /** @brief Whether destruction requests are currently being deferred. */
+        bool isActive() const { return m_active; }
+
+        /**
+         * @brief Queues destruction work, tagged with the current frame.
+         * @param destroy Callback releasing the GPU resource; runs on the
+         *        render thread during a later retire() (or flushAll())
+         *
+         * Runs the callback inline when the queue is not active, so
+         * startup and post-shutdown destruction keep their old behavior.
+         */
+        void defer(std::function<void()> destroy);
+
+        /**
+         * @brief Retires one frame and runs destruction that became safe.
+         *
+         * Call once per frame after the frame's fence or timeline wait:
+         * work deferred framesInFlight retires ago can no longer be
+         * referenced by any in-flight command buffer.
+         */
+        void retire();
+
+        /**
+         * @brief Runs every pending destruction immediately.
+         *
+         * Only valid when the GPU is known idle (after vkDeviceWaitIdle);
+         * used at swapchain teardown and engine shutdown.
+         */
+        void flushAll();
+
+        /** @brief Flushes pending work and deactivates deferral. */
+        void shutdown();
+
+        /** @brief Number of destruction requests still pending. */
+        size_t pendingCount() const;
+
+    private:
+        DeletionQueue() = default;
+        ~DeletionQueue();
+
+        /** @brief One deferred destruction and its earliest safe frame. */
+        struct Pending {
+            uint64_t retireTick;            ///< First retire() tick this may run in
+            std::function<void()> destroy;  ///< Resource release callback
+        };
+
+        mutable std::mutex m_mutex;        ///< Guards the queue (workers defer, render thread retires)
+        std::deque<Pending> m_pending;     ///< Oldest first; ticks are monotonic
+        uint64_t m_tick = 0;               ///< Retired-frame counter
+        uint32_t m_framesInFlight = 0;     ///< Deferral distance in frames
+        bool m_active = false;             ///< Deferring (vs inline destruction)
+    };
+
+} // namespace vkeng
@@ -20,8 +20,11 @@
 #include "vulkan-engine/core/VulkanDevice.hpp"
 #include "vulkan-engine/core/VulkanInstance.hpp"
 #include "vulkan-engine/core/VulkanSwapChain.hpp"
+#include "vulkan-engine/core/HitchWatchdog.hpp"
 #include "vulkan-engine/core/InputManager.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
 #include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/core/TelemetryExporter.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 #include "vulkan-engine/core/Time.hpp"
 #include "vulkan-engine/rendering/DescriptorSet.hpp"
@@ -30,11 +33,31 @@
 #include "vulkan-engine/audio/AudioEngine.hpp"
 
 #include <GLFW/glfw3.h>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace vkeng {
 
+    /**
+     * @struct InputLatencyStats
+     * @brief Rolling input-to-present latency statistics
+     *
+     * Measures from the OS delivery timestamp of the newest input event to
+     * the completion of that frame's present call, on the CPU clock. Display
+     * scanout time is not included (that would need VK_GOOGLE_display_timing),
+     * but the metric shifts with the same pipeline changes as true
+     * input-to-photon latency, so it is a usable proxy for comparing
+     * configurations — e.g. late-latch on versus off.
+     */
+    struct InputLatencyStats {
+        double averageMs = 0.0;     ///< Mean latency over the sample window
+        double minMs = 0.0;         ///< Fastest sample in the window
+        double maxMs = 0.0;         ///< Slowest sample in the window
+        uint64_t sampleCount = 0;   ///< Total samples recorded since startup
+    };
+
     /**
      * @class Engine
      * @brief Base class for Vulkan applications providing core infrastructure
@@ -85,6 +108,31 @@ namespace vkeng {
          */
         void run();
 
+        /**
+         * @brief Caps the frame rate with hybrid sleep/spin pacing.
+         * @param fps Target frames per second; 0 disables the limiter
+         *
+         * The frame loop sleeps until shortly before the target frame
+         * deadline, then spins for the remainder — OS sleep granularity
+         * alone overshoots by up to a scheduler quantum. Initialized from
+         * Config::render.fpsLimit; this setter changes it at runtime.
+         * Ignored in headless mode (soak runs want maximum throughput).
+         */
+        void setFrameRateLimit(uint32_t fps) { fpsLimit_ = fps; }
+
+        /** @brief Gets the current frame rate cap (0 = uncapped). */
+        uint32_t getFrameRateLimit() const { return fpsLimit_; }
+
+        /**
+         * @brief Gets rolling input-to-present latency statistics.
+         * @return Stats over the last INPUT_LATENCY_WINDOW samples
+         *
+         * One sample is recorded per frame that presented after new input
+         * arrived; frames without fresh input contribute nothing. Always
+         * empty in headless mode (no input source).
+         */
+        InputLatencyStats getInputLatencyStats() const;
+
     protected:
         // ============================================================================
         // Lifecycle Hooks - Must be implemented by derived classes
@@ -138,19 +186,22 @@ namespace vkeng {
         // Initialization Helpers
         // ============================================================================
         
-        /** 
+        /**
          * @brief Initializes GLFW and creates the window
-         * 
+         *
          * Creates a GlfwWindow using the config settings and initializes
-         * the input manager with the native window handle.
+         * the input manager with the native window handle. In headless mode
+         * (Config::Headless) GLFW is skipped entirely and a HeadlessWindow
+         * is created instead.
          */
         void initWindow();
-        
-        /** 
+
+        /**
          * @brief Initializes core Vulkan objects
-         * 
+         *
          * Creates Vulkan instance, surface, device, memory manager, and swapchain.
-         * Must be called after initWindow().
+         * Must be called after initWindow(). Headless mode omits the surface
+         * and backs the swapchain with offscreen images.
          */
         void initVulkanCore();
 
@@ -167,11 +218,80 @@ namespace vkeng {
          */
         void setSceneRoot(SceneNode* root) { m_sceneRoot = root; }
 
+        /**
+         * @brief Access the engine-wide job system for parallel work.
+         * @return Reference to the shared worker pool.
+         *
+         * The pool is started in the Engine constructor (sized by
+         * Config::Jobs) and drained in the destructor; derived applications
+         * schedule work and parallelFor loops through it instead of spawning
+         * their own threads.
+         */
+        JobSystem& getJobSystem() { return JobSystem::get(); }
+
+        /**
+         * @brief The hitch watchdog, or null when disabled.
+         *
+         * Enabled through Config::Watchdog. Applications that own a
+         * Renderer should wire setDrawStatsProvider() from onInit() so
+         * hitch reports include draw counts.
+         */
+        HitchWatchdog* getHitchWatchdog() const { return hitchWatchdog_.get(); }
+
+        /**
+         * @brief The telemetry exporter, or null when disabled.
+         *
+         * Enabled through Config::Telemetry. Applications that own a
+         * Renderer should wire setDrawStatsProvider() from onInit() so
+         * published snapshots include draw counters.
+         */
+        TelemetryExporter* getTelemetryExporter() const { return telemetryExporter_.get(); }
+
+        // ============================================================================
+        // Multi-Window Output
+        // ============================================================================
+
+        /** @brief A secondary output: own window, surface, and swapchain on the shared device. */
+        struct AuxiliaryWindow {
+            std::unique_ptr<IWindow> window;
+            VkSurfaceKHR surface = VK_NULL_HANDLE;
+            std::unique_ptr<VulkanSwapChain> swapChain;
+        };
+
+        /**
+         * @brief Create an additional window presenting from the shared device.
+         * @param title Window title
+         * @param width,height Initial window size in screen coordinates
+         * @return The new output; owned by Engine, valid until shutdown
+         *
+         * Multi-output setups (video walls, editor viewports) render the
+         * same scene from several cameras. Every auxiliary window shares
+         * the one VulkanDevice, MemoryManager, and — when the app routes
+         * its renderers through one PipelineManager — the full pipeline and
+         * resource set, so N outputs cost one copy of every GPU resource
+         * instead of N processes. Apps build one Renderer per output
+         * against the returned swapchain; Renderer::shareShadowsFrom()
+         * lets the extra outputs sample the primary's shadow map instead
+         * of re-rendering it.
+         *
+         * Call from onInit() or later (the device must exist). Not
+         * available in headless mode. Presentation support is assumed to
+         * match the primary surface's queue family, which holds on every
+         * desktop platform we target.
+         */
+        AuxiliaryWindow& createAuxiliaryWindow(const std::string& title, int width, int height);
+
+        /** @brief All auxiliary windows created so far. */
+        const std::vector<std::unique_ptr<AuxiliaryWindow>>& getAuxiliaryWindows() const {
+            return auxiliaryWindows_;
+        }
+
         // ============================================================================
         // Core Systems - Available to derived classes
         // ============================================================================
 
         Config config_;                                 ///< Engine configuration
+        uint32_t fpsLimit_ = 0;                         ///< Frame rate cap (0 = uncapped); see setFrameRateLimit()
         std::unique_ptr<IWindow> window_;               ///< Window abstraction
         std::unique_ptr<InputManager> inputManager_;    ///< Keyboard/mouse input handler
         std::unique_ptr<VulkanInstance> instance_;      ///< Vulkan instance
@@ -179,6 +299,7 @@ namespace vkeng {
         std::unique_ptr<VulkanDevice> device_;          ///< Logical and physical device wrapper
         std::shared_ptr<MemoryManager> memoryManager_;  ///< VMA-based memory allocator
         std::unique_ptr<VulkanSwapChain> swapChain_;    ///< Swapchain for presentation
+        std::vector<std::unique_ptr<AuxiliaryWindow>> auxiliaryWindows_; ///< Secondary outputs on the shared device
         std::shared_ptr<Texture> fallbackTexture_;      ///< 1x1 white fallback for unbound texture slots
         std::shared_ptr<Texture> fallbackNormalTexture_;  ///< 1x1 flat normal (128,128,255,255) for normal map slots
         std::shared_ptr<Texture> fallbackMRTexture_;      ///< 1x1 default metallic-roughness (0, roughness=0.5) for MR slots
@@ -189,6 +310,8 @@ namespace vkeng {
 
         std::unique_ptr<PhysicsWorld> physicsWorld_;    ///< Physics simulation
         std::unique_ptr<AudioEngine> audioEngine_;      ///< Audio playback and spatial sound
+        std::unique_ptr<HitchWatchdog> hitchWatchdog_;  ///< Frame hitch capture; null when disabled
+        std::unique_ptr<TelemetryExporter> telemetryExporter_; ///< Fleet metrics export; null when disabled
         SceneNode* m_sceneRoot = nullptr;               ///< Non-owning pointer to the scene root
 
     private:
@@ -198,6 +321,51 @@ namespace vkeng {
          * @param description Human-readable error description
          */
         static void glfwErrorCallback(int error, const char* description);
+
+        /**
+         * @brief Reports frame-time statistics after a headless run
+         * @param frameTimesMs Wall time of each rendered frame in milliseconds
+         *
+         * Logs average/min/max and percentile frame times, and writes the
+         * raw per-frame series to Config::Headless::statsCsvPath if set.
+         */
+        void reportHeadlessStats(const std::vector<double>& frameTimesMs) const;
+
+        /**
+         * @brief Records one input-to-present latency sample after a present
+         *
+         * Compares the InputManager's newest event timestamp against "now"
+         * (called right after onRender() returns, i.e. once the frame's
+         * present has been queued). Skips frames where no new input arrived
+         * since the previous sample. Logs a rolling summary every
+         * INPUT_LATENCY_WINDOW samples.
+         */
+        void recordInputLatency();
+
+        /**
+         * @brief Records one named startup phase duration for the boot report
+         *
+         * Phases are appended in completion order during construction and
+         * logged by reportStartupPhases() once the engine is ready, so boot
+         * regressions show which stage grew instead of just the total.
+         */
+        void recordStartupPhase(const char* name, double ms);
+
+        /** @brief Logs the per-phase startup timing report. */
+        void reportStartupPhases(double totalMs) const;
+
+        /** @brief One timed stage of engine construction. */
+        struct StartupPhase {
+            const char* name;   ///< Stage label for the report
+            double ms;          ///< Wall time spent in the stage
+        };
+        std::vector<StartupPhase> startupPhases_;               ///< Boot stages in completion order
+
+        static constexpr size_t INPUT_LATENCY_WINDOW = 240;     ///< Rolling sample window (matches present stats)
+        std::vector<double> inputLatencySamplesMs_;             ///< Ring buffer of latency samples
+        size_t inputLatencyCursor_ = 0;                         ///< Next write slot in the ring
+        uint64_t inputLatencyCount_ = 0;                        ///< Total samples recorded since startup
+        std::chrono::steady_clock::time_point lastSampledInputEvent_{};  ///< Event timestamp of the previous sample
     };
 
 } // namespace vkeng
@@ -4,7 +4,8 @@
  *
  * Allows subsystems (physics, audio, rendering) to communicate without
  * depending on each other directly. Events are identified by type and
- * dispatched synchronously to registered listeners.
+ * dispatched synchronously to registered listeners, or deferred through a
+ * lock-free queue and dispatched in batch from the main loop.
  *
  * Usage:
  * @code
@@ -26,12 +27,18 @@
  */
 #pragma once
 
-#include <functional>
-#include <vector>
-#include <unordered_map>
-#include <typeindex>
-#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace vkeng {
 
@@ -42,8 +49,17 @@ namespace vkeng {
      * @class EventSystem
      * @brief Singleton type-safe event bus
      *
-     * Events are any copyable struct. Listeners are std::function callbacks
-     * keyed by std::type_index. Dispatch is synchronous (same frame).
+     * Events are any copyable struct. Listeners are callables keyed by
+     * std::type_index, stored in dense per-type slabs with small captures
+     * held inline (see ListenerCallback). Two dispatch modes exist:
+     *
+     * - publish(): invokes listeners synchronously at the call site. Use for
+     *   latency-critical paths (input, body registry bookkeeping).
+     * - publishDeferred(): pushes the event onto a lock-free multi-producer
+     *   queue; drainDeferred() — called once per frame from Engine::run —
+     *   dispatches the backlog in batch on the main thread. Use for bursty
+     *   producers (physics contacts) and for publishing from worker threads,
+     *   since listener lists themselves are not thread-safe.
      */
     class EventSystem {
     public:
@@ -56,11 +72,11 @@ namespace vkeng {
          * @param callback Function to invoke when T is published.
          * @return A listener ID that can be passed to unsubscribe().
          */
-        template<typename T>
-        EventListenerId subscribe(std::function<void(const T&)> callback) {
+        template<typename T, typename Fn>
+        EventListenerId subscribe(Fn&& callback) {
             EventListenerId id = m_nextId++;
-            auto& listeners = getListeners<T>();
-            listeners.push_back({id, std::move(callback)});
+            auto& list = getListeners<T>();
+            list.entries.emplace_back(id, std::forward<Fn>(callback));
             return id;
         }
 
@@ -68,14 +84,21 @@ namespace vkeng {
          * @brief Remove a previously registered listener.
          * @tparam T The event type the listener was registered for.
          * @param id The listener ID returned by subscribe().
+         *
+         * O(n) lookup but O(1) removal: the entry is only marked dead here
+         * and compacted out in one bulk sweep before the next dispatch.
+         * Safe to call from inside a listener of the same event type.
          */
         template<typename T>
         void unsubscribe(EventListenerId id) {
-            auto& listeners = getListeners<T>();
-            listeners.erase(
-                std::remove_if(listeners.begin(), listeners.end(),
-                    [id](const auto& entry) { return entry.id == id; }),
-                listeners.end());
+            auto& list = getListeners<T>();
+            for (auto& entry : list.entries) {
+                if (entry.id == id) {
+                    entry.id = kDeadListener;
+                    list.deadCount++;
+                    return;
+                }
+            }
         }
 
         /**
@@ -83,16 +106,60 @@ namespace vkeng {
          * @tparam T The event struct type.
          * @param event The event data to broadcast.
          *
-         * Listeners are invoked synchronously in registration order.
+         * Listeners are invoked synchronously in registration order. The
+         * entries are fixed-size and contiguous, and small captures live
+         * inline in the entry, so dispatch walks a dense array instead of
+         * chasing std::function heap blocks. Listeners subscribed during
+         * dispatch first fire on the next publish.
          */
         template<typename T>
         void publish(const T& event) {
-            auto& listeners = getListeners<T>();
-            for (auto& entry : listeners) {
-                entry.callback(event);
+            auto& list = getListeners<T>();
+            if (list.deadCount > 0 && list.publishDepth == 0) {
+                list.sweep();
             }
+
+            list.publishDepth++;
+            const size_t count = list.entries.size();
+            for (size_t i = 0; i < count; ++i) {
+                auto& entry = list.entries[i];
+                if (entry.id != kDeadListener) {
+                    entry.callback(event);
+                }
+            }
+            list.publishDepth--;
         }
 
+        /**
+         * @brief Queue an event for batched dispatch from the main loop.
+         * @tparam T The event struct type.
+         * @param event The event data; copied into the queue node.
+         *
+         * Producers push with a lock-free CAS loop and never block each
+         * other, so this is safe from any thread and O(1) at the publish
+         * site — a physics contact burst costs one small allocation per
+         * event instead of running every listener mid-step.
+         */
+        template<typename T>
+        void publishDeferred(const T& event) {
+            auto* node = new DeferredEvent<T>(event);
+            node->next = m_deferredHead.load(std::memory_order_relaxed);
+            while (!m_deferredHead.compare_exchange_weak(
+                       node->next, node,
+                       std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        /**
+         * @brief Dispatch all deferred events queued since the last drain.
+         *
+         * Call from one thread only (Engine::run). Events dispatch in the
+         * order they were queued; events deferred by listeners during the
+         * drain are picked up by the next drain, so a drain always
+         * terminates.
+         */
+        void drainDeferred();
+
         /** @brief Remove all listeners for all event types. */
         void clearAll();
 
@@ -107,32 +174,164 @@ namespace vkeng {
             virtual ~ListenerListBase() = default;
         };
 
-        /** @brief Typed listener list for a specific event type. */
+        /** @brief Intrusive node in the lock-free deferred queue. */
+        struct DeferredEventBase {
+            DeferredEventBase* next = nullptr;
+            virtual ~DeferredEventBase() = default;
+
+            /** @brief Dispatch the stored event through synchronous publish. */
+            virtual void dispatch(EventSystem& system) = 0;
+        };
+
+        /** @brief Typed deferred event holding a copy of the payload. */
+        template<typename T>
+        struct DeferredEvent : DeferredEventBase {
+            explicit DeferredEvent(const T& e) : event(e) {}
+            void dispatch(EventSystem& system) override { system.publish(event); }
+            T event;
+        };
+
+        /** @brief Marks an entry awaiting compaction by the next sweep. */
+        static constexpr EventListenerId kDeadListener = 0;
+
+        /**
+         * @brief Type-erased listener callable with inline capture storage.
+         *
+         * Captures up to kInlineCaptureBytes are constructed directly inside
+         * the entry (no heap allocation, no pointer chase at dispatch);
+         * larger callables degrade to a single heap block behind the same
+         * function-pointer interface. Move-only, like the listener list.
+         */
+        template<typename T>
+        class ListenerCallback {
+        public:
+            /// Covers a this-pointer plus a handful of captured values;
+            /// sized so an Entry stays within ~1.5 cache lines
+            static constexpr size_t kInlineCaptureBytes = 64;
+
+            template<typename Fn,
+                     typename = std::enable_if_t<!std::is_same_v<std::decay_t<Fn>, ListenerCallback>>>
+            ListenerCallback(Fn&& fn) {  // Implicit by design, mirrors std::function
+                using Decayed = std::decay_t<Fn>;
+                if constexpr (sizeof(Decayed) <= kInlineCaptureBytes &&
+                              alignof(Decayed) <= alignof(std::max_align_t)) {
+                    new (m_storage) Decayed(std::forward<Fn>(fn));
+                    m_invoke = [](void* s, const T& e) {
+                        (*static_cast<Decayed*>(s))(e);
+                    };
+                    m_relocate = [](void* src, void* dst) {
+                        auto* from = static_cast<Decayed*>(src);
+                        new (dst) Decayed(std::move(*from));
+                        from->~Decayed();
+                    };
+                    m_destroy = [](void* s) { static_cast<Decayed*>(s)->~Decayed(); };
+                } else {
+                    auto* heap = new Decayed(std::forward<Fn>(fn));
+                    std::memcpy(m_storage, &heap, sizeof(heap));
+                    m_invoke = [](void* s, const T& e) {
+                        Decayed* fn;
+                        std::memcpy(&fn, s, sizeof(fn));
+                        (*fn)(e);
+                    };
+                    m_relocate = [](void* src, void* dst) {
+                        std::memcpy(dst, src, sizeof(Decayed*));
+                    };
+                    m_destroy = [](void* s) {
+                        Decayed* fn;
+                        std::memcpy(&fn, s, sizeof(fn));
+                        delete fn;
+                    };
+                }
+            }
+
+            ListenerCallback(ListenerCallback&& other) noexcept
+                : m_invoke(other.m_invoke),
+                  m_relocate(other.m_relocate),
+                  m_destroy(other.m_destroy) {
+                m_relocate(other.m_storage, m_storage);
+                other.m_destroy = nullptr;
+            }
+
+            ListenerCallback& operator=(ListenerCallback&& other) noexcept {
+                if (this != &other) {
+                    if (m_destroy) m_destroy(m_storage);
+                    m_invoke = other.m_invoke;
+                    m_relocate = other.m_relocate;
+                    m_destroy = other.m_destroy;
+                    m_relocate(other.m_storage, m_storage);
+                    other.m_destroy = nullptr;
+                }
+                return *this;
+            }
+
+            ListenerCallback(const ListenerCallback&) = delete;
+            ListenerCallback& operator=(const ListenerCallback&) = delete;
+
+            ~ListenerCallback() {
+                if (m_destroy) m_destroy(m_storage);
+            }
+
+            void operator()(const T& event) { m_invoke(m_storage, event); }
+
+        private:
+            alignas(std::max_align_t) unsigned char m_storage[kInlineCaptureBytes];
+            void (*m_invoke)(void*, const T&);
+            void (*m_relocate)(void*, void*);   ///< Destructive move src -> dst (vector growth, sweeps)
+            void (*m_destroy)(void*);           ///< Null after being moved from
+        };
+
+        /**
+         * @brief Typed listener list for a specific event type.
+         *
+         * The entries vector is the slab: fixed-size entries, contiguous,
+         * iterated densely by publish(). unsubscribe() only marks entries
+         * dead; sweep() compacts them out in one pass before a dispatch,
+         * never during one (publishDepth guards re-entrant publishes).
+         */
         template<typename T>
         struct ListenerList : ListenerListBase {
             struct Entry {
-                EventListenerId id;
-                std::function<void(const T&)> callback;
+                template<typename Fn>
+                Entry(EventListenerId listenerId, Fn&& fn)
+                    : id(listenerId), callback(std::forward<Fn>(fn)) {}
+
+                EventListenerId id;         ///< kDeadListener once unsubscribed
+                ListenerCallback<T> callback;
             };
+
             std::vector<Entry> entries;
+            uint32_t deadCount = 0;     ///< Entries awaiting the next sweep
+            uint32_t publishDepth = 0;  ///< Re-entrant publish() nesting level
+
+            /** @brief Compacts dead entries out in a single bulk pass. */
+            void sweep() {
+                entries.erase(
+                    std::remove_if(entries.begin(), entries.end(),
+                        [](const Entry& entry) { return entry.id == kDeadListener; }),
+                    entries.end());
+                deadCount = 0;
+            }
         };
 
         /** @brief Get or create the typed listener list for event type T. */
         template<typename T>
-        std::vector<typename ListenerList<T>::Entry>& getListeners() {
+        ListenerList<T>& getListeners() {
             auto key = std::type_index(typeid(T));
             auto it = m_listeners.find(key);
             if (it == m_listeners.end()) {
                 auto list = std::make_unique<ListenerList<T>>();
-                auto& entries = list->entries;
+                auto& ref = *list;
                 m_listeners[key] = std::move(list);
-                return entries;
+                return ref;
             }
-            return static_cast<ListenerList<T>*>(it->second.get())->entries;
+            return *static_cast<ListenerList<T>*>(it->second.get());
         }
 
         std::unordered_map<std::type_index, std::unique_ptr<ListenerListBase>> m_listeners;
         EventListenerId m_nextId = 1;
+
+        /** @brief Head of the deferred queue (LIFO; drain reverses to FIFO). */
+        std::atomic<DeferredEventBase*> m_deferredHead{nullptr};
     };
 
 } // namespace vkeng
@@ -0,0 +1,57 @@
+/**
+ * @file FileMapping.hpp
+ * @brief RAII read-only memory mapping of a whole file
+ *
+ * The binary cache readers (MeshCache, TextureCache) hand mapped blobs
+ * straight to the GPU upload path; this wraps the platform mapping calls
+ * so those readers stay free of platform-specific code. POSIX builds use
+ * mmap, Windows builds use CreateFileMapping/MapViewOfFile — same
+ * zero-copy semantics on both.
+ */
+#pragma once
+
+#include "vulkan-engine/core/Result.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace vkeng {
+
+    /**
+     * @class FileMapping
+     * @brief Owns a read-only mapping of an entire file
+     *
+     * Valid instances expose the mapped bytes until destruction; keep the
+     * object alive as long as any pointer into data() is in use. Move-only,
+     * like the mapped cache views built on top of it.
+     */
+    class FileMapping {
+    public:
+        FileMapping() = default;
+
+        /** @brief Unmaps the file, invalidating all pointers into data(). */
+        ~FileMapping();
+
+        FileMapping(const FileMapping&) = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+        FileMapping(FileMapping&& other) noexcept;
+        FileMapping& operator=(FileMapping&& other) noexcept;
+
+        /**
+         * @brief Map an existing file read-only in its entirety
+         * @return Error if the file is missing, empty, or cannot be mapped
+         */
+        static Result<FileMapping> open(const std::string& path);
+
+        const void* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+        /** @brief True when a mapping is held. */
+        explicit operator bool() const { return m_data != nullptr; }
+
+    private:
+        void* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+} // namespace vkeng
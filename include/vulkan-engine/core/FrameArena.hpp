@@ -0,0 +1,123 @@
+/**
+ * @file FrameArena.hpp
+ * @brief Bump allocator for per-frame transient allocations
+ *
+ * The renderer rebuilds its draw lists, light lists, and instance scratch
+ * every frame; funnelling those through the general-purpose heap costs
+ * malloc time each frame and fragments the heap over long sessions. The
+ * frame arena hands out memory by bumping a pointer through one block
+ * sized at startup, and reclaims everything at once when the frame's
+ * containers are reset.
+ *
+ * Key Arena Concepts:
+ * - Bump Allocation: an allocation is an aligned pointer increment; there
+ *   is no per-allocation free
+ * - Double Buffering: the arena alternates between two blocks, one per
+ *   reset. A frame's allocations therefore stay valid through the NEXT
+ *   frame's reset — which lets a render thread consume frame N's packet
+ *   while the update thread builds N+1 in the other block
+ * - Frame Reset: reset() flips to the other block and rewinds it; arena
+ *   memory from two resets ago is invalid afterwards, so containers
+ *   backed by the arena must be re-created (not just cleared) each frame
+ * - Overflow: allocations that do not fit fall back to the heap and are
+ *   freed two resets later (same lifetime as block memory); the overflow
+ *   count signals an undersized arena without ever failing an allocation
+ *
+ * FrameArenaAllocator adapts the arena to the std allocator interface so
+ * std::vector and friends can live in it (see FrameVector).
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    class FrameArena {
+    public:
+        static FrameArena& get();
+
+        /**
+         * @brief Allocates the arena blocks; call once at startup
+         * @param capacityBytes Per-block arena size (Config::Memory::frameArenaBytes)
+         */
+        void initialize(size_t capacityBytes);
+
+        /**
+         * @brief Flips to the other block and rewinds it
+         *
+         * Everything allocated before the PREVIOUS reset is invalid after
+         * this returns; the last frame's allocations survive one more
+         * frame (the render thread may still be reading them). Call at
+         * frame start, before any per-frame container is touched.
+         */
+        void reset();
+
+        /**
+         * @brief Allocates from the arena, falling back to the heap on overflow
+         * @param size Bytes to allocate
+         * @param alignment Required alignment (power of two)
+         * @return Never null; overflow allocations are freed at reset()
+         */
+        void* allocate(size_t size, size_t alignment);
+
+        size_t getUsedBytes() const { return m_offset; }
+        size_t getCapacityBytes() const { return m_capacity; }
+        size_t getOverflowCount() const { return m_overflowCount; }
+        size_t getHighWaterBytes() const { return m_highWater; }
+
+        /** @brief Releases the arena block (engine shutdown). */
+        void shutdown();
+
+    private:
+        FrameArena() = default;
+
+        std::unique_ptr<uint8_t[]> m_blocks[2];
+        size_t m_capacity = 0;
+        size_t m_offset = 0;
+        size_t m_active = 0;
+        size_t m_highWater = 0;
+        size_t m_overflowCount = 0;
+        std::vector<void*> m_overflowBlocks[2];
+    };
+
+    /**
+     * @class FrameArenaAllocator
+     * @brief std-compatible allocator backed by the frame arena
+     *
+     * deallocate() is a no-op — arena memory is reclaimed wholesale by
+     * FrameArena::reset(), and overflow blocks are freed there too. All
+     * instances share the singleton arena, so any two allocators compare
+     * equal.
+     */
+    template <typename T>
+    class FrameArenaAllocator {
+    public:
+        using value_type = T;
+
+        FrameArenaAllocator() = default;
+        template <typename U>
+        FrameArenaAllocator(const FrameArenaAllocator<U>&) {}
+
+        T* allocate(size_t count) {
+            return static_cast<T*>(
+                FrameArena::get().allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, size_t) {
+            // Reclaimed by FrameArena::reset()
+        }
+
+        template <typename U>
+        bool operator==(const FrameArenaAllocator<U>&) const { return true; }
+        template <typename U>
+        bool operator!=(const FrameArenaAllocator<U>&) const { return false; }
+    };
+
+    /// std::vector living in the frame arena; re-create (assign {}) after reset()
+    template <typename T>
+    using FrameVector = std::vector<T, FrameArenaAllocator<T>>;
+
+} // namespace vkeng
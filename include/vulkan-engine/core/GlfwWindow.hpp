@@ -64,6 +64,9 @@ namespace vkeng {
         /** @brief Sets the callback for framebuffer resize events */
         void setResizeCallback(ResizeCallback callback) override;
 
+        /** @brief Flags the window to close, as if the close button was pressed */
+        void requestClose() override;
+
     private:
         GLFWwindow* m_window{nullptr};      ///< Native GLFW window handle
         ResizeCallback m_resizeCallback;    ///< User-provided resize callback
@@ -0,0 +1,174 @@
+/**
+ * @file Handle.hpp
+ * @brief Generation-checked 32-bit handles for GPU objects on draw paths
+ *
+ * Draw lists used to carry shared_ptr<Mesh> per draw call, so every copy —
+ * packet building, the radix-sort ping-pong, instancing prototypes — paid
+ * refcount atomics per element per frame. A Handle is a plain 32-bit value:
+ * copying one is a register move, and resolving it is an array index plus a
+ * generation compare.
+ *
+ * Key Handle Concepts:
+ * - Intrusive Registration: objects register themselves in their type's
+ *   pool on construction and unregister in their destructor, so a handle
+ *   never outlives a valid object silently — it just goes stale
+ * - Generation Check: each slot carries a generation bumped on release;
+ *   resolving a stale handle returns nullptr instead of a dangling pointer,
+ *   and slot reuse can never alias an old handle to a new object
+ * - Non-Owning: handles never extend lifetime. Ownership stays with
+ *   shared_ptr at the ResourceManager/scene boundary, and GPU safety for
+ *   mid-flight destruction comes from the DeletionQueue deferring the
+ *   underlying buffer destroys
+ * - Encoding: low 16 bits slot index, high 16 bits generation; value 0 is
+ *   the null handle (generations start at 1 and skip 0 on wrap)
+ *
+ * @note resolve() is lock-free; registration and release take the pool
+ *       mutex. Like the rest of the frame pipeline, this assumes objects
+ *       are not destroyed concurrently with draw recording — scene unloads
+ *       happen between frames.
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vkeng {
+
+    template <typename T>
+    class HandlePool;
+
+    /**
+     * @class Handle
+     * @brief 32-bit non-owning reference to a pool-registered object
+     *
+     * Dereferencing resolves through the type's pool: nullptr (and a falsy
+     * bool conversion) for null or stale handles. operator-> and operator*
+     * are for call sites that already checked validity this frame.
+     */
+    template <typename T>
+    class Handle {
+    public:
+        Handle() = default;
+
+        /** @brief Resolves to the object, or nullptr when null or stale. */
+        T* get() const;
+
+        T* operator->() const { return get(); }
+        T& operator*() const { return *get(); }
+
+        /** @brief True when the handle currently resolves to a live object. */
+        explicit operator bool() const { return get() != nullptr; }
+
+        bool operator==(const Handle& other) const { return m_value == other.m_value; }
+        bool operator!=(const Handle& other) const { return m_value != other.m_value; }
+
+        /** @brief Raw packed value (index | generation); 0 is null. Stable sort/map key. */
+        uint32_t value() const { return m_value; }
+
+    private:
+        friend class HandlePool<T>;
+        explicit Handle(uint32_t value) : m_value(value) {}
+
+        uint32_t m_value = 0;
+    };
+
+    /**
+     * @class HandlePool
+     * @brief Type-specific slot pool backing Handle<T> resolution
+     *
+     * One pool per handle type, accessed via get(). Slot storage is
+     * allocated once at the maximum count and never moves, so resolve()
+     * reads slots without taking the mutex.
+     */
+    template <typename T>
+    class HandlePool {
+    public:
+        /// Hard cap on simultaneously registered objects (16-bit slot index)
+        static constexpr uint32_t kMaxHandles = 1u << 16;
+
+        /** @brief Gets the pool for T. */
+        static HandlePool& get() {
+            static HandlePool pool;
+            return pool;
+        }
+
+        HandlePool(const HandlePool&) = delete;
+        HandlePool& operator=(const HandlePool&) = delete;
+
+        /**
+         * @brief Registers an object and returns its handle.
+         * @return The null handle when the pool is exhausted (the object is
+         *         then only reachable through its owning shared_ptr)
+         */
+        Handle<T> add(T* object) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            uint32_t index;
+            if (!m_freeList.empty()) {
+                index = m_freeList.back();
+                m_freeList.pop_back();
+            } else if (m_slotCount < kMaxHandles) {
+                index = m_slotCount++;
+            } else {
+                return Handle<T>();
+            }
+            Slot& slot = m_slots[index];
+            slot.object = object;
+            return Handle<T>((slot.generation << 16) | index);
+        }
+
+        /**
+         * @brief Releases a handle's slot, staling every copy of the handle.
+         *
+         * Called from the object's destructor; bumping the generation makes
+         * resolve() return nullptr for outstanding copies immediately.
+         */
+        void remove(Handle<T> handle) {
+            if (handle.m_value == 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_mutex);
+            uint32_t index = handle.m_value & 0xFFFFu;
+            Slot& slot = m_slots[index];
+            if (slot.generation != (handle.m_value >> 16)) {
+                return; // Already released (double remove is a no-op)
+            }
+            slot.object = nullptr;
+            slot.generation = (slot.generation + 1) & 0xFFFFu;
+            if (slot.generation == 0) {
+                slot.generation = 1; // Generation 0 is reserved for null
+            }
+            m_freeList.push_back(index);
+        }
+
+        /** @brief Resolves a handle; nullptr when null or stale. Lock-free. */
+        T* resolve(Handle<T> handle) const {
+            if (handle.m_value == 0) {
+                return nullptr;
+            }
+            const Slot& slot = m_slots[handle.m_value & 0xFFFFu];
+            return slot.generation == (handle.m_value >> 16) ? slot.object : nullptr;
+        }
+
+    private:
+        HandlePool() : m_slots(new Slot[kMaxHandles]) {}
+
+        /** @brief One registered object and the generation its handles must match. */
+        struct Slot {
+            T* object = nullptr;
+            uint32_t generation = 1; ///< Never 0; bumped on every release
+        };
+
+        std::unique_ptr<Slot[]> m_slots; ///< Fixed storage so resolve() needs no lock
+        std::vector<uint32_t> m_freeList;
+        uint32_t m_slotCount = 0;        ///< High-water mark of allocated slots
+        std::mutex m_mutex;              ///< Guards add/remove (loads on workers)
+    };
+
+    template <typename T>
+    T* Handle<T>::get() const {
+        return HandlePool<T>::get().resolve(*this);
+    }
+
+} // namespace vkeng
@@ -0,0 +1,71 @@
+/**
+ * @file HeadlessWindow.hpp
+ * @brief Headless (offscreen) implementation of the IWindow interface
+ *
+ * This file contains the HeadlessWindow class which satisfies the IWindow
+ * contract without any windowing system. It is used by the engine's
+ * headless mode (Config::Headless) for benchmarks and CI soak tests where
+ * no display is available.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/interfaces/IWindow.hpp"
+
+namespace vkeng {
+
+    /**
+     * @class HeadlessWindow
+     * @brief Display-less window implementation for offscreen rendering
+     *
+     * Reports a fixed framebuffer size, requires no instance extensions, and
+     * never creates a surface. Event polling is a no-op and shouldClose()
+     * reflects an internal flag set via requestClose(), which the engine
+     * uses to stop after a configured frame count.
+     *
+     * @note Does not depend on GLFW; safe to construct without glfwInit()
+     */
+    class HeadlessWindow : public IWindow {
+    public:
+        /**
+         * @brief Creates a headless window with a fixed framebuffer size
+         * @param width Offscreen framebuffer width in pixels
+         * @param height Offscreen framebuffer height in pixels
+         */
+        HeadlessWindow(int width, int height);
+
+        /** @brief Checks if requestClose() has been called */
+        bool shouldClose() const override;
+
+        /** @brief No-op; there are no events in headless mode */
+        void pollEvents() override;
+
+        /** @brief No-op; there are no events to wait for */
+        void waitEvents() override;
+
+        /** @brief Gets the fixed offscreen framebuffer dimensions */
+        void getFramebufferSize(int& width, int& height) const override;
+
+        /** @brief Returns nullptr; there is no native window */
+        void* getNativeHandle() const override;
+
+        /** @brief Returns an empty list; no surface extensions are needed */
+        std::vector<const char*> getRequiredExtensions() const override;
+
+        /** @brief Leaves the surface null; headless rendering is offscreen */
+        void createSurface(void* instance, void* surface) override;
+
+        /** @brief Stores the callback; it never fires (fixed size) */
+        void setResizeCallback(ResizeCallback callback) override;
+
+        /** @brief Marks the window as closed, ending the engine main loop */
+        void requestClose() override;
+
+    private:
+        int m_width;                        ///< Fixed framebuffer width
+        int m_height;                       ///< Fixed framebuffer height
+        bool m_shouldClose{false};          ///< Set by requestClose()
+        ResizeCallback m_resizeCallback;    ///< Stored but never invoked
+    };
+
+} // namespace vkeng
@@ -0,0 +1,104 @@
+/**
+ * @file HitchWatchdog.hpp
+ * @brief Always-on frame hitch detection with on-disk capture reports
+ *
+ * A frame-time graph in the field says "something spiked" long after the
+ * spike is gone; customers rarely attach traces. The watchdog keeps the
+ * CPU profiler rings recording in the background and, when a frame blows
+ * past the configured threshold, writes a forensic report with enough
+ * context to diagnose the hitch offline.
+ *
+ * Key Watchdog Concepts:
+ * - Always-On: the per-frame cost is one comparison plus the profiler's
+ *   ring writes (two clock reads per zone), so it ships enabled
+ * - Hitch Report: recent CPU zones (CpuProfiler::snapshotRecent), GPU
+ *   pass timings (GpuProfiler), scene summary (node count, draw counts),
+ *   and VRAM usage (MemoryManager stats), one file per hitch
+ * - Rotating Log: reports cycle through hitch_000..hitch_NNN.log in the
+ *   configured directory, so a hitchy soak run cannot fill the disk
+ * - Cooldown: a sustained stall produces one report plus a suppressed
+ *   count, not a report per slow frame
+ *
+ * Report formatting and file I/O run on a job system worker — the frame
+ * that hitched is not made worse by writing about it.
+ */
+#pragma once
+
+#include "vulkan-engine/core/Config.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+namespace vkeng {
+
+    class SceneNode;
+
+    class HitchWatchdog {
+    public:
+        /** @brief Renderer counters sampled into a report (see setDrawStatsProvider). */
+        struct DrawStats {
+            uint32_t drawCalls = 0;     ///< Draws issued last frame
+            uint32_t culledDraws = 0;   ///< Draws rejected by culling
+        };
+
+        /**
+         * @brief Arms the watchdog and enables background zone recording
+         * @param memoryManager Memory manager queried for VRAM stats on hitch
+         * @param config Threshold, report directory, and rotation settings
+         *
+         * Creates the report directory if missing.
+         *
+         * @warning May throw std::runtime_error if the directory cannot be created
+         */
+        HitchWatchdog(std::shared_ptr<MemoryManager> memoryManager,
+                      const Config::Watchdog& config);
+
+        /** @brief Disarms background zone recording. */
+        ~HitchWatchdog();
+
+        HitchWatchdog(const HitchWatchdog&) = delete;
+        HitchWatchdog& operator=(const HitchWatchdog&) = delete;
+
+        /**
+         * @brief Supplies renderer draw counters for reports
+         *
+         * The engine core does not own the renderer, so applications wire
+         * this up after creating theirs; reports note when it is missing.
+         * Called only when a hitch fires, never on the fast path.
+         */
+        void setDrawStatsProvider(std::function<DrawStats()> provider) {
+            m_drawStatsProvider = std::move(provider);
+        }
+
+        /**
+         * @brief Checks one completed frame against the threshold
+         * @param frameMs Wall time of the frame that just finished
+         * @param sceneRoot Scene root for the node-count summary (may be null)
+         *
+         * Fast path is a single comparison; everything else happens only
+         * when the frame exceeded the threshold and the cooldown elapsed.
+         */
+        void endFrame(double frameMs, const SceneNode* sceneRoot);
+
+        /** @brief Total frames over threshold since startup (including suppressed). */
+        uint64_t getHitchCount() const { return m_hitchCount; }
+
+    private:
+        /** @brief Gathers the report data and schedules the file write. */
+        void captureHitch(double frameMs, const SceneNode* sceneRoot);
+
+        Config::Watchdog m_config;
+        std::filesystem::path m_reportDir;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        std::function<DrawStats()> m_drawStatsProvider;
+
+        uint64_t m_hitchCount = 0;          ///< Frames over threshold since startup
+        uint64_t m_reportIndex = 0;         ///< Next rotating report slot
+        uint64_t m_suppressedSinceReport = 0; ///< Hitches swallowed by the cooldown
+        uint64_t m_lastReportUs = 0;        ///< Profiler-clock time of the last report
+    };
+
+} // namespace vkeng
@@ -16,6 +16,7 @@
 
 #pragma once
 #include <GLFW/glfw3.h>
+#include <chrono>
 
 namespace vkeng {
 
@@ -106,6 +107,19 @@ public:
      */
     void endFrame();
 
+    /**
+     * @brief Pump OS events mid-frame for late-latched camera sampling
+     *
+     * Re-polls GLFW immediately before the view matrix is uploaded so
+     * controllers can consume mouse movement that arrived after the
+     * regular update pass, cutting up to a frame of input latency.
+     * Key state is snapshotted first so that presses arriving in this
+     * late window still register with isKeyTriggered() next frame.
+     *
+     * @note Safe no-op before init(); call at most once per frame
+     */
+    void pollLatest();
+
     // ============================================================================
     // Keyboard Input Queries
     // ============================================================================
@@ -148,7 +162,26 @@ public:
      * @note Positive X is rightward movement, positive Y is downward movement
      */
     void getMouseDelta(double& x, double& y) const;
-    
+
+    /**
+     * @brief Read and clear the accumulated mouse delta
+     * @param x Reference to store X-axis movement delta
+     * @param y Reference to store Y-axis movement delta
+     *
+     * Used by late-latching camera controllers so each pixel of movement
+     * is applied exactly once — whether it was consumed during the
+     * regular update or by lateLatch() just before the UBO upload.
+     */
+    void consumeMouseDelta(double& x, double& y);
+
+    /**
+     * @brief Read and clear the accumulated scroll delta
+     * @param y Reference to store vertical scroll delta
+     *
+     * Consuming counterpart of getScrollDelta() for late-latch mode.
+     */
+    void consumeScrollDelta(double& y);
+
     /**
      * @brief Get scroll wheel delta since last frame
      * @param y Reference to store vertical scroll delta
@@ -173,6 +206,17 @@ public:
      */
     bool isCursorCaptured() const;
 
+    /**
+     * @brief Timestamp of the most recent input event handled by any callback
+     * @return Steady-clock time of the last key/mouse/scroll event, or a
+     *         default-constructed time_point if no event has arrived yet
+     *
+     * Captured inside the GLFW callbacks, so it marks the moment the OS
+     * delivered the event to us. The engine pairs this with the present
+     * time to measure end-to-end input-to-present latency.
+     */
+    std::chrono::steady_clock::time_point getLastEventTime() const { return m_lastEventTime; }
+
 private:
     GLFWwindow* m_window{nullptr};
     // ============================================================================
@@ -264,6 +308,10 @@ private:
     double m_mouseX;             ///< Current absolute mouse X position
     double m_mouseY;             ///< Current absolute mouse Y position
     bool m_firstMouse;           ///< Flag to handle first mouse movement
+    bool m_keysAtLatch[1024];    ///< Key snapshot taken by pollLatest() for trigger bookkeeping
+    bool m_latchPolled{false};   ///< Whether pollLatest() ran this frame
+
+    std::chrono::steady_clock::time_point m_lastEventTime{};  ///< OS delivery time of the newest input event
 
     RawMouseMode m_rawMouseMode{RawMouseMode::Auto}; ///< User-selected policy
     bool m_rawMouseActive{false};                     ///< Whether raw input is actually on
@@ -0,0 +1,254 @@
+/**
+ * @file JobSystem.hpp
+ * @brief Work-stealing job scheduler shared by all engine subsystems
+ *
+ * Until now every subsystem that wanted parallelism spun its own threads
+ * (resource loading workers, parallel command recording). The job system
+ * centralizes that: a fixed pool of workers sized to the hardware, one
+ * work-stealing deque per worker, and lightweight handles that support
+ * dependency chaining. Subsystems submit work instead of owning threads,
+ * so the engine never oversubscribes the machine.
+ *
+ * Key Scheduling Concepts:
+ * - Work Stealing: each worker pops from the back of its own deque (LIFO,
+ *   cache-warm) and steals from the front of a victim's deque (FIFO) when
+ *   it runs dry, balancing load without a central queue
+ * - Job Handles: cheap shared references to a job's completion state;
+ *   wait() executes other jobs instead of blocking the thread
+ * - Dependency Chaining: a job scheduled against a handle is held as a
+ *   continuation and enqueued only when that handle finishes
+ * - parallelFor: splits an index range into grain-sized chunks fanned out
+ *   across the pool under a single handle
+ * - Topology Awareness: workers can be pinned by core/SMT policy and know
+ *   which CPU socket they run on; stealing prefers same-socket victims and
+ *   scheduleOnSocket() lets memory-bound subsystem passes stay NUMA-local
+ *
+ * @note Access via JobSystem::get(); Engine initializes and shuts it down
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace vkeng {
+
+    class JobSystem;
+
+    /**
+     * @class JobHandle
+     * @brief Shared reference to a scheduled job's completion state
+     *
+     * Handles are cheap to copy and may outlive the job. A default-constructed
+     * handle is "done": waiting on it returns immediately and scheduling
+     * against it enqueues right away.
+     */
+    class JobHandle {
+    public:
+        JobHandle() = default;
+
+        /**
+         * @brief Whether the job (and, for parallelFor, every chunk) finished
+         * @return true if complete or the handle is empty
+         */
+        bool isDone() const;
+
+    private:
+        friend class JobSystem;
+
+        struct State;
+        explicit JobHandle(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+        std::shared_ptr<State> m_state;
+    };
+
+    /**
+     * @class JobSystem
+     * @brief Fixed worker pool with per-worker work-stealing deques
+     *
+     * Jobs are plain std::function<void()> callables. Submissions from a
+     * worker thread go to that worker's own deque; submissions from outside
+     * the pool (main thread, loaders) are distributed round-robin. Workers
+     * that run out of local work steal from the other deques before sleeping.
+     *
+     * @note Singleton - access via JobSystem::get()
+     * @warning initialize() must be called before scheduling; jobs scheduled
+     *          on an uninitialized system run inline on the calling thread
+     */
+    class JobSystem {
+    public:
+        /// Callable executed by a worker thread
+        using JobFunc = std::function<void()>;
+
+        /**
+         * @brief Get the singleton job system instance
+         * @return Reference to the global job system
+         */
+        static JobSystem& get();
+
+        /**
+         * @brief Starts the worker pool; call once at engine startup
+         * @param workerCount Number of workers, or 0 for hardware threads - 1
+         *                    (one core is left for the main thread)
+         * @param affinityPolicy Worker pinning policy from Config::Jobs:
+         *        "none" (scheduler decides), "compact" (fill one socket
+         *        before the next — best for single-socket working sets),
+         *        "spread" (alternate sockets — best for bandwidth-bound
+         *        work), or "physical" (one worker per physical core,
+         *        skipping SMT siblings)
+         *
+         * Detected CPU topology (sockets, cores, SMT) is logged at startup
+         * so placement can be verified in deployment; with a policy active
+         * each worker's pinned CPU is logged too. Pinning is implemented on
+         * Linux; other platforms fall back to "none" with a warning.
+         */
+        void initialize(uint32_t workerCount = 0, const std::string& affinityPolicy = "none");
+
+        /**
+         * @brief Drains remaining jobs and joins the workers (engine shutdown)
+         */
+        void shutdown();
+
+        /**
+         * @brief Schedules a job for execution on the pool
+         * @param fn Work to run; must not throw
+         * @return Handle that completes when fn returns
+         */
+        JobHandle schedule(JobFunc fn);
+
+        /**
+         * @brief Schedules a job that runs only after another job finishes
+         * @param fn Work to run; must not throw
+         * @param dependency Handle the job waits on (empty = run immediately)
+         * @return Handle that completes when fn returns
+         */
+        JobHandle schedule(JobFunc fn, const JobHandle& dependency);
+
+        /**
+         * @brief Schedules a job with a CPU-socket placement hint
+         * @param fn Work to run; must not throw
+         * @param socket Socket index in [0, getSocketCount()); out-of-range
+         *        values wrap
+         * @return Handle that completes when fn returns
+         *
+         * The job is queued on a worker pinned (or assigned) to the given
+         * socket, so subsystem passes can be segregated per socket — e.g.
+         * physics on socket 0 while rendering works socket 1 — keeping
+         * their working sets NUMA-local. A hint biases placement; idle
+         * workers on other sockets may still steal the job rather than
+         * letting it wait.
+         */
+        JobHandle scheduleOnSocket(JobFunc fn, uint32_t socket);
+
+        /**
+         * @brief Fans an index range out across the pool in grain-sized chunks
+         * @param count Number of iterations; fn receives [begin, end) subranges
+         * @param grainSize Iterations per chunk, or 0 for an automatic grain
+         *                  (~4 chunks per worker)
+         * @param fn Callable taking (size_t begin, size_t end)
+         * @return Handle that completes when every chunk has run
+         */
+        template <typename Fn>
+        JobHandle parallelFor(size_t count, size_t grainSize, Fn&& fn) {
+            if (count == 0) {
+                return JobHandle{};
+            }
+            if (m_workers.empty()) {
+                fn(0, count); // Uninitialized or single-core: run inline
+                return JobHandle{};
+            }
+
+            if (grainSize == 0) {
+                size_t targetChunks = m_workers.size() * 4;
+                grainSize = (count + targetChunks - 1) / targetChunks;
+                if (grainSize == 0) grainSize = 1;
+            }
+            size_t chunks = (count + grainSize - 1) / grainSize;
+
+            auto state = makeState(static_cast<uint32_t>(chunks));
+            auto body = std::make_shared<std::decay_t<Fn>>(std::forward<Fn>(fn));
+            for (size_t begin = 0; begin < count; begin += grainSize) {
+                size_t end = (begin + grainSize < count) ? begin + grainSize : count;
+                enqueue(Job{[body, begin, end] { (*body)(begin, end); }, state});
+            }
+            return JobHandle{state};
+        }
+
+        /**
+         * @brief Blocks until the handle completes, executing jobs meanwhile
+         * @param handle Job to wait for (empty handles return immediately)
+         *
+         * Safe to call from workers and from the main thread: the waiting
+         * thread drains queued jobs instead of idling, so waiting inside a
+         * job cannot deadlock the pool.
+         */
+        void wait(const JobHandle& handle);
+
+        /**
+         * @brief Number of worker threads in the pool
+         * @return Worker count, 0 before initialize()
+         */
+        size_t getWorkerCount() const { return m_workers.size(); }
+
+        /**
+         * @brief Number of CPU sockets workers are distributed across
+         * @return Socket count from the detected topology, 1 before
+         *         initialize() or when detection is unavailable
+         */
+        uint32_t getSocketCount() const { return m_socketCount; }
+
+    private:
+        friend class JobHandle; // JobHandle::State stores Jobs as continuations
+
+        JobSystem() = default;
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /// A callable paired with the completion state it decrements
+        struct Job {
+            JobFunc fn;
+            std::shared_ptr<JobHandle::State> state;
+        };
+
+        /// Per-worker deque; the owner works the back, thieves take the front
+        struct WorkerQueue {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        static std::shared_ptr<JobHandle::State> makeState(uint32_t pending);
+
+        void enqueue(Job&& job);
+        void workerLoop(size_t workerIndex);
+        bool tryExecuteOne(size_t preferredQueue);
+        void finishJob(const std::shared_ptr<JobHandle::State>& state);
+
+        std::vector<std::thread> m_workers;
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+        /// Socket each worker runs on (from pinning, or modulo-assigned)
+        std::vector<uint32_t> m_workerSocket;
+        /// Worker indices grouped by socket, for scheduleOnSocket()
+        std::vector<std::vector<size_t>> m_socketWorkers;
+        /// Per-worker victim scan order: same-socket queues before remote ones
+        std::vector<std::vector<size_t>> m_victimOrder;
+        uint32_t m_socketCount = 1;
+        std::atomic<size_t> m_socketCursor{0};  ///< Round-robin within a socket's workers
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCv;
+        std::atomic<bool> m_running{false};
+        std::atomic<size_t> m_submitCursor{0};  ///< Round-robin target for external submits
+    };
+
+} // namespace vkeng
@@ -12,15 +12,22 @@
  * - Categories: Organized logging by system (GENERAL, INPUT, CAMERA, etc.)
  * - Multi-output: Simultaneous console and file logging support
  * - Thread-safe: Safe for use in multi-threaded applications
+ * - Async Mode: Callers enqueue into a bounded lock-free ring; a background
+ *   thread does timestamp formatting and console/file I/O off the hot path
+ * - Compile-time Stripping: LOG_* macros below VKENG_MIN_LOG_LEVEL compile
+ *   to nothing, so disabled levels cost zero code in release builds
  */
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <chrono>
 #include <iomanip>
+#include <memory>
+#include <thread>
 
 namespace vkeng {
 
@@ -103,7 +110,34 @@ public:
      * @brief Disable file logging (console logging continues)
      */
     void disableFileLogging();
-    
+
+    /**
+     * @brief Enable or disable the asynchronous logging backend
+     * @param enabled true to route log output through the background thread
+     *
+     * In async mode the calling thread only formats the message text and
+     * pushes a fixed-size record into a bounded lock-free queue; timestamping,
+     * prefix formatting and console/file I/O happen on a background thread.
+     * When the queue is full the record is dropped and counted rather than
+     * blocking the caller (see getDroppedCount()).
+     *
+     * @note Disabling async mode drains and flushes all queued records first
+     */
+    void setAsync(bool enabled);
+
+    /**
+     * @brief Block until all queued async records have been written
+     *
+     * @note No-op when async mode is disabled
+     */
+    void flush();
+
+    /**
+     * @brief Number of records dropped because the async queue was full
+     * @return Total dropped record count since startup
+     */
+    uint64_t getDroppedCount() const { return droppedCount_.load(std::memory_order_relaxed); }
+
     // ============================================================================
     // Core Logging Methods
     // ============================================================================
@@ -269,15 +303,82 @@ private:
         }
     }
     
+    // ============================================================================
+    // Asynchronous Backend
+    // ============================================================================
+
+    /// Queue capacity in records; must be a power of two for index masking
+    static constexpr size_t kQueueCapacity = 1024;
+
+    /// Message text beyond this many characters is truncated in async mode
+    static constexpr size_t kMaxMessageLength = 224;
+
+    /**
+     * @struct AsyncRecord
+     * @brief Fixed-size log record stored inline in the async ring buffer
+     *
+     * The timestamp is captured on the calling thread so queued messages keep
+     * their true ordering even when the background thread falls behind.
+     */
+    struct AsyncRecord {
+        LogLevel level;
+        LogCategory category;
+        std::chrono::system_clock::time_point time;
+        uint16_t length;
+        char text[kMaxMessageLength];
+    };
+
+    /**
+     * @struct AsyncSlot
+     * @brief Ring buffer cell pairing a record with its sequence counter
+     *
+     * The sequence counter implements a bounded multi-producer queue: a
+     * producer claims the slot when sequence == enqueue position and releases
+     * it at position + 1; the consumer reclaims it at position + capacity.
+     */
+    struct AsyncSlot {
+        std::atomic<size_t> sequence;
+        AsyncRecord record;
+    };
+
+    /**
+     * @brief Try to push a record into the async ring without blocking
+     * @param level Severity level of the message
+     * @param category System category for the message
+     * @param message Formatted message text (truncated to kMaxMessageLength)
+     * @return true if enqueued, false if the queue was full
+     */
+    bool tryEnqueue(LogLevel level, LogCategory category, const std::string& message);
+
+    /**
+     * @brief Background thread body: drains the ring and performs output
+     */
+    void asyncWorkerLoop();
+
+    /**
+     * @brief Write one fully formatted entry to console and file
+     * @param level Severity level (selects console color)
+     * @param category System category for the prefix
+     * @param message Message text
+     * @param time Timestamp to format into the prefix
+     * @param file Source file name or nullptr
+     * @param line Source line number
+     * @param func Source function name or nullptr
+     */
+    void writeEntry(LogLevel level, LogCategory category, const std::string& message,
+                    std::chrono::system_clock::time_point time,
+                    const char* file, int line, const char* func);
+
     // ============================================================================
     // Utility Methods
     // ============================================================================
     
     /**
-     * @brief Get current timestamp as formatted string
+     * @brief Format a timestamp for log message prefixes
+     * @param time Point in time to format (captured at the original call site)
      * @return Timestamp string for log message prefixes
      */
-    std::string getCurrentTime();
+    std::string formatTime(std::chrono::system_clock::time_point time);
     
     /**
      * @brief Convert log level enum to string representation
@@ -300,70 +401,129 @@ private:
     LogLevel minLogLevel_ = LogLevel::INFO;  ///< Minimum level for message output
     std::ofstream logFile_;                  ///< File stream for file logging
     bool fileLoggingEnabled_ = false;        ///< Flag indicating if file logging is active
+
+    // Async backend state (allocated lazily when async mode is first enabled)
+    std::unique_ptr<AsyncSlot[]> queue_;       ///< Bounded lock-free ring buffer
+    std::atomic<size_t> enqueuePos_{0};        ///< Next producer position
+    std::atomic<size_t> dequeuePos_{0};        ///< Next consumer position
+    std::atomic<bool> asyncEnabled_{false};    ///< Routes log() through the ring
+    std::atomic<bool> workerRunning_{false};   ///< Signals the worker to keep draining
+    std::atomic<uint64_t> droppedCount_{0};    ///< Records dropped on queue overflow
+    uint64_t reportedDropped_ = 0;             ///< Drops already reported (worker only)
+    std::thread worker_;                       ///< Background output thread
 };
 
 // ============================================================================
 // Convenience Macros for Easy Logging
 // ============================================================================
 
+// Numeric level values for the preprocessor (mirror LogLevel above)
+#define VKENG_LOG_LEVEL_TRACE    0
+#define VKENG_LOG_LEVEL_DEBUG    1
+#define VKENG_LOG_LEVEL_INFO     2
+#define VKENG_LOG_LEVEL_WARN     3
+#define VKENG_LOG_LEVEL_ERROR    4
+#define VKENG_LOG_LEVEL_CRITICAL 5
+
+/**
+ * @def VKENG_MIN_LOG_LEVEL
+ * @brief Compile-time minimum log level; LOG_* macros below it vanish entirely
+ *
+ * Defaults to DEBUG in release builds (stripping TRACE) and TRACE in debug
+ * builds. Define on the command line to strip more aggressively, e.g.
+ * -DVKENG_MIN_LOG_LEVEL=VKENG_LOG_LEVEL_WARN removes all INFO-and-below
+ * call sites, including argument evaluation, from the binary.
+ */
+#ifndef VKENG_MIN_LOG_LEVEL
+    #ifdef NDEBUG
+        #define VKENG_MIN_LOG_LEVEL VKENG_LOG_LEVEL_DEBUG
+    #else
+        #define VKENG_MIN_LOG_LEVEL VKENG_LOG_LEVEL_TRACE
+    #endif
+#endif
+
 /**
  * @def LOG_TRACE(category, ...)
  * @brief Convenience macro for TRACE level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_TRACE(CAMERA, "Camera position: {}, {}, {}", x, y, z);
  */
-#define LOG_TRACE(category, ...) vkeng::Logger::getInstance().trace(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_TRACE
+    #define LOG_TRACE(category, ...) vkeng::Logger::getInstance().trace(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_TRACE(category, ...) ((void)0)
+#endif
 
 /**
  * @def LOG_DEBUG(category, ...)
  * @brief Convenience macro for DEBUG level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_DEBUG(VULKAN, "Created buffer with size: {} bytes", size);
  */
-#define LOG_DEBUG(category, ...) vkeng::Logger::getInstance().debug(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_DEBUG
+    #define LOG_DEBUG(category, ...) vkeng::Logger::getInstance().debug(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_DEBUG(category, ...) ((void)0)
+#endif
 
 /**
  * @def LOG_INFO(category, ...)
  * @brief Convenience macro for INFO level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_INFO(GENERAL, "Application initialized successfully");
  */
-#define LOG_INFO(category, ...) vkeng::Logger::getInstance().info(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_INFO
+    #define LOG_INFO(category, ...) vkeng::Logger::getInstance().info(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_INFO(category, ...) ((void)0)
+#endif
 
 /**
  * @def LOG_WARN(category, ...)
  * @brief Convenience macro for WARN level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_WARN(RENDERING, "Frame rate dropped below {} FPS", targetFPS);
  */
-#define LOG_WARN(category, ...) vkeng::Logger::getInstance().warn(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_WARN
+    #define LOG_WARN(category, ...) vkeng::Logger::getInstance().warn(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_WARN(category, ...) ((void)0)
+#endif
 
 /**
  * @def LOG_ERROR(category, ...)
  * @brief Convenience macro for ERROR level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_ERROR(VULKAN, "Failed to create buffer: {}", errorMessage);
  */
-#define LOG_ERROR(category, ...) vkeng::Logger::getInstance().error(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_ERROR
+    #define LOG_ERROR(category, ...) vkeng::Logger::getInstance().error(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_ERROR(category, ...) ((void)0)
+#endif
 
 /**
  * @def LOG_CRITICAL(category, ...)
  * @brief Convenience macro for CRITICAL level logging
  * @param category LogCategory enum value (without LogCategory:: prefix)
  * @param ... Format string and arguments for the log message
- * 
+ *
  * @note Example: LOG_CRITICAL(VULKAN, "Vulkan instance creation failed");
  */
-#define LOG_CRITICAL(category, ...) vkeng::Logger::getInstance().critical(vkeng::LogCategory::category, __VA_ARGS__)
+#if VKENG_MIN_LOG_LEVEL <= VKENG_LOG_LEVEL_CRITICAL
+    #define LOG_CRITICAL(category, ...) vkeng::Logger::getInstance().critical(vkeng::LogCategory::category, __VA_ARGS__)
+#else
+    #define LOG_CRITICAL(category, ...) ((void)0)
+#endif
 
 } // namespace vkeng
\ No newline at end of file
@@ -23,14 +23,49 @@
 #include <string>
 #include <mutex>
 #include <functional>
+#include <array>
+#include <unordered_map>
+#include <vector>
 
 #include "Result.hpp"
 #include "Buffer.hpp"
+#include "TimelineSemaphore.hpp"
 
 namespace vkeng {
 
     class VulkanDevice; // Forward declaration
     class CommandPool;  // Forward declaration
+    class StagingRing;  // Forward declaration
+
+    /**
+     * @struct PerFrameUniformBuffer
+     * @brief One persistently-mapped uniform buffer holding a region per frame in flight
+     *
+     * Replaces N separate per-frame uniform buffers with one allocation whose
+     * regions are spaced by the device's minUniformBufferOffsetAlignment.
+     * Each frame's descriptor binds its region via offset(frame); updates go
+     * through write(), which hits the persistent mapping directly — no
+     * map/unmap per frame, and no flush on host-coherent memory.
+     *
+     * Created by MemoryManager::createPerFrameUniformBuffer().
+     */
+    struct PerFrameUniformBuffer {
+        std::shared_ptr<Buffer> buffer;  ///< Single backing buffer, persistently mapped
+        VkDeviceSize stride = 0;         ///< Aligned spacing between frame regions
+        VkDeviceSize elementSize = 0;    ///< Requested (descriptor range) size
+        uint32_t frameCount = 0;         ///< Number of frame regions
+
+        /** @brief Byte offset of one frame's region — use as the descriptor offset. */
+        VkDeviceSize offset(uint32_t frame) const { return stride * frame; }
+
+        /** @brief Write one frame's region through the persistent mapping. */
+        Result<void> write(uint32_t frame, const void* data, VkDeviceSize size) const {
+            return buffer->write(data, size, offset(frame));
+        }
+
+        /** @brief Whether the buffer was created successfully. */
+        bool valid() const { return buffer != nullptr; }
+    };
 
     /**
      * @class MemoryManager
@@ -102,7 +137,21 @@ namespace vkeng {
          * @return Result containing the created buffer or error
          */
         Result<std::shared_ptr<Buffer>> createUniformBuffer(VkDeviceSize size);
-        
+
+        /**
+         * Create one persistently-mapped uniform buffer with a region per
+         * frame in flight. One allocation instead of one per frame; each
+         * region starts on a minUniformBufferOffsetAlignment boundary so
+         * descriptors can bind it directly. Updates go through
+         * PerFrameUniformBuffer::write(), which is a plain memcpy with no
+         * map/unmap calls and no flush on host-coherent memory.
+         * @param perFrameSize Bytes each frame's region must hold
+         * @param frameCount Number of frames in flight
+         * @return Result containing the per-frame buffer or error
+         */
+        Result<PerFrameUniformBuffer> createPerFrameUniformBuffer(VkDeviceSize perFrameSize,
+                                                                  uint32_t frameCount);
+
         /**
          * Create a staging buffer (for CPU->GPU transfers)
          * @param size Size in bytes
@@ -129,13 +178,17 @@ namespace vkeng {
          * @param format Pixel format (e.g., VK_FORMAT_R8G8B8A8_UNORM)
          * @param usage Usage flags (e.g., VK_IMAGE_USAGE_SAMPLED_BIT)
          * @param hostVisible If true, image is CPU-accessible (rare)
+         * @param mipLevels Number of mip levels
+         * @param arrayLayers Number of array layers (2D_ARRAY view when > 1)
          * @return Result containing the created image or error
          */
         Result<std::shared_ptr<Image>> createImage(
             uint32_t width, uint32_t height,
             VkFormat format,
             VkImageUsageFlags usage,
-            bool hostVisible = false);
+            bool hostVisible = false,
+            uint32_t mipLevels = 1,
+            uint32_t arrayLayers = 1);
         
         /**
          * Create a texture for sampling in shaders
@@ -203,15 +256,224 @@ namespace vkeng {
             VkDeviceSize size,
             uint32_t width, uint32_t height);
 
+        /**
+         * @brief Uploads data into a rectangular region of an image
+         *
+         * Used by TextureAtlas to pack textures into shared pages: unlike
+         * uploadToImage, the transition into TRANSFER_DST_OPTIMAL preserves
+         * existing contents when @p firstUpload is false, so previously
+         * packed regions survive. The image ends in
+         * SHADER_READ_ONLY_OPTIMAL either way.
+         *
+         * @param dstImage Target image
+         * @param data Source data pointer (tightly packed region pixels)
+         * @param size Data size in bytes
+         * @param x Destination x offset in pixels
+         * @param y Destination y offset in pixels
+         * @param width Region width in pixels
+         * @param height Region height in pixels
+         * @param firstUpload True only for the image's first upload, when its
+         *        contents are still undefined and may be discarded
+         * @return Result indicating success or error
+         */
+        Result<void> uploadToImageRegion(
+            std::shared_ptr<Image> dstImage,
+            const void* data,
+            VkDeviceSize size,
+            uint32_t x, uint32_t y,
+            uint32_t width, uint32_t height,
+            bool firstUpload);
+
+        /**
+         * @brief One mip level's slice of a multi-level image upload
+         */
+        struct MipUploadRegion {
+            VkDeviceSize bufferOffset = 0;  ///< Offset of this level in the staging data
+            uint32_t width = 0;             ///< Level width in pixels
+            uint32_t height = 0;            ///< Level height in pixels
+            uint32_t mipLevel = 0;          ///< Destination mip level
+        };
+
+        /**
+         * @brief Uploads pre-generated mip levels to an image in one transfer
+         *
+         * Used for compressed-container textures (KTX2) that ship their full
+         * mip chain: all levels are copied from a single staging buffer and
+         * the whole chain is transitioned to SHADER_READ_ONLY_OPTIMAL in one
+         * pair of barriers.
+         *
+         * @param dstImage Destination image created with matching mipLevels
+         * @param data Staging data containing every level at its region offset
+         * @param size Total size of the staging data in bytes
+         * @param regions One entry per mip level to copy
+         * @return Result indicating success or error
+         */
+        Result<void> uploadToImageMips(
+            std::shared_ptr<Image> dstImage,
+            const void* data,
+            VkDeviceSize size,
+            const std::vector<MipUploadRegion>& regions);
+
+        /**
+         * @brief Generates the mip chain of an image with a vkCmdBlitImage cascade
+         *
+         * Expects level 0 in SHADER_READ_ONLY_OPTIMAL (the state uploadToImage
+         * leaves it in) and the remaining levels untouched. Each level is
+         * blitted from the one above with linear filtering; the whole chain
+         * ends in SHADER_READ_ONLY_OPTIMAL. The image must have been created
+         * with TRANSFER_SRC usage. Callers are responsible for checking that
+         * the format supports blitting (VK_FORMAT_FEATURE_BLIT_SRC/DST).
+         *
+         * @param image Image created with mipLevels > 1
+         * @return Result indicating success or error
+         */
+        Result<void> generateMipmaps(std::shared_ptr<Image> image);
+
+        /**
+         * @brief Creates a smaller image holding the tail of another's mip chain
+         *
+         * Used by texture residency to demote distant textures: the new image
+         * is levels [baseLevel..N) of the source, copied on the GPU with no
+         * disk or CPU work. The source must be in SHADER_READ_ONLY_OPTIMAL
+         * and is returned to that state; the new image ends there too.
+         *
+         * @param srcImage Source image with a full mip chain
+         * @param baseLevel First source level to keep (becomes level 0)
+         * @return Result containing the new image or error
+         */
+        Result<std::shared_ptr<Image>> createMipTailImage(
+            std::shared_ptr<Image> srcImage,
+            uint32_t baseLevel);
+
+        // ================================================================
+        // Batched Transfers (staging ring)
+        // ================================================================
+
+        /**
+         * Begin a transfer batch: subsequent uploads memcpy into the staging
+         * ring and record copies into one shared command buffer instead of
+         * submitting (and fencing) individually.
+         *
+         * Must be paired with flushTransferBatch(). Nested batches are not
+         * supported.
+         */
+        void beginTransferBatch();
+
+        /**
+         * Submit all copies recorded since beginTransferBatch() in a single
+         * queue submission. Does NOT wait for completion: the staging ring
+         * regions are progress-tracked (timeline values, or fences on the
+         * fallback path) and reclaimed once the GPU is done, and same-queue
+         * ordering guarantees the data is visible to later work.
+         * @return Result indicating success or error
+         */
+        Result<void> flushTransferBatch();
+
+        // ================================================================
+        // Asynchronous Transfers (dedicated transfer queue)
+        // ================================================================
+
+        /** Invoked from pollAsyncTransfers() once an async upload has finished on the GPU. */
+        using TransferCompleteCallback = std::function<void()>;
+
+        /**
+         * Upload data to a device-local buffer on the dedicated transfer
+         * queue, without blocking the caller or the graphics queue.
+         *
+         * The copy runs on the transfer queue with a queue-family release
+         * barrier; the matching acquire barrier is submitted to the graphics
+         * queue waiting on a semaphore, so the buffer is usable by any
+         * graphics work submitted afterwards. The callback fires from
+         * pollAsyncTransfers() once both submissions have completed — that is
+         * the point where a resource can be marked resident.
+         *
+         * Falls back to a synchronous uploadToBuffer() (callback invoked
+         * before returning) when the device has no dedicated transfer queue.
+         *
+         * @param dstBuffer Target device-local buffer
+         * @param data Source data pointer (copied before returning)
+         * @param size Data size in bytes
+         * @param offset Offset in target buffer
+         * @param onComplete Invoked once the upload is visible to the graphics queue
+         * @return Result indicating the upload was queued (or completed) or error
+         */
+        Result<void> uploadToBufferAsync(
+            std::shared_ptr<Buffer> dstBuffer,
+            const void* data,
+            VkDeviceSize size,
+            VkDeviceSize offset,
+            TransferCompleteCallback onComplete);
+
+        /**
+         * Fire completion callbacks for finished async transfers and recycle
+         * their command buffers, fences and semaphores. Call once per frame
+         * from the main loop.
+         */
+        void pollAsyncTransfers();
+
+        // ================================================================
+        // Defragmentation Service
+        // ================================================================
+
+        /**
+         * @brief Registers a buffer as safe to relocate during defragmentation.
+         *
+         * Only register buffers whose consumers re-read getHandle() at
+         * record time every frame and that are never written into
+         * long-lived descriptor sets — a relocation swaps the buffer's
+         * handle, allocation, and mapping in place, so stale cached
+         * handles are the one thing it cannot fix. Mesh pool blocks and
+         * standalone mesh buffers qualify; uniform buffers bound by
+         * persistent descriptors do not.
+         *
+         * Held weakly: a registered buffer that is destroyed simply stops
+         * being a candidate.
+         */
+        void markRelocatable(const std::shared_ptr<Buffer>& buffer);
+
+        /**
+         * @brief Runs one incremental defragmentation step.
+         *
+         * Drives VMA's defragmentation a small slice at a time so the work
+         * can hide inside frames with pacing headroom. One call either
+         * starts/advances a pass (relocating up to @p maxMoves registered
+         * buffers, copying host-visible ones with memcpy and device-local
+         * ones with a blocking transfer-queue copy) or retires a previous
+         * pass once enough frames have elapsed that no in-flight command
+         * buffer can still reference the old locations. Candidates not
+         * registered via markRelocatable() are never moved.
+         *
+         * Also refreshes the fragmentation fields of getMemoryStats().
+         *
+         * @warning Call from the thread that records rendering work, with
+         *          no recording in flight (e.g. during the frame limiter's
+         *          idle window) — relocation swaps handles that recording
+         *          reads.
+         *
+         * @param maxMoves Most allocations to relocate in one step
+         * @param maxBytes Most bytes to relocate in one step
+         * @return Number of relocations issued this step (0 = idle/retire step)
+         */
+        Result<uint32_t> defragmentStep(uint32_t maxMoves = 8,
+                                        VkDeviceSize maxBytes = 8ull * 1024 * 1024);
+
         // ================================================================
         // Memory Statistics and Debugging
         // ================================================================
         
         struct MemoryStats {
             VkDeviceSize totalAllocated = 0;
+            VkDeviceSize bufferBytes = 0;   ///< Portion of totalAllocated held by buffers (mesh/uniform/staging)
+            VkDeviceSize imageBytes = 0;    ///< Portion of totalAllocated held by images (textures/attachments)
             uint32_t allocationCount = 0;
             uint32_t bufferCount = 0;
             uint32_t imageCount = 0;
+            // Heap fragmentation (refreshed by defragmentation steps)
+            VkDeviceSize unusedBytes = 0;       ///< Free bytes inside allocated VMA blocks
+            VkDeviceSize largestFreeRange = 0;  ///< Largest single free range — the biggest allocation that can still succeed
+            float fragmentation = 0.0f;         ///< 1 - largestFreeRange/unusedBytes; 0 = free space contiguous
+            uint32_t defragMoves = 0;           ///< Allocations relocated since startup
+            VkDeviceSize defragMovedBytes = 0;  ///< Bytes relocated since startup
         };
         
         /**
@@ -263,13 +525,121 @@ namespace vkeng {
         Result<void> executeTransfer(std::function<void(VkCommandBuffer)> transferFunction);
         void updateStats(VkDeviceSize size, bool isAllocation, bool isBuffer);
 
+        // Staging ring internals
+        /**
+         * Attempt a buffer upload through the staging ring: memcpy into
+         * pre-mapped memory plus a copy command in the current (or an
+         * implicit single-upload) transfer batch. Fails when the ring is
+         * full or too small; callers fall back to the one-shot path.
+         */
+        Result<void> ringUploadToBuffer(
+            std::shared_ptr<Buffer> dstBuffer,
+            const void* data,
+            VkDeviceSize size,
+            VkDeviceSize offset);
+
+        /**
+         * Image counterpart of ringUploadToBuffer: memcpy into the staging
+         * ring plus both layout transitions and the copy in the current
+         * transfer batch. Fails when the ring is full; uploadToImage falls
+         * back to the one-shot path.
+         */
+        Result<void> ringUploadToImage(
+            std::shared_ptr<Image> dstImage,
+            const void* data,
+            VkDeviceSize size,
+            uint32_t width, uint32_t height);
+
+        /** Acquire the next transfer slot, waiting out its previous submission. */
+        Result<uint32_t> acquireTransferSlot();
+
+        /** End + submit the active slot's command buffer (no CPU-side wait). */
+        Result<void> submitTransferSlot();
+
         // Member variables
         VkDevice m_device = VK_NULL_HANDLE;
-        
+        VkDeviceSize m_uboAlignment = 256;  ///< minUniformBufferOffsetAlignment (queried in create())
+
         // Transfer command pool
         VulkanDevice* m_deviceRef = nullptr;
         std::unique_ptr<CommandPool> m_transferCommandPool;
+
+        // Persistent staging ring + fenced transfer slots
+        static constexpr VkDeviceSize STAGING_RING_SIZE = 16 * 1024 * 1024;
+        static constexpr uint32_t TRANSFER_SLOT_COUNT = 4;
+
+        /** A reusable transfer command buffer with its completion tracking. */
+        struct TransferSlot {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VkFence fence = VK_NULL_HANDLE;   ///< Fallback when timelines are unavailable
+            uint64_t timelineValue = 0;       ///< Transfer timeline value the submit signals
+            bool submitted = false;   ///< True while a submission may be in flight
+        };
+
+        /**
+         * Transfer timeline: every slot submission signals the next value,
+         * so slot reuse waits on an exact value instead of a wait/reset
+         * fence cycle, and the staging ring retires regions by comparing
+         * against the completed counter. Null when the device lacks
+         * timelineSemaphore (slots fall back to fences).
+         */
+        std::shared_ptr<TimelineSemaphore> m_transferTimeline;
+
+        std::unique_ptr<StagingRing> m_stagingRing;
+        std::array<TransferSlot, TRANSFER_SLOT_COUNT> m_transferSlots{};
+        uint32_t m_currentSlot = 0;       ///< Slot the active batch records into
+        bool m_batchActive = false;       ///< True between begin/flushTransferBatch
+        bool m_slotRecording = false;     ///< True once the slot's buffer has begun
+
+        /** One in-flight async upload: copy on the transfer queue, acquire on graphics. */
+        struct AsyncTransfer {
+            VkCommandBuffer transferCmd = VK_NULL_HANDLE;  ///< Copy + release barrier
+            VkCommandBuffer acquireCmd = VK_NULL_HANDLE;   ///< Acquire barrier (graphics)
+            VkFence transferFence = VK_NULL_HANDLE;        ///< Transfer queue completion (fence fallback)
+            VkFence acquireFence = VK_NULL_HANDLE;         ///< Graphics queue completion (fence fallback)
+            VkSemaphore ownershipSemaphore = VK_NULL_HANDLE; ///< Release→acquire ordering (fence fallback)
+            uint64_t releaseValue = 0;  ///< Async timeline value the transfer-queue copy signals
+            uint64_t acquireValue = 0;  ///< Async timeline value the graphics acquire signals (0 = fence path)
+            std::shared_ptr<Buffer> stagingBuffer;         ///< Kept alive until done
+            std::shared_ptr<Buffer> dstBuffer;             ///< Kept alive until done
+            TransferCompleteCallback callback;             ///< Fired on completion
+        };
+
+        /**
+         * Async transfer timeline spanning both queues: the transfer-queue
+         * copy signals a reserved value, the graphics-queue acquire waits
+         * on it (wait-before-signal is legal on timelines, so submission
+         * order between the two queues is unconstrained) and signals the
+         * next value, which completion polling compares against. Replaces
+         * the per-transfer semaphore + two fences of the fallback path.
+         */
+        std::shared_ptr<TimelineSemaphore> m_asyncTimeline;
+
+        std::unique_ptr<CommandPool> m_asyncCommandPool;   ///< Transfer-family pool
+        std::vector<AsyncTransfer> m_asyncInFlight;        ///< Outstanding async uploads
+        std::mutex m_asyncMutex;                           ///< Guards m_asyncInFlight
         
+        // Defragmentation service internals
+        /** Recomputes the fragmentation fields of m_stats from vmaCalculateStatistics. */
+        void refreshFragmentationStats();
+
+        /** In-flight defragmentation: context plus the pass awaiting retirement. */
+        struct DefragState {
+            VmaDefragmentationContext context = VK_NULL_HANDLE;
+            VmaDefragmentationPassMoveInfo passInfo{};
+            bool passOpen = false;            ///< A pass's moves are copied but not yet retired
+            uint32_t framesUntilRetire = 0;   ///< Steps left before the sources can be freed
+            std::vector<VkBuffer> retiredBuffers;              ///< Old handles, destroyed at retirement
+            std::vector<std::shared_ptr<Buffer>> movedBuffers; ///< Keeps moved owners alive through the pass
+        };
+
+        /** Old locations outlive the copy by this many steps — must exceed frames in flight. */
+        static constexpr uint32_t DEFRAG_RETIRE_STEPS = 3;
+
+        DefragState m_defrag;
+        std::unordered_map<VmaAllocation, std::weak_ptr<Buffer>> m_relocatable; ///< Opt-in move candidates
+        std::mutex m_relocatableMutex;                                          ///< Loads register from job threads
+
         // VMA allocator
         VmaAllocator m_allocator = VK_NULL_HANDLE;
         
@@ -0,0 +1,161 @@
+/**
+ * @file Profiler.hpp
+ * @brief Scoped CPU profiling with chrome://tracing JSON export
+ *
+ * When a customer reports stutter, a frame-time graph says "something
+ * spiked" but not what. The CPU profiler records named zones from any
+ * thread into thread-local ring buffers and dumps a capture as Chrome
+ * trace-event JSON, so a spike can be opened in chrome://tracing (or
+ * Perfetto) and read subsystem by subsystem.
+ *
+ * Key Profiling Concepts:
+ * - Scoped Zone: PROFILE_SCOPE("name") times the enclosing block via RAII;
+ *   zone names must be string literals (the pointer is stored, not copied)
+ * - Thread-Local Ring: each thread appends to its own fixed-size buffer
+ *   with no locks or allocation on the hot path; old events are overwritten
+ *   when the ring wraps, so a capture holds the most recent window
+ * - Capture: beginCapture() clears the rings and arms recording;
+ *   endCapture(path) disarms and writes the JSON
+ * - Background Recording: setBackgroundRecording(true) arms the rings
+ *   without an explicit capture, so snapshotRecent() can pull the last
+ *   window of zones after the fact — the hitch watchdog runs this way
+ *   always-on in production
+ *
+ * Zones cost two steady_clock reads and a relaxed atomic bump when armed,
+ * and two relaxed loads when disarmed.
+ */
+#pragma once
+
+#include "vulkan-engine/core/Result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    class CpuProfiler {
+    public:
+        static CpuProfiler& get();
+
+        /** @brief Clears all ring buffers and arms zone recording. */
+        void beginCapture();
+
+        /**
+         * @brief Disarms recording and writes the capture
+         * @param path Output file (chrome://tracing JSON array format)
+         */
+        Result<void> endCapture(const std::string& path);
+
+        bool isCapturing() const { return m_capturing.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Arms or disarms zone recording outside explicit captures
+         *
+         * Rings keep overwriting their oldest events, so this stays cheap
+         * indefinitely; it exists so snapshotRecent() has data to pull when
+         * something goes wrong after the fact.
+         */
+        void setBackgroundRecording(bool enabled) {
+            m_background.store(enabled, std::memory_order_relaxed);
+        }
+
+        /** @brief Whether zones are being recorded (capture or background). */
+        bool isRecording() const {
+            return m_capturing.load(std::memory_order_relaxed) ||
+                   m_background.load(std::memory_order_relaxed);
+        }
+
+        /** @brief One zone pulled out of the rings by snapshotRecent(). */
+        struct Sample {
+            const char* name = nullptr; ///< Static zone name
+            uint64_t startUs = 0;       ///< Start, profiler clock (nowMicros)
+            uint64_t endUs = 0;         ///< End, profiler clock
+            uint64_t threadId = 0;      ///< Hashed owning thread id
+        };
+
+        /**
+         * @brief Copies recent zones out of every thread ring, oldest first
+         * @param sinceUs Skip zones that ended before this time (nowMicros clock)
+         * @param maxEvents Keep at most this many zones (newest win)
+         *
+         * Best-effort: threads keep writing while the snapshot walks their
+         * rings, so the newest slot of a busy ring may be torn. Good enough
+         * for hitch forensics; use endCapture() for exact traces.
+         */
+        std::vector<Sample> snapshotRecent(uint64_t sinceUs, size_t maxEvents);
+
+        /**
+         * @brief Appends one completed zone; called by ProfileScope
+         * @param name Static string literal identifying the zone
+         */
+        void record(const char* name, uint64_t startUs, uint64_t endUs);
+
+        /** @brief Microseconds since profiler epoch (steady clock). */
+        static uint64_t nowMicros();
+
+    private:
+        CpuProfiler() = default;
+
+        static constexpr size_t kEventsPerThread = 1 << 16;
+
+        struct Event {
+            const char* name = nullptr;
+            uint64_t startUs = 0;
+            uint64_t endUs = 0;
+        };
+
+        struct ThreadBuffer {
+            std::vector<Event> events{kEventsPerThread};
+            std::atomic<uint64_t> head{0};  ///< Total events written (monotonic)
+            uint64_t threadId = 0;
+        };
+
+        ThreadBuffer& threadBuffer();
+
+        std::atomic<bool> m_capturing{false};
+        std::atomic<bool> m_background{false};
+        std::mutex m_registryMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    };
+
+    /**
+     * @class ProfileScope
+     * @brief RAII zone; use via the PROFILE_SCOPE macro
+     */
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name) : m_name(name) {
+            if (CpuProfiler::get().isRecording()) {
+                m_startUs = CpuProfiler::nowMicros();
+            }
+        }
+
+        ~ProfileScope() {
+            if (m_startUs != 0) {
+                CpuProfiler::get().record(m_name, m_startUs, CpuProfiler::nowMicros());
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_name;
+        uint64_t m_startUs = 0;
+    };
+
+} // namespace vkeng
+
+#define VKENG_PROFILE_CONCAT2(a, b) a##b
+#define VKENG_PROFILE_CONCAT(a, b) VKENG_PROFILE_CONCAT2(a, b)
+
+/// Times the enclosing block as a named zone; name must be a string literal
+#define PROFILE_SCOPE(name) \
+    ::vkeng::ProfileScope VKENG_PROFILE_CONCAT(_profileScope, __LINE__)(name)
+
+/// Times the enclosing function under its own name
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
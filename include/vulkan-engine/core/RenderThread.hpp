@@ -0,0 +1,77 @@
+/**
+ * @file RenderThread.hpp
+ * @brief Dedicated thread that records and submits frames one behind the update thread
+ *
+ * With a single thread, frame time is update cost PLUS record/submit cost.
+ * The render thread overlaps them: the update thread builds frame packet
+ * N+1 (culling, sorting, uploads) while this thread records and submits
+ * packet N. The pipeline is exactly one frame deep — submit() waits for
+ * the previous frame's work to finish before queuing the next — so the
+ * two threads never touch the same packet or frame-in-flight slot.
+ *
+ * Key Render Thread Concepts:
+ * - Mailbox: one pending work item, not a queue; depth stays bounded at
+ *   one frame and latency never grows under load
+ * - Exception Relay: a throw on the render thread is captured and
+ *   rethrown from the next submit()/flush() on the update thread, where
+ *   the app's existing error handling lives
+ * - Flush: blocks until the in-flight item completes; required before
+ *   swapchain recreation or renderer teardown (see
+ *   Renderer::setRecreateSyncCallback)
+ */
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace vkeng {
+
+    class RenderThread {
+    public:
+        RenderThread();
+
+        /** @brief Flushes outstanding work and joins the thread. */
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        /**
+         * @brief Queues one frame of render work
+         * @param work Typically a bound Renderer::submitFramePacket() call
+         *
+         * Blocks until the PREVIOUS frame's work has completed (one-deep
+         * pipeline), then hands this one to the thread and returns. If the
+         * previous item threw, the exception is rethrown here.
+         */
+        void submit(std::function<void()> work);
+
+        /**
+         * @brief Blocks until the in-flight item (if any) has completed
+         *
+         * Rethrows any exception the item raised. Call before touching
+         * state the render thread may still be reading — swapchain
+         * recreation, renderer destruction, engine shutdown.
+         */
+        void flush();
+
+    private:
+        void threadMain();
+
+        /** @brief Waits for the pending item to finish; lock must be held. */
+        void waitIdle(std::unique_lock<std::mutex>& lock);
+
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workDone;
+        std::function<void()> m_pending;        ///< The mailbox: at most one item
+        std::exception_ptr m_pendingException;  ///< Relayed to the next submit()/flush()
+        bool m_hasWork = false;
+        bool m_running = true;
+    };
+
+} // namespace vkeng
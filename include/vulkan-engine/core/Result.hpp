@@ -11,10 +11,14 @@
  * - Error: Structured error information with optional Vulkan result codes
  * - Explicit Handling: All failures must be explicitly checked and handled
  * - No Hidden Exceptions: Vulkan errors don't throw, they return Result types
+ * - Lean Success Path: the error payload lives behind a pointer that is
+ *   only materialized on failure, so a successful Result is the value
+ *   plus a tag — no string construction, no allocation
  */
 
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <variant>
 #include <string>
@@ -39,13 +43,25 @@ namespace vkeng {
          * @param msg Error description
          */
         Error(const std::string& msg);
-        
+
+        /**
+         * @brief Creates error from a static/literal message
+         *
+         * Preferred for the common literal-message case: the string is
+         * copied once here, at the failure site, instead of a temporary
+         * std::string materializing at every call regardless of outcome.
+         */
+        Error(const char* msg);
+
         /**
          * @brief Creates error with message and Vulkan result code
          * @param msg Error description
          * @param result Vulkan result code that caused the error
          */
         Error(const std::string& msg, VkResult result);
+
+        /** @brief Static/literal message plus Vulkan result code. */
+        Error(const char* msg, VkResult result);
         
         /**
          * @brief Get human-readable string for Vulkan error codes
@@ -70,6 +86,11 @@ namespace vkeng {
      * 
      * @note Attempting to get value from failed Result throws exception
      * @warning Always check isSuccess() before calling getValue()
+     *
+     * The error payload is boxed: the variant's failure alternative is a
+     * unique_ptr<Error>, so a successful Result is sizeof(T) plus a tag
+     * and the Error (with its strings) is only allocated at the failure
+     * site. Results move freely; copying clones the boxed error.
      */
     template<typename T>
     class Result {
@@ -77,72 +98,92 @@ namespace vkeng {
         // ============================================================================
         // Constructors
         // ============================================================================
-        
+
         /**
          * @brief Construct successful result with value
          */
-        Result(const T& value) : m_value(value) {}
-        Result(T&& value) : m_value(std::move(value)) {}
-        
+        Result(const T& value) : m_value(std::in_place_index<0>, value) {}
+        Result(T&& value) : m_value(std::in_place_index<0>, std::move(value)) {}
+
         /**
-         * @brief Construct failed result with error
+         * @brief Construct failed result with error (allocates the error box)
          */
-        Result(const Error& error) : m_value(error) {}
-        Result(Error&& error) : m_value(std::move(error)) {}
-        
+        Result(const Error& error) : m_value(std::in_place_index<1>, std::make_unique<Error>(error)) {}
+        Result(Error&& error) : m_value(std::in_place_index<1>, std::make_unique<Error>(std::move(error))) {}
+
+        Result(Result&&) = default;
+        Result& operator=(Result&&) = default;
+
+        /** @brief Copies clone the boxed error so both Results stay independent. */
+        Result(const Result& other)
+            : m_value(other.isSuccess()
+                ? Storage(std::in_place_index<0>, std::get<0>(other.m_value))
+                : Storage(std::in_place_index<1>, std::make_unique<Error>(*std::get<1>(other.m_value)))) {}
+
+        Result& operator=(const Result& other) {
+            if (this != &other) {
+                if (other.isSuccess()) {
+                    m_value.template emplace<0>(std::get<0>(other.m_value));
+                } else {
+                    m_value.template emplace<1>(std::make_unique<Error>(*std::get<1>(other.m_value)));
+                }
+            }
+            return *this;
+        }
+
         // ============================================================================
         // Status Checking
         // ============================================================================
-        
+
         /**
          * @brief Check if result contains a successful value
          * @return true if result contains value, false if error
          */
-        bool isSuccess() const { 
-            return std::holds_alternative<T>(m_value); 
+        bool isSuccess() const {
+            return m_value.index() == 0;
         }
-        
+
         /**
          * @brief Check if result contains an error
          * @return true if result contains error, false if successful
          */
-        bool hasError() const { 
-            return std::holds_alternative<Error>(m_value); 
+        bool hasError() const {
+            return m_value.index() == 1;
         }
-        
+
         // ============================================================================
         // Value Access
         // ============================================================================
-        
+
         /**
          * @brief Get the successful value
          * @return Reference to the contained value
          * @warning Throws std::runtime_error if result contains error
          * @note Always check isSuccess() before calling this method
          */
-        const T& getValue() const { 
+        const T& getValue() const {
             if (hasError()) {
                 throw std::runtime_error(getError().message);
             }
-            return std::get<T>(m_value); 
+            return std::get<0>(m_value);
         }
-        
-        T& getValue() { 
+
+        T& getValue() {
             if (hasError()) {
                 throw std::runtime_error(getError().message);
             }
-            return std::get<T>(m_value); 
+            return std::get<0>(m_value);
         }
-        
+
         // Get error
         const Error& getError() const {
-            return std::get<Error>(m_value);
+            return *std::get<1>(m_value);
         }
-        
+
         // Safe access
         const T* tryGetValue() const {
             if (isSuccess()) {
-                return &std::get<T>(m_value);
+                return &std::get<0>(m_value);
             }
             return nullptr;
         }
@@ -171,21 +212,38 @@ namespace vkeng {
         }
         
     private:
-        std::variant<T, Error> m_value;
+        /// Value inline, error boxed: success never touches the allocator
+        using Storage = std::variant<T, std::unique_ptr<Error>>;
+        Storage m_value;
     };
 
-    // Specialization for void
+    // Specialization for void: a null pointer is success, so the whole
+    // Result is one word and the common all-good path is a null check
     template<>
     class Result<void> {
     public:
-        Result() : m_error(std::nullopt) {}
-        Result(const Error& error) : m_error(error) {}
-        Result(Error&& error) : m_error(std::move(error)) {}
-        
-        bool isSuccess() const { return !m_error.has_value(); }
-        bool hasError() const { return m_error.has_value(); }
-        
-        const Error& getError() const { return m_error.value(); }
+        Result() = default;
+        Result(const Error& error) : m_error(std::make_unique<Error>(error)) {}
+        Result(Error&& error) : m_error(std::make_unique<Error>(std::move(error))) {}
+
+        Result(Result&&) = default;
+        Result& operator=(Result&&) = default;
+
+        /** @brief Copies clone the boxed error so both Results stay independent. */
+        Result(const Result& other)
+            : m_error(other.m_error ? std::make_unique<Error>(*other.m_error) : nullptr) {}
+
+        Result& operator=(const Result& other) {
+            if (this != &other) {
+                m_error = other.m_error ? std::make_unique<Error>(*other.m_error) : nullptr;
+            }
+            return *this;
+        }
+
+        bool isSuccess() const { return m_error == nullptr; }
+        bool hasError() const { return m_error != nullptr; }
+
+        const Error& getError() const { return *m_error; }
         
         explicit operator bool() const { return isSuccess(); }
         
@@ -205,14 +263,15 @@ namespace vkeng {
         }
         
     private:
-        std::optional<Error> m_error;
+        std::unique_ptr<Error> m_error;    ///< Materialized on failure only
     };
 
-    // Add missing function declarations that are used in .cpp
-    Result<void> checkVkResult(VkResult result, const std::string& operation);
-    
+    // Helpers take the operation as a literal so the success path builds
+    // no message at all; the string is assembled only on failure
+    Result<void> checkVkResult(VkResult result, const char* operation);
+
     template<typename T>
-    Result<T> wrapVkResult(VkResult result, const T& value, const std::string& operation);
+    Result<T> wrapVkResult(VkResult result, const T& value, const char* operation);
 
     // Helper macros for Vulkan calls
     #define VK_CHECK_RESULT(call, errorMsg) \
@@ -0,0 +1,134 @@
+/**
+ * @file StagingRing.hpp
+ * @brief Persistent ring-buffer staging allocator for CPU→GPU uploads
+ *
+ * Provides a single pre-mapped staging buffer that uploads sub-allocate from
+ * in ring order, replacing the create-buffer/copy/wait-idle/destroy cycle
+ * previously performed for every upload. Reclamation is GPU-progress
+ * tracked: a region becomes reusable once the timeline value (or, on the
+ * fallback path, the fence) guarding the transfer that read from it has
+ * signaled.
+ *
+ * Key Upload Concepts:
+ * - Pre-mapped Memory: Uploads are a plain memcpy, no allocation per upload
+ * - Ring Allocation: Regions are handed out in order and retired in order
+ * - Progress Tracking: Timeline values (or fences) gate space reuse
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <deque>
+#include <memory>
+
+#include "Result.hpp"
+
+namespace vkeng {
+
+    class Buffer;
+
+    /**
+     * @class StagingRing
+     * @brief Fence-tracked ring allocator over a persistently mapped staging buffer
+     *
+     * Usage pattern (driven by MemoryManager):
+     * @code
+     *   auto alloc = ring.allocate(size);
+     *   memcpy(alloc.getValue().mappedPtr, data, size);
+     *   // record vkCmdCopyBuffer from alloc.buffer/alloc.offset ...
+     *   ring.onSubmit(fence);   // all allocations since last submit guarded by fence
+     *   ring.retireCompleted(); // called before future allocations
+     * @endcode
+     *
+     * @note Not thread-safe; callers must synchronize externally (MemoryManager
+     *       serializes uploads through its own locking).
+     */
+    class StagingRing {
+    public:
+        /** @brief A sub-allocation inside the ring's mapped staging buffer. */
+        struct Allocation {
+            void* mappedPtr = nullptr;        ///< CPU write destination (pre-mapped)
+            VkBuffer buffer = VK_NULL_HANDLE; ///< Staging buffer to copy from
+            VkDeviceSize offset = 0;          ///< Offset of this allocation in the buffer
+        };
+
+        /**
+         * @brief Constructs the ring over a persistently mapped staging buffer.
+         * @param device Logical device (for fence/semaphore status queries)
+         * @param stagingBuffer Host-visible buffer backing the ring (kept alive)
+         * @param mappedPtr Persistent mapping of the staging buffer
+         * @param timeline Transfer timeline semaphore; when non-null regions
+         *        are guarded by timeline values instead of fences (borrowed,
+         *        must outlive the ring)
+         */
+        StagingRing(VkDevice device, std::shared_ptr<Buffer> stagingBuffer, void* mappedPtr,
+                    VkSemaphore timeline = VK_NULL_HANDLE);
+
+        StagingRing(const StagingRing&) = delete;
+        StagingRing& operator=(const StagingRing&) = delete;
+
+        /**
+         * @brief Sub-allocates a region of the ring.
+         * @param size Requested size in bytes
+         * @param alignment Required alignment (default 16, covers buffer copies)
+         * @return The allocation, or an Error if the ring cannot satisfy the
+         *         request (caller should fall back to a one-shot staging buffer)
+         *
+         * Retires completed regions first. Fails rather than blocking when the
+         * ring is full of in-flight data, so callers never stall on the GPU.
+         */
+        Result<Allocation> allocate(VkDeviceSize size, VkDeviceSize alignment = 16);
+
+        /**
+         * @brief Marks all allocations since the last submit as guarded by a fence.
+         * @param fence Fence signaled when the transfer reading these regions completes
+         *
+         * The fence handle is borrowed; the owner must not reset it before the
+         * guarded regions have been retired (retireCompleted observes signaled
+         * status, so waiting on the fence before reset is sufficient).
+         */
+        void onSubmit(VkFence fence);
+
+        /**
+         * @brief Marks all allocations since the last submit as guarded by a
+         *        timeline value.
+         * @param timelineValue Value the transfer's submit signals on the
+         *        ring's timeline semaphore
+         *
+         * Only valid when the ring was constructed with a timeline.
+         */
+        void onSubmit(uint64_t timelineValue);
+
+        /** @brief Releases regions whose guarding fences/values have signaled. */
+        void retireCompleted();
+
+        /** @brief Total capacity of the ring in bytes. */
+        VkDeviceSize getCapacity() const { return m_capacity; }
+
+    private:
+        /** @brief Byte count consumed since the previous submit, guarded by one submit. */
+        struct InFlightRegion {
+            VkDeviceSize size;          ///< Bytes (including alignment/wrap padding) to release
+            VkFence fence;              ///< Signals when the region is reusable (fence path)
+            uint64_t timelineValue;     ///< Timeline counter target (timeline path)
+        };
+
+        // The live span is always contiguous modulo capacity: it starts at
+        // m_tail and covers m_live bytes; the write head is derived from both.
+        // Alignment and wrap padding are counted as live so retirement in FIFO
+        // order keeps the accounting exact.
+
+        VkDevice m_device;                        ///< For fence/semaphore status polling
+        VkSemaphore m_timeline;                   ///< Transfer timeline (null = fence tracking)
+        std::shared_ptr<Buffer> m_buffer;         ///< Backing staging buffer (owned)
+        uint8_t* m_mappedBase;                    ///< Persistent CPU mapping
+        VkDeviceSize m_capacity;                  ///< Ring size in bytes
+
+        VkDeviceSize m_tail = 0;                  ///< Oldest still-in-flight byte
+        VkDeviceSize m_live = 0;                  ///< Outstanding bytes (incl. padding)
+        VkDeviceSize m_openSize = 0;              ///< Bytes consumed since last onSubmit()
+
+        std::deque<InFlightRegion> m_inFlight;    ///< FIFO of fence-guarded regions
+    };
+
+} // namespace vkeng
@@ -0,0 +1,101 @@
+/**
+ * @file StringId.hpp
+ * @brief 64-bit compile-time string hash identifiers
+ *
+ * Name lookups used to compare std::string keys: every query hashed the
+ * full string at runtime and map misses still paid allocation and
+ * comparison costs. A StringId is the string's 64-bit FNV-1a hash,
+ * computable at compile time from a literal, so hot lookup paths (the
+ * resource name map, scene node queries from the scripting layer) key on
+ * a single integer.
+ *
+ * Key Concepts:
+ * - FNV-1a: simple, constexpr-friendly 64-bit hash with good dispersion
+ *   for short identifier-like strings. Collisions are astronomically
+ *   unlikely at 64 bits but checked anyway in debug builds
+ * - Literal Operator: "player_root"_id evaluates to the hash at compile
+ *   time — zero runtime hashing for literal queries
+ * - Debug Retention: debug builds keep a hash -> string registry so ids
+ *   can be printed and collisions between distinct strings detected;
+ *   release builds carry the bare 8-byte hash and nothing else
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace vkeng {
+
+    /**
+     * @class StringId
+     * @brief A string identity reduced to its 64-bit FNV-1a hash
+     *
+     * Ids constructed from identical strings compare equal; construction
+     * from a literal via the ""_id operator is entirely compile-time.
+     * Hashable with std::hash (identity — the value already is a hash),
+     * so it drops into unordered_map keys directly.
+     */
+    class StringId {
+    public:
+        constexpr StringId() = default;
+
+        /** @brief Hashes a string at compile time when given a constant. */
+        constexpr StringId(const char* str, size_t length)
+            : m_hash(hash(str, length)) {}
+
+        /** @brief Runtime construction from a dynamic string (registers the debug name). */
+        explicit StringId(const std::string& str);
+
+        constexpr uint64_t getHash() const { return m_hash; }
+        constexpr bool isValid() const { return m_hash != 0; }
+
+        constexpr bool operator==(const StringId& other) const { return m_hash == other.m_hash; }
+        constexpr bool operator!=(const StringId& other) const { return m_hash != other.m_hash; }
+        constexpr bool operator<(const StringId& other) const { return m_hash < other.m_hash; }
+
+        /**
+         * @brief The source string, when known — debug builds only.
+         *
+         * Resolves through the debug registry; ids built purely at
+         * compile time (never passed through the runtime constructor)
+         * resolve to "<unknown>". Release builds return the hash digits.
+         */
+        std::string getDebugString() const;
+
+        /** @brief Constexpr FNV-1a over a character range. */
+        static constexpr uint64_t hash(const char* str, size_t length) {
+            uint64_t value = kOffsetBasis;
+            for (size_t i = 0; i < length; ++i) {
+                value ^= static_cast<uint8_t>(str[i]);
+                value *= kPrime;
+            }
+            return value;
+        }
+
+    private:
+        static constexpr uint64_t kOffsetBasis = 14695981039346656037ull;
+        static constexpr uint64_t kPrime = 1099511628211ull;
+
+        uint64_t m_hash = 0;
+    };
+
+    namespace literals {
+        /** @brief Compile-time string id: "node_name"_id */
+        constexpr StringId operator""_id(const char* str, size_t length) {
+            return StringId(str, length);
+        }
+    }
+
+} // namespace vkeng
+
+namespace std {
+    /// StringId is already a hash; identity keeps unordered_map lookups to one integer op.
+    template<>
+    struct hash<vkeng::StringId> {
+        size_t operator()(const vkeng::StringId& id) const noexcept {
+            return static_cast<size_t>(id.getHash());
+        }
+    };
+}
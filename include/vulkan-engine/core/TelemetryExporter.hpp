@@ -0,0 +1,159 @@
+/**
+ * @file TelemetryExporter.hpp
+ * @brief Periodic fleet metrics export over HTTP (Prometheus) and rotating CSV
+ *
+ * The hitch watchdog answers "what happened in that one bad frame"; this
+ * answers "how are the dozens of installations doing right now". Every
+ * frame the engine records a compact sample, and a background thread
+ * aggregates each interval into a snapshot — frame-time percentiles, GPU
+ * pass averages, draw counters, VRAM usage — published as Prometheus text
+ * on a local HTTP port and appended to an optional rotating CSV.
+ *
+ * Key Telemetry Concepts:
+ * - Allocation-Free Frame Path: recordFrame() writes into fixed-size
+ *   accumulators (frame-time ring, bounded GPU pass table) under a
+ *   briefly-held mutex; nothing on the frame path touches the heap
+ * - Frame-Path Sampling: GPU timings and memory stats are read on the
+ *   frame path because GpuProfiler resolves its table on that thread;
+ *   the exporter thread only ever sees the aggregated copy
+ * - Interval Snapshot: the exporter thread swaps the accumulators out
+ *   each interval, computes percentiles from the frame-time window, and
+ *   formats the exposition off the frame path
+ * - Scrape Endpoint: a minimal non-blocking listener serves the latest
+ *   exposition to any HTTP GET; no request parsing beyond best effort
+ * - Rotating CSV: rows append until the file exceeds the size limit,
+ *   then files shift (path -> path.1 -> path.2), so soak runs on
+ *   installations without a scraper cannot fill the disk
+ */
+#pragma once
+
+#include "vulkan-engine/core/Config.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace vkeng {
+
+    class TelemetryExporter {
+    public:
+        /** @brief Renderer counters sampled each frame (see setDrawStatsProvider). */
+        struct DrawStats {
+            uint32_t drawCalls = 0;         ///< Draws issued last frame
+            uint32_t culledDraws = 0;       ///< Draws rejected by culling
+            uint32_t instancedBatches = 0;  ///< Instanced batches submitted last frame
+        };
+
+        /**
+         * @brief Starts the exporter thread and opens the HTTP listener
+         * @param memoryManager Memory manager sampled for VRAM stats
+         * @param config Port, interval, and CSV rotation settings
+         *
+         * A failed socket bind (port taken), or a platform without BSD
+         * sockets, logs a warning and disables the endpoint; aggregation
+         * and CSV output still run.
+         */
+        TelemetryExporter(std::shared_ptr<MemoryManager> memoryManager,
+                          const Config::Telemetry& config);
+
+        /** @brief Stops the exporter thread and closes the listener. */
+        ~TelemetryExporter();
+
+        TelemetryExporter(const TelemetryExporter&) = delete;
+        TelemetryExporter& operator=(const TelemetryExporter&) = delete;
+
+        /**
+         * @brief Supplies renderer draw counters for frame samples
+         *
+         * The engine core does not own the renderer, so applications wire
+         * this up after creating theirs; draw metrics read zero until then.
+         */
+        void setDrawStatsProvider(std::function<DrawStats()> provider) {
+            m_drawStatsProvider = std::move(provider);
+        }
+
+        /**
+         * @brief Records one completed frame into the current interval
+         * @param frameMs Wall time of the frame's workload (pacing excluded)
+         * @param fixedUpdateMs Time spent in the fixed-step loop this frame
+         * @param audioMs Time spent in the audio update this frame
+         *
+         * Call once per frame on the main thread, before the frame
+         * limiter. Allocation-free: samples the draw provider, GPU pass
+         * timings, and memory stats into fixed accumulators.
+         */
+        void recordFrame(double frameMs, double fixedUpdateMs, double audioMs);
+
+        /** @brief Latest published Prometheus exposition (empty before the first interval). */
+        std::string getExposition() const;
+
+    private:
+        // Percentiles cover at most this many recent frames per interval;
+        // ~17 s at 120 Hz, so a default interval never overflows the window
+        static constexpr uint32_t kFrameWindow = 2048;
+        static constexpr uint32_t kMaxPasses = 32;       ///< Distinct GPU pass names tracked
+        static constexpr uint32_t kPassNameLength = 48;  ///< Longer pass names are truncated
+
+        /** @brief Per-pass running totals; names copied once into fixed storage. */
+        struct PassAccumulator {
+            char name[kPassNameLength] = {};
+            double totalMs = 0.0;
+            uint64_t samples = 0;
+        };
+
+        /** @brief One interval's worth of frame samples, fixed-size throughout. */
+        struct Accumulator {
+            float frameMs[kFrameWindow] = {};       ///< Ring of recent frame times
+            uint32_t frameHead = 0;                 ///< Next ring write slot
+            uint64_t frameCount = 0;                ///< Frames recorded this interval
+            double frameMsSum = 0.0;
+            double fixedUpdateMsSum = 0.0;
+            double audioMsSum = 0.0;
+            uint64_t drawCallSum = 0;
+            uint64_t culledDrawSum = 0;
+            uint64_t instancedBatchSum = 0;
+            PassAccumulator passes[kMaxPasses];
+            uint32_t passCount = 0;
+            MemoryManager::MemoryStats memory;      ///< Latest per-frame snapshot
+        };
+
+        /** @brief Exporter thread: serves scrapes and publishes each interval. */
+        void run();
+
+        /** @brief Swaps the accumulator out, computes the snapshot, publishes it. */
+        void publishInterval();
+
+        /** @brief Appends one CSV row, rotating files past the size limit. */
+        void appendCsvRow(const std::string& row);
+
+        /** @brief Opens the non-blocking listen socket; -1 on failure. */
+        static int openListenSocket(uint16_t port);
+
+        /** @brief Accepts and answers pending scrape connections. */
+        void servePendingConnections();
+
+        Config::Telemetry m_config;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        std::function<DrawStats()> m_drawStatsProvider;
+
+        mutable std::mutex m_sampleMutex;   ///< Guards m_accumulator (held briefly per frame)
+        Accumulator m_accumulator;
+
+        mutable std::mutex m_expositionMutex;  ///< Guards m_exposition
+        std::string m_exposition;              ///< Latest formatted Prometheus text
+
+        std::thread m_thread;
+        std::mutex m_wakeMutex;
+        std::condition_variable m_wake;     ///< Wakes the exporter thread for shutdown
+        bool m_running = false;
+
+        int m_listenFd = -1;                ///< HTTP listen socket (-1 = disabled)
+        uint64_t m_intervalsPublished = 0;  ///< Snapshots published since startup
+    };
+
+} // namespace vkeng
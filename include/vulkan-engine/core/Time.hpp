@@ -80,6 +80,22 @@ namespace vkeng {
          */
         bool consumeFixedStep();
 
+        /**
+         * @brief Fraction of a fixed step left in the accumulator, in [0, 1].
+         *
+         * After the consumeFixedStep() loop drains the accumulator, this is
+         * how far the render frame sits between the last fixed step and the
+         * next one. Systems that snapshot previous/current fixed-step state
+         * (e.g. PhysicsWorld) use it to interpolate poses at render time.
+         */
+        float fixedStepAlpha() const {
+            if (m_fixedDeltaTime <= 0.0f) {
+                return 0.0f;
+            }
+            float alpha = m_fixedAccumulator / m_fixedDeltaTime;
+            return alpha < 1.0f ? alpha : 1.0f;
+        }
+
         // ============================================================================
         // Time scale
         // ============================================================================
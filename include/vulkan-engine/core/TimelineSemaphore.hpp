@@ -0,0 +1,93 @@
+/**
+ * @file TimelineSemaphore.hpp
+ * @brief Monotonic timeline semaphore for engine-wide GPU/CPU synchronization
+ *
+ * Wraps a VK_SEMAPHORE_TYPE_TIMELINE semaphore: one monotonically increasing
+ * 64-bit counter per queue replaces the binary-semaphore/fence pairs that
+ * previously guarded each submission. Submissions signal reserved values,
+ * the CPU waits on exact values, and nothing ever needs resetting.
+ *
+ * Key Synchronization Concepts:
+ * - Timeline Values: Each submission signals a unique, increasing value
+ * - Wait-Before-Signal: Waits on not-yet-submitted values are legal, so
+ *   worker threads may submit dependent work out of order
+ * - Exact CPU Waits: vkWaitSemaphores blocks until the counter reaches a
+ *   value, replacing the wait/reset fence cycle
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "Result.hpp"
+
+namespace vkeng {
+
+    /**
+     * @class TimelineSemaphore
+     * @brief RAII wrapper over a Vulkan timeline semaphore with value reservation
+     *
+     * Usage pattern:
+     * @code
+     *   uint64_t value = timeline->reserveValue();
+     *   // chain VkTimelineSemaphoreSubmitInfo signaling `value` ...
+     *   timeline->wait(value);              // CPU wait, no reset needed
+     *   timeline->isComplete(value);        // non-blocking poll
+     * @endcode
+     *
+     * reserveValue() is atomic, so multiple threads may reserve and submit
+     * concurrently; values signal in submission order per queue, but waits
+     * are on exact values so cross-thread ordering never over-synchronizes.
+     */
+    class TimelineSemaphore {
+    public:
+        /**
+         * @brief Creates a timeline semaphore with an initial value of zero.
+         * @param device Logical device (must have timelineSemaphore enabled)
+         */
+        static Result<std::shared_ptr<TimelineSemaphore>> create(VkDevice device);
+
+        ~TimelineSemaphore();
+
+        TimelineSemaphore(const TimelineSemaphore&) = delete;
+        TimelineSemaphore& operator=(const TimelineSemaphore&) = delete;
+
+        VkSemaphore getHandle() const { return m_semaphore; }
+
+        /**
+         * @brief Reserves the next value on the timeline.
+         *
+         * The caller must submit work that signals the returned value (or
+         * signal it from the host); reservations are atomic so worker
+         * threads can reserve before their submission order is decided.
+         */
+        uint64_t reserveValue() { return m_nextValue.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+        /** @brief Most recently reserved value (0 if nothing reserved yet). */
+        uint64_t lastReservedValue() const { return m_nextValue.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Blocks until the timeline reaches the given value.
+         * @param value Target counter value
+         * @param timeoutNs Wait budget in nanoseconds (default: forever)
+         */
+        Result<void> wait(uint64_t value, uint64_t timeoutNs = UINT64_MAX) const;
+
+        /** @brief Current counter value as observed by the device. */
+        uint64_t getCompletedValue() const;
+
+        /** @brief Non-blocking check whether the timeline has reached a value. */
+        bool isComplete(uint64_t value) const { return getCompletedValue() >= value; }
+
+    private:
+        TimelineSemaphore(VkDevice device, VkSemaphore semaphore)
+            : m_device(device), m_semaphore(semaphore) {}
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        VkSemaphore m_semaphore = VK_NULL_HANDLE;
+        std::atomic<uint64_t> m_nextValue{0};   ///< Last reserved value
+    };
+
+} // namespace vkeng
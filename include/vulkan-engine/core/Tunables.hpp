@@ -0,0 +1,153 @@
+/**
+ * @file Tunables.hpp
+ * @brief Runtime registry of live-adjustable performance settings
+ *
+ * Config.hpp is read once at startup; evaluating a performance trade-off
+ * (culling toggles, LOD bias, frame cap) through it means a restart per
+ * data point. The tunables registry lets subsystems expose typed, named
+ * parameters that can be changed while the engine runs, so A/B-ing
+ * settings on target hardware takes minutes instead of rebuild cycles.
+ *
+ * Key Tunables Concepts:
+ * - Registration: each subsystem registers its parameters with a name,
+ *   type, range, and an apply callback, and unregisters them when it is
+ *   destroyed; the registry never outlives a dangling callback
+ * - Frame-Boundary Application: set() only stages a value. The engine
+ *   calls applyPending() once per frame before the update phase, where
+ *   staged values are clamped and delivered on the main thread — no
+ *   subsystem sees a parameter change mid-frame
+ * - Control File: an optional watched text file ("name = value" lines)
+ *   is re-read when its timestamp moves, mirroring the shader hot-reload
+ *   workflow; editing the file adjusts a running engine, including on
+ *   customer hardware where attaching tooling is impractical
+ * - Discovery: logAll() prints every registered parameter with its
+ *   current value and description, which doubles as the control file
+ *   template
+ */
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    /** @brief Value type of a registered tunable. */
+    enum class TunableType {
+        Bool,
+        Int,
+        Float
+    };
+
+    /**
+     * @class Tunables
+     * @brief Singleton registry of live-adjustable engine parameters
+     *
+     * Thread-safe: set() may be called from any thread (it only stages),
+     * while applyPending() runs the apply callbacks on the caller's thread
+     * — the engine invokes it from the main loop at the frame boundary.
+     */
+    class Tunables {
+    public:
+        static Tunables& get();
+
+        /** @brief Registered parameter snapshot for display and logging. */
+        struct Info {
+            std::string name;           ///< Dotted registry name (e.g. "renderer.culling")
+            TunableType type;           ///< Value type
+            float value;                ///< Current value (bools as 0/1)
+            float minValue;             ///< Lower clamp (Int/Float)
+            float maxValue;             ///< Upper clamp (Int/Float)
+            std::string description;    ///< One-line help text
+        };
+
+        /**
+         * @brief Register a boolean parameter.
+         * @param name Dotted registry name; must be unique
+         * @param initial Current value at registration time
+         * @param apply Callback invoked at the frame boundary with new values
+         * @param description One-line help text for logAll()
+         */
+        void registerBool(const std::string& name, bool initial,
+                          std::function<void(bool)> apply, std::string description);
+
+        /** @brief Register an integer parameter clamped to [minValue, maxValue]. */
+        void registerInt(const std::string& name, int initial, int minValue, int maxValue,
+                         std::function<void(int)> apply, std::string description);
+
+        /** @brief Register a float parameter clamped to [minValue, maxValue]. */
+        void registerFloat(const std::string& name, float initial, float minValue, float maxValue,
+                           std::function<void(float)> apply, std::string description);
+
+        /**
+         * @brief Remove a parameter; the owning subsystem calls this before
+         *        the captured state in its apply callback is destroyed.
+         */
+        void unregister(const std::string& name);
+
+        /**
+         * @brief Stage a new value, parsed according to the parameter's type.
+         * @param name Registered parameter name
+         * @param value Textual value: "true"/"false"/"1"/"0" for bools,
+         *        decimal for ints and floats
+         * @return false if the name is unknown or the value fails to parse
+         *
+         * The value takes effect at the next applyPending(); out-of-range
+         * values are clamped there, not rejected here.
+         */
+        bool set(const std::string& name, const std::string& value);
+
+        /**
+         * @brief Apply all staged values on the calling thread.
+         *
+         * Called by the engine once per frame before onUpdate(). Also polls
+         * the control file (when enabled) at a coarse interval. Each applied
+         * change is logged so a tuning session leaves a record.
+         */
+        void applyPending();
+
+        /**
+         * @brief Watch a "name = value" text file for live adjustments.
+         * @param path Control file; created with the current values and
+         *        descriptions if it does not exist, so the file itself
+         *        documents what can be tuned
+         */
+        void enableFileControl(const std::filesystem::path& path);
+
+        /** @brief Snapshot of every registered parameter (sorted by name). */
+        std::vector<Info> snapshot() const;
+
+        /** @brief Log every registered parameter with value and description. */
+        void logAll() const;
+
+    private:
+        Tunables() = default;
+
+        struct Entry {
+            TunableType type = TunableType::Float;
+            float value = 0.0f;                 ///< Last applied value (bools as 0/1)
+            float minValue = 0.0f;
+            float maxValue = 0.0f;
+            std::function<void(float)> apply;   ///< Typed callback adapted to float
+            std::string description;
+            bool hasPending = false;
+            float pending = 0.0f;
+        };
+
+        void registerEntry(const std::string& name, Entry entry);
+        void pollControlFile();
+        void parseControlFile();
+        void writeControlFileTemplate() const;
+
+        mutable std::mutex m_mutex;                 ///< Guards the entry map and staging
+        std::map<std::string, Entry> m_entries;     ///< Sorted so logAll() groups by subsystem
+
+        std::filesystem::path m_controlFile;        ///< Empty = file control disabled
+        std::filesystem::file_time_type m_controlFileTime{};  ///< Last parsed timestamp
+        uint32_t m_pollCountdown = 0;               ///< Frames until the next mtime check
+    };
+
+} // namespace vkeng
@@ -32,7 +32,8 @@ namespace vkeng {
      * - Queue Families: Different command processing units (graphics, compute, transfer)
      * 
      * @note This implementation focuses on graphics queues for the rendering pipeline
-     * @warning Only supports single graphics queue for Phase 1 requirements
+     * @note A dedicated transfer queue is created when the GPU exposes one, so
+     *       resource uploads can run without serializing against rendering
      */
     class VulkanDevice {
         public:
@@ -43,10 +44,12 @@ namespace vkeng {
          * features and creates a logical device with graphics queue capabilities.
          * 
          * @param instance Valid Vulkan instance for device enumeration
-         * @param surface Surface for checking presentation support
-         * 
+         * @param surface Surface for checking presentation support, or
+         *                VK_NULL_HANDLE for headless (offscreen) rendering
+         *
          * @note Throws std::runtime_error if no suitable GPU is found
-         * @warning Requires a valid surface for graphics queue selection
+         * @note With a null surface, presentation support and the swapchain
+         *       extension are skipped; any graphics queue family qualifies
          */
         explicit VulkanDevice(VkInstance instance, VkSurfaceKHR surface);
         
@@ -89,6 +92,91 @@ namespace vkeng {
          */
         uint32_t getGraphicsFamily() const { return graphicsFamily_; }
 
+        /**
+         * @brief Get the transfer queue for asynchronous resource uploads
+         * @return VkQueue handle; aliases the graphics queue when the GPU has
+         *         no dedicated transfer queue family
+         */
+        VkQueue getTransferQueue() const { return transferQueue_; }
+
+        /**
+         * @brief Get the transfer queue family index
+         * @return Queue family index for transfer operations (may equal the
+         *         graphics family)
+         */
+        uint32_t getTransferFamily() const { return transferFamily_; }
+
+        /**
+         * @brief Check whether a dedicated transfer queue family is available
+         * @return True when transfers run on a different family than graphics,
+         *         making queue ownership transfer barriers necessary
+         */
+        bool hasDedicatedTransferQueue() const { return transferFamily_ != graphicsFamily_; }
+
+        /**
+         * @brief Check whether the device was created without a surface
+         * @return True when running headless (no swapchain extension enabled)
+         */
+        bool isHeadless() const { return headless_; }
+
+        /**
+         * @brief Check whether bindless texture arrays can be used
+         * @return True when the device enabled the descriptor indexing
+         *         features needed for a variable-count, update-after-bind
+         *         sampled image array and push constants can carry the
+         *         extra texture-index block
+         */
+        bool supportsBindlessTextures() const { return bindlessTexturesSupported_; }
+
+        /**
+         * @brief Check whether the indirect multi-draw path can be used
+         * @return True when the device enabled multiDrawIndirect (several
+         *         commands per vkCmdDrawIndexedIndirect) and
+         *         shaderDrawParameters (gl_DrawID in the vertex stage)
+         */
+        bool supportsIndirectDraws() const { return indirectDrawsSupported_; }
+
+        /**
+         * @brief Check whether timeline semaphores can be used
+         * @return True when the device enabled the Vulkan 1.2
+         *         timelineSemaphore feature; subsystems fall back to
+         *         binary semaphore/fence pairs when false
+         */
+        bool supportsTimelineSemaphores() const { return timelineSemaphoresSupported_; }
+
+        /**
+         * @brief Check whether present-wait feedback can be used
+         * @return True when the device enabled VK_KHR_present_id and
+         *         VK_KHR_present_wait, letting the swapchain tag presents
+         *         with IDs and block until one actually reached the display
+         */
+        bool supportsPresentWait() const { return presentWaitSupported_; }
+
+        /**
+         * @brief Check whether per-draw push descriptors can be used
+         * @return True when the device enabled VK_KHR_push_descriptor,
+         *         allowing descriptor writes recorded straight into command
+         *         buffers via push-descriptor set layouts
+         */
+        bool supportsPushDescriptors() const { return pushDescriptorsSupported_; }
+
+        /**
+         * @brief Check whether the meshlet rendering path can be used
+         * @return True when the device enabled the taskShader and meshShader
+         *         features of VK_EXT_mesh_shader; the renderer falls back to
+         *         the classic vertex pipeline when false
+         */
+        bool supportsMeshShading() const { return meshShadingSupported_; }
+
+        /**
+         * @brief Check whether multiview render passes can be used
+         * @return True when the device enabled the Vulkan 1.1 multiview
+         *         feature, letting one render pass instance write several
+         *         array layers with gl_ViewIndex selecting the view; the
+         *         shadow pass falls back to per-cascade passes when false
+         */
+        bool supportsMultiview() const { return multiviewSupported_; }
+
         private:
         // ============================================================================
         // Internal Device Setup Methods
@@ -114,7 +202,17 @@ namespace vkeng {
         VkDevice device_{VK_NULL_HANDLE};                 ///< Logical device interface
         VkQueue graphicsQueue_{VK_NULL_HANDLE};           ///< Graphics command queue
         uint32_t graphicsFamily_{UINT32_MAX};             ///< Graphics queue family index
+        VkQueue transferQueue_{VK_NULL_HANDLE};           ///< Transfer queue (may alias graphics)
+        uint32_t transferFamily_{UINT32_MAX};             ///< Transfer queue family index
+        bool headless_{false};                            ///< Created without a surface
+        bool bindlessTexturesSupported_{false};           ///< Descriptor indexing features enabled
+        bool indirectDrawsSupported_{false};              ///< multiDrawIndirect + shaderDrawParameters enabled
+        bool timelineSemaphoresSupported_{false};         ///< Vulkan 1.2 timelineSemaphore enabled
+        bool presentWaitSupported_{false};                ///< VK_KHR_present_id + VK_KHR_present_wait enabled
+        bool pushDescriptorsSupported_{false};            ///< VK_KHR_push_descriptor enabled
+        bool meshShadingSupported_{false};                ///< VK_EXT_mesh_shader task + mesh features enabled
+        bool multiviewSupported_{false};                  ///< Vulkan 1.1 multiview feature enabled
 
-        // Future expansion: Add support for compute queues, transfer queues, etc.
+        // Future expansion: Add support for compute queues, etc.
     };
 } // namespace vkeng
\ No newline at end of file
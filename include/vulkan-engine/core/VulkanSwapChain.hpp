@@ -16,6 +16,7 @@
 
 #pragma once
 #include <vulkan/vulkan.h>
+#include <chrono>
 #include <vector>
 #include <memory>
 #include "vulkan-engine/core/MemoryManager.hpp"
@@ -23,6 +24,37 @@
 
 namespace vkeng {
 
+    /**
+     * @enum PresentMode
+     * @brief Presentation policy, mapped onto VkPresentModeKHR
+     *
+     * Exposed so deployments can pick their latency/power trade-off instead
+     * of the swapchain choosing internally: MAILBOX for latency-critical
+     * installs, FIFO for power-constrained kiosks.
+     */
+    enum class PresentMode {
+        Auto,        ///< MAILBOX when available, otherwise FIFO (historic default)
+        Fifo,        ///< Vsync; always supported, lowest power
+        FifoRelaxed, ///< Vsync, but tears instead of stuttering when a frame is late
+        Mailbox,     ///< Triple-buffered low latency without tearing
+        Immediate,   ///< Lowest latency, may tear
+    };
+
+    /**
+     * @struct PresentStats
+     * @brief Measured present-to-present timing over a sliding window
+     *
+     * Actual intervals between vkQueuePresentKHR calls, not estimates —
+     * use these to verify a present-mode or frame-limiter change did what
+     * was intended.
+     */
+    struct PresentStats {
+        double averageIntervalMs = 0.0; ///< Mean present-to-present interval
+        double minIntervalMs = 0.0;     ///< Fastest interval in the window
+        double maxIntervalMs = 0.0;     ///< Slowest interval in the window (hitches)
+        uint64_t presentCount = 0;      ///< Total presents since creation
+    };
+
     /**
      * @struct SwapChainSupportDetails
      * @brief Contains swapchain capabilities and supported formats
@@ -65,9 +97,26 @@ namespace vkeng {
          * Automatically selects optimal format (B8G8R8A8_SRGB preferred) and
          * present mode (MAILBOX preferred, falls back to FIFO).
          */
-        VulkanSwapChain(VkDevice device, VkPhysicalDevice phys, VkSurfaceKHR surface, 
+        VulkanSwapChain(VkDevice device, VkPhysicalDevice phys, VkSurfaceKHR surface,
                        uint32_t width, uint32_t height, std::shared_ptr<MemoryManager> memoryManager);
-        
+
+        /**
+         * @brief Constructs a headless (offscreen) swap chain substitute
+         * @param device Logical device for resource creation
+         * @param phys Physical device for capability queries
+         * @param width Offscreen image width in pixels
+         * @param height Offscreen image height in pixels
+         * @param memoryManager Memory manager for image allocation
+         *
+         * Creates a fixed set of offscreen color images (B8G8R8A8_SRGB) that
+         * satisfy the swap chain contract — images(), imageViews(), extent(),
+         * imageFormat() — without any surface or VkSwapchainKHR. Image
+         * acquisition and presentation are emulated in acquireNextImage() and
+         * present() so Renderer::drawFrame runs unchanged.
+         */
+        VulkanSwapChain(VkDevice device, VkPhysicalDevice phys,
+                       uint32_t width, uint32_t height, std::shared_ptr<MemoryManager> memoryManager);
+
         /**
          * @brief Destroys the swap chain and releases all resources
          * 
@@ -96,6 +145,9 @@ namespace vkeng {
         
         /** @brief Gets the image views for all swap chain images. */
         const std::vector<VkImageView>& imageViews() const { return imageViews_; }
+
+        /** @brief Gets the raw swap chain images (for barriers; owned by the swapchain). */
+        const std::vector<VkImage>& images() const { return images_; }
         
         /** @brief Gets the raw Vulkan swap chain handle. */
         VkSwapchainKHR swapChain() const { return swapChain_; }
@@ -106,29 +158,147 @@ namespace vkeng {
         /** @brief Gets the depth format chosen for this device. */
         VkFormat depthFormat() const { return depthFormat_; }
 
+        /** @brief Gets the depth buffer image (sampled by the depth pyramid pass). */
+        const std::shared_ptr<Image>& depthImage() const { return depthImage_; }
+
+        /** @brief Checks whether this is a headless (offscreen) swap chain. */
+        bool isHeadless() const { return surface_ == VK_NULL_HANDLE; }
+
+        // ============================================================================
+        // Present Mode and Timing
+        // ============================================================================
+
+        /**
+         * @brief Selects the presentation policy, recreating the swapchain live.
+         *
+         * If the requested mode differs from the active one, the next
+         * acquireNextImage() reports VK_ERROR_OUT_OF_DATE_KHR so the
+         * renderer's existing recreation path rebuilds the swapchain with
+         * the new mode — no extra plumbing in the frame loop. Unsupported
+         * modes fall back to Auto behavior with a warning at creation.
+         * No-op beyond bookkeeping in headless mode.
+         */
+        void setPresentMode(PresentMode mode);
+
+        /** @brief Gets the requested presentation policy. */
+        PresentMode presentMode() const { return preferredPresentMode_; }
+
+        /** @brief Gets the Vulkan present mode the current swapchain was built with. */
+        VkPresentModeKHR activePresentMode() const { return activePresentMode_; }
+
+        /**
+         * @brief Gets measured present-to-present intervals (sliding window).
+         *
+         * Call from the render thread; the stats are updated by present()
+         * and are not synchronized for concurrent readers.
+         */
+        PresentStats getPresentStats() const;
+
+        /**
+         * @brief Arms VK_KHR_present_wait feedback
+         *
+         * Call once after creation when the device reports
+         * supportsPresentWait(). Every subsequent present() chains an
+         * incrementing VkPresentIdKHR, and waitForPresent() can block until
+         * a given present actually reached the display — the real signal
+         * that the pipeline is running ahead of the screen. No-op in
+         * headless mode or when the function pointer cannot be resolved.
+         */
+        void enablePresentIds();
+
+        /** @brief True when presents carry IDs and waitForPresent() works. */
+        bool presentWaitEnabled() const { return waitForPresentFn_ != nullptr; }
+
+        /** @brief ID attached to the most recent present (0 = none yet). */
+        uint64_t lastPresentId() const { return presentIdCounter_; }
+
+        /**
+         * @brief Blocks until the given present has reached the display
+         * @param presentId ID a previous present() attached (see lastPresentId())
+         * @param timeoutNs Wait cap in nanoseconds
+         * @return Result of vkWaitForPresentKHR; VK_SUCCESS when feedback
+         *         is not enabled (callers need no special casing)
+         */
+        VkResult waitForPresent(uint64_t presentId, uint64_t timeoutNs);
+
         // ============================================================================
         // Swapchain Management
         // ============================================================================
-        
-        /** 
+
+        /**
+         * @brief Acquires the next image to render into
+         * @param queue Graphics queue (used to signal the semaphore in headless mode)
+         * @param imageAvailable Semaphore signaled when the image is ready
+         * @param imageIndex Receives the acquired image index
+         * @return VkResult from vkAcquireNextImageKHR, or VK_SUCCESS in headless mode
+         *
+         * Windowed mode forwards to vkAcquireNextImageKHR. Headless mode
+         * round-robins over the offscreen images and signals the semaphore
+         * via an empty queue submission so the caller's synchronization
+         * logic works identically in both modes.
+         */
+        VkResult acquireNextImage(VkQueue queue, VkSemaphore imageAvailable, uint32_t& imageIndex);
+
+        /**
+         * @brief Presents a rendered image
+         * @param queue Graphics/present queue
+         * @param renderFinished Semaphore to wait on before presenting
+         * @param imageIndex Index of the image to present
+         * @return VkResult from vkQueuePresentKHR, or VK_SUCCESS in headless mode
+         *
+         * Windowed mode forwards to vkQueuePresentKHR. Headless mode consumes
+         * the render-finished semaphore with an empty queue submission (there
+         * is nowhere to present to) so it can be re-signaled next frame.
+         */
+        VkResult present(VkQueue queue, VkSemaphore renderFinished, uint32_t imageIndex);
+
+        /**
          * @brief Recreates the swap chain with new dimensions
          * @param width New width in pixels
          * @param height New height in pixels
-         * 
+         *
          * Called when the window is resized. This method:
-         * 1. Cleans up old depth image and image views
-         * 2. Stores the old swapchain for transition
-         * 3. Re-queries surface capabilities
-         * 4. Creates new swapchain with old swapchain reference
-         * 5. Retrieves new images and creates image views
-         * 6. Recreates depth buffer at new resolution
-         * 
-         * @note Caller must ensure device is idle before calling
+         * 1. Retires the old depth image, image views, and swapchain
+         * 2. Re-queries surface capabilities
+         * 3. Creates new swapchain with the old one as oldSwapchain, so
+         *    in-flight presents transition gracefully instead of requiring
+         *    a device-wide stall
+         * 4. Retrieves new images and creates image views
+         * 5. Recreates depth buffer at new resolution
+         *
+         * The retired resources stay alive until destroyRetired(): the
+         * caller must ensure its own rendering to the old images has
+         * finished (frame fences suffice — no vkDeviceWaitIdle needed)
+         * and defer destroyRetired() until pending presents have drained,
+         * typically MAX_FRAMES_IN_FLIGHT frames later.
+         *
          * @warning All framebuffers using these images must be recreated after
          */
         void recreate(uint32_t width, uint32_t height);
 
+        /**
+         * @brief Destroys swapchains retired by recreate()
+         *
+         * Safe once no queued rendering references the retired views and
+         * the presentation engine has released the retired images (all
+         * presents to the old swapchain have completed or been replaced).
+         * Idempotent; also runs from the destructor.
+         */
+        void destroyRetired();
+
+        /** @brief True while retired swapchain resources await destroyRetired(). */
+        bool hasRetired() const { return !retired_.empty(); }
+
     private:
+        /**
+         * @brief Creates the offscreen color images for headless mode
+         *
+         * Allocates a fixed number of B8G8R8A8_SRGB color-attachment images
+         * via MemoryManager and mirrors their handles/views into images_ and
+         * imageViews_ so accessors behave like a real swap chain.
+         */
+        void createOffscreenImages(uint32_t width, uint32_t height);
+
         // ============================================================================
         // Internal Creation Methods
         // ============================================================================
@@ -184,10 +354,55 @@ namespace vkeng {
         VkSwapchainKHR swapChain_ = VK_NULL_HANDLE;     ///< Vulkan swapchain handle
         VkFormat format_;                               ///< Selected image format
         VkExtent2D extent_;                             ///< Current swapchain extent (resolution)
-        std::vector<VkImage> images_;                   ///< Swapchain images (owned by swapchain)
+        std::vector<VkImage> images_;                   ///< Swapchain images (owned by swapchain or offscreenImages_)
         std::vector<VkImageView> imageViews_;           ///< Image views for swapchain images
         SwapChainSupportDetails support_;               ///< Cached support details
 
+        // ============================================================================
+        // Present Mode and Timing State
+        // ============================================================================
+
+        /// Number of present intervals kept for getPresentStats()
+        static constexpr size_t PRESENT_STATS_WINDOW = 240;
+
+        /** @brief Record the interval since the previous present into the stats ring. */
+        void recordPresentInterval();
+
+        PresentMode preferredPresentMode_ = PresentMode::Auto;              ///< Requested policy
+        VkPresentModeKHR activePresentMode_ = VK_PRESENT_MODE_FIFO_KHR;     ///< Mode the swapchain was built with
+        bool presentModeDirty_ = false;                 ///< Requested mode differs from active; recreate on next acquire
+        std::vector<double> presentIntervalsMs_;        ///< Ring buffer of present-to-present intervals
+        size_t presentIntervalCursor_ = 0;              ///< Next ring slot to overwrite
+        uint64_t presentCount_ = 0;                     ///< Total presents since creation
+        std::chrono::steady_clock::time_point lastPresentTime_{}; ///< Timestamp of the previous present
+
+        // ============================================================================
+        // Present-Wait Feedback State (VK_KHR_present_wait)
+        // ============================================================================
+
+        PFN_vkWaitForPresentKHR waitForPresentFn_ = nullptr; ///< Resolved by enablePresentIds()
+        uint64_t presentIdCounter_ = 0;                 ///< Monotonic ID attached to each present
+
+        // ============================================================================
+        // Headless (Offscreen) Resources
+        // ============================================================================
+
+        std::vector<std::shared_ptr<Image>> offscreenImages_;  ///< Offscreen color targets (headless mode only)
+        uint32_t nextHeadlessImage_ = 0;                ///< Round-robin acquire cursor (headless mode only)
+
+        // ============================================================================
+        // Retired Swapchain Resources
+        // ============================================================================
+
+        /** @brief Resources from a replaced swapchain, alive until destroyRetired(). */
+        struct RetiredSwapchain {
+            VkSwapchainKHR swapchain = VK_NULL_HANDLE;  ///< Old handle (was passed as oldSwapchain)
+            std::vector<VkImageView> imageViews;        ///< Views into the old images
+            std::shared_ptr<Image> depthImage;          ///< Old depth buffer (keeps its view alive)
+        };
+
+        std::vector<RetiredSwapchain> retired_;         ///< Pending destruction after presents drain
+
         // ============================================================================
         // Depth Buffer Resources
         // ============================================================================
@@ -82,6 +82,15 @@ namespace vkeng {
          */
         virtual void createSurface(void* instance, void* surface) = 0;
         
+        /**
+         * @brief Requests that the window close, ending the engine main loop
+         *
+         * Used by frame-limited runs (headless benchmarks, stress harnesses)
+         * to stop the engine programmatically; equivalent to the user
+         * pressing the close button.
+         */
+        virtual void requestClose() = 0;
+
         /**
          * @brief Callback type for window resize events
          * @param width New framebuffer width
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "vulkan-engine/core/Engine.hpp"
+#include "vulkan-engine/rendering/Pipeline.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/rendering/Renderer.hpp"
+#include "vulkan-engine/rendering/ShadowPass.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+#include "vulkan-engine/rendering/Camera.hpp"
+#include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/resources/Material.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @struct BenchmarkOptions
+     * @brief Parameters controlling the procedural benchmark scene and run
+     *
+     * The generator is deterministic: the same options always produce the
+     * same scene and camera path, so numbers from two builds are comparable.
+     */
+    struct BenchmarkOptions {
+        uint32_t nodeCount = 2000;      ///< Number of mesh nodes to scatter
+        uint32_t meshDensity = 1;       ///< Primitive tessellation multiplier (1 = base)
+        uint32_t lightCount = 8;        ///< Point/spot lights scattered through the scene
+        uint32_t materialCount = 16;    ///< Distinct materials cycled across nodes
+        uint32_t frameCount = 1000;     ///< Frames to render before exiting
+        uint32_t seed = 1337;           ///< PRNG seed for node placement
+        float staticFraction = 0.8f;    ///< Fraction of nodes flagged static (shadow cache)
+        std::string csvPath;            ///< Per-frame subsystem times (empty = skip)
+        std::string jsonPath;           ///< Summary stats JSON (empty = skip)
+    };
+
+    /**
+     * @class BenchmarkApp
+     * @brief Reproducible performance benchmark over a procedural scene
+     *
+     * Builds a parameterized scene from PrimitiveFactory meshes (scattered
+     * over a ground plane with varied materials and lights), flies a scripted
+     * orbit camera path, and records per-subsystem CPU times each frame
+     * (scene update, renderer drawFrame). On exit it prints mean/p95/p99 per
+     * series and optionally writes the raw per-frame data to CSV and the
+     * summary to JSON for CI tracking. Typically run with Config::Headless
+     * enabled so no display is required.
+     */
+    class BenchmarkApp : public Engine {
+    public:
+        BenchmarkApp(const Config& config, const BenchmarkOptions& options);
+        ~BenchmarkApp() override;
+
+    protected:
+        void onInit() override;
+        void onUpdate(float deltaTime) override;
+        void onRender() override;
+        void onShutdown() override;
+
+    private:
+        void initRenderingPipeline();
+        void initScene();
+        void recreateResources(uint32_t width, uint32_t height);
+        void updateCameraPath(float deltaTime);
+        void reportResults();
+
+        BenchmarkOptions options_;                                  ///< Generator and run parameters
+
+        // ============================================================================
+        // Rendering Resources (mirrors the structure of HelloTriangleApp)
+        // ============================================================================
+
+        PerFrameUniformBuffer globalUbo_{};                         ///< Per-frame regions, one mapped buffer
+        std::shared_ptr<SceneNode> rootNode_{};                     ///< Root node of scene graph
+        VkDescriptorSetLayout descriptorSetLayout_{};               ///< Layout for shader resources
+        VkDescriptorPool descriptorPool_{};                         ///< Pool for descriptor allocation
+        std::vector<VkDescriptorSet> descriptorSets_{};             ///< Per-frame descriptor sets
+        std::shared_ptr<DescriptorSetLayout> textureSetLayout_{};   ///< Per-material texture descriptors (set 1)
+        std::shared_ptr<DescriptorPool> materialDescriptorPool_{};  ///< Persistent pool for material descriptor sets
+        VkDescriptorSet fallbackTextureDescriptorSet_{};            ///< Descriptor set using the white fallback texture
+        std::vector<std::shared_ptr<Material>> materials_{};        ///< Generated material variety
+
+        std::shared_ptr<RenderPass>         renderPass_{};          ///< Render pass definition
+        std::unique_ptr<PipelineManager>    pipelineManager_{};     ///< Pipeline variant cache + layout
+        PipelineConfig                      defaultPipelineConfig_{}; ///< Default opaque pipeline config
+
+        // Shadow mapping
+        std::unique_ptr<ShadowPass>         shadowPass_{};
+        std::shared_ptr<DescriptorSetLayout> shadowSetLayout_{};    ///< Layout for shadow map descriptor (set 2)
+        VkDescriptorSet                     shadowDescriptorSet_{}; ///< Shadow map descriptor set
+        PipelineConfig                      shadowPipelineConfig_{}; ///< Depth-only shadow pipeline config
+
+        std::unique_ptr<Renderer> renderer_{};                      ///< Main renderer instance
+        std::unique_ptr<PerspectiveCamera> camera_{};               ///< Scripted benchmark camera
+
+        // ============================================================================
+        // Measurement State
+        // ============================================================================
+
+        float pathTime_ = 0.0f;                                     ///< Elapsed time along the camera path
+        uint32_t frameIndex_ = 0;                                   ///< Rendered frame counter
+        double lastUpdateMs_ = 0.0;                                 ///< Scene update time of the current frame
+        std::vector<double> updateTimesMs_{};                       ///< Per-frame scene update times
+        std::vector<double> renderTimesMs_{};                       ///< Per-frame drawFrame times
+    };
+
+} // namespace vkeng
@@ -14,10 +14,31 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace vkeng {
 
+    /**
+     * @struct StressOptions
+     * @brief Parameters for the draw-call stress mode of HelloTriangleApp
+     *
+     * With gridSize > 0 the app replaces its demo scene with an N×N×N grid
+     * of cubes and records per-frame drawFrame CPU times, turning the smoke
+     * test into a harness for measuring the renderer's draw-call ceiling.
+     * The per-draw data path (push constants vs. the storage-buffer indirect
+     * backend) is selected through Config::Render as usual, so a stress run
+     * exercises exactly the code path a real scene would.
+     */
+    struct StressOptions {
+        uint32_t gridSize = 0;          ///< Cubes per axis of the stress grid (0 = normal demo scene)
+        uint32_t materialCount = 8;     ///< Distinct materials cycled across the grid
+        bool instanced = false;         ///< Fold repeated draws into instanced batches
+        bool sorted = true;             ///< Keep the renderer's per-frame draw sort
+        uint32_t frameLimit = 0;        ///< Close after N frames (0 = run until closed)
+        std::string csvPath;            ///< Per-frame drawFrame CPU times (empty = skip)
+    };
+
     /**
      * @class HelloTriangleApp
      * @brief Main application class demonstrating Vulkan rendering pipeline
@@ -25,6 +46,7 @@ namespace vkeng {
     class HelloTriangleApp : public Engine {
     public:
         HelloTriangleApp(const Config& config);
+        HelloTriangleApp(const Config& config, const StressOptions& stress);
         ~HelloTriangleApp() override;
 
     protected:
@@ -36,14 +58,16 @@ namespace vkeng {
     private:
         void initRenderingPipeline();
         void initScene();
+        void initStressScene();
         void recreateResources(uint32_t width, uint32_t height);
+        void reportStressResults();
 
         // ============================================================================
         // Rendering Resources (App Specific)
         // ============================================================================
         
         std::shared_ptr<Mesh> mesh_{};                              ///< Demo triangle mesh
-        std::vector<std::shared_ptr<Buffer>> uniformBuffers_{};     ///< Per-frame uniform buffers
+        PerFrameUniformBuffer globalUbo_{};                         ///< Per-frame regions, one mapped buffer
         std::shared_ptr<SceneNode> rootNode_{};                     ///< Root node of scene graph
         VkDescriptorSetLayout descriptorSetLayout_{};              ///< Layout for shader resources
         VkDescriptorPool descriptorPool_{};                        ///< Pool for descriptor allocation
@@ -82,6 +106,14 @@ namespace vkeng {
         
         uint32_t frameCount_ = 0;                                   ///< Frame counter for debug output
         static constexpr uint32_t DEBUG_FRAME_INTERVAL = 60;       ///< Frames between debug prints
+
+        // ============================================================================
+        // Draw-Call Stress Mode
+        // ============================================================================
+
+        StressOptions stress_{};                                    ///< Stress harness parameters (gridSize 0 = off)
+        std::vector<std::shared_ptr<Material>> stressMaterials_{};  ///< Materials cycled across the stress grid
+        std::vector<double> drawTimesMs_{};                         ///< Per-frame drawFrame CPU times (stress mode)
     };
 
 } // namespace vkeng
\ No newline at end of file
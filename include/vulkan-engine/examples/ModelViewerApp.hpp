@@ -2,6 +2,7 @@
 
 #include "vulkan-engine/core/Buffer.hpp"
 #include "vulkan-engine/core/Engine.hpp"
+#include "vulkan-engine/core/RenderThread.hpp"
 #include "vulkan-engine/rendering/OrbitCameraController.hpp"
 #include "vulkan-engine/rendering/Pipeline.hpp"
 #include "vulkan-engine/rendering/PipelineManager.hpp"
@@ -10,10 +11,13 @@
 #include "vulkan-engine/rendering/DescriptorSet.hpp"
 #include "vulkan-engine/rendering/Uniforms.hpp"
 #include "vulkan-engine/resources/Material.hpp"
+#include "vulkan-engine/resources/ResourceManager.hpp"
 #include "vulkan-engine/scene/SceneNode.hpp"
 
 #include <filesystem>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace vkeng {
@@ -41,7 +45,22 @@ private:
     void initScene();
     void recreateResources(uint32_t width, uint32_t height);
     std::filesystem::path resolveModelPath() const;
+    std::filesystem::path resolveModelFile(const std::string& configured) const;
     void loadModelMesh();
+
+    // --- Playlist prefetch cache ---
+    void buildPlaylist();
+    /** @brief Kicks an async load of the next playlist entry if it is not cached. */
+    void startNextPrefetch();
+    /** @brief Publishes a finished prefetch into the cache (and swaps if a switch waits on it). */
+    void pumpPrefetch();
+    /** @brief Advances the playlist; cached models swap in the same frame. */
+    void switchToNextModel();
+    /** @brief Pointer-swaps the displayed mesh and starts the fade-in. */
+    void adoptModel(const std::filesystem::path& path, const std::shared_ptr<Mesh>& mesh);
+    void insertCachedModel(const std::string& key, const std::shared_ptr<Mesh>& mesh);
+    /** @brief Evicts least-recently-shown cached models above the VRAM budget. */
+    void evictOverBudget();
     void layoutComparisonScene();
     void configureCameraForScene(const glm::vec3& sceneCenter, float sceneRadius);
     void setDebugShadingMode(DebugShadingMode mode);
@@ -50,10 +69,26 @@ private:
 
     std::shared_ptr<Mesh> loadedMesh_{};
     std::shared_ptr<Mesh> referenceMesh_{};
+
+    /// One warm model: the mesh keeps its GPU buffers alive, so switching
+    /// to it is a pointer swap instead of a disk load
+    struct CachedModel {
+        std::shared_ptr<Mesh> mesh;
+        uint64_t gpuBytes = 0;
+        uint64_t lastShownFrame = 0;
+    };
+    std::vector<std::filesystem::path> playlist_{};           ///< Exhibit rotation (resolved paths)
+    size_t playlistIndex_ = 0;                                ///< Currently displayed playlist entry
+    std::unordered_map<std::string, CachedModel> modelCache_{}; ///< Warm models keyed by resolved path
+    uint64_t modelCacheBytes_ = 0;                            ///< GPU bytes held by the cache
+    ResourceHandle<Mesh> pendingPrefetch_{};                  ///< In-flight async load (invalid when idle)
+    std::string pendingPrefetchPath_{};                       ///< Path the in-flight load resolves to
+    bool switchPending_ = false;                              ///< Swap as soon as the pending prefetch lands
+    float modelFadeIn_ = 1.0f;                                ///< Scale-in progress after a swap (1 = settled)
     std::shared_ptr<Material> defaultMaterial_{};
     std::shared_ptr<Material> referenceMaterial_{};
     std::filesystem::path loadedModelPath_{};
-    std::vector<std::shared_ptr<Buffer>> uniformBuffers_{};
+    PerFrameUniformBuffer globalUbo_{};
     std::shared_ptr<SceneNode> rootNode_{};
     std::shared_ptr<SceneNode> modelNode_{};
     std::shared_ptr<SceneNode> referenceNode_{};
@@ -76,6 +111,7 @@ private:
 
     std::unique_ptr<MeshLoader> meshLoader_{};
     std::unique_ptr<Renderer> renderer_{};
+    std::unique_ptr<RenderThread> renderThread_{};  ///< Optional (config_.render.renderThread)
     std::shared_ptr<OrbitCameraController> orbitController_{};
     std::unique_ptr<PerspectiveCamera> camera_{};
     DebugShadingMode debugShadingMode_ = DebugShadingMode::Lit;
@@ -0,0 +1,108 @@
+/**
+ * @file Broadphase.hpp
+ * @brief Uniform-grid broadphase for collision pair generation
+ *
+ * The broadphase prunes the O(n²) pairwise collider test down to pairs
+ * whose bounding volumes share a grid cell. Proxies carry fattened AABBs
+ * so bodies that move a little between steps stay in their cells and cost
+ * nothing to maintain.
+ *
+ * Key Broadphase Concepts:
+ * - Uniform Grid: World space is hashed into fixed-size cells
+ * - Fat AABB: Proxy bounds are inflated by a margin; reinsertion only
+ *   happens when the tight bounds escape the fat bounds
+ * - Candidate Pairs: Output is potentially-overlapping pairs only;
+ *   the narrowphase does the exact shape tests
+ */
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vkeng {
+
+    class SceneNode;
+
+    /**
+     * @class Broadphase
+     * @brief Incrementally maintained uniform grid over collider AABBs
+     *
+     * Usage per fixed step:
+     * @code
+     *   for (each body) broadphase.update(node, tightMin, tightMax);
+     *   broadphase.computePairs(pairs);
+     * @endcode
+     *
+     * update() is cheap for resting or slowly moving bodies: as long as the
+     * tight AABB stays inside the proxy's fat AABB the grid is untouched.
+     * remove() must be called when a body leaves the simulation.
+     *
+     * @note Cell size should roughly match typical collider diameter; far
+     *       smaller wastes cells per proxy, far larger degenerates toward
+     *       all-pairs within one cell.
+     */
+    class Broadphase {
+    public:
+        /**
+         * @brief Construct the grid
+         * @param cellSize World-space edge length of one cell
+         * @param fatMargin Padding added to proxy bounds on (re)insertion
+         */
+        explicit Broadphase(float cellSize = 4.0f, float fatMargin = 0.2f);
+
+        /**
+         * @brief Insert a new proxy or refresh an existing one
+         * @param node The body's scene node (identity key)
+         * @param tightMin World-space AABB minimum this step
+         * @param tightMax World-space AABB maximum this step
+         *
+         * Reinserts into the grid only when the tight bounds escape the
+         * stored fat bounds.
+         */
+        void update(SceneNode* node, const glm::vec3& tightMin, const glm::vec3& tightMax);
+
+        /** @brief Remove a proxy and vacate its grid cells. */
+        void remove(SceneNode* node);
+
+        /** @brief Remove all proxies. */
+        void clear();
+
+        /**
+         * @brief Collect candidate pairs whose tight AABBs overlap
+         * @param outPairs Receives each unique pair exactly once
+         */
+        void computePairs(std::vector<std::pair<SceneNode*, SceneNode*>>& outPairs) const;
+
+        /** @brief Number of proxies currently tracked. */
+        size_t getProxyCount() const { return m_proxies.size(); }
+
+        /** @brief Number of occupied grid cells (diagnostics). */
+        size_t getCellCount() const { return m_grid.size(); }
+
+    private:
+        /** @brief Per-body grid residency and bounds. */
+        struct Proxy {
+            glm::vec3 tightMin{0.0f};
+            glm::vec3 tightMax{0.0f};
+            glm::vec3 fatMin{0.0f};
+            glm::vec3 fatMax{0.0f};
+            std::vector<uint64_t> cells; ///< Keys of occupied cells
+        };
+
+        /** @brief Pack signed cell coordinates into one hashable key. */
+        static uint64_t cellKey(int32_t x, int32_t y, int32_t z);
+
+        void insertIntoGrid(SceneNode* node, Proxy& proxy);
+        void removeFromGrid(SceneNode* node, Proxy& proxy);
+
+        float m_cellSize;
+        float m_fatMargin;
+
+        std::unordered_map<SceneNode*, Proxy> m_proxies;
+        std::unordered_map<uint64_t, std::vector<SceneNode*>> m_grid;
+    };
+
+} // namespace vkeng
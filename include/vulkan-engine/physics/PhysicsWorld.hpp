@@ -19,9 +19,14 @@
 #pragma once
 
 #include "vulkan-engine/scene/SceneNode.hpp"
+#include "vulkan-engine/physics/Broadphase.hpp"
+#include "vulkan-engine/core/EventSystem.hpp"
 
 #include <glm/glm.hpp>
+#include <atomic>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace vkeng {
@@ -50,13 +55,40 @@ namespace vkeng {
      * @class PhysicsWorld
      * @brief Manages physics simulation for the scene
      *
-     * Create one PhysicsWorld and feed it the scene root. It walks the scene
-     * graph each step to find nodes with RigidBody + Collider components.
+     * Create one PhysicsWorld and feed it the scene root. Bodies register
+     * themselves through RigidBodyAttached/DetachedEvents when their
+     * component attaches, so steps never re-walk the scene graph; a one-time
+     * scan on the first step picks up bodies created before the world.
+     * Collision detection runs a uniform-grid broadphase (see Broadphase)
+     * followed by exact shape tests producing contacts.
+     *
+     * With parallel mode enabled (the default), large body counts integrate
+     * as a parallel-for and contacts are partitioned into independent
+     * islands — connected groups of touching bodies — solved on worker
+     * threads. Bodies in different islands share no contacts, so island
+     * solves never race. All Transform writes and event publishes happen in
+     * one serial batch at the end of the step, keeping the scene graph and
+     * EventSystem single-threaded.
+     *
+     * Dynamic bodies that stay below a velocity threshold long enough are
+     * put to sleep: they skip integration, broadphase refresh, and the
+     * narrowphase until a contact from an awake body, a force, or an impulse
+     * wakes them. Wake-ups propagate through the island graph, so a
+     * disturbance travels through a settled stack one contact layer per
+     * step. A fully settled scene costs near-zero physics CPU.
+     *
+     * Each step snapshots every dynamic body's previous and current
+     * position; applyRenderInterpolation() blends between them using the
+     * accumulator fraction so the fixed rate can sit well below the render
+     * rate (e.g. 30Hz physics under 120Hz rendering) without visible
+     * stepping.
      */
     class PhysicsWorld {
     public:
         PhysicsWorld();
-        ~PhysicsWorld() = default;
+
+        /** @brief Unsubscribes from body registry events. */
+        ~PhysicsWorld();
 
         // Non-copyable
         PhysicsWorld(const PhysicsWorld&) = delete;
@@ -72,6 +104,19 @@ namespace vkeng {
          */
         void step(float dt, SceneNode* sceneRoot);
 
+        /**
+         * @brief Write interpolated render poses into body Transforms.
+         * @param alpha Accumulator fraction from Time::fixedStepAlpha(), [0, 1].
+         *
+         * Blends each dynamic body's Transform between its previous and
+         * current fixed-step positions so rendering stays smooth when the
+         * render rate exceeds the fixed rate. Call once per frame, after the
+         * consumeFixedStep() loop and before rendering. step() restores the
+         * true (un-blended) poses before simulating, so interpolation never
+         * feeds back into the physics.
+         */
+        void applyRenderInterpolation(float alpha);
+
         // ============================================================================
         // World settings
         // ============================================================================
@@ -88,24 +133,148 @@ namespace vkeng {
         /** @brief Check if the physics simulation is enabled. */
         bool isEnabled() const { return m_enabled; }
 
+        /** @brief Enable or disable worker-thread integration and island solving. */
+        void setParallelEnabled(bool enabled) { m_parallelEnabled = enabled; }
+
+        /** @brief Check if parallel simulation is enabled. */
+        bool isParallelEnabled() const { return m_parallelEnabled; }
+
+        /** @brief Enable or disable fixed-step render interpolation (default: on). */
+        void setInterpolationEnabled(bool enabled) { m_interpolationEnabled = enabled; }
+
+        /** @brief Check if fixed-step render interpolation is enabled. */
+        bool isInterpolationEnabled() const { return m_interpolationEnabled; }
+
+        /** @brief Enable or disable automatic body sleeping (default: on). */
+        void setSleepingEnabled(bool enabled) { m_sleepingEnabled = enabled; }
+
+        /** @brief Check if automatic body sleeping is enabled. */
+        bool isSleepingEnabled() const { return m_sleepingEnabled; }
+
+        /** @brief Number of bodies currently registered. */
+        size_t getBodyCount() const { return m_bodies.size(); }
+
+        /** @brief Candidate pairs produced by the last broadphase (diagnostics). */
+        size_t getCandidatePairCount() const { return m_candidatePairs.size(); }
+
+        /** @brief Contacts found by the last narrowphase (diagnostics). */
+        size_t getContactCount() const { return m_contacts.size(); }
+
+        /** @brief Islands solved last step (diagnostics). */
+        size_t getIslandCount() const { return m_islands.size(); }
+
+        /** @brief Dynamic bodies integrated last step (diagnostics). */
+        size_t getActiveBodyCount() const { return m_activeBodyCount.load(std::memory_order_relaxed); }
+
+        /** @brief Dynamic bodies skipped asleep last step (diagnostics). */
+        size_t getSleepingBodyCount() const { return m_sleepingBodyCount.load(std::memory_order_relaxed); }
+
     private:
-        /** @brief Collect all nodes that have a RigidBody component. */
-        void collectBodies(SceneNode* node);
+        /** @brief One-time scan (via the query index) for bodies created before this world existed. */
+        void collectBodies();
+
+        /** @brief Add a body to the persistent registry (idempotent). */
+        void registerBody(SceneNode* node);
+
+        /** @brief Remove a body from the registry and broadphase. */
+        void unregisterBody(SceneNode* node);
+
+        /**
+         * @brief A narrowphase contact between two solid colliders
+         *
+         * Normal points from nodeA toward nodeB. The accumulated normal
+         * impulse persists across steps through the manifold cache and
+         * warm-starts the solver; the restitution bias is transient,
+         * recomputed each step from pre-solve velocities.
+         */
+        struct Contact {
+            SceneNode* nodeA = nullptr;
+            SceneNode* nodeB = nullptr;
+            glm::vec3 point{0.0f};
+            glm::vec3 normal{0.0f};
+            float depth = 0.0f;
+            float accumulatedImpulse = 0.0f;
+            float restitutionBias = 0.0f;
+        };
+
+        /** @brief Restore true poses and snapshot them as "previous" step state. */
+        void beginStepStates();
+
+        /** @brief Snapshot post-resolution poses as "current" step state. */
+        void captureStepStates();
 
         /** @brief Apply gravity and external forces, integrate velocities. */
         void integrate(float dt);
 
-        /** @brief Broadphase + narrowphase collision detection. */
+        /** @brief Per-body integration work, safe to run on any thread. */
+        void integrateRange(float dt, size_t begin, size_t end);
+
+        /** @brief Refresh broadphase proxies, gather pairs, run narrowphase. */
         void detectCollisions();
 
-        /** @brief Resolve detected collisions with impulse response. */
+        /** @brief Exact shape test for one candidate pair. */
+        bool testPair(SceneNode* a, SceneNode* b, Contact& outContact) const;
+
+        /** @brief Partition contacts into independent islands and solve them. */
         void resolveCollisions();
 
+        /**
+         * @brief Impulse-solve one island's contacts
+         * @param contactIndices Indices into m_contacts forming the island
+         * @param outCorrections Receives per-node position corrections
+         *
+         * Only touches RigidBody velocities and contact accumulators of
+         * bodies inside the island, so islands can be solved concurrently.
+         * Transform writes are deferred to the serial batch via
+         * @p outCorrections. Contacts are warm-started with last step's
+         * accumulated impulse, so few iterations converge on stable stacks.
+         */
+        void solveIsland(const std::vector<uint32_t>& contactIndices,
+                         std::vector<std::pair<SceneNode*, glm::vec3>>& outCorrections);
+
+        /**
+         * @brief Compute a body's world-space AABB from its Collider
+         * @return False if the node has no collider
+         */
+        bool computeWorldAABB(SceneNode* node, glm::vec3& outMin, glm::vec3& outMax) const;
+
         glm::vec3 m_gravity{0.0f, -9.81f, 0.0f};
         bool m_enabled = true;
+        bool m_parallelEnabled = true;
+        bool m_interpolationEnabled = true;
+        bool m_sleepingEnabled = true;
+
+        /** @brief Last-step body counts; atomic because integration ranges run on workers. */
+        std::atomic<uint32_t> m_activeBodyCount{0};
+        std::atomic<uint32_t> m_sleepingBodyCount{0};
 
-        /** @brief Scratch list rebuilt each step. */
+        /** @brief Persistent registry, maintained by RigidBody attach/detach events. */
         std::vector<SceneNode*> m_bodies;
+        bool m_initialScanDone = false;
+
+        Broadphase m_broadphase;
+
+        /** @brief Potentially overlapping pairs from the last broadphase pass. */
+        std::vector<std::pair<SceneNode*, SceneNode*>> m_candidatePairs;
+
+        /** @brief Narrowphase contacts for this step. */
+        std::vector<Contact> m_contacts;
+
+        /** @brief Accumulated normal impulses keyed by node pair, carried across steps. */
+        std::unordered_map<uint64_t, float> m_cachedImpulses;
+
+        /** @brief Contact indices grouped into independent islands. */
+        std::vector<std::vector<uint32_t>> m_islands;
+
+        /** @brief New positions computed by parallel integration, applied serially. */
+        std::vector<std::pair<SceneNode*, glm::vec3>> m_integrationScratch;
+
+        /** @brief Overlapping trigger pairs (trigger, other), for enter/exit edges. */
+        std::unordered_map<uint64_t, std::pair<SceneNode*, SceneNode*>> m_activeTriggerPairs;
+        std::vector<TriggerEvent> m_pendingTriggerEvents;
+
+        EventListenerId m_attachListener = 0;
+        EventListenerId m_detachListener = 0;
     };
 
 } // namespace vkeng
@@ -13,6 +13,22 @@
 
 namespace vkeng {
 
+    class SceneNode;
+
+    // ============================================================================
+    // Registry events (published via EventSystem)
+    // ============================================================================
+
+    /** @brief Fired when a RigidBody component attaches to a node. */
+    struct RigidBodyAttachedEvent {
+        SceneNode* node = nullptr;
+    };
+
+    /** @brief Fired when a RigidBody component is destroyed. */
+    struct RigidBodyDetachedEvent {
+        SceneNode* node = nullptr;
+    };
+
     /** @brief Controls how the physics system treats this body. */
     enum class BodyType {
         Static,     ///< Immovable (floors, walls). Zero mass, ignored by integrator.
@@ -33,6 +49,12 @@ namespace vkeng {
         explicit RigidBody(BodyType type = BodyType::Dynamic, float mass = 1.0f);
         ~RigidBody() override = default;
 
+        /** @brief Publishes RigidBodyAttachedEvent so PhysicsWorld registers the body. */
+        void initialize(SceneNode* owner) override;
+
+        /** @brief Publishes RigidBodyDetachedEvent so PhysicsWorld unregisters the body. */
+        void destroy() override;
+
         void update(float deltaTime) override;
 
         // ============================================================================
@@ -84,6 +106,59 @@ namespace vkeng {
         bool useGravity() const { return m_useGravity; }
         void setUseGravity(bool use) { m_useGravity = use; }
 
+        // ============================================================================
+        // Sleeping
+        // ============================================================================
+
+        /**
+         * @brief Whether the body is asleep (skipped by integration).
+         *
+         * PhysicsWorld puts a Dynamic body to sleep once its velocity stays
+         * below threshold for enough consecutive steps, and wakes it when a
+         * contact from an awake body, a force, or an impulse reaches it.
+         */
+        bool isSleeping() const { return m_sleeping; }
+
+        /** @brief Wake the body and restart its low-motion countdown. */
+        void wake() {
+            m_sleeping = false;
+            m_lowMotionSteps = 0;
+        }
+
+        /** @brief Put the body to sleep, zeroing velocity and pending forces. */
+        void sleep();
+
+        /** @brief Consecutive low-velocity steps (counter owned by PhysicsWorld). */
+        uint32_t getLowMotionSteps() const { return m_lowMotionSteps; }
+        void setLowMotionSteps(uint32_t steps) { m_lowMotionSteps = steps; }
+
+        // ============================================================================
+        // Fixed-step interpolation state (owned by PhysicsWorld)
+        // ============================================================================
+
+        /**
+         * @brief Whether previous/current fixed-step poses have been captured.
+         *
+         * False until the body's first completed physics step; interpolation
+         * skips bodies without state instead of blending from garbage.
+         */
+        bool hasStepStates() const { return m_hasStepStates; }
+
+        /** @brief World position at the start of the last completed fixed step. */
+        const glm::vec3& getPreviousStepPosition() const { return m_previousStepPosition; }
+
+        /** @brief World position at the end of the last completed fixed step. */
+        const glm::vec3& getCurrentStepPosition() const { return m_currentStepPosition; }
+
+        /** @brief Record the pre-integration pose (called by PhysicsWorld at step start). */
+        void setPreviousStepPosition(const glm::vec3& position) { m_previousStepPosition = position; }
+
+        /** @brief Record the post-resolution pose (called by PhysicsWorld at step end). */
+        void setCurrentStepPosition(const glm::vec3& position) {
+            m_currentStepPosition = position;
+            m_hasStepStates = true;
+        }
+
     private:
         BodyType m_bodyType;
         float m_mass;
@@ -93,6 +168,13 @@ namespace vkeng {
 
         float m_linearDamping = 0.01f;
         bool m_useGravity = true;
+
+        bool m_sleeping = false;
+        uint32_t m_lowMotionSteps = 0;
+
+        glm::vec3 m_previousStepPosition{0.0f};
+        glm::vec3 m_currentStepPosition{0.0f};
+        bool m_hasStepStates = false;
     };
 
 } // namespace vkeng
@@ -0,0 +1,205 @@
+/**
+ * @file AnimationSystem.hpp
+ * @brief Skeletal pose evaluation and GPU-skinned drawing
+ *
+ * Character skinning designed around the engine's existing fast paths
+ * rather than the scene graph: bones never become SceneNodes. Poses
+ * evaluate from flat SoA clip samples through the SIMD batch kernels
+ * (simd::composeTrsBatch, simd::multiply) fanned across the job system,
+ * the resulting joint palettes upload into one per-frame storage buffer,
+ * and the vertex shader blends four joint matrices per vertex — the CPU
+ * never touches a vertex.
+ *
+ * Key Skinning Concepts:
+ * - Job-System Evaluation: instances are independent, so update() runs
+ *   one parallelFor over them; each instance samples its clip, composes
+ *   local matrices in one SIMD batch, and walks the parents-first joint
+ *   array linearly
+ * - Shared Palette Buffer: every instance owns a fixed slice of one
+ *   per-frame SSBO (offset pushed per draw), so all characters bind the
+ *   same descriptor set
+ * - Dedicated Pipeline: a PipelineConfig with skinned = true adds the
+ *   SkinVertex joint/weight stream on binding 1; the mesh's regular
+ *   vertex stream and index buffer are untouched
+ * - Own Layout & Ordering: like the meshlet path, the skinned layout is
+ *   incompatible with the shared graphics layout, so skinned draws record
+ *   before the classic set bindings in the main pass
+ */
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/resources/AnimationClip.hpp"
+#include "vulkan-engine/resources/Mesh.hpp"
+#include "vulkan-engine/resources/Skeleton.hpp"
+
+#include <glm/glm.hpp>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class AnimationSystem
+     * @brief Owns animated instances, their palettes, and the skinned pipeline.
+     *
+     * Usage (app steps the animation, the Renderer records GPU work):
+     * @code
+     *   renderer.enableSkinning(memoryManager, shaderDir);
+     *   auto* anim = renderer.getAnimationSystem();
+     *   uint32_t id = anim->addInstance(mesh, skinStream, skeleton, clip);
+     *   anim->setModelMatrix(id, transform);
+     *   // per frame, before drawFrame():
+     *   anim->update(deltaTime);
+     * @endcode
+     */
+    class AnimationSystem {
+    public:
+        /// Total joint matrices across all instances per frame buffer
+        static constexpr uint32_t kMaxPaletteJoints = 4096;
+
+        /**
+         * @brief Construct the skinned pipeline layout and per-frame buffers.
+         * @param device Vulkan device wrapper
+         * @param memoryManager Memory manager for palette and skin buffers
+         * @param pipelineManager Pipeline cache shared with the classic path
+         * @param framesInFlight Number of frames in flight (per-frame palettes)
+         * @param shaderDir Directory with the compiled skinned_*.spv shaders
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        AnimationSystem(VulkanDevice& device,
+                        std::shared_ptr<MemoryManager> memoryManager,
+                        PipelineManager& pipelineManager,
+                        uint32_t framesInFlight,
+                        const std::filesystem::path& shaderDir);
+
+        ~AnimationSystem();
+
+        AnimationSystem(const AnimationSystem&) = delete;
+        AnimationSystem& operator=(const AnimationSystem&) = delete;
+
+        /**
+         * @brief Register an animated instance.
+         * @param mesh Geometry to skin (regular vertex/index buffers)
+         * @param skinStream One SkinVertex per mesh vertex (joints/weights)
+         * @param skeleton Joint hierarchy the clip and weights target
+         * @param clip Animation to play (jointCount must match the skeleton)
+         * @return Instance id, or kInvalidInstance on mismatch or a full palette
+         *
+         * Uploads the skin stream to its own vertex buffer and reserves the
+         * skeleton's slice of the palette. Instances start playing at time
+         * zero, looping, at unit speed.
+         */
+        uint32_t addInstance(std::shared_ptr<Mesh> mesh,
+                             const std::vector<SkinVertex>& skinStream,
+                             std::shared_ptr<Skeleton> skeleton,
+                             std::shared_ptr<AnimationClip> clip);
+        static constexpr uint32_t kInvalidInstance = ~0u;
+
+        /** @brief Remove an instance (its palette slice is not reclaimed). */
+        void removeInstance(uint32_t id);
+
+        /** @brief Set the instance's object-to-world matrix for this frame. */
+        void setModelMatrix(uint32_t id, const glm::mat4& model);
+
+        /** @brief Set playback speed (1 = authored rate) and looping. */
+        void setPlayback(uint32_t id, float speed, bool looping);
+
+        /**
+         * @brief Advance playback and evaluate every pose.
+         * @param deltaTime Seconds since the last update
+         *
+         * Fans instances across the job system; each job samples the clip
+         * into SoA scratch, composes local joint matrices in one SIMD
+         * batch, resolves globals in a forward pass, and writes
+         * global * inverseBind into the instance's palette scratch.
+         */
+        void update(float deltaTime);
+
+        /**
+         * @brief Upload the evaluated palettes and camera state for a frame.
+         * @param frameIndex Frame-in-flight index
+         * @param viewProj Combined view-projection matrix
+         * @param cameraPos Camera position (world space)
+         */
+        void prepare(uint32_t frameIndex, const glm::mat4& viewProj,
+                     const glm::vec3& cameraPos);
+
+        /**
+         * @brief Record the skinned draws inside the main render pass.
+         *
+         * Binds the skinned pipeline (lazily rebuilt when the render pass
+         * changed) and issues one indexed draw per instance. Record before
+         * the classic descriptor bindings: this layout invalidates them.
+         */
+        void recordDraws(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                         VkExtent2D extent, uint32_t frameIndex);
+
+        /** @brief Number of registered instances (for stats/debug). */
+        uint32_t instanceCount() const { return m_activeInstances; }
+
+    private:
+        /** @brief Camera block read by skinned.vert/.frag (set 0, binding 0). */
+        struct FrameUbo {
+            glm::mat4 viewProj;
+            glm::vec4 cameraPos;
+        };
+
+        /** @brief Push block for skinned.vert. */
+        struct SkinnedPush {
+            glm::mat4 model;
+            uint32_t paletteOffset = 0; ///< First joint matrix in the palette SSBO
+            uint32_t pad0 = 0, pad1 = 0, pad2 = 0;
+        };
+
+        /** @brief One animated character: playback state + evaluation scratch. */
+        struct Instance {
+            std::shared_ptr<Mesh> mesh;
+            std::shared_ptr<Buffer> skinBuffer; ///< SkinVertex stream (binding 1)
+            std::shared_ptr<Skeleton> skeleton;
+            std::shared_ptr<AnimationClip> clip;
+            glm::mat4 model{1.0f};
+            uint32_t paletteOffset = 0;
+            float time = 0.0f;
+            float speed = 1.0f;
+            bool looping = true;
+            bool alive = true;                  ///< False after removeInstance()
+
+            // Per-instance evaluation scratch so job workers never share
+            // state: sampled SoA pose, composed locals, resolved palette
+            std::vector<float> px, py, pz, qx, qy, qz, qw, sx, sy, sz;
+            std::vector<glm::mat4> locals;
+            std::vector<glm::mat4> palette;     ///< globalPose * inverseBind per joint
+        };
+
+        void ensurePipeline(VkRenderPass renderPass, VkExtent2D extent);
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+
+        std::shared_ptr<DescriptorSetLayout> m_setLayout; ///< binding 0 = UBO, 1 = palette SSBO
+        std::shared_ptr<DescriptorPool> m_descriptorPool;
+        VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+
+        PipelineConfig m_drawConfig;            ///< skinned = true graphics variant
+        std::shared_ptr<Pipeline> m_pipeline;   ///< Rebuilt when the render pass changes
+        VkRenderPass m_builtRenderPass = VK_NULL_HANDLE;
+
+        struct FrameResources {
+            std::shared_ptr<Buffer> ubo;
+            std::shared_ptr<Buffer> palettes;   ///< kMaxPaletteJoints mat4s, host-visible
+            VkDescriptorSet set = VK_NULL_HANDLE;
+        };
+        std::vector<FrameResources> m_frames;   ///< One entry per frame in flight
+
+        std::vector<std::unique_ptr<Instance>> m_instances;
+        uint32_t m_activeInstances = 0;
+        uint32_t m_paletteCursor = 0;           ///< Next free joint slot in the palette
+    };
+
+} // namespace vkeng
@@ -0,0 +1,102 @@
+/**
+ * @file BindlessTextures.hpp
+ * @brief One variable-count texture array bound once per frame
+ *
+ * The classic path gives every material its own descriptor set and the
+ * renderer rebinds set 1 per draw-call group. Bindless inverts that: all
+ * loaded textures live in a single descriptor array, the set is bound
+ * once, and each draw selects its textures by index through the push
+ * constant block. No per-material descriptor binds remain, which also
+ * makes the draw stream state-free enough for merged indirect drawing.
+ *
+ * Key Concepts:
+ * - Descriptor Indexing: core in Vulkan 1.2. The array binding uses
+ *   PARTIALLY_BOUND (unused slots stay unwritten), UPDATE_AFTER_BIND
+ *   (textures can register while frames are in flight) and
+ *   VARIABLE_DESCRIPTOR_COUNT (capacity fixed at init, not in the layout)
+ * - Index Stability: a texture keeps its slot until unregistered; freed
+ *   slots are recycled. Indices are what draws embed in push constants,
+ *   so they must never move under a live material
+ */
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace vkeng {
+
+    // Reserved slots for the fallback textures. Apps register them in this
+    // order right after initialize(); materials with missing texture slots
+    // point at these instead of getting per-material descriptor writes.
+    static constexpr uint32_t BINDLESS_FALLBACK_WHITE = 0;              ///< 1x1 white (base color, occlusion, emissive)
+    static constexpr uint32_t BINDLESS_FALLBACK_FLAT_NORMAL = 1;        ///< 1x1 flat normal map
+    static constexpr uint32_t BINDLESS_FALLBACK_METALLIC_ROUGHNESS = 2; ///< 1x1 default metallic-roughness
+
+    /**
+     * @class BindlessTextureManager
+     * @brief Singleton owner of the bindless sampled-image array
+     *
+     * Follows the DescriptorManager pattern: apps initialize it after
+     * device creation (when VulkanDevice::supportsBindlessTextures()) and
+     * clean it up before the device goes away. Thread-safe registration —
+     * textures stream in from loader threads.
+     */
+    class BindlessTextureManager {
+    public:
+        /** @brief Gets the singleton instance. */
+        static BindlessTextureManager& get();
+
+        /**
+         * @brief Creates the layout, pool, and the single descriptor set.
+         * @param device Logical device (must have descriptor indexing enabled)
+         * @param capacity Maximum number of simultaneously registered textures
+         */
+        void initialize(VkDevice device, uint32_t capacity = 1024);
+
+        /** @brief True once initialize() has run. */
+        bool isInitialized() const { return m_set != VK_NULL_HANDLE; }
+
+        /**
+         * @brief Adds a texture to the array.
+         * @param imageView Sampled image view
+         * @param sampler Sampler to pair with it
+         * @return Stable array index for push-constant selection, or
+         *         UINT32_MAX when the array is full
+         */
+        uint32_t registerTexture(VkImageView imageView, VkSampler sampler);
+
+        /**
+         * @brief Releases a slot for reuse.
+         *
+         * The caller must guarantee no in-flight frame still draws with
+         * this index (texture teardown already waits for device idle).
+         */
+        void unregisterTexture(uint32_t index);
+
+        /** @brief Set layout for pipeline layout creation (replaces set 1). */
+        VkDescriptorSetLayout getLayout() const { return m_layout; }
+
+        /** @brief The one descriptor set, bound once per frame as set 1. */
+        VkDescriptorSet getSet() const { return m_set; }
+
+        /** @brief Destroys pool and layout (device must be idle). */
+        void cleanup();
+
+    private:
+        BindlessTextureManager() = default;
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+        VkDescriptorPool m_pool = VK_NULL_HANDLE;
+        VkDescriptorSet m_set = VK_NULL_HANDLE;
+        uint32_t m_capacity = 0;
+
+        std::mutex m_mutex;                 ///< Guards slot bookkeeping (loader threads)
+        uint32_t m_nextIndex = 0;           ///< High-water mark of handed-out slots
+        std::vector<uint32_t> m_freeIndices; ///< Recycled slots from unregistered textures
+    };
+
+} // namespace vkeng
@@ -13,14 +13,48 @@
 
 namespace vkeng {
 
-    struct Frustum;
-
     /// @brief Defines the projection type of a camera.
     enum class CameraType {
         Perspective,
         Orthographic
     };
 
+    /**
+     * @struct Frustum
+     * @brief Represents the six planes of a viewing frustum for culling.
+     *
+     * Defined before Camera so cameras can cache extracted planes; extract
+     * once per matrix change via Camera::getFrustum() rather than calling
+     * fromMatrix() per consumer.
+     */
+    struct Frustum {
+        /// @brief Enum for indexing the six planes of the frustum.
+        enum PlaneIndex { LEFT = 0, RIGHT, BOTTOM, TOP, NEAR, FAR };
+
+        /// @brief Represents a single plane in 3D space.
+        struct Plane {
+            glm::vec3 normal;
+            float distance;
+
+            /** @brief Calculates the signed distance from a point to the plane. */
+            float distanceToPoint(const glm::vec3& point) const {
+                return glm::dot(normal, point) + distance;
+            }
+        };
+
+        Plane planes[6];
+
+        /** @brief Checks if a point is inside the frustum. */
+        bool containsPoint(const glm::vec3& point) const;
+        /** @brief Checks if a sphere intersects the frustum. */
+        bool intersectsSphere(const glm::vec3& center, float radius) const;
+        /** @brief Checks if an axis-aligned bounding box intersects the frustum. */
+        bool intersectsAABB(const glm::vec3& min, const glm::vec3& max) const;
+
+        /** @brief Extracts the frustum planes from a combined view-projection matrix. */
+        static Frustum fromMatrix(const glm::mat4& viewProjectionMatrix);
+    };
+
     /**
      * @class Camera
      * @brief The base class for all cameras, managing view and projection matrices.
@@ -58,8 +92,13 @@ namespace vkeng {
 
         /** @brief Pure virtual method to get the projection matrix. */
         virtual glm::mat4 getProjectionMatrix() const = 0;
-        /** @brief Gets the combined view-projection matrix. */
+        /** @brief Gets the combined view-projection matrix (cached until the
+         *  view or projection changes). */
         virtual glm::mat4 getViewProjectionMatrix() const;
+        /** @brief Gets the inverse view matrix (cached, see above). */
+        glm::mat4 getInverseViewMatrix() const;
+        /** @brief Gets the inverse projection matrix (cached, see above). */
+        glm::mat4 getInverseProjectionMatrix() const;
 
         /** @brief Gets the camera's projection type. */
         CameraType getType() const { return m_type; }
@@ -75,8 +114,15 @@ namespace vkeng {
         /** @brief Rotates the camera to look at a target point. */
         void lookAt(const glm::vec3& target, const glm::vec3& up = glm::vec3(0, 1, 0));
 
-        /** @brief Pure virtual method to get the camera's viewing frustum. */
-        virtual Frustum getFrustum() const = 0;
+        /**
+         * @brief Gets the camera's viewing frustum.
+         *
+         * Planes are extracted once when the view or projection changes and
+         * cached; every consumer (renderer culling, cascade fitting, audio
+         * distance checks) reads the same precomputed planes. The reference
+         * stays valid until the camera mutates.
+         */
+        const Frustum& getFrustum() const;
 
         /// @brief Represents a ray in 3D space with an origin and direction.
         struct Ray {
@@ -98,11 +144,25 @@ namespace vkeng {
         glm::vec3 m_up{0.0f, 1.0f, 0.0f};
         glm::mat4 m_viewMatrix{1.0f};
 
+        /** @brief Marks the cached derived matrices and frustum stale.
+         *  Subclass projection setters must call this alongside their own
+         *  projection dirty flag. */
+        void invalidateDerivedState() { m_derivedDirty = true; }
+
     private:
         /** @brief Rebuilds the view matrix from stored position and direction vectors. */
         void rebuildViewMatrix();
         /** @brief Syncs the Transform from current view state. */
         void syncTransform();
+        /** @brief Recomputes view-proj, inverses, and frustum planes. */
+        void refreshDerivedState() const;
+
+        // --- Cached Derived State (rebuilt lazily on first read after a change) ---
+        mutable bool m_derivedDirty = true;
+        mutable glm::mat4 m_viewProjMatrix{1.0f};
+        mutable glm::mat4 m_invViewMatrix{1.0f};
+        mutable glm::mat4 m_invProjMatrix{1.0f};
+        mutable Frustum m_frustum{};
     };
 
     /**
@@ -128,7 +188,6 @@ namespace vkeng {
         float getFarPlane() const { return m_far; }
 
         glm::mat4 getProjectionMatrix() const override;
-        Frustum getFrustum() const override;
 
     private:
         float m_fov;    ///< Field of view in degrees.
@@ -176,7 +235,6 @@ namespace vkeng {
         float getHeight() const { return m_top - m_bottom; }
 
         glm::mat4 getProjectionMatrix() const override;
-        Frustum getFrustum() const override;
 
     private:
         float m_left, m_right;
@@ -189,36 +247,4 @@ namespace vkeng {
         void updateProjectionMatrix() const;
     };
 
-    /**
-     * @struct Frustum
-     * @brief Represents the six planes of a viewing frustum for culling.
-     */
-    struct Frustum {
-        /// @brief Enum for indexing the six planes of the frustum.
-        enum PlaneIndex { LEFT = 0, RIGHT, BOTTOM, TOP, NEAR, FAR };
-
-        /// @brief Represents a single plane in 3D space.
-        struct Plane {
-            glm::vec3 normal;
-            float distance;
-
-            /** @brief Calculates the signed distance from a point to the plane. */
-            float distanceToPoint(const glm::vec3& point) const {
-                return glm::dot(normal, point) + distance;
-            }
-        };
-
-        Plane planes[6];
-
-        /** @brief Checks if a point is inside the frustum. */
-        bool containsPoint(const glm::vec3& point) const;
-        /** @brief Checks if a sphere intersects the frustum. */
-        bool intersectsSphere(const glm::vec3& center, float radius) const;
-        /** @brief Checks if an axis-aligned bounding box intersects the frustum. */
-        bool intersectsAABB(const glm::vec3& min, const glm::vec3& max) const;
-
-        /** @brief Extracts the frustum planes from a combined view-projection matrix. */
-        static Frustum fromMatrix(const glm::mat4& viewProjectionMatrix);
-    };
-
 } // namespace vkeng
@@ -41,9 +41,31 @@ public:
      */
     virtual void reset() {};
 
+    /**
+     * @brief Applies freshly polled input just before the view matrix upload.
+     *
+     * Called from the renderer's late-latch hook after InputManager::pollLatest(),
+     * so mouse movement that arrived after update() still reaches this frame's
+     * view matrix. Implementations should apply rotation only — movement needs
+     * a delta time and stays in update(). No-op unless late latching is enabled.
+     */
+    virtual void lateLatch() {}
+
+    /**
+     * @brief Enables or disables late-latch input consumption.
+     *
+     * When enabled, update() and lateLatch() consume mouse deltas
+     * (read-and-clear) so each pixel of movement is applied exactly once.
+     */
+    void setLateLatchEnabled(bool enabled) { m_lateLatch = enabled; }
+
+    /** @brief Whether late-latch input consumption is enabled. */
+    bool isLateLatchEnabled() const { return m_lateLatch; }
+
 protected:
     Camera& m_camera; ///< A reference to the camera being controlled.
     InputManager& m_inputManager; ///< A reference to the input manager.
+    bool m_lateLatch = false; ///< Consume input deltas for late-latch sampling.
 };
 
 } // namespace vkeng
\ No newline at end of file
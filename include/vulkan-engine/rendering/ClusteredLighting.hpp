@@ -0,0 +1,157 @@
+/**
+ * @file ClusteredLighting.hpp
+ * @brief Clustered (froxel) forward lighting that scales past the UBO light cap
+ *
+ * GlobalUbo carries a flat MAX_LIGHTS array and the stock fragment shader
+ * iterates all of it per fragment — fine for a handful of lights, hopeless
+ * for venue scenes with hundreds. ClusteredLighting moves lights into a
+ * storage buffer, bins them into a view-space froxel grid with a compute
+ * pass each frame, and lets shader_clustered.frag shade only the lights in
+ * the fragment's own cluster.
+ *
+ * Key Concepts:
+ * - Froxel Grid: the view frustum diced into screen tiles x exponential
+ *   depth slices (16x9x24 by default). Exponential slicing keeps froxels
+ *   roughly cubical so near and far clusters hold similar light counts.
+ * - Fixed Cluster Slices: every cluster owns MAX_LIGHTS_PER_CLUSTER index
+ *   slots, so the binning pass needs no atomics or prefix sums and the
+ *   fragment shader indexes the list directly. Overflowing lights in one
+ *   cluster are dropped brightest-last (collection order).
+ * - Set 3: cluster resources bind as descriptor set 3 of the shared
+ *   graphics layout, next to UBO (0), textures (1), and shadow map (2).
+ *   Apps opt in by passing createSetLayout() to the PipelineManager.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/rendering/Uniforms.hpp"
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class ClusteredLighting
+     * @brief Owns the light/cluster storage buffers and records the per-frame
+     *        froxel binning dispatch.
+     *
+     * Usage (driven by the Renderer each frame):
+     * @code
+     *   clustered.prepare(frame, lights, count, camera-derived params);
+     *   clustered.recordBuild(cmd, frame);   // before the main pass
+     *   ... bind clustered.descriptorSet(frame) as set 3, draw ...
+     * @endcode
+     */
+    class ClusteredLighting {
+    public:
+        static constexpr uint32_t kGridX = 16;  ///< Screen tiles horizontally
+        static constexpr uint32_t kGridY = 9;   ///< Screen tiles vertically
+        static constexpr uint32_t kGridZ = 24;  ///< Exponential depth slices
+        static constexpr uint32_t kClusterCount = kGridX * kGridY * kGridZ;
+        static constexpr uint32_t kMaxLightsPerCluster = 64; ///< Must match the shaders
+        static constexpr uint32_t kMaxLights = 1024;         ///< Light SSBO capacity
+
+        /**
+         * @brief Create the set 3 layout (lights + counts + indices + params).
+         *
+         * Apps call this before constructing the PipelineManager so the shared
+         * graphics pipeline layout includes set 3; the ClusteredLighting
+         * instance creates its own identically-defined layout internally
+         * (identical definitions are bind-compatible in Vulkan).
+         */
+        static std::shared_ptr<DescriptorSetLayout> createSetLayout(VkDevice device);
+
+        /**
+         * @brief Construct the cluster resources and binning pipeline.
+         * @param device Vulkan device wrapper
+         * @param memoryManager Memory manager for buffer creation
+         * @param pipelineManager Pipeline cache providing the compute pipeline
+         * @param framesInFlight Number of frames in flight (per-frame buffers)
+         * @param shaderDir Directory with the compiled light_cluster.spv
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        ClusteredLighting(VulkanDevice& device,
+                          std::shared_ptr<MemoryManager> memoryManager,
+                          PipelineManager& pipelineManager,
+                          uint32_t framesInFlight,
+                          const std::filesystem::path& shaderDir);
+
+        ~ClusteredLighting();
+
+        ClusteredLighting(const ClusteredLighting&) = delete;
+        ClusteredLighting& operator=(const ClusteredLighting&) = delete;
+
+        /**
+         * @brief Upload this frame's lights and camera-derived cluster params.
+         * @param frameIndex Frame-in-flight index
+         * @param lights Collected GPU lights (world space)
+         * @param lightCount Number of lights (clamped to kMaxLights)
+         * @param view Camera view matrix
+         * @param proj Camera projection matrix (perspective)
+         * @param nearPlane Camera near plane distance
+         * @param farPlane Camera far plane distance
+         * @param framebufferExtent Current swapchain extent (fragment tile lookup)
+         */
+        void prepare(uint32_t frameIndex,
+                     const GpuLight* lights, uint32_t lightCount,
+                     const glm::mat4& view, const glm::mat4& proj,
+                     float nearPlane, float farPlane,
+                     VkExtent2D framebufferExtent);
+
+        /**
+         * @brief Record the binning dispatch (outside any render pass, before the main pass).
+         *
+         * Emits the compute dispatch plus the barrier making the cluster
+         * buffers visible to fragment-shader reads.
+         */
+        void recordBuild(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+        /** @brief Descriptor set to bind as set 3 for the given frame. */
+        VkDescriptorSet descriptorSet(uint32_t frameIndex) const {
+            return m_frames[frameIndex].set;
+        }
+
+        /** @brief Lights uploaded for the given frame (for stats/debug). */
+        uint32_t lightCount(uint32_t frameIndex) const {
+            return m_frames[frameIndex].lightCount;
+        }
+
+    private:
+        /** @brief Uniform block shared by light_cluster.comp and shader_clustered.frag. */
+        struct ClusterParams {
+            glm::mat4 view;
+            glm::vec4 gridSize;    ///< xyz = grid dimensions, w = light count
+            glm::vec4 zPlanes;     ///< x = near, y = far, zw = framebuffer size
+            glm::vec4 projFactors; ///< x = proj[0][0], y = proj[1][1]
+        };
+
+        /** @brief Per-frame-in-flight cluster buffers and their descriptor set. */
+        struct FrameResources {
+            std::shared_ptr<Buffer> lights;   ///< Host-visible GpuLight SSBO
+            std::shared_ptr<Buffer> counts;   ///< Device-local per-cluster light counts
+            std::shared_ptr<Buffer> indices;  ///< Device-local per-cluster index slices
+            std::shared_ptr<Buffer> params;   ///< Host-visible ClusterParams UBO
+            VkDescriptorSet set = VK_NULL_HANDLE;
+            uint32_t lightCount = 0;          ///< Lights uploaded this frame
+        };
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+
+        std::shared_ptr<DescriptorSetLayout> m_setLayout; ///< Identical to createSetLayout()
+        std::shared_ptr<DescriptorPool> m_descriptorPool;
+        VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+        std::shared_ptr<ComputePipeline> m_binPipeline;
+
+        std::vector<FrameResources> m_frames; ///< One entry per frame in flight
+    };
+
+} // namespace vkeng
@@ -11,6 +11,13 @@
  * - Command Pool: Allocates command buffers from memory pools
  * - Queue: Submits command buffers to GPU for execution
  * - Synchronization: Fences and semaphores coordinate GPU/CPU work
+ * - Batched Submission: every vkQueueSubmit carries fixed driver overhead,
+ *   so a frame's submissions are collected and flushed as one call
+ * - State Filtering: an opt-in tracking layer remembers the last-bound
+ *   pipeline, descriptor sets, vertex/index buffers, and viewport/scissor
+ *   per buffer, and elides re-binds of identical state — sorted draw
+ *   streams hit such no-ops at every bucket boundary, and per-buffer
+ *   tracking keeps secondary buffers independent under parallel recording
  */
 
 #pragma once
@@ -26,6 +33,7 @@ namespace vkeng {
     class Buffer;
     class Image;
     class Pipeline;
+    class ComputePipeline;
 
     /**
      * @enum CommandBufferLevel
@@ -95,7 +103,18 @@ namespace vkeng {
         void drawIndexed(uint32_t indexCount, uint32_t instanceCount = 1,
                         uint32_t firstIndex = 0, int32_t vertexOffset = 0,
                         uint32_t firstInstance = 0);
-        
+
+        // Compute commands
+        /// Binds a compute pipeline at the COMPUTE bind point
+        void bindComputePipeline(const ComputePipeline& pipeline);
+
+        /// Records a compute dispatch (workgroup counts per dimension)
+        void dispatch(uint32_t groupCountX, uint32_t groupCountY = 1,
+                    uint32_t groupCountZ = 1);
+
+        /// Records a dispatch whose workgroup counts come from a GPU buffer
+        void dispatchIndirect(VkBuffer buffer, VkDeviceSize offset = 0);
+
         // Push constants
         void pushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags,
                         uint32_t offset, uint32_t size, const void* data);
@@ -124,25 +143,147 @@ namespace vkeng {
         void beginDebugLabel(const char* labelName, const float color[4] = nullptr);
         void endDebugLabel();
         void insertDebugLabel(const char* labelName, const float color[4] = nullptr);
+
+        /// GPU timestamp scope (see GpuProfiler); pairs like begin/endDebugLabel
+        void beginGpuScope(const char* scopeName);
+        void endGpuScope();
         
+        // State filtering
+        /**
+         * @brief Enables or disables redundant-bind elision for this buffer.
+         *
+         * When enabled, bind/set calls whose arguments match the last ones
+         * recorded are dropped instead of forwarded — handle comparisons
+         * only, no deep equality. Off by default: callers that mix raw
+         * vkCmd* calls on getHandle() or vkCmdExecuteCommands into their
+         * recording must either leave it off or call
+         * invalidateTrackedState() after each such call.
+         */
+        void setStateTrackingEnabled(bool enabled) {
+            m_stateTracking = enabled;
+            m_state.reset();
+        }
+        bool isStateTrackingEnabled() const { return m_stateTracking; }
+
+        /**
+         * @brief Forgets all tracked bindings so the next binds record fully.
+         *
+         * Call after recording through getHandle() directly or executing
+         * secondary buffers — both change GPU state the tracker cannot see.
+         */
+        void invalidateTrackedState() { m_state.reset(); }
+
         // Access
         VkCommandBuffer getHandle() const { return m_commandBuffer; }
         bool isRecording() const { return m_isRecording; }
-        
+
     private:
         CommandBuffer(VkDevice device, VkCommandPool pool, VkCommandBuffer commandBuffer);
-        
+
+        /// Descriptor-set slots tracked per bind point; binds beyond this
+        /// range record unconditionally (the shared layout uses 4)
+        static constexpr uint32_t kTrackedSets = 8;
+        /// Vertex-buffer bindings tracked; same overflow rule as sets
+        static constexpr uint32_t kTrackedVertexBindings = 8;
+
+        /**
+         * @brief Last-recorded bindings, compared by handle before forwarding.
+         *
+         * Mirrors the state the GPU sees for this buffer only — secondary
+         * buffers inherit nothing, so each tracks from a clean slate.
+         */
+        struct TrackedState {
+            VkPipeline pipelines[2] = {};           ///< [0] graphics, [1] compute
+            struct SetSlot {
+                VkPipelineLayout layout = VK_NULL_HANDLE; ///< Set is only redundant under the same layout
+                VkDescriptorSet set = VK_NULL_HANDLE;
+            };
+            SetSlot sets[2][kTrackedSets] = {};     ///< Per bind point, per slot
+            VkBuffer vertexBuffers[kTrackedVertexBindings] = {};
+            VkDeviceSize vertexOffsets[kTrackedVertexBindings] = {};
+            VkBuffer indexBuffer = VK_NULL_HANDLE;
+            VkDeviceSize indexOffset = 0;
+            VkIndexType indexType = VK_INDEX_TYPE_MAX_ENUM;
+            VkViewport viewport = {};               ///< Tracked for the single-viewport case only
+            VkRect2D scissor = {};
+            bool viewportValid = false;
+            bool scissorValid = false;
+
+            void reset() { *this = TrackedState{}; }
+        };
+
         VkDevice m_device = VK_NULL_HANDLE;
         VkCommandPool m_pool = VK_NULL_HANDLE;
         VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
         bool m_isRecording = false;
+        bool m_stateTracking = false;   ///< Elision layer off unless opted in
+        TrackedState m_state;
+    };
+
+    /**
+     * @class SubmissionBatch
+     * @brief Collects a frame's submissions for a single vkQueueSubmit
+     *
+     * Each add() queues one logical submission — a pass group or one
+     * window's frame — with its own wait/signal semaphores. The batch is
+     * flushed through Queue::submitBatch() as one vkQueueSubmit carrying
+     * one VkSubmitInfo per entry, paying the driver's submit overhead once
+     * instead of per pass/window.
+     *
+     * Semaphores may be binary or timeline: pass a non-empty value list to
+     * treat the matching semaphores as timelines (a VkTimelineSemaphoreSubmitInfo
+     * is chained for that entry). Entries execute in add() order, so
+     * timeline values signal in the order they were reserved.
+     */
+    class SubmissionBatch {
+    public:
+        /**
+         * @brief Queues one submission's command buffers and synchronization.
+         * @param commandBuffers Buffers to execute (must have finished recording)
+         * @param waitSemaphores Semaphores to wait before execution
+         * @param waitStages Destination stage per wait semaphore
+         * @param waitValues Timeline values per wait semaphore (empty = all binary)
+         * @param signalSemaphores Semaphores to signal after execution
+         * @param signalValues Timeline values per signal semaphore (empty = all binary)
+         */
+        Result<void> add(
+            const std::vector<std::shared_ptr<CommandBuffer>>& commandBuffers,
+            const std::vector<VkSemaphore>& waitSemaphores = {},
+            const std::vector<VkPipelineStageFlags>& waitStages = {},
+            const std::vector<uint64_t>& waitValues = {},
+            const std::vector<VkSemaphore>& signalSemaphores = {},
+            const std::vector<uint64_t>& signalValues = {});
+
+        /** @brief True when nothing has been queued. */
+        bool empty() const { return m_entries.empty(); }
+        /** @brief Number of queued submissions. */
+        size_t size() const { return m_entries.size(); }
+        /** @brief Drops all queued submissions (for per-frame batch reuse). */
+        void clear() { m_entries.clear(); }
+
+    private:
+        friend class Queue;
+
+        /// One VkSubmitInfo worth of handles; vectors stay stable so the
+        /// flush can point VkSubmitInfo at them directly
+        struct Entry {
+            std::vector<VkCommandBuffer> commandBuffers;
+            std::vector<VkSemaphore> waitSemaphores;
+            std::vector<VkPipelineStageFlags> waitStages;
+            std::vector<uint64_t> waitValues;
+            std::vector<VkSemaphore> signalSemaphores;
+            std::vector<uint64_t> signalValues;
+            bool usesTimeline = false;
+        };
+
+        std::vector<Entry> m_entries;
     };
 
     // Queue wrapper for command submission
     class Queue {
     public:
         Queue(VkDevice device, VkQueue queue, uint32_t familyIndex);
-        
+
         Result<void> submit(
             const std::vector<std::shared_ptr<CommandBuffer>>& commandBuffers,
             const std::vector<VkSemaphore>& waitSemaphores = {},
@@ -152,7 +293,19 @@ namespace vkeng {
         
         Result<void> submitAndWait(
             const std::vector<std::shared_ptr<CommandBuffer>>& commandBuffers);
-        
+
+        /**
+         * @brief Flushes a SubmissionBatch as a single vkQueueSubmit.
+         * @param batch Submissions collected this frame (left intact; the
+         *              caller clear()s it for reuse)
+         * @param fence Optional fence signaled when the whole batch retires
+         */
+        Result<void> submitBatch(const SubmissionBatch& batch,
+                                 VkFence fence = VK_NULL_HANDLE);
+
+        /// Batch-shaped: one call presents every window's swapchain in a
+        /// single VkPresentInfoKHR, with per-swapchain results checked so
+        /// one window's OUT_OF_DATE does not mask the others
         Result<void> present(
             const std::vector<VkSemaphore>& waitSemaphores,
             const std::vector<VkSwapchainKHR>& swapchains,
@@ -15,6 +15,8 @@
 
 #pragma once
 #include <vulkan/vulkan.h>
+#include <memory>
+#include <vector>
 #include "vulkan-engine/core/Result.hpp"
 
 namespace vkeng {
@@ -75,6 +77,18 @@ namespace vkeng {
          */
         Result<void> endSingleTimeCommands(VkCommandBuffer commandBuffer, VkQueue queue);
 
+        /**
+         * @brief Allocates command buffers from this pool.
+         * @param count Number of command buffers to allocate.
+         * @param level Primary or secondary command buffer level.
+         * @return The allocated command buffer handles.
+         *
+         * Used by multi-threaded recording where each worker thread owns its
+         * own CommandPool and allocates secondary buffers from it.
+         */
+        Result<std::vector<VkCommandBuffer>> allocateCommandBuffers(
+            uint32_t count, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+
         /** @brief Gets the raw Vulkan command pool handle. */
         VkCommandPool getPool() const { return commandPool_; }
 
@@ -82,4 +96,37 @@ namespace vkeng {
         VkDevice device_{VK_NULL_HANDLE};       ///< The logical device.
         VkCommandPool commandPool_{VK_NULL_HANDLE}; ///< The Vulkan command pool object.
     };
+
+    /**
+     * @class PerThreadCommandPools
+     * @brief Owns one CommandPool per worker thread for parallel recording
+     *
+     * Command pools are externally synchronized in Vulkan, so concurrent
+     * command buffer recording requires one pool per recording thread.
+     * This helper owns a fixed set of pools, indexed by worker thread index.
+     *
+     * @note Pool count is fixed at construction; size it to the worker count.
+     */
+    class PerThreadCommandPools {
+        public:
+        /**
+         * @brief Creates one command pool per worker thread.
+         * @param device The logical device.
+         * @param queueFamilyIndex Queue family all pools allocate for.
+         * @param threadCount Number of worker threads (one pool each).
+         */
+        PerThreadCommandPools(VkDevice device, uint32_t queueFamilyIndex, uint32_t threadCount);
+
+        PerThreadCommandPools(const PerThreadCommandPools&) = delete;
+        PerThreadCommandPools& operator=(const PerThreadCommandPools&) = delete;
+
+        /** @brief Gets the pool owned by the given worker thread index. */
+        CommandPool& getPool(uint32_t threadIndex) { return *pools_[threadIndex]; }
+
+        /** @brief Number of per-thread pools. */
+        uint32_t getThreadCount() const { return static_cast<uint32_t>(pools_.size()); }
+
+        private:
+        std::vector<std::unique_ptr<CommandPool>> pools_; ///< One pool per worker thread.
+    };
 } // namespace vkeng
\ No newline at end of file
@@ -11,6 +11,10 @@
  * - Descriptor Layout: Template defining what resources can be bound
  * - Descriptor Pool: Memory allocator for descriptor sets
  * - Resource Binding: Process of connecting buffers/images to shader uniforms
+ * - Update Template: Precompiled write layout (core 1.1); updates copy a
+ *   packed data blob instead of assembling VkWriteDescriptorSet arrays
+ * - Push Descriptor: Writes recorded straight into the command buffer
+ *   (VK_KHR_push_descriptor) — no set allocation at all
  */
 
 #pragma once
@@ -35,32 +39,70 @@ namespace vkeng {
         VkShaderStageFlags stageFlags;  ///< The shader stages that can access this binding.
     };
 
+    /**
+     * @brief Per-binding source data for descriptor update templates.
+     *
+     * Updates via template read one of these per layout binding (in binding
+     * declaration order); each template entry's offset selects the member
+     * matching the binding's descriptor type.
+     */
+    struct DescriptorTemplateData {
+        VkDescriptorBufferInfo buffer;
+        VkDescriptorImageInfo image;
+    };
+
     /** @class DescriptorSetLayout @brief A template for creating descriptor sets. */
     class DescriptorSetLayout {
     public:
-        /** @brief Factory method to create a new DescriptorSetLayout. */
-        static Result<std::shared_ptr<DescriptorSetLayout>> create(VkDevice device, const std::vector<DescriptorBinding>& bindings);
+        /**
+         * @brief Factory method to create a new DescriptorSetLayout.
+         * @param pushDescriptor When true the layout is created with
+         *        PUSH_DESCRIPTOR_BIT_KHR: sets cannot be allocated from it,
+         *        resources are pushed per-draw instead. Only valid when the
+         *        device enabled VK_KHR_push_descriptor.
+         */
+        static Result<std::shared_ptr<DescriptorSetLayout>> create(VkDevice device, const std::vector<DescriptorBinding>& bindings, bool pushDescriptor = false);
         /** @brief Destructor. */
         ~DescriptorSetLayout();
-        
+
         /** @brief Gets the raw Vulkan layout handle. */
         VkDescriptorSetLayout getHandle() const { return m_layout; }
         /** @brief Gets the bindings that this layout was created with. */
         const std::vector<DescriptorBinding>& getBindings() const { return m_bindings; }
-        
+        /** @brief Whether the layout was created for per-draw push descriptors. */
+        bool isPushDescriptor() const { return m_pushDescriptor; }
+        /**
+         * @brief Gets the precompiled update template for this layout.
+         * @return The template, or VK_NULL_HANDLE when the layout cannot be
+         *         templated (array bindings, texel buffers, push layouts) —
+         *         callers fall back to VkWriteDescriptorSet assembly then.
+         *
+         * Data passed to vkUpdateDescriptorSetWithTemplate must be an array
+         * of DescriptorTemplateData, one element per binding in declaration
+         * order.
+         */
+        VkDescriptorUpdateTemplate getUpdateTemplate() const { return m_updateTemplate; }
+
     private:
-        DescriptorSetLayout(VkDevice device, VkDescriptorSetLayout layout, const std::vector<DescriptorBinding>& bindings);
-        
+        DescriptorSetLayout(VkDevice device, VkDescriptorSetLayout layout, const std::vector<DescriptorBinding>& bindings, bool pushDescriptor, VkDescriptorUpdateTemplate updateTemplate);
+
         VkDevice m_device = VK_NULL_HANDLE;
         VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
         std::vector<DescriptorBinding> m_bindings;
+        bool m_pushDescriptor = false;
+        VkDescriptorUpdateTemplate m_updateTemplate = VK_NULL_HANDLE;
     };
 
     /** @class DescriptorPool @brief Manages the allocation of descriptor sets. */
     class DescriptorPool {
     public:
-        /** @brief Factory method to create a new DescriptorPool. */
-        static Result<std::shared_ptr<DescriptorPool>> create(VkDevice device, uint32_t maxSets, const std::vector<VkDescriptorPoolSize>& poolSizes);
+        /**
+         * @brief Factory method to create a new DescriptorPool.
+         * @param allowFreeIndividualSets When false the pool omits
+         *        FREE_DESCRIPTOR_SET_BIT and can only be bulk-reset, which is
+         *        cheaper for per-frame transient pools.
+         */
+        static Result<std::shared_ptr<DescriptorPool>> create(VkDevice device, uint32_t maxSets, const std::vector<VkDescriptorPoolSize>& poolSizes, bool allowFreeIndividualSets = true);
         /** @brief Destructor. */
         ~DescriptorPool();
         
@@ -92,13 +134,23 @@ namespace vkeng {
         /** @brief Stages a write operation for an array of image descriptors. */
         void writeImages(uint32_t binding, const std::vector<std::shared_ptr<Image>>& images, VkSampler sampler = VK_NULL_HANDLE, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
         
-        /** @brief Applies all pending writes to the descriptor set. */
+        /**
+         * @brief Applies all pending writes to the descriptor set.
+         *
+         * When the writes cover every layout binding exactly once and the
+         * layout has an update template, the update goes through
+         * vkUpdateDescriptorSetWithTemplate; partial updates and array
+         * writes use the VkWriteDescriptorSet path.
+         */
         void update();
-        
+
         /** @brief Gets the raw Vulkan descriptor set handle. */
         VkDescriptorSet getHandle() const { return m_descriptorSet; }
-        
+
     private:
+        /** @brief Template fast path; returns false when writes don't fit it. */
+        bool updateWithTemplate();
+
         enum class PendingWriteKind {
             Buffer,
             Image
@@ -121,6 +173,104 @@ namespace vkeng {
         std::vector<VkDescriptorImageInfo> m_imageInfos;
     };
 
+    /** @brief One resource binding used to key and populate a cached descriptor set. */
+    struct CachedDescriptorWrite {
+        uint32_t binding = 0;
+        VkDescriptorType type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        // Buffer descriptors
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize range = VK_WHOLE_SIZE;
+        // Image descriptors
+        VkImageView imageView = VK_NULL_HANDLE;
+        VkSampler sampler = VK_NULL_HANDLE;
+        VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        bool operator==(const CachedDescriptorWrite& other) const {
+            return binding == other.binding && type == other.type &&
+                   buffer == other.buffer && offset == other.offset && range == other.range &&
+                   imageView == other.imageView && sampler == other.sampler &&
+                   imageLayout == other.imageLayout;
+        }
+    };
+
+    /**
+     * @class DescriptorSetCache
+     * @brief Per-frame descriptor set cache with a bulk-reset pool ring
+     *
+     * Owns one descriptor pool per frame in flight. Each frame's pool is
+     * bulk-reset via vkResetDescriptorPool (no per-set frees, so pools are
+     * created without FREE_DESCRIPTOR_SET_BIT), and sets are handed out from
+     * a cache keyed by (layout, bound resources). Draws that bind the same
+     * resources share one set, and steady-state rendering performs no
+     * descriptor allocations beyond cheap bump allocations from a reset pool.
+     *
+     * Usage per frame:
+     * @code
+     *   cache.beginFrame(frameIndex);                  // resets that frame's pool
+     *   auto set = cache.getOrAllocate(layout, writes); // cached after first use
+     * @endcode
+     *
+     * @note Returned sets are valid only until the same frame slot is reset
+     *       (i.e. for MAX_FRAMES_IN_FLIGHT frames); do not store them.
+     */
+    class DescriptorSetCache {
+    public:
+        /**
+         * @brief Factory method to create a new DescriptorSetCache.
+         * @param device The logical device.
+         * @param frameCount Number of frames in flight (pool ring size).
+         * @param maxSetsPerFrame Capacity of each per-frame pool.
+         */
+        static Result<std::shared_ptr<DescriptorSetCache>> create(
+            VkDevice device, uint32_t frameCount, uint32_t maxSetsPerFrame = 1024);
+
+        /**
+         * @brief Starts a new frame: bulk-resets the frame's pool and clears its cache.
+         * @param frameIndex Current frame-in-flight index.
+         */
+        void beginFrame(uint32_t frameIndex);
+
+        /**
+         * @brief Gets a descriptor set bound to the given resources, allocating on miss.
+         * @param layout Layout the set is allocated with.
+         * @param writes Resources to bind, also used as the cache key.
+         * @return The (possibly shared) descriptor set, or an error on pool exhaustion.
+         */
+        Result<VkDescriptorSet> getOrAllocate(
+            std::shared_ptr<DescriptorSetLayout> layout,
+            const std::vector<CachedDescriptorWrite>& writes);
+
+        /** @brief Cache hits since the last beginFrame() of the current slot. */
+        uint32_t getFrameCacheHits() const { return m_frameCacheHits; }
+        /** @brief Allocations since the last beginFrame() of the current slot. */
+        uint32_t getFrameAllocations() const { return m_frameAllocations; }
+
+    private:
+        DescriptorSetCache(VkDevice device, std::vector<std::shared_ptr<DescriptorPool>> pools);
+
+        /** @brief Cache key: layout plus every bound resource. */
+        struct CacheKey {
+            VkDescriptorSetLayout layout;
+            std::vector<CachedDescriptorWrite> writes;
+
+            bool operator==(const CacheKey& other) const {
+                return layout == other.layout && writes == other.writes;
+            }
+        };
+
+        struct CacheKeyHash {
+            size_t operator()(const CacheKey& key) const;
+        };
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        std::vector<std::shared_ptr<DescriptorPool>> m_pools; ///< One pool per frame in flight.
+        std::vector<std::unordered_map<CacheKey, VkDescriptorSet, CacheKeyHash>> m_frameCaches;
+        uint32_t m_currentFrame = 0;
+        uint32_t m_frameCacheHits = 0;
+        uint32_t m_frameAllocations = 0;
+    };
+
     /** @class DescriptorManager @brief A singleton utility for managing descriptor layouts and pools. */
     class DescriptorManager {
     public:
@@ -136,11 +286,19 @@ namespace vkeng {
         std::shared_ptr<DescriptorSetLayout> createUniformBufferLayout(VkShaderStageFlags stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
         /** @brief Creates or retrieves a cached layout for a texture array. */
         std::shared_ptr<DescriptorSetLayout> createTextureLayout(uint32_t textureCount = 1, VkShaderStageFlags stages = VK_SHADER_STAGE_FRAGMENT_BIT);
-        /** @brief Creates or retrieves a cached layout for a custom combination of bindings. */
-        std::shared_ptr<DescriptorSetLayout> createCombinedLayout(const std::vector<DescriptorBinding>& bindings);
+        /**
+         * @brief Creates or retrieves a cached layout for a custom combination of bindings.
+         * @param pushDescriptor Create as a push-descriptor layout (see
+         *        DescriptorSetLayout::create); cached separately from the
+         *        equivalent bindable layout.
+         */
+        std::shared_ptr<DescriptorSetLayout> createCombinedLayout(const std::vector<DescriptorBinding>& bindings, bool pushDescriptor = false);
         
         /** @brief Creates and caches a new descriptor pool with default sizes. */
         std::shared_ptr<DescriptorPool> createPool(uint32_t maxSets = 1000, const std::vector<VkDescriptorPoolSize>& additionalSizes = {});
+
+        /** @brief Creates a per-frame descriptor set cache (see DescriptorSetCache). */
+        std::shared_ptr<DescriptorSetCache> createSetCache(uint32_t frameCount, uint32_t maxSetsPerFrame = 1024);
         
     private:
         VkDevice m_device = VK_NULL_HANDLE;
@@ -35,6 +35,7 @@ public:
 
     void update(float deltaTime) override;
     void reset() override;
+    void lateLatch() override;
 
     // --- Configuration ---
     void setMovementSpeed(float speed) { m_movementSpeed = speed; }
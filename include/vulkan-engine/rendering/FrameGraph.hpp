@@ -0,0 +1,265 @@
+/**
+ * @file FrameGraph.hpp
+ * @brief Declarative render pass scheduling with derived barriers
+ *
+ * This file contains the FrameGraph class which sits on top of the raw
+ * RenderPass/CommandBuffer layer. Passes declare which attachments they
+ * read and write; the graph derives the pipeline barriers between them,
+ * culls passes whose results are never consumed, and recycles transient
+ * attachment memory between non-overlapping lifetimes.
+ *
+ * Key Frame Graph Concepts:
+ * - Declared Access: Each pass states (stage, access, layout) per resource
+ * - Derived Barriers: Exact src/dst scopes come from consecutive accesses,
+ *   replacing hand-placed full-pipeline barriers
+ * - Pass Culling: Passes not reachable from a marked output are dropped
+ * - Transient Aliasing: Attachments with disjoint pass lifetimes share
+ *   the same VkImage, allocated through MemoryManager
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/Result.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    class Image;
+    class MemoryManager;
+
+    /** @brief Opaque handle to a frame graph resource (index into the graph). */
+    using FrameGraphResource = uint32_t;
+
+    /** @brief Sentinel for "no resource". */
+    constexpr FrameGraphResource kInvalidFrameGraphResource = UINT32_MAX;
+
+    /**
+     * @struct ResourceAccess
+     * @brief How a pass touches a resource: the exact barrier scope it needs
+     */
+    struct ResourceAccess {
+        VkPipelineStageFlags stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        VkAccessFlags access = 0;
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    };
+
+    /**
+     * @struct TransientImageDesc
+     * @brief Describes a graph-owned attachment created for this frame only
+     */
+    struct TransientImageDesc {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        VkImageUsageFlags usage = 0;
+
+        bool operator==(const TransientImageDesc& other) const {
+            return width == other.width && height == other.height
+                && format == other.format && usage == other.usage;
+        }
+    };
+
+    /**
+     * @class FrameGraph
+     * @brief Schedules render passes from declared resource usage
+     *
+     * The graph is rebuilt every frame: reset(), import the externally owned
+     * images (swapchain backbuffer, shadow map), declare passes with their
+     * reads/writes, mark the final outputs, then compile() and execute().
+     * compile() culls passes that do not contribute to any marked output,
+     * assigns transient attachments (reusing pooled images whose previous
+     * lifetime ended before the new one starts), and precomputes one minimal
+     * vkCmdPipelineBarrier per pass from the declared access chain.
+     *
+     * Accesses made inside a VkRenderPass instance can be declared as
+     * render-pass-managed: the graph then tracks the resulting layout but
+     * emits no transition of its own, since the render pass's attachment
+     * final layout and external subpass dependencies already cover it.
+     *
+     * Usage:
+     * @code
+     *   graph.reset();
+     *   auto shadow = graph.importImage("shadowMap", shadowImage, aspect, current);
+     *   graph.addPass("shadow",
+     *       [&](FrameGraph::Builder& b) { b.writeAsRenderPass(shadow, after); },
+     *       [&](VkCommandBuffer cmd) { recordShadowPass(cmd); });
+     *   ...
+     *   graph.markOutput(backbuffer);
+     *   graph.compile();
+     *   graph.execute(cmd);
+     * @endcode
+     *
+     * @note The transient image pool persists across reset() so steady-state
+     *       frames allocate nothing.
+     * @warning Imported VkImage handles must outlive execute().
+     */
+    class FrameGraph {
+    public:
+        /**
+         * @class Builder
+         * @brief Declaration interface handed to each pass's setup callback
+         */
+        class Builder {
+        public:
+            /** @brief Declare a read of @p resource with the given scope. */
+            void read(FrameGraphResource resource, const ResourceAccess& access);
+
+            /** @brief Declare a write of @p resource with the given scope. */
+            void write(FrameGraphResource resource, const ResourceAccess& access);
+
+            /**
+             * @brief Declare a write performed inside a VkRenderPass instance
+             * @param resource The attachment written
+             * @param layoutAfter The render pass's finalLayout for it, with
+             *        the stage/access the attachment writes resolve at
+             *
+             * No barrier is emitted for this access; the render pass's own
+             * initial/final layouts and external dependencies handle it. The
+             * graph records @p layoutAfter as the resource's state so later
+             * readers get exact barrier scopes.
+             */
+            void writeAsRenderPass(FrameGraphResource resource, const ResourceAccess& layoutAfter);
+
+            /**
+             * @brief Create a graph-owned attachment for this frame
+             * @return Handle usable by this and later passes
+             *
+             * The image is assigned during compile(), possibly aliasing a
+             * pooled image whose lifetime does not overlap. Retrieve it with
+             * FrameGraph::getImage() inside the execute callback.
+             */
+            FrameGraphResource createTransient(const std::string& name,
+                                               const TransientImageDesc& desc,
+                                               const ResourceAccess& firstUse);
+
+        private:
+            friend class FrameGraph;
+            Builder(FrameGraph& graph, uint32_t passIndex)
+                : m_graph(graph), m_passIndex(passIndex) {}
+
+            FrameGraph& m_graph;
+            uint32_t m_passIndex;
+        };
+
+        using PassSetup = std::function<void(Builder&)>;
+        using PassExecute = std::function<void(VkCommandBuffer)>;
+
+        /**
+         * @brief Construct the graph
+         * @param memoryManager Allocator for transient attachments; may be
+         *        null if no pass creates transients
+         */
+        explicit FrameGraph(std::shared_ptr<MemoryManager> memoryManager = nullptr);
+
+        /** @brief Drop all passes and per-frame resources; keep the transient pool. */
+        void reset();
+
+        /**
+         * @brief Register an externally owned image with the graph
+         * @param name Debug name for logging
+         * @param image The image handle (not owned)
+         * @param aspect Aspect mask used in barriers for this image
+         * @param current The image's layout/scope when execute() begins
+         * @return Handle for pass declarations
+         */
+        FrameGraphResource importImage(const std::string& name,
+                                       VkImage image,
+                                       VkImageAspectFlags aspect,
+                                       const ResourceAccess& current);
+
+        /**
+         * @brief Add a pass to the graph
+         * @param name Debug name for logging
+         * @param setup Called immediately to declare resource usage
+         * @param execute Called during execute() to record commands
+         */
+        void addPass(const std::string& name, const PassSetup& setup, PassExecute execute);
+
+        /** @brief Mark a resource as a frame output; its writers survive culling. */
+        void markOutput(FrameGraphResource resource);
+
+        /**
+         * @brief Cull passes, assign transient images, and derive barriers
+         * @return Error if a transient attachment could not be allocated
+         */
+        Result<void> compile();
+
+        /** @brief Record barriers and scheduled passes into @p commandBuffer. */
+        void execute(VkCommandBuffer commandBuffer);
+
+        /**
+         * @brief Get the image backing a transient resource
+         * @note Valid only between compile() and the next reset()
+         */
+        std::shared_ptr<Image> getImage(FrameGraphResource resource) const;
+
+        /** @brief Passes dropped by the last compile(). */
+        uint32_t getCulledPassCount() const { return m_culledPassCount; }
+
+        /** @brief Image barriers emitted by the last compile(). */
+        uint32_t getBarrierCount() const { return m_barrierCount; }
+
+    private:
+        /** @brief One declared access by one pass. */
+        struct PassAccess {
+            FrameGraphResource resource = kInvalidFrameGraphResource;
+            ResourceAccess access;
+            bool isWrite = false;
+            bool renderPassManaged = false; ///< Layout handled by a VkRenderPass
+        };
+
+        /** @brief Per-resource bookkeeping. */
+        struct ResourceEntry {
+            std::string name;
+            VkImage image = VK_NULL_HANDLE;            ///< Imported handle, or assigned transient
+            std::shared_ptr<Image> transientImage;     ///< Owning pointer for transients
+            TransientImageDesc desc;                   ///< Valid for transients only
+            VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+            ResourceAccess state;                      ///< Tracked layout/scope during compile
+            bool isTransient = false;
+            bool isOutput = false;
+            uint32_t firstUse = UINT32_MAX;            ///< Scheduled pass index range, for aliasing
+            uint32_t lastUse = 0;
+        };
+
+        /** @brief A declared pass and its compiled barrier batch. */
+        struct Pass {
+            std::string name;
+            PassExecute execute;
+            std::vector<PassAccess> accesses;
+            bool culled = false;
+
+            // Compiled by compile():
+            std::vector<VkImageMemoryBarrier> barriers;
+            VkPipelineStageFlags srcStageMask = 0;
+            VkPipelineStageFlags dstStageMask = 0;
+        };
+
+        /** @brief Pooled transient image, reused across frames and passes. */
+        struct PooledImage {
+            TransientImageDesc desc;
+            std::shared_ptr<Image> image;
+            ResourceAccess state;       ///< Layout the image was left in
+            uint32_t availableAfter = 0; ///< Pass index after which it is free this frame
+            bool usedThisFrame = false;
+        };
+
+        void cullPasses();
+        Result<void> assignTransients();
+        void deriveBarriers();
+
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        std::vector<ResourceEntry> m_resources;
+        std::vector<Pass> m_passes;
+        std::vector<PooledImage> m_pool;
+        uint32_t m_culledPassCount = 0;
+        uint32_t m_barrierCount = 0;
+    };
+
+} // namespace vkeng
@@ -0,0 +1,106 @@
+/**
+ * @file GpuProfiler.hpp
+ * @brief GPU pass timing via VkQueryPool timestamps
+ *
+ * CPU fences only say when a whole submission finished; they cannot split
+ * a frame into shadow vs shading cost. The GPU profiler writes timestamp
+ * queries around named scopes while commands are recorded and reads them
+ * back frames later, so timing never stalls the pipeline.
+ *
+ * Key Profiling Concepts:
+ * - Timestamp Query: the GPU writes its clock when a pipeline stage
+ *   drains; two per scope (begin at TOP_OF_PIPE, end at BOTTOM_OF_PIPE)
+ * - Frame Buffering: one query pool per frame in flight; results are
+ *   resolved when the same slot comes around again, after its fence wait,
+ *   so vkGetQueryPoolResults never blocks
+ * - timestampPeriod: device-specific nanoseconds per timestamp tick
+ *
+ * Usage in a render loop:
+ * @code
+ *   GpuProfiler::get().beginFrame(cmd, frameIndex);   // resolve + reset
+ *   GpuProfiler::get().beginScope(cmd, "shadow");
+ *   ... record shadow pass ...
+ *   GpuProfiler::get().endScope(cmd);
+ *   ... then read getTimings() anywhere (stats overlay, logs)
+ * @endcode
+ */
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    class GpuProfiler {
+    public:
+        /** @brief A resolved scope timing from the most recent available frame. */
+        struct PassTiming {
+            std::string name;
+            double milliseconds = 0.0;
+        };
+
+        static GpuProfiler& get();
+
+        /**
+         * @brief Creates the per-frame query pools; call after device init
+         *
+         * Disables itself (all calls become no-ops) on devices whose queues
+         * do not support timestamps.
+         */
+        void initialize(VkDevice device, VkPhysicalDevice physicalDevice,
+                        uint32_t framesInFlight);
+
+        /** @brief Destroys the query pools; call before device destruction. */
+        void shutdown();
+
+        /**
+         * @brief Resolves the slot's previous results and resets its pool
+         *
+         * Record at the very start of the frame's command buffer, after the
+         * frame fence wait (which guarantees the old queries completed).
+         */
+        void beginFrame(VkCommandBuffer cmd, uint32_t frameIndex);
+
+        /** @brief Opens a named timing scope; scopes may nest. */
+        void beginScope(VkCommandBuffer cmd, const char* name);
+
+        /** @brief Closes the innermost open scope. */
+        void endScope(VkCommandBuffer cmd);
+
+        /**
+         * @brief Per-pass milliseconds from the most recently resolved frame
+         *
+         * Values lag the current frame by the frames-in-flight count.
+         */
+        const std::vector<PassTiming>& getTimings() const { return m_resolved; }
+
+        bool isSupported() const { return m_supported; }
+
+    private:
+        GpuProfiler() = default;
+
+        static constexpr uint32_t kMaxScopes = 32;
+
+        struct FrameQueries {
+            VkQueryPool pool = VK_NULL_HANDLE;
+            std::vector<std::string> scopeNames;
+            uint32_t scopeCount = 0;
+            bool hasResults = false;
+        };
+
+        void resolve(FrameQueries& frame);
+
+        VkDevice m_device = VK_NULL_HANDLE;
+        double m_timestampPeriodNs = 0.0;
+        bool m_supported = false;
+
+        std::vector<FrameQueries> m_frames;
+        uint32_t m_activeFrame = 0;
+        std::vector<uint32_t> m_scopeStack;
+
+        std::vector<PassTiming> m_resolved;
+    };
+
+} // namespace vkeng
@@ -0,0 +1,193 @@
+/**
+ * @file MeshletRenderer.hpp
+ * @brief Experimental mesh-shading draw path with per-meshlet GPU culling
+ *
+ * The classic pipeline feeds every index of a bound mesh through the
+ * vertex stage; for photogrammetry scans running tens of millions of
+ * triangles that is the bottleneck even after LOD selection. This module
+ * draws meshes through VK_EXT_mesh_shader instead: a task shader tests
+ * each import-time meshlet (see resources/MeshletBuilder.hpp) against the
+ * frustum and its backface cone on the GPU, and only surviving clusters
+ * expand into triangles.
+ *
+ * Key Meshlet-Path Concepts:
+ * - Opt-In & Fallback: Renderer::enableMeshShading() activates the path
+ *   on devices reporting supportsMeshShading(); everywhere else (and for
+ *   meshes without meshlets) draws take the classic vertex pipeline
+ *   unchanged.
+ * - Own Layout: meshlet geometry binds as storage buffers (set 1) under a
+ *   per-frame camera UBO (set 0) — a layout incompatible with the shared
+ *   graphics layout, so meshlet draws record before the classic set
+ *   bindings in the main pass.
+ * - Experimental Shading: the fragment stage is a plain headlight;
+ *   materials, shadows, instancing, the depth pre-pass, and the indirect
+ *   path all stay classic-only for now.
+ * - Resident Uploads: per-mesh meshlet buffers build lazily from the
+ *   retained CPU copy on first sight and are cached for the renderer's
+ *   lifetime; meshes that already released their CPU data fall back to
+ *   the classic path.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/Camera.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/resources/Mesh.hpp"
+
+#include <glm/glm.hpp>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace vkeng {
+
+    /** @brief One mesh drawn through the meshlet path this frame. */
+    struct MeshletDraw {
+        MeshHandle mesh;           ///< Non-owning; the scene keeps the mesh alive
+        glm::mat4 model{1.0f};
+    };
+
+    /**
+     * @class MeshletRenderer
+     * @brief Owns the meshlet pipelines, per-frame camera UBOs, and the
+     *        per-mesh meshlet storage buffers.
+     *
+     * Usage (driven by the Renderer each frame):
+     * @code
+     *   meshlets.prepare(frame, viewProj, frustum, cameraPos); // build phase
+     *   meshlets.ensureMeshData(mesh);                          // build phase
+     *   meshlets.recordDraws(cmd, renderPass, extent, frame, draws, count);
+     * @endcode
+     */
+    class MeshletRenderer {
+    public:
+        /// Task-shader workgroup width; one mesh workgroup launches per
+        /// surviving meshlet of the group. Must match meshlet.task.
+        static constexpr uint32_t kTaskWorkgroupSize = 32;
+        static constexpr uint32_t kMaxMeshSets = 256; ///< Distinct meshes the path can hold
+
+        /**
+         * @brief Construct the meshlet pipeline layout and per-frame buffers.
+         * @param device Vulkan device wrapper (must support mesh shading)
+         * @param memoryManager Memory manager for UBO/SSBO creation
+         * @param pipelineManager Pipeline cache shared with the classic path
+         * @param framesInFlight Number of frames in flight (per-frame UBOs)
+         * @param shaderDir Directory with the compiled meshlet_*.spv shaders
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        MeshletRenderer(VulkanDevice& device,
+                        std::shared_ptr<MemoryManager> memoryManager,
+                        PipelineManager& pipelineManager,
+                        uint32_t framesInFlight,
+                        const std::filesystem::path& shaderDir);
+
+        ~MeshletRenderer();
+
+        MeshletRenderer(const MeshletRenderer&) = delete;
+        MeshletRenderer& operator=(const MeshletRenderer&) = delete;
+
+        /**
+         * @brief Upload this frame's camera state for task-shader culling.
+         * @param frameIndex Frame-in-flight index
+         * @param viewProj Combined view-projection matrix
+         * @param frustum Camera frustum planes (world space)
+         * @param cameraPos Camera position (world space)
+         */
+        void prepare(uint32_t frameIndex, const glm::mat4& viewProj,
+                     const Frustum& frustum, const glm::vec3& cameraPos);
+
+        /**
+         * @brief Upload (or look up) a mesh's meshlet buffers.
+         * @return True when the mesh can be drawn through the meshlet path
+         *
+         * Builds the storage buffers and descriptor set on first call from
+         * the mesh's meshlet data and retained CPU vertices. Returns false
+         * for stale handles, meshes without meshlets, with released CPU
+         * data, or once the descriptor capacity is exhausted — callers
+         * route those draws through the classic pipeline. Build-phase only
+         * (not thread-safe).
+         */
+        bool ensureMeshData(MeshHandle mesh);
+
+        /**
+         * @brief Record the meshlet draws inside the main render pass.
+         *
+         * Binds the mesh-shading pipeline (lazily rebuilt when the render
+         * pass changed) and dispatches one task workgroup per
+         * kTaskWorkgroupSize meshlets of each draw. Record before the
+         * classic descriptor bindings: this layout invalidates them.
+         */
+        void recordDraws(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                         VkExtent2D extent, uint32_t frameIndex,
+                         const MeshletDraw* draws, size_t count);
+
+    private:
+        /** @brief Camera block read by meshlet.task/.mesh/.frag (set 0). */
+        struct FrameUbo {
+            glm::mat4 viewProj;
+            glm::vec4 frustumPlanes[6]; ///< xyz = normal, w = distance
+            glm::vec4 cameraPos;
+        };
+
+        /** @brief Push block shared by the task and mesh stages. */
+        struct MeshletPush {
+            glm::mat4 model;
+            uint32_t meshletCount = 0;
+            float radiusScale = 1.0f; ///< Largest model-matrix axis scale
+            float pad0 = 0.0f;
+            float pad1 = 0.0f;
+        };
+
+        /** @brief Position + normal pair uploaded for the mesh stage (std430). */
+        struct PackedVertex {
+            glm::vec4 position;
+            glm::vec4 normal;
+        };
+
+        /** @brief GPU-resident meshlet buffers for one mesh (set 1). */
+        struct MeshData {
+            std::shared_ptr<Buffer> meshlets;
+            std::shared_ptr<Buffer> vertexIndices;
+            std::shared_ptr<Buffer> triangles; ///< Corners widened to one uint each
+            std::shared_ptr<Buffer> vertices;
+            VkDescriptorSet set = VK_NULL_HANDLE;
+            uint32_t meshletCount = 0;
+            bool valid = false;                ///< False entries cache the rejection
+        };
+
+        void ensurePipeline(VkRenderPass renderPass, VkExtent2D extent);
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+
+        std::shared_ptr<DescriptorSetLayout> m_frameSetLayout; ///< Set 0: camera UBO
+        std::shared_ptr<DescriptorSetLayout> m_meshSetLayout;  ///< Set 1: meshlet SSBOs
+        std::shared_ptr<DescriptorPool> m_framePool;
+        std::shared_ptr<DescriptorPool> m_meshPool;
+        VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+
+        PipelineConfig m_drawConfig;                  ///< Task/mesh/frag shader paths
+        std::shared_ptr<Pipeline> m_pipeline;         ///< Rebuilt when the render pass changes
+        VkRenderPass m_builtRenderPass = VK_NULL_HANDLE;
+
+        struct FrameResources {
+            std::shared_ptr<Buffer> ubo;
+            VkDescriptorSet set = VK_NULL_HANDLE;
+        };
+        std::vector<FrameResources> m_frames;         ///< One entry per frame in flight
+
+        /// Lifetime cache keyed by handle value, never evicted; generation
+        /// bits in the key keep a recycled slot from aliasing an old entry
+        std::unordered_map<uint32_t, MeshData> m_meshData;
+        bool m_meshPoolExhausted = false;             ///< Logged once, then classic fallback
+
+        PFN_vkCmdDrawMeshTasksEXT m_cmdDrawMeshTasks = nullptr;
+    };
+
+} // namespace vkeng
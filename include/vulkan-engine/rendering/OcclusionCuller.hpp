@@ -0,0 +1,197 @@
+/**
+ * @file OcclusionCuller.hpp
+ * @brief GPU occlusion culling with a hierarchical depth pyramid and indirect draws
+ *
+ * The OcclusionCuller moves per-instance visibility off the CPU: instanced
+ * batch candidates are tested on the GPU against a mip-chain depth pyramid
+ * (HiZ) built from the previous frame's depth buffer, and survivors write
+ * themselves into indirect draw commands. The CPU never learns which
+ * instances were culled — it records one vkCmdDrawIndexedIndirect per batch
+ * and the GPU fills in the instance count.
+ *
+ * Key Concepts:
+ * - Depth Pyramid (HiZ): R32F mip chain where each texel holds the MAX depth
+ *   of its 2x2 footprint in the level below. Max is the conservative
+ *   reduction for a LESS depth test: an object is occluded only if it is
+ *   behind the farthest depth anywhere in its screen footprint.
+ * - One-Frame Latency: the pyramid is rebuilt after each main pass from that
+ *   frame's depth buffer and consumed by the *next* frame's cull dispatch.
+ *   Disocclusion artifacts last a single frame; until the first pyramid
+ *   exists every candidate passes (the shader skips the depth test).
+ * - Indirect Compaction: the cull shader atomically bumps the batch's
+ *   instanceCount and scatters the instance's model matrix into a compacted
+ *   transform buffer, which the instanced vertex shader reads at binding 1
+ *   exactly like the CPU-uploaded instance stream.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class OcclusionCuller
+     * @brief Owns the depth pyramid and per-frame cull buffers, records the
+     *        compute dispatches that compact instanced batches on the GPU.
+     *
+     * Usage (driven by the Renderer each frame):
+     * @code
+     *   culler.prepare(frame, candidates, count, prototypes, batchCount, view, proj, near);
+     *   culler.recordCull(cmd, frame);          // before the main pass
+     *   ... main pass draws with culler.commandsBuffer(frame) ...
+     *   culler.recordPyramidBuild(cmd, depth);  // after the main pass
+     * @endcode
+     */
+    class OcclusionCuller {
+    public:
+        /** @brief One instance candidate handed to the cull shader. */
+        struct Candidate {
+            glm::mat4 model;       ///< World transform
+            glm::vec4 localSphere; ///< xyz = local-space bounds center, w = radius
+            glm::uvec4 batch;      ///< x = batch index, y = firstInstance, zw unused
+        };
+
+        /**
+         * @brief Construct the culler and its GPU resources.
+         * @param device Vulkan device wrapper
+         * @param memoryManager Memory manager for buffer/image creation
+         * @param pipelineManager Pipeline cache providing the compute pipelines
+         * @param framesInFlight Number of frames in flight (per-frame buffers)
+         * @param shaderDir Directory holding the compiled compute shaders
+         *        (depth_pyramid.spv, occlusion_cull.spv)
+         * @param depthWidth Current depth buffer width (pyramid sizing)
+         * @param depthHeight Current depth buffer height
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        OcclusionCuller(VulkanDevice& device,
+                        std::shared_ptr<MemoryManager> memoryManager,
+                        PipelineManager& pipelineManager,
+                        uint32_t framesInFlight,
+                        const std::filesystem::path& shaderDir,
+                        uint32_t depthWidth, uint32_t depthHeight);
+
+        ~OcclusionCuller();
+
+        OcclusionCuller(const OcclusionCuller&) = delete;
+        OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+        /**
+         * @brief Recreate the depth pyramid after a swapchain resize.
+         * @note Caller must ensure the device is idle. Resets the pyramid-ready
+         *       flag, so the next cull pass skips the depth test.
+         */
+        void resize(uint32_t depthWidth, uint32_t depthHeight);
+
+        /**
+         * @brief Upload this frame's candidates, command prototypes, and uniforms.
+         * @param frameIndex Frame-in-flight index
+         * @param candidates Instance candidates (all instances of all batches)
+         * @param candidateCount Number of candidates
+         * @param commands Per-batch indirect command prototypes with instanceCount = 0
+         * @param commandCount Number of batches
+         * @param view Camera view matrix
+         * @param proj Camera projection matrix
+         * @param nearPlane Camera near plane distance
+         *
+         * Buffers grow on demand; growth only happens when the instanced scene
+         * gets bigger, so steady-state frames never allocate.
+         */
+        void prepare(uint32_t frameIndex,
+                     const Candidate* candidates, uint32_t candidateCount,
+                     const VkDrawIndexedIndirectCommand* commands, uint32_t commandCount,
+                     const glm::mat4& view, const glm::mat4& proj, float nearPlane);
+
+        /**
+         * @brief Record the cull dispatch (call outside any render pass, before the main pass).
+         *
+         * Emits the compute dispatch plus the barrier making the command and
+         * transform writes visible to DRAW_INDIRECT and vertex attribute reads.
+         */
+        void recordCull(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+        /**
+         * @brief Record the depth pyramid rebuild (call after the main pass ends).
+         * @param depthImage The swapchain depth buffer just written by the main pass
+         *
+         * Transitions the depth buffer to SHADER_READ_ONLY, max-reduces it
+         * through every pyramid mip, then returns it to
+         * DEPTH_STENCIL_ATTACHMENT_OPTIMAL for the next frame's render pass.
+         */
+        void recordPyramidBuild(VkCommandBuffer commandBuffer,
+                                const std::shared_ptr<Image>& depthImage);
+
+        /** @brief Indirect command buffer for the given frame (one VkDrawIndexedIndirectCommand per batch). */
+        VkBuffer commandsBuffer(uint32_t frameIndex) const;
+        /** @brief GPU-compacted instance transform buffer for the given frame (bind at vertex binding 1). */
+        VkBuffer transformsBuffer(uint32_t frameIndex) const;
+        /** @brief Stride between per-batch commands in the indirect buffer. */
+        static constexpr VkDeviceSize commandStride() { return sizeof(VkDrawIndexedIndirectCommand); }
+
+    private:
+        /** @brief Uniform block consumed by occlusion_cull.comp (binding 4). */
+        struct CullUniforms {
+            glm::mat4 view;
+            glm::mat4 proj;
+            glm::vec4 pyramidInfo; ///< xy = mip 0 size, z = mip count, w = pyramid ready flag
+            glm::vec4 params;      ///< x = near plane, y = candidate count
+        };
+
+        /** @brief Per-frame-in-flight cull buffers and their descriptor set. */
+        struct FrameResources {
+            std::shared_ptr<Buffer> candidates; ///< Host-visible SSBO of Candidate
+            std::shared_ptr<Buffer> commands;   ///< Host-visible indirect + storage buffer
+            std::shared_ptr<Buffer> transforms; ///< Device-local storage + vertex buffer
+            std::shared_ptr<Buffer> uniforms;   ///< Host-visible CullUniforms
+            VkDescriptorSet cullSet = VK_NULL_HANDLE;
+            uint32_t candidateCount = 0;        ///< Candidates uploaded this frame
+            uint32_t commandCount = 0;          ///< Batches uploaded this frame
+            bool setDirty = true;               ///< Rewrite descriptors (buffer recreated)
+        };
+
+        void createLayoutsAndPipelines(const std::filesystem::path& shaderDir);
+        void createPyramid(uint32_t depthWidth, uint32_t depthHeight);
+        void destroyPyramid();
+        void growFrameBuffers(FrameResources& frame, uint32_t candidateCount, uint32_t commandCount);
+        void updateCullDescriptors(FrameResources& frame);
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+        uint32_t m_framesInFlight;
+
+        // ====================================================================
+        // Depth Pyramid
+        // ====================================================================
+
+        std::shared_ptr<Image> m_pyramid;            ///< R32F mip-chain image
+        std::vector<VkImageView> m_pyramidMipViews;  ///< One single-mip view per level (raw; pyramid image owns memory)
+        VkSampler m_reduceSampler = VK_NULL_HANDLE;  ///< Clamp-to-edge nearest sampler for reduction and cull sampling
+        std::vector<VkDescriptorSet> m_reduceSets;   ///< Per-mip input/output sets for depth_pyramid.comp
+        VkImageView m_lastDepthView = VK_NULL_HANDLE;///< Depth view bound to mip 0's reduce set (rebind on change)
+        bool m_pyramidReady = false;                 ///< False until the first pyramid build has been recorded
+
+        // ====================================================================
+        // Pipelines and Layouts
+        // ====================================================================
+
+        std::shared_ptr<DescriptorSetLayout> m_reduceSetLayout; ///< sampler2D + storage image
+        std::shared_ptr<DescriptorSetLayout> m_cullSetLayout;   ///< 3 SSBOs + sampler + UBO
+        std::shared_ptr<DescriptorPool> m_descriptorPool;
+        VkPipelineLayout m_reducePipelineLayout = VK_NULL_HANDLE; ///< Owns push-constant range for outputSize
+        VkPipelineLayout m_cullPipelineLayout = VK_NULL_HANDLE;
+        std::shared_ptr<ComputePipeline> m_reducePipeline;
+        std::shared_ptr<ComputePipeline> m_cullPipeline;
+
+        std::vector<FrameResources> m_frames; ///< One entry per frame in flight
+    };
+
+} // namespace vkeng
@@ -37,6 +37,7 @@ public:
     OrbitCameraController(Camera& camera, InputManager& inputManager, glm::vec3 target = glm::vec3(0.0f));
 
     void update(float deltaTime) override;
+    void lateLatch() override;
     void reset() override;
 
     /** @brief Configure the home view used by reset(). */
@@ -0,0 +1,217 @@
+/**
+ * @file ParticleSystem.hpp
+ * @brief Particle simulation and rendering for ParticleEmitter components
+ *
+ * Two simulation paths behind one component interface: small emitters
+ * integrate on the CPU in SoA arrays and upload evaluated instances each
+ * frame, while emitters at or above kGpuSimThreshold simulate entirely in
+ * a compute pass over ping-ponged storage buffers that double as the draw's
+ * per-instance vertex stream — a million particles never touch the CPU.
+ *
+ * Key Concepts:
+ * - SoA CPU Simulation: positions/velocities/lifetimes in parallel float
+ *   arrays with swap-with-last death compaction, so the integrate loop
+ *   streams contiguous memory instead of hopping across particle structs.
+ * - GPU Ping-Pong: two BufferUsage::StorageVertex buffers per emitter; the
+ *   sim dispatch reads one and writes the other, then the draw binds the
+ *   written buffer directly as instance data (binding 0, per-instance
+ *   rate) — no readback, no copy. Dead particles respawn procedurally in
+ *   the shader from a per-frame seed, so the CPU never tracks them.
+ * - Slot Recycling: per-emitter particle storage lives in pooled slots; a
+ *   destroyed emitter's slot (buffers, descriptor sets) goes on a free
+ *   list and the next emitter of matching capacity reuses it without
+ *   reallocating.
+ * - Billboard Quads: particles render as camera-facing quads expanded in
+ *   particle.vert from gl_VertexIndex — six vertices per instance, no
+ *   vertex or index buffer.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/rendering/Vertex.hpp"
+
+#include <glm/glm.hpp>
+#include <array>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace vkeng {
+
+    class ParticleEmitter;
+
+    /**
+     * @class ParticleSystem
+     * @brief Simulates and draws every enabled ParticleEmitter in the scene.
+     *
+     * Usage (app steps the simulation, the Renderer records GPU work):
+     * @code
+     *   renderer.enableParticles(memoryManager, shaderDir);
+     *   node->addComponent<ParticleEmitter>();
+     *   // per frame, before drawFrame():
+     *   renderer.getParticleSystem()->update(deltaTime);
+     * @endcode
+     *
+     * update() scans the ParticleEmitter component pool, so emitters need no
+     * registration — attaching the component is enough, mirroring how the
+     * Renderer gathers Light components.
+     */
+    class ParticleSystem {
+    public:
+        /// Capacity at which an emitter simulates on the GPU instead of the CPU
+        static constexpr uint32_t kGpuSimThreshold = 65536;
+        /// Sim shader workgroup size (baked via specialization constant 0)
+        static constexpr uint32_t kSimWorkgroupSize = 256;
+        /// GPU emitter cap (sizes the descriptor pool; extra emitters fall back to CPU)
+        static constexpr uint32_t kMaxGpuEmitters = 8;
+
+        /**
+         * @brief Construct the particle pipelines and descriptor resources.
+         * @param device Vulkan device wrapper
+         * @param memoryManager Memory manager for buffer creation
+         * @param pipelineManager Pipeline cache providing the sim and draw pipelines
+         * @param framesInFlight Number of frames in flight (per-frame CPU upload buffers)
+         * @param shaderDir Directory with particle_sim.spv / particle_vert.spv / particle_frag.spv
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        ParticleSystem(VulkanDevice& device,
+                       std::shared_ptr<MemoryManager> memoryManager,
+                       PipelineManager& pipelineManager,
+                       uint32_t framesInFlight,
+                       const std::filesystem::path& shaderDir);
+
+        ~ParticleSystem();
+
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        /**
+         * @brief Step the simulation by one frame.
+         * @param deltaTime Seconds since the last update
+         *
+         * Scans the ParticleEmitter pool: new emitters acquire a slot
+         * (recycled from the free list when one of matching capacity
+         * exists), vanished or disabled emitters release theirs, and CPU
+         * emitters integrate/spawn/compact. GPU emitters only latch the
+         * frame's push-constant inputs here; their work records in
+         * recordSimulate().
+         */
+        void update(float deltaTime);
+
+        /**
+         * @brief Upload CPU-simulated instances for the given frame in flight.
+         * @param frameIndex Frame-in-flight index
+         *
+         * Evaluates the color/size ramps into ParticleInstance entries and
+         * writes them to the frame's host-visible instance buffer. Called by
+         * the Renderer before command recording; no-op for GPU emitters.
+         */
+        void prepare(uint32_t frameIndex);
+
+        /**
+         * @brief Record the GPU simulation dispatches (outside any render pass).
+         *
+         * One dispatch per GPU emitter plus the barriers making the written
+         * buffers visible to vertex fetch (this frame's draw) and compute
+         * reads (next frame's sim). First use of an emitter also records the
+         * zero-fill that marks every particle slot dead.
+         */
+        void recordSimulate(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+        /**
+         * @brief Record the particle draws inside the main render pass.
+         * @param commandBuffer Command buffer inside the main pass
+         * @param renderPass Render pass the draw pipeline must be compatible with
+         * @param extent Current swapchain extent
+         * @param frameIndex Frame-in-flight index
+         *
+         * Expects set 0 (global UBO) already bound on the shared layout, as
+         * the main pass does for scene draws. Particles blend and read depth
+         * without writing it, so this records after the opaque and
+         * transparent scene draws.
+         */
+        void recordDraw(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                        VkExtent2D extent, uint32_t frameIndex);
+
+        /** @brief Live CPU particles plus GPU pool capacities (for stats/debug). */
+        uint32_t particleCount() const;
+
+        /** @brief Number of emitters currently holding a slot. */
+        uint32_t activeEmitterCount() const { return m_activeEmitters; }
+
+    private:
+        /** @brief Push-constant block shared with particle_sim.comp. */
+        struct SimPushConstants {
+            glm::vec4 originAndDt;          ///< xyz = emitter world position, w = dt
+            glm::vec4 velocityAndSeed;      ///< xyz = mean spawn velocity, w = frame seed
+            glm::vec4 varianceAndSpawnRate; ///< xyz = velocity spread, w = particles/sec
+            glm::vec4 gravityAndCapacity;   ///< xyz = gravity, w = pool capacity
+            glm::vec4 startColor;           ///< Color ramp at spawn
+            glm::vec4 endColor;             ///< Color ramp at death
+            glm::vec4 sizeAndLifetime;      ///< x/y = size ramp, z/w = lifetime min/max
+        };
+
+        /**
+         * @brief Pooled per-emitter particle storage (CPU SoA or GPU ping-pong).
+         *
+         * Released slots keep their buffers and descriptor sets; acquire
+         * prefers a free slot of identical capacity and path so emitter
+         * churn (respawning effects) never reallocates.
+         */
+        struct EmitterSlot {
+            const ParticleEmitter* emitter = nullptr; ///< Owner, null while on the free list
+            uint32_t capacity = 0;
+            bool gpu = false;
+            bool seen = false;              ///< Scan mark; unseen slots release after the sweep
+
+            // CPU path: SoA particle state + per-frame instance uploads
+            std::vector<float> posX, posY, posZ;
+            std::vector<float> velX, velY, velZ;
+            std::vector<float> life;
+            std::vector<float> maxLife;
+            uint32_t aliveCount = 0;
+            float spawnAccum = 0.0f;        ///< Fractional spawns carried between frames
+            std::vector<std::shared_ptr<Buffer>> instanceBuffers; ///< Host-visible, one per frame in flight
+            std::vector<ParticleInstance> scratch; ///< Evaluated instances staged for upload
+
+            // GPU path: ping-pong storage buffers doubling as instance streams
+            std::array<std::shared_ptr<Buffer>, 2> simBuffers;
+            std::array<VkDescriptorSet, 2> sets = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+            uint32_t readIndex = 0;         ///< Buffer the next dispatch reads (and last written)
+            bool gpuInitialized = false;    ///< False until the dead-fill has been recorded
+            SimPushConstants pushConstants{}; ///< Latched by update(), pushed by recordSimulate()
+        };
+
+        uint32_t acquireSlot(const ParticleEmitter& emitter, const glm::vec3& origin);
+        void releaseSlot(uint32_t slotIndex);
+        void simulateCpu(EmitterSlot& slot, const ParticleEmitter& emitter,
+                         const glm::vec3& origin, float deltaTime);
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+        uint32_t m_framesInFlight;
+
+        std::shared_ptr<DescriptorSetLayout> m_simSetLayout; ///< binding 0 = read SSBO, 1 = write SSBO
+        std::shared_ptr<DescriptorPool> m_descriptorPool;
+        VkPipelineLayout m_simPipelineLayout = VK_NULL_HANDLE;
+        std::shared_ptr<ComputePipeline> m_simPipeline;
+        PipelineConfig m_drawConfig;        ///< Billboard draw variant (shared graphics layout)
+
+        std::vector<std::unique_ptr<EmitterSlot>> m_slots;
+        std::vector<uint32_t> m_freeSlots;  ///< Indices into m_slots available for reuse
+        std::unordered_map<const ParticleEmitter*, uint32_t> m_slotOf;
+        uint32_t m_activeEmitters = 0;
+        uint32_t m_gpuEmitters = 0;         ///< Active GPU slots (capped at kMaxGpuEmitters)
+
+        float m_time = 0.0f;                ///< Accumulated sim time (GPU seed input)
+        std::mt19937 m_rng{0x9E3779B9u};    ///< CPU spawn randomness (fixed seed: deterministic replays)
+    };
+
+} // namespace vkeng
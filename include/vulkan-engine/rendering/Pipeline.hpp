@@ -14,7 +14,9 @@
  */
 
 #pragma once
+#include "vulkan-engine/rendering/Vertex.hpp"
 #include <filesystem>
+#include <utility>
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <vulkan/vulkan_core.h>
@@ -49,20 +51,50 @@ namespace vkeng {
     struct PipelineConfig {
         std::filesystem::path vertShaderPath;
         std::filesystem::path fragShaderPath;
+        // Mesh-shading variants (VK_EXT_mesh_shader): when meshShaderPath is
+        // set the pipeline is built from task/mesh/fragment stages and the
+        // vertex-input fields (vertShaderPath, instanced, vertexFormat) are
+        // ignored — meshlet geometry is fetched from storage buffers.
+        std::filesystem::path taskShaderPath; ///< Optional task (culling) stage
+        std::filesystem::path meshShaderPath; ///< Mesh stage; empty = classic vertex pipeline
         BlendMode blendMode = BlendMode::Opaque;
         CullMode cullMode = CullMode::Back;
         bool depthWriteEnable = true;
         bool depthTestEnable = true;
         bool depthOnly = false;       ///< True for depth-only passes (no color attachments)
+        bool instanced = false;       ///< True to add the per-instance model matrix stream (binding 1)
+        bool skinned = false;         ///< True to add the per-vertex joint/weight stream (binding 1; exclusive with instanced)
+        VertexFormat vertexFormat = VertexFormat::Fat; ///< Vertex layout the pipeline fetches (matches the mesh)
+        bool colorWriteEnable = true; ///< False masks all color writes (depth pre-pass in a color pass)
+        bool depthCompareEqual = false; ///< Use EQUAL instead of LESS (shaded pass after a depth pre-pass)
+
+        // Fragment-stage specialization constants (constant_ids 0-2 in the
+        // shaded fragment shaders). Baked at pipeline build so the driver
+        // folds the debug/shadow branches and unrolls the light loop;
+        // changing one selects a different cached variant. Entries for
+        // shaders that do not declare the constants are ignored.
+        uint32_t specDebugMode = 0;     ///< DebugShadingMode compiled in (constant_id 0)
+        bool specShadowsEnabled = true; ///< Shadow sampling compiled in (constant_id 1)
+        uint32_t specMaxLights = 8;     ///< Light-loop upper bound (constant_id 2, matches MAX_LIGHTS)
 
         bool operator==(const PipelineConfig& other) const {
             return vertShaderPath == other.vertShaderPath
                 && fragShaderPath == other.fragShaderPath
+                && taskShaderPath == other.taskShaderPath
+                && meshShaderPath == other.meshShaderPath
                 && blendMode == other.blendMode
                 && cullMode == other.cullMode
                 && depthWriteEnable == other.depthWriteEnable
                 && depthTestEnable == other.depthTestEnable
-                && depthOnly == other.depthOnly;
+                && depthOnly == other.depthOnly
+                && instanced == other.instanced
+                && skinned == other.skinned
+                && vertexFormat == other.vertexFormat
+                && colorWriteEnable == other.colorWriteEnable
+                && depthCompareEqual == other.depthCompareEqual
+                && specDebugMode == other.specDebugMode
+                && specShadowsEnabled == other.specShadowsEnabled
+                && specMaxLights == other.specMaxLights;
         }
     };
 
@@ -71,9 +103,10 @@ namespace vkeng {
      * @brief RAII wrapper for VkPipelineCache with on-disk persistence.
      *
      * On construction, attempts to load a previously saved cache blob from
-     * @p cacheFilePath. The driver validates the blob header (vendor/device/
-     * driver IDs) and silently ignores stale or wrong-GPU data, so it is always
-     * safe to pass any on-disk blob.
+     * @p cacheFilePath. The file carries a small versioned header including the
+     * device's pipelineCacheUUID; blobs from another GPU, driver version, or
+     * file format revision are discarded up front. The driver additionally
+     * validates the blob itself, so passing any surviving data is always safe.
      *
      * On destruction, the current cache data is serialised back to the same file
      * so the next launch starts with a warm cache.
@@ -85,11 +118,15 @@ namespace vkeng {
     public:
         /**
          * @brief Creates the pipeline cache, optionally pre-populating from disk.
-         * @param device        The logical device that owns this cache.
-         * @param cacheFilePath Path to the binary cache file. Need not exist;
-         *                      a missing file is treated as a cold start.
+         * @param device         The logical device that owns this cache.
+         * @param physicalDevice Physical device whose pipelineCacheUUID keys the
+         *                       on-disk file; VK_NULL_HANDLE skips the header
+         *                       check and relies on driver-side validation only.
+         * @param cacheFilePath  Path to the binary cache file. Need not exist;
+         *                       a missing file is treated as a cold start.
          */
         explicit PipelineCache(VkDevice device,
+                               VkPhysicalDevice physicalDevice = VK_NULL_HANDLE,
                                const std::filesystem::path& cacheFilePath = "pipeline.cache");
 
         /** @brief Saves the cache data to disk, then destroys the VkPipelineCache. */
@@ -99,9 +136,11 @@ namespace vkeng {
         PipelineCache& operator=(const PipelineCache&) = delete;
 
         PipelineCache(PipelineCache&& other) noexcept
-            : m_device(other.m_device), m_cache(other.m_cache),
+            : m_device(other.m_device), m_physicalDevice(other.m_physicalDevice),
+              m_cache(other.m_cache),
               m_cacheFilePath(std::move(other.m_cacheFilePath)) {
             other.m_device = VK_NULL_HANDLE;
+            other.m_physicalDevice = VK_NULL_HANDLE;
             other.m_cache  = VK_NULL_HANDLE;
         }
 
@@ -112,10 +151,75 @@ namespace vkeng {
         void saveToDisk() noexcept;
 
         VkDevice              m_device{VK_NULL_HANDLE};
+        VkPhysicalDevice      m_physicalDevice{VK_NULL_HANDLE};
         VkPipelineCache       m_cache{VK_NULL_HANDLE};
         std::filesystem::path m_cacheFilePath;
     };
 
+    /**
+     * @struct ComputePipelineConfig
+     * @brief Everything a compute pipeline variant is built from
+     *
+     * The compute analogue of PipelineConfig: shader path, the layout the
+     * shader's bindings live in, and the specialization constants baked in
+     * at build time (workgroup sizes, feature toggles). PipelineManager
+     * caches variants keyed by all three, so the same shader specialized
+     * differently yields distinct cached pipelines.
+     */
+    struct ComputePipelineConfig {
+        std::filesystem::path compShaderPath;        ///< Compiled compute shader (SPIR-V)
+        VkPipelineLayout layout = VK_NULL_HANDLE;    ///< Layout for the shader's bindings
+        /// Specialization constants as (constantID, raw 32-bit value) pairs;
+        /// floats and bools are bit-cast into the value
+        std::vector<std::pair<uint32_t, uint32_t>> specConstants;
+    };
+
+    /**
+     * @class ComputePipeline
+     * @brief RAII wrapper for a Vulkan compute pipeline
+     *
+     * Compute pipelines are far simpler than graphics pipelines — one shader
+     * stage and a layout, no fixed-function state — so they get their own
+     * small wrapper instead of widening PipelineConfig. The layout is caller
+     * provided: compute passes (culling, depth pyramid) bind storage buffers
+     * and images that the shared graphics layout knows nothing about.
+     *
+     * @note Created through PipelineManager::getComputePipeline() for caching
+     */
+    class ComputePipeline {
+    public:
+        /**
+         * @brief Builds a compute pipeline from a SPIR-V shader file
+         * @param device Logical device for pipeline creation
+         * @param pipelineLayout Layout describing the shader's bindings
+         * @param compPath Path to the compiled compute shader (SPIR-V)
+         * @param cache Optional pipeline cache for faster recreation
+         * @param specConstants Specialization constants baked into the build
+         *        (see ComputePipelineConfig::specConstants)
+         */
+        explicit ComputePipeline(VkDevice device,
+            VkPipelineLayout pipelineLayout,
+            const std::filesystem::path& compPath,
+            VkPipelineCache cache = VK_NULL_HANDLE,
+            const std::vector<std::pair<uint32_t, uint32_t>>& specConstants = {});
+
+        ~ComputePipeline() noexcept;
+
+        ComputePipeline(const ComputePipeline&) = delete;
+        ComputePipeline& operator=(const ComputePipeline&) = delete;
+
+        /** @brief Pipeline handle for vkCmdBindPipeline (COMPUTE bind point). */
+        VkPipeline getPipeline() const { return pipeline_; }
+
+        /** @brief Layout the pipeline was built against. */
+        VkPipelineLayout getLayout() const { return layout_; }
+
+    private:
+        VkDevice device_{VK_NULL_HANDLE};
+        VkPipeline pipeline_{VK_NULL_HANDLE};
+        VkPipelineLayout layout_{VK_NULL_HANDLE};
+    };
+
     /**
      * @class Pipeline
      * @brief Manages Vulkan graphics pipeline creation and shader loading
@@ -183,6 +287,22 @@ namespace vkeng {
             VkShaderModule vertModule,
             VkShaderModule fragModule,
             VkPipelineCache cache = VK_NULL_HANDLE);
+
+        /**
+         * @brief Constructs graphics pipeline from a config and cached modules
+         *
+         * Used by PipelineManager with ShaderModuleCache-owned modules: the
+         * modules are NOT destroyed by this constructor, so many variants can
+         * share them without re-reading SPIR-V from disk.
+         */
+        explicit Pipeline(VkDevice device,
+            VkRenderPass renderPass,
+            VkPipelineLayout pipelineLayout,
+            VkExtent2D extent,
+            const PipelineConfig& config,
+            VkShaderModule vertModule,
+            VkShaderModule fragModule,
+            VkPipelineCache cache = VK_NULL_HANDLE);
             
         /**
          * @brief Destroys pipeline and associated resources
@@ -240,6 +360,8 @@ namespace vkeng {
         VkPipelineLayout getLayout() const { return layout_; }
 
         private:
+        friend class ComputePipeline; // Shares readFile() for SPIR-V loading
+
         // ============================================================================
         // Internal Pipeline Creation Methods
         // ============================================================================
@@ -275,6 +397,20 @@ namespace vkeng {
         void createGraphicsPipeline(VkShaderModule vertModule, VkShaderModule fragModule,
                                      VkPipelineCache cache, const PipelineConfig& config);
 
+        /**
+         * @brief Creates a mesh-shading pipeline (task/mesh/fragment stages)
+         * @param taskModule Optional task stage (VK_NULL_HANDLE to omit)
+         * @param meshModule Mesh shader module
+         * @param fragModule Fragment shader module
+         *
+         * Same fixed-function state as the classic path minus vertex input
+         * and input assembly, which mesh pipelines do not have. Requires the
+         * device to have been created with VK_EXT_mesh_shader enabled.
+         */
+        void createMeshShadingPipeline(VkShaderModule taskModule, VkShaderModule meshModule,
+                                        VkShaderModule fragModule,
+                                        VkPipelineCache cache, const PipelineConfig& config);
+
         // ============================================================================
         // Pipeline State
         // ============================================================================
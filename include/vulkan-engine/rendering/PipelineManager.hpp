@@ -11,11 +11,17 @@
 
 #include "vulkan-engine/rendering/Pipeline.hpp"
 #include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/ShaderModuleCache.hpp"
 #include "vulkan-engine/rendering/Uniforms.hpp"
 
+#include <atomic>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace vkeng {
 
@@ -35,14 +41,23 @@ namespace vkeng {
         /**
          * @brief Construct the manager, creating the shared pipeline layout.
          * @param device Vulkan logical device
+         * @param physicalDevice Physical device (keys the on-disk pipeline cache)
          * @param uboSetLayout Descriptor set layout for set 0 (global UBO)
          * @param textureSetLayout Descriptor set layout for set 1 (per-material textures)
          * @param shadowSetLayout Descriptor set layout for set 2 (shadow map), or VK_NULL_HANDLE to omit
+         * @param clusterSetLayout Descriptor set layout for set 3 (clustered lighting),
+         *        or VK_NULL_HANDLE to omit; requires shadowSetLayout (set numbers are positional)
+         * @param bindlessTextures True when set 1 is the bindless texture array;
+         *        extends the push constant range by BindlessPushConstants so
+         *        draws can carry texture indices (device support required)
          */
         PipelineManager(VkDevice device,
+                        VkPhysicalDevice physicalDevice,
                         VkDescriptorSetLayout uboSetLayout,
                         VkDescriptorSetLayout textureSetLayout,
-                        VkDescriptorSetLayout shadowSetLayout = VK_NULL_HANDLE);
+                        VkDescriptorSetLayout shadowSetLayout = VK_NULL_HANDLE,
+                        VkDescriptorSetLayout clusterSetLayout = VK_NULL_HANDLE,
+                        bool bindlessTextures = false);
 
         ~PipelineManager() noexcept;
 
@@ -60,6 +75,33 @@ namespace vkeng {
                                               VkRenderPass renderPass,
                                               VkExtent2D extent);
 
+        /**
+         * @brief Get or create a compute pipeline for the given shader.
+         * @param compShaderPath Path to the compiled compute shader (SPIR-V)
+         * @param layout Pipeline layout for the shader's bindings; compute
+         *        passes own their layouts (storage buffers/images differ from
+         *        the shared graphics layout)
+         * @return Shared pointer to the cached compute pipeline
+         *
+         * Cached by (path, layout) so the same shader can be built against
+         * different layouts without collision. Thread-safe like getPipeline().
+         */
+        std::shared_ptr<ComputePipeline> getComputePipeline(
+            const std::filesystem::path& compShaderPath,
+            VkPipelineLayout layout);
+
+        /**
+         * @brief Get or create a compute pipeline variant.
+         * @param config Shader, layout, and specialization constants
+         * @return Shared pointer to the cached compute pipeline
+         *
+         * Variants of the same shader with different specialization
+         * constants cache as distinct entries, so feature toggles and
+         * workgroup sizes can be baked per variant without collisions.
+         */
+        std::shared_ptr<ComputePipeline> getComputePipeline(
+            const ComputePipelineConfig& config);
+
         /** @brief Get the shared pipeline layout handle. */
         VkPipelineLayout getLayout() const { return m_pipelineLayout; }
 
@@ -74,26 +116,138 @@ namespace vkeng {
          */
         void invalidateAll();
 
+        /**
+         * @brief Compile a list of known pipeline configs on a background thread.
+         * @param configs Pipeline variants expected to be used this session
+         * @param renderPass The render pass the pipelines must be compatible with
+         * @param extent Current swapchain extent
+         *
+         * With a warm on-disk pipeline cache the driver mostly deserializes
+         * rather than compiles, so first use of each variant hits the map
+         * instead of stalling a frame. getPipeline() stays safe to call
+         * concurrently; compiles already in flight are not duplicated.
+         */
+        void prewarmAsync(std::vector<PipelineConfig> configs,
+                          VkRenderPass renderPass,
+                          VkExtent2D extent);
+
+        /** @brief Block until a pending prewarmAsync() pass has finished. */
+        void waitForPrewarm();
+
+        /**
+         * @brief Start watching shader sources and recompiling them on change.
+         * @param sourceDir Directory containing GLSL shader sources
+         * @param outputDir Directory the compiled SPIR-V blobs live in
+         *
+         * Spawns a background thread that polls the known source files'
+         * modification times. When a source changes it is recompiled with
+         * glslc on that thread (the frame loop never blocks on the compiler);
+         * on success the output path is queued for pumpShaderReloads().
+         * Missing sources (e.g. installed builds that ship only SPIR-V) are
+         * skipped. No-op if glslc is not on PATH.
+         */
+        void enableHotReload(const std::filesystem::path& sourceDir,
+                             const std::filesystem::path& outputDir);
+
+        /**
+         * @brief Swap in pipelines for any shaders recompiled since last call.
+         * @return True if any pipelines were rebuilt (device was idled)
+         *
+         * Called once per frame by the renderer, before the frame's command
+         * buffers are recorded. If the watcher queued recompiled shaders this
+         * waits for the device to go idle, invalidates the affected modules
+         * in the shader cache, and rebuilds every cached pipeline variant
+         * that references them against its original render pass. Costs one
+         * mutex check per frame when nothing changed.
+         */
+        bool pumpShaderReloads();
+
     private:
         /** @brief Hash functor for PipelineConfig. */
         struct ConfigHash {
             size_t operator()(const PipelineConfig& c) const {
                 size_t h = std::hash<std::string>{}(c.vertShaderPath.string());
                 h ^= std::hash<std::string>{}(c.fragShaderPath.string()) << 1;
+                h ^= std::hash<std::string>{}(c.taskShaderPath.string()) << 14;
+                h ^= std::hash<std::string>{}(c.meshShaderPath.string()) << 15;
                 h ^= std::hash<int>{}(static_cast<int>(c.blendMode)) << 2;
                 h ^= std::hash<int>{}(static_cast<int>(c.cullMode)) << 3;
                 h ^= std::hash<bool>{}(c.depthWriteEnable) << 4;
                 h ^= std::hash<bool>{}(c.depthTestEnable) << 5;
                 h ^= std::hash<bool>{}(c.depthOnly) << 6;
+                h ^= std::hash<bool>{}(c.instanced) << 7;
+                h ^= std::hash<int>{}(static_cast<int>(c.vertexFormat)) << 8;
+                h ^= std::hash<bool>{}(c.colorWriteEnable) << 9;
+                h ^= std::hash<bool>{}(c.depthCompareEqual) << 10;
+                h ^= std::hash<uint32_t>{}(c.specDebugMode) << 11;
+                h ^= std::hash<bool>{}(c.specShadowsEnabled) << 12;
+                h ^= std::hash<uint32_t>{}(c.specMaxLights) << 13;
+                h ^= std::hash<bool>{}(c.skinned) << 16;
+                return h;
+            }
+        };
+
+        /** @brief Cache key for compute pipelines: shader path + layout + specialization. */
+        struct ComputeKey {
+            std::string path;
+            VkPipelineLayout layout;
+            std::vector<std::pair<uint32_t, uint32_t>> specConstants;
+            bool operator==(const ComputeKey& o) const {
+                return path == o.path && layout == o.layout && specConstants == o.specConstants;
+            }
+        };
+
+        /** @brief Hash functor for ComputeKey. */
+        struct ComputeKeyHash {
+            size_t operator()(const ComputeKey& k) const {
+                size_t h = std::hash<std::string>{}(k.path) ^
+                           (std::hash<const void*>{}(k.layout) << 1);
+                for (const auto& [constantId, value] : k.specConstants) {
+                    h ^= std::hash<uint64_t>{}(
+                        (static_cast<uint64_t>(constantId) << 32) | value) + (h << 6);
+                }
                 return h;
             }
         };
 
+        /**
+         * @brief A cached pipeline plus the state needed to rebuild it.
+         *
+         * Hot reload recreates pipelines in place, and shadow variants were
+         * built against a different render pass than main-pass variants, so
+         * each entry remembers the pass and extent it was created with.
+         */
+        struct PipelineEntry {
+            std::shared_ptr<Pipeline> pipeline;
+            VkRenderPass renderPass = VK_NULL_HANDLE;
+            VkExtent2D extent{};
+        };
+
+        /** @brief A GLSL source file paired with its compiled SPIR-V output. */
+        struct WatchedShader {
+            std::filesystem::path source;
+            std::filesystem::path output;
+            std::filesystem::file_time_type lastWrite;
+        };
+
+        /** @brief Watcher thread body: polls sources and recompiles on change. */
+        void watchShaderSources();
+
         VkDevice m_device;
         VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
         std::unique_ptr<PipelineCache> m_pipelineCache;
+        std::unique_ptr<ShaderModuleCache> m_shaderModules; ///< Shared VkShaderModules, keyed by SPIR-V path
+
+        std::mutex m_pipelinesMutex; ///< Guards m_pipelines (prewarm thread vs render thread)
+        std::unordered_map<PipelineConfig, PipelineEntry, ConfigHash> m_pipelines;
+        std::unordered_map<ComputeKey, std::shared_ptr<ComputePipeline>, ComputeKeyHash> m_computePipelines;
+        std::thread m_prewarmThread; ///< Background compilation of known configs
 
-        std::unordered_map<PipelineConfig, std::shared_ptr<Pipeline>, ConfigHash> m_pipelines;
+        std::thread m_watchThread;             ///< Hot-reload filesystem poller + compiler
+        std::atomic<bool> m_watchStop{false};  ///< Signals the watcher to exit
+        std::vector<WatchedShader> m_watchedShaders; ///< Fixed after enableHotReload(); watcher-thread only
+        std::mutex m_reloadMutex;              ///< Guards m_dirtyOutputs (watcher vs render thread)
+        std::unordered_set<std::string> m_dirtyOutputs; ///< Recompiled SPIR-V paths awaiting pump
     };
 
 } // namespace vkeng
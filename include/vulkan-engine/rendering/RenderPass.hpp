@@ -43,14 +43,22 @@ namespace vkeng {
          * @param device Logical device for render pass creation
          * @param colorFormat Format of the color attachment (swapchain image format)
          * @param depthFormat Format of the depth attachment (e.g., VK_FORMAT_D32_SFLOAT)
-         * 
+         * @param colorFinalLayout Layout the color attachment transitions to when
+         *        the pass ends. PRESENT_SRC (default) for rendering straight into
+         *        the swapchain; TRANSFER_SRC_OPTIMAL for an intermediate target
+         *        that is blitted to the swapchain afterwards (dynamic resolution)
+         *
          * Creates a single-subpass render pass suitable for basic 3D rendering with:
-         * - Color attachment: CLEAR on load, STORE for output, transitions to PRESENT_SRC
+         * - Color attachment: CLEAR on load, STORE for output, transitions to @p colorFinalLayout
          * - Depth attachment: CLEAR on load, DONT_CARE on store, optimal layout
-         * 
+         *
+         * Render pass compatibility ignores layouts, so pipelines built against
+         * the PRESENT_SRC variant record unchanged inside the TRANSFER_SRC one.
+         *
          * @note Uses VK_ATTACHMENT_LOAD_OP_CLEAR for both attachments
          */
-        explicit RenderPass(VkDevice device, VkFormat colorFormat, VkFormat depthFormat);
+        explicit RenderPass(VkDevice device, VkFormat colorFormat, VkFormat depthFormat,
+                            VkImageLayout colorFinalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
         
         /**
          * @brief Destroys the render pass
@@ -63,7 +71,8 @@ namespace vkeng {
         RenderPass(const RenderPass&) = delete;
         RenderPass& operator=(const RenderPass&) = delete;
         RenderPass(RenderPass&& other) noexcept
-            : device_(other.device_), renderPass_(other.renderPass_) {
+            : device_(other.device_), renderPass_(other.renderPass_),
+              colorFormat_(other.colorFormat_), depthFormat_(other.depthFormat_) {
             other.device_ = VK_NULL_HANDLE;
             other.renderPass_ = VK_NULL_HANDLE;
         }
@@ -74,17 +83,27 @@ namespace vkeng {
                 }
                 device_ = other.device_;
                 renderPass_ = other.renderPass_;
+                colorFormat_ = other.colorFormat_;
+                depthFormat_ = other.depthFormat_;
                 other.device_ = VK_NULL_HANDLE;
                 other.renderPass_ = VK_NULL_HANDLE;
             }
             return *this;
         }
-    
+
         /** @brief Gets the raw Vulkan render pass handle for framebuffer/pipeline creation. */
         VkRenderPass get() const { return renderPass_; }
 
+        /** @brief Color attachment format this pass was built with. */
+        VkFormat getColorFormat() const { return colorFormat_; }
+
+        /** @brief Depth attachment format this pass was built with. */
+        VkFormat getDepthFormat() const { return depthFormat_; }
+
         private:
         VkDevice device_{VK_NULL_HANDLE};           ///< Logical device for resource cleanup
         VkRenderPass renderPass_{VK_NULL_HANDLE};   ///< Vulkan render pass object
+        VkFormat colorFormat_{VK_FORMAT_UNDEFINED}; ///< Color attachment format (compatibility check on resize)
+        VkFormat depthFormat_{VK_FORMAT_UNDEFINED}; ///< Depth attachment format (compatibility check on resize)
     };
 } // namespace vkeng
\ No newline at end of file
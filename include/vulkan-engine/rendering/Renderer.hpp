@@ -17,6 +17,9 @@
 #pragma once
 
 #include "vulkan-engine/core/interfaces/IWindow.hpp"
+#include "vulkan-engine/core/FrameArena.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/core/TimelineSemaphore.hpp"
 #include "vulkan-engine/core/VulkanDevice.hpp"
 #include "vulkan-engine/core/VulkanSwapChain.hpp"
 #include "vulkan-engine/rendering/Pipeline.hpp"
@@ -25,8 +28,18 @@
 #include "vulkan-engine/rendering/CommandPool.hpp"
 #include "vulkan-engine/rendering/Camera.hpp"
 #include "vulkan-engine/rendering/ShadowPass.hpp"
+#include "vulkan-engine/rendering/FrameGraph.hpp"
+#include "vulkan-engine/rendering/ClusteredLighting.hpp"
+#include "vulkan-engine/rendering/MeshletRenderer.hpp"
+#include "vulkan-engine/rendering/AnimationSystem.hpp"
+#include "vulkan-engine/rendering/ParticleSystem.hpp"
+#include "vulkan-engine/rendering/StatsOverlay.hpp"
+#include "vulkan-engine/rendering/ScreenshotCapture.hpp"
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+#include "vulkan-engine/rendering/OcclusionCuller.hpp"
 #include "vulkan-engine/rendering/Uniforms.hpp"
 #include "vulkan-engine/resources/Material.hpp"
+#include <array>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -36,7 +49,9 @@
 namespace vkeng {
     class SceneNode;
     class Mesh;
+    class MeshRenderer;
     class Buffer;
+    class MemoryManager;
 
     /**
      * @class Renderer
@@ -55,7 +70,8 @@ namespace vkeng {
      * - Synchronization: Proper CPU-GPU synchronization with fences and semaphores
      * - Swap Chain Integration: Handles presentation and swap chain recreation
      * 
-     * @note Designed for single-threaded rendering with efficient command recording
+     * @note Records single-threaded by default; setParallelRecordingEnabled() partitions
+     *       draw recording across worker threads using secondary command buffers
      * @warning Requires properly initialized Vulkan objects and valid window surface
      */
     class Renderer {
@@ -106,26 +122,331 @@ namespace vkeng {
          */
         using RecreateCallback = std::function<void(uint32_t width, uint32_t height)>;
 
+        /**
+         * @brief Callback type for late-latched input sampling.
+         * Invoked at the top of command recording, before any per-frame state
+         * is derived from the camera. The app re-polls input and lets the
+         * camera controller apply the freshest mouse movement so the view
+         * matrix uploaded this frame is as current as possible.
+         */
+        using LateLatchCallback = std::function<void()>;
+
         void setDebugShadingMode(DebugShadingMode mode) { m_debugShadingMode = mode; }
         DebugShadingMode getDebugShadingMode() const { return m_debugShadingMode; }
 
-        void setFallbackTextureDescriptorSet(VkDescriptorSet set) { m_fallbackTextureDescriptorSet = set; }
+        void setFallbackTextureDescriptorSet(VkDescriptorSet set) {
+            m_fallbackTextureDescriptorSet = set;
+            m_retainedValid = false; // Prototypes bake in the fallback set
+        }
+
+        /**
+         * @brief Enable bindless texturing with the given descriptor array (set 1).
+         *
+         * When set, every draw uses this one set — the per-draw descriptor
+         * rebind filter collapses to a single bind per frame — and draws
+         * select their textures via BindlessPushConstants pushed after the
+         * regular MeshPushConstants block. The pipeline layout must have
+         * been created with bindlessTextures = true.
+         */
+        void setBindlessTextures(VkDescriptorSet set) {
+            m_bindlessTextureSet = set;
+            m_retainedValid = false; // Prototypes bake in texture set/indices
+        }
 
         /** @brief Set the shadow pass for directional shadow mapping. */
         void setShadowPass(ShadowPass* shadowPass) { m_shadowPass = shadowPass; }
+
+        /**
+         * @brief Sample shadows rendered by another renderer instead of
+         *        recording an own shadow pass.
+         * @param primary The renderer that owns and records the shadow pass
+         *
+         * Multi-window setups share one scene across several outputs; the
+         * shadow map depends only on the light and the primary camera, so
+         * rendering it once is enough. A renderer in this mode skips cascade
+         * fitting and shadow recording and copies the primary's fitted
+         * cascades each frame, so its draws sample with the exact matrices
+         * the map was rendered with. The primary's drawFrame() must run
+         * earlier in the frame, and a shadow descriptor set for the shared
+         * map must still be bound via setShadowDescriptorSet().
+         */
+        void shareShadowsFrom(const Renderer& primary) {
+            m_shadowPass = primary.m_shadowPass;
+            m_shadowSource = &primary;
+        }
         /** @brief Set the descriptor set for the shadow map (set 2). */
         void setShadowDescriptorSet(VkDescriptorSet set) { m_shadowDescriptorSet = set; }
+        /**
+         * @brief Push the shadow map (set 2) per-draw instead of binding a set.
+         *
+         * Requires the pipeline layout's set-2 layout to have been created
+         * as a push-descriptor layout (VK_KHR_push_descriptor). The shadow
+         * map image info is then recorded straight into the command buffer
+         * each frame — no descriptor set to allocate, and nothing to
+         * re-point when the shadow map is recreated. Falls back to bound
+         * sets (with a warning) when the function pointer cannot resolve.
+         */
+        void enableShadowPushDescriptors();
         /** @brief Set the shadow pipeline config (depth-only, front-face cull). */
         void setShadowPipelineConfig(const PipelineConfig& config) { m_shadowConfig = config; }
 
+        /**
+         * @brief Enable instanced rendering for repeated mesh/material pairs.
+         * @param memoryManager Memory manager used for per-frame instance buffers
+         * @param instancedConfig Pipeline config using the instanced vertex shader
+         *
+         * When enabled, collected opaque draw calls sharing the same mesh,
+         * material bindings, and material factors are merged into a single
+         * drawIndexed with instanceCount > 1. Per-instance model matrices are
+         * uploaded into a per-frame host-visible instance buffer each frame.
+         */
+        void enableInstancing(std::shared_ptr<MemoryManager> memoryManager,
+                              const PipelineConfig& instancedConfig);
+        /** @brief Check if instanced rendering is enabled. */
+        bool isInstancingEnabled() const { return m_instancingEnabled; }
+
+        /**
+         * @brief Enable a depth-only pre-pass so opaque pixels shade once.
+         * @param prePassConfig Pipeline config for the pre-pass: the regular
+         *        vertex shader paired with the trivial depth_prepass fragment
+         *        shader (depth must rasterize identically in both passes)
+         *
+         * Opaque singles are laid down depth-only (color writes masked) at
+         * the start of the main pass, then shaded with an EQUAL depth test
+         * so the heavy fragment shader runs exactly once per visible pixel.
+         * Worth it for high-overdraw scenes; vertex-bound scenes pay the
+         * second geometry pass for nothing, so this is opt-in per scene
+         * (Config::render.depthPrePass). Alpha-mask, alpha-blend, and
+         * instanced draws are excluded and render as before.
+         */
+        void enableDepthPrePass(const PipelineConfig& prePassConfig);
+        /** @brief Check if the depth pre-pass is enabled. */
+        bool isDepthPrePassEnabled() const { return m_depthPrePassEnabled; }
+
+        /**
+         * @brief Enable the indirect multi-draw backend for collected draws.
+         * @param memoryManager Memory manager for the per-frame draw buffers
+         * @param indirectConfig Pipeline config using the indirect shaders
+         *        (shader_indirect.vert / shader_indirect.frag)
+         *
+         * Per-draw MeshPushConstants data moves into a GpuDrawData storage
+         * buffer (set 0, binding 1) indexed by gl_DrawID, and sorted draws
+         * are packed into VkDrawIndexedIndirectCommand runs — one
+         * vkCmdDrawIndexedIndirect per pipeline bucket, with pooled meshes
+         * from the same block merged into a single bucket. CPU cost per
+         * draw drops to writing one record into a mapped buffer.
+         *
+         * Requires VulkanDevice::supportsIndirectDraws(), bindless
+         * texturing (one texture set for every draw), and the app's set-0
+         * layout to declare binding 1 as a storage buffer. The depth
+         * pre-pass is bypassed while this path is active: its EQUAL test
+         * would pair depth laid down by a different vertex shader.
+         */
+        void enableIndirectDraws(std::shared_ptr<MemoryManager> memoryManager,
+                                 const PipelineConfig& indirectConfig);
+        /** @brief Check if the indirect multi-draw backend is enabled. */
+        bool isIndirectDrawsEnabled() const { return m_indirectEnabled; }
+        /** @brief Number of indirect buckets issued last frame. */
+        uint32_t getIndirectBucketCount() const { return m_indirectBucketCount; }
+
+        /**
+         * @brief Enable GPU occlusion culling for instanced batches.
+         * @param shaderDir Directory with the compiled compute shaders
+         *        (depth_pyramid.spv, occlusion_cull.spv)
+         *
+         * Instanced batch candidates are tested on the GPU against a depth
+         * pyramid built from the previous frame's depth buffer; survivors are
+         * compacted into indirect draw commands, so occluded instances cost
+         * neither vertex work nor CPU time. Requires enableInstancing() first.
+         * Non-instanced singles still rely on CPU frustum culling only.
+         */
+        void enableOcclusionCulling(const std::filesystem::path& shaderDir);
+        /** @brief Check if GPU occlusion culling is enabled. */
+        bool isOcclusionCullingEnabled() const { return m_occlusionCuller != nullptr; }
+
+        /**
+         * @brief Enable clustered forward lighting (scales past MAX_LIGHTS).
+         * @param memoryManager Memory manager for the light/cluster buffers
+         * @param shaderDir Directory with the compiled light_cluster.spv
+         *
+         * Lights are collected into a storage buffer (up to
+         * ClusteredLighting::kMaxLights) and binned into a froxel grid by a
+         * compute pass each frame; pipelines using shader_clustered.frag read
+         * only their cluster's light list. Requires the app to have passed
+         * ClusteredLighting::createSetLayout() to the PipelineManager so the
+         * shared layout includes set 3. The GlobalUbo light array is no
+         * longer filled while clustered lighting is active.
+         */
+        void enableClusteredLighting(std::shared_ptr<MemoryManager> memoryManager,
+                                     const std::filesystem::path& shaderDir);
+        /** @brief Check if clustered lighting is enabled. */
+        bool isClusteredLightingEnabled() const { return m_clusteredLighting != nullptr; }
+
+        /**
+         * @brief Enable the experimental meshlet (mesh shading) draw path.
+         * @param memoryManager Memory manager for the meshlet buffers
+         * @param shaderDir Directory with the compiled meshlet_*.spv shaders
+         *
+         * Opaque draws whose meshes carry import-time meshlets (see
+         * MeshletBuilder) are routed through VK_EXT_mesh_shader task/mesh
+         * pipelines with per-meshlet GPU frustum and backface-cone culling;
+         * everything else keeps the classic vertex path. A no-op with a
+         * warning on devices without supportsMeshShading(). Meshlet draws
+         * skip the depth pre-pass, instancing, the indirect path, and
+         * frames recorded through parallel command recording — dense-scan
+         * geometry is exactly the case none of those help.
+         */
+        void enableMeshShading(std::shared_ptr<MemoryManager> memoryManager,
+                               const std::filesystem::path& shaderDir);
+        /** @brief Check if the meshlet path is active. */
+        bool isMeshShadingEnabled() const { return m_meshletRenderer != nullptr; }
+
+        /**
+         * @brief Enable skeletal animation with GPU skinning.
+         * @param memoryManager Memory manager for palette and skin buffers
+         * @param shaderDir Directory with the compiled skinned_*.spv shaders
+         *
+         * Animated instances register directly with the AnimationSystem
+         * (bones never become SceneNodes); poses evaluate on the job
+         * system with the SIMD batch kernels and skinning happens in
+         * skinned.vert from a per-frame joint palette SSBO. The app steps
+         * playback by calling getAnimationSystem()->update() once per
+         * frame. Skinned draws are skipped while parallel command
+         * recording is active for a frame, like the other inline paths.
+         */
+        void enableSkinning(std::shared_ptr<MemoryManager> memoryManager,
+                            const std::filesystem::path& shaderDir);
+        /** @brief The animation system, or null when skinning is disabled. */
+        AnimationSystem* getAnimationSystem() const { return m_animationSystem.get(); }
+
+        /**
+         * @brief Enable particle simulation and rendering for ParticleEmitter components.
+         * @param memoryManager Memory manager for the particle buffers
+         * @param shaderDir Directory with the compiled particle shaders
+         *
+         * drawFrame() records the compute simulation before the frame graph
+         * and the blended billboard draws at the end of the main pass. The
+         * app steps the simulation by calling getParticleSystem()->update()
+         * once per frame. Particle draws are skipped while parallel command
+         * recording is active for a frame (the main pass records through
+         * secondary buffers, which the particle path does not target).
+         */
+        void enableParticles(std::shared_ptr<MemoryManager> memoryManager,
+                             const std::filesystem::path& shaderDir);
+        /** @brief The particle system, or null when particles are disabled. */
+        ParticleSystem* getParticleSystem() const { return m_particleSystem.get(); }
+
+        /**
+         * @brief Enable the in-engine stats overlay (FPS, frame graph, draws, VRAM).
+         * @param memoryManager Memory manager (buffers, atlas, and the VRAM gauge source)
+         * @param shaderDir Directory with the compiled overlay shaders
+         *
+         * The overlay records at the very end of the main pass (after
+         * particles) and is cheap enough to leave on in production: one
+         * persistently mapped vertex refill and one draw. Toggle it at
+         * runtime through getStatsOverlay()->setVisible(). Not drawn while
+         * parallel command recording is active for a frame.
+         */
+        void enableStatsOverlay(std::shared_ptr<MemoryManager> memoryManager,
+                                const std::filesystem::path& shaderDir);
+        /** @brief The stats overlay, or null when disabled. */
+        StatsOverlay* getStatsOverlay() const { return m_statsOverlay.get(); }
+
+        /**
+         * @brief Pre-bake pipeline variants for every material in a subtree.
+         * @param subtree Root of the freshly loaded scene (sub)graph
+         *
+         * Walks the subtree, derives the pipeline variant each MeshRenderer's
+         * material/mesh pairing will request (including depth pre-pass and
+         * instanced variants), and hands the deduplicated list to
+         * PipelineManager::prewarmAsync. Call after SceneSerializer::loadScene
+         * (or after attaching a streamed-in section) and before the subtree
+         * becomes visible, so first use hits the cache instead of compiling
+         * mid-frame.
+         */
+        void prebakeScenePipelines(const SceneNode& subtree);
+
+        /**
+         * @brief Enable asynchronous screenshot / video-frame capture.
+         * @param memoryManager Memory manager for the readback buffers
+         * @param outputDir Directory PNG captures are written to
+         *
+         * Captured frames are copied to host memory on the GPU and encoded
+         * on a background thread — no vkDeviceWaitIdle, no dropped frames.
+         * Trigger captures through getScreenshotCapture().
+         */
+        void enableScreenshotCapture(std::shared_ptr<MemoryManager> memoryManager,
+                                     const std::filesystem::path& outputDir);
+        /** @brief The capture service, or null when disabled. */
+        ScreenshotCapture* getScreenshotCapture() const { return m_screenshotCapture.get(); }
+        /** @brief Number of instanced batches issued last frame. */
+        uint32_t getInstancedBatchCount() const { return m_renderPacket->instancedBatchCount; }
+        /** @brief Number of draws folded into instanced batches last frame. */
+        uint32_t getInstancedDrawCount() const { return m_renderPacket->instancedDrawCount; }
+        /** @brief Milliseconds the last frame blocked acquiring a swapchain image
+         *  (zero when the acquire-ahead from the previous present covered it). */
+        float getAcquireWaitMs() const { return m_lastAcquireWaitMs; }
+        /** @brief Milliseconds the last frame blocked in present plus, when
+         *  VK_KHR_present_wait is active, waiting for the previous present to
+         *  actually reach the display. */
+        float getPresentWaitMs() const { return m_lastPresentWaitMs; }
+
+        /**
+         * @brief Enable dynamic resolution scaling driven by GPU frame time.
+         * @param memoryManager Memory manager for the internal render targets
+         * @param minScale Lower bound for the per-axis resolution scale
+         * @param targetGpuMs GPU frame time the controller steers toward
+         *
+         * The main pass renders into an internal color/depth target and the
+         * result is blitted (upsampled) to the swapchain image at present
+         * resolution. A smoothed GPU frame time from the GpuProfiler steps
+         * the scale between @p minScale and 1.0: over budget shrinks the
+         * render extent, comfortable headroom grows it back. Geometry cost
+         * is unaffected — this trades fragment work for resolution, so it
+         * only helps fill-rate-bound scenes. No-op without profiler support
+         * (the scale just stays at 1.0, still through the blit path).
+         */
+        void enableDynamicResolution(std::shared_ptr<MemoryManager> memoryManager,
+                                     float minScale = 0.5f, float targetGpuMs = 14.0f);
+        /** @brief Current dynamic resolution scale (1.0 when disabled). */
+        float getRenderScale() const { return m_renderScale; }
+
+        /**
+         * @brief Enable or disable multi-threaded command buffer recording.
+         * @param enabled True to partition draw recording across worker threads
+         *
+         * When enabled, the main pass records the collected draw-call list into
+         * secondary command buffers on worker threads (one CommandPool each),
+         * stitched into the primary with vkCmdExecuteCommands. Falls back to
+         * single-threaded inline recording for small draw counts where thread
+         * dispatch overhead would exceed the recording cost.
+         */
+        void setParallelRecordingEnabled(bool enabled) { m_parallelRecordingEnabled = enabled; }
+        /** @brief Check if multi-threaded command recording is enabled. */
+        bool isParallelRecordingEnabled() const { return m_parallelRecordingEnabled; }
+
         /** @brief Enable or disable frustum culling. */
         void setCullingEnabled(bool enabled) { m_cullingEnabled = enabled; }
         /** @brief Check if frustum culling is enabled. */
         bool isCullingEnabled() const { return m_cullingEnabled; }
+
+        /**
+         * @brief Enable or disable the per-frame draw sort (benchmark knob).
+         *
+         * Disabling skips sortDrawCalls() so draws are issued in collection
+         * order: redundant-bind elimination stops matching, opaque draws lose
+         * their front-to-back overdraw ordering, instance/indirect batching
+         * finds fewer adjacent runs, and transparent layering may be wrong.
+         * Exists so stress runs can measure what the sort buys on a given
+         * scene and driver; not meant to ship disabled.
+         */
+        void setDrawSortingEnabled(bool enabled) { m_drawSortingEnabled = enabled; }
+        /** @brief Check if the per-frame draw sort is enabled. */
+        bool isDrawSortingEnabled() const { return m_drawSortingEnabled; }
         /** @brief Get the number of meshes drawn last frame. */
-        uint32_t getDrawnCount() const { return m_drawnCount; }
+        uint32_t getDrawnCount() const { return m_renderPacket->drawnCount; }
         /** @brief Get the number of meshes culled last frame. */
-        uint32_t getCulledCount() const { return m_culledCount; }
+        uint32_t getCulledCount() const { return m_renderPacket->culledCount; }
 
         /**
          * @brief Sets the callback for swapchain recreation.
@@ -133,12 +454,18 @@ namespace vkeng {
          */
         void setRecreateCallback(RecreateCallback callback) { m_recreateCallback = callback; }
 
+        /**
+         * @brief Sets the callback for late-latched input sampling.
+         * @param callback Function to call just before camera state is consumed
+         */
+        void setLateLatchCallback(LateLatchCallback callback) { m_lateLatchCallback = callback; }
+
         /**
          * @brief Renders a complete frame to the swap chain
          * @param rootNode Root of the scene graph to render
          * @param camera Camera providing view and projection matrices
          * @param descriptorSets Per-frame descriptor sets for shader resources
-         * @param uniformBuffers Per-frame uniform buffers for shader constants
+         * @param globalUbo Persistently-mapped per-frame uniform buffer for shader constants
          * 
          * This method performs the complete frame rendering process:
          * 1. Polls for window resize (WSL2 compatibility)
@@ -152,7 +479,63 @@ namespace vkeng {
          */
         void drawFrame(SceneNode& rootNode, Camera& camera,
                          const std::vector<VkDescriptorSet>& descriptorSets,
-                         const std::vector<std::shared_ptr<Buffer>>& uniformBuffers);
+                         const PerFrameUniformBuffer& globalUbo);
+
+        // ============================================================================
+        // Two-Phase Frame Pipeline (update thread / render thread)
+        // ============================================================================
+
+        /**
+         * @brief All per-frame draw state the record/submit phase consumes.
+         *
+         * Built by buildFramePacket() on the update thread, read by
+         * submitFramePacket() — possibly on a render thread a frame behind.
+         * Two instances alternate, so building packet N+1 never touches the
+         * state packet N is being recorded from; the arena-backed lists
+         * inside rely on FrameArena's double-buffered reset for the same
+         * one-extra-frame lifetime. Defined below with the types it holds.
+         */
+        struct FramePacket;
+
+        /**
+         * @brief Phase 1: everything that reads the scene graph and camera.
+         * @return The packet to submit, or null when the frame was skipped
+         *         (swapchain recreation)
+         *
+         * Flushes transforms, waits this slot's previous GPU work, collects
+         * lights and draws, fits shadow cascades, uploads the global UBO,
+         * instance matrices, and indirect commands, and snapshots the
+         * result. After it returns the scene graph may be freely mutated —
+         * nothing in submitFramePacket() touches it. Must be called on the
+         * thread that owns the scene (the engine update thread).
+         */
+        const FramePacket* buildFramePacket(SceneNode& rootNode, Camera& camera,
+                                            const std::vector<VkDescriptorSet>& descriptorSets,
+                                            const PerFrameUniformBuffer& globalUbo);
+
+        /**
+         * @brief Phase 2: acquire, record, submit, and present one packet.
+         *
+         * Reads only the packet and renderer-internal GPU state, so it may
+         * run on a dedicated render thread while the update thread builds
+         * the next packet. Swapchain loss during acquire/present does not
+         * recreate here — it flags the resize and drops the frame, and the
+         * next buildFramePacket() recreates on the update thread (after the
+         * recreate-sync callback has drained the render thread).
+         */
+        void submitFramePacket(const FramePacket& packet);
+
+        /**
+         * @brief Sets a callback invoked just before swapchain recreation.
+         * @param callback Function that must block until the render thread
+         *                 has finished the in-flight submitFramePacket()
+         *
+         * Only needed by apps running the two-phase pipeline across
+         * threads; single-threaded drawFrame() callers can ignore it.
+         */
+        void setRecreateSyncCallback(std::function<void()> callback) {
+            m_recreateSyncCallback = std::move(callback);
+        }
 
     private:
         // ============================================================================
@@ -168,7 +551,36 @@ namespace vkeng {
          * @note Called during initialization and after swap chain recreation
          */
         void createFramebuffers();
-        
+
+        /**
+         * @brief (Re)creates the internal dynamic-resolution render targets
+         *
+         * Allocates one color image per frame in flight plus a shared depth
+         * buffer at the swapchain extent, and framebuffers against the
+         * TRANSFER_SRC render pass variant. The scale never reallocates —
+         * lower resolutions render into a sub-rect via viewport/scissor.
+         *
+         * @note Called from enableDynamicResolution() and after swap chain recreation
+         */
+        void createScaledTargets();
+
+        /** @brief Destroys the dynamic-resolution framebuffers and images. */
+        void destroyScaledTargets();
+
+        /**
+         * @brief Steps the resolution scale from smoothed GPU frame time
+         *
+         * Reads the GpuProfiler's resolved per-pass timings (which lag by
+         * the frames-in-flight count), folds them into an exponential
+         * moving average, and nudges m_renderScale down when over the
+         * target or back up when there is comfortable headroom. A hold
+         * counter between steps keeps the scale from oscillating.
+         */
+        void updateRenderScale();
+
+        /** @brief Swapchain extent scaled by m_renderScale, aligned to even pixels. */
+        VkExtent2D scaledExtent() const;
+
         /**
          * @brief Allocates command buffers for multi-frame rendering
          * 
@@ -180,10 +592,11 @@ namespace vkeng {
         /**
          * @brief Creates synchronization objects for frame coordination
          * 
-         * Creates semaphores and fences for each frame in flight:
+         * Creates the frame timeline semaphore (when supported) plus the
+         * binary semaphores each frame in flight needs for presentation:
          * - imageAvailableSemaphore: Signals when swap chain image is ready
          * - renderFinishedSemaphore: Signals when rendering is complete
-         * - inFlightFence: CPU-GPU synchronization for frame completion
+         * - inFlightFence: Fallback CPU-GPU sync when timelines are unavailable
          */
         void createSyncObjects();
         
@@ -199,15 +612,27 @@ namespace vkeng {
          * @param camera Camera to update aspect ratio for
          * 
          * Handles swap chain recreation when window is resized. This includes:
-         * - Waiting for device idle
+         * - Waiting for this renderer's frames in flight (not device idle —
+         *   the transfer queue and async uploads keep running)
          * - Destroying old framebuffers
-         * - Recreating swap chain with new dimensions
+         * - Recreating swap chain with new dimensions (old one retired via
+         *   oldSwapchain and destroyed once pending presents cycle out)
          * - Calling the recreate callback for app-level resource recreation
          * - Updating camera aspect ratio
          * - Recreating framebuffers
          */
         void recreateSwapChain(Camera& camera);
-        
+
+        /**
+         * @brief Consumes a pending acquire-ahead before swapchain recreation
+         *
+         * A pre-acquired image leaves its slot's imageAvailableSemaphore
+         * signaled with no submit queued to wait on it; an empty submission
+         * unsignals it so the semaphore is reusable against the new
+         * swapchain. Runs after the frame drain in recreateSwapChain().
+         */
+        void drainPreAcquiredImage();
+
         // ============================================================================
         // Frame Rendering Implementation
         // ============================================================================
@@ -216,33 +641,46 @@ namespace vkeng {
          * @brief Records rendering commands into a command buffer
          * @param commandBuffer Command buffer to record into
          * @param imageIndex Current swap chain image index
-         * @param rootNode Root scene node for hierarchical rendering
-         * @param camera Camera for view/projection matrices
-         * @param descriptorSets Descriptor sets for shader resource binding
-         * @param uniformBuffers Uniform buffers for constant data
-         * 
-         * Records all rendering commands for the current frame including:
+         * @param packet Sealed frame packet produced by buildFramePacket()
+         *
+         * Records all rendering commands for the packet's frame including:
          * - Render pass begin/end
          * - Pipeline binding
          * - Dynamic viewport and scissor setup
          * - Descriptor set binding
-         * - Scene traversal and mesh rendering
+         * - Draw submission from the packet's sorted draw lists
+         *
+         * Reads only the packet and render-side members — never the scene
+         * graph or camera — so it is safe to run on a render thread while
+         * the update thread builds the next packet.
          */
-        void recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, SceneNode& rootNode, Camera& camera,
-                                 const std::vector<VkDescriptorSet>& descriptorSets,
-                                 const std::vector<std::shared_ptr<Buffer>>& uniformBuffers);
-        
+        void recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex,
+                                 const FramePacket& packet);
+
+        /**
+         * @brief Binds or pushes the shadow map descriptor (set 2)
+         * @param commandBuffer Command buffer being recorded
+         * @param layout Pipeline layout to bind against
+         *
+         * No-op when shadows are disabled. In push mode the shadow map
+         * image info is recorded directly; otherwise the pre-written
+         * descriptor set is bound.
+         */
+        void bindShadowSet(VkCommandBuffer commandBuffer, VkPipelineLayout layout) const;
+
         /**
          * @brief Updates uniform buffer with camera matrices for current frame
          * @param currentImage Current frame index for multi-frame rendering
          * @param camera Camera providing view and projection matrices
-         * @param uniformBuffers Vector of per-frame uniform buffers to update
-         * 
-         * Updates the uniform buffer for the current frame with the GlobalUbo
-         * structure containing view, projection, and view-projection matrices.
+         * @param globalUbo Per-frame uniform buffer to update
+         *
+         * Writes the current frame's region of the persistently-mapped
+         * uniform buffer with the GlobalUbo structure containing view,
+         * projection, and view-projection matrices — a direct memcpy, no
+         * map/unmap and no flush on coherent memory.
          */
         void updateGlobalUbo(uint32_t currentImage, Camera& camera,
-                                 const std::vector<std::shared_ptr<Buffer>>& uniformBuffers);
+                                 const PerFrameUniformBuffer& globalUbo);
 
         void renderNode(VkCommandBuffer commandBuffer, const SceneNode& node);
 
@@ -251,7 +689,7 @@ namespace vkeng {
          * @param root Root node to traverse
          * @param outLights Output vector of GPU light structs (capped at MAX_LIGHTS)
          */
-        void collectLights(const SceneNode& root, std::vector<GpuLight>& outLights);
+        void collectLights(const SceneNode& root, FrameVector<GpuLight>& outLights);
 
         // ============================================================================
         // Core Vulkan Object References
@@ -265,6 +703,7 @@ namespace vkeng {
         PipelineConfig m_defaultConfig;                 ///< Default (opaque) pipeline config
 
         RecreateCallback m_recreateCallback;            ///< Callback invoked during swapchain recreation
+        LateLatchCallback m_lateLatchCallback;          ///< Callback for late-latched input sampling
 
         // ============================================================================
         // Rendering Resources
@@ -273,7 +712,22 @@ namespace vkeng {
         std::unique_ptr<CommandPool> m_commandPool;         ///< Command pool for buffer allocation
         std::vector<VkFramebuffer> m_swapChainFramebuffers; ///< Framebuffers for each swap chain image
         bool m_framebufferResized = false;                  ///< Flag indicating pending resize
-        
+
+        // ============================================================================
+        // Dynamic Resolution Scaling
+        // ============================================================================
+
+        bool m_dynamicResolution = false;               ///< Main pass renders into the scaled targets below
+        float m_renderScale = 1.0f;                     ///< Current per-axis resolution scale
+        float m_minRenderScale = 0.5f;                  ///< Lower clamp for m_renderScale
+        float m_targetGpuMs = 14.0f;                    ///< GPU frame time the scale controller steers toward
+        float m_smoothedGpuMs = 0.0f;                   ///< EMA of total GPU frame time (0 until first sample)
+        uint32_t m_scaleHoldFrames = 0;                 ///< Frames until the controller may step again
+        std::vector<std::shared_ptr<Image>> m_scaledColorImages; ///< Per-frame-in-flight internal color targets
+        std::shared_ptr<Image> m_scaledDepthImage;      ///< Shared internal depth buffer (same sharing as swapchain depth)
+        std::unique_ptr<RenderPass> m_scaledRenderPass; ///< Same formats as m_renderPass, color ends TRANSFER_SRC
+        std::vector<VkFramebuffer> m_scaledFramebuffers; ///< One per frame in flight, at swapchain extent
+
         // ============================================================================
         // Resize Detection and Debouncing
         // ============================================================================
@@ -290,23 +744,70 @@ namespace vkeng {
         /// Last known window height for polling-based resize detection (WSL2/WSLg workaround)
         int m_lastKnownHeight = 0;
 
+        /// Frames left before swapchains retired by recreateSwapChain() are
+        /// destroyed — counts down from MAX_FRAMES_IN_FLIGHT so pending
+        /// presents to the old images drain first (no device-wide wait)
+        uint32_t m_retiredSwapchainFrames = 0;
+
+        // ============================================================================
+        // Pipelined Acquisition (acquire-ahead + present-wait feedback)
+        // ============================================================================
+
+        /// Image acquired right after the previous present, using the next
+        /// slot's semaphore, so the next frame starts recording without
+        /// blocking in vkAcquireNextImageKHR
+        uint32_t m_preAcquiredImage = 0;
+        uint32_t m_preAcquiredSlot = 0;        ///< Frame slot the pre-acquire signaled
+        bool m_hasPreAcquiredImage = false;    ///< Pre-acquired image is valid
+        uint64_t m_prevPresentId = 0;          ///< ID of the last queued present (0 after recreation)
+        float m_lastAcquireWaitMs = 0.0f;      ///< Time blocked acquiring, last frame
+        float m_lastPresentWaitMs = 0.0f;      ///< Time blocked presenting/present-waiting, last frame
+
         DebugShadingMode m_debugShadingMode = DebugShadingMode::Lit;
 
         VkDescriptorSet m_fallbackTextureDescriptorSet = VK_NULL_HANDLE;
+        VkDescriptorSet m_bindlessTextureSet = VK_NULL_HANDLE; ///< Bindless texture array (set 1) when non-null
 
         // ============================================================================
         // Shadow Mapping
         // ============================================================================
 
         ShadowPass* m_shadowPass = nullptr;                ///< Non-owning pointer to shadow pass (null = no shadows)
+        const Renderer* m_shadowSource = nullptr;          ///< Renderer whose shadow map/cascades we reuse (null = own pass)
         VkDescriptorSet m_shadowDescriptorSet = VK_NULL_HANDLE; ///< Shadow map descriptor set (set 2)
+        bool m_pushShadowDescriptors = false;              ///< Push set 2 per-draw instead of binding it
+        PFN_vkCmdPushDescriptorSetKHR m_pushDescriptorFn = nullptr; ///< Resolved when push mode enabled
+        FrameGraph m_frameGraph;                           ///< Per-frame pass scheduler (rebuilt each frame)
         PipelineConfig m_shadowConfig{};                    ///< Pipeline config for shadow depth pass
-        glm::mat4 m_lightSpaceMatrix{1.f};                 ///< Cached light-space VP matrix
+        /** @brief Per-cascade shadow data recomputed each frame from the camera frustum. */
+        struct ShadowCascade {
+            glm::mat4 viewProj{1.f};   ///< Light-space VP matrix for this cascade
+            glm::vec3 boundsMin{0.f};  ///< Caster-culling AABB in light view space
+            glm::vec3 boundsMax{0.f};
+            float splitFar = 0.f;      ///< View-space far distance of the frustum slice
+        };
+
+        // Fitted cascades and the shared light view live in the frame
+        // packet: they are written at build time and read at record time.
+
+        // Static shadow caching: the static caster layers are only re-rendered
+        // when the cascade matrices or the static caster set/transforms change.
+        // Texel snapping in the cascade fit keeps the matrices stable while the
+        // camera merely translates, so the cache survives most frames.
+        bool m_staticShadowValid = false;                  ///< Static layers match current scene/light
+        size_t m_staticShadowHash = 0;                     ///< Hash of cascade matrices + static caster transforms
 
         void recordShadowPass(VkCommandBuffer commandBuffer, VkDescriptorSet uboDescriptorSet);
-        glm::mat4 computeLightSpaceMatrix(const SceneNode& root) const;
+        void computeShadowCascades(const SceneNode& root, Camera& camera);
+
+        FrameVector<GpuLight> m_collectedLights;  ///< Lights gathered from scene graph each frame (frame arena)
 
-        std::vector<GpuLight> m_collectedLights;  ///< Lights gathered from scene graph each frame
+        /// Gathered GpuLight cache: rebuilt only when the light-set stamp
+        /// moves (light property/lifecycle revision, owner transform
+        /// versions, enabled/active flags); otherwise copied as-is
+        std::vector<GpuLight> m_cachedLights;
+        uint64_t m_lightGatherStamp = 0;          ///< Stamp m_cachedLights was built at
+        bool m_lightCacheValid = false;           ///< False until the first gather
 
         // ============================================================================
         // Draw Call Queue (collected per-frame, sorted, then issued)
@@ -314,31 +815,363 @@ namespace vkeng {
 
         /** @brief A deferred draw call collected during scene traversal. */
         struct DrawCall {
-            std::shared_ptr<Mesh> mesh;
+            MeshHandle mesh;         ///< Non-owning; scene/ResourceManager keep the mesh alive
             MeshPushConstants pushConstants;
+            BindlessPushConstants textureIndices; ///< Bindless array indices (bindless mode only)
             VkDescriptorSet textureDescriptorSet;
             BlendMode blendMode;
             CullMode cullMode;
             float distanceToCamera;  ///< For back-to-front sorting of transparent objects
+            uint64_t sortKey;        ///< Packed pipeline/material/mesh/depth ordering key
+            bool isStatic = false;   ///< Source node is static (eligible for shadow caching)
         };
 
-        std::vector<DrawCall> m_opaqueDrawCalls;       ///< Opaque + alpha-mask draws
-        std::vector<DrawCall> m_transparentDrawCalls;   ///< Alpha-blend draws (sorted back-to-front)
+        // Per-frame draw lists live in the frame packet (arena-backed,
+        // re-created each build in resetFrameContainers); the sort scratch
+        // is build-phase-only so it stays a plain member
+        FrameVector<DrawCall> m_drawSortScratch;        ///< Ping-pong buffer for the radix sort
 
-        /** @brief Collect draw calls from the scene graph (replaces immediate renderNode drawing). */
-        void collectDrawCalls(const SceneNode& node, const glm::vec3& cameraPos);
+        /** @brief Re-creates the arena-backed containers after an arena reset. */
+        void resetFrameContainers();
+
+        // ============================================================================
+        // Retained Draw List (rebuilt only on scene structure changes)
+        // ============================================================================
+
+        /** @brief A cached draw source: node, renderer, pre-resolved material state. */
+        struct RetainedDraw {
+            const SceneNode* node = nullptr;
+            MeshRenderer* renderer = nullptr;
+            DrawCall prototype;        ///< Camera-independent fields, resolved at rebuild
+            bool transparent = false;  ///< Prototype blend mode is alpha-blend
+        };
+
+        /**
+         * @brief Rebuild the retained draw list from the scene graph.
+         *
+         * Full traversal resolving each mesh-bearing node's material and
+         * texture state into a DrawCall prototype. Runs only when the scene
+         * structure version moved (node add/remove, component add/remove,
+         * mesh or material swap) — in steady-state scenes, almost never.
+         * Inactive nodes are cached too: active flags are per-frame state,
+         * checked at emit time, not structural.
+         */
+        void rebuildRetainedDraws(const SceneNode& root);
+
+        /** @brief Recursion helper for rebuildRetainedDraws(). */
+        void appendRetainedDraws(const SceneNode& node);
+
+        /** @brief Resolve one node's material/texture state into a prototype. */
+        void buildDrawPrototype(const SceneNode& node, MeshRenderer& meshRenderer,
+                                RetainedDraw& out);
+
+        /**
+         * @brief Emit this frame's draw calls from the retained list.
+         *
+         * Per-frame work per draw: active check, optional frustum test
+         * against the cached world AABB, world matrix read (recomputed only
+         * for nodes whose Transform dirty flag is set), LOD selection, and
+         * sort-key packing. All material-derived state comes from the cached
+         * prototype instead of being re-read from the component.
+         */
+        void collectRetainedDraws(const glm::vec3& cameraPos);
+
+        std::vector<RetainedDraw> m_retainedDraws; ///< Heap-backed cache, survives frames
+        uint64_t m_retainedVersion = 0;            ///< Structure version the cache was built at
+        bool m_retainedValid = false;              ///< False until the first rebuild
+
+        /**
+         * @brief Frustum-cull the retained draws with the SIMD kernel.
+         * @return Number of surviving draws; their retained-list indices
+         *         fill m_visibleRetained in ascending order
+         *
+         * Mirrors each draw's cached world AABB into the SoA bounds arrays
+         * and runs simd::cullAabbs over job-system chunks, each chunk
+         * compacting into its own disjoint slice of the output before the
+         * slices are stitched together. Taken only above a draw-count
+         * threshold; small lists keep the scalar per-node test.
+         */
+        size_t cullRetainedBounds();
+
+        /// SoA mirror of the retained draws' world bounds (centers and
+        /// half-extents, parallel arrays), refreshed each vectorized cull
+        std::vector<float> m_boundsCx, m_boundsCy, m_boundsCz;
+        std::vector<float> m_boundsEx, m_boundsEy, m_boundsEz;
+        std::vector<uint32_t> m_visibleRetained;   ///< Cull survivors, ascending indices
+
+        /**
+         * @brief Sort both draw lists by their packed 64-bit sort keys.
+         *
+         * Opaque keys order by pipeline, then material, then mesh, then
+         * front-to-back depth, minimizing state changes while preserving
+         * early-z benefit. Transparent keys put inverted depth in the top
+         * bits, so the same ascending sort yields back-to-front order with
+         * state grouping as the tiebreaker. Uses an LSD radix sort — draw
+         * lists are re-sorted every frame and mostly-sorted input is common,
+         * so O(n) beats comparison sorting at scale.
+         */
+        void sortDrawCalls();
 
         /** @brief Issue all collected draw calls with correct pipeline binding. */
         void issueDrawCalls(VkCommandBuffer commandBuffer);
 
+        /** @brief Bind state carried across recorded draws to skip redundant binds. */
+        struct RecordState {
+            VkPipeline pipeline = VK_NULL_HANDLE;        ///< Last bound pipeline
+            VkDescriptorSet textureSet = VK_NULL_HANDLE; ///< Last bound material set (set 1)
+            const Mesh* mesh = nullptr;                  ///< Last bound vertex/index buffers
+        };
+
+        /**
+         * @brief Record a contiguous range of draw calls into a command buffer.
+         * @param commandBuffer Target (primary or secondary) command buffer
+         * @param drawCalls Pointer to first draw call in the range
+         * @param count Number of draw calls to record
+         * @param state In/out tracking of bound pipeline/material/mesh; with
+         *              sorted input most binds are eliminated as redundant
+         *
+         * Shared between single-threaded inline recording and per-worker
+         * secondary buffer recording. Pipelines must already exist in the
+         * PipelineManager cache when called from worker threads.
+         */
+        void recordDrawRange(VkCommandBuffer commandBuffer, const DrawCall* drawCalls,
+                             size_t count, RecordState& state);
+
+        // ============================================================================
+        // Instanced Rendering
+        // ============================================================================
+
+        /** @brief A batch of draw calls merged into one instanced drawIndexed. */
+        struct InstanceBatch {
+            DrawCall prototype;       ///< Representative draw call (mesh, material state)
+            uint32_t firstInstance;   ///< Offset into the per-frame instance buffer
+            uint32_t instanceCount;   ///< Number of instances in the batch
+            bool allStatic;           ///< Every member draw came from a static node
+        };
+
+        /**
+         * @brief Group opaque draw calls by (mesh, material) into instance batches.
+         *
+         * Draws sharing the same mesh, texture descriptor set, pipeline state,
+         * and material factors are folded into an InstanceBatch; their model
+         * matrices are appended to the instance scratch list. Singles remain
+         * in m_opaqueDrawCalls.
+         */
+        void buildInstanceBatches();
+
+        /** @brief Upload this frame's instance matrices into the per-frame buffer. */
+        void uploadInstanceData(uint32_t frameIndex);
+
+        /** @brief Record all instanced batches (instance buffer bound at binding 1). */
+        void recordInstancedBatches(VkCommandBuffer commandBuffer);
+
+        bool m_instancingEnabled = false;                        ///< Toggle for instanced rendering
+        std::shared_ptr<MemoryManager> m_memoryManager;          ///< For instance buffer creation
+        PipelineConfig m_instancedConfig{};                      ///< Pipeline config with instanced vertex shader
+        std::vector<std::shared_ptr<Buffer>> m_instanceBuffers;  ///< Per-frame-in-flight instance buffers
+
+        // ============================================================================
+        // Depth Pre-Pass
+        // ============================================================================
+
+        /** @brief Record opaque singles depth-only before the shaded pass. */
+        void recordDepthPrePass(VkCommandBuffer commandBuffer);
+
+        bool m_depthPrePassEnabled = false;        ///< Toggle for the depth-only pre-pass
+        PipelineConfig m_prePassConfig{};          ///< Depth-only config (color writes masked)
+
+        // ============================================================================
+        // Indirect Multi-Draw
+        // ============================================================================
+
+        /** @brief A run of commands sharing pipeline state and buffer bindings. */
+        struct IndirectBucket {
+            BlendMode blendMode;             ///< Pipeline variant selector
+            CullMode cullMode;               ///< Pipeline variant selector
+            VertexFormat vertexFormat;       ///< Pipeline variant selector
+            VkBuffer vertexBuffer;           ///< Vertex buffer bound for the bucket
+            VkBuffer indexBuffer;            ///< Index buffer bound for the bucket
+            VkDeviceSize vertexBindOffset;   ///< 0 for merged pooled buckets
+            VkDeviceSize indexBindOffset;    ///< 0 for merged pooled buckets
+            VkIndexType indexType;           ///< Uniform across the bucket
+            uint32_t firstDraw;              ///< First record in the draw-data/command buffers
+            uint32_t drawCount;              ///< Commands issued by the bucket's one indirect draw
+        };
+
+        /** @brief Per-frame-in-flight mapped draw-data and command buffers. */
+        struct IndirectFrame {
+            std::shared_ptr<Buffer> drawData; ///< Host-visible GpuDrawData array (set 0, binding 1)
+            std::shared_ptr<Buffer> commands; ///< Host-visible VkDrawIndexedIndirectCommand array
+            VkDescriptorSet writtenSet = VK_NULL_HANDLE; ///< Set-0 set whose binding 1 points at drawData
+        };
+
+        /**
+         * @brief Pack this frame's sorted draws into the mapped buffers.
+         *
+         * Walks opaque then transparent draws (command order preserves the
+         * sorted order, so transparency stays back-to-front), writing one
+         * GpuDrawData record and one indirect command per draw and cutting
+         * a new bucket whenever the pipeline variant or the required
+         * vertex/index binding changes. Pooled meshes on whole-vertex
+         * boundaries address their block through firstIndex/vertexOffset,
+         * so a block full of different meshes still forms one bucket.
+         * Also (re)writes set-0 binding 1 when the buffer grew or the
+         * per-frame descriptor set changed — before any recording, while
+         * the set is guaranteed not to be in flight.
+         */
+        void prepareIndirectDraws(uint32_t frameIndex, VkDescriptorSet uboSet);
+
+        /** @brief Grow the per-frame draw-data/command buffers if needed. */
+        void growIndirectBuffers(IndirectFrame& frame, uint32_t drawCount);
+
+        /** @brief Issue one vkCmdDrawIndexedIndirect per prepared bucket. */
+        void recordIndirectDraws(VkCommandBuffer commandBuffer);
+
+        bool m_indirectEnabled = false;             ///< Toggle for the indirect multi-draw backend
+        PipelineConfig m_indirectConfig{};          ///< Pipeline config with the indirect shaders
+        std::vector<IndirectFrame> m_indirectFrames; ///< One entry per frame in flight
+        FrameVector<GpuDrawData> m_drawDataScratch; ///< CPU-side draw records this frame (frame arena)
+        FrameVector<VkDrawIndexedIndirectCommand> m_indirectCommandScratch; ///< Commands this frame (frame arena)
+        uint32_t m_indirectBucketCount = 0;         ///< Buckets issued last frame
+
+        // ============================================================================
+        // GPU Occlusion Culling
+        // ============================================================================
+
+        /**
+         * @brief Build cull candidates/command prototypes from this frame's
+         *        instance batches and hand them to the OcclusionCuller.
+         *
+         * One candidate per instance (mesh-local bounding sphere + world
+         * matrix), one indirect command prototype per batch with
+         * instanceCount = 0 for the cull shader to fill in.
+         */
+        void prepareOcclusionCulling(Camera& camera);
+
+        std::unique_ptr<OcclusionCuller> m_occlusionCuller;      ///< Null when occlusion culling is disabled
+        std::vector<OcclusionCuller::Candidate> m_cullCandidateScratch; ///< Persistent CPU staging (reused each frame)
+        std::vector<VkDrawIndexedIndirectCommand> m_cullCommandScratch; ///< Per-batch command prototypes
+
+        // ============================================================================
+        // Clustered Lighting
+        // ============================================================================
+
+        std::unique_ptr<ClusteredLighting> m_clusteredLighting; ///< Null when clustered lighting is disabled
+        std::unique_ptr<MeshletRenderer> m_meshletRenderer; ///< Null when the meshlet path is disabled
+        std::unique_ptr<AnimationSystem> m_animationSystem; ///< Null when skinning is disabled
+
+        // ============================================================================
+        // Particles
+        // ============================================================================
+
+        std::unique_ptr<ParticleSystem> m_particleSystem; ///< Null when particles are disabled
+
+        // ============================================================================
+        // Stats Overlay
+        // ============================================================================
+
+        std::unique_ptr<StatsOverlay> m_statsOverlay; ///< Null when the overlay is disabled
+
+        // ============================================================================
+        // Screenshot Capture
+        // ============================================================================
+
+        std::unique_ptr<ScreenshotCapture> m_screenshotCapture; ///< Null when capture is disabled
+
+        // ============================================================================
+        // Multi-threaded Recording (secondary command buffers)
+        // ============================================================================
+
+        /**
+         * @brief Record the main pass draw calls across worker threads.
+         * @param primary Primary command buffer (render pass begun with
+         *                VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS)
+         * @param imageIndex Current swap chain image index
+         * @param uboDescriptorSet Global UBO descriptor set for this frame
+         *
+         * Partitions m_opaqueDrawCalls across the worker secondaries, records
+         * transparent draws into a dedicated secondary on the calling thread
+         * (to preserve back-to-front order), then stitches everything with a
+         * single vkCmdExecuteCommands call.
+         */
+        void recordSceneParallel(VkCommandBuffer primary, uint32_t imageIndex,
+                                 VkDescriptorSet uboDescriptorSet);
+
+        /** @brief Lazily create per-worker command pools and secondary buffers. */
+        void createWorkerResources();
+
+        /** @brief Begin a secondary buffer inheriting the main render pass state. */
+        void beginSecondary(VkCommandBuffer secondary, uint32_t imageIndex);
+
+        /** @brief Ensure every pipeline variant used this frame exists in the cache. */
+        void prewarmPipelines();
+
+        /**
+         * @brief Stamps the current shading specialization onto a config.
+         *
+         * Debug shading mode and the shadow toggle bake into the fragment
+         * shader as specialization constants, so the variant for the
+         * current renderer state is selected through the pipeline cache
+         * rather than branched on per fragment.
+         */
+        void applyShadingSpecConstants(PipelineConfig& config) const;
+
         // ============================================================================
         // Frustum Culling
         // ============================================================================
 
+        // ============================================================================
+        // Multi-threaded Recording State
+        // ============================================================================
+
+        bool m_parallelRecordingEnabled = false;   ///< Toggle for multi-threaded recording
+
+        /// Minimum opaque draw count before parallel recording pays for itself
+        static constexpr size_t PARALLEL_RECORD_THRESHOLD = 256;
+
+        std::unique_ptr<PerThreadCommandPools> m_workerPools;  ///< One command pool per worker thread
+
+        /// Secondary command buffers: [workerIndex][frameInFlight]
+        std::vector<std::vector<VkCommandBuffer>> m_workerSecondaries;
+
+        /// Secondary for transparent draws, recorded on the calling thread: [frameInFlight]
+        std::vector<VkCommandBuffer> m_transparentSecondaries;
+
+        /// Secondary for the depth pre-pass, executed before the opaque partitions: [frameInFlight]
+        std::vector<VkCommandBuffer> m_prePassSecondaries;
+
+        uint32_t m_workerCount = 0;                ///< Number of recording worker threads
+
         Frustum m_frustum;                         ///< Current frame's camera frustum
         bool m_cullingEnabled = true;              ///< Toggle for frustum culling
-        uint32_t m_drawnCount = 0;                 ///< Meshes drawn this frame
-        uint32_t m_culledCount = 0;                ///< Meshes culled this frame
+        bool m_drawSortingEnabled = true;          ///< Toggle for the per-frame draw sort (benchmark knob)
+        /** @brief Per-frame draw state handed from build to record (see the
+         *  public FramePacket declaration for the threading contract). */
+        struct FramePacket {
+            uint32_t frameIndex = 0;                  ///< Frame-in-flight slot the packet targets
+            VkDescriptorSet globalSet = VK_NULL_HANDLE; ///< Global UBO set (set 0) for the slot
+            std::array<ShadowCascade, ShadowPass::CASCADE_COUNT> cascades{}; ///< Fitted cascades
+            glm::mat4 lightViewMatrix{1.f};           ///< Shared light view (cascades differ only in ortho fit)
+            FrameVector<DrawCall> opaqueDrawCalls;    ///< Opaque + alpha-mask draws
+            FrameVector<DrawCall> transparentDrawCalls; ///< Alpha-blend draws (sorted back-to-front)
+            FrameVector<InstanceBatch> instanceBatches; ///< Batches built this frame (frame arena)
+            FrameVector<glm::mat4> instanceScratch;   ///< CPU-side instance matrices this frame (frame arena)
+            FrameVector<IndirectBucket> indirectBuckets; ///< Buckets built this frame (frame arena)
+            FrameVector<MeshletDraw> meshletDraws;    ///< Opaque draws routed through the meshlet path
+            uint32_t drawnCount = 0;                  ///< Meshes drawn this frame
+            uint32_t culledCount = 0;                 ///< Meshes culled this frame
+            uint32_t instancedBatchCount = 0;         ///< Batches issued this frame
+            uint32_t instancedDrawCount = 0;          ///< Draws folded into batches this frame
+            bool indirectActiveThisFrame = false;     ///< Draws were routed through the indirect path
+            bool occlusionActiveThisFrame = false;    ///< Batches were routed through the GPU cull
+            VkExtent2D renderExtent{};                ///< Main pass extent (scaled when dynamic resolution is on)
+            Frustum frustum{};                        ///< Camera frustum planes extracted once for this frame
+        };
+
+        FramePacket m_packetStorage[2];               ///< Alternating packets (build N+1 vs record N)
+        FramePacket* m_buildPacket = &m_packetStorage[0];       ///< Packet the build phase writes
+        const FramePacket* m_renderPacket = &m_packetStorage[0]; ///< Packet the record phase reads
+        std::function<void()> m_recreateSyncCallback; ///< Drains the render thread before recreation
 
         // ============================================================================
         // Multi-Frame Synchronization
@@ -353,14 +1186,24 @@ namespace vkeng {
          * in flight has its own FrameData to allow parallel CPU/GPU work.
          */
         struct FrameData {
-            VkCommandBuffer commandBuffer;           ///< Command buffer for this frame's rendering
-            VkSemaphore imageAvailableSemaphore;     ///< Signals when swap chain image is available
-            VkSemaphore renderFinishedSemaphore;     ///< Signals when rendering is complete
-            VkFence inFlightFence;                   ///< CPU synchronization for frame completion
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;       ///< Command buffer for this frame's rendering
+            VkSemaphore imageAvailableSemaphore = VK_NULL_HANDLE; ///< Signals when swap chain image is available
+            VkSemaphore renderFinishedSemaphore = VK_NULL_HANDLE; ///< Signals when rendering is complete
+            VkFence inFlightFence = VK_NULL_HANDLE;               ///< Fallback CPU sync when timeline semaphores are unavailable
+            uint64_t timelineValue = 0;                           ///< Frame timeline value this frame's submit signals
         };
-        
+
         std::vector<FrameData> m_frames;    ///< Per-frame data for all frames in flight
         uint32_t m_currentFrame = 0;        ///< Current frame index (cycles through frames)
+
+        /**
+         * @brief Graphics-queue timeline: each frame's submit signals the
+         * next value and the CPU waits on the exact value before reusing
+         * the frame's resources — no fence resets, and the swapchain's
+         * binary acquire/present semaphores are the only binary sync left.
+         * Null when the device lacks timelineSemaphore (fences are used).
+         */
+        std::shared_ptr<TimelineSemaphore> m_frameTimeline;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * @file ScreenshotCapture.hpp
+ * @brief Asynchronous swapchain readback and PNG encoding
+ *
+ * Monitoring installs need periodic frame captures. The old path was a
+ * vkDeviceWaitIdle readback that dropped several frames; this service
+ * copies the presented image into a host-visible buffer on the GPU and
+ * hands the fence to a background thread that encodes the PNG, so the
+ * render loop never blocks.
+ *
+ * Key Capture Concepts:
+ * - Copy submission: a small command buffer on the graphics queue that
+ *   waits on the frame's render-finished semaphore, transitions the
+ *   swapchain image PRESENT -> TRANSFER_SRC, copies it to a readback
+ *   buffer, transitions back, and signals the semaphore present waits on
+ *   (swapchain images are EXCLUSIVE to the graphics family, so the copy
+ *   cannot ride the dedicated transfer queue without an ownership
+ *   transfer; the extra graphics-queue submission costs microseconds)
+ * - Slot ring: a few in-flight captures, each with its own command
+ *   buffer, fence, and readback buffer; when all slots are busy the
+ *   frame is simply not captured
+ * - Encoder thread: waits each slot's fence, swizzles BGRA -> RGBA, and
+ *   writes the PNG to disk, entirely off the main loop
+ *
+ * Usage:
+ * @code
+ *   renderer.enableScreenshotCapture(memoryManager, "captures");
+ *   renderer.getScreenshotCapture()->requestCapture();          // one shot
+ *   renderer.getScreenshotCapture()->beginContinuousCapture();  // video frames
+ * @endcode
+ */
+#pragma once
+
+#include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/core/VulkanDevice.hpp"
+
+#include <vulkan/vulkan.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class ScreenshotCapture
+     * @brief Renderer-owned service for stall-free frame captures
+     *
+     * The Renderer calls recordCopy() between its draw submission and
+     * present on frames where wantsFrame() is true; everything after the
+     * GPU copy (fence wait, pixel swizzle, PNG write) happens on a
+     * dedicated encoder thread. Completed files land in the output
+     * directory as capture_NNNNNN.png (continuous) or the caller-supplied
+     * path (one-shot).
+     */
+    class ScreenshotCapture {
+    public:
+        /**
+         * @brief Creates the capture slots and starts the encoder thread
+         * @param device Device providing the graphics queue for copies
+         * @param memoryManager Allocator for the readback buffers
+         * @param outputDir Directory captures are written to (created if missing)
+         *
+         * @throws std::runtime_error if command pool or sync object creation fails
+         */
+        ScreenshotCapture(VulkanDevice& device,
+                          std::shared_ptr<MemoryManager> memoryManager,
+                          const std::filesystem::path& outputDir);
+
+        /** @brief Drains in-flight captures, joins the encoder thread, frees GPU objects. */
+        ~ScreenshotCapture();
+
+        // Non-copyable (owns GPU objects and a thread)
+        ScreenshotCapture(const ScreenshotCapture&) = delete;
+        ScreenshotCapture& operator=(const ScreenshotCapture&) = delete;
+
+        // ============================================================================
+        // Requests
+        // ============================================================================
+
+        /**
+         * @brief Queue a one-shot capture of the next presented frame.
+         * @param filename Output file name inside the output directory;
+         *        empty picks a timestamped default.
+         */
+        void requestCapture(const std::string& filename = {});
+
+        /**
+         * @brief Capture every presented frame until endContinuousCapture().
+         *
+         * Frames are numbered sequentially for assembly into a
+         * performance-report video. Frames that arrive while every slot is
+         * still encoding are skipped (and counted, see droppedFrameCount()).
+         */
+        void beginContinuousCapture();
+
+        /** @brief Stop continuous capture; in-flight frames still finish encoding. */
+        void endContinuousCapture();
+
+        /** @brief Whether the next presented frame should be captured. */
+        bool wantsFrame() const { return m_continuous || m_oneShotPending; }
+
+        /** @brief Frames requested but skipped because all slots were busy. */
+        uint64_t droppedFrameCount() const { return m_droppedFrames; }
+
+        // ============================================================================
+        // Renderer hook
+        // ============================================================================
+
+        /**
+         * @brief Submit the GPU copy for the frame about to be presented.
+         * @param image Acquired swapchain image, in PRESENT_SRC layout once
+         *        @p renderFinished signals
+         * @param extent Swapchain extent
+         * @param format Swapchain format (B8G8R8A8-family expected)
+         * @param renderFinished Semaphore the frame's draw submission signals
+         * @return The semaphore present must wait on instead of
+         *         @p renderFinished, or VK_NULL_HANDLE when no slot was free
+         *         (caller presents against @p renderFinished as usual)
+         *
+         * Called by Renderer::drawFrame between submit and present when
+         * wantsFrame() is true. Must be called from the thread that owns
+         * the graphics queue.
+         */
+        VkSemaphore recordCopy(VkImage image, VkExtent2D extent, VkFormat format,
+                               VkSemaphore renderFinished);
+
+    private:
+        static constexpr uint32_t kSlotCount = 3;
+
+        /** @brief One in-flight capture: GPU copy state plus its encode job. */
+        struct Slot {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            VkFence fence = VK_NULL_HANDLE;
+            VkSemaphore copyDone = VK_NULL_HANDLE;
+            std::shared_ptr<Buffer> readback;   ///< Host-visible TRANSFER_DST, resized on demand
+            uint32_t width = 0;
+            uint32_t height = 0;
+            VkFormat format = VK_FORMAT_UNDEFINED;
+            std::string path;                   ///< Destination file for the encode
+            bool busy = false;                  ///< Owned by the encoder until cleared
+        };
+
+        /** @brief Encoder thread main: waits fences, swizzles, writes PNGs. */
+        void encoderMain();
+
+        /** @brief Swizzle the mapped readback pixels to RGBA and write the PNG. */
+        void encodeSlot(Slot& slot);
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        std::filesystem::path m_outputDir;
+
+        VkCommandPool m_commandPool = VK_NULL_HANDLE;
+        Slot m_slots[kSlotCount];
+
+        // Request state (main thread)
+        bool m_continuous = false;
+        bool m_oneShotPending = false;
+        std::string m_oneShotName;
+        uint64_t m_sequence = 0;        ///< Continuous-capture frame number
+        uint64_t m_droppedFrames = 0;
+
+        // Encoder queue (shared with the worker thread)
+        std::mutex m_queueMutex;
+        std::condition_variable m_queueCv;
+        std::deque<uint32_t> m_pendingSlots;
+        bool m_shutdown = false;
+        std::thread m_encoderThread;
+
+        std::vector<uint8_t> m_encodeScratch; ///< RGBA swizzle buffer, encoder thread only
+    };
+
+} // namespace vkeng
@@ -0,0 +1,86 @@
+/**
+ * @file ShaderModuleCache.hpp
+ * @brief Content-hashed cache of VkShaderModule objects
+ *
+ * Every pipeline variant build used to re-read its SPIR-V blobs from disk
+ * and create fresh VkShaderModules, even though most variants share the
+ * same two shaders. This cache creates each module once per distinct file
+ * content and hands the same handle to every pipeline that asks.
+ *
+ * Key Concepts:
+ * - Content Hash: entries remember an FNV-1a hash of the SPIR-V bytes, so
+ *   an invalidated file that compiled to identical output (e.g. a comment
+ *   edit) keeps its existing module instead of churning the driver
+ * - Invalidation: invalidate() marks an entry stale without destroying it;
+ *   the next getModule() re-reads the file and only replaces the module
+ *   when the content actually changed. Callers must ensure the GPU is idle
+ *   before a stale module can be replaced (hot reload does this between
+ *   frames)
+ */
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vulkan/vulkan.h>
+
+namespace vkeng {
+
+    /**
+     * @class ShaderModuleCache
+     * @brief Caches shader modules by path, validated by content hash
+     *
+     * Thread-safe: getPipeline() runs on both the render thread and the
+     * prewarm thread, so lookups and creation are serialized internally.
+     *
+     * @note Modules are owned by the cache and destroyed in clear()/dtor;
+     *       pipelines keep no reference to them after creation
+     */
+    class ShaderModuleCache {
+    public:
+        explicit ShaderModuleCache(VkDevice device);
+
+        /** @brief Destroys all cached modules */
+        ~ShaderModuleCache() noexcept;
+
+        ShaderModuleCache(const ShaderModuleCache&) = delete;
+        ShaderModuleCache& operator=(const ShaderModuleCache&) = delete;
+
+        /**
+         * @brief Gets the shader module for a SPIR-V file, creating it on miss
+         * @param path Path to the compiled SPIR-V blob
+         * @return Cached module handle (owned by the cache)
+         * @throws std::runtime_error if the file is missing or not valid SPIR-V
+         */
+        VkShaderModule getModule(const std::filesystem::path& path);
+
+        /**
+         * @brief Marks a path stale so the next getModule() re-reads the file
+         *
+         * The module is replaced only if the new content hashes differently;
+         * replacement destroys the old module, so the caller must guarantee
+         * no in-flight frame still references a pipeline built from it.
+         */
+        void invalidate(const std::filesystem::path& path);
+
+        /** @brief Destroys all cached modules (device must be idle) */
+        void clear();
+
+    private:
+        struct Entry {
+            VkShaderModule module = VK_NULL_HANDLE; ///< Created from the file contents
+            uint64_t contentHash = 0;               ///< FNV-1a of the SPIR-V bytes
+            bool stale = false;                     ///< Re-read and re-hash on next lookup
+        };
+
+        /** @brief Reads the file and creates a module; updates the entry in place */
+        void loadEntry(const std::filesystem::path& path, Entry& entry);
+
+        VkDevice m_device;
+        std::mutex m_mutex;                             ///< Guards m_entries (render vs prewarm thread)
+        std::unordered_map<std::string, Entry> m_entries;
+    };
+
+} // namespace vkeng
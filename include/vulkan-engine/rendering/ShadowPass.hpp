@@ -1,7 +1,9 @@
 #pragma once
 
 #include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/rendering/Uniforms.hpp"
 #include <vulkan/vulkan.h>
+#include <array>
 #include <memory>
 
 namespace vkeng {
@@ -10,24 +12,71 @@ class MemoryManager;
 
 /**
  * @class ShadowPass
- * @brief Manages depth-only render pass resources for directional shadow mapping.
+ * @brief Manages depth-only render pass resources for cascaded directional shadow mapping.
  *
- * Owns the shadow map depth image, a depth-only VkRenderPass, a framebuffer,
- * and a comparison sampler for PCF shadow sampling in the main pass.
+ * Owns a layered shadow map depth image (one layer per cascade), a depth-only
+ * VkRenderPass, per-cascade framebuffers, and a comparison sampler for PCF
+ * shadow sampling in the main pass. The composite image view is 2D_ARRAY so
+ * shaders select a cascade layer at sample time; each cascade layer is
+ * rendered through its own single-layer framebuffer.
+ *
+ * Cascades split the camera frustum into depth ranges, each with a tightly
+ * fitted light matrix; near-field cascades get far more texel density than a
+ * single scene-covering map of the same total size. The Renderer computes
+ * the cascade matrices and culls casters per cascade; this class only owns
+ * the layered resources.
+ *
+ * Static shadow caching: a second persistent layered depth image holds the
+ * static casters. While the light and static transforms are unchanged, each
+ * frame only copies the cached layers into the sampled shadow map and
+ * re-renders the dynamic casters on top (via the load render pass, which
+ * preserves the copied depth instead of clearing). The Renderer decides when
+ * the cache is stale; this class just owns both layers and the two render
+ * pass variants.
+ *
+ * Multiview: when the device enabled the Vulkan 1.1 multiview feature, the
+ * render passes carry a viewMask covering every cascade and a single layered
+ * framebuffer replaces the per-cascade ones — one render pass instance
+ * writes all cascade layers, with gl_ViewIndex selecting the light matrix in
+ * the shadow shader. Casters are then recorded and vertex-fetched once
+ * instead of once per cascade.
  */
 class ShadowPass {
 public:
-    static constexpr uint32_t SHADOW_MAP_SIZE = 2048;
+    /// Number of frustum cascades (mirrors SHADOW_CASCADE_COUNT in Uniforms.hpp)
+    static constexpr uint32_t CASCADE_COUNT = SHADOW_CASCADE_COUNT;
 
+    /// Per-cascade resolution. Four tightly fitted 1024^2 cascades beat the
+    /// old single 2048^2 scene-covering map on near-field density at the
+    /// same total texel budget.
+    static constexpr uint32_t SHADOW_MAP_SIZE = 1024;
+
+    /**
+     * @param useMultiview Render all cascades through one multiview render
+     *        pass instance. Only pass true when the device enabled the
+     *        multiview feature (VulkanDevice::supportsMultiview()); the
+     *        caller must then also use the gl_ViewIndex shadow shader.
+     */
     ShadowPass(VkDevice device, VkPhysicalDevice physicalDevice,
-               std::shared_ptr<MemoryManager> memoryManager);
+               std::shared_ptr<MemoryManager> memoryManager,
+               bool useMultiview = false);
     ~ShadowPass() noexcept;
 
     ShadowPass(const ShadowPass&) = delete;
     ShadowPass& operator=(const ShadowPass&) = delete;
 
     VkRenderPass getRenderPass() const { return m_renderPass; }
-    VkFramebuffer getFramebuffer() const { return m_framebuffer; }
+    VkFramebuffer getFramebuffer(uint32_t cascade) const { return m_framebuffers[cascade]; }
+
+    // --- Multiview (single-pass cascades) ---
+
+    /** @brief True when the render passes write all cascades in one instance. */
+    bool isMultiview() const { return m_multiview; }
+    /** @brief Framebuffer over the full cascade array (multiview mode only). */
+    VkFramebuffer getLayeredFramebuffer() const { return m_layeredFramebuffer; }
+    /** @brief Layered framebuffer over the static caster cache (multiview mode only). */
+    VkFramebuffer getStaticLayeredFramebuffer() const { return m_staticLayeredFramebuffer; }
+
     VkExtent2D getExtent() const { return {SHADOW_MAP_SIZE, SHADOW_MAP_SIZE}; }
     VkFormat getDepthFormat() const { return m_depthFormat; }
 
@@ -35,21 +84,51 @@ public:
     VkImageView getDepthImageView() const { return m_depthImage->getImageView(); }
     VkSampler getSampler() const { return m_sampler; }
 
+    // --- Static caster cache ---
+
+    /** @brief Render pass that LOADs existing depth (dynamic casters over the copied static layer). */
+    VkRenderPass getLoadRenderPass() const { return m_loadRenderPass; }
+    /** @brief Framebuffer targeting one cascade of the persistent static layer (clear render pass). */
+    VkFramebuffer getStaticFramebuffer(uint32_t cascade) const { return m_staticFramebuffers[cascade]; }
+    /** @brief Persistent layered depth image holding the static casters. */
+    std::shared_ptr<Image> getStaticDepthImage() const { return m_staticDepthImage; }
+
+    /**
+     * @brief Record the copy of all static cascade layers into the sampled shadow map.
+     * @param justRenderedStatic True if the static layers were re-rendered this
+     *        frame (they then sit in the render pass's READ_ONLY final layout
+     *        and need a transition; otherwise they stayed in TRANSFER_SRC)
+     *
+     * Leaves the main depth image in TRANSFER_DST_OPTIMAL; the load render
+     * pass transitions it to attachment layout via its initialLayout.
+     */
+    void recordStaticLayerCopy(VkCommandBuffer commandBuffer, bool justRenderedStatic);
+
 private:
     void createRenderPass();
+    void createLoadRenderPass();
     void createDepthResources();
-    void createFramebuffer();
+    void createFramebuffers();
     void createSampler();
     VkFormat findDepthFormat();
+    VkImageView createLayerView(VkImage image, uint32_t layer) const;
 
     VkDevice m_device = VK_NULL_HANDLE;
     VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
     std::shared_ptr<MemoryManager> m_memoryManager;
 
     VkFormat m_depthFormat = VK_FORMAT_D32_SFLOAT;
-    std::shared_ptr<Image> m_depthImage;
+    std::shared_ptr<Image> m_depthImage;             ///< Layered map the main pass samples (2D_ARRAY view)
+    std::shared_ptr<Image> m_staticDepthImage;       ///< Persistent layered static caster cache
     VkRenderPass m_renderPass = VK_NULL_HANDLE;
-    VkFramebuffer m_framebuffer = VK_NULL_HANDLE;
+    VkRenderPass m_loadRenderPass = VK_NULL_HANDLE;  ///< loadOp LOAD variant for incremental redraw
+    std::array<VkImageView, CASCADE_COUNT> m_layerViews{};        ///< Single-layer attachment views (main)
+    std::array<VkImageView, CASCADE_COUNT> m_staticLayerViews{};  ///< Single-layer attachment views (static)
+    std::array<VkFramebuffer, CASCADE_COUNT> m_framebuffers{};
+    std::array<VkFramebuffer, CASCADE_COUNT> m_staticFramebuffers{};
+    bool m_multiview = false;                        ///< Render passes carry a cascade-wide viewMask
+    VkFramebuffer m_layeredFramebuffer = VK_NULL_HANDLE;        ///< All-cascade framebuffer (multiview)
+    VkFramebuffer m_staticLayeredFramebuffer = VK_NULL_HANDLE;  ///< All-cascade static framebuffer (multiview)
     VkSampler m_sampler = VK_NULL_HANDLE;
 };
 
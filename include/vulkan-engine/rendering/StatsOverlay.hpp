@@ -0,0 +1,155 @@
+/**
+ * @file StatsOverlay.hpp
+ * @brief Immediate-mode in-engine stats HUD (FPS, frame graph, draws, VRAM)
+ *
+ * Demos need visibility without attaching external tools: frame rate, a
+ * frame-time history graph, draw-call counters, GPU pass timings, and a
+ * VRAM gauge, drawn by the engine itself. The overlay is built to stay on
+ * in production: a pre-baked 8x8 font atlas lives in the binary, text and
+ * graph bars refill one persistently mapped vertex buffer per frame (no
+ * allocation, no staging), and everything renders with one pipeline and
+ * one draw at the tail of the main pass.
+ *
+ * Key Concepts:
+ * - Embedded Font: a hand-packed 8x8 glyph table (digits, uppercase,
+ *   punctuation) baked into an R8 atlas at startup — no font file, no
+ *   asset dependency. Lowercase input maps to uppercase at lookup.
+ * - Zero-Allocation Refill: vertices are written straight through the
+ *   buffer's persistent mapping from fixed stack buffers; the frame-time
+ *   history is a fixed ring. Steady state performs no heap allocation.
+ * - Single Draw: text quads and graph bars share the atlas (bars sample a
+ *   solid glyph), so the whole HUD is one vkCmdDraw.
+ * - Data Sources: CPU frame time from its own clock, GPU pass times from
+ *   GpuProfiler::getTimings(), memory from MemoryManager::getMemoryStats(),
+ *   draw counters handed in by the Renderer.
+ */
+
+#pragma once
+
+#include "vulkan-engine/core/VulkanDevice.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/rendering/DescriptorSet.hpp"
+#include "vulkan-engine/rendering/PipelineManager.hpp"
+#include "vulkan-engine/rendering/Vertex.hpp"
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class StatsOverlay
+     * @brief Draws the engine stats HUD inside the main render pass.
+     *
+     * Usage (driven by the Renderer each frame):
+     * @code
+     *   renderer.enableStatsOverlay(memoryManager, shaderDir);
+     *   renderer.getStatsOverlay()->setVisible(showHud);
+     *   // drawFrame() records the overlay automatically
+     * @endcode
+     */
+    class StatsOverlay {
+    public:
+        /** @brief Renderer counters displayed alongside the timing data. */
+        struct FrameStats {
+            uint32_t drawCalls = 0;         ///< Draws issued this frame
+            uint32_t culledDraws = 0;       ///< Draws rejected by culling
+            uint32_t instancedBatches = 0;  ///< Instanced batches issued
+            float acquireWaitMs = 0.0f;     ///< Time blocked acquiring a swapchain image
+            float presentWaitMs = 0.0f;     ///< Time blocked in present / present-wait
+        };
+
+        /**
+         * @brief Build the font atlas, vertex buffers, and draw pipeline state.
+         * @param device Vulkan device wrapper
+         * @param memoryManager Memory manager (buffers, atlas, and the VRAM gauge source)
+         * @param pipelineManager Pipeline cache providing the shared VkPipelineCache
+         * @param framesInFlight Number of frames in flight (per-frame vertex buffers)
+         * @param shaderDir Directory with overlay_vert.spv / overlay_frag.spv
+         *
+         * @warning May throw std::runtime_error if resource creation fails
+         */
+        StatsOverlay(VulkanDevice& device,
+                     std::shared_ptr<MemoryManager> memoryManager,
+                     PipelineManager& pipelineManager,
+                     uint32_t framesInFlight,
+                     const std::filesystem::path& shaderDir);
+
+        ~StatsOverlay();
+
+        StatsOverlay(const StatsOverlay&) = delete;
+        StatsOverlay& operator=(const StatsOverlay&) = delete;
+
+        /**
+         * @brief Fill this frame's vertex buffer and record the overlay draw.
+         * @param commandBuffer Command buffer inside the main render pass
+         * @param renderPass Render pass the overlay pipeline must be compatible with
+         * @param extent Current swapchain extent (pixel-to-NDC transform)
+         * @param frameIndex Frame-in-flight index
+         * @param stats Renderer draw counters for this frame
+         *
+         * Also samples the CPU frame clock, so call exactly once per frame.
+         * No-op while hidden (the clock still advances to keep the graph
+         * continuous across toggles).
+         */
+        void recordDraw(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                        VkExtent2D extent, uint32_t frameIndex, const FrameStats& stats);
+
+        /** @brief Show or hide the overlay (hidden costs one clock sample). */
+        void setVisible(bool visible) { m_visible = visible; }
+        bool isVisible() const { return m_visible; }
+        void toggle() { m_visible = !m_visible; }
+
+    private:
+        /// Worst-case HUD geometry: text lines + graph bars + backdrop
+        static constexpr uint32_t kMaxQuads = 1024;
+        static constexpr uint32_t kMaxVertices = kMaxQuads * 6;
+        /// Frame-time history samples shown in the graph
+        static constexpr uint32_t kHistorySize = 120;
+
+        void createFontAtlas();
+        void createPipelineState(const std::filesystem::path& shaderDir);
+
+        /** @brief Appends one textured quad; returns false when the buffer is full. */
+        bool pushQuad(OverlayVertex* vertices, uint32_t& count,
+                      float x0, float y0, float x1, float y1,
+                      float u0, float v0, float u1, float v1, uint32_t color) const;
+        /** @brief Appends a text run at pixel position (x, y); returns the end x. */
+        float pushText(OverlayVertex* vertices, uint32_t& count,
+                       float x, float y, const char* text, uint32_t color) const;
+        /** @brief Appends a solid rectangle (samples the solid block glyph). */
+        void pushRect(OverlayVertex* vertices, uint32_t& count,
+                      float x0, float y0, float x1, float y1, uint32_t color) const;
+
+        VulkanDevice& m_device;
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        PipelineManager& m_pipelineManager;
+
+        std::shared_ptr<Image> m_fontAtlas;
+        VkSampler m_fontSampler = VK_NULL_HANDLE;
+        std::shared_ptr<DescriptorSetLayout> m_setLayout; ///< binding 0 = font atlas sampler
+        std::shared_ptr<DescriptorPool> m_descriptorPool;
+        VkDescriptorSet m_fontSet = VK_NULL_HANDLE;
+        VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+
+        PipelineConfig m_drawConfig;            ///< Overlay pipeline variant
+        std::shared_ptr<Pipeline> m_pipeline;   ///< Built lazily, rebuilt on render pass change
+        VkRenderPass m_builtRenderPass = VK_NULL_HANDLE;
+
+        std::vector<std::shared_ptr<Buffer>> m_vertexBuffers; ///< Persistently mapped, one per frame in flight
+
+        // Pixel-to-NDC transform for the current extent (set per recordDraw)
+        float m_ndcScaleX = 0.0f;
+        float m_ndcScaleY = 0.0f;
+
+        bool m_visible = true;
+        std::chrono::steady_clock::time_point m_lastFrameTime{};
+        bool m_clockStarted = false;
+        float m_smoothedFrameMs = 0.0f;         ///< EMA of the frame time for the FPS readout
+        std::array<float, kHistorySize> m_history{}; ///< Frame-time ring buffer (milliseconds)
+        uint32_t m_historyHead = 0;
+    };
+
+} // namespace vkeng
@@ -15,6 +15,9 @@ namespace vkeng {
     /// Maximum number of lights the shader can process per frame.
     static constexpr uint32_t MAX_LIGHTS = 8;
 
+    /// Number of shadow cascades (must match CASCADE_COUNT in the shaders).
+    static constexpr uint32_t SHADOW_CASCADE_COUNT = 4;
+
     enum class DebugShadingMode : uint32_t {
         Lit = 0,
         Unlit = 1,
@@ -47,10 +50,11 @@ namespace vkeng {
     struct GlobalUbo {
         alignas(16) glm::mat4 view;             ///< View matrix (world to camera space)
         alignas(16) glm::mat4 proj;             ///< Projection matrix (camera to clip space)
-        alignas(16) glm::mat4 lightSpaceMatrix{1.f}; ///< Light-space VP matrix for shadow mapping
+        alignas(16) glm::mat4 lightSpaceMatrices[SHADOW_CASCADE_COUNT]; ///< Per-cascade light-space VP matrices
         alignas(16) glm::vec4 cameraPosition;   ///< Camera world position (xyz), w = padding
         alignas(16) glm::vec4 ambientColor;     ///< Ambient light color (rgb), a = padding
         alignas(16) glm::vec4 debugView;        ///< x = DebugShadingMode, y = shadowsEnabled (1.0 = on), zw reserved
+        alignas(16) glm::vec4 cascadeSplits;    ///< View-space far distance of each cascade
         alignas(4)  uint32_t  lightCount = 0;   ///< Number of active lights (0..MAX_LIGHTS)
         alignas(4)  uint32_t  _pad0 = 0;        ///< Explicit padding for std140
         alignas(4)  uint32_t  _pad1 = 0;
@@ -62,8 +66,10 @@ namespace vkeng {
      * @struct MeshPushConstants
      * @brief Push constants for per-mesh transformation and material data
      *
-     * @note Push constants are limited to 128 bytes (guaranteed minimum).
-     *       Current size: 128 bytes (fully utilized).
+     * @note Current size: 144 bytes — past the 128-byte guaranteed minimum
+     *       by the uvScaleOffset block for atlas sub-region addressing.
+     *       VulkanDevice verifies maxPushConstantsSize covers this (every
+     *       desktop-class device does; the same check gates bindless).
      */
     struct MeshPushConstants {
         alignas(16) glm::mat4 modelMatrix{1.f};                    ///< Model matrix (object to world space)
@@ -71,5 +77,45 @@ namespace vkeng {
         alignas(16) glm::vec4 emissiveFactor{0.f, 0.f, 0.f, 0.f}; ///< Emissive (rgb) + alphaCutoff (a)
         alignas(16) glm::vec4 specularColorAndShininess{0.35f, 0.35f, 0.35f, 32.0f}; ///< Specular color (rgb) and shininess (a)
         alignas(16) glm::vec4 pbrFactors{0.0f, 1.0f, 1.0f, 1.0f}; ///< metallic (x), roughness (y), normalScale (z), occlusionStrength (w)
+        alignas(16) glm::vec4 uvScaleOffset{1.f, 1.f, 0.f, 0.f};  ///< Texture atlas UV transform: uv * xy + zw (identity when unatlased)
+    };
+
+    /**
+     * @struct BindlessPushConstants
+     * @brief Per-draw texture indices appended after MeshPushConstants
+     *
+     * Only present in bindless mode: the pipeline layout extends the push
+     * range to 160 bytes (devices advertise this via
+     * VulkanDevice::supportsBindlessTextures()), and the renderer pushes
+     * this block at offset sizeof(MeshPushConstants). Two 16-bit indices
+     * share each component so five material slots fit in one uvec4:
+     * x = baseColor | (normal << 16), y = metallicRoughness |
+     * (occlusion << 16), z = emissive, w reserved. Must match
+     * shader_bindless.frag.
+     */
+    struct BindlessPushConstants {
+        alignas(16) glm::uvec4 textureIndices{0, 0, 0, 0}; ///< Packed bindless array indices (see above)
+    };
+
+    /**
+     * @struct GpuDrawData
+     * @brief Per-draw shading data for the indirect multi-draw path
+     *
+     * The indirect path moves everything the push-constant path carried per
+     * draw into one storage buffer (set 0, binding 1): shaders index it with
+     * the bucket's base draw offset plus gl_DrawID, so a whole pipeline
+     * bucket renders from a single vkCmdDrawIndexedIndirect with no per-draw
+     * CPU commands. Layout is std430-compatible (every member 16-byte
+     * aligned, 160-byte array stride) and must match shader_indirect.vert /
+     * shader_indirect.frag.
+     */
+    struct GpuDrawData {
+        alignas(16) glm::mat4 modelMatrix{1.f};                    ///< Model matrix (object to world space)
+        alignas(16) glm::vec4 baseColorFactor{1.f, 1.f, 1.f, 1.f};///< Base color multiplier and alpha
+        alignas(16) glm::vec4 emissiveFactor{0.f, 0.f, 0.f, 0.f}; ///< Emissive (rgb) + alphaCutoff (a)
+        alignas(16) glm::vec4 specularColorAndShininess{0.35f, 0.35f, 0.35f, 32.0f}; ///< Specular color (rgb) and shininess (a)
+        alignas(16) glm::vec4 pbrFactors{0.0f, 1.0f, 1.0f, 1.0f}; ///< metallic (x), roughness (y), normalScale (z), occlusionStrength (w)
+        alignas(16) glm::vec4 uvScaleOffset{1.f, 1.f, 0.f, 0.f};  ///< Texture atlas UV transform: uv * xy + zw
+        alignas(16) glm::uvec4 textureIndices{0, 0, 0, 0};         ///< Packed bindless array indices (see BindlessPushConstants)
     };
 }
@@ -4,14 +4,50 @@
  *
  * This file contains the definition of the Vertex struct, which is used to
  * represent a single vertex in a 3D mesh. It also provides helper functions
- * to describe the vertex layout to Vulkan.
+ * to describe the vertex layout to Vulkan. The layouts themselves are
+ * defined once as compile-time tables in VertexFormatTraits.hpp; the
+ * helpers here are the runtime lookups pipelines call.
  */
 #pragma once
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
+#include <cstdint>
 #include <vector>
 
 namespace vkeng {
+
+    /**
+     * @enum VertexFormat
+     * @brief Per-mesh vertex layout selector.
+     *
+     * Pipelines convert integer/half attribute formats to float at fetch
+     * time, so both layouts feed the same shaders — only the vertex input
+     * state differs. Meshes record their format and the renderer picks the
+     * matching pipeline variant per draw.
+     */
+    enum class VertexFormat {
+        Fat,        ///< Full-float Vertex layout (60 bytes)
+        Compact,    ///< Quantized CompactVertex layout (28 bytes)
+        Particle,   ///< Per-instance ParticleInstance stream (48 bytes, quad corners from gl_VertexIndex)
+        Overlay     ///< Screen-space OverlayVertex layout (20 bytes, stats/debug HUD)
+    };
+
+    /**
+     * @brief Binding description for a vertex format (binding 0, per-vertex rate).
+     */
+    VkVertexInputBindingDescription getVertexBindingDescription(VertexFormat format);
+
+    /**
+     * @brief Attribute descriptions for a vertex format.
+     *
+     * Replaces the single hardcoded Vertex::getAttributeDescriptions: the
+     * five attribute locations (position, color, UV, normal, tangent) are
+     * the same in both mesh formats, only formats and offsets change. The
+     * tables are constexpr data from the VertexFormatTraits registry and
+     * layout-validated against the structs at compile time.
+     */
+    std::vector<VkVertexInputAttributeDescription> getVertexAttributeDescriptions(VertexFormat format);
+
     /**
      * @struct Vertex
      * @brief Represents a single vertex with position, color, texture coordinates, and normal.
@@ -67,6 +103,140 @@ namespace vkeng {
                    tangent == other.tangent;
         }
     };
+
+    /**
+     * @struct CompactVertex
+     * @brief Quantized vertex layout for bandwidth-bound geometry.
+     *
+     * Positions stay full float (quantizing them visibly cracks adjacent
+     * meshes), everything else is packed: color as RGBA8 unorm, UVs as two
+     * half floats, normal and tangent as 10-10-10-2 snorm with the
+     * bitangent sign in the tangent's 2-bit alpha. 28 bytes per vertex
+     * against Vertex's 60, halving vertex fetch bandwidth and VRAM for
+     * geometry that opts in.
+     */
+    struct CompactVertex {
+        glm::vec3 pos;          ///< Full-precision position.
+        uint32_t color = 0;     ///< RGBA8 unorm (VK_FORMAT_R8G8B8A8_UNORM).
+        uint32_t texCoord = 0;  ///< Two half floats (VK_FORMAT_R16G16_SFLOAT).
+        uint32_t normal = 0;    ///< 10-10-10-2 snorm (VK_FORMAT_A2B10G10R10_SNORM_PACK32).
+        uint32_t tangent = 0;   ///< 10-10-10-2 snorm, w = bitangent sign.
+
+        /**
+         * @brief Quantizes a fat vertex into the compact layout.
+         */
+        static CompactVertex pack(const Vertex& vertex);
+    };
+
+    /**
+     * @struct InstanceData
+     * @brief Per-instance vertex stream data for instanced rendering.
+     *
+     * Bound at vertex input binding 1 with per-instance input rate. The model
+     * matrix occupies four consecutive attribute locations (5-8), one vec4
+     * column each, matching shader_instanced.vert.
+     */
+    struct InstanceData {
+        glm::mat4 model{1.0f};  ///< Object-to-world matrix for this instance.
+
+        /**
+         * @brief Gets the binding description for the instance stream.
+         * @return Binding 1 with VK_VERTEX_INPUT_RATE_INSTANCE.
+         */
+        static VkVertexInputBindingDescription getBindingDescription();
+
+        /**
+         * @brief Gets the attribute descriptions for the instance stream.
+         * @return Four vec4 attributes at locations 5-8 (model matrix columns).
+         */
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
+
+    /**
+     * @struct SkinVertex
+     * @brief Per-vertex joint influences for GPU-skinned meshes.
+     *
+     * Bound at vertex input binding 1 with per-vertex rate alongside the
+     * mesh's regular stream on binding 0, so skinning never changes the
+     * Vertex/CompactVertex layouts or the mesh cache format. Four
+     * influences per vertex (industry-standard budget); weights should sum
+     * to 1. Uses locations 5-6 — the same range the instanced stream
+     * occupies, which is fine because a draw is either skinned or
+     * instanced, never both.
+     */
+    struct SkinVertex {
+        glm::uvec4 joints{0};   ///< Palette-relative joint indices.
+        glm::vec4 weights{0.0f}; ///< Blend weights (x holds the remainder if unnormalized).
+
+        /**
+         * @brief Gets the binding description for the skinning stream.
+         * @return Binding 1 with VK_VERTEX_INPUT_RATE_VERTEX.
+         */
+        static VkVertexInputBindingDescription getBindingDescription();
+
+        /**
+         * @brief Gets the attribute descriptions for the skinning stream.
+         * @return Joint indices (uvec4) and weights (vec4) at locations 5-6.
+         */
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
+
+    /**
+     * @struct OverlayVertex
+     * @brief Screen-space vertex for the stats overlay HUD.
+     *
+     * Positions are already in NDC (the CPU bakes the pixel-to-NDC
+     * transform while filling the persistently mapped buffer), so the
+     * overlay vertex shader is a passthrough with no UBO or push
+     * constants. Color is packed RGBA8 to keep the per-frame refill small.
+     */
+    struct OverlayVertex {
+        glm::vec2 pos{0.0f};    ///< Clip-space position (z = 0, w = 1 in the shader)
+        glm::vec2 uv{0.0f};     ///< Font atlas coordinates
+        uint32_t color = 0;     ///< RGBA8 unorm tint (alpha modulates glyph coverage)
+
+        /**
+         * @brief Gets the binding description for the overlay stream.
+         * @return Binding 0 with VK_VERTEX_INPUT_RATE_VERTEX.
+         */
+        static VkVertexInputBindingDescription getBindingDescription();
+
+        /**
+         * @brief Gets the attribute descriptions for the overlay stream.
+         * @return Position, UV, and color attributes at locations 0-2.
+         */
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
+
+    /**
+     * @struct ParticleInstance
+     * @brief Per-particle data shared by the particle simulation and draw.
+     *
+     * One entry per live particle, bound as the only vertex stream
+     * (binding 0) at per-instance rate — the quad corners come from
+     * gl_VertexIndex in particle.vert, so no per-vertex buffer exists.
+     * The same layout backs both paths: the CPU simulation writes evaluated
+     * instances into a host-visible buffer, the compute path ping-pongs
+     * storage buffers of this struct and the draw binds the written one
+     * directly (BufferUsage::StorageVertex).
+     */
+    struct ParticleInstance {
+        glm::vec4 positionAndSize{0.0f};  ///< xyz = world position, w = billboard size
+        glm::vec4 velocityAndLife{0.0f};  ///< xyz = velocity, w = remaining life (<= 0 means dead)
+        glm::vec4 colorAndMaxLife{0.0f};  ///< rgb = current color, w = lifetime at spawn
+
+        /**
+         * @brief Gets the binding description for the particle stream.
+         * @return Binding 0 with VK_VERTEX_INPUT_RATE_INSTANCE.
+         */
+        static VkVertexInputBindingDescription getBindingDescription();
+
+        /**
+         * @brief Gets the attribute descriptions for the particle stream.
+         * @return Three vec4 attributes at locations 0-2, matching particle.vert.
+         */
+        static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions();
+    };
 }
 
 // Hash specialization for Vertex to allow it to be used as a key in unordered containers
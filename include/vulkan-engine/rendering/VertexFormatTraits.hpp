@@ -0,0 +1,183 @@
+/**
+ * @file VertexFormatTraits.hpp
+ * @brief Compile-time registry of vertex formats and their input layouts
+ *
+ * Each VertexFormat is described once, here, as a traits specialization
+ * with constexpr binding and attribute tables. The runtime dispatch
+ * helpers in Vertex.cpp and the per-struct description methods all read
+ * these tables, so a layout exists in exactly one place — and because the
+ * tables are constant expressions, the layout contract is checked when
+ * the engine compiles, not when a pipeline is built:
+ *
+ * - every attribute offset must name a real member of the vertex struct
+ *   (offsetof), so struct edits that drift from the table fail to compile
+ * - the declared stride must equal sizeof the vertex struct
+ * - attribute locations must exactly cover the input locations the
+ *   format's shader family consumes (0-4 for the mesh shaders, 0-2 for
+ *   particle/overlay), so adding or dropping a shader input without
+ *   updating the table is a compile error
+ *
+ * Adding a format: add the enum value in Vertex.hpp, specialize
+ * VertexFormatTraits here, and extend the switch in Vertex.cpp — an
+ * unhandled format fails to compile at the traits lookup, never at draw
+ * time. Fat and compact layouts coexist safely because each pipeline
+ * variant bakes its format's table at creation; the per-draw path carries
+ * no format branching at all.
+ */
+#pragma once
+
+#include "vulkan-engine/rendering/Vertex.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace vkeng {
+
+    /**
+     * @struct VertexFormatTraits
+     * @brief Primary template — intentionally undefined.
+     *
+     * Only the explicit specializations below exist; naming an
+     * unregistered format is a compile error.
+     */
+    template<VertexFormat Format>
+    struct VertexFormatTraits;
+
+    /** @brief Fat layout: full-float attributes, 60 bytes (see Vertex). */
+    template<>
+    struct VertexFormatTraits<VertexFormat::Fat> {
+        using VertexType = Vertex;
+        static constexpr uint32_t kBinding = 0;
+        static constexpr VkVertexInputRate kInputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        static constexpr VkVertexInputAttributeDescription kAttributes[] = {
+            {0, 0, VK_FORMAT_R32G32B32_SFLOAT,    offsetof(Vertex, pos)},
+            {1, 0, VK_FORMAT_R32G32B32_SFLOAT,    offsetof(Vertex, color)},
+            {2, 0, VK_FORMAT_R32G32_SFLOAT,       offsetof(Vertex, texCoord)},
+            {3, 0, VK_FORMAT_R32G32B32_SFLOAT,    offsetof(Vertex, normal)},
+            {4, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(Vertex, tangent)},
+        };
+    };
+
+    /** @brief Compact layout: quantized attributes, 28 bytes (see CompactVertex). */
+    template<>
+    struct VertexFormatTraits<VertexFormat::Compact> {
+        using VertexType = CompactVertex;
+        static constexpr uint32_t kBinding = 0;
+        static constexpr VkVertexInputRate kInputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        static constexpr VkVertexInputAttributeDescription kAttributes[] = {
+            // Position stays full float (quantized positions crack adjacent meshes)
+            {0, 0, VK_FORMAT_R32G32B32_SFLOAT,          offsetof(CompactVertex, pos)},
+            {1, 0, VK_FORMAT_R8G8B8A8_UNORM,            offsetof(CompactVertex, color)},
+            {2, 0, VK_FORMAT_R16G16_SFLOAT,             offsetof(CompactVertex, texCoord)},
+            {3, 0, VK_FORMAT_A2B10G10R10_SNORM_PACK32,  offsetof(CompactVertex, normal)},
+            // Bitangent sign rides the tangent's 2-bit alpha
+            {4, 0, VK_FORMAT_A2B10G10R10_SNORM_PACK32,  offsetof(CompactVertex, tangent)},
+        };
+    };
+
+    /** @brief Particle stream: per-instance rate, corners from gl_VertexIndex. */
+    template<>
+    struct VertexFormatTraits<VertexFormat::Particle> {
+        using VertexType = ParticleInstance;
+        static constexpr uint32_t kBinding = 0;
+        static constexpr VkVertexInputRate kInputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        static constexpr VkVertexInputAttributeDescription kAttributes[] = {
+            {0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ParticleInstance, positionAndSize)},
+            {1, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ParticleInstance, velocityAndLife)},
+            {2, 0, VK_FORMAT_R32G32B32A32_SFLOAT, offsetof(ParticleInstance, colorAndMaxLife)},
+        };
+    };
+
+    /** @brief Overlay stream: NDC positions, packed RGBA8 color (stats HUD). */
+    template<>
+    struct VertexFormatTraits<VertexFormat::Overlay> {
+        using VertexType = OverlayVertex;
+        static constexpr uint32_t kBinding = 0;
+        static constexpr VkVertexInputRate kInputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        static constexpr VkVertexInputAttributeDescription kAttributes[] = {
+            {0, 0, VK_FORMAT_R32G32_SFLOAT,  offsetof(OverlayVertex, pos)},
+            {1, 0, VK_FORMAT_R32G32_SFLOAT,  offsetof(OverlayVertex, uv)},
+            {2, 0, VK_FORMAT_R8G8B8A8_UNORM, offsetof(OverlayVertex, color)},
+        };
+    };
+
+    // ============================================================================
+    // Constexpr accessors
+    // ============================================================================
+
+    /** @brief Number of attributes a format declares. */
+    template<VertexFormat Format>
+    constexpr uint32_t vertexAttributeCount() {
+        return static_cast<uint32_t>(sizeof(VertexFormatTraits<Format>::kAttributes) /
+                                     sizeof(VkVertexInputAttributeDescription));
+    }
+
+    /** @brief Binding description built from a format's traits. */
+    template<VertexFormat Format>
+    constexpr VkVertexInputBindingDescription vertexBindingDescription() {
+        using Traits = VertexFormatTraits<Format>;
+        return {Traits::kBinding,
+                static_cast<uint32_t>(sizeof(typename Traits::VertexType)),
+                Traits::kInputRate};
+    }
+
+    // ============================================================================
+    // Compile-time layout validation
+    // ============================================================================
+
+    namespace detail {
+        /** @brief True if every attribute offset lies inside the vertex struct. */
+        template<VertexFormat Format>
+        constexpr bool attributesFitStride() {
+            for (uint32_t i = 0; i < vertexAttributeCount<Format>(); i++) {
+                if (VertexFormatTraits<Format>::kAttributes[i].offset >=
+                    sizeof(typename VertexFormatTraits<Format>::VertexType)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief True if the table declares exactly locations [0, count),
+         * in order, on the format's binding — the contract the format's
+         * shader family compiles against.
+         */
+        template<VertexFormat Format>
+        constexpr bool attributesCoverLocations(uint32_t count) {
+            if (vertexAttributeCount<Format>() != count) return false;
+            for (uint32_t i = 0; i < count; i++) {
+                if (VertexFormatTraits<Format>::kAttributes[i].location != i) return false;
+                if (VertexFormatTraits<Format>::kAttributes[i].binding !=
+                    VertexFormatTraits<Format>::kBinding) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    // Mesh shader family (shader.vert, shader_instanced.vert, depth pre-pass)
+    // consumes locations 0-4; both mesh layouts must satisfy it identically.
+    static_assert(detail::attributesCoverLocations<VertexFormat::Fat>(5),
+                  "Fat layout must declare shader inputs 0-4");
+    static_assert(detail::attributesCoverLocations<VertexFormat::Compact>(5),
+                  "Compact layout must declare shader inputs 0-4");
+    static_assert(detail::attributesCoverLocations<VertexFormat::Particle>(3),
+                  "Particle layout must declare particle.vert inputs 0-2");
+    static_assert(detail::attributesCoverLocations<VertexFormat::Overlay>(3),
+                  "Overlay layout must declare overlay.vert inputs 0-2");
+
+    static_assert(detail::attributesFitStride<VertexFormat::Fat>() &&
+                  detail::attributesFitStride<VertexFormat::Compact>() &&
+                  detail::attributesFitStride<VertexFormat::Particle>() &&
+                  detail::attributesFitStride<VertexFormat::Overlay>(),
+                  "Vertex attribute offsets must lie inside their struct");
+
+    static_assert(sizeof(Vertex) == 60, "Fat vertex stride drifted (shaders assume 60 bytes)");
+    static_assert(sizeof(CompactVertex) == 28, "Compact vertex stride drifted (shaders assume 28 bytes)");
+    static_assert(sizeof(ParticleInstance) == 48, "Particle instance stride drifted (sim shader assumes 48 bytes)");
+    static_assert(sizeof(OverlayVertex) == 20, "Overlay vertex stride drifted (overlay refill assumes 20 bytes)");
+
+} // namespace vkeng
@@ -0,0 +1,336 @@
+/**
+ * @file LoadTask.hpp
+ * @brief Chainable async tasks for asset load orchestration
+ *
+ * Async loading across ResourceManager, MeshLoader, and TextureLoader
+ * breeds callback pyramids: load-the-mesh, then-load-its-textures,
+ * then-build-descriptors, each nested inside the last. LoadTask flattens
+ * that into explicit chains over the job system. The engine builds as
+ * C++17, so this is continuation-passing rather than C++20 coroutines —
+ * the chains read top-to-bottom all the same.
+ *
+ * Key Task Concepts:
+ * - LoadTask<T>: shared handle to an eventual value; copies are cheap and
+ *   all observe the same completion
+ * - then(): schedules the next step when the value arrives, on the thread
+ *   class the step needs — Worker for I/O and parsing, Main for anything
+ *   that touches GPU submission or the scene graph
+ * - LoadTaskGroup: batched awaiting — add every task of a scene section
+ *   and get one callback when the whole batch has landed
+ * - LoadTaskScheduler: routes Worker steps to the JobSystem and queues
+ *   Main steps for pumpMainThread(), called once per frame by the engine
+ *
+ * Usage:
+ * @code
+ *   loadResourceTask<Mesh>("models/crate.obj")
+ *       .then(TaskThread::Worker, [](const std::shared_ptr<Mesh>& mesh) {
+ *           return buildCollisionHull(mesh);      // heavy, off-thread
+ *       })
+ *       .onReady(TaskThread::Main, [](const Hull& hull) {
+ *           attachToScene(hull);                  // scene graph: main thread
+ *       });
+ * @endcode
+ */
+#pragma once
+
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/StringId.hpp"
+#include "vulkan-engine/resources/ResourceManager.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vkeng {
+
+    /** @brief Thread class a task step runs on. */
+    enum class TaskThread {
+        Worker, ///< Job system pool: disk I/O, decode, mesh processing
+        Main    ///< Engine main thread: GPU submission, scene graph mutation
+    };
+
+    /**
+     * @class LoadTaskScheduler
+     * @brief Routes task continuations to their target thread
+     *
+     * Worker steps go straight to the JobSystem. Main steps queue here and
+     * run from pumpMainThread(), which the engine loop calls once per frame
+     * right after ResourceManager::pumpCompletedLoads() — so a resource
+     * published this frame reaches its continuations the same frame.
+     */
+    class LoadTaskScheduler {
+    public:
+        static LoadTaskScheduler& get();
+
+        /** @brief Run @p fn on the given thread class (Main = next pump). */
+        void dispatch(TaskThread thread, std::function<void()> fn);
+
+        /**
+         * @brief Register a poll run every pump until it returns true.
+         *
+         * Used to bridge publish-by-pump APIs (ResourceManager handles)
+         * into task completions without adding callbacks to the manager.
+         */
+        void addPoll(std::function<bool()> poll);
+
+        /** @brief Drain queued main-thread steps and pending polls (engine loop). */
+        void pumpMainThread();
+
+    private:
+        LoadTaskScheduler() = default;
+
+        std::mutex m_mutex;
+        std::vector<std::function<void()>> m_mainQueue;
+        std::vector<std::function<bool()>> m_polls;
+    };
+
+    /**
+     * @class LoadTask
+     * @brief Shared handle to a value that arrives asynchronously
+     *
+     * Default-constructed tasks are invalid. Producers create one with
+     * makePending() and call complete(); consumers chain with then() or
+     * finish with onReady(). Completion is sticky: steps attached after the
+     * value arrived run immediately (via their target thread).
+     */
+    template<typename T>
+    class LoadTask {
+    public:
+        LoadTask() = default;
+
+        /** @brief Create an unresolved task; the producer calls complete(). */
+        static LoadTask makePending() {
+            LoadTask task;
+            task.m_state = std::make_shared<State>();
+            return task;
+        }
+
+        /** @brief Schedule @p fn on @p thread; its return value completes the task. */
+        static LoadTask run(TaskThread thread, std::function<T()> fn) {
+            LoadTask task = makePending();
+            LoadTaskScheduler::get().dispatch(thread, [task, fn = std::move(fn)]() mutable {
+                task.complete(fn());
+            });
+            return task;
+        }
+
+        bool isValid() const { return m_state != nullptr; }
+
+        /** @brief Whether the value has arrived. */
+        bool isReady() const {
+            if (!m_state) return false;
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            return m_state->value.has_value();
+        }
+
+        /** @brief The value if ready, null otherwise. */
+        const T* tryGet() const {
+            if (!m_state) return nullptr;
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            return m_state->value.has_value() ? &*m_state->value : nullptr;
+        }
+
+        /**
+         * @brief Resolve the task (producer side); runs queued steps.
+         *
+         * Completing twice is a no-op — the first value wins.
+         */
+        void complete(T value) const {
+            std::vector<Continuation> pending;
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                if (m_state->value.has_value()) return;
+                m_state->value.emplace(std::move(value));
+                pending = std::move(m_state->continuations);
+                m_state->continuations.clear();
+            }
+            for (Continuation& continuation : pending) {
+                dispatchContinuation(std::move(continuation));
+            }
+        }
+
+        /**
+         * @brief Attach a terminal step run on @p thread with the value.
+         *
+         * Runs immediately (via the target thread) if already complete.
+         */
+        void onReady(TaskThread thread, std::function<void(const T&)> fn) const {
+            Continuation continuation{thread, std::move(fn)};
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                if (!m_state->value.has_value()) {
+                    m_state->continuations.push_back(std::move(continuation));
+                    return;
+                }
+            }
+            dispatchContinuation(std::move(continuation));
+        }
+
+        /**
+         * @brief Chain a transforming step; returns the task for its result.
+         * @param thread Thread class the step runs on
+         * @param fn Callable taking (const T&) and returning the next value
+         *
+         * Terminal (void) steps use onReady() instead.
+         */
+        template<typename Fn>
+        auto then(TaskThread thread, Fn&& fn) const
+            -> LoadTask<std::invoke_result_t<Fn, const T&>> {
+            using U = std::invoke_result_t<Fn, const T&>;
+            static_assert(!std::is_void_v<U>,
+                          "then() steps must produce a value; use onReady() for terminal steps");
+
+            auto next = LoadTask<U>::makePending();
+            onReady(thread, [next, fn = std::forward<Fn>(fn)](const T& value) mutable {
+                next.complete(fn(value));
+            });
+            return next;
+        }
+
+    private:
+        struct Continuation {
+            TaskThread thread;
+            std::function<void(const T&)> fn;
+        };
+
+        /** @brief Value plus the steps waiting on it; shared by all copies. */
+        struct State {
+            std::mutex mutex;
+            std::optional<T> value;
+            std::vector<Continuation> continuations;
+        };
+
+        /** @brief Route one step to its thread; the value stays alive in the state. */
+        void dispatchContinuation(Continuation continuation) const {
+            auto state = m_state;
+            LoadTaskScheduler::get().dispatch(continuation.thread,
+                [state, fn = std::move(continuation.fn)]() { fn(*state->value); });
+        }
+
+        std::shared_ptr<State> m_state;
+    };
+
+    /**
+     * @class LoadTaskGroup
+     * @brief Batched awaiting: one callback when every added task is done
+     *
+     * Add each task of a scene section as it is kicked off, then call
+     * onAllReady() once — the callback fires (on its target thread) when
+     * the last task lands, or immediately if everything already finished.
+     * Tasks may complete in any order and on any thread.
+     */
+    class LoadTaskGroup {
+    public:
+        LoadTaskGroup() : m_state(std::make_shared<State>()) {}
+
+        /** @brief Track a task; must precede onAllReady(). */
+        template<typename T>
+        void add(const LoadTask<T>& task) {
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                m_state->pending++;
+            }
+            auto state = m_state;
+            task.onReady(TaskThread::Worker, [state](const T&) {
+                std::vector<Callback> fire;
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    state->pending--;
+                    if (state->pending == 0 && state->sealed) {
+                        fire = std::move(state->callbacks);
+                        state->callbacks.clear();
+                    }
+                }
+                for (Callback& callback : fire) {
+                    LoadTaskScheduler::get().dispatch(callback.thread, std::move(callback.fn));
+                }
+            });
+        }
+
+        /**
+         * @brief Register the batch-complete callback and seal the group.
+         *
+         * Tasks added after sealing are not counted.
+         */
+        void onAllReady(TaskThread thread, std::function<void()> fn) {
+            bool fireNow = false;
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                m_state->sealed = true;
+                if (m_state->pending == 0) {
+                    fireNow = true;
+                } else {
+                    m_state->callbacks.push_back({thread, std::move(fn)});
+                }
+            }
+            if (fireNow) {
+                LoadTaskScheduler::get().dispatch(thread, std::move(fn));
+            }
+        }
+
+        /** @brief Tasks still outstanding (diagnostics / progress bars). */
+        uint32_t pendingCount() const {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            return m_state->pending;
+        }
+
+    private:
+        struct Callback {
+            TaskThread thread;
+            std::function<void()> fn;
+        };
+
+        struct State {
+            mutable std::mutex mutex;
+            uint32_t pending = 0;
+            bool sealed = false;
+            std::vector<Callback> callbacks;
+        };
+
+        std::shared_ptr<State> m_state;
+    };
+
+    /**
+     * @brief Load a resource through ResourceManager as an awaitable task.
+     * @tparam T Resource type with a registered loader (Mesh, Texture, ...)
+     * @param path Asset path; identical paths share the underlying load
+     * @return Task completing with the resource, or null if the load failed
+     *
+     * Wraps loadResourceAsync(): the actual I/O, parsing, and upload run on
+     * the manager's loader workers as before; a per-frame poll bridges the
+     * pump-published handle into the task. Failure is detected when the
+     * manager releases the path reservation without publishing.
+     */
+    template<typename T>
+    LoadTask<std::shared_ptr<T>> loadResourceTask(const std::string& path) {
+        auto handle = ResourceManager::get().loadResourceAsync<T>(path);
+        auto task = LoadTask<std::shared_ptr<T>>::makePending();
+        if (!handle.isValid()) {
+            task.complete(nullptr); // no loader for the path
+            return task;
+        }
+
+        LoadTaskScheduler::get().addPoll([handle, path, task]() -> bool {
+            auto resource = ResourceManager::get().getResource(handle);
+            if (resource) {
+                task.complete(std::move(resource));
+                return true;
+            }
+            // The path reservation is held for the whole flight; if it no
+            // longer maps to our handle the load failed and was retired
+            auto current = ResourceManager::get().findResource<T>(StringId(path));
+            if (current.getId() != handle.getId()) {
+                task.complete(nullptr);
+                return true;
+            }
+            return false;
+        });
+        return task;
+    }
+
+} // namespace vkeng
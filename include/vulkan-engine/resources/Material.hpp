@@ -40,6 +40,26 @@ struct MaterialTextures {
     std::shared_ptr<Texture> emissive;
 };
 
+/**
+ * @struct MaterialParameterBlock
+ * @brief GPU-ready packed factor block, mirroring the material portion of
+ *        MeshPushConstants / GpuDrawData
+ *
+ * Materials keep this as a shadow copy of their factors, repacked only
+ * when a setter dirties it. The renderer copies the block verbatim into
+ * each draw's push constants (or GpuDrawData entry) instead of
+ * re-deriving the alpha-cutoff packing and atlas UV remap per draw per
+ * frame — with animated material factors on dozens of materials the
+ * repack happens once per changed material, not once per draw.
+ */
+struct MaterialParameterBlock {
+    glm::vec4 baseColorFactor{1.f, 1.f, 1.f, 1.f};              ///< Base color multiplier and alpha
+    glm::vec4 emissiveFactor{0.f, 0.f, 0.f, 0.f};               ///< Emissive (rgb) + alphaCutoff (a, 0 unless Mask)
+    glm::vec4 specularColorAndShininess{0.35f, 0.35f, 0.35f, 32.f}; ///< Specular color (rgb) and shininess (a)
+    glm::vec4 pbrFactors{0.f, 1.f, 1.f, 1.f};                   ///< metallic, roughness, normalScale, occlusionStrength
+    glm::vec4 uvScaleOffset{1.f, 1.f, 0.f, 0.f};                ///< Texture atlas UV transform: uv * xy + zw
+};
+
 class Material : public Resource {
 public:
     explicit Material(const std::string& name,
@@ -48,33 +68,33 @@ public:
                       MaterialTextures textures = {});
 
     const MaterialFactors& getFactors() const { return m_factors; }
-    MaterialFactors& getFactors() { return m_factors; }
-    void setFactors(const MaterialFactors& factors) { m_factors = factors; }
+    MaterialFactors& getFactors() { m_parametersDirty = true; return m_factors; }
+    void setFactors(const MaterialFactors& factors) { m_factors = factors; m_parametersDirty = true; }
 
     AlphaMode getAlphaMode() const { return m_alphaMode; }
-    void setAlphaMode(AlphaMode alphaMode) { m_alphaMode = alphaMode; }
+    void setAlphaMode(AlphaMode alphaMode) { m_alphaMode = alphaMode; m_parametersDirty = true; }
 
     const MaterialTextures& getTextures() const { return m_textures; }
-    MaterialTextures& getTextures() { return m_textures; }
-    void setTextures(const MaterialTextures& textures) { m_textures = textures; }
-
-    void setBaseColorFactor(const glm::vec4& baseColorFactor) { m_factors.baseColorFactor = baseColorFactor; }
-    void setEmissiveFactor(const glm::vec3& emissiveFactor) { m_factors.emissiveFactor = emissiveFactor; }
-    void setSpecularColor(const glm::vec3& specularColor) { m_factors.specularColor = specularColor; }
-    void setMetallicFactor(float metallicFactor) { m_factors.metallicFactor = metallicFactor; }
-    void setRoughnessFactor(float roughnessFactor) { m_factors.roughnessFactor = roughnessFactor; }
-    void setNormalScale(float normalScale) { m_factors.normalScale = normalScale; }
-    void setOcclusionStrength(float occlusionStrength) { m_factors.occlusionStrength = occlusionStrength; }
-    void setAlphaCutoff(float alphaCutoff) { m_factors.alphaCutoff = alphaCutoff; }
-    void setShininess(float shininess) { m_factors.shininess = shininess; }
-    void setDoubleSided(bool doubleSided) { m_factors.doubleSided = doubleSided; }
-    void setUnlit(bool unlit) { m_factors.unlit = unlit; }
-
-    void setBaseColorTexture(std::shared_ptr<Texture> texture) { m_textures.baseColor = std::move(texture); }
-    void setNormalTexture(std::shared_ptr<Texture> texture) { m_textures.normal = std::move(texture); }
-    void setMetallicRoughnessTexture(std::shared_ptr<Texture> texture) { m_textures.metallicRoughness = std::move(texture); }
-    void setOcclusionTexture(std::shared_ptr<Texture> texture) { m_textures.occlusion = std::move(texture); }
-    void setEmissiveTexture(std::shared_ptr<Texture> texture) { m_textures.emissive = std::move(texture); }
+    MaterialTextures& getTextures() { m_parametersDirty = true; return m_textures; }
+    void setTextures(const MaterialTextures& textures) { m_textures = textures; m_parametersDirty = true; }
+
+    void setBaseColorFactor(const glm::vec4& baseColorFactor) { m_factors.baseColorFactor = baseColorFactor; m_parametersDirty = true; }
+    void setEmissiveFactor(const glm::vec3& emissiveFactor) { m_factors.emissiveFactor = emissiveFactor; m_parametersDirty = true; }
+    void setSpecularColor(const glm::vec3& specularColor) { m_factors.specularColor = specularColor; m_parametersDirty = true; }
+    void setMetallicFactor(float metallicFactor) { m_factors.metallicFactor = metallicFactor; m_parametersDirty = true; }
+    void setRoughnessFactor(float roughnessFactor) { m_factors.roughnessFactor = roughnessFactor; m_parametersDirty = true; }
+    void setNormalScale(float normalScale) { m_factors.normalScale = normalScale; m_parametersDirty = true; }
+    void setOcclusionStrength(float occlusionStrength) { m_factors.occlusionStrength = occlusionStrength; m_parametersDirty = true; }
+    void setAlphaCutoff(float alphaCutoff) { m_factors.alphaCutoff = alphaCutoff; m_parametersDirty = true; }
+    void setShininess(float shininess) { m_factors.shininess = shininess; m_parametersDirty = true; }
+    void setDoubleSided(bool doubleSided) { m_factors.doubleSided = doubleSided; m_parametersDirty = true; }
+    void setUnlit(bool unlit) { m_factors.unlit = unlit; m_parametersDirty = true; }
+
+    void setBaseColorTexture(std::shared_ptr<Texture> texture) { m_textures.baseColor = std::move(texture); m_parametersDirty = true; }
+    void setNormalTexture(std::shared_ptr<Texture> texture) { m_textures.normal = std::move(texture); m_parametersDirty = true; }
+    void setMetallicRoughnessTexture(std::shared_ptr<Texture> texture) { m_textures.metallicRoughness = std::move(texture); m_parametersDirty = true; }
+    void setOcclusionTexture(std::shared_ptr<Texture> texture) { m_textures.occlusion = std::move(texture); m_parametersDirty = true; }
+    void setEmissiveTexture(std::shared_ptr<Texture> texture) { m_textures.emissive = std::move(texture); m_parametersDirty = true; }
 
     bool hasAnyTexture() const;
 
@@ -91,11 +111,47 @@ public:
                              std::shared_ptr<DescriptorSetLayout> layout,
                              const FallbackTextures& fallbacks);
 
+    /**
+     * @brief Get this material's packed bindless texture array indices.
+     *
+     * Lazily registers the material's textures with the
+     * BindlessTextureManager on first call; missing slots resolve to the
+     * reserved fallback indices. Packing matches BindlessPushConstants:
+     * x = baseColor | (normal << 16), y = metallicRoughness |
+     * (occlusion << 16), z = emissive, w reserved.
+     *
+     * Only meaningful in bindless mode (manager must be initialized).
+     */
+    glm::uvec4 getBindlessIndices();
+
+    /**
+     * @brief UV transform for atlas sub-region textures: uv * xy + zw.
+     *
+     * Derived from the base color texture's atlas region (identity when the
+     * material has no textures or they are not atlased). The renderer copies
+     * this into MeshPushConstants::uvScaleOffset per draw.
+     */
+    glm::vec4 getUvScaleOffset() const;
+
+    /**
+     * @brief Packed GPU factor block, repacked lazily after mutation.
+     *
+     * Every factor/texture setter (and the mutable getFactors() /
+     * getTextures() accessors, conservatively) marks the block dirty;
+     * the next call repacks once. The renderer copies the block into
+     * each draw instead of re-deriving it.
+     */
+    const MaterialParameterBlock& getParameterBlock() const;
+
 private:
     MaterialFactors m_factors;
     AlphaMode m_alphaMode = AlphaMode::Opaque;
     MaterialTextures m_textures;
     VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE;
+    glm::uvec4 m_bindlessIndices{0, 0, 0, 0}; ///< Cached packed indices (valid when registered)
+    bool m_bindlessRegistered = false;        ///< Textures registered with the bindless array
+    mutable MaterialParameterBlock m_parameterBlock; ///< Shadow copy of the packed factors
+    mutable bool m_parametersDirty = true;    ///< Block needs repacking before next use
 };
 
 } // namespace vkeng
\ No newline at end of file
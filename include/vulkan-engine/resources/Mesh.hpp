@@ -1,7 +1,10 @@
 #pragma once
 
+#include "vulkan-engine/core/Handle.hpp"
 #include "vulkan-engine/core/MemoryManager.hpp"
 #include "vulkan-engine/rendering/Vertex.hpp"
+#include "vulkan-engine/resources/MeshBufferPool.hpp"
+#include "vulkan-engine/resources/MeshletBuilder.hpp"
 #include "vulkan-engine/resources/ResourceManager.hpp" // <-- Add include
 #include <glm/glm.hpp>
 #include <memory>
@@ -21,12 +24,73 @@ public:
     // The constructor now takes a name to pass to the Resource base class
     Mesh(const std::string& name,
          std::shared_ptr<MemoryManager> memoryManager,
-         const std::vector<Vertex>& vertices, 
+         const std::vector<Vertex>& vertices,
             const std::vector<uint32_t>& indices,
-            MeshNormalSource normalSource = MeshNormalSource::Authored);
+            MeshNormalSource normalSource = MeshNormalSource::Authored,
+            VertexFormat vertexFormat = VertexFormat::Fat);
+
+    /**
+     * @brief Zero-copy constructor for pre-baked data with known bounds.
+     *
+     * Uploads straight from the given pointers (e.g. a memory-mapped
+     * .vkmesh cache) without building intermediate vectors or re-scanning
+     * the vertices for bounds. The pointers only need to stay valid for
+     * the duration of the constructor.
+     */
+    Mesh(const std::string& name,
+         std::shared_ptr<MemoryManager> memoryManager,
+         const Vertex* vertices, size_t vertexCount,
+         const uint32_t* indices, size_t indexCount,
+         MeshNormalSource normalSource,
+         const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+         float boundingRadius,
+         VertexFormat vertexFormat = VertexFormat::Fat);
+
+    /** @brief Frees the mesh's pool ranges (dedicated buffers are RAII). */
+    ~Mesh();
+
+    // Copying would double-free the pool ranges; meshes are shared by pointer
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
 
     void bind(VkCommandBuffer commandBuffer);
     uint32_t getIndexCount() const { return m_indexCount; }
+
+    /**
+     * @brief The vertex layout this mesh uploaded (drives pipeline selection).
+     *
+     * Compact meshes quantize normals/tangents to 10-10-10-2 snorm and UVs
+     * to half floats; the renderer must draw them with a pipeline variant
+     * whose PipelineConfig::vertexFormat matches.
+     */
+    VertexFormat getVertexFormat() const { return m_vertexFormat; }
+
+    /** @brief Index type bound by bind(); UINT16 when the vertex count permits. */
+    VkIndexType getIndexType() const { return m_indexType; }
+
+    /**
+     * @brief Whether the geometry lives in the shared MeshBufferPool.
+     *
+     * Pooled meshes in the same block share buffer bindings, so draws
+     * sorted by block skip redundant vkCmdBindVertexBuffers calls; the
+     * offsets below feed the indirect-draw path.
+     */
+    bool isPooled() const { return m_poolAllocation.isValid(); }
+
+    /** @brief Pool block the geometry lives in (pooled meshes only). */
+    uint32_t getPoolBlock() const { return m_poolAllocation.blockIndex; }
+
+    /** @brief Byte offset of the vertices in the block's vertex buffer. */
+    VkDeviceSize getVertexOffset() const { return m_poolAllocation.vertexOffset; }
+
+    /** @brief Byte offset of the indices in the block's index buffer. */
+    VkDeviceSize getIndexOffset() const { return m_poolAllocation.indexOffset; }
+
+    /** @brief Dedicated vertex buffer (null when pooled). */
+    const std::shared_ptr<Buffer>& getVertexBuffer() const { return m_vertexBuffer; }
+
+    /** @brief Dedicated index buffer (null when pooled). */
+    const std::shared_ptr<Buffer>& getIndexBuffer() const { return m_indexBuffer; }
     const glm::vec3& getBoundsMin() const { return m_boundsMin; }
     const glm::vec3& getBoundsMax() const { return m_boundsMax; }
     glm::vec3 getBoundsCenter() const { return (m_boundsMin + m_boundsMax) * 0.5f; }
@@ -34,20 +98,124 @@ public:
         MeshNormalSource getNormalSource() const { return m_normalSource; }
         bool usesGeneratedNormals() const { return m_normalSource != MeshNormalSource::Authored; }
 
+    /**
+     * @brief Whether the CPU-side copy of the geometry is still held.
+     *
+     * Both constructors retain a CPU copy so StaticBatcher can bake merged
+     * meshes at scene finalize; releaseCpuData() frees it afterwards.
+     */
+    bool hasCpuData() const { return !m_cpuVertices.empty(); }
+    const std::vector<Vertex>& getCpuVertices() const { return m_cpuVertices; }
+    const std::vector<uint32_t>& getCpuIndices() const { return m_cpuIndices; }
+
+    /** @brief Frees the CPU-side geometry copy (GPU buffers are unaffected). */
+    void releaseCpuData() {
+        m_cpuVertices = std::vector<Vertex>();
+        m_cpuIndices = std::vector<uint32_t>();
+    }
+
+    // ========================================================================
+    // GPU Residency
+    //
+    // MeshResidencyManager evicts the GPU buffers of meshes that have not
+    // been drawn for a while, using the retained CPU copy as the reload
+    // source. Meshes that released their CPU data are never evicted.
+    // ========================================================================
+
+    /** @brief Whether the geometry currently lives on the GPU. */
+    bool isResident() const { return m_poolAllocation.isValid() || m_vertexBuffer != nullptr; }
+
+    /** @brief GPU bytes the geometry occupies when resident (vertex + index). */
+    uint64_t getGpuBytes() const { return m_gpuBytes; }
+
+    /**
+     * @brief Frees the GPU buffers, keeping the CPU copy as reload source.
+     *
+     * No-op when the CPU copy was released or the mesh is already evicted.
+     * The caller must guarantee no in-flight frame still references the
+     * buffers — MeshResidencyManager only evicts meshes idle for longer
+     * than the frames-in-flight window.
+     */
+    void evictGpuData();
+
+    /** @brief Re-uploads evicted geometry from the CPU copy; no-op if resident. */
+    void ensureResident();
+
+    /** @brief Stamps the frame this mesh was last drawn (LRU eviction input). */
+    void noteUsed(uint64_t frame) { m_lastUsedFrame = frame; }
+
+    /** @brief Frame stamp of the most recent draw; see noteUsed(). */
+    uint64_t getLastUsedFrame() const { return m_lastUsedFrame; }
+
+    /**
+     * @brief Attaches a chain of simplified meshes for distant rendering.
+     * @param lods Reduction levels, finest first; this mesh is level 0.
+     *
+     * Built at import time by MeshLoader; MeshRenderer::selectLod() picks a
+     * level per frame from the projected screen size.
+     */
+    void setLodChain(std::vector<std::shared_ptr<Mesh>> lods) { m_lods = std::move(lods); }
+
+    /** @brief Number of reduction levels beyond this mesh (0 = no LODs). */
+    size_t getLodCount() const { return m_lods.size(); }
+
+    /** @brief Reduction level by index; 0 is the first level coarser than this mesh. */
+    const std::shared_ptr<Mesh>& getLod(size_t level) const { return m_lods[level]; }
+
+    /**
+     * @brief Attaches the import-time meshlet decomposition.
+     *
+     * Built by MeshLoader (and round-tripped through the .vkmesh cache);
+     * MeshletRenderer uploads it lazily when the mesh-shading path draws
+     * this mesh. Kept CPU-side only — meshes never touched by that path
+     * pay nothing beyond the vectors.
+     */
+    void setMeshlets(MeshletData meshlets) { m_meshlets = std::move(meshlets); }
+
+    /** @brief Whether a meshlet decomposition is attached. */
+    bool hasMeshlets() const { return !m_meshlets.empty(); }
+
+    /** @brief The meshlet decomposition; empty() when none was built. */
+    const MeshletData& getMeshlets() const { return m_meshlets; }
+
+    /**
+     * @brief Non-owning 32-bit handle to this mesh for draw-path storage.
+     *
+     * Copies freely without touching the shared_ptr refcount; resolves to
+     * nullptr once the mesh is destroyed. Ownership stays with the
+     * shared_ptr held by ResourceManager and the scene.
+     */
+    Handle<Mesh> getHandle() const { return m_handle; }
+
 private:
     void calculateBounds(const std::vector<Vertex>& vertices);
-    void createVertexBuffers(const std::vector<Vertex>& vertices);
-    void createIndexBuffers(const std::vector<uint32_t>& indices);
+    void createBuffers(const Vertex* vertices, size_t vertexCount,
+                       const uint32_t* indices, size_t indexCount);
+    void createVertexBuffers(const void* vertexData, VkDeviceSize vertexBytes);
+    void createIndexBuffers(const void* indexData, VkDeviceSize indexBytes);
 
     std::shared_ptr<MemoryManager> m_memoryManager;
-    std::shared_ptr<Buffer> m_vertexBuffer;
-    std::shared_ptr<Buffer> m_indexBuffer;
+    std::shared_ptr<Buffer> m_vertexBuffer;   ///< Dedicated buffer (unpooled meshes only)
+    std::shared_ptr<Buffer> m_indexBuffer;    ///< Dedicated buffer (unpooled meshes only)
+    MeshPoolAllocation m_poolAllocation;      ///< Ranges in the shared pool, if pooled
+    std::vector<Vertex> m_cpuVertices;    ///< Retained for static batching; see releaseCpuData()
+    std::vector<uint32_t> m_cpuIndices;
+    std::vector<std::shared_ptr<Mesh>> m_lods;  ///< Simplified levels, finest first
+    MeshletData m_meshlets;               ///< Import-time clusters for the mesh-shading path
     glm::vec3 m_boundsMin{0.0f};
     glm::vec3 m_boundsMax{0.0f};
     float m_boundingRadius = 0.0f;
     uint32_t m_vertexCount = 0;
     uint32_t m_indexCount = 0;
+    uint64_t m_gpuBytes = 0;        ///< Uploaded vertex + index bytes (post-quantization)
+    uint64_t m_lastUsedFrame = 0;   ///< Frame stamp of the most recent draw
     MeshNormalSource m_normalSource = MeshNormalSource::Authored;
+    VertexFormat m_vertexFormat = VertexFormat::Fat;
+    VkIndexType m_indexType = VK_INDEX_TYPE_UINT32; ///< UINT16 when vertex count <= 65535
+    Handle<Mesh> m_handle;          ///< Pool registration; released in the destructor
 };
 
+/// Draw-path alias: non-owning, generation-checked reference to a Mesh
+using MeshHandle = Handle<Mesh>;
+
 } // namespace vkeng
\ No newline at end of file
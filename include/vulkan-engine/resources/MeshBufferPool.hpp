@@ -0,0 +1,166 @@
+/**
+ * @file MeshBufferPool.hpp
+ * @brief Pooled vertex/index storage with per-mesh suballocation
+ *
+ * Every mesh used to own a dedicated VkBuffer pair, so a scene with
+ * thousands of meshes meant thousands of tiny VMA allocations and a
+ * different vertex buffer bound per draw. The pool instead carves mesh
+ * geometry out of a few large device-local buffers: meshes become
+ * (block, offset) pairs, draws sorted by block share a single
+ * vkCmdBindVertexBuffers call, and all geometry in one block is
+ * addressable by offset — a prerequisite for indirect multi-draw.
+ *
+ * Key Concepts:
+ * - Block: one large vertex buffer + index buffer pair. Most scenes fit
+ *   in a single block; a new one is added when the current blocks are
+ *   full, and oversized meshes get a block sized to fit
+ * - Free List: each block tracks its free byte ranges sorted by offset;
+ *   freeing a mesh coalesces the range with adjacent free neighbours, so
+ *   space from unloaded meshes is compacted back into large spans
+ * - Fallback: meshes created before initialize() (or after clear())
+ *   keep the old dedicated-buffer path; Mesh::bind() handles both
+ */
+#pragma once
+
+#include "vulkan-engine/core/MemoryManager.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @struct MeshPoolAllocation
+     * @brief A mesh's byte ranges inside one pool block
+     *
+     * Stored by Mesh and handed back to free() on destruction. A
+     * default-constructed allocation is invalid and means the mesh owns
+     * dedicated buffers instead.
+     */
+    struct MeshPoolAllocation {
+        uint32_t blockIndex = UINT32_MAX;   ///< Pool block the ranges live in
+        VkDeviceSize vertexOffset = 0;      ///< Byte offset into the block's vertex buffer
+        VkDeviceSize vertexSize = 0;        ///< Allocated vertex bytes (alignment-padded)
+        VkDeviceSize indexOffset = 0;       ///< Byte offset into the block's index buffer
+        VkDeviceSize indexSize = 0;         ///< Allocated index bytes (alignment-padded)
+
+        bool isValid() const { return blockIndex != UINT32_MAX; }
+    };
+
+    /**
+     * @class MeshBufferPool
+     * @brief Singleton pool of large device-local mesh buffers
+     *
+     * Follows the TextureResidencyManager pattern: the Engine wires it to
+     * the MemoryManager during Vulkan init and clears it during shutdown.
+     * Thread-safe — meshes are created from job-system loader threads.
+     */
+    class MeshBufferPool {
+    public:
+        /** @brief Gets the singleton instance. */
+        static MeshBufferPool& get();
+
+        /**
+         * @brief Wires the pool to the memory manager.
+         * @param memoryManager Allocator the block buffers come from
+         * @param vertexBlockBytes Vertex capacity per block
+         * @param indexBlockBytes Index capacity per block
+         *
+         * Blocks are created lazily on first allocation, so enabling the
+         * pool costs nothing until a mesh is uploaded.
+         */
+        void initialize(std::shared_ptr<MemoryManager> memoryManager,
+                        VkDeviceSize vertexBlockBytes = 64ull * 1024 * 1024,
+                        VkDeviceSize indexBlockBytes = 16ull * 1024 * 1024);
+
+        /** @brief True once initialize() has run; Mesh uses this to opt in. */
+        bool isInitialized() const { return m_memoryManager != nullptr; }
+
+        /**
+         * @brief Reserves vertex and index ranges in one block.
+         * @param vertexBytes Vertex data size in bytes
+         * @param indexBytes Index data size in bytes
+         * @param vertexStride Bytes per vertex; when nonzero the vertex
+         *        range starts on a stride multiple, so the mesh is
+         *        addressable as a whole-vertex vertexOffset from a block
+         *        bound at offset zero (what indirect multi-draw commands
+         *        need to merge meshes from one block into one bucket)
+         * @return Allocation describing the ranges, or an error
+         *
+         * Both ranges come from the same block so a mesh is fully
+         * addressable with one buffer pair. First-fit over existing
+         * blocks; a new block (sized up for oversized meshes) is created
+         * when nothing fits.
+         */
+        Result<MeshPoolAllocation> allocate(VkDeviceSize vertexBytes, VkDeviceSize indexBytes,
+                                            VkDeviceSize vertexStride = 0);
+
+        /**
+         * @brief Returns a mesh's ranges to the free lists.
+         *
+         * Adjacent free ranges are merged immediately, so churn from
+         * unloaded meshes compacts back into contiguous spans instead of
+         * fragmenting the block. Safe to call after clear() (no-op).
+         */
+        void free(const MeshPoolAllocation& allocation);
+
+        /** @brief Vertex buffer backing a block (for binding at an offset). */
+        std::shared_ptr<Buffer> getVertexBuffer(uint32_t blockIndex) const;
+
+        /** @brief Index buffer backing a block (for binding at an offset). */
+        std::shared_ptr<Buffer> getIndexBuffer(uint32_t blockIndex) const;
+
+        /** @brief Number of blocks created so far. */
+        size_t getBlockCount() const;
+
+        /**
+         * @brief Releases all blocks and detaches from the memory manager.
+         *
+         * Called during engine shutdown. Meshes freed afterwards are
+         * ignored; their Buffer handles die with the blocks.
+         */
+        void clear();
+
+    private:
+        MeshBufferPool() = default;
+
+        /** @brief A contiguous free byte range inside a block buffer. */
+        struct FreeRange {
+            VkDeviceSize offset = 0;
+            VkDeviceSize size = 0;
+        };
+
+        /** @brief One vertex/index buffer pair plus its free lists. */
+        struct Block {
+            std::shared_ptr<Buffer> vertexBuffer;
+            std::shared_ptr<Buffer> indexBuffer;
+            std::vector<FreeRange> vertexFree;  ///< Sorted by offset, non-adjacent
+            std::vector<FreeRange> indexFree;   ///< Sorted by offset, non-adjacent
+        };
+
+        /**
+         * @brief First-fit carve from a free list; false if nothing fits.
+         *
+         * The carved range starts on a multiple of @p alignment; any front
+         * padding left by aligning up stays in the free list.
+         */
+        static bool carveRange(std::vector<FreeRange>& freeList, VkDeviceSize size,
+                               VkDeviceSize alignment, VkDeviceSize& outOffset);
+
+        /** @brief Inserts a range sorted by offset and merges adjacent neighbours. */
+        static void returnRange(std::vector<FreeRange>& freeList, VkDeviceSize offset,
+                                VkDeviceSize size);
+
+        /** @brief Creates a block sized for at least the given demands. */
+        Result<uint32_t> addBlock(VkDeviceSize vertexBytes, VkDeviceSize indexBytes);
+
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        VkDeviceSize m_vertexBlockBytes = 0;
+        VkDeviceSize m_indexBlockBytes = 0;
+
+        mutable std::mutex m_mutex;     ///< Guards m_blocks (loader threads vs render thread)
+        std::vector<Block> m_blocks;
+    };
+
+} // namespace vkeng
@@ -0,0 +1,150 @@
+/**
+ * @file MeshCache.hpp
+ * @brief Compiled binary mesh container with memory-mapped loading
+ *
+ * OBJ parsing dominates load time for large scans, and the result is always
+ * the same vertex/index blobs. MeshCache writes those blobs to a versioned
+ * sidecar file whose layout matches the Vertex struct byte-for-byte, so a
+ * later run maps the file and hands the pointers straight to the GPU upload
+ * path with no per-vertex work.
+ *
+ * Key Cache Concepts:
+ * - Sidecar File: model.obj -> model.obj.vkmesh, rebuilt transparently
+ * - Source Hash: FNV-1a of the OBJ bytes; edits invalidate the cache
+ * - Layout Guard: header records sizeof(Vertex); struct changes invalidate
+ * - Zero-Copy: the mapped blobs are uploaded directly, never deserialized
+ * - Meshlets: version 2 appends the import-time meshlet decomposition so
+ *   cached loads skip the clustering pass along with the parse
+ */
+#pragma once
+
+#include "vulkan-engine/core/FileMapping.hpp"
+#include "vulkan-engine/core/Result.hpp"
+#include "vulkan-engine/rendering/Vertex.hpp"
+#include "vulkan-engine/resources/Mesh.hpp"
+#include "vulkan-engine/resources/MeshletBuilder.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class MappedMesh
+     * @brief RAII view of a memory-mapped .vkmesh file
+     *
+     * Valid instances expose pointers into the mapping; the mapping lives
+     * until destruction, so keep the object alive until the data has been
+     * uploaded. Obtained via MeshCache::open().
+     */
+    class MappedMesh {
+    public:
+        MappedMesh() = default;
+
+        MappedMesh(const MappedMesh&) = delete;
+        MappedMesh& operator=(const MappedMesh&) = delete;
+        MappedMesh(MappedMesh&&) noexcept = default;
+        MappedMesh& operator=(MappedMesh&&) noexcept = default;
+
+        const Vertex* vertices() const { return m_vertices; }
+        const uint32_t* indices() const { return m_indices; }
+        size_t vertexCount() const { return m_vertexCount; }
+        size_t indexCount() const { return m_indexCount; }
+
+        MeshNormalSource normalSource() const { return m_normalSource; }
+        const glm::vec3& boundsMin() const { return m_boundsMin; }
+        const glm::vec3& boundsMax() const { return m_boundsMax; }
+        float boundingRadius() const { return m_boundingRadius; }
+
+        /** @brief Whether meshlet blobs were baked into this cache file. */
+        bool hasMeshlets() const { return m_meshletCount > 0; }
+        const Meshlet* meshlets() const { return m_meshlets; }
+        const uint32_t* meshletVertexIndices() const { return m_meshletVertexIndices; }
+        const uint8_t* meshletTriangles() const { return m_meshletTriangles; }
+        size_t meshletCount() const { return m_meshletCount; }
+        size_t meshletVertexIndexCount() const { return m_meshletVertexIndexCount; }
+        size_t meshletTriangleBytes() const { return m_meshletTriangleBytes; }
+
+    private:
+        friend class MeshCache;
+
+        FileMapping m_file; ///< Owns the mapping; pointers below alias into it
+
+        const Vertex* m_vertices = nullptr;
+        const uint32_t* m_indices = nullptr;
+        size_t m_vertexCount = 0;
+        size_t m_indexCount = 0;
+
+        const Meshlet* m_meshlets = nullptr;
+        const uint32_t* m_meshletVertexIndices = nullptr;
+        const uint8_t* m_meshletTriangles = nullptr;
+        size_t m_meshletCount = 0;
+        size_t m_meshletVertexIndexCount = 0;
+        size_t m_meshletTriangleBytes = 0;
+
+        MeshNormalSource m_normalSource = MeshNormalSource::Authored;
+        glm::vec3 m_boundsMin{0.0f};
+        glm::vec3 m_boundsMax{0.0f};
+        float m_boundingRadius = 0.0f;
+    };
+
+    /**
+     * @class MeshCache
+     * @brief Reads and writes the binary .vkmesh sidecar format
+     *
+     * Usage in a loader:
+     * @code
+     *   uint64_t hash = MeshCache::hashFile(objPath);
+     *   auto mapped = MeshCache::open(MeshCache::cachePathFor(objPath), hash, mode);
+     *   if (mapped) { upload from mapped.getValue() }
+     *   else        { parse OBJ, then MeshCache::write(...) }
+     * @endcode
+     *
+     * Bounds are precomputed into the header so cached loads skip even the
+     * bounds pass over the vertices.
+     */
+    class MeshCache {
+    public:
+        /** @brief Sidecar path for a source mesh (source path + ".vkmesh"). */
+        static std::string cachePathFor(const std::string& sourcePath);
+
+        /**
+         * @brief FNV-1a hash of a file's bytes
+         * @return 0 if the file could not be read
+         */
+        static uint64_t hashFile(const std::string& path);
+
+        /**
+         * @brief Map a cache file and validate it against the source
+         * @param cachePath The .vkmesh file
+         * @param expectedSourceHash Hash of the current source file
+         * @param missingNormalMode Normal-generation mode the caller wants;
+         *        part of the cache key since it changes the baked data
+         * @return Error for missing, stale, or layout-mismatched caches —
+         *         all of which simply mean "re-parse the source"
+         */
+        static Result<MappedMesh> open(const std::string& cachePath,
+                                       uint64_t expectedSourceHash,
+                                       MissingNormalMode missingNormalMode);
+
+        /**
+         * @brief Write a cache file for parsed mesh data
+         *
+         * Failures are non-fatal for the caller (the parse already
+         * succeeded); they just mean the next load parses again.
+         */
+        static Result<void> write(const std::string& cachePath,
+                                  uint64_t sourceHash,
+                                  MissingNormalMode missingNormalMode,
+                                  const std::vector<Vertex>& vertices,
+                                  const std::vector<uint32_t>& indices,
+                                  MeshNormalSource normalSource,
+                                  const glm::vec3& boundsMin,
+                                  const glm::vec3& boundsMax,
+                                  float boundingRadius,
+                                  const MeshletData* meshlets = nullptr);
+    };
+
+} // namespace vkeng
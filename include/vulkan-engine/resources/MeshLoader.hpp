@@ -19,6 +19,21 @@ public:
     bool canLoad(const std::string& path) override;
 
 private:
+    /**
+     * @brief Builds the simplified LOD chain for a freshly loaded mesh.
+     *
+     * Generates up to three halving reduction levels with MeshSimplifier and
+     * attaches them via Mesh::setLodChain(). Small meshes are skipped, and
+     * the chain stops early once simplification stalls.
+     */
+    void generateLodChain(const std::shared_ptr<Mesh>& mesh);
+
+    Result<std::shared_ptr<Mesh>> createAndCache(
+        const std::string& path, const std::string& cachePath,
+        uint64_t sourceHash, MissingNormalMode missingNormalMode,
+        const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+        MeshNormalSource normalSource);
+
     std::shared_ptr<MemoryManager> m_memoryManager;
 };
 
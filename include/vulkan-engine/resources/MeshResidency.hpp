@@ -0,0 +1,78 @@
+/**
+ * @file MeshResidency.hpp
+ * @brief VRAM-budgeted residency for mesh geometry
+ *
+ * Long sessions accumulate mesh vertex/index buffers until VMA starts
+ * failing allocations mid-frame. The residency manager keeps resident
+ * mesh bytes under a configured budget by evicting the GPU buffers of
+ * the least-recently-drawn meshes; the CPU copy every mesh already
+ * retains for static batching serves as the reload source, so eviction
+ * costs no disk I/O.
+ *
+ * Key Residency Concepts:
+ * - LRU by Frame Stamp: the renderer stamps every mesh it draws via
+ *   noteUsage(); the mesh idle the longest is evicted first
+ * - Idle Window: only meshes undrawn for longer than the frames-in-flight
+ *   window are eligible, so no in-flight command buffer can still
+ *   reference the freed buffers (no retire list needed, unlike textures)
+ * - On-Demand Reload: noteUsage() re-uploads an evicted mesh before the
+ *   draw that needs it — a synchronous hitch, mirroring texture promotion
+ *
+ * Unlike TextureResidencyManager there is no explicit registration:
+ * the renderer sees every drawn mesh, so noteUsage() tracks meshes on
+ * first sight. update() runs once per frame from the engine loop.
+ */
+#pragma once
+
+#include "vulkan-engine/resources/Mesh.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    class MeshResidencyManager {
+    public:
+        static MeshResidencyManager& get();
+
+        /**
+         * @brief Sets the resident mesh budget; call once after device init
+         * @param budgetBytes Resident geometry budget (0 disables eviction)
+         */
+        void configure(uint64_t budgetBytes);
+
+        /**
+         * @brief Stamps a mesh as drawn this frame, reloading it if evicted
+         *
+         * Call at draw collection time for every mesh about to be drawn.
+         * Untracked meshes are registered on first call.
+         */
+        void noteUsage(const std::shared_ptr<Mesh>& mesh);
+
+        /**
+         * @brief Advances the frame counter and applies the eviction policy;
+         *        run once per frame
+         */
+        void update();
+
+        uint64_t getResidentBytes() const { return m_residentBytes; }
+        size_t getEvictedCount() const;
+
+        /** @brief Drops all tracking state (level teardown). */
+        void clear();
+
+    private:
+        MeshResidencyManager() = default;
+
+        struct Entry {
+            std::weak_ptr<Mesh> mesh;
+        };
+
+        uint64_t m_budgetBytes = 0;
+        uint64_t m_residentBytes = 0;
+        uint64_t m_frame = 1;   ///< Starts at 1 so a stamp of 0 means "never drawn"
+
+        std::vector<Entry> m_entries;
+    };
+
+} // namespace vkeng
@@ -0,0 +1,62 @@
+/**
+ * @file MeshSimplifier.hpp
+ * @brief Quadric-error mesh simplification for LOD chain generation
+ *
+ * Produces reduced-triangle versions of an indexed mesh for distant
+ * rendering. Each vertex accumulates a quadric built from the planes of
+ * its incident triangles; collapsing an edge onto one of its endpoints
+ * costs the combined quadric evaluated at the surviving position, so the
+ * cheapest collapses are the ones that move the surface least.
+ *
+ * Key Simplification Concepts:
+ * - Error Quadrics: the sum of squared distances to a vertex's incident
+ *   triangle planes, stored as 10 coefficients of a symmetric 4x4 form
+ * - Endpoint Collapse: edges collapse onto an existing endpoint (no new
+ *   positions), which keeps attributes (UVs, normals) valid without
+ *   resampling
+ * - Boundary Preservation: open edges add a heavily weighted constraint
+ *   plane perpendicular to the surface, so silhouettes and seams erode
+ *   last
+ * - Greedy Passes: per pass, candidate collapses are sorted by cost and
+ *   applied while their endpoints are untouched; no incremental heap to
+ *   maintain, and a handful of passes reaches any target count
+ *
+ * Intended for import-time use (MeshLoader LOD generation); the output
+ * feeds the same MeshOptimizer reordering as any parsed mesh.
+ */
+#pragma once
+
+#include "vulkan-engine/rendering/Vertex.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vkeng {
+
+    class MeshSimplifier {
+    public:
+        /**
+         * @brief Simplifies an indexed triangle mesh toward a target size
+         * @param vertices Source vertex data
+         * @param indices Source triangle indices (multiple of 3)
+         * @param targetIndexCount Desired index count (rounded to triangles)
+         * @param outVertices Receives the compacted surviving vertices
+         * @param outIndices Receives the simplified index buffer
+         * @return Achieved index count; may stay above the target when
+         *         topology constraints stop further collapses
+         *
+         * The exact target is not guaranteed — callers should treat levels
+         * that barely shrank as a signal to stop extending the LOD chain.
+         */
+        static size_t simplify(const std::vector<Vertex>& vertices,
+                               const std::vector<uint32_t>& indices,
+                               size_t targetIndexCount,
+                               std::vector<Vertex>& outVertices,
+                               std::vector<uint32_t>& outIndices);
+
+    private:
+        MeshSimplifier() = delete;
+    };
+
+} // namespace vkeng
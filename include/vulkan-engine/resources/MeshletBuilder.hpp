@@ -0,0 +1,98 @@
+/**
+ * @file MeshletBuilder.hpp
+ * @brief Import-time meshlet clustering for the mesh-shading draw path
+ *
+ * Dense scan meshes run tens of millions of triangles; even after LOD
+ * selection the classic vertex pipeline processes every index of whatever
+ * level is bound. Meshlets slice the index buffer into small fixed-size
+ * clusters, each carrying its own bounding sphere and a backface cone, so
+ * a task shader can discard invisible clusters on the GPU before any
+ * vertex work happens (see rendering/MeshletRenderer.hpp).
+ *
+ * Key Meshlet Concepts:
+ * - Cluster Limits: at most 64 vertices and 124 triangles per meshlet —
+ *   sized to one mesh-shader workgroup's output and friendly to the
+ *   common hardware output caps.
+ * - Local Indexing: a meshlet's triangles index into its own small
+ *   vertex list (uint8 corners), which in turn references the original
+ *   vertex buffer. Vertices shared across meshlet boundaries are simply
+ *   duplicated in the lists, never in the vertex data.
+ * - Backface Cone: the spread of a meshlet's triangle normals collapses
+ *   to an axis + cutoff; when the whole cone faces away from the camera
+ *   the cluster is culled without touching a single triangle. A cutoff
+ *   of 1.0 marks cones too wide to ever cull.
+ * - Import-Time Work: building scans the index buffer once (O(n)) and
+ *   the result round-trips through the .vkmesh cache, so shipped scenes
+ *   never pay the build cost at load.
+ */
+#pragma once
+
+#include "vulkan-engine/rendering/Vertex.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @struct Meshlet
+     * @brief One cluster's bounds, cone, and ranges into the shared lists
+     *
+     * Layout is std430-compatible and uploaded verbatim as a storage
+     * buffer element; meshlet.task reads the bounds and cone, meshlet.mesh
+     * reads the ranges. Keep in sync with the MeshletDesc struct in the
+     * meshlet shaders.
+     */
+    struct Meshlet {
+        glm::vec4 boundsSphere;   ///< Object-space bounding sphere (xyz = center, w = radius)
+        glm::vec4 coneAxisCutoff; ///< Backface cone (xyz = axis, w = cutoff; 1.0 = cull disabled)
+        uint32_t vertexOffset = 0;   ///< First entry in MeshletData::vertexIndices
+        uint32_t vertexCount = 0;    ///< Unique vertices referenced (<= kMaxVertices)
+        uint32_t triangleOffset = 0; ///< First corner byte in MeshletData::triangles
+        uint32_t triangleCount = 0;  ///< Triangles emitted (<= kMaxTriangles)
+    };
+
+    /**
+     * @struct MeshletData
+     * @brief A mesh's complete meshlet decomposition
+     *
+     * Three flat arrays: the meshlet descriptors, the per-meshlet unique
+     * vertex lists (indices into the original vertex buffer), and the
+     * triangle corners as uint8 triples indexing each meshlet's local
+     * vertex list. Attached to the Mesh at import and cached in the
+     * .vkmesh sidecar.
+     */
+    struct MeshletData {
+        std::vector<Meshlet> meshlets;
+        std::vector<uint32_t> vertexIndices; ///< Global vertex indices, grouped per meshlet
+        std::vector<uint8_t> triangles;      ///< Meshlet-local corner triples (3 bytes per triangle)
+
+        bool empty() const { return meshlets.empty(); }
+    };
+
+    /**
+     * @class MeshletBuilder
+     * @brief Greedy scan-order clustering of an index buffer into meshlets
+     *
+     * Triangles are consumed in index-buffer order — MeshLoader runs the
+     * vertex-cache optimizer first, so consecutive triangles already share
+     * vertices and the greedy packing stays tight without a spatial pass.
+     * A meshlet closes when the next triangle would overflow either limit.
+     */
+    class MeshletBuilder {
+    public:
+        static constexpr uint32_t kMaxVertices = 64;   ///< Unique vertices per meshlet
+        static constexpr uint32_t kMaxTriangles = 124; ///< Triangles per meshlet
+
+        /**
+         * @brief Cluster a triangle list into meshlets.
+         * @param vertices Vertex buffer (positions feed bounds, normals the cone)
+         * @param indices Triangle-list index buffer (size must be a multiple of 3)
+         * @return The meshlet decomposition; empty when the mesh has no triangles
+         */
+        static MeshletData build(const std::vector<Vertex>& vertices,
+                                 const std::vector<uint32_t>& indices);
+    };
+
+} // namespace vkeng
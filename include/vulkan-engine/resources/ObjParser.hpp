@@ -0,0 +1,58 @@
+/**
+ * @file ObjParser.hpp
+ * @brief Parallel chunked OBJ parser for first-time imports
+ *
+ * First-run imports of large OBJ scans (hundreds of MB) were bottlenecked
+ * on tiny_obj_loader's single-threaded parse. This front-end splits the
+ * file at line boundaries into chunks parsed concurrently on the job
+ * system — OBJ is line-oriented, so a chunk can be parsed knowing nothing
+ * about its neighbours — and merges the per-chunk results at the end.
+ *
+ * Key Parser Concepts:
+ * - Line-Boundary Chunking: chunk edges are advanced to the next newline,
+ *   so every record is parsed by exactly one chunk
+ * - Global Index Merge: v/vt/vn arrays concatenated in chunk (= file)
+ *   order reproduce the sequential parse exactly, so the absolute indices
+ *   faces reference need no per-chunk fixup — only a 1-based to 0-based
+ *   conversion and a range check
+ * - Fast Float Path: a locale-free integer-accumulation float parser
+ *   replaces strtof, which dominates the per-line cost
+ * - Fallback: files using features the chunked parser does not handle
+ *   (negative/relative indices, line continuations) report failure and
+ *   the caller falls back to tiny_obj_loader
+ *
+ * Output fills tinyobj-compatible structures (one merged shape), so the
+ * downstream dedup/normal-generation pipeline in MeshLoader is unchanged.
+ */
+#pragma once
+
+#include <tiny_obj_loader.h>
+
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    class ObjParser {
+    public:
+        /**
+         * @brief Parses an OBJ file in parallel chunks
+         * @param path File to parse
+         * @param attrib Receives merged vertex/normal/texcoord arrays
+         * @param shapes Receives a single merged, triangulated shape
+         * @param warn Optional; receives the reason when parsing is declined
+         * @return True on success; false when the file cannot be read or
+         *         uses unsupported features — fall back to tinyobj then
+         *
+         * Faces are fan-triangulated during the chunk pass (matching the
+         * triangulate flag MeshLoader passes to tinyobj). Material, group,
+         * and object statements are ignored — the mesh pipeline merges all
+         * shapes anyway.
+         */
+        static bool parse(const std::string& path,
+                          tinyobj::attrib_t& attrib,
+                          std::vector<tinyobj::shape_t>& shapes,
+                          std::string* warn);
+    };
+
+} // namespace vkeng
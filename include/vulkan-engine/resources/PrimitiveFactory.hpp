@@ -4,6 +4,11 @@
  *
  * All primitives are created with white vertex colors, proper normals, and
  * [0,1] UV coordinates suitable for texture mapping.
+ *
+ * Results are deduplicated: repeated calls with the same parameters return
+ * the same shared Mesh (and therefore the same vertex-pool suballocation)
+ * instead of regenerating it. The cache holds weak references, so a shape
+ * is rebuilt only after every user of it has released it.
  */
 
 #pragma once
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -7,11 +8,24 @@
 #include <vector>
 #include <mutex>
 #include <any> // <-- Include for std::any
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
 #include "../core/Result.hpp"
+#include "../core/StringId.hpp"
 
 namespace vkeng {
 
-// (ResourceHandle class is unchanged)
+/**
+ * @brief Typed, generational handle to a managed resource.
+ *
+ * The id packs (generation << 32 | slot index). The slot indexes straight
+ * into the manager's table, and the generation must match the slot's
+ * published generation — a handle to an unloaded or cleared resource fails
+ * the comparison and resolves to null instead of aliasing a newer resource.
+ */
 template<typename T>
 class ResourceHandle {
 public:
@@ -61,9 +75,54 @@ public:
     template<typename T>
     ResourceHandle<T> loadResource(const std::string& path);
 
+    /**
+     * @brief Queues a load on the worker pool and returns immediately.
+     *
+     * The handle is valid right away but getResource() returns nullptr
+     * until the load finishes and pumpCompletedLoads() publishes it.
+     * Repeat requests for the same path return the same handle, whether
+     * the load is still pending or already published. Disk I/O, parsing,
+     * and the staging-ring upload all happen on the worker thread; only
+     * publication touches the resource maps on the main thread.
+     */
+    template<typename T>
+    ResourceHandle<T> loadResourceAsync(const std::string& path);
+
+    /** @brief True once an async handle's resource has been published. */
+    template<typename T>
+    bool isReady(ResourceHandle<T> handle);
+
+    /**
+     * @brief Publishes resources whose async loads completed.
+     *
+     * Called once per frame from the engine loop. Failed loads release
+     * their path reservation so a later request can retry.
+     */
+    void pumpCompletedLoads();
+
+    /**
+     * @brief Resolve a handle to its resource — lock-free.
+     *
+     * Costs two indexed loads (block pointer, slot) plus a generation
+     * compare; no mutex. Returns null for pending async loads, stale
+     * generations, and invalid handles. Safe to call from any thread
+     * concurrently with loads on other threads.
+     */
     template<typename T>
     std::shared_ptr<T> getResource(ResourceHandle<T> handle);
 
+    /**
+     * @brief Looks up a loaded resource by its name hash.
+     *
+     * The canonical name-query path: callers with a literal name use the
+     * ""_id operator so the hash is computed at compile time and the
+     * lookup is a single integer probe — no string hashing, no
+     * allocation. Returns an invalid handle when nothing is registered
+     * under the id (including loads still in flight that failed).
+     */
+    template<typename T>
+    ResourceHandle<T> findResource(StringId nameId);
+
     template<typename T>
     void registerLoader(std::unique_ptr<ResourceLoader<T>> loader);
 
@@ -72,27 +131,75 @@ public:
 
 private:
     ResourceManager() = default;
-
-    struct ResourceEntry {
+    ~ResourceManager();
+
+    // ========================================================================
+    // Lock-free handle resolution
+    //
+    // Slots live in fixed-size blocks. Blocks are allocated under m_mutex
+    // but published through an atomic pointer and never freed or moved
+    // before shutdown, so readers index into them without locking. A slot
+    // becomes visible by storing its generation last (release); readers
+    // load it first (acquire). The mutex is reserved for load/unload
+    // mutation: the name map, loader map, and slot reservation.
+    // ========================================================================
+
+    static constexpr uint32_t kSlotBlockShift = 10;
+    static constexpr uint32_t kSlotBlockSize = 1u << kSlotBlockShift; ///< 1024 slots per block
+    static constexpr uint32_t kMaxSlotBlocks = 1024;                  ///< ~1M concurrently live resources
+
+    struct Slot {
+        /// 0 = never published; otherwise the generation the slot was
+        /// published at. Bumped on retire so stale handles fail fast.
+        std::atomic<uint32_t> generation{0};
+        /// Accessed with std::atomic_load/atomic_store — publication and
+        /// retirement race with render-path reads by design.
         std::shared_ptr<Resource> resource;
-        std::type_index type;
-        
-        ResourceEntry() : type(typeid(void)) {}
-        ResourceEntry(std::shared_ptr<Resource> res, std::type_index t) 
-            : resource(std::move(res)), type(t) {}
     };
 
+    /** @brief Reserve the next slot and encode its handle id (caller holds m_mutex). */
+    uint64_t reserveSlot();
+
+    /** @brief Publish a resource into its reserved slot (caller holds m_mutex). */
+    void publishSlot(uint64_t id, std::shared_ptr<Resource> resource);
+
+    /** @brief Lock-free: resolve an id to its published resource (null if pending/stale). */
+    std::shared_ptr<Resource> resolveSlot(uint64_t id) const;
+
+    std::array<std::atomic<Slot*>, kMaxSlotBlocks> m_slotBlocks{};
+    std::atomic<uint32_t> m_slotCount{0}; ///< Slots reserved so far (append index)
+
     std::mutex m_mutex;
-    uint64_t m_nextId = 1;
 
-    std::unordered_map<uint64_t, ResourceEntry> m_resourcesById;
-    std::unordered_map<std::string, uint64_t> m_resourcesByName;
+    /// Keyed by name hash: lookups cost one integer compare, and ids from
+    /// the ""_id literal resolve without touching the original string
+    std::unordered_map<StringId, uint64_t> m_resourcesByName;
 
     // --- MODIFIED Loader Map ---
     // We use std::any to store loaders of different types
     std::unordered_map<std::type_index, std::any> m_loaders;
 
-    uint64_t generateId() { return m_nextId++; }
+    // --- Async loading ---
+    struct CompletedLoad {
+        uint64_t id = 0;
+        std::string path;
+        std::shared_ptr<Resource> resource; // null on failure
+        std::string error;
+    };
+
+    void enqueueAsyncJob(std::function<void()> job);
+    void startWorkers();
+    void workerLoop();
+    void pushCompleted(CompletedLoad completed);
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_jobQueue;
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobCv;
+    bool m_stopWorkers = false;
+
+    std::mutex m_completedMutex;
+    std::vector<CompletedLoad> m_completed;
 };
 
 // --- Template Implementations ---
@@ -107,16 +214,27 @@ ResourceHandle<T> ResourceManager::createResource(const std::string& name, Args&
 
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    const uint64_t id = generateId();
+    const uint64_t id = reserveSlot();
+    if (id == 0) {
+        return ResourceHandle<T>(); // Slot table exhausted
+    }
     resource->m_id = id; // Set the ID after creation
 
-    // Store the resource entry
-    m_resourcesById[id] = ResourceEntry(resource, std::type_index(typeid(T)));
-    m_resourcesByName[name] = id;
+    m_resourcesByName[StringId(name)] = id;
+    publishSlot(id, std::move(resource));
 
     return ResourceHandle<T>(id);
 }
 
+template<typename T>
+ResourceHandle<T> ResourceManager::findResource(StringId nameId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto it = m_resourcesByName.find(nameId); it != m_resourcesByName.end()) {
+        return ResourceHandle<T>(it->second);
+    }
+    return ResourceHandle<T>();
+}
+
 template<typename T>
 void ResourceManager::registerLoader(std::unique_ptr<ResourceLoader<T>> loader) {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -130,7 +248,8 @@ template<typename T>
 ResourceHandle<T> ResourceManager::loadResource(const std::string& path) {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    if (auto it = m_resourcesByName.find(path); it != m_resourcesByName.end()) {
+    const StringId pathId(path);
+    if (auto it = m_resourcesByName.find(pathId); it != m_resourcesByName.end()) {
         return ResourceHandle<T>(it->second);
     }
 
@@ -148,12 +267,14 @@ ResourceHandle<T> ResourceManager::loadResource(const std::string& path) {
         auto result = (*loaderPtr)->load(path);
         if (result.isSuccess()) {
             auto resource = result.getValue();
-            const uint64_t id = generateId();
+            const uint64_t id = reserveSlot();
+            if (id == 0) {
+                return ResourceHandle<T>(); // Slot table exhausted
+            }
             resource->m_id = id;
 
-            // Store the resource entry
-            m_resourcesById[id] = ResourceEntry(resource, typeIndex);
-            m_resourcesByName[path] = id;
+            m_resourcesByName[pathId] = id;
+            publishSlot(id, std::move(resource));
             return ResourceHandle<T>(id);
         }
     }
@@ -162,11 +283,63 @@ ResourceHandle<T> ResourceManager::loadResource(const std::string& path) {
 }
 
 template<typename T>
-std::shared_ptr<T> ResourceManager::getResource(ResourceHandle<T> handle) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (auto it = m_resourcesById.find(handle.getId()); it != m_resourcesById.end()) {
-        return std::static_pointer_cast<T>(it->second.resource);
+ResourceHandle<T> ResourceManager::loadResourceAsync(const std::string& path) {
+    const std::type_index typeIndex = std::type_index(typeid(T));
+    std::shared_ptr<ResourceLoader<T>> loader;
+    uint64_t id = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Covers both published resources and loads still in flight:
+        // the name is reserved the moment the job is queued
+        if (auto it = m_resourcesByName.find(StringId(path)); it != m_resourcesByName.end()) {
+            return ResourceHandle<T>(it->second);
+        }
+
+        auto loaderIt = m_loaders.find(typeIndex);
+        if (loaderIt == m_loaders.end()) {
+            return ResourceHandle<T>();
+        }
+
+        auto* loaderPtr = std::any_cast<std::shared_ptr<ResourceLoader<T>>>(&loaderIt->second);
+        if (!loaderPtr || !(*loaderPtr)->canLoad(path)) {
+            return ResourceHandle<T>();
+        }
+
+        loader = *loaderPtr;
+        id = reserveSlot();
+        if (id == 0) {
+            return ResourceHandle<T>(); // Slot table exhausted
+        }
+        m_resourcesByName[StringId(path)] = id;
     }
-    return nullptr;
+
+    enqueueAsyncJob([this, loader, path, id]() {
+        CompletedLoad completed;
+        completed.id = id;
+        completed.path = path;
+
+        auto result = loader->load(path);
+        if (result.isSuccess()) {
+            completed.resource = result.getValue();
+        } else {
+            completed.error = result.getError().message;
+        }
+        pushCompleted(std::move(completed));
+    });
+
+    return ResourceHandle<T>(id);
+}
+
+template<typename T>
+bool ResourceManager::isReady(ResourceHandle<T> handle) {
+    // Published means resolvable — same lock-free path as getResource
+    return resolveSlot(handle.getId()) != nullptr;
+}
+
+template<typename T>
+std::shared_ptr<T> ResourceManager::getResource(ResourceHandle<T> handle) {
+    return std::static_pointer_cast<T>(resolveSlot(handle.getId()));
 }
 }
\ No newline at end of file
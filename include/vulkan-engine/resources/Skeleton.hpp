@@ -0,0 +1,94 @@
+/**
+ * @file Skeleton.hpp
+ * @brief Flat joint hierarchy for skeletal animation
+ *
+ * A skeleton here is deliberately NOT a SceneNode subtree: one node (and
+ * Transform, and pool slot, and dirty-flag traffic) per bone would put
+ * every animated character through the full scene-graph update machinery
+ * sixty times a second. Instead joints live in flat parallel arrays
+ * ordered parents-before-children, so a pose evaluates as one linear scan
+ * and the rest pose feeds the SIMD batch kernels (simd::composeTrsBatch)
+ * directly.
+ *
+ * Key Skeleton Concepts:
+ * - Topological Order: addJoint() enforces parent index < joint index, so
+ *   evaluators propagate parent globals in a single forward pass with no
+ *   recursion or sorting
+ * - SoA Rest Pose: local TRS components stored as parallel float arrays in
+ *   the exact shape the batch compose kernel consumes
+ * - Inverse Binds: one matrix per joint taking bind-pose model space into
+ *   joint space; globalPose * inverseBind is the palette entry the vertex
+ *   shader applies
+ */
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace vkeng {
+
+/**
+ * @class Skeleton
+ * @brief Immutable-after-build joint hierarchy shared by animated instances.
+ *
+ * Built once (by a loader or procedurally) and shared by pointer between
+ * every instance that animates it; evaluation state lives per-instance in
+ * the AnimationSystem, never here.
+ */
+class Skeleton {
+public:
+    /// Root sentinel for addJoint(); also the palette budget guard below
+    static constexpr int32_t kNoParent = -1;
+    /// Per-skeleton joint cap (keeps palettes and uvec4 joint indices sane)
+    static constexpr uint32_t kMaxJoints = 256;
+
+    /**
+     * @brief Append a joint to the hierarchy.
+     * @param parent Index of the parent joint, or kNoParent for a root
+     * @param translation Local rest translation
+     * @param rotation Local rest rotation
+     * @param scale Local rest scale
+     * @param inverseBind Inverse bind-pose matrix for the joint
+     * @return The new joint's index, or kMaxJoints if the cap is hit
+     *
+     * Parents must be added before their children (parent < returned
+     * index); violations are rejected with a warning so a malformed rig
+     * fails loudly at build time instead of animating garbage.
+     */
+    uint32_t addJoint(int32_t parent,
+                      const glm::vec3& translation,
+                      const glm::quat& rotation,
+                      const glm::vec3& scale,
+                      const glm::mat4& inverseBind);
+
+    uint32_t jointCount() const { return static_cast<uint32_t>(m_parents.size()); }
+
+    const std::vector<int32_t>& parents() const { return m_parents; }
+    const std::vector<glm::mat4>& inverseBinds() const { return m_inverseBinds; }
+
+    // Rest-pose SoA channels, parallel per joint — evaluators copy these
+    // as the base pose before applying clip samples
+    const std::vector<float>& restPx() const { return m_px; }
+    const std::vector<float>& restPy() const { return m_py; }
+    const std::vector<float>& restPz() const { return m_pz; }
+    const std::vector<float>& restQx() const { return m_qx; }
+    const std::vector<float>& restQy() const { return m_qy; }
+    const std::vector<float>& restQz() const { return m_qz; }
+    const std::vector<float>& restQw() const { return m_qw; }
+    const std::vector<float>& restSx() const { return m_sx; }
+    const std::vector<float>& restSy() const { return m_sy; }
+    const std::vector<float>& restSz() const { return m_sz; }
+
+private:
+    std::vector<int32_t> m_parents;       ///< Parent joint index (parents precede children)
+    std::vector<glm::mat4> m_inverseBinds;
+
+    // Local rest pose in SoA layout (see file header)
+    std::vector<float> m_px, m_py, m_pz;
+    std::vector<float> m_qx, m_qy, m_qz, m_qw;
+    std::vector<float> m_sx, m_sy, m_sz;
+};
+
+} // namespace vkeng
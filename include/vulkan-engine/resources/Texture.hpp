@@ -2,6 +2,7 @@
 
 #include "vulkan-engine/resources/ResourceManager.hpp"
 #include "vulkan-engine/core/Buffer.hpp" // For vkeng::Image
+#include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
 #include <memory>
 
@@ -28,6 +29,42 @@ public:
     VkSampler getSampler() const { return m_sampler; }
     std::shared_ptr<Image> getImage() const { return m_image; }
 
+    /**
+     * @brief Swaps the backing image, returning the previous one.
+     *
+     * Used by texture residency to demote/promote a texture's mip chain.
+     * The caller must keep the returned image alive until the GPU is done
+     * with frames that reference its view (descriptor sets keyed on the
+     * old view simply stop matching and are rebuilt by the cache).
+     */
+    std::shared_ptr<Image> replaceImage(std::shared_ptr<Image> newImage) {
+        auto previous = std::move(m_image);
+        m_image = std::move(newImage);
+        return previous;
+    }
+
+    // ========================================================================
+    // Atlas Sub-Regions
+    //
+    // TextureAtlas packs small textures into shared pages and hands out
+    // Texture instances that alias the page image with a UV remap. Such a
+    // texture behaves like any other resource (same view, sampler and
+    // ResourceHandle<Texture> semantics); draws sampling it apply the UV
+    // transform below via MeshPushConstants::uvScaleOffset.
+    // ========================================================================
+
+    /** @brief Marks this texture as a sub-region of a shared atlas page. */
+    void setUvRegion(const glm::vec4& uvScaleOffset) {
+        m_uvScaleOffset = uvScaleOffset;
+        m_isAtlasRegion = true;
+    }
+
+    /** @brief UV transform mapping [0,1] coords into this texture's region: uv * xy + zw. */
+    const glm::vec4& getUvScaleOffset() const { return m_uvScaleOffset; }
+
+    /** @brief Whether this texture aliases part of a shared atlas page. */
+    bool isAtlasRegion() const { return m_isAtlasRegion; }
+
 private:
     /**
      * @brief Creates a VkSampler for this texture.
@@ -37,6 +74,8 @@ private:
     VkDevice m_device; ///< Logical device for resource cleanup.
     std::shared_ptr<Image> m_image; ///< The underlying GPU image data.
     VkSampler m_sampler = VK_NULL_HANDLE; ///< The sampler to use with this image.
+    glm::vec4 m_uvScaleOffset{1.f, 1.f, 0.f, 0.f}; ///< Atlas region remap (identity when unatlased)
+    bool m_isAtlasRegion = false; ///< True when aliasing part of an atlas page
 };
 
 } // namespace vkeng
\ No newline at end of file
@@ -0,0 +1,137 @@
+/**
+ * @file TextureAtlas.hpp
+ * @brief Shared atlas pages for small UI/detail textures
+ *
+ * Signage-heavy scenes load hundreds of small decals and UI textures, and
+ * every one used to own a dedicated VkImage: its own allocation, its own
+ * descriptor, and a material boundary the renderer cannot batch across.
+ * The atlas instead packs small textures into shared 4k pages at load
+ * time: each packed texture becomes an ordinary Texture resource that
+ * aliases the page image with a UV remap, so draws sampling different
+ * regions of one page share a view/sampler pair (and, in bindless mode,
+ * a descriptor index — letting the indirect path merge them).
+ *
+ * Key Concepts:
+ * - Page: one 4096x4096 single-mip RGBA image. A new page is opened when
+ *   the current ones are full
+ * - Shelf Packing: regions are placed left-to-right on horizontal
+ *   shelves; a new shelf opens when a region does not fit the current
+ *   one. Simple, fast, and good enough for same-order-of-magnitude
+ *   region sizes (the only kind the atlas accepts)
+ * - UV Remap: each region texture carries uvScaleOffset (uv * xy + zw),
+ *   which the renderer forwards through MeshPushConstants; shaders remap
+ *   [0,1] mesh UVs into the region. Regions are padded by 2 pixels so
+ *   linear filtering at the edges does not bleed neighbours
+ * - Sub-Region Handles: the returned textures are plain Texture
+ *   resources (same ResourceHandle<Texture> semantics); only their
+ *   backing image is shared, kept alive by shared_ptr from every region
+ */
+#pragma once
+
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/resources/Texture.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class TextureAtlas
+     * @brief Singleton packer of small textures into shared atlas pages
+     *
+     * Follows the MeshBufferPool pattern: the Engine wires it to the
+     * MemoryManager during Vulkan init and clears it during shutdown.
+     * Thread-safe — textures are loaded from job-system worker threads.
+     */
+    class TextureAtlas {
+    public:
+        /** @brief Gets the singleton instance. */
+        static TextureAtlas& get();
+
+        /**
+         * @brief Wires the atlas to the memory manager and device.
+         *
+         * Pages are created lazily on the first packed texture, so
+         * enabling the atlas costs nothing until a small texture loads.
+         */
+        void initialize(std::shared_ptr<MemoryManager> memoryManager, VkDevice device);
+
+        /** @brief True once initialize() has run; TextureLoader uses this to opt in. */
+        bool isInitialized() const { return m_memoryManager != nullptr; }
+
+        /**
+         * @brief Whether a texture of this size belongs in the atlas.
+         *
+         * Small textures (both dimensions at or below 512) pack well and
+         * rarely need deep mip chains; anything larger keeps its own
+         * image and full mip pipeline.
+         */
+        static bool shouldAtlas(uint32_t width, uint32_t height);
+
+        /**
+         * @brief Packs decoded RGBA pixels into a page and returns a region texture.
+         *
+         * Uploads the pixels into a free region of an existing page (or a
+         * new one), then wraps the page image in a Texture whose UV
+         * region maps [0,1] onto the packed rectangle. The texture is
+         * single-mip — pages cannot generate per-region mip chains
+         * without cross-region bleed.
+         *
+         * @param name Resource name (usually the source path)
+         * @param pixels Tightly packed RGBA8 pixel data
+         * @param size Pixel data size in bytes (width * height * 4)
+         * @param width Texture width in pixels (must pass shouldAtlas)
+         * @param height Texture height in pixels (must pass shouldAtlas)
+         * @return Region texture aliasing the page image, or an error
+         */
+        Result<std::shared_ptr<Texture>> addTexture(const std::string& name,
+                                                    const void* pixels,
+                                                    VkDeviceSize size,
+                                                    uint32_t width, uint32_t height);
+
+        /** @brief Number of pages created so far. */
+        size_t getPageCount() const;
+
+        /**
+         * @brief Releases all pages and detaches from the memory manager.
+         *
+         * Called during engine shutdown. Region textures loaded before
+         * the clear keep their page images alive via shared_ptr.
+         */
+        void clear();
+
+    private:
+        TextureAtlas() = default;
+
+        /** @brief One horizontal packing row inside a page. */
+        struct Shelf {
+            uint32_t y = 0;        ///< Top of the shelf in pixels
+            uint32_t height = 0;   ///< Shelf height (tallest region placed)
+            uint32_t cursorX = 0;  ///< Next free x position
+        };
+
+        /** @brief One atlas page image plus its packing state. */
+        struct Page {
+            std::shared_ptr<Image> image;
+            std::vector<Shelf> shelves;
+            uint32_t nextShelfY = 0;  ///< Top of the next shelf to open
+            bool uploaded = false;    ///< False until the first region upload (layout still undefined)
+        };
+
+        /** @brief Finds or opens a spot for a padded region; false if the page is full. */
+        static bool placeRegion(Page& page, uint32_t width, uint32_t height,
+                                uint32_t& outX, uint32_t& outY);
+
+        /** @brief Creates a fresh empty page. */
+        Result<uint32_t> addPage();
+
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        VkDevice m_device = VK_NULL_HANDLE;
+
+        mutable std::mutex m_mutex;  ///< Guards m_pages (loader threads)
+        std::vector<Page> m_pages;
+    };
+
+} // namespace vkeng
@@ -2,6 +2,7 @@
 
 #include "vulkan-engine/resources/ResourceManager.hpp"
 #include "vulkan-engine/resources/Texture.hpp"
+#include "vulkan-engine/resources/TextureCache.hpp"
 #include "vulkan-engine/core/MemoryManager.hpp"
 #include "vulkan-engine/core/VulkanDevice.hpp"
 
@@ -14,9 +15,81 @@ namespace vkeng {
         Result<std::shared_ptr<Texture>> load(const std::string& path) override;
         bool canLoad(const std::string& path) override;
 
+        /**
+         * @brief Loads many textures with parallel decode and one upload submission.
+         *
+         * stb_image decode is embarrassingly parallel across files, so the
+         * decode phase fans out over the job system while the GPU phase stays
+         * serial: every image is staged through the persistent staging ring
+         * and all copies plus layout transitions flush as a single transfer
+         * batch. Mip generation (GPU blits) runs after the flush. KTX2
+         * containers have no decode phase and load as usual.
+         *
+         * @param paths Texture files to load
+         * @return One result per path, index-aligned with @p paths
+         */
+        std::vector<Result<std::shared_ptr<Texture>>> loadBatch(const std::vector<std::string>& paths);
+
+        /** @brief Enables/disables blit-generated mip chains for decoded images. */
+        void setGenerateMipmaps(bool enabled) { m_generateMipmaps = enabled; }
+
+        /**
+         * @brief Enables/disables the transcoded disk cache for decoded images.
+         *
+         * When enabled (the default), the first load of a PNG/JPG transcodes
+         * to BC1/BC3 with baked mips and writes a .vktex sidecar next to the
+         * source; later loads map the sidecar and upload the pre-compressed
+         * blocks directly, skipping decode, compression, and the blit mip
+         * pass. Atlas-sized textures are exempt — the atlas needs raw RGBA.
+         */
+        void setTranscodeCache(bool enabled) { m_transcodeCache = enabled; }
+
     private:
+        /**
+         * @brief Loads a KTX2 container of pre-compressed blocks (BC7/BC5/...)
+         *
+         * The blocks and the full mip chain are uploaded exactly as stored —
+         * no decode, no mip generation — after checking that the device can
+         * sample the container's VkFormat with optimal tiling. Supercompressed
+         * (BasisLZ/zstd) containers are rejected; we ship plain BC payloads.
+         */
+        Result<std::shared_ptr<Texture>> loadKtx2(const std::string& path);
+
+        /**
+         * @brief Creates, uploads, and wraps an image from decoded RGBA pixels.
+         *
+         * Shared by load() and loadBatch(). Does NOT generate mipmaps — the
+         * image is created with the full mip level count, but the blit pass
+         * is the caller's responsibility so batch loads can defer it until
+         * after the upload batch has been submitted.
+         */
+        Result<std::shared_ptr<Texture>> uploadDecoded(const std::string& path,
+                                                       const unsigned char* pixels,
+                                                       int width, int height);
+
+        /**
+         * @brief Creates and uploads an image from pre-compressed BC levels.
+         *
+         * Shared by the cache-hit path (levels point into the mapped .vktex)
+         * and the first-load transcode path (levels point into the freshly
+         * baked payload). All levels stage through the ring and copy out at
+         * their table offsets, mirroring the KTX2 path.
+         */
+        Result<std::shared_ptr<Texture>> uploadCompressed(const std::string& path,
+                                                          VkFormat format,
+                                                          uint32_t width, uint32_t height,
+                                                          const TextureCacheLevel* levels,
+                                                          uint32_t levelCount,
+                                                          const void* payload,
+                                                          size_t payloadSize);
+
+        /** @brief True when the device samples @p format with optimal tiling. */
+        bool deviceSamplesFormat(VkFormat format);
+
         std::shared_ptr<MemoryManager> m_memoryManager;
         VulkanDevice& m_device;
+        bool m_generateMipmaps = true;
+        bool m_transcodeCache = true;
     };
 
 } // namespace vkeng
\ No newline at end of file
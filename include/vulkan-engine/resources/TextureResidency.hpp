@@ -0,0 +1,111 @@
+/**
+ * @file TextureResidency.hpp
+ * @brief VRAM-budgeted streaming of texture mip chains
+ *
+ * Full mip chains for every texture overcommit VRAM in texture-heavy
+ * scenes, and the driver's response (migrating allocations to host
+ * memory) is a performance cliff. The residency manager keeps resident
+ * texture bytes under a configured budget by demoting the most distant
+ * textures to the tail of their mip chain — a GPU-side copy, no disk
+ * I/O — and promoting them back to the full chain when the camera
+ * approaches.
+ *
+ * Key Residency Concepts:
+ * - Demotion: replace a texture's image with its mip tail (levels
+ *   [bias..N)); distant surfaces only ever sample those levels anyway
+ * - Promotion: reload the full chain through the registered reload
+ *   callback when a demoted texture gets close again
+ * - Retire List: replaced images are kept alive a few frames so frames
+ *   in flight finish with the old view before it is destroyed
+ *
+ * Draw code reports camera distance via noteUsage(); update() runs once
+ * per frame from the engine loop and applies at most one demotion and
+ * one promotion per frame to spread transfer cost.
+ */
+#pragma once
+
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/core/Result.hpp"
+#include "vulkan-engine/resources/Texture.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vkeng {
+
+    class TextureResidencyManager {
+    public:
+        /// Reloads a texture's full-resolution image from its source path
+        using ReloadFn = std::function<Result<std::shared_ptr<Image>>(const std::string& path)>;
+
+        static TextureResidencyManager& get();
+
+        /**
+         * @brief Configures budget and systems; call once after device init
+         * @param memoryManager Used for GPU-side mip tail copies
+         * @param budgetBytes Resident texture budget (0 disables demotion)
+         * @param reload Full-chain reload for promotion; may be empty, in
+         *        which case demoted textures stay demoted
+         */
+        void configure(std::shared_ptr<MemoryManager> memoryManager,
+                       uint64_t budgetBytes,
+                       ReloadFn reload = {});
+
+        /**
+         * @brief Registers a texture for residency tracking
+         * @param texture Tracked texture
+         * @param sourcePath Path used by the reload callback for promotion
+         */
+        void registerTexture(std::shared_ptr<Texture> texture,
+                             const std::string& sourcePath);
+
+        /**
+         * @brief Reports the camera distance at which a texture was used
+         *
+         * Call at draw/cull time each frame a texture is visible. Textures
+         * never reported keep their last distance and age toward demotion.
+         */
+        void noteUsage(const std::shared_ptr<Texture>& texture, float cameraDistance);
+
+        /**
+         * @brief Applies the residency policy; run once per frame
+         */
+        void update();
+
+        uint64_t getResidentBytes() const { return m_residentBytes; }
+        size_t getDemotedCount() const;
+
+        /** @brief Drops all tracking state (level teardown). */
+        void clear();
+
+    private:
+        TextureResidencyManager() = default;
+
+        struct Entry {
+            std::weak_ptr<Texture> texture;
+            std::string sourcePath;
+            float lastDistance = 0.0f;
+            uint64_t residentBytes = 0;
+            bool demoted = false;
+        };
+
+        struct RetiredImage {
+            std::shared_ptr<Image> image;
+            uint32_t framesLeft = 0;
+        };
+
+        static uint64_t estimateImageBytes(const Image& image);
+        void recomputeResidentBytes();
+
+        std::shared_ptr<MemoryManager> m_memoryManager;
+        ReloadFn m_reload;
+        uint64_t m_budgetBytes = 0;
+        uint64_t m_residentBytes = 0;
+
+        std::vector<Entry> m_entries;
+        std::vector<RetiredImage> m_retired;
+    };
+
+} // namespace vkeng
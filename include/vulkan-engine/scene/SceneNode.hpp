@@ -21,13 +21,16 @@
 #include <unordered_map>
 #include <string>
 #include <algorithm>
+#include "../core/StringId.hpp"
 #include "../math/Transform.hpp"
 #include "../components/Component.hpp"
+#include "../components/ComponentPool.hpp"
 
 namespace vkeng {
 
     // Forward declarations
     class Visitor;
+    class TransformSystem;
 
     /**
      * @class SceneNode
@@ -54,6 +57,26 @@ namespace vkeng {
          */
         explicit SceneNode(const std::string& name = "");
 
+        /**
+         * @brief Creates a pool-allocated node (preferred over make_shared)
+         *
+         * Nodes come from SceneNodePool slabs: creation is a free-list pop
+         * plus placement-new instead of a heap allocation, nodes created
+         * together sit together in memory, and a dropped streaming
+         * section's slabs are released wholesale via SceneNodePool::trim().
+         * The returned shared_ptr behaves exactly like a heap-owning one.
+         */
+        static std::shared_ptr<SceneNode> create(const std::string& name = "");
+
+        /**
+         * @brief Pre-sizes the child list for a known fan-out
+         *
+         * Loaders that know a node's child count up front (streamed
+         * sections, serialized scenes) avoid the vector's growth
+         * reallocations during hierarchy assembly.
+         */
+        void reserveChildren(size_t count) { m_children.reserve(count); }
+
         /**
          * @brief Destructor - automatically removes from parent and destroys components
          */
@@ -174,6 +197,18 @@ namespace vkeng {
          */
         glm::mat4 getWorldMatrix() const;
 
+        /**
+         * @brief Monotonic counter bumped whenever the cached world matrix
+         *        is rewritten with a new value
+         *
+         * Lets consumers that cache data derived from a node's world
+         * transform (the renderer's light gather) detect movement with one
+         * integer compare instead of re-deriving per frame. Note the lazy
+         * recompute only runs on access, so compare versions after the
+         * frame's transform flush or a getWorldMatrix() call.
+         */
+        uint64_t getWorldTransformVersion() const { return m_worldTransformVersion; }
+
         /**
          * @brief Get the world position of this node
          * @return Position in world space
@@ -192,6 +227,43 @@ namespace vkeng {
          */
         glm::vec3 getWorldScale() const;
 
+        /**
+         * @brief Get this node's index into a TransformSystem's flat arrays
+         * @return Transform index, or TransformSystem::kInvalidIndex if the
+         *         node is not registered with a system
+         *
+         * Assigned by TransformSystem::build(). Nodes outside any system keep
+         * the on-demand getWorldMatrix() path; registered nodes additionally
+         * get their world matrix refreshed by the system's bulk update.
+         */
+        uint32_t getTransformIndex() const { return m_transformIndex; }
+
+        // ================== World-Space Bounding Volumes ==================
+
+        /**
+         * @brief Get the cached world-space AABB of this node's own mesh
+         * @param outMin Receives the world-space minimum corner
+         * @param outMax Receives the world-space maximum corner
+         * @return True if this node has a MeshRenderer with a mesh, false otherwise
+         *
+         * The bounds are the mesh's local AABB transformed by the world matrix.
+         * Cached and invalidated together with the world transform, so repeated
+         * queries (e.g. per-frame frustum culling) are just a copy.
+         */
+        bool getMeshWorldBounds(glm::vec3& outMin, glm::vec3& outMax) const;
+
+        /**
+         * @brief Get the cached world-space AABB of this node and all descendants
+         * @param outMin Receives the world-space minimum corner
+         * @param outMax Receives the world-space maximum corner
+         * @return True if the subtree contains any renderable mesh
+         *
+         * Aggregate bounds allow whole subtrees to be rejected with one frustum
+         * test. Invalidation propagates up the parent chain whenever any
+         * descendant's transform or hierarchy changes.
+         */
+        bool getSubtreeWorldBounds(glm::vec3& outMin, glm::vec3& outMax) const;
+
         // ================== Component Management ==================
 
         /**
@@ -207,8 +279,13 @@ namespace vkeng {
         template<typename T, typename... Args>
         std::shared_ptr<T> addComponent(Args&&... args) {
             static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
-            
-            auto component = std::make_shared<T>(std::forward<Args>(args)...);
+
+            // Components live in per-type pools so same-type instances sit
+            // packed in memory; the shared_ptr's deleter returns the slot
+            T* raw = ComponentPools::get().pool<T>().allocate(std::forward<Args>(args)...);
+            std::shared_ptr<T> component(raw, [](T* p) {
+                ComponentPools::get().pool<T>().release(p);
+            });
             auto typeId = getComponentTypeId<T>();
             
             // Remove existing component of this type if it exists
@@ -218,7 +295,8 @@ namespace vkeng {
             
             m_components[typeId] = component;
             component->initialize(this);
-            
+            bumpStructureVersion();
+
             return component;
         }
 
@@ -263,6 +341,7 @@ namespace vkeng {
             if (auto it = m_components.find(typeId); it != m_components.end()) {
                 it->second->destroy();
                 m_components.erase(it);
+                bumpStructureVersion();
                 return true;
             }
             return false;
@@ -293,8 +372,10 @@ namespace vkeng {
         /**
          * @brief Set the name of this node
          * @param name New name for the node
+         *
+         * Re-files the node in the SceneQueryIndex under the new hash.
          */
-        void setName(const std::string& name) { m_name = name; }
+        void setName(const std::string& name);
 
         /**
          * @brief Get the name of this node
@@ -302,6 +383,35 @@ namespace vkeng {
          */
         const std::string& getName() const { return m_name; }
 
+        /**
+         * @brief Get this node's name hash
+         *
+         * The canonical identity for name queries: comparing two ids is
+         * one integer op, and literal queries ("player_root"_id) hash at
+         * compile time.
+         */
+        StringId getNameId() const { return m_nameId; }
+
+        /**
+         * @brief Find a descendant node by name hash
+         *
+         * Depth-first over the subtree below this node (this node itself
+         * is not considered). Comparisons are single integer ops against
+         * each node's cached name hash — no string hashing, no
+         * allocation, regardless of tree depth. For scene-wide lookups
+         * prefer SceneQueryIndex::findNode(), which is a single map probe.
+         *
+         * @param nameId Hash of the name to find (use the ""_id literal)
+         * @param recursive Search the whole subtree (default) or direct children only
+         * @return The first match in traversal order, or nullptr
+         */
+        std::shared_ptr<SceneNode> findChild(StringId nameId, bool recursive = true) const;
+
+        /** @brief Convenience overload hashing a runtime name. */
+        std::shared_ptr<SceneNode> findChild(const std::string& name, bool recursive = true) const {
+            return findChild(StringId(name), recursive);
+        }
+
         /**
          * @brief Set whether this node is active
          * @param active True to activate, false to deactivate
@@ -317,6 +427,59 @@ namespace vkeng {
          */
         bool isActive() const { return m_active; }
 
+        /**
+         * @brief Check if this node and all of its ancestors are active
+         * @return True only if no node on the path to the root is inactive
+         *
+         * Pool-based component scans (ComponentPools::forEachComponent) can
+         * reach components whose nodes sit under a deactivated subtree; this
+         * is the equivalent of the isActive() pruning that a recursive
+         * traversal gets for free.
+         */
+        bool isActiveInHierarchy() const {
+            for (const SceneNode* node = this; node; node = node->m_parent) {
+                if (!node->m_active) return false;
+            }
+            return true;
+        }
+
+        // ================== Structure Versioning ==================
+
+        /**
+         * @brief Global scene-structure version, bumped by topology changes.
+         *
+         * addChild/removeChild and component add/remove increment this
+         * counter (MeshRenderer also bumps it on mesh/material swaps).
+         * Systems holding retained views of the graph — the renderer's
+         * cached draw list — compare it against the version they were built
+         * from and rebuild only when it moved. Per-frame state like active
+         * flags and transforms is deliberately not structural.
+         */
+        static uint64_t getStructureVersion() {
+            return s_structureVersion.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Record a structural change (topology, components, materials). */
+        static void bumpStructureVersion() {
+            s_structureVersion.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Mark this node's geometry as static (never moves at runtime)
+         * @param isStatic True to flag the node for static optimizations
+         *
+         * Static nodes are candidates for StaticBatcher::batch(), which bakes
+         * their world transform into merged vertex buffers at scene finalize.
+         * Moving a node after it has been batched has no visual effect.
+         */
+        void setStatic(bool isStatic) { m_static = isStatic; }
+
+        /**
+         * @brief Check if this node is flagged static
+         * @return True if node is static
+         */
+        bool isStatic() const { return m_static; }
+
         /**
          * @brief Update this node and all its components
          * @param deltaTime Time elapsed since last update in seconds
@@ -326,7 +489,28 @@ namespace vkeng {
          */
         void update(float deltaTime);
 
+        /**
+         * @brief Recompute every dirty world transform in one batched pass
+         *
+         * Transform edits append the affected subtree root to a frame-wide
+         * dirty list (deduplicated by the clean-to-dirty transition, since a
+         * node below an already-dirty ancestor never transitions itself).
+         * This walks each listed subtree top-down, recomputing exactly the
+         * changed nodes, so the per-query lazy path in getWorldMatrix()
+         * becomes a pure cache read for every consumer that runs after it
+         * (renderer collection, physics, spatial audio).
+         *
+         * Idempotent and cheap when nothing changed; the first transform
+         * consumer of the frame calls it. Main thread only, like the lazy
+         * caches it replaces.
+         */
+        static void flushDirtyTransforms();
+
     private:
+        /// TransformSystem assigns m_transformIndex and writes the cached
+        /// world matrix directly during its bulk update pass.
+        friend class TransformSystem;
+
         /**
          * @brief Mark world transform as dirty (needs recalculation)
          */
@@ -342,6 +526,23 @@ namespace vkeng {
          */
         void updateWorldTransform() const;
 
+        /**
+         * @brief Recompute this subtree's dirty world transforms top-down
+         *
+         * Skips clean children entirely: dirtiness propagates downward at
+         * mark time, so a clean child implies a clean subtree.
+         */
+        void updateWorldTransformRecursive() const;
+
+        /**
+         * @brief Mark cached world bounds dirty for this node and all ancestors
+         *
+         * Own and subtree bounds are invalidated here; ancestors only need their
+         * aggregate subtree bounds invalidated. Stops early once a clean ancestor
+         * chain is already marked dirty.
+         */
+        void markWorldBoundsDirty() const;
+
         // Node hierarchy
         SceneNode* m_parent = nullptr;
         std::vector<std::shared_ptr<SceneNode>> m_children;
@@ -350,16 +551,34 @@ namespace vkeng {
         Transform m_transform;
         mutable glm::mat4 m_cachedWorldMatrix = glm::mat4(1.0f);
         mutable bool m_worldTransformDirty = true;
+        mutable uint64_t m_worldTransformVersion = 0; ///< Bumped when the cached world matrix changes
+        uint32_t m_transformIndex = UINT32_MAX; ///< Index into a TransformSystem, or kInvalidIndex
+
+        // Cached world-space bounding volumes (lazily rebuilt when dirty)
+        mutable glm::vec3 m_cachedMeshBoundsMin{0.0f};     ///< World AABB min of own mesh
+        mutable glm::vec3 m_cachedMeshBoundsMax{0.0f};     ///< World AABB max of own mesh
+        mutable glm::vec3 m_cachedSubtreeBoundsMin{0.0f};  ///< World AABB min of subtree
+        mutable glm::vec3 m_cachedSubtreeBoundsMax{0.0f};  ///< World AABB max of subtree
+        mutable bool m_meshBoundsValid = false;            ///< Own mesh AABB exists
+        mutable bool m_subtreeBoundsValid = false;         ///< Subtree AABB exists
+        mutable bool m_worldBoundsDirty = true;            ///< Cached bounds need rebuild
 
         // Components
         std::unordered_map<ComponentTypeId, std::shared_ptr<Component>> m_components;
 
         // Node properties
         std::string m_name;
+        StringId m_nameId;  ///< Cached hash of m_name; kept in sync by setName
         bool m_active = true;
+        bool m_static = false;
 
         // Static counter for automatic naming
         static std::atomic<uint32_t> s_nodeCounter;
+        static std::atomic<uint64_t> s_structureVersion;
+
+        /// Subtree roots that transitioned clean→dirty since the last
+        /// flushDirtyTransforms(); main-thread, like the caches themselves
+        static std::vector<const SceneNode*> s_dirtySubtrees;
     };
 
 } // namespace vkeng
\ No newline at end of file
@@ -0,0 +1,98 @@
+/**
+ * @file SceneNodePool.hpp
+ * @brief Slab-allocated storage for SceneNode instances
+ *
+ * Every SceneNode used to be an individual make_shared heap allocation,
+ * so building a 100k-node streamed section meant 100k+ mallocs and
+ * teardown gave most of them straight back to the allocator. The pool
+ * instead carves nodes out of fixed-size slabs: creation is a free-list
+ * pop plus placement-new, destruction returns the slot, and a drained
+ * section's slabs are released wholesale with trim().
+ *
+ * Key Pool Concepts:
+ * - Slab Storage: nodes are constructed into blocks of slots that never
+ *   move, so the shared_ptrs handed out stay valid for the node's
+ *   lifetime (same guarantee as TypedComponentPool)
+ * - Creation-Order Layout: slots are handed out in creation order, so a
+ *   loader that builds its hierarchy breadth-first gets breadth-first
+ *   memory order — traversals touch slabs sequentially
+ * - Free List: released slots are recycled before new slabs are added,
+ *   so steady-state streaming churn allocates nothing
+ * - Bulk Release: trim() frees every slab with no live nodes, returning
+ *   a whole unloaded section's memory in one pass instead of per-node
+ * - Ownership: the public API is unchanged — SceneNode::create() hands
+ *   out ordinary shared_ptrs whose deleter releases the slot
+ */
+#pragma once
+
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace vkeng {
+
+    /**
+     * @class SceneNodePool
+     * @brief Engine-wide slab allocator behind SceneNode::create()
+     *
+     * Matches the ComponentPools conventions: singleton access via
+     * get(), block storage with a free list, main-thread use (scene
+     * mutation is not thread-safe anywhere in the graph).
+     */
+    class SceneNodePool {
+    public:
+        /** @brief Slots per slab — one slab spans a few cache pages. */
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        /** @brief Gets the singleton instance. */
+        static SceneNodePool& get();
+
+        SceneNodePool(const SceneNodePool&) = delete;
+        SceneNodePool& operator=(const SceneNodePool&) = delete;
+
+        /**
+         * @brief Constructs a node in the next free slot.
+         * @return shared_ptr whose deleter returns the slot to the pool
+         */
+        std::shared_ptr<SceneNode> createNode(const std::string& name = "");
+
+        /** @brief Number of live pooled nodes. */
+        size_t liveCount() const { return m_liveCount; }
+
+        /** @brief Number of slabs currently backed by memory. */
+        size_t blockCount() const;
+
+        /**
+         * @brief Releases every slab with no live nodes.
+         *
+         * Call after dropping a streamed section's root: the section's
+         * nodes have returned their slots, so its slabs free in one pass.
+         * Slabs still hosting live nodes are untouched; freed slab
+         * positions are reused by later growth.
+         */
+        void trim();
+
+    private:
+        SceneNodePool() = default;
+        ~SceneNodePool();
+
+        /** @brief One fixed-size run of node slots; never reallocated while live. */
+        struct Block {
+            alignas(SceneNode) unsigned char storage[sizeof(SceneNode) * BLOCK_SIZE];
+            bool live[BLOCK_SIZE] = {};
+            size_t liveInBlock = 0;   ///< Live slots; 0 makes the slab trimmable
+
+            SceneNode* at(size_t offset) { return reinterpret_cast<SceneNode*>(storage) + offset; }
+        };
+
+        /** @brief Destroys a node and returns its slot to the free list. */
+        void release(SceneNode* node);
+
+        std::vector<std::unique_ptr<Block>> m_blocks;   ///< Stable slab storage (null = trimmed)
+        std::vector<size_t> m_freeList;                 ///< Recyclable slot indices
+        size_t m_slotCount = 0;                         ///< High-water slot mark
+        size_t m_liveCount = 0;                         ///< Currently constructed nodes
+    };
+
+} // namespace vkeng
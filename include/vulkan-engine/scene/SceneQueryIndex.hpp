@@ -0,0 +1,118 @@
+/**
+ * @file SceneQueryIndex.hpp
+ * @brief Incremental scene-wide index for name and component-type queries
+ *
+ * Finding a node used to mean a recursive walk from some root — fine for
+ * a one-off, but serializer fix-ups, app logic, and editor-style tooling
+ * repeat the same lookups, and each walk touches the whole tree. The
+ * query index keeps a name-hash map maintained incrementally by SceneNode
+ * itself (construction, destruction, renames), so a lookup is one
+ * unordered_map probe regardless of scene size.
+ *
+ * Key Query Index Concepts:
+ * - Incremental Maintenance: nodes register on construction and
+ *   unregister in their destructor; setName() re-files the entry. No
+ *   rebuild pass ever runs, and detached subtrees stay queryable while
+ *   they are being assembled
+ * - Hash Keys: names are indexed by their StringId, so literal queries
+ *   ("player_root"_id) hash at compile time and duplicates are handled
+ *   via multimap semantics — findNode() returns one match, findNodes()
+ *   collects them all
+ * - Typed Iteration: per-component-type dense lists already exist in
+ *   ComponentPools; forEachNodeWith() fronts them with the owning node,
+ *   replacing "scan the whole tree for component X" consumers
+ * - Threading: main-thread only, like the scene graph it mirrors — node
+ *   lifetime and renames must not race queries
+ */
+#pragma once
+
+#include "vulkan-engine/components/ComponentPool.hpp"
+#include "vulkan-engine/core/StringId.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace vkeng {
+
+    class SceneNode;
+
+    /**
+     * @class SceneQueryIndex
+     * @brief Engine-wide node lookup index (singleton, like ComponentPools)
+     *
+     * Usage:
+     * @code
+     *   auto player = SceneQueryIndex::get().findNode("player_root"_id);
+     *   SceneQueryIndex::get().forEachNodeWith<RigidBody>(
+     *       [](SceneNode& node, RigidBody& body) { ... });
+     * @endcode
+     */
+    class SceneQueryIndex {
+    public:
+        static SceneQueryIndex& get() {
+            static SceneQueryIndex instance;
+            return instance;
+        }
+
+        SceneQueryIndex(const SceneQueryIndex&) = delete;
+        SceneQueryIndex& operator=(const SceneQueryIndex&) = delete;
+
+        /**
+         * @brief Looks up a node by name hash.
+         * @return A live node with that name, or nullptr
+         *
+         * With duplicate names the choice between them is unspecified —
+         * use findNodes() when duplicates are expected. Unlike
+         * SceneNode::findChild() this is scene-wide and O(1), not scoped
+         * to a subtree.
+         */
+        std::shared_ptr<SceneNode> findNode(StringId nameId) const;
+
+        /** @brief Convenience overload hashing a runtime name. */
+        std::shared_ptr<SceneNode> findNode(const std::string& name) const {
+            return findNode(StringId(name));
+        }
+
+        /**
+         * @brief Collects every node with the given name hash.
+         * @param out Receives the matches (appended, not cleared)
+         * @return Number of matches appended
+         */
+        size_t findNodes(StringId nameId, std::vector<std::shared_ptr<SceneNode>>& out) const;
+
+        /**
+         * @brief Iterates every node owning a live component of type T.
+         * @param fn Callable taking (SceneNode&, T&)
+         *
+         * A linear scan over the type's packed component pool — the
+         * replacement for recursive "find all nodes with X" traversals.
+         * Active-state filtering is the caller's business (use
+         * isActiveInHierarchy(), as the pool scan consumers do).
+         */
+        template<typename T, typename Fn>
+        void forEachNodeWith(Fn&& fn) {
+            ComponentPools::get().forEachComponent<T>([&fn](T& component) {
+                if (SceneNode* owner = component.getOwner()) {
+                    fn(*owner, component);
+                }
+            });
+        }
+
+        /** @brief Number of indexed (i.e. live) nodes. */
+        size_t size() const { return m_byName.size(); }
+
+    private:
+        /// SceneNode drives registration from its lifecycle methods
+        friend class SceneNode;
+
+        SceneQueryIndex() = default;
+
+        void registerNode(SceneNode* node);
+        void unregisterNode(SceneNode* node, StringId nameId);
+
+        /// Multimap: names are not unique, and each entry is one node
+        std::unordered_multimap<StringId, SceneNode*> m_byName;
+    };
+
+} // namespace vkeng
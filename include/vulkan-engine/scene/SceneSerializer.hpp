@@ -10,8 +10,14 @@
  * registerComponent<T>() so that the serializer knows how to save
  * and reconstruct each component type.
  *
- * File format: JSON (using nlohmann/json or a lightweight alternative).
- * The format is intentionally human-readable for debugging.
+ * Two formats are supported:
+ * - JSON: human-readable debug/interchange format.
+ * - Binary: length-prefixed chunks with a string table interning node and
+ *   component type names. Nodes are stored in depth-first order (parents
+ *   always precede children), so the file can be applied chunk-by-chunk —
+ *   a background reader decodes chunks while the main thread attaches the
+ *   nodes it already has, letting rendering start before the full scene
+ *   is in memory. See loadSceneBinaryStreaming()/pumpStreamedChunks().
  */
 #pragma once
 
@@ -21,6 +27,7 @@
 #include <functional>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 namespace vkeng {
 
@@ -84,7 +91,96 @@ namespace vkeng {
          */
         std::shared_ptr<SceneNode> loadScene(const std::string& filepath) const;
 
+        /**
+         * @brief Save a scene graph to the binary chunked format.
+         * @param root The root SceneNode to serialize.
+         * @param filepath Output file path (convention: .vkscene).
+         * @return true on success, false on IO error.
+         *
+         * Nodes are written depth-first in chunks of SCENE_NODES_PER_CHUNK,
+         * with all node and component type names interned into a string
+         * table chunk at the front of the file. Component payloads are the
+         * same strings the registered SerializeFn produces for JSON, stored
+         * length-prefixed. Multi-byte fields are little-endian.
+         */
+        bool saveSceneBinary(const SceneNode* root, const std::string& filepath) const;
+
+        /**
+         * @brief Load a binary scene synchronously, chunk by chunk.
+         * @param filepath Input file path.
+         * @return The reconstructed root node, or nullptr on failure.
+         *
+         * Peak memory stays at one decoded chunk plus the constructed graph —
+         * the whole file is never resident as a parse tree the way a JSON
+         * document is.
+         */
+        std::shared_ptr<SceneNode> loadSceneBinary(const std::string& filepath) const;
+
+        /**
+         * @brief Begin a streaming load of a binary scene.
+         * @param filepath Input file path.
+         * @return The root node (with the first chunk of nodes attached),
+         *         or nullptr on failure.
+         *
+         * The header, string table, and first node chunk are read
+         * synchronously so the caller gets a renderable partial scene
+         * immediately. Remaining chunks are read and decoded on the job
+         * system; call pumpStreamedChunks() once per frame to attach them.
+         * Only one streaming load may be active per serializer at a time.
+         */
+        std::shared_ptr<SceneNode> loadSceneBinaryStreaming(const std::string& filepath);
+
+        /**
+         * @brief Attaches chunks the background reader has finished decoding.
+         * @param maxChunks Maximum chunks to apply this call (0 = all ready).
+         * @return true while the stream is still in progress, false once
+         *         complete (or failed, which logs an error).
+         *
+         * Must be called from the thread that owns the scene graph (the
+         * deserializer callbacks may create GPU resources); mirrors
+         * ResourceManager::pumpCompletedLoads().
+         */
+        bool pumpStreamedChunks(uint32_t maxChunks = 0);
+
+        /** @brief Whether a streaming load is currently in progress. */
+        bool isStreaming() const { return m_streaming != nullptr; }
+
+        /** @brief Fraction of nodes attached so far [0, 1]; 1 when idle. */
+        float getStreamingProgress() const;
+
     private:
+        /** @brief A component decoded from a binary chunk, names resolved. */
+        struct DecodedComponent {
+            std::string typeName;
+            std::string data;
+        };
+
+        /** @brief A node decoded from a binary chunk, ready to attach. */
+        struct DecodedNode {
+            uint32_t parentIndex;       ///< Index into depth-first node order; UINT32_MAX = root
+            std::string name;
+            uint8_t flags;              ///< Bit 0: active, bit 1: static
+            glm::vec3 position;
+            glm::quat rotation;
+            glm::vec3 scale;
+            std::vector<DecodedComponent> components;
+        };
+
+        /** @brief Shared state between the background reader and the pump. */
+        struct StreamingState;
+
+        /** @brief Decode one node chunk payload into attachable records. */
+        static bool decodeNodeChunk(const std::vector<char>& payload,
+                                    const std::vector<std::string>& strings,
+                                    std::vector<DecodedNode>& out);
+
+        /** @brief Create, configure, and attach decoded nodes (main thread). */
+        std::shared_ptr<SceneNode> applyDecodedNodes(
+            const std::vector<DecodedNode>& nodes,
+            std::vector<std::shared_ptr<SceneNode>>& nodesByIndex) const;
+
+        /** @brief Active streaming load, shared with the reader job. */
+        std::shared_ptr<StreamingState> m_streaming;
         struct SerializerEntry {
             std::string typeName;
             SerializeFn fn;
@@ -0,0 +1,73 @@
+/**
+ * @file StaticBatcher.hpp
+ * @brief Merges static meshes sharing a material into single draw calls
+ *
+ * Architectural scenes contain thousands of small static MeshRenderer nodes;
+ * each one costs a push-constant update and a vkCmdDrawIndexed per frame, and
+ * that per-draw CPU setup dominates frame time long before the GPU is busy.
+ * The batcher runs once at scene finalize: meshes on nodes flagged static
+ * that share a Material are merged into one consolidated vertex/index buffer
+ * with their world transforms baked into the vertices, replacing N draws
+ * with one.
+ *
+ * Key Batching Concepts:
+ * - Transform Baking: positions are transformed by the node's world matrix,
+ *   normals/tangents by its inverse-transpose, so the merged mesh renders
+ *   with an identity model matrix
+ * - Material Grouping: only meshes sharing the exact Material instance are
+ *   merged, so blend mode, cull mode, and texture bindings stay uniform
+ *   within a batch
+ * - Source Replacement: batched MeshRenderers have their mesh cleared (the
+ *   nodes and their children stay in the graph); one new node per batch is
+ *   attached to the root
+ *
+ * @warning Batched geometry is permanently in world space: moving a source
+ *          node afterwards has no visual effect. Batch only truly static
+ *          scenery, and run the batcher before TransformSystem::build().
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace vkeng {
+
+    class MemoryManager;
+    class SceneNode;
+
+    /**
+     * @class StaticBatcher
+     * @brief One-shot scene pass that consolidates static draws by material
+     *
+     * Usage at scene finalize, after the hierarchy and transforms are final:
+     * @code
+     *   auto stats = StaticBatcher::batch(*rootNode, memoryManager);
+     *   LOG_INFO(RENDERING, "{} draws merged into {} batches",
+     *            stats.meshesMerged, stats.batchesCreated);
+     * @endcode
+     *
+     * Only meshes that still hold their CPU-side copy (Mesh::hasCpuData())
+     * can be baked; groups with a single member are left untouched.
+     */
+    class StaticBatcher {
+    public:
+        /**
+         * @struct Stats
+         * @brief Result summary of a batching pass
+         */
+        struct Stats {
+            uint32_t batchesCreated = 0;  ///< Merged meshes added to the scene
+            uint32_t meshesMerged = 0;    ///< Source draws folded into batches
+            uint32_t verticesBaked = 0;   ///< Total vertices transformed
+        };
+
+        /**
+         * @brief Merges static, material-sharing meshes under the given root
+         * @param root Scene root; batch nodes are attached directly to it
+         * @param memoryManager Allocator used to build the merged GPU buffers
+         * @return Statistics describing what was merged
+         */
+        static Stats batch(SceneNode& root, std::shared_ptr<MemoryManager> memoryManager);
+    };
+
+} // namespace vkeng
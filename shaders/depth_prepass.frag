@@ -0,0 +1,10 @@
+#version 450
+
+// Depth pre-pass fragment shader: depth comes from the fixed-function
+// rasterizer and color writes are masked off in the pipeline, so there is
+// nothing to do. Paired with the regular shader.vert so the pre-pass and
+// the shaded pass rasterize identical depth values (required for the
+// EQUAL depth test in the shaded pass).
+
+void main() {
+}
@@ -0,0 +1,23 @@
+#version 450
+
+// Minimal shading for the experimental meshlet path: a camera headlight
+// over the interpolated normal. Materials, shadows, and clustered lights
+// stay with the classic pipeline for now.
+
+layout(location = 0) in vec3 inNormal;
+layout(location = 1) in vec3 inWorldPos;
+
+layout(set = 0, binding = 0) uniform FrameUbo {
+    mat4 viewProj;
+    vec4 frustumPlanes[6];
+    vec4 cameraPos;
+} ubo;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    vec3 normal = normalize(inNormal);
+    vec3 toCamera = normalize(ubo.cameraPos.xyz - inWorldPos);
+    float diffuse = 0.15 + 0.85 * max(dot(normal, toCamera), 0.0);
+    outColor = vec4(vec3(diffuse), 1.0);
+}
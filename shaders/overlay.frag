@@ -0,0 +1,17 @@
+#version 450
+
+// Tints the R8 font atlas coverage with the per-vertex color. Graph bars
+// and backdrop quads sample the solid glyph, so text and bars share one
+// pipeline and one draw.
+
+layout(set = 0, binding = 0) uniform sampler2D fontAtlas;
+
+layout(location = 0) in vec2 fragUv;
+layout(location = 1) in vec4 fragColor;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    float coverage = texture(fontAtlas, fragUv).r;
+    outColor = vec4(fragColor.rgb, fragColor.a * coverage);
+}
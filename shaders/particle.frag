@@ -0,0 +1,20 @@
+#version 450
+
+// Soft circular sprite: radial falloff from the quad center, modulated by
+// the per-particle color (premultiplied by the ramp alpha in the sim) and
+// the end-of-life fade from the vertex stage.
+
+layout(location = 0) in vec4 fragColor;
+layout(location = 1) in vec2 fragUv;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    float distanceFromCenter = length(fragUv - vec2(0.5)) * 2.0;
+    float falloff = 1.0 - smoothstep(0.4, 1.0, distanceFromCenter);
+    float alpha = fragColor.a * falloff;
+    if (alpha <= 0.001) {
+        discard;
+    }
+    outColor = vec4(fragColor.rgb * falloff, alpha);
+}
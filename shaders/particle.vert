@@ -0,0 +1,66 @@
+#version 450
+
+// Expands one camera-facing quad per particle instance. There is no
+// per-vertex buffer: binding 0 is the per-instance particle stream (written
+// by particle_sim.comp or the CPU path) and the six quad corners come from
+// gl_VertexIndex. The billboard axes are the camera right/up vectors read
+// straight out of the view matrix rows.
+
+const uint MAX_LIGHTS = 8;
+
+struct Light {
+    vec4 positionAndType;
+    vec4 directionAndRange;
+    vec4 colorAndIntensity;
+    vec4 spotParams;
+};
+
+const uint CASCADE_COUNT = 4;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 view;
+    mat4 proj;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
+    vec4 cameraPosition;
+    vec4 ambientColor;
+    vec4 debugView;
+    vec4 cascadeSplits;
+    uint lightCount;
+    uint _pad0;
+    uint _pad1;
+    uint _pad2;
+    Light lights[MAX_LIGHTS];
+} ubo;
+
+layout(location = 0) in vec4 inPositionAndSize;  // xyz = world position, w = billboard size
+layout(location = 1) in vec4 inVelocityAndLife;  // xyz = velocity, w = remaining life
+layout(location = 2) in vec4 inColorAndMaxLife;  // rgb = premultiplied color, w = max life
+
+layout(location = 0) out vec4 fragColor;
+layout(location = 1) out vec2 fragUv;
+
+// Two CCW triangles covering the unit quad
+const vec2 CORNERS[6] = vec2[](
+    vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5),
+    vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+
+void main() {
+    // Dead particles (life <= 0 or zero size) collapse to a degenerate
+    // point and rasterize nothing — the GPU path draws its whole pool
+    float size = inVelocityAndLife.w > 0.0 ? inPositionAndSize.w : 0.0;
+
+    vec3 cameraRight = vec3(ubo.view[0][0], ubo.view[1][0], ubo.view[2][0]);
+    vec3 cameraUp = vec3(ubo.view[0][1], ubo.view[1][1], ubo.view[2][1]);
+
+    vec2 corner = CORNERS[gl_VertexIndex];
+    vec3 worldPosition = inPositionAndSize.xyz
+        + cameraRight * (corner.x * size)
+        + cameraUp * (corner.y * size);
+
+    gl_Position = ubo.proj * ubo.view * vec4(worldPosition, 1.0);
+
+    // Fade out over the last quarter of the particle's life
+    float fade = clamp(inVelocityAndLife.w / (0.25 * inColorAndMaxLife.w), 0.0, 1.0);
+    fragColor = vec4(inColorAndMaxLife.rgb, fade);
+    fragUv = corner + vec2(0.5);
+}
@@ -9,13 +9,23 @@ struct Light {
     vec4 spotParams;
 };
 
+const uint CASCADE_COUNT = 4;
+
+// Specialization constants baked per pipeline variant (see PipelineConfig):
+// the driver folds the debug and shadow branches away at pipeline build
+// and bounds the light loop with a compile-time constant.
+layout(constant_id = 0) const uint SPEC_DEBUG_MODE = 0;       // DebugShadingMode
+layout(constant_id = 1) const bool SPEC_SHADOWS_ENABLED = true;
+layout(constant_id = 2) const uint SPEC_MAX_LIGHTS = 8;
+
 layout(set = 0, binding = 0) uniform GlobalUbo {
     mat4 view;
     mat4 proj;
-    mat4 lightSpaceMatrix;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
     vec4 cameraPosition;
     vec4 ambientColor;
     vec4 debugView;
+    vec4 cascadeSplits;
     uint lightCount;
     uint _pad0;
     uint _pad1;
@@ -29,6 +39,7 @@ layout(push_constant) uniform PushConstants {
     vec4 emissiveFactor;
     vec4 specularColorAndShininess;
     vec4 pbrFactors; // metallic(x), roughness(y), normalScale(z), occlusionStrength(w)
+    vec4 uvScaleOffset; // Texture atlas UV transform: uv * xy + zw
 } pushConstants;
 
 layout(set = 1, binding = 0) uniform sampler2D texBaseColor;
@@ -37,7 +48,7 @@ layout(set = 1, binding = 2) uniform sampler2D texMetallicRoughness;
 layout(set = 1, binding = 3) uniform sampler2D texOcclusion;
 layout(set = 1, binding = 4) uniform sampler2D texEmissive;
 
-layout(set = 2, binding = 0) uniform sampler2DShadow texShadowMap;
+layout(set = 2, binding = 0) uniform sampler2DArrayShadow texShadowMap;
 
 layout(location = 0) in vec3 fragColor;
 layout(location = 1) in vec3 fragWorldPosition;
@@ -45,7 +56,6 @@ layout(location = 2) in vec3 fragWorldNormal;
 layout(location = 3) in vec2 fragTexCoord;
 layout(location = 4) in vec3 fragWorldTangent;
 layout(location = 5) in vec3 fragWorldBitangent;
-layout(location = 6) in vec4 fragLightSpacePos;
 
 layout(location = 0) out vec4 outColor;
 
@@ -61,17 +71,28 @@ vec3 tonemapACES(vec3 x) {
     return clamp((x * (a * x + b)) / (x * (c * x + d) + e), 0.0, 1.0);
 }
 
-float calculateShadow(vec4 lightSpacePos, vec3 normal, vec3 lightDir) {
-    // debugView.y: 1.0 = shadows enabled
-    if (ubo.debugView.y < 0.5) return 1.0;
+float calculateShadow(vec3 worldPos, vec3 normal, vec3 lightDir) {
+    // Shadow sampling is compiled out of no-shadow variants
+    if (!SPEC_SHADOWS_ENABLED) return 1.0;
+
+    // Select the cascade whose depth slice contains this fragment
+    float viewDepth = -(ubo.view * vec4(worldPos, 1.0)).z;
+    uint cascade = 0u;
+    for (uint i = 0u; i < CASCADE_COUNT - 1u; i++) {
+        if (viewDepth > ubo.cascadeSplits[i]) cascade = i + 1u;
+    }
+    // Beyond the last cascade: unshadowed
+    if (viewDepth > ubo.cascadeSplits[CASCADE_COUNT - 1u]) return 1.0;
+
+    vec4 lightSpacePos = ubo.lightSpaceMatrices[cascade] * vec4(worldPos, 1.0);
 
-    // Perspective divide
+    // Perspective divide (w == 1 for the ortho cascades, kept for safety)
     vec3 projCoords = lightSpacePos.xyz / lightSpacePos.w;
 
     // Transform from [-1,1] to [0,1] UV space
     projCoords.xy = projCoords.xy * 0.5 + 0.5;
 
-    // Fragments outside the shadow map are lit (border color = white handles this,
+    // Fragments outside the cascade are lit (border color = white handles this,
     // but explicit check avoids edge artifacts)
     if (projCoords.x < 0.0 || projCoords.x > 1.0 ||
         projCoords.y < 0.0 || projCoords.y > 1.0 ||
@@ -85,12 +106,12 @@ float calculateShadow(vec4 lightSpacePos, vec3 normal, vec3 lightDir) {
 
     // 3x3 PCF (percentage-closer filtering) for softer shadow edges
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(texShadowMap, 0);
+    vec2 texelSize = 1.0 / vec2(textureSize(texShadowMap, 0).xy);
     for (int x = -1; x <= 1; x++) {
         for (int y = -1; y <= 1; y++) {
             vec2 offset = vec2(x, y) * texelSize;
-            // sampler2DShadow: texture() returns comparison result [0,1]
-            shadow += texture(texShadowMap, vec3(projCoords.xy + offset, biasedDepth));
+            // sampler2DArrayShadow: texture() returns comparison result [0,1]
+            shadow += texture(texShadowMap, vec4(projCoords.xy + offset, float(cascade), biasedDepth));
         }
     }
     shadow /= 9.0;
@@ -148,12 +169,12 @@ void main() {
     vec3 normal = getNormal();
 
     // --- Debug views (bypass lighting) ---
-    if (ubo.debugView.x > 1.5) {
+    if (SPEC_DEBUG_MODE == 2u) {
         outColor = vec4(normal * 0.5 + 0.5, 1.0);
         return;
     }
 
-    if (ubo.debugView.x > 0.5) {
+    if (SPEC_DEBUG_MODE == 1u) {
         // Unlit: raw linear color; swapchain sRGB encoding handles gamma
         outColor = vec4(baseColor + emissive, alpha);
         return;
@@ -182,7 +203,7 @@ void main() {
     float shadowFactor = 1.0;
     bool shadowApplied = false;
 
-    for (uint i = 0u; i < ubo.lightCount && i < MAX_LIGHTS; i++) {
+    for (uint i = 0u; i < min(ubo.lightCount, SPEC_MAX_LIGHTS); i++) {
         Light light = ubo.lights[i];
         float lightType = light.positionAndType.w;
 
@@ -195,7 +216,7 @@ void main() {
 
             // Apply shadow mapping to the first directional light
             if (!shadowApplied) {
-                shadowFactor = calculateShadow(fragLightSpacePos, normal, L);
+                shadowFactor = calculateShadow(fragWorldPosition, normal, L);
                 shadowApplied = true;
             }
         } else {
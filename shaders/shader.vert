@@ -9,13 +9,16 @@ struct Light {
     vec4 spotParams;
 };
 
+const uint CASCADE_COUNT = 4;
+
 layout(set = 0, binding = 0) uniform GlobalUbo {
     mat4 view;
     mat4 proj;
-    mat4 lightSpaceMatrix;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
     vec4 cameraPosition;
     vec4 ambientColor;
     vec4 debugView;
+    vec4 cascadeSplits;
     uint lightCount;
     uint _pad0;
     uint _pad1;
@@ -29,6 +32,7 @@ layout(push_constant) uniform PushConstants {
     vec4 emissiveFactor;
     vec4 specularColorAndShininess;
     vec4 pbrFactors; // metallic(x), roughness(y), normalScale(z), occlusionStrength(w)
+    vec4 uvScaleOffset; // Texture atlas UV transform: uv * xy + zw
 } pushConstants;
 
 layout(location = 0) in vec3 inPosition;
@@ -43,7 +47,6 @@ layout(location = 2) out vec3 fragWorldNormal;
 layout(location = 3) out vec2 fragTexCoord;
 layout(location = 4) out vec3 fragWorldTangent;
 layout(location = 5) out vec3 fragWorldBitangent;
-layout(location = 6) out vec4 fragLightSpacePos;
 
 void main() {
     vec4 worldPosition = pushConstants.modelMatrix * vec4(inPosition, 1.0);
@@ -54,7 +57,8 @@ void main() {
     fragWorldPosition = worldPosition.xyz;
     fragWorldNormal = normalize(normalMatrix * inNormal);
     fragColor = inColor;
-    fragTexCoord = inTexCoord;
+    // Remap into the texture's atlas sub-region (identity when unatlased)
+    fragTexCoord = inTexCoord * pushConstants.uvScaleOffset.xy + pushConstants.uvScaleOffset.zw;
 
     // Tangent and bitangent for normal mapping (TBN matrix)
     vec3 T = normalize(normalMatrix * inTangent.xyz);
@@ -65,7 +69,5 @@ void main() {
     fragWorldTangent = T;
     fragWorldBitangent = B;
 
-    fragLightSpacePos = ubo.lightSpaceMatrix * worldPosition;
-
     gl_Position = ubo.proj * ubo.view * worldPosition;
 }
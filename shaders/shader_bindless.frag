@@ -0,0 +1,290 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+// Bindless variant of shader.frag: instead of five per-material samplers in
+// set 1, the whole texture pool is one runtime-sized array bound once per
+// frame and each draw selects its textures through packed push-constant
+// indices (see BindlessPushConstants in Uniforms.hpp). Lighting, shadows,
+// and tone mapping are identical to shader.frag.
+
+const uint MAX_LIGHTS = 8;
+
+struct Light {
+    vec4 positionAndType;
+    vec4 directionAndRange;
+    vec4 colorAndIntensity;
+    vec4 spotParams;
+};
+
+const uint CASCADE_COUNT = 4;
+
+// Specialization constants baked per pipeline variant (see PipelineConfig):
+// the driver folds the debug and shadow branches away at pipeline build
+// and bounds the light loop with a compile-time constant.
+layout(constant_id = 0) const uint SPEC_DEBUG_MODE = 0;       // DebugShadingMode
+layout(constant_id = 1) const bool SPEC_SHADOWS_ENABLED = true;
+layout(constant_id = 2) const uint SPEC_MAX_LIGHTS = 8;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 view;
+    mat4 proj;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
+    vec4 cameraPosition;
+    vec4 ambientColor;
+    vec4 debugView;
+    vec4 cascadeSplits;
+    uint lightCount;
+    uint _pad0;
+    uint _pad1;
+    uint _pad2;
+    Light lights[MAX_LIGHTS];
+} ubo;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix;
+    vec4 baseColorFactor;
+    vec4 emissiveFactor;
+    vec4 specularColorAndShininess;
+    vec4 pbrFactors; // metallic(x), roughness(y), normalScale(z), occlusionStrength(w)
+    vec4 uvScaleOffset; // Texture atlas UV transform (applied in the vertex stage)
+    // Bindless texture indices, two 16-bit slots per component:
+    // x = baseColor | (normal << 16), y = metallicRoughness | (occlusion << 16),
+    // z = emissive, w reserved
+    uvec4 textureIndices;
+} pushConstants;
+
+layout(set = 1, binding = 0) uniform sampler2D textures[];
+
+layout(set = 2, binding = 0) uniform sampler2DArrayShadow texShadowMap;
+
+layout(location = 0) in vec3 fragColor;
+layout(location = 1) in vec3 fragWorldPosition;
+layout(location = 2) in vec3 fragWorldNormal;
+layout(location = 3) in vec2 fragTexCoord;
+layout(location = 4) in vec3 fragWorldTangent;
+layout(location = 5) in vec3 fragWorldBitangent;
+
+layout(location = 0) out vec4 outColor;
+
+// Indices can diverge across fragments of one draw only in theory (they are
+// push constants, so uniform per draw), but nonuniformEXT keeps drivers
+// honest about descriptor indexing requirements.
+vec4 sampleBindless(uint index, vec2 uv) {
+    return texture(textures[nonuniformEXT(index)], uv);
+}
+
+// ACES filmic tone mapping (Narkowicz fit). Maps HDR lighting to [0,1] with a
+// smooth highlight rolloff. Output stays linear: the sRGB swapchain applies
+// gamma encoding on write, so the shader must NOT gamma-correct manually.
+vec3 tonemapACES(vec3 x) {
+    const float a = 2.51;
+    const float b = 0.03;
+    const float c = 2.43;
+    const float d = 0.59;
+    const float e = 0.14;
+    return clamp((x * (a * x + b)) / (x * (c * x + d) + e), 0.0, 1.0);
+}
+
+float calculateShadow(vec3 worldPos, vec3 normal, vec3 lightDir) {
+    // Shadow sampling is compiled out of no-shadow variants
+    if (!SPEC_SHADOWS_ENABLED) return 1.0;
+
+    // Select the cascade whose depth slice contains this fragment
+    float viewDepth = -(ubo.view * vec4(worldPos, 1.0)).z;
+    uint cascade = 0u;
+    for (uint i = 0u; i < CASCADE_COUNT - 1u; i++) {
+        if (viewDepth > ubo.cascadeSplits[i]) cascade = i + 1u;
+    }
+    // Beyond the last cascade: unshadowed
+    if (viewDepth > ubo.cascadeSplits[CASCADE_COUNT - 1u]) return 1.0;
+
+    vec4 lightSpacePos = ubo.lightSpaceMatrices[cascade] * vec4(worldPos, 1.0);
+
+    // Perspective divide (w == 1 for the ortho cascades, kept for safety)
+    vec3 projCoords = lightSpacePos.xyz / lightSpacePos.w;
+
+    // Transform from [-1,1] to [0,1] UV space
+    projCoords.xy = projCoords.xy * 0.5 + 0.5;
+
+    // Fragments outside the cascade are lit (border color = white handles this,
+    // but explicit check avoids edge artifacts)
+    if (projCoords.x < 0.0 || projCoords.x > 1.0 ||
+        projCoords.y < 0.0 || projCoords.y > 1.0 ||
+        projCoords.z > 1.0) {
+        return 1.0;
+    }
+
+    // Slope-scaled bias to reduce shadow acne
+    float bias = max(0.005 * (1.0 - dot(normal, lightDir)), 0.001);
+    float biasedDepth = projCoords.z - bias;
+
+    // 3x3 PCF (percentage-closer filtering) for softer shadow edges
+    float shadow = 0.0;
+    vec2 texelSize = 1.0 / vec2(textureSize(texShadowMap, 0).xy);
+    for (int x = -1; x <= 1; x++) {
+        for (int y = -1; y <= 1; y++) {
+            vec2 offset = vec2(x, y) * texelSize;
+            // sampler2DArrayShadow: texture() returns comparison result [0,1]
+            shadow += texture(texShadowMap, vec4(projCoords.xy + offset, float(cascade), biasedDepth));
+        }
+    }
+    shadow /= 9.0;
+
+    return shadow;
+}
+
+vec3 getNormal() {
+    vec3 N = normalize(fragWorldNormal);
+    vec3 T = normalize(fragWorldTangent);
+    vec3 B = normalize(fragWorldBitangent);
+    mat3 TBN = mat3(T, B, N);
+
+    // Sample normal map and decode from [0,1] to [-1,1]
+    uint normalIndex = pushConstants.textureIndices.x >> 16;
+    vec3 tangentNormal = sampleBindless(normalIndex, fragTexCoord).rgb * 2.0 - 1.0;
+
+    // Apply normal scale to the XY components
+    float normalScale = pushConstants.pbrFactors.z;
+    tangentNormal.xy *= normalScale;
+    tangentNormal = normalize(tangentNormal);
+
+    return normalize(TBN * tangentNormal);
+}
+
+void main() {
+    // Unpack bindless texture indices (must match Material::getBindlessIndices)
+    uint baseColorIndex = pushConstants.textureIndices.x & 0xFFFFu;
+    uint mrIndex        = pushConstants.textureIndices.y & 0xFFFFu;
+    uint occlusionIndex = pushConstants.textureIndices.y >> 16;
+    uint emissiveIndex  = pushConstants.textureIndices.z;
+
+    // Sample textures
+    vec4 texColor = sampleBindless(baseColorIndex, fragTexCoord);
+    vec3 baseColor = fragColor * pushConstants.baseColorFactor.rgb * texColor.rgb;
+    float alpha = pushConstants.baseColorFactor.a * texColor.a;
+
+    // Alpha mask cutoff (emissiveFactor.w carries the cutoff; 0 = disabled)
+    float alphaCutoff = pushConstants.emissiveFactor.w;
+    if (alphaCutoff > 0.0 && alpha < alphaCutoff) {
+        discard;
+    }
+
+    // PBR material factors from textures and push constants
+    float metallic = pushConstants.pbrFactors.x;
+    float roughness = pushConstants.pbrFactors.y;
+    float occlusionStrength = pushConstants.pbrFactors.w;
+
+    // Sample metallic-roughness texture (glTF convention: G=roughness, B=metallic)
+    vec4 mrSample = sampleBindless(mrIndex, fragTexCoord);
+    roughness *= mrSample.g;
+    metallic *= mrSample.b;
+
+    // Sample occlusion texture (R channel)
+    float occlusion = sampleBindless(occlusionIndex, fragTexCoord).r;
+
+    // Sample emissive texture
+    vec3 emissiveTexColor = sampleBindless(emissiveIndex, fragTexCoord).rgb;
+    vec3 emissive = pushConstants.emissiveFactor.rgb * emissiveTexColor;
+
+    // Get normal (with normal mapping)
+    vec3 normal = getNormal();
+
+    // --- Debug views (bypass lighting) ---
+    if (SPEC_DEBUG_MODE == 2u) {
+        outColor = vec4(normal * 0.5 + 0.5, 1.0);
+        return;
+    }
+
+    if (SPEC_DEBUG_MODE == 1u) {
+        // Unlit: raw linear color; swapchain sRGB encoding handles gamma
+        outColor = vec4(baseColor + emissive, alpha);
+        return;
+    }
+
+    // --- Lit shading: accumulate per-light Blinn-Phong with PBR modulation ---
+    vec3 viewDir = normalize(ubo.cameraPosition.xyz - fragWorldPosition);
+    vec3 specColor = pushConstants.specularColorAndShininess.rgb;
+    float shininess = max(pushConstants.specularColorAndShininess.a, 1.0);
+
+    // Metallic modulation: metallic surfaces use base color as specular, reduce diffuse
+    vec3 dielectricSpecular = specColor;
+    vec3 effectiveSpecColor = mix(dielectricSpecular, baseColor, metallic);
+    vec3 effectiveDiffuseColor = baseColor * (1.0 - metallic);
+
+    // Roughness affects shininess: rough surfaces have wider, dimmer highlights
+    float effectiveShininess = shininess * max(1.0 - roughness, 0.01);
+    effectiveShininess = max(effectiveShininess, 1.0);
+
+    // Start with ambient (modulated by occlusion)
+    vec3 ambient = ubo.ambientColor.rgb * effectiveDiffuseColor;
+    ambient = mix(ambient, ambient * occlusion, occlusionStrength);
+    vec3 lighting = ambient;
+
+    // Compute shadow factor once (applies to first directional light)
+    float shadowFactor = 1.0;
+    bool shadowApplied = false;
+
+    for (uint i = 0u; i < min(ubo.lightCount, SPEC_MAX_LIGHTS); i++) {
+        Light light = ubo.lights[i];
+        float lightType = light.positionAndType.w;
+
+        vec3 L;
+        float attenuation = 1.0;
+
+        if (lightType < 0.5) {
+            // --- Directional light ---
+            L = normalize(-light.directionAndRange.xyz);
+
+            // Apply shadow mapping to the first directional light
+            if (!shadowApplied) {
+                shadowFactor = calculateShadow(fragWorldPosition, normal, L);
+                shadowApplied = true;
+            }
+        } else {
+            // --- Point or Spot light ---
+            vec3 toLight = light.positionAndType.xyz - fragWorldPosition;
+            float dist = length(toLight);
+            L = toLight / max(dist, 0.0001);
+
+            // Smooth distance attenuation
+            float range = light.directionAndRange.w;
+            float ratio = clamp(dist / range, 0.0, 1.0);
+            attenuation = (1.0 - ratio) * (1.0 - ratio);
+
+            if (lightType > 1.5) {
+                // --- Spot light angular falloff ---
+                float cosTheta = dot(L, normalize(-light.directionAndRange.xyz));
+                float cosInner = light.spotParams.x;
+                float cosOuter = light.spotParams.y;
+                attenuation *= smoothstep(cosOuter, cosInner, cosTheta);
+            }
+        }
+
+        // Diffuse (Lambertian)
+        float NdotL = max(dot(normal, L), 0.0);
+        vec3 diffuse = effectiveDiffuseColor * NdotL;
+
+        // Specular (Blinn-Phong)
+        float spec = 0.0;
+        if (NdotL > 0.0) {
+            vec3 H = normalize(L + viewDir);
+            spec = pow(max(dot(normal, H), 0.0), effectiveShininess);
+        }
+        vec3 specular = effectiveSpecColor * spec;
+
+        // Apply shadow factor to directional light contributions
+        float lightShadow = (lightType < 0.5) ? shadowFactor : 1.0;
+
+        vec3 lightContrib = (diffuse + specular)
+                          * light.colorAndIntensity.rgb
+                          * light.colorAndIntensity.a
+                          * attenuation
+                          * lightShadow;
+        lighting += lightContrib;
+    }
+
+    // Add emissive (unaffected by lighting)
+    lighting += emissive;
+
+    outColor = vec4(tonemapACES(lighting), alpha);
+}
@@ -0,0 +1,100 @@
+#version 460
+
+// Indirect multi-draw variant of shader.vert: the per-draw push-constant
+// block is replaced by a storage buffer of DrawData records (set 0,
+// binding 1). Each vkCmdDrawIndexedIndirect covers a whole pipeline bucket;
+// the bucket's base offset arrives as a push constant and gl_DrawID
+// (#version 460 core, requires the shaderDrawParameters device feature)
+// selects the record within the bucket. The resolved index is forwarded to
+// the fragment stage as a flat varying since gl_DrawID is vertex-only.
+
+const uint MAX_LIGHTS = 8;
+
+struct Light {
+    vec4 positionAndType;
+    vec4 directionAndRange;
+    vec4 colorAndIntensity;
+    vec4 spotParams;
+};
+
+const uint CASCADE_COUNT = 4;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 view;
+    mat4 proj;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
+    vec4 cameraPosition;
+    vec4 ambientColor;
+    vec4 debugView;
+    vec4 cascadeSplits;
+    uint lightCount;
+    uint _pad0;
+    uint _pad1;
+    uint _pad2;
+    Light lights[MAX_LIGHTS];
+} ubo;
+
+// Must match GpuDrawData in Uniforms.hpp (144-byte std430 stride)
+struct DrawData {
+    mat4 modelMatrix;
+    vec4 baseColorFactor;
+    vec4 emissiveFactor;
+    vec4 specularColorAndShininess;
+    vec4 pbrFactors; // metallic(x), roughness(y), normalScale(z), occlusionStrength(w)
+    vec4 uvScaleOffset; // Texture atlas UV transform: uv * xy + zw
+    // Bindless texture indices, two 16-bit slots per component:
+    // x = baseColor | (normal << 16), y = metallicRoughness | (occlusion << 16),
+    // z = emissive, w reserved
+    uvec4 textureIndices;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer DrawDataBuffer {
+    DrawData draws[];
+} drawData;
+
+layout(push_constant) uniform IndirectPush {
+    uint firstDraw; // Index of the bucket's first record in the draw-data buffer
+} pc;
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inNormal;
+layout(location = 4) in vec4 inTangent;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragWorldPosition;
+layout(location = 2) out vec3 fragWorldNormal;
+layout(location = 3) out vec2 fragTexCoord;
+layout(location = 4) out vec3 fragWorldTangent;
+layout(location = 5) out vec3 fragWorldBitangent;
+layout(location = 6) flat out uint fragDrawIndex;
+
+void main() {
+    uint drawIndex = pc.firstDraw + uint(gl_DrawID);
+    mat4 modelMatrix = drawData.draws[drawIndex].modelMatrix;
+    fragDrawIndex = drawIndex;
+
+    vec4 worldPosition = modelMatrix * vec4(inPosition, 1.0);
+
+    // Normal matrix: for uniform scale + rotation, mat3(model) is sufficient.
+    mat3 normalMatrix = mat3(modelMatrix);
+
+    fragWorldPosition = worldPosition.xyz;
+    fragWorldNormal = normalize(normalMatrix * inNormal);
+    fragColor = inColor;
+    // Remap into the texture's atlas sub-region (identity when unatlased)
+    vec4 uvScaleOffset = drawData.draws[drawIndex].uvScaleOffset;
+    fragTexCoord = inTexCoord * uvScaleOffset.xy + uvScaleOffset.zw;
+
+    // Tangent and bitangent for normal mapping (TBN matrix)
+    vec3 T = normalize(normalMatrix * inTangent.xyz);
+    vec3 N = fragWorldNormal;
+    // Re-orthogonalize T with respect to N
+    T = normalize(T - dot(T, N) * N);
+    vec3 B = cross(N, T) * inTangent.w;
+    fragWorldTangent = T;
+    fragWorldBitangent = B;
+
+    gl_Position = ubo.proj * ubo.view * worldPosition;
+}
@@ -0,0 +1,85 @@
+#version 450
+
+// Instanced variant of shader.vert: the model matrix comes from a per-instance
+// vertex attribute stream (binding 1) instead of push constants, so one
+// drawIndexed call can render every node sharing a mesh/material pair.
+// Material factors still come from push constants (uniform across the batch).
+
+const uint MAX_LIGHTS = 8;
+
+struct Light {
+    vec4 positionAndType;
+    vec4 directionAndRange;
+    vec4 colorAndIntensity;
+    vec4 spotParams;
+};
+
+const uint CASCADE_COUNT = 4;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 view;
+    mat4 proj;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
+    vec4 cameraPosition;
+    vec4 ambientColor;
+    vec4 debugView;
+    vec4 cascadeSplits;
+    uint lightCount;
+    uint _pad0;
+    uint _pad1;
+    uint _pad2;
+    Light lights[MAX_LIGHTS];
+} ubo;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix; // Unused in the instanced path; kept for layout compatibility
+    vec4 baseColorFactor;
+    vec4 emissiveFactor;
+    vec4 specularColorAndShininess;
+    vec4 pbrFactors; // metallic(x), roughness(y), normalScale(z), occlusionStrength(w)
+    vec4 uvScaleOffset; // Texture atlas UV transform: uv * xy + zw
+} pushConstants;
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inNormal;
+layout(location = 4) in vec4 inTangent;
+
+// Per-instance model matrix, one vec4 column per attribute location
+layout(location = 5) in vec4 inModelCol0;
+layout(location = 6) in vec4 inModelCol1;
+layout(location = 7) in vec4 inModelCol2;
+layout(location = 8) in vec4 inModelCol3;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragWorldPosition;
+layout(location = 2) out vec3 fragWorldNormal;
+layout(location = 3) out vec2 fragTexCoord;
+layout(location = 4) out vec3 fragWorldTangent;
+layout(location = 5) out vec3 fragWorldBitangent;
+
+void main() {
+    mat4 modelMatrix = mat4(inModelCol0, inModelCol1, inModelCol2, inModelCol3);
+    vec4 worldPosition = modelMatrix * vec4(inPosition, 1.0);
+
+    // Normal matrix: for uniform scale + rotation, mat3(model) is sufficient.
+    mat3 normalMatrix = mat3(modelMatrix);
+
+    fragWorldPosition = worldPosition.xyz;
+    fragWorldNormal = normalize(normalMatrix * inNormal);
+    fragColor = inColor;
+    // Remap into the texture's atlas sub-region (identity when unatlased)
+    fragTexCoord = inTexCoord * pushConstants.uvScaleOffset.xy + pushConstants.uvScaleOffset.zw;
+
+    // Tangent and bitangent for normal mapping (TBN matrix)
+    vec3 T = normalize(normalMatrix * inTangent.xyz);
+    vec3 N = fragWorldNormal;
+    // Re-orthogonalize T with respect to N
+    T = normalize(T - dot(T, N) * N);
+    vec3 B = cross(N, T) * inTangent.w;
+    fragWorldTangent = T;
+    fragWorldBitangent = B;
+
+    gl_Position = ubo.proj * ubo.view * worldPosition;
+}
@@ -0,0 +1,40 @@
+#version 450
+#extension GL_EXT_multiview : require
+
+// Depth-only cascade pass, multiview variant: one render pass instance
+// writes every cascade layer and gl_ViewIndex selects the cascade's
+// light-space VP matrix from the global UBO. Unlike shadow.vert, the
+// push constant carries the plain model matrix — the same draw serves
+// all cascades, so nothing can be pre-multiplied on the CPU.
+
+const uint CASCADE_COUNT = 4;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+    mat4 view;
+    mat4 proj;
+    mat4 lightSpaceMatrices[CASCADE_COUNT];
+    vec4 cameraPosition;
+    vec4 ambientColor;
+    vec4 debugView;
+    vec4 cascadeSplits;
+} ubo;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix; // Plain model matrix (cascade VP applied per view)
+    vec4 baseColorFactor;
+    vec4 emissiveFactor;
+    vec4 specularColorAndShininess;
+    vec4 pbrFactors;
+    vec4 uvScaleOffset; // Unused here; keeps the block layout in sync
+} pushConstants;
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inNormal;
+layout(location = 4) in vec4 inTangent;
+
+void main() {
+    gl_Position = ubo.lightSpaceMatrices[gl_ViewIndex]
+                * pushConstants.modelMatrix * vec4(inPosition, 1.0);
+}
@@ -0,0 +1,23 @@
+#version 450
+
+// Minimal shading for the skinned path: camera headlight over the skinned
+// normal, modulated by vertex color. Material/shadow/clustered-light
+// integration stays with the classic pipeline for now.
+
+layout(location = 0) in vec3 inNormal;
+layout(location = 1) in vec3 inWorldPos;
+layout(location = 2) in vec3 inColor;
+
+layout(set = 0, binding = 0) uniform FrameUbo {
+    mat4 viewProj;
+    vec4 cameraPos;
+} ubo;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    vec3 normal = normalize(inNormal);
+    vec3 toCamera = normalize(ubo.cameraPos.xyz - inWorldPos);
+    float diffuse = 0.15 + 0.85 * max(dot(normal, toCamera), 0.0);
+    outColor = vec4(inColor * diffuse, 1.0);
+}
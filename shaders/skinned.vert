@@ -0,0 +1,47 @@
+#version 450
+
+// GPU skinning: blends four joint matrices from the shared palette SSBO
+// per vertex. Binding 0 carries the mesh's regular vertex stream, binding
+// 1 the SkinVertex joint/weight stream (locations 5-6).
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inNormal;
+layout(location = 4) in vec4 inTangent;
+layout(location = 5) in uvec4 inJoints;
+layout(location = 6) in vec4 inWeights;
+
+layout(set = 0, binding = 0) uniform FrameUbo {
+    mat4 viewProj;
+    vec4 cameraPos;
+} ubo;
+
+layout(set = 0, binding = 1, std430) readonly buffer Palette {
+    mat4 joints[];
+};
+
+layout(push_constant) uniform Push {
+    mat4 model;
+    uint paletteOffset; // First joint matrix of this instance's slice
+} pc;
+
+layout(location = 0) out vec3 outNormal;
+layout(location = 1) out vec3 outWorldPos;
+layout(location = 2) out vec3 outColor;
+
+void main() {
+    mat4 skin = inWeights.x * joints[pc.paletteOffset + inJoints.x]
+              + inWeights.y * joints[pc.paletteOffset + inJoints.y]
+              + inWeights.z * joints[pc.paletteOffset + inJoints.z]
+              + inWeights.w * joints[pc.paletteOffset + inJoints.w];
+
+    vec4 worldPos = pc.model * (skin * vec4(inPosition, 1.0));
+    gl_Position = ubo.viewProj * worldPos;
+
+    // Palette matrices are rigid per joint; the blend can shear slightly
+    // but normalizing after interpolation is the standard approximation
+    outNormal = normalize(mat3(pc.model) * (mat3(skin) * inNormal));
+    outWorldPos = worldPos.xyz;
+    outColor = inColor;
+}
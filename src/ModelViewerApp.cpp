@@ -4,6 +4,7 @@
 #include "vulkan-engine/components/MeshRenderer.hpp"
 #include "vulkan-engine/core/InputManager.hpp"
 #include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/rendering/BindlessTextures.hpp"
 #include "vulkan-engine/rendering/Uniforms.hpp"
 #include "vulkan-engine/resources/Material.hpp"
 #include "vulkan-engine/resources/Mesh.hpp"
@@ -18,6 +19,10 @@
 namespace vkeng {
 
 namespace {
+/// Scale-in time after an exhibit switch; long enough to read as a fade,
+/// short enough that rapid playlist stepping never queues animations
+constexpr float MODEL_FADE_SECONDS = 0.25f;
+
 std::filesystem::path getCompiledShaderOutputDir() {
 #ifdef VKENG_SHADER_OUTPUT_DIR
     return std::filesystem::path(VKENG_SHADER_OUTPUT_DIR);
@@ -116,16 +121,24 @@ const char* toString(MeshNormalSource source) {
 }
 
 void createUboSetLayout(VkDevice device, VkDescriptorSetLayout* descriptorSetLayout) {
-    VkDescriptorSetLayoutBinding uboLayoutBinding{};
-    uboLayoutBinding.binding = 0;
-    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    uboLayoutBinding.descriptorCount = 1;
-    uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    // Binding 0: global UBO. Binding 1: per-draw GpuDrawData storage buffer
+    // for the indirect multi-draw path — declared unconditionally (only
+    // statically-used bindings need valid descriptors) so the layout is the
+    // same whether or not indirect draws are enabled.
+    VkDescriptorSetLayoutBinding bindings[2]{};
+    bindings[0].binding = 0;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].descriptorCount = 1;
+    bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+    bindings[1].binding = 1;
+    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindings[1].descriptorCount = 1;
+    bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings = &uboLayoutBinding;
+    layoutInfo.bindingCount = 2;
+    layoutInfo.pBindings = bindings;
 
     if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, descriptorSetLayout) != VK_SUCCESS) {
         throw std::runtime_error("failed to create descriptor set layout!");
@@ -133,14 +146,16 @@ void createUboSetLayout(VkDevice device, VkDescriptorSetLayout* descriptorSetLay
 }
 
 void createDescriptorPool(VkDevice device, uint32_t frameCount, VkDescriptorPool* descriptorPool) {
-    VkDescriptorPoolSize poolSize{};
-    poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSize.descriptorCount = frameCount;
+    VkDescriptorPoolSize poolSizes[2]{};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    poolSizes[0].descriptorCount = frameCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[1].descriptorCount = frameCount;
 
     VkDescriptorPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    poolInfo.poolSizeCount = 1;
-    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.poolSizeCount = 2;
+    poolInfo.pPoolSizes = poolSizes;
     poolInfo.maxSets = frameCount;
 
     if (vkCreateDescriptorPool(device, &poolInfo, nullptr, descriptorPool) != VK_SUCCESS) {
@@ -149,7 +164,7 @@ void createDescriptorPool(VkDevice device, uint32_t frameCount, VkDescriptorPool
 }
 
 void createDescriptorSets(VkDevice device, uint32_t frameCount, VkDescriptorPool descriptorPool,
-                          VkDescriptorSetLayout descriptorSetLayout, const std::vector<std::shared_ptr<Buffer>>& uniformBuffers,
+                          VkDescriptorSetLayout descriptorSetLayout, const PerFrameUniformBuffer& globalUbo,
                           std::vector<VkDescriptorSet>& descriptorSets) {
     std::vector<VkDescriptorSetLayout> layouts(frameCount, descriptorSetLayout);
     VkDescriptorSetAllocateInfo allocInfo{};
@@ -164,10 +179,11 @@ void createDescriptorSets(VkDevice device, uint32_t frameCount, VkDescriptorPool
     }
 
     for (size_t i = 0; i < frameCount; i++) {
+        // Each frame's set binds its region of the single mapped buffer
         VkDescriptorBufferInfo bufferInfo{};
-        bufferInfo.buffer = uniformBuffers[i]->getHandle();
-        bufferInfo.offset = 0;
-        bufferInfo.range = sizeof(GlobalUbo);
+        bufferInfo.buffer = globalUbo.buffer->getHandle();
+        bufferInfo.offset = globalUbo.offset(static_cast<uint32_t>(i));
+        bufferInfo.range = globalUbo.elementSize;
 
         VkWriteDescriptorSet descriptorWrite{};
         descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -192,6 +208,9 @@ void ModelViewerApp::onInit() {
 }
 
 void ModelViewerApp::onShutdown() {
+    // Join the render thread before tearing anything down it may read
+    renderThread_.reset();
+
     vkDeviceWaitIdle(device_->getDevice());
 
     defaultMaterial_.reset();
@@ -229,36 +248,115 @@ void ModelViewerApp::initRenderingPipeline() {
     // 3. Create shadow map descriptor set layout (set 2)
     shadowSetLayout_ = DescriptorManager::get().createCombinedLayout({
         {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT},
-    });
+    }, device_->supportsPushDescriptors());
+
+    // Bindless texturing (opt-in): replace the per-material set 1 with the
+    // shared descriptor array; the fallback textures claim the reserved
+    // slots so untextured draws index them
+    bool bindless = config_.render.bindlessTextures && device_->supportsBindlessTextures();
+    if (config_.render.bindlessTextures && !bindless) {
+        LOG_WARN(RENDERING, "Bindless textures requested but not supported by the device; using per-material descriptor sets");
+    }
+    if (bindless) {
+        auto& bindlessManager = BindlessTextureManager::get();
+        bindlessManager.initialize(device_->getDevice());
+        bindlessManager.registerTexture(fallbackTexture_->getImageView(), fallbackTexture_->getSampler());       // BINDLESS_FALLBACK_WHITE
+        bindlessManager.registerTexture(fallbackNormalTexture_->getImageView(), fallbackNormalTexture_->getSampler()); // BINDLESS_FALLBACK_FLAT_NORMAL
+        bindlessManager.registerTexture(fallbackMRTexture_->getImageView(), fallbackMRTexture_->getSampler());   // BINDLESS_FALLBACK_METALLIC_ROUGHNESS
+    }
 
     // 4. Create UBO descriptor set layout (set 0) and PipelineManager (with shadow set layout)
     createUboSetLayout(device_->getDevice(), &descriptorSetLayout_);
-    pipelineManager_ = std::make_unique<PipelineManager>(device_->getDevice(), descriptorSetLayout_, textureSetLayout_->getHandle(), shadowSetLayout_->getHandle());
+    VkDescriptorSetLayout materialSetLayout = bindless
+        ? BindlessTextureManager::get().getLayout()
+        : textureSetLayout_->getHandle();
+    pipelineManager_ = std::make_unique<PipelineManager>(device_->getDevice(), device_->getPhysicalDevice(), descriptorSetLayout_, materialSetLayout, shadowSetLayout_->getHandle(), VK_NULL_HANDLE, bindless);
 
     // 4. Configure default pipeline
     defaultPipelineConfig_.vertShaderPath = resolveShaderPath(config_.render.vertexShaderPath, "vert.spv");
-    defaultPipelineConfig_.fragShaderPath = resolveShaderPath(config_.render.fragmentShaderPath, "frag.spv");
+    defaultPipelineConfig_.fragShaderPath = bindless
+        ? resolveShaderPath("", "frag_bindless.spv")
+        : resolveShaderPath(config_.render.fragmentShaderPath, "frag.spv");
     defaultPipelineConfig_.blendMode = BlendMode::Opaque;
     defaultPipelineConfig_.cullMode = CullMode::Back;
     defaultPipelineConfig_.depthWriteEnable = true;
     defaultPipelineConfig_.depthTestEnable = true;
 
     // 5. Create Uniform Buffers and Descriptors
-    uniformBuffers_.resize(Renderer::MAX_FRAMES_IN_FLIGHT);
-    for (size_t i = 0; i < Renderer::MAX_FRAMES_IN_FLIGHT; i++) {
-        auto bufferResult = memoryManager_->createUniformBuffer(sizeof(GlobalUbo));
-        if (!bufferResult) {
+    {
+        auto uboResult = memoryManager_->createPerFrameUniformBuffer(sizeof(GlobalUbo), Renderer::MAX_FRAMES_IN_FLIGHT);
+        if (!uboResult) {
             throw std::runtime_error("failed to create uniform buffer!");
         }
-        uniformBuffers_[i] = bufferResult.getValue();
+        globalUbo_ = uboResult.getValue();
     }
 
     createDescriptorPool(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, &descriptorPool_);
-    createDescriptorSets(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, descriptorPool_, descriptorSetLayout_, uniformBuffers_, descriptorSets_);
+    createDescriptorSets(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, descriptorPool_, descriptorSetLayout_, globalUbo_, descriptorSets_);
 
     // 6. Create Renderer
     renderer_ = std::make_unique<Renderer>(window_.get(), *device_, *swapChain_, renderPass_, *pipelineManager_, defaultPipelineConfig_);
 
+    // Optional render thread: onRender() builds the frame packet on the
+    // update thread and hands recording/submission to this thread, one
+    // frame deep. The sync callback drains it before swapchain recreation.
+    if (config_.render.renderThread) {
+        renderThread_ = std::make_unique<RenderThread>();
+        renderer_->setRecreateSyncCallback([this]() {
+            renderThread_->flush();
+        });
+    }
+
+    // Hitch reports include draw counts when the app wires them up
+    if (auto* watchdog = getHitchWatchdog()) {
+        watchdog->setDrawStatsProvider([this]() {
+            return HitchWatchdog::DrawStats{renderer_->getDrawnCount(),
+                                            renderer_->getCulledCount()};
+        });
+    }
+
+    // Telemetry snapshots likewise pick up renderer counters once wired
+    if (auto* telemetry = getTelemetryExporter()) {
+        telemetry->setDrawStatsProvider([this]() {
+            return TelemetryExporter::DrawStats{renderer_->getDrawnCount(),
+                                                renderer_->getCulledCount(),
+                                                renderer_->getInstancedBatchCount()};
+        });
+    }
+
+    if (config_.render.depthPrePass) {
+        // Same vertex shader as the shaded pass (depth must match exactly),
+        // trivial fragment shader, color writes masked by the renderer
+        PipelineConfig prePassConfig = defaultPipelineConfig_;
+        prePassConfig.fragShaderPath = resolveShaderPath("", "depth_prepass.spv");
+        renderer_->enableDepthPrePass(prePassConfig);
+    }
+
+    // Prewarm the pipeline variants materials can select (blend/cull/depth
+    // combinations) on a background thread; with a warm on-disk cache this
+    // turns first-use compilation stalls into cheap deserialization.
+    {
+        std::vector<PipelineConfig> prewarmConfigs;
+        for (BlendMode blend : {BlendMode::Opaque, BlendMode::AlphaMask, BlendMode::AlphaBlend}) {
+            for (CullMode cull : {CullMode::Back, CullMode::None}) {
+                PipelineConfig config = defaultPipelineConfig_;
+                config.blendMode = blend;
+                config.cullMode = cull;
+                if (blend == BlendMode::AlphaBlend) {
+                    config.depthWriteEnable = false;
+                }
+                prewarmConfigs.push_back(config);
+            }
+        }
+        pipelineManager_->prewarmAsync(std::move(prewarmConfigs), renderPass_->get(), swapChain_->extent());
+    }
+
+#ifdef VKENG_SHADER_SOURCE_DIR
+    // Developer builds know where the GLSL sources live: watch them and swap
+    // pipelines when a shader is edited, without restarting the app
+    pipelineManager_->enableHotReload(VKENG_SHADER_SOURCE_DIR, getCompiledShaderOutputDir());
+#endif
+
     // 7. Create fallback texture descriptor set (all 5 PBR slots)
     {
         auto setResult = materialDescriptorPool_->allocateDescriptorSet(textureSetLayout_);
@@ -274,16 +372,45 @@ void ModelViewerApp::initRenderingPipeline() {
         fallbackDescSet.update();
     }
     renderer_->setFallbackTextureDescriptorSet(fallbackTextureDescriptorSet_);
+    if (bindless) {
+        renderer_->setBindlessTextures(BindlessTextureManager::get().getSet());
+        if (config_.render.indirectDraws) {
+            PipelineConfig indirectConfig = defaultPipelineConfig_;
+            indirectConfig.vertShaderPath = resolveShaderPath("", "vert_indirect.spv");
+            indirectConfig.fragShaderPath = resolveShaderPath("", "frag_indirect.spv");
+            renderer_->enableIndirectDraws(memoryManager_, indirectConfig);
+        }
+    } else if (config_.render.indirectDraws) {
+        LOG_WARN(RENDERING, "Indirect draws require bindless textures; using the push-constant path");
+    }
+
+    if (config_.render.dynamicResolution) {
+        renderer_->enableDynamicResolution(memoryManager_, config_.render.minRenderScale);
+    }
 
     // 8. Set Callback
     renderer_->setRecreateCallback([this](uint32_t width, uint32_t height) {
         recreateResources(width, height);
     });
 
-    // 9. Shadow mapping setup
-    shadowPass_ = std::make_unique<ShadowPass>(device_->getDevice(), device_->getPhysicalDevice(), memoryManager_);
+    // Late-latch input: re-poll and apply the freshest mouse movement right
+    // before the renderer uploads the view matrix
+    if (config_.input.lateLatch) {
+        renderer_->setLateLatchCallback([this]() {
+            inputManager_->pollLatest();
+            if (orbitController_) orbitController_->lateLatch();
+        });
+    }
 
-    {
+    // 9. Shadow mapping setup. With multiview, one render pass instance
+    // writes every cascade layer and casters are recorded once.
+    shadowPass_ = std::make_unique<ShadowPass>(device_->getDevice(), device_->getPhysicalDevice(), memoryManager_,
+                                               device_->supportsMultiview());
+
+    if (shadowSetLayout_->isPushDescriptor()) {
+        // No set to allocate: the renderer pushes the shadow map per-draw
+        renderer_->enableShadowPushDescriptors();
+    } else {
         auto setResult = materialDescriptorPool_->allocateDescriptorSet(shadowSetLayout_);
         if (!setResult) throw std::runtime_error("Failed to allocate shadow descriptor set");
         shadowDescriptorSet_ = setResult.getValue();
@@ -291,9 +418,12 @@ void ModelViewerApp::initRenderingPipeline() {
         DescriptorSet shadowDescSet(device_->getDevice(), shadowDescriptorSet_, shadowSetLayout_);
         shadowDescSet.writeImage(0, shadowPass_->getDepthImage(), shadowPass_->getSampler(), VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL);
         shadowDescSet.update();
+        renderer_->setShadowDescriptorSet(shadowDescriptorSet_);
     }
 
-    shadowPipelineConfig_.vertShaderPath = resolveShaderPath("", "shadow_vert.spv");
+    shadowPipelineConfig_.vertShaderPath = shadowPass_->isMultiview()
+        ? resolveShaderPath("", "shadow_multiview_vert.spv")
+        : resolveShaderPath("", "shadow_vert.spv");
     shadowPipelineConfig_.fragShaderPath = resolveShaderPath("", "shadow_frag.spv");
     shadowPipelineConfig_.blendMode = BlendMode::Opaque;
     shadowPipelineConfig_.cullMode = CullMode::Front;
@@ -302,14 +432,17 @@ void ModelViewerApp::initRenderingPipeline() {
     shadowPipelineConfig_.depthOnly = true;
 
     renderer_->setShadowPass(shadowPass_.get());
-    renderer_->setShadowDescriptorSet(shadowDescriptorSet_);
     renderer_->setShadowPipelineConfig(shadowPipelineConfig_);
 }
 
 std::filesystem::path ModelViewerApp::resolveModelPath() const {
-    const std::filesystem::path configuredPath = config_.viewer.modelPath.empty()
+    return resolveModelFile(config_.viewer.modelPath);
+}
+
+std::filesystem::path ModelViewerApp::resolveModelFile(const std::string& configured) const {
+    const std::filesystem::path configuredPath = configured.empty()
         ? std::filesystem::path("cube.obj")
-        : std::filesystem::path(config_.viewer.modelPath);
+        : std::filesystem::path(configured);
 
     if (configuredPath.is_absolute()) {
         return configuredPath;
@@ -350,9 +483,9 @@ void ModelViewerApp::initScene() {
     loadModelMesh();
     referenceMesh_ = PrimitiveFactory::createUvSphere(memoryManager_, 1.0f, 24, 48);
 
-    rootNode_ = std::make_shared<SceneNode>("ModelViewerRoot");
-    modelNode_ = std::make_shared<SceneNode>(loadedModelPath_.stem().string());
-    referenceNode_ = std::make_shared<SceneNode>("SmoothReferenceSphere");
+    rootNode_ = SceneNode::create("ModelViewerRoot");
+    modelNode_ = SceneNode::create(loadedModelPath_.stem().string());
+    referenceNode_ = SceneNode::create("SmoothReferenceSphere");
     modelNode_->addComponent<MeshRenderer>(loadedMesh_, defaultMaterial_);
     referenceNode_->addComponent<MeshRenderer>(referenceMesh_, referenceMaterial_);
     rootNode_->addChild(modelNode_);
@@ -360,7 +493,7 @@ void ModelViewerApp::initScene() {
 
     // --- Lights ---
     // Directional sun (matches the old hardcoded values)
-    auto sunNode = std::make_shared<SceneNode>("Sun");
+    auto sunNode = SceneNode::create("Sun");
     sunNode->getTransform().setRotation(glm::vec3(glm::radians(-60.0f), glm::radians(-30.0f), 0.0f));
     auto sunLight = sunNode->addComponent<Light>();
     sunLight->setType(LightType::Directional);
@@ -371,6 +504,159 @@ void ModelViewerApp::initScene() {
     layoutComparisonScene();
     setDebugShadingMode(debugShadingMode_);
     logViewerControls();
+
+    // Playlist prefetch: async loads go through the ResourceManager worker
+    // pool (the engine loop pumps completions), so the next exhibit's mesh
+    // is warm in VRAM before anyone presses next
+    ResourceManager::get().registerLoader<Mesh>(std::make_unique<MeshLoader>(memoryManager_));
+    buildPlaylist();
+    insertCachedModel(loadedModelPath_.string(), loadedMesh_);
+    startNextPrefetch();
+}
+
+void ModelViewerApp::buildPlaylist() {
+    playlist_.clear();
+    playlist_.push_back(loadedModelPath_);
+    for (const std::string& entry : config_.viewer.playlist) {
+        std::filesystem::path resolved = resolveModelFile(entry);
+        if (resolved != loadedModelPath_) {
+            playlist_.push_back(std::move(resolved));
+        }
+    }
+    playlistIndex_ = 0;
+    if (playlist_.size() > 1) {
+        LOG_INFO(GENERAL, "Model playlist: {} exhibits, prefetch budget {} MB",
+                 playlist_.size(), config_.viewer.prefetchBudgetMb);
+    }
+}
+
+void ModelViewerApp::startNextPrefetch() {
+    if (playlist_.size() < 2 || pendingPrefetch_.isValid()) {
+        return;
+    }
+
+    const std::filesystem::path& next = playlist_[(playlistIndex_ + 1) % playlist_.size()];
+    const std::string key = next.string();
+    if (modelCache_.count(key)) {
+        return; // Already warm
+    }
+
+    pendingPrefetch_ = ResourceManager::get().loadResourceAsync<Mesh>(key);
+    pendingPrefetchPath_ = key;
+    LOG_INFO(GENERAL, "Prefetching next exhibit: {}", key);
+}
+
+void ModelViewerApp::pumpPrefetch() {
+    if (!pendingPrefetch_.isValid() || !ResourceManager::get().isReady(pendingPrefetch_)) {
+        return;
+    }
+
+    auto mesh = ResourceManager::get().getResource(pendingPrefetch_);
+    const std::string key = pendingPrefetchPath_;
+    pendingPrefetch_ = ResourceHandle<Mesh>{};
+    pendingPrefetchPath_.clear();
+
+    if (!mesh) {
+        LOG_WARN(GENERAL, "Prefetch failed for {}; it will load on demand instead", key);
+        switchPending_ = false;
+        return;
+    }
+
+    insertCachedModel(key, mesh);
+    if (switchPending_) {
+        // The user out-ran the prefetch: finish their switch now that the
+        // mesh has landed (still no synchronous stall)
+        switchPending_ = false;
+        adoptModel(std::filesystem::path(key), mesh);
+        startNextPrefetch();
+    }
+}
+
+void ModelViewerApp::switchToNextModel() {
+    if (playlist_.size() < 2) {
+        LOG_INFO(GENERAL, "No playlist configured; nothing to switch to");
+        return;
+    }
+    if (switchPending_) {
+        return; // Already waiting on the prefetch for this switch
+    }
+
+    playlistIndex_ = (playlistIndex_ + 1) % playlist_.size();
+    const std::string key = playlist_[playlistIndex_].string();
+
+    auto it = modelCache_.find(key);
+    if (it != modelCache_.end()) {
+        // Warm: the swap is this frame
+        adoptModel(playlist_[playlistIndex_], it->second.mesh);
+        startNextPrefetch();
+        return;
+    }
+
+    // Cold: the prefetch has not landed yet — swap the moment it does
+    // rather than blocking the frame loop on a disk load
+    switchPending_ = true;
+    if (!pendingPrefetch_.isValid() || pendingPrefetchPath_ != key) {
+        pendingPrefetch_ = ResourceManager::get().loadResourceAsync<Mesh>(key);
+        pendingPrefetchPath_ = key;
+    }
+    LOG_INFO(GENERAL, "Next exhibit {} still loading; switching when ready", key);
+}
+
+void ModelViewerApp::adoptModel(const std::filesystem::path& path, const std::shared_ptr<Mesh>& mesh) {
+    loadedModelPath_ = path;
+    loadedMesh_ = mesh;
+    if (modelNode_) {
+        if (auto meshRenderer = modelNode_->getComponent<MeshRenderer>()) {
+            meshRenderer->setMesh(loadedMesh_);
+        }
+    }
+    layoutComparisonScene();
+    modelFadeIn_ = 0.0f;
+
+    auto it = modelCache_.find(path.string());
+    if (it != modelCache_.end()) {
+        it->second.lastShownFrame = frameCount_;
+    }
+    LOG_INFO(GENERAL, "Switched exhibit to {}", path.string());
+}
+
+void ModelViewerApp::insertCachedModel(const std::string& key, const std::shared_ptr<Mesh>& mesh) {
+    auto it = modelCache_.find(key);
+    if (it != modelCache_.end()) {
+        return;
+    }
+    CachedModel entry;
+    entry.mesh = mesh;
+    entry.gpuBytes = mesh->getGpuBytes();
+    entry.lastShownFrame = frameCount_;
+    modelCacheBytes_ += entry.gpuBytes;
+    modelCache_.emplace(key, std::move(entry));
+    evictOverBudget();
+}
+
+void ModelViewerApp::evictOverBudget() {
+    const uint64_t budget = static_cast<uint64_t>(config_.viewer.prefetchBudgetMb) * 1024ull * 1024ull;
+    while (modelCacheBytes_ > budget) {
+        // Evict the least-recently-shown entry; the displayed model and the
+        // in-flight prefetch target are pinned
+        auto victim = modelCache_.end();
+        for (auto it = modelCache_.begin(); it != modelCache_.end(); ++it) {
+            if (it->second.mesh == loadedMesh_ || it->first == pendingPrefetchPath_) {
+                continue;
+            }
+            if (victim == modelCache_.end() ||
+                it->second.lastShownFrame < victim->second.lastShownFrame) {
+                victim = it;
+            }
+        }
+        if (victim == modelCache_.end()) {
+            break; // Everything left is pinned
+        }
+        LOG_INFO(GENERAL, "Evicting warm model {} ({} bytes) over prefetch budget",
+                 victim->first, victim->second.gpuBytes);
+        modelCacheBytes_ -= victim->second.gpuBytes;
+        modelCache_.erase(victim);
+    }
 }
 
 void ModelViewerApp::loadModelMesh() {
@@ -418,6 +704,7 @@ void ModelViewerApp::configureCameraForScene(const glm::vec3& sceneCenter, float
     camera_->lookAt(sceneCenter);
 
     orbitController_ = std::make_shared<OrbitCameraController>(*camera_, *inputManager_, sceneCenter);
+    orbitController_->setLateLatchEnabled(config_.input.lateLatch);
     orbitController_->setHomeView(sceneCenter, framedDistance, 45.0f, 20.0f);
     orbitController_->reset();
 
@@ -471,39 +758,41 @@ void ModelViewerApp::toggleGeneratedNormalMode() {
 }
 
 void ModelViewerApp::logViewerControls() const {
-    LOG_INFO(GENERAL, "Model viewer controls: 1=lit, 2=unlit, 3=normal debug, N=toggle generated smooth/flat normals, C=toggle frustum culling, R/F=reset camera, H=repeat controls");
+    LOG_INFO(GENERAL, "Model viewer controls: 1=lit, 2=unlit, 3=normal debug, N=toggle generated smooth/flat normals, M=next playlist model, C=toggle frustum culling, R/F=reset camera, H=repeat controls");
     LOG_INFO(GENERAL, "Reference sphere remains on the right side of the scene to compare smooth interpolation against the loaded mesh");
 }
 
 void ModelViewerApp::recreateResources(uint32_t width, uint32_t height) {
     LOG_INFO(GENERAL, "Recreating model viewer resources for size {}x{}", width, height);
 
-    // 1. Recreate RenderPass
-    renderPass_ = std::make_shared<RenderPass>(device_->getDevice(), swapChain_->imageFormat(), swapChain_->depthFormat());
-
-    // 2. Invalidate cached pipelines (render pass changed, but PipelineCache on disk survives)
-    pipelineManager_->invalidateAll();
+    // 1/2. Render pass and pipelines depend only on attachment formats,
+    // never the extent (viewport/scissor are dynamic) — a plain resize
+    // keeps both. Formats change only on display-mode switches, where a
+    // full rebuild is correct (PipelineCache on disk still survives).
+    if (renderPass_->getColorFormat() != swapChain_->imageFormat() ||
+        renderPass_->getDepthFormat() != swapChain_->depthFormat()) {
+        LOG_INFO(GENERAL, "Attachment formats changed; rebuilding render pass and pipelines");
+        renderPass_ = std::make_shared<RenderPass>(device_->getDevice(), swapChain_->imageFormat(), swapChain_->depthFormat());
+        pipelineManager_->invalidateAll();
+        renderer_->setRenderPass(renderPass_);
+    }
 
     // 3. Recreate Uniform Buffers and Descriptors
     if (descriptorPool_ != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(device_->getDevice(), descriptorPool_, nullptr);
     }
-    uniformBuffers_.clear();
+    globalUbo_ = {};
 
-    uniformBuffers_.resize(Renderer::MAX_FRAMES_IN_FLIGHT);
-    for (size_t i = 0; i < Renderer::MAX_FRAMES_IN_FLIGHT; i++) {
-        auto bufferResult = memoryManager_->createUniformBuffer(sizeof(GlobalUbo));
-        if (!bufferResult) {
+    {
+        auto uboResult = memoryManager_->createPerFrameUniformBuffer(sizeof(GlobalUbo), Renderer::MAX_FRAMES_IN_FLIGHT);
+        if (!uboResult) {
             throw std::runtime_error("failed to create uniform buffer!");
         }
-        uniformBuffers_[i] = bufferResult.getValue();
+        globalUbo_ = uboResult.getValue();
     }
 
     createDescriptorPool(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, &descriptorPool_);
-    createDescriptorSets(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, descriptorPool_, descriptorSetLayout_, uniformBuffers_, descriptorSets_);
-
-    // 4. Update Renderer
-    renderer_->setRenderPass(renderPass_);
+    createDescriptorSets(device_->getDevice(), Renderer::MAX_FRAMES_IN_FLIGHT, descriptorPool_, descriptorSetLayout_, globalUbo_, descriptorSets_);
 }
 
 void ModelViewerApp::onUpdate(float deltaTime) {
@@ -527,6 +816,20 @@ void ModelViewerApp::onUpdate(float deltaTime) {
         renderer_->setCullingEnabled(enabled);
         LOG_INFO(RENDERING, "Frustum culling {}", enabled ? "enabled" : "disabled");
     }
+    if (inputManager_->isKeyTriggered(GLFW_KEY_M)) {
+        switchToNextModel();
+    }
+
+    // Publish any finished background prefetch (and complete a switch that
+    // was waiting on it)
+    pumpPrefetch();
+
+    // Scale-in fade after a swap; layout sets the base scale to 1
+    if (modelFadeIn_ < 1.0f && modelNode_) {
+        modelFadeIn_ = std::min(modelFadeIn_ + deltaTime / MODEL_FADE_SECONDS, 1.0f);
+        const float eased = modelFadeIn_ * (2.0f - modelFadeIn_);
+        modelNode_->getTransform().setScale(std::max(eased, 0.01f));
+    }
 
     if (orbitController_) {
         orbitController_->update(deltaTime);
@@ -552,7 +855,20 @@ void ModelViewerApp::onUpdate(float deltaTime) {
 }
 
 void ModelViewerApp::onRender() {
-    renderer_->drawFrame(*rootNode_, *camera_, descriptorSets_, uniformBuffers_);
+    if (renderThread_) {
+        // Build on this (update) thread, record/submit on the render
+        // thread. submit() waits for the previous frame first, so the
+        // pipeline stays exactly one frame deep and next frame's update
+        // overlaps this frame's recording.
+        if (const auto* packet = renderer_->buildFramePacket(*rootNode_, *camera_,
+                                                             descriptorSets_, globalUbo_)) {
+            renderThread_->submit([this, packet]() {
+                renderer_->submitFramePacket(*packet);
+            });
+        }
+    } else {
+        renderer_->drawFrame(*rootNode_, *camera_, descriptorSets_, globalUbo_);
+    }
     frameCount_++;
 }
 
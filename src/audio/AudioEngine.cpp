@@ -1,8 +1,67 @@
 #include "vulkan-engine/audio/AudioEngine.hpp"
+#include "vulkan-engine/audio/AudioListener.hpp"
+#include "vulkan-engine/audio/AudioMixKernels.hpp"
+#include "vulkan-engine/audio/AudioStreamingClip.hpp"
+#include "vulkan-engine/audio/AudioSource.hpp"
+#include "vulkan-engine/components/ComponentPool.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
 #include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
 
 namespace vkeng {
 
+    AudioEngine* AudioEngine::s_active = nullptr;
+
+    namespace {
+        /**
+         * @brief One mix quantum — how long the mixer sleeps between passes.
+         *
+         * With a real backend this cadence comes from the device callback
+         * (e.g. 256 frames at 48 kHz ≈ 5.3 ms); the stub loop sleeps the
+         * equivalent so command latency matches what shipping would feel like.
+         */
+        constexpr auto kMixQuantum = std::chrono::milliseconds(5);
+
+        /**
+         * @brief Encoded size above which a clip streams instead of residing.
+         *
+         * 1 MiB encoded is seconds of audio — anything bigger is music or an
+         * ambient bed, exactly the content whose full decode costs hundreds
+         * of MB resident.
+         */
+        constexpr uintmax_t kStreamingThresholdBytes = 1024 * 1024;
+
+        /**
+         * @brief Decode thread refill cadence. One ring chunk is ~0.34 s of
+         * audio, so a 10 ms poll keeps rings full with huge margin.
+         */
+        constexpr auto kDecodeInterval = std::chrono::milliseconds(10);
+
+        /** @brief Ask the OS for real-time-ish priority on the mixer thread. */
+        void raiseMixerThreadPriority(std::thread& thread) {
+#if defined(__linux__) || defined(__APPLE__)
+            sched_param param{};
+            param.sched_priority = sched_get_priority_min(SCHED_FIFO) + 1;
+            if (pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param) != 0) {
+                // Needs CAP_SYS_NICE / elevated limits; fine to run at
+                // normal priority, dropouts just become possible under
+                // heavy system load instead of never
+                LOG_WARN(AUDIO, "Could not raise audio thread priority (continuing at normal priority)");
+            }
+#else
+            (void)thread;
+#endif
+        }
+    } // namespace
+
     AudioEngine::AudioEngine() = default;
 
     AudioEngine::~AudioEngine() {
@@ -13,14 +72,30 @@ namespace vkeng {
 
     bool AudioEngine::initialize() {
         // TODO: Initialize audio backend (miniaudio / OpenAL / SoLoud)
-        LOG_INFO(AUDIO, "AudioEngine initialized (backend: stub — no audio backend linked yet)");
+
+        m_running.store(true, std::memory_order_release);
+        m_mixerThread = std::thread([this]() { mixerLoop(); });
+        raiseMixerThreadPriority(m_mixerThread);
+        m_decodeThread = std::thread([this]() { decodeLoop(); });
+
+        s_active = this;
         m_initialized = true;
+        LOG_INFO(AUDIO, "AudioEngine initialized (backend: stub, mixer thread running)");
         return true;
     }
 
     void AudioEngine::shutdown() {
         if (!m_initialized) return;
 
+        m_running.store(false, std::memory_order_release);
+        if (m_mixerThread.joinable()) {
+            m_mixerThread.join();
+        }
+        if (m_decodeThread.joinable()) {
+            m_decodeThread.join();
+        }
+        s_active = nullptr;
+
         unloadAllClips();
         // TODO: Shut down audio backend
 
@@ -34,10 +109,32 @@ namespace vkeng {
             return INVALID_AUDIO_CLIP;
         }
 
-        // TODO: Decode audio file into backend buffer
+        // Encoded size picks the residency mode: short SFX decode in full,
+        // long tracks stream through a fixed-size chunk ring
+        std::error_code ec;
+        const uintmax_t fileBytes = std::filesystem::file_size(filepath, ec);
+        const bool streaming = !ec && fileBytes > kStreamingThresholdBytes;
+
+        ClipRecord record;
+        record.filepath = filepath;
+        record.streaming = streaming;
+        if (streaming) {
+            record.stream = std::make_shared<AudioStreamingClip>(filepath);
+            if (!record.stream->isOpen()) {
+                LOG_WARN(AUDIO, "Cannot load clip '{}' — failed to open '{}'", name, filepath);
+                return INVALID_AUDIO_CLIP;
+            }
+        }
+        // TODO: Decode resident clips into a backend buffer here
+
         AudioClipId id = m_nextClipId++;
         m_clipNames[name] = id;
-        LOG_INFO(AUDIO, "Loaded audio clip '{}' from '{}' (id={})", name, filepath, id);
+        {
+            std::lock_guard<std::mutex> lock(m_clipMutex);
+            m_clips[id] = std::move(record);
+        }
+        LOG_INFO(AUDIO, "Loaded audio clip '{}' from '{}' (id={}, {})", name, filepath, id,
+                 streaming ? "streaming" : "resident");
         return id;
     }
 
@@ -46,36 +143,293 @@ namespace vkeng {
         return (it != m_clipNames.end()) ? it->second : INVALID_AUDIO_CLIP;
     }
 
-    void AudioEngine::unloadClip(AudioClipId /*clipId*/) {
-        // TODO: Free backend buffer for this clip
+    void AudioEngine::unloadClip(AudioClipId clipId) {
+        std::lock_guard<std::mutex> lock(m_clipMutex);
+        auto it = m_clips.find(clipId);
+        if (it == m_clips.end()) return;
+
+        // Streaming rings free as soon as the decode thread drops its
+        // temporary reference — no waiting on in-flight decodes
+        if (it->second.stream) {
+            it->second.stream->markUnloaded();
+        }
+        // TODO: Free the resident backend buffer for this clip
+        m_clips.erase(it);
+        LOG_DEBUG(AUDIO, "Unloaded audio clip id={}", clipId);
     }
 
     void AudioEngine::unloadAllClips() {
-        // TODO: Free all backend buffers
+        {
+            std::lock_guard<std::mutex> lock(m_clipMutex);
+            for (auto& [id, record] : m_clips) {
+                if (record.stream) record.stream->markUnloaded();
+            }
+            m_clips.clear();
+        }
+        // TODO: Free all resident backend buffers
         m_clipNames.clear();
         LOG_DEBUG(AUDIO, "All audio clips unloaded");
     }
 
+    // ============================================================================
+    // Main Thread — Dirty Position Updates
+    // ============================================================================
+
     void AudioEngine::update(SceneNode* /*sceneRoot*/) {
+        PROFILE_SCOPE("AudioEngine::update");
         if (!m_initialized) return;
 
-        // TODO: Walk scene graph for AudioListener + AudioSource components
-        //       Update 3D positions in the backend
+        // Settle pending transform edits before sampling source positions
+        // (no-op when an earlier consumer already flushed this frame)
+        SceneNode::flushDirtyTransforms();
+
+        // Packed scan over the AudioSource pool; only positions that moved
+        // cross the queue, so a static scene costs a compare per source and
+        // nothing on the mixer side
+        ComponentPools::get().forEachComponent<AudioSource>([this](AudioSource& source) {
+            if (!source.isPlaying() || !source.isSpatial()) return;
+            SceneNode* owner = source.getOwner();
+            if (!owner || !owner->isActiveInHierarchy()) return;
+
+            glm::vec3 position = owner->getWorldPosition();
+            if (!source.updatePushedPosition(position)) return;
+
+            AudioCommand command{};
+            command.type = AudioCommandType::SetPosition;
+            command.sourceId = source.getSourceId();
+            command.position[0] = position.x;
+            command.position[1] = position.y;
+            command.position[2] = position.z;
+            enqueue(command);
+        });
+
+        // First active listener wins; push its pose only when it moved
+        ComponentPools::get().forEachComponent<AudioListener>([this](AudioListener& listener) {
+            if (m_listenerPushed) return;  // Already handled one this frame
+            if (!listener.isEnabled()) return;
+            SceneNode* owner = listener.getOwner();
+            if (!owner || !owner->isActiveInHierarchy()) return;
+
+            glm::vec3 position = owner->getWorldPosition();
+            glm::vec3 forward = glm::normalize(
+                owner->getWorldRotation() * glm::vec3(0.0f, 0.0f, -1.0f));
+            if (position == m_lastListenerPos && forward == m_lastListenerForward) {
+                m_listenerPushed = true;
+                return;
+            }
+            m_lastListenerPos = position;
+            m_lastListenerForward = forward;
+
+            AudioCommand command{};
+            command.type = AudioCommandType::SetListener;
+            command.position[0] = position.x;
+            command.position[1] = position.y;
+            command.position[2] = position.z;
+            command.forward[0] = forward.x;
+            command.forward[1] = forward.y;
+            command.forward[2] = forward.z;
+            enqueue(command);
+            m_listenerPushed = true;
+        });
+        m_listenerPushed = false;
+    }
+
+    bool AudioEngine::enqueue(const AudioCommand& command) {
+        if (!m_commands.push(command)) {
+            // Never block the frame loop on audio; a dropped command is a
+            // bug worth logging, not a hitch worth hearing
+            LOG_WARN(AUDIO, "Audio command queue full — dropped command type {}",
+                     static_cast<uint32_t>(command.type));
+            return false;
+        }
+        return true;
     }
 
     void AudioEngine::setMasterVolume(float volume) {
         m_masterVolume = (volume < 0.0f) ? 0.0f : (volume > 1.0f) ? 1.0f : volume;
-        // TODO: Apply to backend master gain
+
+        AudioCommand command{};
+        command.type = AudioCommandType::SetMasterVolume;
+        command.value = m_masterVolume;
+        enqueue(command);
     }
 
     void AudioEngine::pauseAll() {
-        // TODO: Pause all active voices in the backend
+        AudioCommand command{};
+        command.type = AudioCommandType::PauseAll;
+        enqueue(command);
         LOG_DEBUG(AUDIO, "All audio paused");
     }
 
     void AudioEngine::resumeAll() {
-        // TODO: Resume all paused voices
+        AudioCommand command{};
+        command.type = AudioCommandType::ResumeAll;
+        enqueue(command);
         LOG_DEBUG(AUDIO, "All audio resumed");
     }
 
+    // ============================================================================
+    // Mixer Thread
+    // ============================================================================
+
+    void AudioEngine::mixerLoop() {
+        AudioMixKernels::initialize();
+        LOG_INFO(AUDIO, "Mixer thread running ({} kernels)", AudioMixKernels::isaName());
+
+        while (m_running.load(std::memory_order_acquire)) {
+            // Drain everything the main thread queued since the last quantum
+            AudioCommand command;
+            while (m_commands.pop(command)) {
+                applyCommand(command);
+            }
+
+            computeVoiceGains();
+
+            // TODO: Mix active voices into the backend's output buffer here.
+            //       Per-ear gains for voice m_soaVoiceIds[i] are already in
+            //       m_gainL[i]/m_gainR[i]; once clips decode, each voice is
+            //       one AudioMixKernels::mixAddStereo(mixL, mixR, samples,
+            //       m_gainL[i] * m_mixerMasterVolume,
+            //       m_gainR[i] * m_mixerMasterVolume, frames) call —
+            //       resident clips supply samples directly, streaming clips
+            //       via currentChunk()/consumeChunk(). With a real backend
+            //       this loop blocks on the device writer instead of
+            //       sleeping.
+            std::this_thread::sleep_for(kMixQuantum);
+        }
+    }
+
+    void AudioEngine::computeVoiceGains() {
+        m_soaX.clear(); m_soaY.clear(); m_soaZ.clear();
+        m_soaGain.clear(); m_soaRef.clear(); m_soaMax.clear();
+        m_soaVoiceIds.clear();
+
+        for (const auto& [id, voice] : m_voices) {
+            if (!voice.playing || voice.paused) continue;
+            m_soaX.push_back(voice.position.x);
+            m_soaY.push_back(voice.position.y);
+            m_soaZ.push_back(voice.position.z);
+            m_soaGain.push_back(voice.volume);
+            m_soaRef.push_back(voice.refDistance);
+            m_soaMax.push_back(voice.maxDistance);
+            m_soaVoiceIds.push_back(id);
+        }
+
+        const size_t count = m_soaVoiceIds.size();
+        m_gainL.resize(count);
+        m_gainR.resize(count);
+        if (count == 0) return;
+
+        // Pan axis: the listener's right vector; degenerate forward
+        // (straight up/down) falls back to world right
+        glm::vec3 right = glm::cross(m_listenerForward, glm::vec3(0.0f, 1.0f, 0.0f));
+        float lengthSq = glm::dot(right, right);
+        right = (lengthSq > 1e-6f) ? right / std::sqrt(lengthSq)
+                                   : glm::vec3(1.0f, 0.0f, 0.0f);
+
+        const float listenerPos[3] = {m_listenerPos.x, m_listenerPos.y, m_listenerPos.z};
+        const float listenerRight[3] = {right.x, right.y, right.z};
+        AudioMixKernels::computeSpatialGains(
+            m_soaX.data(), m_soaY.data(), m_soaZ.data(),
+            m_soaGain.data(), m_soaRef.data(), m_soaMax.data(), count,
+            listenerPos, listenerRight, m_gainL.data(), m_gainR.data());
+    }
+
+    // ============================================================================
+    // Decode Thread
+    // ============================================================================
+
+    void AudioEngine::decodeLoop() {
+        std::vector<std::shared_ptr<AudioStreamingClip>> pending;
+
+        while (m_running.load(std::memory_order_acquire)) {
+            // Snapshot hungry streams under the lock, decode outside it so
+            // file I/O never stalls loadClip/unloadClip on the main thread
+            pending.clear();
+            {
+                std::lock_guard<std::mutex> lock(m_clipMutex);
+                for (auto& [id, record] : m_clips) {
+                    if (record.stream && record.stream->needsDecode()) {
+                        pending.push_back(record.stream);
+                    }
+                }
+            }
+
+            for (auto& stream : pending) {
+                // Fill the whole ring before moving on; unload can land
+                // mid-fill and cuts the work short
+                while (!stream->isUnloaded() && stream->decodeNextChunk()) {
+                }
+            }
+            pending.clear();    // Drop references before sleeping — unload reclaims now
+
+            std::this_thread::sleep_for(kDecodeInterval);
+        }
+    }
+
+    void AudioEngine::applyCommand(const AudioCommand& command) {
+        switch (command.type) {
+            case AudioCommandType::Play: {
+                Voice& voice = m_voices[command.sourceId];
+                voice.clipId = command.clipId;
+                voice.volume = command.value;
+                voice.refDistance = command.refDistance;
+                voice.maxDistance = command.maxDistance;
+                voice.playing = true;
+                voice.paused = false;
+                // TODO: Start the backend voice at the current playback position
+                break;
+            }
+            case AudioCommandType::Pause: {
+                auto it = m_voices.find(command.sourceId);
+                if (it != m_voices.end()) it->second.paused = true;
+                break;
+            }
+            case AudioCommandType::Stop: {
+                m_voices.erase(command.sourceId);
+                // TODO: Stop and recycle the backend voice
+                break;
+            }
+            case AudioCommandType::SetVolume: {
+                auto it = m_voices.find(command.sourceId);
+                if (it != m_voices.end()) it->second.volume = command.value;
+                break;
+            }
+            case AudioCommandType::SetPitch: {
+                auto it = m_voices.find(command.sourceId);
+                if (it != m_voices.end()) it->second.pitch = command.value;
+                break;
+            }
+            case AudioCommandType::SetLooping: {
+                auto it = m_voices.find(command.sourceId);
+                if (it != m_voices.end()) it->second.looping = (command.flag != 0);
+                break;
+            }
+            case AudioCommandType::SetPosition: {
+                auto it = m_voices.find(command.sourceId);
+                if (it != m_voices.end()) {
+                    it->second.position = glm::vec3(command.position[0],
+                                                    command.position[1],
+                                                    command.position[2]);
+                }
+                break;
+            }
+            case AudioCommandType::SetListener:
+                m_listenerPos = glm::vec3(command.position[0], command.position[1],
+                                          command.position[2]);
+                m_listenerForward = glm::vec3(command.forward[0], command.forward[1],
+                                              command.forward[2]);
+                break;
+            case AudioCommandType::SetMasterVolume:
+                m_mixerMasterVolume = command.value;
+                break;
+            case AudioCommandType::PauseAll:
+                for (auto& [id, voice] : m_voices) voice.paused = true;
+                break;
+            case AudioCommandType::ResumeAll:
+                for (auto& [id, voice] : m_voices) voice.paused = false;
+                break;
+        }
+    }
+
 } // namespace vkeng
@@ -0,0 +1,316 @@
+#include "vulkan-engine/audio/AudioMixKernels.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define VKENG_AUDIO_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang compile AVX intrinsics only in functions tagged for the
+// target; MSVC compiles them unconditionally and relies on our runtime
+// check to avoid executing them on older CPUs.
+#if defined(VKENG_AUDIO_X86) && (defined(__GNUC__) || defined(__clang__))
+#define VKENG_TARGET_AVX __attribute__((target("avx")))
+#define VKENG_TARGET_SSE __attribute__((target("sse2")))
+#else
+#define VKENG_TARGET_AVX
+#define VKENG_TARGET_SSE
+#endif
+
+namespace vkeng {
+
+    // ============================================================================
+    // Scalar Reference Kernels
+    // ============================================================================
+
+    namespace {
+
+        void mixAddScalar(float* dst, const float* src, float gain, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                dst[i] += src[i] * gain;
+            }
+        }
+
+        void mixAddStereoScalar(float* dstL, float* dstR, const float* src,
+                                float gainL, float gainR, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                dstL[i] += src[i] * gainL;
+                dstR[i] += src[i] * gainR;
+            }
+        }
+
+        /** @brief One source's attenuation + pan; shared by all tails. */
+        inline void spatialGainScalar(float px, float py, float pz,
+                                      float baseGain, float refDist, float maxDist,
+                                      const float listenerPos[3],
+                                      const float listenerRight[3],
+                                      float& outL, float& outR) {
+            float dx = px - listenerPos[0];
+            float dy = py - listenerPos[1];
+            float dz = pz - listenerPos[2];
+            float distSq = dx * dx + dy * dy + dz * dz;
+            float dist = std::sqrt(distSq);
+
+            // Inverse-distance clamped attenuation, silent beyond maxDist
+            float attenuation = refDist / std::max(dist, refDist);
+            if (dist > maxDist) attenuation = 0.0f;
+            float gain = baseGain * attenuation;
+
+            // Equal-power pan from the direction's projection onto the
+            // listener's right vector; centered when the source is on us
+            float invDist = (dist > 1e-6f) ? (1.0f / dist) : 0.0f;
+            float pan = (dx * listenerRight[0] + dy * listenerRight[1] +
+                         dz * listenerRight[2]) * invDist;
+            pan = std::clamp(pan, -1.0f, 1.0f);
+            outL = gain * std::sqrt((1.0f - pan) * 0.5f);
+            outR = gain * std::sqrt((1.0f + pan) * 0.5f);
+        }
+
+        void computeSpatialGainsScalar(const float* px, const float* py, const float* pz,
+                                       const float* baseGain, const float* refDist,
+                                       const float* maxDist, size_t count,
+                                       const float listenerPos[3],
+                                       const float listenerRight[3],
+                                       float* outL, float* outR) {
+            for (size_t i = 0; i < count; i++) {
+                spatialGainScalar(px[i], py[i], pz[i], baseGain[i], refDist[i], maxDist[i],
+                                  listenerPos, listenerRight, outL[i], outR[i]);
+            }
+        }
+
+#ifdef VKENG_AUDIO_X86
+
+        // ============================================================================
+        // SSE Kernels (4-wide)
+        // ============================================================================
+
+        VKENG_TARGET_SSE
+        void mixAddSse(float* dst, const float* src, float gain, size_t count) {
+            const __m128 vgain = _mm_set1_ps(gain);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 d = _mm_loadu_ps(dst + i);
+                __m128 s = _mm_loadu_ps(src + i);
+                d = _mm_add_ps(d, _mm_mul_ps(s, vgain));
+                _mm_storeu_ps(dst + i, d);
+            }
+            mixAddScalar(dst + i, src + i, gain, count - i);
+        }
+
+        VKENG_TARGET_SSE
+        void mixAddStereoSse(float* dstL, float* dstR, const float* src,
+                             float gainL, float gainR, size_t count) {
+            const __m128 vgl = _mm_set1_ps(gainL);
+            const __m128 vgr = _mm_set1_ps(gainR);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 s = _mm_loadu_ps(src + i);
+                _mm_storeu_ps(dstL + i, _mm_add_ps(_mm_loadu_ps(dstL + i), _mm_mul_ps(s, vgl)));
+                _mm_storeu_ps(dstR + i, _mm_add_ps(_mm_loadu_ps(dstR + i), _mm_mul_ps(s, vgr)));
+            }
+            mixAddStereoScalar(dstL + i, dstR + i, src + i, gainL, gainR, count - i);
+        }
+
+        VKENG_TARGET_SSE
+        void computeSpatialGainsSse(const float* px, const float* py, const float* pz,
+                                    const float* baseGain, const float* refDist,
+                                    const float* maxDist, size_t count,
+                                    const float listenerPos[3],
+                                    const float listenerRight[3],
+                                    float* outL, float* outR) {
+            const __m128 lx = _mm_set1_ps(listenerPos[0]);
+            const __m128 ly = _mm_set1_ps(listenerPos[1]);
+            const __m128 lz = _mm_set1_ps(listenerPos[2]);
+            const __m128 rx = _mm_set1_ps(listenerRight[0]);
+            const __m128 ry = _mm_set1_ps(listenerRight[1]);
+            const __m128 rz = _mm_set1_ps(listenerRight[2]);
+            const __m128 half = _mm_set1_ps(0.5f);
+            const __m128 one = _mm_set1_ps(1.0f);
+            const __m128 eps = _mm_set1_ps(1e-6f);
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 dx = _mm_sub_ps(_mm_loadu_ps(px + i), lx);
+                __m128 dy = _mm_sub_ps(_mm_loadu_ps(py + i), ly);
+                __m128 dz = _mm_sub_ps(_mm_loadu_ps(pz + i), lz);
+                __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx),
+                                _mm_add_ps(_mm_mul_ps(dy, dy), _mm_mul_ps(dz, dz)));
+                __m128 dist = _mm_sqrt_ps(distSq);
+
+                __m128 ref = _mm_loadu_ps(refDist + i);
+                __m128 att = _mm_div_ps(ref, _mm_max_ps(dist, ref));
+                __m128 audible = _mm_cmple_ps(dist, _mm_loadu_ps(maxDist + i));
+                att = _mm_and_ps(att, audible);
+                __m128 gain = _mm_mul_ps(_mm_loadu_ps(baseGain + i), att);
+
+                __m128 invDist = _mm_div_ps(one, _mm_max_ps(dist, eps));
+                __m128 pan = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(dx, rx),
+                              _mm_add_ps(_mm_mul_ps(dy, ry), _mm_mul_ps(dz, rz))), invDist);
+                pan = _mm_min_ps(_mm_max_ps(pan, _mm_sub_ps(_mm_setzero_ps(), one)), one);
+
+                __m128 gl = _mm_mul_ps(gain, _mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(one, pan), half)));
+                __m128 gr = _mm_mul_ps(gain, _mm_sqrt_ps(_mm_mul_ps(_mm_add_ps(one, pan), half)));
+                _mm_storeu_ps(outL + i, gl);
+                _mm_storeu_ps(outR + i, gr);
+            }
+            computeSpatialGainsScalar(px + i, py + i, pz + i, baseGain + i, refDist + i,
+                                      maxDist + i, count - i, listenerPos, listenerRight,
+                                      outL + i, outR + i);
+        }
+
+        // ============================================================================
+        // AVX Kernels (8-wide)
+        // ============================================================================
+
+        VKENG_TARGET_AVX
+        void mixAddAvx(float* dst, const float* src, float gain, size_t count) {
+            const __m256 vgain = _mm256_set1_ps(gain);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 d = _mm256_loadu_ps(dst + i);
+                __m256 s = _mm256_loadu_ps(src + i);
+                d = _mm256_add_ps(d, _mm256_mul_ps(s, vgain));
+                _mm256_storeu_ps(dst + i, d);
+            }
+            mixAddScalar(dst + i, src + i, gain, count - i);
+        }
+
+        VKENG_TARGET_AVX
+        void mixAddStereoAvx(float* dstL, float* dstR, const float* src,
+                             float gainL, float gainR, size_t count) {
+            const __m256 vgl = _mm256_set1_ps(gainL);
+            const __m256 vgr = _mm256_set1_ps(gainR);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 s = _mm256_loadu_ps(src + i);
+                _mm256_storeu_ps(dstL + i,
+                    _mm256_add_ps(_mm256_loadu_ps(dstL + i), _mm256_mul_ps(s, vgl)));
+                _mm256_storeu_ps(dstR + i,
+                    _mm256_add_ps(_mm256_loadu_ps(dstR + i), _mm256_mul_ps(s, vgr)));
+            }
+            mixAddStereoScalar(dstL + i, dstR + i, src + i, gainL, gainR, count - i);
+        }
+
+        VKENG_TARGET_AVX
+        void computeSpatialGainsAvx(const float* px, const float* py, const float* pz,
+                                    const float* baseGain, const float* refDist,
+                                    const float* maxDist, size_t count,
+                                    const float listenerPos[3],
+                                    const float listenerRight[3],
+                                    float* outL, float* outR) {
+            const __m256 lx = _mm256_set1_ps(listenerPos[0]);
+            const __m256 ly = _mm256_set1_ps(listenerPos[1]);
+            const __m256 lz = _mm256_set1_ps(listenerPos[2]);
+            const __m256 rx = _mm256_set1_ps(listenerRight[0]);
+            const __m256 ry = _mm256_set1_ps(listenerRight[1]);
+            const __m256 rz = _mm256_set1_ps(listenerRight[2]);
+            const __m256 half = _mm256_set1_ps(0.5f);
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 negOne = _mm256_set1_ps(-1.0f);
+            const __m256 eps = _mm256_set1_ps(1e-6f);
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(px + i), lx);
+                __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(py + i), ly);
+                __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(pz + i), lz);
+                __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx),
+                                _mm256_add_ps(_mm256_mul_ps(dy, dy), _mm256_mul_ps(dz, dz)));
+                __m256 dist = _mm256_sqrt_ps(distSq);
+
+                __m256 ref = _mm256_loadu_ps(refDist + i);
+                __m256 att = _mm256_div_ps(ref, _mm256_max_ps(dist, ref));
+                __m256 audible = _mm256_cmp_ps(dist, _mm256_loadu_ps(maxDist + i), _CMP_LE_OQ);
+                att = _mm256_and_ps(att, audible);
+                __m256 gain = _mm256_mul_ps(_mm256_loadu_ps(baseGain + i), att);
+
+                __m256 invDist = _mm256_div_ps(one, _mm256_max_ps(dist, eps));
+                __m256 pan = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(dx, rx),
+                              _mm256_add_ps(_mm256_mul_ps(dy, ry), _mm256_mul_ps(dz, rz))), invDist);
+                pan = _mm256_min_ps(_mm256_max_ps(pan, negOne), one);
+
+                __m256 gl = _mm256_mul_ps(gain,
+                    _mm256_sqrt_ps(_mm256_mul_ps(_mm256_sub_ps(one, pan), half)));
+                __m256 gr = _mm256_mul_ps(gain,
+                    _mm256_sqrt_ps(_mm256_mul_ps(_mm256_add_ps(one, pan), half)));
+                _mm256_storeu_ps(outL + i, gl);
+                _mm256_storeu_ps(outR + i, gr);
+            }
+            computeSpatialGainsScalar(px + i, py + i, pz + i, baseGain + i, refDist + i,
+                                      maxDist + i, count - i, listenerPos, listenerRight,
+                                      outL + i, outR + i);
+        }
+
+        /** @brief Runtime CPU feature checks (one call each at startup). */
+        bool cpuSupportsAvx() {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_cpu_supports("avx");
+#elif defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx) return false;
+            // XGETBV: OS must preserve YMM state across context switches
+            unsigned long long xcr0 = _xgetbv(0);
+            return (xcr0 & 0x6) == 0x6;
+#else
+            return false;
+#endif
+        }
+
+        bool cpuSupportsSse2() {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_cpu_supports("sse2");
+#elif defined(_MSC_VER)
+            return true;  // x64 baseline
+#else
+            return false;
+#endif
+        }
+
+#endif // VKENG_AUDIO_X86
+
+    } // namespace
+
+    // ============================================================================
+    // Dispatch
+    // ============================================================================
+
+    AudioMixKernels::MixAddFn AudioMixKernels::s_mixAdd = mixAddScalar;
+    AudioMixKernels::MixAddStereoFn AudioMixKernels::s_mixAddStereo = mixAddStereoScalar;
+    AudioMixKernels::SpatialGainsFn AudioMixKernels::s_computeSpatialGains = computeSpatialGainsScalar;
+    const char* AudioMixKernels::s_isaName = "scalar";
+
+    void AudioMixKernels::initialize() {
+        static bool bound = false;
+        if (bound) return;
+        bound = true;
+
+#ifdef VKENG_AUDIO_X86
+        if (cpuSupportsAvx()) {
+            s_mixAdd = mixAddAvx;
+            s_mixAddStereo = mixAddStereoAvx;
+            s_computeSpatialGains = computeSpatialGainsAvx;
+            s_isaName = "AVX";
+        } else if (cpuSupportsSse2()) {
+            s_mixAdd = mixAddSse;
+            s_mixAddStereo = mixAddStereoSse;
+            s_computeSpatialGains = computeSpatialGainsSse;
+            s_isaName = "SSE";
+        }
+#endif
+        LOG_INFO(AUDIO, "Audio mix kernels bound: {}", s_isaName);
+    }
+
+    const char* AudioMixKernels::isaName() {
+        return s_isaName;
+    }
+
+} // namespace vkeng
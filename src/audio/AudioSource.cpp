@@ -6,6 +6,12 @@ namespace vkeng {
     void AudioSource::initialize(SceneNode* owner) {
         Component::initialize(owner);
 
+        // Claim a mixer voice ID so every command this source emits
+        // addresses the same slot in the mixer thread's voice table
+        if (auto* engine = AudioEngine::active()) {
+            m_sourceId = engine->acquireSourceId();
+        }
+
         if (m_playOnAwake && m_clipId != INVALID_AUDIO_CLIP) {
             play();
         }
@@ -16,18 +22,63 @@ namespace vkeng {
             LOG_WARN(AUDIO, "AudioSource::play() called with no clip assigned");
             return;
         }
-        // TODO: Tell the AudioEngine backend to start playing this clip
         m_playing = true;
+
+        auto* engine = AudioEngine::active();
+        if (!engine || m_sourceId == 0) return;
+
+        AudioCommand command{};
+        command.type = AudioCommandType::Play;
+        command.sourceId = m_sourceId;
+        command.clipId = m_clipId;
+        command.value = m_volume;
+        command.refDistance = m_referenceDistance;
+        command.maxDistance = m_maxDistance;
+        engine->enqueue(command);
+
+        // Seed the voice's remaining parameters; position follows from the
+        // next AudioEngine::update() dirty push
+        pushCommand(AudioCommandType::SetPitch, m_pitch);
+        pushCommand(AudioCommandType::SetLooping, 0.0f, m_loop ? 1u : 0u);
+        m_hasPushedPosition = false;
     }
 
     void AudioSource::pause() {
-        // TODO: Pause in backend
         m_playing = false;
+        pushCommand(AudioCommandType::Pause, 0.0f);
     }
 
     void AudioSource::stop() {
-        // TODO: Stop in backend, reset playback position
         m_playing = false;
+        m_hasPushedPosition = false;
+        pushCommand(AudioCommandType::Stop, 0.0f);
+    }
+
+    void AudioSource::setVolume(float v) {
+        m_volume = v;
+        pushCommand(AudioCommandType::SetVolume, v);
+    }
+
+    void AudioSource::setPitch(float p) {
+        m_pitch = p;
+        pushCommand(AudioCommandType::SetPitch, p);
+    }
+
+    void AudioSource::setLooping(bool loop) {
+        m_loop = loop;
+        pushCommand(AudioCommandType::SetLooping, 0.0f, loop ? 1u : 0u);
+    }
+
+    void AudioSource::pushCommand(AudioCommandType type, float value, uint32_t flag) const {
+        auto* engine = AudioEngine::active();
+        if (!engine || m_sourceId == 0) return;
+
+        AudioCommand command{};
+        command.type = type;
+        command.sourceId = m_sourceId;
+        command.value = value;
+        command.flag = flag;
+        engine->enqueue(command);
     }
 
 } // namespace vkeng
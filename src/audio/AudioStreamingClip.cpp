@@ -0,0 +1,72 @@
+#include "vulkan-engine/audio/AudioStreamingClip.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+namespace vkeng {
+
+    AudioStreamingClip::AudioStreamingClip(const std::string& filepath)
+        : m_file(filepath, std::ios::binary) {
+        if (!m_file.is_open()) {
+            LOG_WARN(AUDIO, "Failed to open streaming clip '{}'", filepath);
+        }
+    }
+
+    bool AudioStreamingClip::needsDecode() const {
+        if (m_endOfFile || isUnloaded()) return false;
+        const uint64_t produced = m_produced.load(std::memory_order_relaxed);
+        const uint64_t consumed = m_consumed.load(std::memory_order_acquire);
+        return produced - consumed < RING_CHUNKS;
+    }
+
+    bool AudioStreamingClip::decodeNextChunk() {
+        if (!needsDecode()) return false;
+
+        const uint64_t produced = m_produced.load(std::memory_order_relaxed);
+        Chunk& chunk = m_ring[produced % RING_CHUNKS];
+        chunk.samples.resize(CHUNK_FRAMES);
+
+        // TODO: Real codec decode (WAV/OGG/MP3) once a backend lands. The
+        //       stub reads raw file bytes as float samples so the ring,
+        //       decode-ahead, and unload machinery are exercised end to end.
+        m_file.read(reinterpret_cast<char*>(chunk.samples.data()),
+                    static_cast<std::streamsize>(CHUNK_FRAMES * sizeof(float)));
+        const size_t bytesRead = static_cast<size_t>(m_file.gcount());
+        chunk.frames = bytesRead / sizeof(float);
+
+        if (chunk.frames == 0) {
+            m_endOfFile = true;
+            return false;
+        }
+        if (m_file.eof()) {
+            // TODO: Looping streams seek back to the data start here
+            m_endOfFile = true;
+        }
+
+        m_produced.store(produced + 1, std::memory_order_release);
+        return true;
+    }
+
+    const float* AudioStreamingClip::currentChunk(size_t& frameCount) const {
+        const uint64_t consumed = m_consumed.load(std::memory_order_relaxed);
+        const uint64_t produced = m_produced.load(std::memory_order_acquire);
+        if (consumed == produced) {
+            frameCount = 0;
+            return nullptr;    // Decode thread is behind — mixer outputs silence
+        }
+        const Chunk& chunk = m_ring[consumed % RING_CHUNKS];
+        frameCount = chunk.frames;
+        return chunk.samples.data();
+    }
+
+    void AudioStreamingClip::consumeChunk() {
+        const uint64_t consumed = m_consumed.load(std::memory_order_relaxed);
+        if (consumed == m_produced.load(std::memory_order_acquire)) return;
+        m_consumed.store(consumed + 1, std::memory_order_release);
+    }
+
+    bool AudioStreamingClip::isExhausted() const {
+        return m_endOfFile &&
+               m_consumed.load(std::memory_order_acquire) ==
+                   m_produced.load(std::memory_order_acquire);
+    }
+
+} // namespace vkeng
@@ -0,0 +1,94 @@
+#include "vulkan-engine/examples/BenchmarkApp.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Config.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --nodes N       Mesh nodes to scatter (default 2000)\n"
+              << "  --density N     Primitive tessellation multiplier (default 1)\n"
+              << "  --lights N      Point/spot lights (default 8)\n"
+              << "  --materials N   Distinct materials (default 16)\n"
+              << "  --frames N      Frames to render (default 1000)\n"
+              << "  --seed N        Scene placement seed (default 1337)\n"
+              << "  --width N       Framebuffer width (default 1920)\n"
+              << "  --height N      Framebuffer height (default 1080)\n"
+              << "  --csv PATH      Write per-frame subsystem times as CSV\n"
+              << "  --json PATH     Write summary stats as JSON\n"
+              << "  --windowed      Render to a window instead of headless\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    vkeng::Logger::getInstance().setLogLevel(vkeng::LogLevel::INFO);
+
+    vkeng::Config config;
+    config.window.title = "Vulkan Engine - Benchmark";
+    config.window.width = 1920;
+    config.window.height = 1080;
+    config.window.resizable = false;
+    config.headless.enabled = true;
+
+    vkeng::BenchmarkOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        auto nextValue = [&](const char* flag) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << flag << "\n";
+                std::exit(EXIT_FAILURE);
+            }
+            return argv[++i];
+        };
+
+        if (std::strcmp(argv[i], "--nodes") == 0) {
+            options.nodeCount = static_cast<uint32_t>(std::stoul(nextValue("--nodes")));
+        } else if (std::strcmp(argv[i], "--density") == 0) {
+            options.meshDensity = static_cast<uint32_t>(std::stoul(nextValue("--density")));
+        } else if (std::strcmp(argv[i], "--lights") == 0) {
+            options.lightCount = static_cast<uint32_t>(std::stoul(nextValue("--lights")));
+        } else if (std::strcmp(argv[i], "--materials") == 0) {
+            options.materialCount = static_cast<uint32_t>(std::stoul(nextValue("--materials")));
+        } else if (std::strcmp(argv[i], "--frames") == 0) {
+            options.frameCount = static_cast<uint32_t>(std::stoul(nextValue("--frames")));
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::stoul(nextValue("--seed")));
+        } else if (std::strcmp(argv[i], "--width") == 0) {
+            config.window.width = static_cast<uint32_t>(std::stoul(nextValue("--width")));
+        } else if (std::strcmp(argv[i], "--height") == 0) {
+            config.window.height = static_cast<uint32_t>(std::stoul(nextValue("--height")));
+        } else if (std::strcmp(argv[i], "--csv") == 0) {
+            options.csvPath = nextValue("--csv");
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            options.jsonPath = nextValue("--json");
+        } else if (std::strcmp(argv[i], "--windowed") == 0) {
+            config.headless.enabled = false;
+        } else if (std::strcmp(argv[i], "--help") == 0) {
+            printUsage(argv[0]);
+            return EXIT_SUCCESS;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // The engine's headless loop stops the run after the requested frames;
+    // windowed runs close via the window and report whatever was rendered
+    config.headless.frameCount = options.frameCount;
+
+    try {
+        vkeng::BenchmarkApp app(config, options);
+        app.run();
+    } catch (const std::exception& e) {
+        LOG_CRITICAL(GENERAL, "Fatal error: {}", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -7,6 +7,8 @@
 
 namespace vkeng {
 
+std::atomic<uint64_t> Light::s_revision{0};
+
 Light::Light()
     : m_type(LightType::Directional),
       m_color(1.0f, 1.0f, 1.0f),
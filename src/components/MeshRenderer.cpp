@@ -8,6 +8,7 @@
  */
 
 #include "vulkan-engine/components/MeshRenderer.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
 
 namespace vkeng {
 
@@ -27,4 +28,93 @@ namespace vkeng {
 MeshRenderer::MeshRenderer(std::shared_ptr<Mesh> mesh, std::shared_ptr<Material> material)
 	: m_mesh(std::move(mesh)), m_material(std::move(material)) {}
 
+// ============================================================================
+// Mesh / Material Swaps
+// ============================================================================
+
+/**
+ * @brief Swaps the rendered mesh and invalidates retained draw lists
+ *
+ * Mesh swaps change what a cached draw call would bind, so the scene
+ * structure version is bumped; the renderer rebuilds its retained list on
+ * the next frame.
+ */
+void MeshRenderer::setMesh(std::shared_ptr<Mesh> mesh) {
+	m_mesh = std::move(mesh);
+	m_currentLod = 0; // New mesh, new LOD chain; restart selection
+	SceneNode::bumpStructureVersion();
+}
+
+/**
+ * @brief Swaps the material and invalidates retained draw lists
+ */
+void MeshRenderer::setMaterial(std::shared_ptr<Material> material) {
+	m_material = std::move(material);
+	SceneNode::bumpStructureVersion();
+}
+
+// ============================================================================
+// LOD Selection
+// ============================================================================
+
+namespace {
+	/// Projected size (bounding radius / distance) below which each coarser
+	/// level kicks in; level N switches at kLodBaseSize / 2^N
+	constexpr float kLodBaseSize = 0.25f;
+
+	/// Margin the projected size must cross beyond a threshold before the
+	/// level actually changes, so hovering at a boundary never flickers
+	constexpr float kLodHysteresis = 1.15f;
+
+	float lodSwitchSize(uint32_t level) {
+		return kLodBaseSize * MeshRenderer::getLodBias() / static_cast<float>(1u << level);
+	}
+}
+
+float MeshRenderer::s_lodBias = 1.0f;
+
+/**
+ * @brief Picks the LOD level for this frame with hysteresis
+ *
+ * The desired level is the deepest one whose switch size still exceeds the
+ * projected size. The current level then steps at most one level toward it,
+ * and only when the projected size clears the boundary by the hysteresis
+ * margin — a mesh sitting exactly on a threshold keeps its level.
+ */
+const std::shared_ptr<Mesh>& MeshRenderer::selectLod(float distanceToCamera) {
+	if (!m_mesh || m_mesh->getLodCount() == 0) {
+		m_currentLod = 0;
+		return m_mesh;
+	}
+
+	const uint32_t maxLevel = static_cast<uint32_t>(m_mesh->getLodCount());
+	const float radius = m_mesh->getBoundingRadius();
+	const float projectedSize = (distanceToCamera > 1e-3f)
+		? radius / distanceToCamera
+		: kLodBaseSize * 2.0f; // Camera inside the mesh: full detail
+
+	uint32_t desired = 0;
+	while (desired < maxLevel && projectedSize < lodSwitchSize(desired)) {
+		desired++;
+	}
+
+	if (m_currentLod > maxLevel) {
+		m_currentLod = maxLevel; // Chain shrank since last selection
+	}
+
+	if (desired > m_currentLod) {
+		// Going coarser: require clearing the boundary by the margin
+		if (projectedSize * kLodHysteresis < lodSwitchSize(m_currentLod)) {
+			m_currentLod++;
+		}
+	} else if (desired < m_currentLod) {
+		// Going finer: same margin in the other direction
+		if (projectedSize > lodSwitchSize(m_currentLod - 1) * kLodHysteresis) {
+			m_currentLod--;
+		}
+	}
+
+	return (m_currentLod == 0) ? m_mesh : m_mesh->getLod(m_currentLod - 1);
+}
+
 } // namespace vkeng
\ No newline at end of file
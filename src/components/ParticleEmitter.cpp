@@ -0,0 +1,23 @@
+/**
+ * @file ParticleEmitter.cpp
+ * @brief Implementation of the ParticleEmitter component
+ */
+
+#include "vulkan-engine/components/ParticleEmitter.hpp"
+
+namespace vkeng {
+
+ParticleEmitter::ParticleEmitter()
+    : m_maxParticles(1024),
+      m_spawnRate(256.0f),
+      m_lifetimeMin(1.5f),
+      m_lifetimeMax(3.0f),
+      m_initialVelocity(0.0f, 3.0f, 0.0f),
+      m_velocityVariance(1.0f, 0.5f, 1.0f),
+      m_gravity(0.0f, -9.81f, 0.0f),
+      m_startColor(1.0f, 0.85f, 0.3f, 1.0f),
+      m_endColor(1.0f, 0.2f, 0.05f, 0.0f),
+      m_startSize(0.15f),
+      m_endSize(0.02f) {}
+
+} // namespace vkeng
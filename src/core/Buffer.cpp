@@ -1,4 +1,5 @@
 #include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/core/DeletionQueue.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 #include <stdexcept>
 #include <cstring>  // For memcpy
@@ -63,6 +64,12 @@ namespace vkeng {
                 return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
             case BufferUsage::TransferDst:
                 return VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            case BufferUsage::StorageVertex:
+                return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                       VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            case BufferUsage::Indirect:
+                return VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                       VK_BUFFER_USAGE_TRANSFER_DST_BIT;
             default:
                 return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
         }
@@ -141,11 +148,20 @@ namespace vkeng {
         auto bufferObj = std::shared_ptr<Buffer>(new Buffer(device, allocator, buffer, 
                                                             allocation, createInfo.size, 
                                                             createInfo.hostVisible));
+        bufferObj->m_usageFlags = usageFlags;
         
         // If the buffer was created with the mapped flag, VMA provides the pointer.
         if (createInfo.hostVisible && allocationInfo.pMappedData) {
             bufferObj->m_mappedData = allocationInfo.pMappedData;
         }
+
+        // Host-coherent memory needs no flushes after CPU writes; remember
+        // this so the per-frame write path can skip them entirely
+        if (createInfo.hostVisible) {
+            VkMemoryPropertyFlags memFlags = 0;
+            vmaGetAllocationMemoryProperties(allocator, allocation, &memFlags);
+            bufferObj->m_coherent = (memFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        }
         
         if (!createInfo.debugName.empty()) {
             // TODO: Add debug naming when a debug utils extension is available.
@@ -159,12 +175,19 @@ namespace vkeng {
 
     /**
      * @brief Destructor that destroys the Vulkan buffer and frees its memory via VMA.
+     *
+     * Destruction is deferred through the DeletionQueue, so a buffer can be
+     * dropped while frames referencing it are still in flight; the actual
+     * vmaDestroyBuffer runs once those frames' fences have signaled.
      */
     Buffer::~Buffer() {
         LOG_TRACE(MEMORY, "Destroying buffer");
 
         if (m_buffer != VK_NULL_HANDLE) {
-            vmaDestroyBuffer(m_allocator, m_buffer, m_allocation);
+            DeletionQueue::get().defer(
+                [allocator = m_allocator, buffer = m_buffer, allocation = m_allocation]() {
+                    vmaDestroyBuffer(allocator, buffer, allocation);
+                });
             m_buffer = VK_NULL_HANDLE;
             m_allocation = VK_NULL_HANDLE;
         }
@@ -180,8 +203,9 @@ namespace vkeng {
         , m_allocation(other.m_allocation)
         , m_size(other.m_size)
         , m_hostVisible(other.m_hostVisible)
+        , m_coherent(other.m_coherent)
         , m_mappedData(other.m_mappedData) {
-        
+
         other.m_buffer = VK_NULL_HANDLE;
         other.m_allocation = VK_NULL_HANDLE;
         other.m_mappedData = nullptr;
@@ -202,6 +226,7 @@ namespace vkeng {
             m_allocation = other.m_allocation;
             m_size = other.m_size;
             m_hostVisible = other.m_hostVisible;
+            m_coherent = other.m_coherent;
             m_mappedData = other.m_mappedData;
             
             other.m_buffer = VK_NULL_HANDLE;
@@ -271,11 +296,38 @@ namespace vkeng {
         
         std::memcpy(static_cast<char*>(mappedData) + offset, data, size);
 
-        VkResult result = vmaFlushAllocation(m_allocator, m_allocation, offset, size);
-        if (result != VK_SUCCESS) {
-            return Result<void>(Error("Failed to flush buffer memory", result));
+        // Host-coherent memory makes CPU writes visible automatically
+        if (!m_coherent) {
+            VkResult result = vmaFlushAllocation(m_allocator, m_allocation, offset, size);
+            if (result != VK_SUCCESS) {
+                return Result<void>(Error("Failed to flush buffer memory", result));
+            }
         }
-        
+
+        return Result<void>();
+    }
+
+    /**
+     * @brief Writes through the persistent mapping without map/unmap or flush calls.
+     */
+    Result<void> Buffer::write(const void* data, VkDeviceSize size, VkDeviceSize offset) {
+        if (!m_mappedData) {
+            return Result<void>(Error("Buffer is not persistently mapped"));
+        }
+
+        if (offset + size > m_size) {
+            return Result<void>(Error("Write size exceeds buffer size"));
+        }
+
+        std::memcpy(static_cast<char*>(m_mappedData) + offset, data, size);
+
+        if (!m_coherent) {
+            VkResult result = vmaFlushAllocation(m_allocator, m_allocation, offset, size);
+            if (result != VK_SUCCESS) {
+                return Result<void>(Error("Failed to flush buffer memory", result));
+            }
+        }
+
         return Result<void>();
     }
 
@@ -286,9 +338,10 @@ namespace vkeng {
     /**
      * @brief Private constructor for the Image class.
      */
-    Image::Image(VkDevice device, VmaAllocator allocator, VkImage image, 
+    Image::Image(VkDevice device, VmaAllocator allocator, VkImage image,
                 VmaAllocation allocation, VkImageView imageView,
-                uint32_t width, uint32_t height, VkFormat format)
+                uint32_t width, uint32_t height, VkFormat format,
+                uint32_t mipLevels, uint32_t arrayLayers)
         : m_device(device)
         , m_allocator(allocator)
         , m_image(image)
@@ -296,7 +349,9 @@ namespace vkeng {
         , m_imageView(imageView)
         , m_width(width)
         , m_height(height)
-        , m_format(format) {
+        , m_format(format)
+        , m_mipLevels(mipLevels)
+        , m_arrayLayers(arrayLayers) {
     }
 
     /**
@@ -305,15 +360,16 @@ namespace vkeng {
     Result<std::shared_ptr<Image>> Image::create(VkDevice device, VmaAllocator allocator,
                                         uint32_t width, uint32_t height,
                                         VkFormat format, VkImageUsageFlags usage,
-                                        bool hostVisible) {
-        
+                                        bool hostVisible, uint32_t mipLevels,
+                                        uint32_t arrayLayers) {
+
         VkImageCreateInfo imageInfo = {};
         imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
         imageInfo.imageType = VK_IMAGE_TYPE_2D;
         imageInfo.format = format;
         imageInfo.extent = { width, height, 1 };
-        imageInfo.mipLevels = 1;
-        imageInfo.arrayLayers = 1;
+        imageInfo.mipLevels = mipLevels;
+        imageInfo.arrayLayers = arrayLayers;
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
         imageInfo.tiling = hostVisible ? VK_IMAGE_TILING_LINEAR : VK_IMAGE_TILING_OPTIMAL;
         imageInfo.usage = usage;
@@ -337,14 +393,14 @@ namespace vkeng {
         VkImageViewCreateInfo viewInfo = {};
         viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         viewInfo.image = image;
-        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.viewType = (arrayLayers > 1) ? VK_IMAGE_VIEW_TYPE_2D_ARRAY : VK_IMAGE_VIEW_TYPE_2D;
         viewInfo.format = format;
         viewInfo.subresourceRange.aspectMask = getImageAspectMask(format);
         viewInfo.subresourceRange.baseMipLevel = 0;
-        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.levelCount = mipLevels;
         viewInfo.subresourceRange.baseArrayLayer = 0;
-        viewInfo.subresourceRange.layerCount = 1;
-        
+        viewInfo.subresourceRange.layerCount = arrayLayers;
+
         VkImageView imageView;
         result = vkCreateImageView(device, &viewInfo, nullptr, &imageView);
         if (result != VK_SUCCESS) {
@@ -354,20 +410,30 @@ namespace vkeng {
         }
         
         auto imageObj = std::shared_ptr<Image>(new Image(device, allocator, image, allocation,
-                                            imageView, width, height, format));
+                                            imageView, width, height, format, mipLevels, arrayLayers));
         return Result<std::shared_ptr<Image>>(imageObj);
     }
 
     /**
      * @brief Destructor that destroys the Vulkan image view, image, and frees its memory.
+     *
+     * Deferred through the DeletionQueue like Buffer, so textures can be
+     * evicted mid-session without waiting on in-flight frames.
      */
     Image::~Image() {
-        if (m_imageView != VK_NULL_HANDLE) {
-            vkDestroyImageView(m_device, m_imageView, nullptr);
-        }
-        
-        if (m_image != VK_NULL_HANDLE) {
-            vmaDestroyImage(m_allocator, m_image, m_allocation);
+        if (m_imageView != VK_NULL_HANDLE || m_image != VK_NULL_HANDLE) {
+            DeletionQueue::get().defer(
+                [device = m_device, imageView = m_imageView,
+                 allocator = m_allocator, image = m_image, allocation = m_allocation]() {
+                    if (imageView != VK_NULL_HANDLE) {
+                        vkDestroyImageView(device, imageView, nullptr);
+                    }
+                    if (image != VK_NULL_HANDLE) {
+                        vmaDestroyImage(allocator, image, allocation);
+                    }
+                });
+            m_imageView = VK_NULL_HANDLE;
+            m_image = VK_NULL_HANDLE;
         }
     }
 
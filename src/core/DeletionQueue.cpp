@@ -0,0 +1,99 @@
+/**
+ * @file DeletionQueue.cpp
+ * @brief Frame-tagged deferred destruction implementation
+ */
+#include "vulkan-engine/core/DeletionQueue.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace vkeng {
+
+    DeletionQueue& DeletionQueue::get() {
+        static DeletionQueue instance;
+        return instance;
+    }
+
+    DeletionQueue::~DeletionQueue() {
+        // Engine::~Engine flushes via shutdown(); anything left here leaked
+        // past device teardown and must not touch destroyed Vulkan handles.
+        if (!m_pending.empty()) {
+            LOG_WARN(MEMORY, "DeletionQueue destroyed with {} pending entries (leaked past shutdown)",
+                     m_pending.size());
+        }
+    }
+
+    void DeletionQueue::initialize(uint32_t framesInFlight) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_framesInFlight = framesInFlight;
+        m_tick = 0;
+        m_active = true;
+        LOG_INFO(MEMORY, "Deletion queue active ({} frames in flight)", framesInFlight);
+    }
+
+    void DeletionQueue::defer(std::function<void()> destroy) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_active) {
+                // Safe once every frame in flight at request time has retired.
+                m_pending.push_back({m_tick + m_framesInFlight, std::move(destroy)});
+                return;
+            }
+        }
+        // Startup / post-shutdown: GPU cannot be using the resource yet/anymore.
+        destroy();
+    }
+
+    void DeletionQueue::retire() {
+        std::vector<std::function<void()>> ready;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_tick;
+            while (!m_pending.empty() && m_pending.front().retireTick <= m_tick) {
+                ready.push_back(std::move(m_pending.front().destroy));
+                m_pending.pop_front();
+            }
+        }
+        // Run outside the lock: destruction may cascade into further defer() calls.
+        for (auto& destroy : ready) {
+            destroy();
+        }
+    }
+
+    void DeletionQueue::flushAll() {
+        // Destruction callbacks can enqueue more work (an Image freeing its
+        // view then its allocation), so drain until the queue stays empty.
+        while (true) {
+            std::deque<Pending> pending;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_pending.empty()) {
+                    return;
+                }
+                pending.swap(m_pending);
+            }
+            for (auto& entry : pending) {
+                entry.destroy();
+            }
+        }
+    }
+
+    void DeletionQueue::shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_active) {
+                return;
+            }
+            m_active = false;
+        }
+        flushAll();
+        LOG_INFO(MEMORY, "Deletion queue shut down");
+    }
+
+    size_t DeletionQueue::pendingCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending.size();
+    }
+
+} // namespace vkeng
@@ -1,8 +1,26 @@
 #include "vulkan-engine/core/Engine.hpp"
+#include "vulkan-engine/core/DeletionQueue.hpp"
+#include "vulkan-engine/core/EventSystem.hpp"
 #include "vulkan-engine/core/GlfwWindow.hpp"
+#include "vulkan-engine/core/HeadlessWindow.hpp"
+#include "vulkan-engine/core/FrameArena.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
 #include "vulkan-engine/core/Time.hpp"
+#include "vulkan-engine/core/Tunables.hpp"
+#include "vulkan-engine/rendering/BindlessTextures.hpp"
+#include "vulkan-engine/rendering/Renderer.hpp"
+#include "vulkan-engine/resources/LoadTask.hpp"
+#include "vulkan-engine/resources/MeshBufferPool.hpp"
+#include "vulkan-engine/resources/MeshResidency.hpp"
+#include "vulkan-engine/resources/ResourceManager.hpp"
+#include "vulkan-engine/resources/TextureAtlas.hpp"
+#include "vulkan-engine/resources/TextureResidency.hpp"
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <stdexcept>
+#include <thread>
 
 namespace vkeng {
 
@@ -10,21 +28,78 @@ namespace vkeng {
         LOG_ERROR(GENERAL, "GLFW Error ({}): {}", error, description);
     }
 
-    Engine::Engine(const Config& config) : config_(config) {
+    namespace {
+        PresentMode parsePresentMode(const std::string& name) {
+            if (name == "fifo")         return PresentMode::Fifo;
+            if (name == "fifo_relaxed") return PresentMode::FifoRelaxed;
+            if (name == "mailbox")      return PresentMode::Mailbox;
+            if (name == "immediate")    return PresentMode::Immediate;
+            if (name != "auto") {
+                LOG_WARN(VULKAN, "Unknown present mode '{}' in config; using automatic selection", name);
+            }
+            return PresentMode::Auto;
+        }
+    }
+
+    Engine::Engine(const Config& config) : config_(config), fpsLimit_(config.render.fpsLimit) {
+        auto bootStart = std::chrono::steady_clock::now();
+        auto msSince = [](std::chrono::steady_clock::time_point since) {
+            return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - since).count();
+        };
+
+        Logger::getInstance().setAsync(config_.logging.async);
+        JobSystem::get().initialize(config_.jobs.workerThreads, config_.jobs.affinity);
+
+        // The frame cap was already runtime-adjustable via the setter; the
+        // tunable just makes it reachable from the control file
+        Tunables::get().registerInt("engine.fpsLimit", static_cast<int>(fpsLimit_), 0, 1000,
+            [this](int fps) { fpsLimit_ = static_cast<uint32_t>(fps); },
+            "Frame rate cap (0 = uncapped)");
+
         inputManager_ = std::make_unique<InputManager>();
         physicsWorld_ = std::make_unique<PhysicsWorld>();
         audioEngine_ = std::make_unique<AudioEngine>();
+        recordStartupPhase("job system + subsystems", msSince(bootStart));
+
+        // Audio device bring-up touches no Vulkan or GLFW state, so it
+        // overlaps the whole Vulkan boot path on a worker instead of
+        // adding its device-open latency to the serial chain
+        double audioMs = 0.0;
+        JobHandle audioInit = JobSystem::get().schedule([this, &audioMs, &msSince] {
+            auto audioStart = std::chrono::steady_clock::now();
+            audioEngine_->initialize();
+            audioMs = msSince(audioStart);
+        });
+
         initWindow();
         initVulkanCore();
-        audioEngine_->initialize();
+
+        JobSystem::get().wait(audioInit);
+        recordStartupPhase("audio device (overlapped)", audioMs);
+
+        reportStartupPhases(msSince(bootStart));
     }
 
     Engine::~Engine() {
+        Tunables::get().unregister("engine.fpsLimit");
+
         // Wait for device to be idle before destroying resources
         if (device_) {
             vkDeviceWaitIdle(device_->getDevice());
         }
 
+        // Disarm the watchdog before the job system stops — it schedules
+        // report writes onto the workers
+        hitchWatchdog_.reset();
+
+        // Stop the job system before any subsystem it may reference goes away
+        JobSystem::get().shutdown();
+
+        // Device is idle: run all deferred destruction now, and have
+        // everything destroyed from here on release its handles inline
+        DeletionQueue::get().shutdown();
+
         // Derived class resources should be destroyed in their destructors or onShutdown
         // But we need to ensure order. 
         // C++ destructors run in reverse order of construction. 
@@ -36,10 +111,19 @@ namespace vkeng {
         physicsWorld_.reset();
 
         swapChain_.reset();
+        for (auto& aux : auxiliaryWindows_) {
+            aux->swapChain.reset();
+        }
         fallbackTexture_.reset();
         fallbackNormalTexture_.reset();
         fallbackMRTexture_.reset();
         DescriptorManager::get().cleanup();
+        BindlessTextureManager::get().cleanup(); // No-op unless an app enabled bindless texturing
+        FrameArena::get().shutdown();
+        TextureResidencyManager::get().clear(); // Releases retired images and its MemoryManager hold
+        MeshResidencyManager::get().clear(); // Drops mesh residency tracking
+        MeshBufferPool::get().clear(); // Releases the pooled mesh blocks and its MemoryManager hold
+        TextureAtlas::get().clear(); // Drops atlas pages and its MemoryManager hold
         memoryManager_.reset(); // Shared ptr, but we release our hold
         
         if (device_) {
@@ -49,55 +133,135 @@ namespace vkeng {
         if (surface_ != VK_NULL_HANDLE) {
             vkDestroySurfaceKHR(instance_->get(), surface_, nullptr);
         }
+        for (auto& aux : auxiliaryWindows_) {
+            if (aux->surface != VK_NULL_HANDLE) {
+                vkDestroySurfaceKHR(instance_->get(), aux->surface, nullptr);
+            }
+        }
 
+        auxiliaryWindows_.clear();
         if (window_) {
             window_.reset();
         }
-        glfwTerminate();
+        if (!config_.headless.enabled) {
+            glfwTerminate();
+        }
     }
 
     void Engine::initWindow() {
+        auto phaseStart = std::chrono::steady_clock::now();
+
+        // Headless mode: no display, no GLFW, no input. The "window" just
+        // reports a fixed framebuffer size and a close flag.
+        if (config_.headless.enabled) {
+            window_ = std::make_unique<HeadlessWindow>(
+                config_.window.width,
+                config_.window.height
+            );
+            LOG_INFO(GENERAL, "Running headless: {}x{}, {} frames",
+                     config_.window.width, config_.window.height,
+                     config_.headless.frameCount);
+            recordStartupPhase("window", std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - phaseStart).count());
+            return;
+        }
+
         glfwSetErrorCallback(glfwErrorCallback);
         if (!glfwInit()) {
             throw std::runtime_error("glfwInit failed.");
         }
 
         window_ = std::make_unique<GlfwWindow>(
-            config_.window.width, 
-            config_.window.height, 
-            config_.window.title, 
+            config_.window.width,
+            config_.window.height,
+            config_.window.title,
             config_.window.resizable
         );
 
         // InputManager currently expects GLFWwindow*
         // We need to fix InputManager or get the native handle
         inputManager_->init(static_cast<GLFWwindow*>(window_->getNativeHandle()));
+
+        recordStartupPhase("window", std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - phaseStart).count());
     }
 
     void Engine::initVulkanCore() {
-        // 1. Instance
-        uint32_t glfwExtensionCount = 0;
-        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-        std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        // Stage timer for the startup report; each mark() closes the stage
+        // opened by the previous one
+        auto stageStart = std::chrono::steady_clock::now();
+        auto mark = [this, &stageStart](const char* name) {
+            auto now = std::chrono::steady_clock::now();
+            recordStartupPhase(name, std::chrono::duration<double, std::milli>(now - stageStart).count());
+            stageStart = now;
+        };
+
+        // 1. Instance (headless windows require no surface extensions)
+        std::vector<const char*> extensions = window_->getRequiredExtensions();
         instance_ = std::make_unique<VulkanInstance>(extensions);
 
-        // 2. Surface
-        if (glfwCreateWindowSurface(instance_->get(), static_cast<GLFWwindow*>(window_->getNativeHandle()), nullptr, &surface_) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create window surface!");
+        // 2. Surface (stays VK_NULL_HANDLE in headless mode)
+        if (!config_.headless.enabled) {
+            window_->createSurface(instance_->get(), &surface_);
         }
+        mark("instance + surface");
 
         // 3. Device
         device_ = std::make_unique<VulkanDevice>(instance_->get(), surface_);
+        mark("device");
 
         // 4. Memory Manager
         auto memManagerResult = MemoryManager::create(instance_->get(), device_->getPhysicalDevice(), device_->getDevice());
         if (!memManagerResult) throw std::runtime_error("Failed to create Memory Manager");
         memoryManager_ = memManagerResult.getValue();
         memoryManager_->initializeForTransfers(*device_);
+        mark("memory manager");
 
         // Initialize the descriptor manager singleton
         DescriptorManager::get().initialize(device_->getDevice());
 
+        // Defer GPU resource destruction until the frames that could still
+        // reference a resource have retired (streaming unloads don't stall).
+        // A render thread holds a packet one frame longer, so queue one
+        // extra frame of depth when it is enabled.
+        DeletionQueue::get().initialize(Renderer::MAX_FRAMES_IN_FLIGHT +
+                                        (config_.render.renderThread ? 1u : 0u));
+
+        // Per-frame bump arena for transient render data
+        FrameArena::get().initialize(config_.memory.frameArenaBytes);
+
+        // Texture residency budget; apps wire a reload callback if they
+        // want demoted textures promoted back to full resolution
+        TextureResidencyManager::get().configure(memoryManager_,
+                                                 config_.textures.vramBudgetBytes);
+
+        // Mesh residency budget; least-recently-drawn geometry is evicted
+        // and reloaded from the CPU copy on demand
+        MeshResidencyManager::get().configure(config_.meshes.vramBudgetBytes);
+
+        // Pooled mesh storage: meshes suballocate from a few large buffers
+        // instead of owning a VkBuffer pair each
+        MeshBufferPool::get().initialize(memoryManager_);
+
+        // Small textures pack into shared atlas pages at load, so draws
+        // sampling different decals/UI textures can share a descriptor
+        if (config_.textures.atlasSmallTextures) {
+            TextureAtlas::get().initialize(memoryManager_, device_->getDevice());
+        }
+
+        // Hitch watchdog: always-on frame budget policing with on-disk
+        // capture reports (see HitchWatchdog.hpp)
+        if (config_.watchdog.enabled) {
+            hitchWatchdog_ = std::make_unique<HitchWatchdog>(memoryManager_, config_.watchdog);
+        }
+
+        // Telemetry exporter: interval metrics snapshots published over
+        // HTTP and CSV from a background thread (see TelemetryExporter.hpp)
+        if (config_.telemetry.enabled) {
+            telemetryExporter_ = std::make_unique<TelemetryExporter>(memoryManager_, config_.telemetry);
+        }
+        mark("subsystem pools");
+
         // Create 1x1 white fallback texture (used for unbound material texture slots)
         {
             uint32_t whitePixel = 0xFFFFFFFF; // RGBA white
@@ -146,11 +310,75 @@ namespace vkeng {
             fallbackMRTexture_ = std::make_shared<Texture>(
                 "__fallback_metallic_roughness", device_->getDevice(), imageResult.getValue());
         }
+        mark("fallback textures");
 
-        // 5. SwapChain
+        // 5. SwapChain (offscreen images in headless mode)
         int width, height;
         window_->getFramebufferSize(width, height);
-        swapChain_ = std::make_unique<VulkanSwapChain>(device_->getDevice(), device_->getPhysicalDevice(), surface_, width, height, memoryManager_);
+        if (config_.headless.enabled) {
+            swapChain_ = std::make_unique<VulkanSwapChain>(device_->getDevice(), device_->getPhysicalDevice(), width, height, memoryManager_);
+        } else {
+            swapChain_ = std::make_unique<VulkanSwapChain>(device_->getDevice(), device_->getPhysicalDevice(), surface_, width, height, memoryManager_);
+            // Apply the configured present-mode preference; if it differs
+            // from what automatic selection picked, the first acquire
+            // triggers one recreation with the requested mode
+            swapChain_->setPresentMode(parsePresentMode(config_.render.presentMode));
+            // Present IDs let the renderer measure (and bound) how far the
+            // pipeline runs ahead of the display
+            if (device_->supportsPresentWait()) {
+                swapChain_->enablePresentIds();
+            }
+        }
+        mark("swapchain");
+    }
+
+    /**
+     * @brief Creates a secondary output window on the shared device.
+     */
+    Engine::AuxiliaryWindow& Engine::createAuxiliaryWindow(const std::string& title,
+                                                           int width, int height) {
+        if (config_.headless.enabled) {
+            throw std::runtime_error("Auxiliary windows are not available in headless mode");
+        }
+        if (!device_ || !instance_) {
+            throw std::runtime_error("createAuxiliaryWindow requires the Vulkan core (call from onInit or later)");
+        }
+
+        auto aux = std::make_unique<AuxiliaryWindow>();
+        aux->window = std::make_unique<GlfwWindow>(width, height, title,
+                                                   config_.window.resizable);
+        aux->window->createSurface(instance_->get(), &aux->surface);
+
+        int fbWidth, fbHeight;
+        aux->window->getFramebufferSize(fbWidth, fbHeight);
+        aux->swapChain = std::make_unique<VulkanSwapChain>(
+            device_->getDevice(), device_->getPhysicalDevice(), aux->surface,
+            fbWidth, fbHeight, memoryManager_);
+        aux->swapChain->setPresentMode(parsePresentMode(config_.render.presentMode));
+        if (device_->supportsPresentWait()) {
+            aux->swapChain->enablePresentIds();
+        }
+
+        LOG_INFO(VULKAN, "Auxiliary window '{}' created ({}x{})", title, fbWidth, fbHeight);
+        auxiliaryWindows_.push_back(std::move(aux));
+        return *auxiliaryWindows_.back();
+    }
+
+    void Engine::recordStartupPhase(const char* name, double ms) {
+        startupPhases_.push_back(StartupPhase{name, ms});
+    }
+
+    /**
+     * @brief Logs the per-phase startup timing report
+     *
+     * Overlapped phases (currently audio) ran concurrently with the
+     * Vulkan boot path, so phase times can sum to more than the total.
+     */
+    void Engine::reportStartupPhases(double totalMs) const {
+        LOG_INFO(GENERAL, "Engine ready in {} ms:", totalMs);
+        for (const StartupPhase& phase : startupPhases_) {
+            LOG_INFO(GENERAL, "  {}: {} ms", phase.name, phase.ms);
+        }
     }
 
     void Engine::onFixedUpdate(float fixedDeltaTime) {
@@ -163,35 +391,281 @@ namespace vkeng {
     void Engine::run() {
         onInit(); // Allow derived class to initialize its specific resources
 
+        // After onInit so every subsystem the app created has registered its
+        // parameters — the template written for a fresh file lists them all
+        if (!config_.tunables.controlFile.empty()) {
+            Tunables::get().enableFileControl(config_.tunables.controlFile);
+        }
+
         auto& time = Time::get();
 
+        // Headless soak runs record per-frame wall time and stop after the
+        // configured frame count
+        const bool headless = config_.headless.enabled;
+        std::vector<double> frameTimesMs;
+        if (headless) {
+            frameTimesMs.reserve(config_.headless.frameCount > 0 ? config_.headless.frameCount : 1024);
+        }
+        uint64_t frameIndex = 0;
+
         while (!window_->shouldClose()) {
-            window_->pollEvents();
+            PROFILE_SCOPE("frame");
+            auto frameStart = std::chrono::steady_clock::now();
+
+            // Rewind the frame arena; per-frame containers are re-created
+            // by their owners before first use each frame
+            FrameArena::get().reset();
+
+            {
+                PROFILE_SCOPE("pollEvents");
+                window_->pollEvents();
+            }
+
+            // Frame boundary: deliver staged tunable changes before any
+            // subsystem reads its parameters this frame
+            Tunables::get().applyPending();
 
             // Advance the engine clock
             time.tick();
             float dt = time.deltaTime();
 
-            // Fixed-rate updates (physics, deterministic game logic)
-            while (time.consumeFixedStep()) {
-                onFixedUpdate(time.fixedDeltaTime());
+            // Fixed-rate updates (physics, deterministic game logic);
+            // timed only while telemetry wants the per-subsystem split
+            double fixedUpdateMs = 0.0;
+            {
+                PROFILE_SCOPE("fixedUpdate");
+                const auto fixedStart = std::chrono::steady_clock::now();
+                while (time.consumeFixedStep()) {
+                    onFixedUpdate(time.fixedDeltaTime());
+                }
+                if (telemetryExporter_) {
+                    fixedUpdateMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - fixedStart).count();
+                }
             }
 
+            // Dispatch events deferred during fixed updates (physics bursts)
+            // and by worker threads, in one batch before variable-rate logic
+            EventSystem::get().drainDeferred();
+
             // Variable-rate update (input, camera, animation, game logic)
-            onUpdate(dt);
+            {
+                PROFILE_SCOPE("update");
+                onUpdate(dt);
+            }
+
+            // Blend physics body transforms between the last two fixed steps
+            // using the leftover accumulator fraction, so rendering above the
+            // fixed rate stays smooth (step() restores true poses first)
+            if (m_sceneRoot) {
+                physicsWorld_->applyRenderInterpolation(time.fixedStepAlpha());
+            }
+
+            // Fire completion callbacks for finished async resource uploads
+            memoryManager_->pollAsyncTransfers();
+
+            // Publish resources finished by the async load workers
+            ResourceManager::get().pumpCompletedLoads();
+
+            // Run main-thread load-task steps (and resource-handle polls)
+            // against the resources just published
+            LoadTaskScheduler::get().pumpMainThread();
+
+            // Apply texture residency policy (demote/promote mip chains)
+            TextureResidencyManager::get().update();
+
+            // Apply mesh residency policy (evict least-recently-drawn geometry)
+            MeshResidencyManager::get().update();
 
             // Update spatial audio positions
+            double audioMs = 0.0;
             if (m_sceneRoot) {
+                const auto audioStart = std::chrono::steady_clock::now();
                 audioEngine_->update(m_sceneRoot);
+                if (telemetryExporter_) {
+                    audioMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - audioStart).count();
+                }
             }
 
             // Render
-            onRender();
+            {
+                PROFILE_SCOPE("render");
+                onRender();
+            }
+
+            // Input-to-present latency sample: onRender() has queued this
+            // frame's present, so "now" minus the newest event timestamp
+            // approximates the end-to-end latency the user experiences
+            if (!headless) {
+                recordInputLatency();
+            }
 
             inputManager_->endFrame();
+
+            // Check the frame against the hitch budget and record telemetry
+            // before the limiter sleeps — pacing time is idle, not workload
+            if (hitchWatchdog_ || telemetryExporter_) {
+                const double workMs = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - frameStart).count();
+                if (hitchWatchdog_) {
+                    hitchWatchdog_->endFrame(workMs, m_sceneRoot);
+                }
+                if (telemetryExporter_) {
+                    telemetryExporter_->recordFrame(workMs, fixedUpdateMs, audioMs);
+                }
+            }
+
+            // Frame limiter: sleep to within a couple of milliseconds of the
+            // frame deadline, then spin for precision — sleep_until alone
+            // overshoots by up to a scheduler quantum, which reads as judder
+            if (fpsLimit_ > 0 && !headless) {
+                PROFILE_SCOPE("framePacing");
+                auto deadline = frameStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(1.0 / static_cast<double>(fpsLimit_)));
+                constexpr auto kSpinWindow = std::chrono::milliseconds(2);
+
+                // Idle-frame maintenance: spend pacing headroom compacting
+                // VMA heaps instead of sleeping it away. Disabled alongside
+                // the render thread, which may still be recording against
+                // the handles a relocation would swap.
+                if (config_.render.defragmentation && !config_.render.renderThread) {
+                    constexpr auto kDefragHeadroom = std::chrono::milliseconds(4);
+                    if (std::chrono::steady_clock::now() + kDefragHeadroom < deadline) {
+                        auto defragResult = memoryManager_->defragmentStep();
+                        if (!defragResult) {
+                            LOG_WARN(MEMORY, "Defragmentation step failed: {}",
+                                     defragResult.getError().message);
+                        }
+                    }
+                }
+                if (std::chrono::steady_clock::now() < deadline - kSpinWindow) {
+                    std::this_thread::sleep_until(deadline - kSpinWindow);
+                }
+                while (std::chrono::steady_clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (headless) {
+                auto frameEnd = std::chrono::steady_clock::now();
+                frameTimesMs.push_back(
+                    std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+
+                frameIndex++;
+                if (config_.headless.frameCount > 0 && frameIndex >= config_.headless.frameCount) {
+                    window_->requestClose();
+                }
+            }
+        }
+
+        if (headless) {
+            reportHeadlessStats(frameTimesMs);
         }
 
         onShutdown();
     }
 
+    /**
+     * @brief Logs frame-time statistics from a headless run and optionally
+     * writes the raw per-frame times to the configured CSV path.
+     */
+    void Engine::reportHeadlessStats(const std::vector<double>& frameTimesMs) const {
+        if (frameTimesMs.empty()) {
+            LOG_WARN(GENERAL, "Headless run finished without rendering any frames");
+            return;
+        }
+
+        std::vector<double> sorted = frameTimesMs;
+        std::sort(sorted.begin(), sorted.end());
+
+        double total = 0.0;
+        for (double ms : sorted) {
+            total += ms;
+        }
+        double avg = total / static_cast<double>(sorted.size());
+
+        auto percentile = [&sorted](double p) {
+            size_t idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+            return sorted[idx];
+        };
+
+        LOG_INFO(GENERAL, "Headless run: {} frames in {} ms", sorted.size(), total);
+        LOG_INFO(GENERAL, "Frame time (ms): avg={} min={} max={}",
+                 avg, sorted.front(), sorted.back());
+        LOG_INFO(GENERAL, "Frame time (ms): p50={} p95={} p99={}",
+                 percentile(0.50), percentile(0.95), percentile(0.99));
+
+        if (!config_.headless.statsCsvPath.empty()) {
+            std::ofstream csv(config_.headless.statsCsvPath);
+            if (!csv) {
+                LOG_ERROR(GENERAL, "Failed to open stats CSV for writing: {}",
+                          config_.headless.statsCsvPath);
+                return;
+            }
+            csv << "frame,time_ms\n";
+            for (size_t i = 0; i < frameTimesMs.size(); i++) {
+                csv << i << "," << frameTimesMs[i] << "\n";
+            }
+            LOG_INFO(GENERAL, "Wrote {} frame times to {}",
+                     frameTimesMs.size(), config_.headless.statsCsvPath);
+        }
+    }
+
+    /**
+     * @brief Records one input-to-present latency sample for this frame
+     *
+     * Only frames that presented after a new input event contribute a
+     * sample; an idle mouse produces no data points that would drag the
+     * average down artificially.
+     */
+    void Engine::recordInputLatency() {
+        auto lastEvent = inputManager_->getLastEventTime();
+        if (lastEvent == std::chrono::steady_clock::time_point{} ||
+            lastEvent == lastSampledInputEvent_) {
+            return;  // No new input since the previous sample
+        }
+        lastSampledInputEvent_ = lastEvent;
+
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - lastEvent).count();
+
+        if (inputLatencySamplesMs_.size() < INPUT_LATENCY_WINDOW) {
+            inputLatencySamplesMs_.push_back(ms);
+        } else {
+            inputLatencySamplesMs_[inputLatencyCursor_] = ms;
+        }
+        inputLatencyCursor_ = (inputLatencyCursor_ + 1) % INPUT_LATENCY_WINDOW;
+        inputLatencyCount_++;
+
+        // Periodic rolling summary so latency regressions show up in logs
+        // without anyone having to query the stats explicitly
+        if (inputLatencyCount_ % INPUT_LATENCY_WINDOW == 0) {
+            InputLatencyStats stats = getInputLatencyStats();
+            LOG_DEBUG(INPUT, "Input-to-present latency (ms): avg={} min={} max={} over {} samples",
+                      stats.averageMs, stats.minMs, stats.maxMs, inputLatencySamplesMs_.size());
+        }
+    }
+
+    InputLatencyStats Engine::getInputLatencyStats() const {
+        InputLatencyStats stats;
+        stats.sampleCount = inputLatencyCount_;
+        if (inputLatencySamplesMs_.empty()) {
+            return stats;
+        }
+
+        double total = 0.0;
+        double minMs = inputLatencySamplesMs_.front();
+        double maxMs = inputLatencySamplesMs_.front();
+        for (double ms : inputLatencySamplesMs_) {
+            total += ms;
+            minMs = std::min(minMs, ms);
+            maxMs = std::max(maxMs, ms);
+        }
+        stats.averageMs = total / static_cast<double>(inputLatencySamplesMs_.size());
+        stats.minMs = minMs;
+        stats.maxMs = maxMs;
+        return stats;
+    }
+
 } // namespace vkeng
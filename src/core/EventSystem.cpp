@@ -7,9 +7,39 @@ namespace vkeng {
         return instance;
     }
 
+    void EventSystem::drainDeferred() {
+        // Grab the whole backlog in one atomic exchange; producers pushing
+        // during the drain start a fresh list for the next frame.
+        DeferredEventBase* node = m_deferredHead.exchange(nullptr, std::memory_order_acquire);
+
+        // Pushes are LIFO — reverse to dispatch in queue order
+        DeferredEventBase* ordered = nullptr;
+        while (node) {
+            DeferredEventBase* next = node->next;
+            node->next = ordered;
+            ordered = node;
+            node = next;
+        }
+
+        while (ordered) {
+            DeferredEventBase* next = ordered->next;
+            ordered->dispatch(*this);
+            delete ordered;
+            ordered = next;
+        }
+    }
+
     void EventSystem::clearAll() {
         m_listeners.clear();
         m_nextId = 1;
+
+        // Discard any undispatched deferred events
+        DeferredEventBase* node = m_deferredHead.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            DeferredEventBase* next = node->next;
+            delete node;
+            node = next;
+        }
     }
 
 } // namespace vkeng
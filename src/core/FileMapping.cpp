@@ -0,0 +1,103 @@
+#include "vulkan-engine/core/FileMapping.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vkeng {
+
+    FileMapping::~FileMapping() {
+        if (m_data) {
+#ifdef _WIN32
+            UnmapViewOfFile(m_data);
+#else
+            munmap(m_data, m_size);
+#endif
+        }
+    }
+
+    FileMapping::FileMapping(FileMapping&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)),
+          m_size(std::exchange(other.m_size, size_t{0})) {
+    }
+
+    FileMapping& FileMapping::operator=(FileMapping&& other) noexcept {
+        if (this != &other) {
+            if (m_data) {
+#ifdef _WIN32
+                UnmapViewOfFile(m_data);
+#else
+                munmap(m_data, m_size);
+#endif
+            }
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, size_t{0});
+        }
+        return *this;
+    }
+
+    Result<FileMapping> FileMapping::open(const std::string& path) {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return Result<FileMapping>(Error("Failed to open file for mapping: " + path));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+            CloseHandle(file);
+            return Result<FileMapping>(Error("File empty or unsized: " + path));
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file); // the mapping object keeps the file open
+        if (!mapping) {
+            return Result<FileMapping>(Error("Failed to create file mapping: " + path));
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping); // the view keeps the mapping object alive
+        if (!view) {
+            return Result<FileMapping>(Error("Failed to map view of file: " + path));
+        }
+
+        FileMapping result;
+        result.m_data = view;
+        result.m_size = static_cast<size_t>(fileSize.QuadPart);
+        return Result<FileMapping>(std::move(result));
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return Result<FileMapping>(Error("Failed to open file for mapping: " + path));
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            return Result<FileMapping>(Error("File empty or unsized: " + path));
+        }
+        const size_t fileSize = static_cast<size_t>(st.st_size);
+
+        void* view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping holds its own reference
+        if (view == MAP_FAILED) {
+            return Result<FileMapping>(Error("Failed to map file: " + path));
+        }
+
+        FileMapping result;
+        result.m_data = view;
+        result.m_size = fileSize;
+        return Result<FileMapping>(std::move(result));
+#endif
+    }
+
+} // namespace vkeng
@@ -0,0 +1,73 @@
+#include "vulkan-engine/core/FrameArena.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace vkeng {
+
+    FrameArena& FrameArena::get() {
+        static FrameArena instance;
+        return instance;
+    }
+
+    void FrameArena::initialize(size_t capacityBytes) {
+        m_blocks[0] = std::make_unique<uint8_t[]>(capacityBytes);
+        m_blocks[1] = std::make_unique<uint8_t[]>(capacityBytes);
+        m_capacity = capacityBytes;
+        m_offset = 0;
+        m_active = 0;
+        m_highWater = 0;
+        m_overflowCount = 0;
+        LOG_INFO(GENERAL, "FrameArena: initialized with 2x {} KB", capacityBytes / 1024);
+    }
+
+    void FrameArena::reset() {
+        m_highWater = std::max(m_highWater, m_offset);
+
+        // Flip to the other block: the frame just finished keeps its memory
+        // valid until the NEXT reset, covering a render thread still reading
+        // its packet. The block we flip to was last touched two frames ago.
+        m_active ^= 1;
+        m_offset = 0;
+
+        auto& overflow = m_overflowBlocks[m_active];
+        if (!overflow.empty()) {
+            for (void* block : overflow) {
+                ::operator delete(block);
+            }
+            overflow.clear();
+        }
+    }
+
+    void* FrameArena::allocate(size_t size, size_t alignment) {
+        if (m_blocks[m_active]) {
+            const size_t aligned = (m_offset + alignment - 1) & ~(alignment - 1);
+            if (aligned + size <= m_capacity) {
+                m_offset = aligned + size;
+                return m_blocks[m_active].get() + aligned;
+            }
+        }
+
+        // Arena exhausted (or never initialized): heap block, freed when this
+        // block's parity next resets. Allocation never fails outright; the
+        // counter flags undersizing.
+        ++m_overflowCount;
+        void* block = ::operator new(size);
+        m_overflowBlocks[m_active].push_back(block);
+        return block;
+    }
+
+    void FrameArena::shutdown() {
+        reset();
+        reset();
+        if (m_overflowCount > 0) {
+            LOG_WARN(GENERAL,
+                     "FrameArena: {} overflow allocations this session (high water {} KB of {} KB) — consider a larger frameArenaBytes",
+                     m_overflowCount, m_highWater / 1024, m_capacity / 1024);
+        }
+        m_blocks[0].reset();
+        m_blocks[1].reset();
+        m_capacity = 0;
+    }
+
+} // namespace vkeng
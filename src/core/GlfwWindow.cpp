@@ -61,6 +61,10 @@ namespace vkeng {
         m_resizeCallback = callback;
     }
 
+    void GlfwWindow::requestClose() {
+        glfwSetWindowShouldClose(m_window, GLFW_TRUE);
+    }
+
     void GlfwWindow::framebufferResizeCallback(GLFWwindow* window, int width, int height) {
         auto self = reinterpret_cast<GlfwWindow*>(glfwGetWindowUserPointer(window));
         if (self && self->m_resizeCallback) {
@@ -0,0 +1,47 @@
+#include "vulkan-engine/core/HeadlessWindow.hpp"
+
+namespace vkeng {
+
+    HeadlessWindow::HeadlessWindow(int width, int height)
+        : m_width(width), m_height(height) {
+    }
+
+    bool HeadlessWindow::shouldClose() const {
+        return m_shouldClose;
+    }
+
+    void HeadlessWindow::pollEvents() {
+        // No event source in headless mode
+    }
+
+    void HeadlessWindow::waitEvents() {
+        // No event source in headless mode
+    }
+
+    void HeadlessWindow::getFramebufferSize(int& width, int& height) const {
+        width = m_width;
+        height = m_height;
+    }
+
+    void* HeadlessWindow::getNativeHandle() const {
+        return nullptr;
+    }
+
+    std::vector<const char*> HeadlessWindow::getRequiredExtensions() const {
+        return {};
+    }
+
+    void HeadlessWindow::createSurface(void* /*instance*/, void* /*surface*/) {
+        // Headless rendering targets offscreen images; the surface stays
+        // VK_NULL_HANDLE and the device/swap-chain paths branch on that.
+    }
+
+    void HeadlessWindow::setResizeCallback(ResizeCallback callback) {
+        m_resizeCallback = callback;
+    }
+
+    void HeadlessWindow::requestClose() {
+        m_shouldClose = true;
+    }
+
+} // namespace vkeng
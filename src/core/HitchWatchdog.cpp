@@ -0,0 +1,182 @@
+#include "vulkan-engine/core/HitchWatchdog.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace vkeng {
+
+    namespace {
+        /// How far back the CPU zone snapshot reaches — enough to cover the
+        /// hitched frame plus the frames leading into it
+        constexpr uint64_t CAPTURE_WINDOW_US = 500'000;
+
+        /// Zone cap per report; the newest win when a window is busier
+        constexpr size_t MAX_REPORT_EVENTS = 512;
+
+        /// Minimum spacing between reports — a sustained stall produces one
+        /// report and a suppressed count instead of a report per slow frame
+        constexpr uint64_t REPORT_COOLDOWN_US = 2'000'000;
+
+        /** @brief Counts a subtree iteratively (hitch path only, never per frame). */
+        uint32_t countNodes(const SceneNode& root) {
+            uint32_t count = 0;
+            std::vector<const SceneNode*> stack;
+            stack.push_back(&root);
+            while (!stack.empty()) {
+                const SceneNode* node = stack.back();
+                stack.pop_back();
+                count++;
+                for (const auto& child : node->getChildren()) {
+                    stack.push_back(child.get());
+                }
+            }
+            return count;
+        }
+    }
+
+    HitchWatchdog::HitchWatchdog(std::shared_ptr<MemoryManager> memoryManager,
+                                 const Config::Watchdog& config)
+        : m_config(config)
+        , m_reportDir(config.reportDir)
+        , m_memoryManager(std::move(memoryManager)) {
+
+        if (m_config.maxReports == 0) {
+            m_config.maxReports = 1;
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_reportDir, ec);
+        if (ec) {
+            throw std::runtime_error("Failed to create hitch report directory: " +
+                                     m_reportDir.string());
+        }
+
+        CpuProfiler::get().setBackgroundRecording(true);
+        LOG_INFO(GENERAL, "Hitch watchdog armed: threshold {} ms, reports in {}",
+                 m_config.hitchThresholdMs, m_reportDir.string());
+    }
+
+    HitchWatchdog::~HitchWatchdog() {
+        CpuProfiler::get().setBackgroundRecording(false);
+        if (m_hitchCount > 0) {
+            LOG_INFO(GENERAL, "Hitch watchdog: {} frame(s) over threshold this run", m_hitchCount);
+        }
+    }
+
+    void HitchWatchdog::endFrame(double frameMs, const SceneNode* sceneRoot) {
+        if (frameMs < static_cast<double>(m_config.hitchThresholdMs)) {
+            return;
+        }
+
+        m_hitchCount++;
+        const uint64_t nowUs = CpuProfiler::nowMicros();
+        if (m_lastReportUs != 0 && nowUs - m_lastReportUs < REPORT_COOLDOWN_US) {
+            m_suppressedSinceReport++;
+            return;
+        }
+        m_lastReportUs = nowUs;
+
+        captureHitch(frameMs, sceneRoot);
+        m_suppressedSinceReport = 0;
+    }
+
+    void HitchWatchdog::captureHitch(double frameMs, const SceneNode* sceneRoot) {
+        // Gather everything on the main thread — these are cheap copies and
+        // the sources are not safe to read from a worker mid-frame
+        const uint64_t nowUs = CpuProfiler::nowMicros();
+        auto samples = CpuProfiler::get().snapshotRecent(
+            nowUs > CAPTURE_WINDOW_US ? nowUs - CAPTURE_WINDOW_US : 0, MAX_REPORT_EVENTS);
+        auto gpuTimings = GpuProfiler::get().getTimings();
+        const auto memory = m_memoryManager->getMemoryStats();
+        const uint32_t nodeCount = sceneRoot ? countNodes(*sceneRoot) : 0;
+        const bool haveDrawStats = static_cast<bool>(m_drawStatsProvider);
+        const DrawStats draws = haveDrawStats ? m_drawStatsProvider() : DrawStats{};
+
+        const std::time_t wallTime = std::time(nullptr);
+        const uint64_t suppressed = m_suppressedSinceReport;
+
+        const std::filesystem::path path = m_reportDir /
+            ("hitch_" + std::to_string(m_reportIndex % m_config.maxReports) + ".log");
+        m_reportIndex++;
+
+        LOG_WARN(GENERAL, "Frame hitch: {} ms (threshold {} ms), report {}",
+                 frameMs, m_config.hitchThresholdMs, path.string());
+
+        // Formatting and file I/O run on a worker; the hitched frame is
+        // already late and does not need to pay for its own autopsy
+        JobSystem::get().schedule([path, frameMs, wallTime, suppressed, nodeCount,
+                                   haveDrawStats, draws, memory, nowUs,
+                                   samples = std::move(samples),
+                                   gpuTimings = std::move(gpuTimings)]() {
+            std::ofstream file(path, std::ios::trunc);
+            if (!file.is_open()) {
+                LOG_WARN(GENERAL, "Hitch watchdog: failed to open report file {}", path.string());
+                return;
+            }
+
+            char stamp[32] = {};
+            std::tm local{};
+#ifdef _WIN32
+            localtime_s(&local, &wallTime);
+#else
+            localtime_r(&wallTime, &local);
+#endif
+            std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+
+            file << "Hitch report " << stamp << "\n";
+            file << "Frame time: " << frameMs << " ms\n";
+            if (suppressed > 0) {
+                file << "Suppressed hitches since previous report: " << suppressed << "\n";
+            }
+            file << "\nScene:\n";
+            file << "  nodes: " << nodeCount << "\n";
+            if (haveDrawStats) {
+                file << "  draw calls: " << draws.drawCalls << "\n";
+                file << "  culled draws: " << draws.culledDraws << "\n";
+            } else {
+                file << "  draw stats: unavailable (no provider wired)\n";
+            }
+            file << "\nMemory:\n";
+            file << "  total allocated: " << memory.totalAllocated << " bytes\n";
+            file << "  buffers: " << memory.bufferBytes << " bytes (" << memory.bufferCount << ")\n";
+            file << "  images: " << memory.imageBytes << " bytes (" << memory.imageCount << ")\n";
+
+            file << "\nGPU passes (most recent resolved frame):\n";
+            if (gpuTimings.empty()) {
+                file << "  (no timestamps available)\n";
+            }
+            for (const auto& pass : gpuTimings) {
+                file << "  " << pass.name << ": " << pass.milliseconds << " ms\n";
+            }
+
+            // Zones print with start times relative to the report moment so
+            // the hitched frame reads as the final ~frameMs of the window
+            file << "\nCPU zones (last " << samples.size() << ", oldest first):\n";
+            for (const auto& sample : samples) {
+                const double startMs =
+                    static_cast<double>(nowUs - sample.startUs) / 1000.0;
+                const double durMs =
+                    static_cast<double>(sample.endUs - sample.startUs) / 1000.0;
+                char line[160];
+                std::snprintf(line, sizeof(line), "  -%9.3f ms  %-24s %9.3f ms  tid %llx\n",
+                              startMs, sample.name, durMs,
+                              static_cast<unsigned long long>(sample.threadId & 0xFFFFFF));
+                file << line;
+            }
+
+            if (!file.good()) {
+                LOG_WARN(GENERAL, "Hitch watchdog: failed writing report {}", path.string());
+            }
+        });
+    }
+
+} // namespace vkeng
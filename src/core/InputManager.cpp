@@ -29,6 +29,7 @@ InputManager::InputManager()
     std::memset(m_keys, 0, sizeof(m_keys));
     std::memset(m_lastKeys, 0, sizeof(m_lastKeys));
     std::memset(m_mouseButtons, 0, sizeof(m_mouseButtons));
+    std::memset(m_keysAtLatch, 0, sizeof(m_keysAtLatch));
 }
 
 InputManager::~InputManager() {
@@ -95,8 +96,12 @@ void InputManager::init(GLFWwindow* window) {
  * per-frame delta values. Essential for proper frame-based input tracking.
  */
 void InputManager::endFrame() {
-    // Copy current key states to last key states
-    std::memcpy(m_lastKeys, m_keys, sizeof(m_keys));
+    // Copy current key states to last key states. If a late-latch poll ran
+    // this frame, use the snapshot it took instead — presses that arrived
+    // in the late window were never observable by this frame's update, so
+    // they must still read as triggered next frame.
+    std::memcpy(m_lastKeys, m_latchPolled ? m_keysAtLatch : m_keys, sizeof(m_keys));
+    m_latchPolled = false;
 
     // Log only if there was significant input this frame
     if (std::abs(m_mouseDeltaX) > 0.1 || std::abs(m_mouseDeltaY) > 0.1 || std::abs(m_scrollDeltaY) > 0.01) {
@@ -110,6 +115,24 @@ void InputManager::endFrame() {
     m_scrollDeltaY = 0.0;
 }
 
+/**
+ * @brief Pump OS events mid-frame for late-latched camera sampling
+ *
+ * Snapshots key state before polling so endFrame() can keep triggered-key
+ * detection correct for presses that arrive in the late window.
+ */
+void InputManager::pollLatest() {
+    if (!m_window) return;
+
+    // Only the first late poll of a frame takes the snapshot; the update
+    // pass has already seen everything in m_keys at this point
+    if (!m_latchPolled) {
+        std::memcpy(m_keysAtLatch, m_keys, sizeof(m_keys));
+        m_latchPolled = true;
+    }
+    glfwPollEvents();
+}
+
 bool InputManager::isKeyPressed(int key) const {
     if (key >= 0 && key < 1024) return m_keys[key];
     return false;
@@ -136,6 +159,18 @@ void InputManager::getScrollDelta(double& y) const {
     y = m_scrollDeltaY;
 }
 
+void InputManager::consumeMouseDelta(double& x, double& y) {
+    x = m_mouseDeltaX;
+    y = m_mouseDeltaY;
+    m_mouseDeltaX = 0.0;
+    m_mouseDeltaY = 0.0;
+}
+
+void InputManager::consumeScrollDelta(double& y) {
+    y = m_scrollDeltaY;
+    m_scrollDeltaY = 0.0;
+}
+
 void InputManager::getMousePosition(double& x, double& y) const {
     x = m_mouseX;
     y = m_mouseY;
@@ -149,6 +184,7 @@ bool InputManager::isCursorCaptured() const {
 // --- Private Event Handlers ---
 
 void InputManager::handleKey(int key, int scancode, int action, int mods) {
+    m_lastEventTime = std::chrono::steady_clock::now();
     if (key >= 0 && key < 1024) {
         if (action == GLFW_PRESS) m_keys[key] = true;
         else if (action == GLFW_RELEASE) m_keys[key] = false;
@@ -156,6 +192,7 @@ void InputManager::handleKey(int key, int scancode, int action, int mods) {
 }
 
 void InputManager::handleCursorPos(double xpos, double ypos) {
+    m_lastEventTime = std::chrono::steady_clock::now();
     LOG_TRACE(INPUT, "Cursor position: ({}, {}), first={}", xpos, ypos, m_firstMouse);
     
     if (m_firstMouse) {
@@ -187,6 +224,7 @@ void InputManager::handleCursorPos(double xpos, double ypos) {
 }
 
 void InputManager::handleMouseButton(int button, int action, int mods) {
+    m_lastEventTime = std::chrono::steady_clock::now();
     if (button >= 0 && button < 8) {
         if (action == GLFW_PRESS) {
             m_mouseButtons[button] = true;
@@ -197,6 +235,7 @@ void InputManager::handleMouseButton(int button, int action, int mods) {
 }
 
 void InputManager::handleScroll(double xoffset, double yoffset) {
+    m_lastEventTime = std::chrono::steady_clock::now();
     m_scrollDeltaY += yoffset;
 }
 
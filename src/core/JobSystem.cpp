@@ -0,0 +1,481 @@
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace vkeng {
+
+    namespace {
+        /// Index of this thread's queue, or SIZE_MAX for non-worker threads
+        thread_local size_t tlWorkerIndex = SIZE_MAX;
+
+        /// One logical CPU from the detected machine topology
+        struct CpuSlot {
+            uint32_t cpu = 0;     ///< Logical CPU id (the pinning target)
+            uint32_t socket = 0;  ///< Physical package id
+            uint32_t core = 0;    ///< Core id within the socket
+            uint32_t smtRank = 0; ///< 0 = first hardware thread of the core
+        };
+
+#ifdef __linux__
+        /// Reads a small integer sysfs attribute; -1 on failure
+        int readTopologyValue(uint32_t cpu, const char* attribute) {
+            char path[128];
+            std::snprintf(path, sizeof(path),
+                          "/sys/devices/system/cpu/cpu%u/topology/%s", cpu, attribute);
+            FILE* file = std::fopen(path, "r");
+            if (!file) return -1;
+            int value = -1;
+            if (std::fscanf(file, "%d", &value) != 1) value = -1;
+            std::fclose(file);
+            return value;
+        }
+#endif
+
+        /**
+         * @brief Enumerate logical CPUs with their socket/core placement
+         *
+         * Uses sysfs on Linux; elsewhere (or when sysfs is unavailable)
+         * every CPU reports socket 0 / distinct cores, which degrades all
+         * policies to plain sequential assignment.
+         */
+        std::vector<CpuSlot> detectTopology() {
+            uint32_t hw = std::thread::hardware_concurrency();
+            if (hw == 0) hw = 1;
+
+            std::vector<CpuSlot> slots(hw);
+            for (uint32_t i = 0; i < hw; i++) {
+                slots[i].cpu = i;
+                slots[i].core = i;
+            }
+
+#ifdef __linux__
+            for (uint32_t i = 0; i < hw; i++) {
+                int socket = readTopologyValue(i, "physical_package_id");
+                int core = readTopologyValue(i, "core_id");
+                if (socket >= 0) slots[i].socket = static_cast<uint32_t>(socket);
+                if (core >= 0) slots[i].core = static_cast<uint32_t>(core);
+            }
+#endif
+
+            // SMT rank: order of appearance within each (socket, core)
+            for (uint32_t i = 0; i < hw; i++) {
+                uint32_t rank = 0;
+                for (uint32_t j = 0; j < i; j++) {
+                    if (slots[j].socket == slots[i].socket && slots[j].core == slots[i].core) {
+                        rank++;
+                    }
+                }
+                slots[i].smtRank = rank;
+            }
+            return slots;
+        }
+
+        /**
+         * @brief Order CPUs into the sequence workers are assigned along
+         *
+         * compact: socket by socket, physical threads before SMT siblings.
+         * spread: alternate sockets so consecutive workers land apart.
+         * physical: compact order restricted to SMT rank 0.
+         */
+        std::vector<CpuSlot> buildPinOrder(std::vector<CpuSlot> slots, const std::string& policy) {
+            auto compactLess = [](const CpuSlot& a, const CpuSlot& b) {
+                if (a.socket != b.socket) return a.socket < b.socket;
+                if (a.smtRank != b.smtRank) return a.smtRank < b.smtRank;
+                return a.core < b.core;
+            };
+            std::sort(slots.begin(), slots.end(), compactLess);
+
+            if (policy == "physical") {
+                slots.erase(std::remove_if(slots.begin(), slots.end(),
+                                           [](const CpuSlot& s) { return s.smtRank != 0; }),
+                            slots.end());
+            } else if (policy == "spread") {
+                // Round-robin across sockets, preserving compact order inside each
+                std::vector<CpuSlot> interleaved;
+                interleaved.reserve(slots.size());
+                std::vector<std::vector<CpuSlot>> bySocket;
+                for (const CpuSlot& slot : slots) {
+                    if (slot.socket >= bySocket.size()) bySocket.resize(slot.socket + 1);
+                    bySocket[slot.socket].push_back(slot);
+                }
+                for (size_t offset = 0; interleaved.size() < slots.size(); offset++) {
+                    for (const auto& socketSlots : bySocket) {
+                        if (offset < socketSlots.size()) {
+                            interleaved.push_back(socketSlots[offset]);
+                        }
+                    }
+                }
+                slots = std::move(interleaved);
+            }
+            return slots;
+        }
+
+        /** @brief Pin a worker thread to one logical CPU (Linux only). */
+        bool pinThreadToCpu(std::thread& thread, uint32_t cpu) {
+#ifdef __linux__
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(cpu, &cpuSet);
+            return pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+            (void)thread;
+            (void)cpu;
+            return false;
+#endif
+        }
+    }
+
+    /**
+     * @brief Completion state shared by a job (or parallelFor chunk group)
+     *
+     * pending counts outstanding chunks; the last finisher flips finished
+     * and enqueues any continuations registered while the job was running.
+     */
+    struct JobHandle::State {
+        std::atomic<uint32_t> pending{1};
+        std::atomic<bool> finished{false};
+        std::mutex contMutex;
+        std::vector<JobSystem::Job> continuations;
+    };
+
+    bool JobHandle::isDone() const {
+        return !m_state || m_state->finished.load(std::memory_order_acquire);
+    }
+
+    JobSystem& JobSystem::get() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    JobSystem::~JobSystem() {
+        shutdown();
+    }
+
+    std::shared_ptr<JobHandle::State> JobSystem::makeState(uint32_t pending) {
+        auto state = std::make_shared<JobHandle::State>();
+        state->pending.store(pending, std::memory_order_relaxed);
+        return state;
+    }
+
+    void JobSystem::initialize(uint32_t workerCount, const std::string& affinityPolicy) {
+        if (m_running.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        if (workerCount == 0) {
+            uint32_t hw = std::thread::hardware_concurrency();
+            workerCount = (hw > 1) ? hw - 1 : 1;
+        }
+
+        // Topology dump, so deployment can verify placement from the log
+        std::vector<CpuSlot> topology = detectTopology();
+        uint32_t coreCount = 0;
+        m_socketCount = 1;
+        for (const CpuSlot& slot : topology) {
+            if (slot.socket + 1 > m_socketCount) m_socketCount = slot.socket + 1;
+            if (slot.smtRank == 0) coreCount++;
+        }
+        LOG_INFO(GENERAL, "CPU topology: {} socket(s), {} physical core(s), {} hardware thread(s)",
+                 m_socketCount, coreCount, topology.size());
+
+        const bool pinning = (affinityPolicy != "none") && !affinityPolicy.empty();
+        std::vector<CpuSlot> pinOrder;
+        if (pinning) {
+            if (affinityPolicy != "compact" && affinityPolicy != "spread" &&
+                affinityPolicy != "physical") {
+                LOG_WARN(GENERAL, "Unknown job affinity policy '{}', workers left unpinned",
+                         affinityPolicy);
+            } else {
+                pinOrder = buildPinOrder(topology, affinityPolicy);
+                // Leave the first CPU of the order for the main thread, the
+                // same headroom the default worker count reserves
+                if (pinOrder.size() > 1) {
+                    pinOrder.erase(pinOrder.begin());
+                }
+            }
+        }
+
+        m_queues.clear();
+        m_queues.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            m_queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        m_running.store(true, std::memory_order_release);
+        m_workers.reserve(workerCount);
+        m_workerSocket.assign(workerCount, 0);
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back(&JobSystem::workerLoop, this, static_cast<size_t>(i));
+
+            if (!pinOrder.empty()) {
+                const CpuSlot& slot = pinOrder[i % pinOrder.size()];
+                m_workerSocket[i] = slot.socket;
+                if (pinThreadToCpu(m_workers.back(), slot.cpu)) {
+                    LOG_INFO(GENERAL, "JobSystem worker {} pinned to cpu {} (socket {}, core {}, smt {})",
+                             i, slot.cpu, slot.socket, slot.core, slot.smtRank);
+                } else {
+                    LOG_WARN(GENERAL, "JobSystem worker {} pinning to cpu {} failed (unsupported platform?)",
+                             i, slot.cpu);
+                }
+            } else {
+                // Unpinned workers are still assigned a nominal socket so
+                // scheduleOnSocket() partitions work deterministically
+                m_workerSocket[i] = i % m_socketCount;
+            }
+        }
+
+        // Group workers by socket and build each worker's steal order:
+        // same-socket victims first, remote sockets only when those run dry
+        m_socketWorkers.assign(m_socketCount, {});
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            m_socketWorkers[m_workerSocket[i]].push_back(i);
+        }
+        m_victimOrder.assign(workerCount, {});
+        for (uint32_t i = 0; i < workerCount; ++i) {
+            std::vector<size_t>& order = m_victimOrder[i];
+            order.reserve(workerCount - 1);
+            for (uint32_t j = 1; j < workerCount; ++j) {
+                size_t victim = (i + j) % workerCount;
+                if (m_workerSocket[victim] == m_workerSocket[i]) order.push_back(victim);
+            }
+            for (uint32_t j = 1; j < workerCount; ++j) {
+                size_t victim = (i + j) % workerCount;
+                if (m_workerSocket[victim] != m_workerSocket[i]) order.push_back(victim);
+            }
+        }
+
+        LOG_INFO(GENERAL, "JobSystem started with {} worker thread(s), affinity '{}'",
+                 workerCount, pinning && !pinOrder.empty() ? affinityPolicy : "none");
+    }
+
+    void JobSystem::shutdown() {
+        if (!m_running.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // Drain: keep executing on this thread until every deque is empty,
+        // so no scheduled job is silently discarded
+        bool drained = false;
+        while (!drained) {
+            drained = !tryExecuteOne(0);
+            if (drained) {
+                for (auto& queue : m_queues) {
+                    std::lock_guard<std::mutex> lock(queue->mutex);
+                    if (!queue->jobs.empty()) {
+                        drained = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        m_running.store(false, std::memory_order_release);
+        m_wakeCv.notify_all();
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+        m_queues.clear();
+        m_workerSocket.clear();
+        m_socketWorkers.clear();
+        m_victimOrder.clear();
+        m_socketCount = 1;
+
+        LOG_INFO(GENERAL, "JobSystem shut down");
+    }
+
+    JobHandle JobSystem::schedule(JobFunc fn) {
+        auto state = makeState(1);
+        Job job{std::move(fn), state};
+
+        if (m_workers.empty()) {
+            // Uninitialized: run inline rather than dropping the work
+            job.fn();
+            finishJob(job.state);
+            return JobHandle{state};
+        }
+
+        enqueue(std::move(job));
+        return JobHandle{state};
+    }
+
+    JobHandle JobSystem::scheduleOnSocket(JobFunc fn, uint32_t socket) {
+        auto state = makeState(1);
+        Job job{std::move(fn), state};
+
+        if (m_workers.empty()) {
+            job.fn();
+            finishJob(job.state);
+            return JobHandle{state};
+        }
+
+        socket %= m_socketCount;
+        const std::vector<size_t>& group = m_socketWorkers[socket];
+        if (group.empty()) {
+            // No worker landed on that socket (more sockets than workers);
+            // fall back to normal placement rather than stranding the job
+            enqueue(std::move(job));
+            return JobHandle{state};
+        }
+
+        size_t target = group[m_socketCursor.fetch_add(1, std::memory_order_relaxed) % group.size()];
+        {
+            std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+            m_queues[target]->jobs.push_back(std::move(job));
+        }
+        m_wakeCv.notify_one();
+        return JobHandle{state};
+    }
+
+    JobHandle JobSystem::schedule(JobFunc fn, const JobHandle& dependency) {
+        if (!dependency.m_state ||
+            dependency.m_state->finished.load(std::memory_order_acquire)) {
+            return schedule(std::move(fn));
+        }
+
+        auto state = makeState(1);
+        Job job{std::move(fn), state};
+
+        {
+            std::lock_guard<std::mutex> lock(dependency.m_state->contMutex);
+            // Re-check under the lock: the dependency may have finished while
+            // we were acquiring it, in which case nobody would run the list
+            if (!dependency.m_state->finished.load(std::memory_order_acquire)) {
+                dependency.m_state->continuations.push_back(std::move(job));
+                return JobHandle{state};
+            }
+        }
+
+        if (m_workers.empty()) {
+            job.fn();
+            finishJob(job.state);
+        } else {
+            enqueue(std::move(job));
+        }
+        return JobHandle{state};
+    }
+
+    void JobSystem::wait(const JobHandle& handle) {
+        if (!handle.m_state) {
+            return;
+        }
+
+        size_t preferred = (tlWorkerIndex != SIZE_MAX) ? tlWorkerIndex : 0;
+        while (!handle.m_state->finished.load(std::memory_order_acquire)) {
+            if (!tryExecuteOne(preferred)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::enqueue(Job&& job) {
+        size_t target = (tlWorkerIndex != SIZE_MAX)
+            ? tlWorkerIndex
+            : m_submitCursor.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+        {
+            std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+            m_queues[target]->jobs.push_back(std::move(job));
+        }
+        m_wakeCv.notify_one();
+    }
+
+    bool JobSystem::tryExecuteOne(size_t preferredQueue) {
+        if (m_queues.empty()) {
+            return false;
+        }
+
+        Job job;
+        bool found = false;
+
+        // Own queue first, from the back: most recently pushed work is the
+        // most cache-warm for this thread
+        {
+            WorkerQueue& own = *m_queues[preferredQueue % m_queues.size()];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.jobs.empty()) {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                found = true;
+            }
+        }
+
+        // Steal from the front of the other deques: oldest work first, which
+        // tends to be the largest remaining chunks. Workers scan same-socket
+        // victims before remote ones so stolen data stays NUMA-local.
+        if (!found) {
+            const size_t own = preferredQueue % m_queues.size();
+            const bool haveOrder = own < m_victimOrder.size() && !m_victimOrder[own].empty();
+            const size_t victimCount = haveOrder ? m_victimOrder[own].size() : m_queues.size() - 1;
+            for (size_t i = 0; i < victimCount && !found; ++i) {
+                size_t victimIndex = haveOrder ? m_victimOrder[own][i]
+                                               : (own + 1 + i) % m_queues.size();
+                WorkerQueue& victim = *m_queues[victimIndex];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.jobs.empty()) {
+                    job = std::move(victim.jobs.front());
+                    victim.jobs.pop_front();
+                    found = true;
+                }
+            }
+        }
+
+        if (!found) {
+            return false;
+        }
+
+        job.fn();
+        finishJob(job.state);
+        return true;
+    }
+
+    void JobSystem::finishJob(const std::shared_ptr<JobHandle::State>& state) {
+        if (state->pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return; // Other chunks of this group are still running
+        }
+
+        std::vector<Job> continuations;
+        {
+            std::lock_guard<std::mutex> lock(state->contMutex);
+            state->finished.store(true, std::memory_order_release);
+            continuations = std::move(state->continuations);
+        }
+
+        for (auto& job : continuations) {
+            if (m_workers.empty()) {
+                job.fn();
+                finishJob(job.state);
+            } else {
+                enqueue(std::move(job));
+            }
+        }
+    }
+
+    void JobSystem::workerLoop(size_t workerIndex) {
+        tlWorkerIndex = workerIndex;
+
+        while (m_running.load(std::memory_order_acquire)) {
+            if (tryExecuteOne(workerIndex)) {
+                continue;
+            }
+
+            // All deques looked empty; sleep until new work is submitted.
+            // The timeout covers the submit-before-sleep race without a
+            // per-queue generation counter.
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeCv.wait_for(lock, std::chrono::milliseconds(1));
+        }
+
+        tlWorkerIndex = SIZE_MAX;
+    }
+
+} // namespace vkeng
@@ -1,4 +1,5 @@
 #include "vulkan-engine/core/Logger.hpp"
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <thread>
@@ -11,6 +12,7 @@ Logger& Logger::getInstance() {
 }
 
 Logger::~Logger() {
+    setAsync(false); // Drains the queue and joins the worker
     if (fileLoggingEnabled_ && logFile_.is_open()) {
         logFile_.close();
     }
@@ -20,10 +22,10 @@ void Logger::enableFileLogging(const std::string& filename) {
     if (logFile_.is_open()) {
         logFile_.close();
     }
-    
+
     logFile_.open(filename, std::ios::out | std::ios::app);
     fileLoggingEnabled_ = logFile_.is_open();
-    
+
     if (fileLoggingEnabled_) {
         log(LogLevel::INFO, LogCategory::GENERAL, "File logging enabled: " + filename);
     }
@@ -32,6 +34,7 @@ void Logger::enableFileLogging(const std::string& filename) {
 void Logger::disableFileLogging() {
     if (fileLoggingEnabled_) {
         log(LogLevel::INFO, LogCategory::GENERAL, "Disabling file logging");
+        flush();
         fileLoggingEnabled_ = false;
         if (logFile_.is_open()) {
             logFile_.close();
@@ -39,16 +42,139 @@ void Logger::disableFileLogging() {
     }
 }
 
-void Logger::log(LogLevel level, LogCategory category, const std::string& message, 
+void Logger::setAsync(bool enabled) {
+    if (enabled == asyncEnabled_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    if (enabled) {
+        if (!queue_) {
+            queue_ = std::make_unique<AsyncSlot[]>(kQueueCapacity);
+            for (size_t i = 0; i < kQueueCapacity; ++i) {
+                queue_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        workerRunning_.store(true, std::memory_order_release);
+        worker_ = std::thread(&Logger::asyncWorkerLoop, this);
+        asyncEnabled_.store(true, std::memory_order_release);
+        log(LogLevel::DEBUG, LogCategory::GENERAL, "Async logging enabled");
+    } else {
+        // Stop routing new messages through the ring, then let the worker
+        // drain whatever is queued before joining it
+        asyncEnabled_.store(false, std::memory_order_release);
+        workerRunning_.store(false, std::memory_order_release);
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+}
+
+void Logger::flush() {
+    if (!asyncEnabled_.load(std::memory_order_acquire)) {
+        return;
+    }
+    // The consumer only advances dequeuePos_ after the record is written out,
+    // so waiting for it to catch up to the producers is a full flush
+    while (dequeuePos_.load(std::memory_order_acquire) <
+           enqueuePos_.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+bool Logger::tryEnqueue(LogLevel level, LogCategory category, const std::string& message) {
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    AsyncSlot* slot;
+    for (;;) {
+        slot = &queue_[pos & (kQueueCapacity - 1)];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break; // Slot claimed
+            }
+        } else if (diff < 0) {
+            return false; // Queue full — a whole lap behind the consumer
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    AsyncRecord& record = slot->record;
+    record.level = level;
+    record.category = category;
+    record.time = std::chrono::system_clock::now();
+    record.length = static_cast<uint16_t>(
+        (message.size() < kMaxMessageLength) ? message.size() : kMaxMessageLength);
+    std::memcpy(record.text, message.data(), record.length);
+
+    // Publish: consumer may read the record once sequence == pos + 1
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::asyncWorkerLoop() {
+    while (true) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        AsyncSlot& slot = queue_[pos & (kQueueCapacity - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) {
+            // Nothing ready. Exit only once producers have stopped AND the
+            // ring is empty so shutdown never loses queued messages.
+            if (!workerRunning_.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        AsyncRecord& record = slot.record;
+        writeEntry(record.level, record.category,
+                   std::string(record.text, record.length),
+                   record.time, nullptr, 0, nullptr);
+
+        // Release the slot for the producers' next lap
+        slot.sequence.store(pos + kQueueCapacity, std::memory_order_release);
+        dequeuePos_.store(pos + 1, std::memory_order_release);
+
+        // Surface overflow so silent drops are at least visible in the output
+        uint64_t dropped = droppedCount_.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped_) {
+            writeEntry(LogLevel::WARN, LogCategory::GENERAL,
+                       "Async log queue overflowed; " +
+                       std::to_string(dropped - reportedDropped_) + " message(s) dropped",
+                       std::chrono::system_clock::now(), nullptr, 0, nullptr);
+            reportedDropped_ = dropped;
+        }
+    }
+}
+
+void Logger::log(LogLevel level, LogCategory category, const std::string& message,
                  const char* file, int line, const char* func) {
     if (level < minLogLevel_) {
         return;
     }
-    
-    std::string timestamp = getCurrentTime();
+
+    if (asyncEnabled_.load(std::memory_order_acquire)) {
+        // Source location is deliberately not carried through the ring: the
+        // records stay fixed-size and DEBUG/TRACE call sites that need it
+        // are compiled out of release builds anyway
+        if (!tryEnqueue(level, category, message)) {
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    writeEntry(level, category, message, std::chrono::system_clock::now(), file, line, func);
+}
+
+void Logger::writeEntry(LogLevel level, LogCategory category, const std::string& message,
+                        std::chrono::system_clock::time_point time,
+                        const char* file, int line, const char* func) {
+    std::string timestamp = formatTime(time);
     std::string levelStr = levelToString(level);
     std::string categoryStr = categoryToString(category);
-    
+
     // Extract just the filename from the full path (file may be null when
     // no source location was provided)
     std::string filename = (file != nullptr) ? file : "";
@@ -56,19 +182,19 @@ void Logger::log(LogLevel level, LogCategory category, const std::string& messag
     if (lastSlash != std::string::npos) {
         filename = filename.substr(lastSlash + 1);
     }
-    
+
     std::ostringstream logEntry;
     logEntry << "[" << timestamp << "] "
              << "[" << levelStr << "] "
              << "[" << categoryStr << "] "
              << message;
-    
+
     // Add file/line info for DEBUG and TRACE levels when a location was provided
     if (level <= LogLevel::DEBUG && file != nullptr) {
         logEntry << " (" << filename << ":" << line << " in "
                  << ((func != nullptr) ? func : "?") << ")";
     }
-    
+
     // Output to console with color coding
     std::string colorCode;
     switch (level) {
@@ -79,9 +205,9 @@ void Logger::log(LogLevel level, LogCategory category, const std::string& messag
         case LogLevel::ERROR: colorCode = "\033[31m"; break;    // Red
         case LogLevel::CRITICAL: colorCode = "\033[91m"; break; // Bright red
     }
-    
+
     std::cout << colorCode << logEntry.str() << "\033[0m" << std::endl;
-    
+
     // Output to file if enabled
     if (fileLoggingEnabled_ && logFile_.is_open()) {
         logFile_ << logEntry.str() << std::endl;
@@ -89,12 +215,11 @@ void Logger::log(LogLevel level, LogCategory category, const std::string& messag
     }
 }
 
-std::string Logger::getCurrentTime() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
+std::string Logger::formatTime(std::chrono::system_clock::time_point time) {
+    auto time_t = std::chrono::system_clock::to_time_t(time);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-        now.time_since_epoch()) % 1000;
-    
+        time.time_since_epoch()) % 1000;
+
     std::ostringstream oss;
     oss << std::put_time(std::localtime(&time_t), "%H:%M:%S");
     oss << "." << std::setfill('0') << std::setw(3) << ms.count();
@@ -127,4 +252,4 @@ std::string Logger::categoryToString(LogCategory category) {
     }
 }
 
-} // namespace vkeng
\ No newline at end of file
+} // namespace vkeng
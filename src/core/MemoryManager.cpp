@@ -1,7 +1,10 @@
 #include "vulkan-engine/core/MemoryManager.hpp"
 #include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/StagingRing.hpp"
 #include "vulkan-engine/core/VulkanDevice.hpp"
 #include "vulkan-engine/rendering/CommandPool.hpp"
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <iomanip>
 #include <functional>
@@ -63,7 +66,12 @@ namespace vkeng {
         LOG_DEBUG(MEMORY, "Memory Types: {}", memProps.memoryTypeCount);
         
         auto memoryManager = std::shared_ptr<MemoryManager>(new MemoryManager(device, allocator));
-        
+
+        // Per-frame uniform regions must start on this boundary
+        VkPhysicalDeviceProperties deviceProps;
+        vkGetPhysicalDeviceProperties(physicalDevice, &deviceProps);
+        memoryManager->m_uboAlignment = deviceProps.limits.minUniformBufferOffsetAlignment;
+
         return Result<std::shared_ptr<MemoryManager>>(memoryManager);
     }
 
@@ -82,6 +90,49 @@ namespace vkeng {
      * @brief Destructor that cleans up the VMA allocator.
      */
     MemoryManager::~MemoryManager() noexcept {
+        // Let outstanding async transfers finish and release their resources.
+        for (auto& transfer : m_asyncInFlight) {
+            if (transfer.acquireValue != 0) {
+                m_asyncTimeline->wait(transfer.acquireValue);
+            } else {
+                vkWaitForFences(m_device, 1, &transfer.transferFence, VK_TRUE, UINT64_MAX);
+                vkWaitForFences(m_device, 1, &transfer.acquireFence, VK_TRUE, UINT64_MAX);
+            }
+        }
+        pollAsyncTransfers();
+
+        // Drain and destroy the staging ring before the allocator goes away:
+        // its backing buffer must be released while the allocator is valid.
+        for (auto& slot : m_transferSlots) {
+            if (slot.submitted) {
+                if (m_transferTimeline) {
+                    m_transferTimeline->wait(slot.timelineValue);
+                } else if (slot.fence != VK_NULL_HANDLE) {
+                    vkWaitForFences(m_device, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+                }
+            }
+            if (slot.fence != VK_NULL_HANDLE) {
+                vkDestroyFence(m_device, slot.fence, nullptr);
+                slot.fence = VK_NULL_HANDLE;
+            }
+        }
+        m_stagingRing.reset();
+
+        // Close out an interrupted defragmentation: retire the open pass and
+        // free the old buffers before the allocator is destroyed.
+        if (m_defrag.context != VK_NULL_HANDLE) {
+            if (m_defrag.passOpen) {
+                vmaEndDefragmentationPass(m_allocator, m_defrag.context, &m_defrag.passInfo);
+                for (VkBuffer oldBuffer : m_defrag.retiredBuffers) {
+                    vkDestroyBuffer(m_device, oldBuffer, nullptr);
+                }
+                m_defrag.retiredBuffers.clear();
+                m_defrag.movedBuffers.clear();
+            }
+            vmaEndDefragmentation(m_allocator, m_defrag.context, nullptr);
+            m_defrag.context = VK_NULL_HANDLE;
+        }
+
         if (m_allocator != VK_NULL_HANDLE) {
             LOG_DEBUG(MEMORY, "Destroying VMA allocator...");
             
@@ -150,10 +201,45 @@ namespace vkeng {
         createInfo.usage = BufferUsage::Uniform;
         createInfo.hostVisible = true;
         createInfo.debugName = "UniformBuffer_" + std::to_string(size);
-        
+
         return createBuffer(createInfo);
     }
 
+    /**
+     * @brief Creates one persistently-mapped uniform buffer with per-frame regions.
+     * @details Regions are spaced by minUniformBufferOffsetAlignment so each
+     * frame's descriptor can bind its region directly by offset.
+     */
+    Result<PerFrameUniformBuffer> MemoryManager::createPerFrameUniformBuffer(
+            VkDeviceSize perFrameSize, uint32_t frameCount) {
+        if (perFrameSize == 0 || frameCount == 0) {
+            return Result<PerFrameUniformBuffer>(
+                Error("Per-frame uniform buffer needs a non-zero size and frame count"));
+        }
+
+        const VkDeviceSize alignment = (m_uboAlignment > 0) ? m_uboAlignment : 1;
+        const VkDeviceSize stride = (perFrameSize + alignment - 1) & ~(alignment - 1);
+
+        BufferCreateInfo createInfo;
+        createInfo.size = stride * frameCount;
+        createInfo.usage = BufferUsage::Uniform;
+        createInfo.hostVisible = true;
+        createInfo.debugName = "PerFrameUniformBuffer_" + std::to_string(perFrameSize) +
+                               "x" + std::to_string(frameCount);
+
+        auto bufferResult = createBuffer(createInfo);
+        if (!bufferResult) {
+            return Result<PerFrameUniformBuffer>(bufferResult.getError());
+        }
+
+        PerFrameUniformBuffer perFrame;
+        perFrame.buffer = bufferResult.getValue();
+        perFrame.stride = stride;
+        perFrame.elementSize = perFrameSize;
+        perFrame.frameCount = frameCount;
+        return Result<PerFrameUniformBuffer>(perFrame);
+    }
+
     /**
      * @brief Convenience method for creating a staging buffer.
      * @details Staging buffers are always host-visible and used for transferring data.
@@ -188,13 +274,15 @@ namespace vkeng {
         uint32_t width, uint32_t height,
         VkFormat format,
         VkImageUsageFlags usage,
-        bool hostVisible) {
-        
-        auto image = Image::create(m_device, m_allocator, width, height, format, usage, hostVisible);
-        
+        bool hostVisible,
+        uint32_t mipLevels,
+        uint32_t arrayLayers) {
+
+        auto image = Image::create(m_device, m_allocator, width, height, format, usage, hostVisible, mipLevels, arrayLayers);
+
         if (image) {
             // A rough estimate for image size, as actual size depends on format and tiling.
-            VkDeviceSize imageSize = width * height * 4;
+            VkDeviceSize imageSize = width * height * 4 * arrayLayers;
             updateStats(imageSize, true, false);
             
             if (m_debugMode) {
@@ -231,8 +319,10 @@ namespace vkeng {
     Result<std::shared_ptr<Image>> MemoryManager::createDepthBuffer(
         uint32_t width, uint32_t height, VkFormat format) {
         
+        // SAMPLED allows the depth buffer to feed the occlusion-culling depth
+        // pyramid after the main pass.
         return createImage(width, height, format,
-                        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+                        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
     }
 
     /**
@@ -244,6 +334,9 @@ namespace vkeng {
 
     /**
      * @brief Initializes a dedicated command pool for memory transfer operations.
+     * @details Also sets up the transfer timeline, the persistent staging ring
+     * and its reusable transfer slots. Ring setup failures are non-fatal:
+     * uploads fall back to the one-shot staging buffer path.
      */
     void MemoryManager::initializeForTransfers(VulkanDevice& device) {
         m_deviceRef = &device;
@@ -251,7 +344,570 @@ namespace vkeng {
             device.getDevice(),
             device.getGraphicsFamily()
         );
-        LOG_INFO(MEMORY, "MemoryManager transfer system initialized.");
+
+        // Transfer timeline: slot submissions signal increasing values, so
+        // slot reuse and ring retirement track exact GPU progress with no
+        // fence resets. Creation failure just means the fence fallback.
+        if (device.supportsTimelineSemaphores()) {
+            auto timelineResult = TimelineSemaphore::create(m_device);
+            if (timelineResult.isSuccess()) {
+                m_transferTimeline = timelineResult.getValue();
+            } else {
+                LOG_WARN(MEMORY, "Failed to create transfer timeline semaphore, using fences: {}",
+                         timelineResult.getError().message);
+            }
+        }
+
+        // Persistent staging ring: one pre-mapped buffer all uploads
+        // sub-allocate from, instead of a fresh staging buffer per upload.
+        auto ringBufferResult = createStagingBuffer(STAGING_RING_SIZE);
+        if (ringBufferResult) {
+            auto ringBuffer = ringBufferResult.getValue();
+            auto mapResult = ringBuffer->map();
+            if (mapResult) {
+                m_stagingRing = std::make_unique<StagingRing>(
+                    m_device, ringBuffer, mapResult.getValue(),
+                    m_transferTimeline ? m_transferTimeline->getHandle() : VK_NULL_HANDLE);
+            } else {
+                LOG_WARN(MEMORY, "Failed to map staging ring buffer, falling back to per-upload staging: {}",
+                         mapResult.getError().message);
+            }
+        } else {
+            LOG_WARN(MEMORY, "Failed to create staging ring buffer, falling back to per-upload staging: {}",
+                     ringBufferResult.getError().message);
+        }
+
+        // Reusable transfer command buffers for non-blocking submits; slot
+        // reuse is guarded by timeline values, or fences on the fallback path.
+        if (m_stagingRing) {
+            auto buffersResult = m_transferCommandPool->allocateCommandBuffers(TRANSFER_SLOT_COUNT);
+            if (buffersResult) {
+                auto buffers = buffersResult.getValue();
+                bool slotsOk = true;
+                for (uint32_t i = 0; i < TRANSFER_SLOT_COUNT; ++i) {
+                    m_transferSlots[i].commandBuffer = buffers[i];
+                    if (m_transferTimeline) {
+                        continue; // Timeline values guard reuse, no fence needed
+                    }
+
+                    VkFenceCreateInfo fenceInfo{};
+                    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+                    if (vkCreateFence(m_device, &fenceInfo, nullptr, &m_transferSlots[i].fence) != VK_SUCCESS) {
+                        slotsOk = false;
+                        break;
+                    }
+                }
+                if (!slotsOk) {
+                    LOG_WARN(MEMORY, "Failed to create transfer slot fences, disabling staging ring");
+                    for (auto& slot : m_transferSlots) {
+                        if (slot.fence != VK_NULL_HANDLE) {
+                            vkDestroyFence(m_device, slot.fence, nullptr);
+                            slot.fence = VK_NULL_HANDLE;
+                        }
+                    }
+                    m_stagingRing.reset();
+                }
+            } else {
+                LOG_WARN(MEMORY, "Failed to allocate transfer slot command buffers, disabling staging ring");
+                m_stagingRing.reset();
+            }
+        }
+
+        // Command pool on the dedicated transfer family for async uploads.
+        if (device.hasDedicatedTransferQueue()) {
+            m_asyncCommandPool = std::make_unique<CommandPool>(
+                device.getDevice(),
+                device.getTransferFamily()
+            );
+            // One timeline spans both queues: release on transfer, acquire
+            // on graphics, completion polling on the host — replacing the
+            // per-transfer semaphore + fence pair of the fallback path.
+            if (device.supportsTimelineSemaphores()) {
+                auto timelineResult = TimelineSemaphore::create(m_device);
+                if (timelineResult.isSuccess()) {
+                    m_asyncTimeline = timelineResult.getValue();
+                } else {
+                    LOG_WARN(MEMORY, "Failed to create async transfer timeline, using fences: {}",
+                             timelineResult.getError().message);
+                }
+            }
+            LOG_INFO(MEMORY, "Async transfers enabled on dedicated transfer family {}",
+                     device.getTransferFamily());
+        }
+
+        LOG_INFO(MEMORY, "MemoryManager transfer system initialized{}.",
+                 m_stagingRing ? " with staging ring" : "");
+    }
+
+    /**
+     * @brief Uploads to a device-local buffer on the dedicated transfer queue.
+     * @details Records the copy plus a queue-family release barrier on the
+     * transfer queue, then submits the matching acquire barrier to the
+     * graphics queue gated by a semaphore. Neither submission is waited on;
+     * pollAsyncTransfers() observes the fences and fires the callback.
+     */
+    Result<void> MemoryManager::uploadToBufferAsync(
+        std::shared_ptr<Buffer> dstBuffer,
+        const void* data,
+        VkDeviceSize size,
+        VkDeviceSize offset,
+        TransferCompleteCallback onComplete) {
+
+        if (!dstBuffer) {
+            return Result<void>(Error("Destination buffer is null"));
+        }
+
+        // Without a dedicated transfer queue there is nothing to overlap
+        // with; do the upload synchronously and report completion now.
+        if (!m_asyncCommandPool) {
+            auto syncResult = uploadToBuffer(dstBuffer, data, size, offset);
+            if (!syncResult) {
+                return syncResult;
+            }
+            if (onComplete) onComplete();
+            return Result<void>();
+        }
+
+        uint32_t transferFamily = m_deviceRef->getTransferFamily();
+        uint32_t graphicsFamily = m_deviceRef->getGraphicsFamily();
+
+        // Dedicated staging buffer per async upload: streaming uploads are
+        // large and long-lived, a poor fit for the frame-oriented staging ring.
+        auto stagingResult = createStagingBufferInternal(size);
+        if (!stagingResult) {
+            return Result<void>(stagingResult.getError());
+        }
+        auto stagingBuffer = stagingResult.getValue();
+        auto copyResult = stagingBuffer->copyData(data, size, 0);
+        if (!copyResult) {
+            return Result<void>(copyResult.getError());
+        }
+
+        AsyncTransfer transfer{};
+        transfer.stagingBuffer = stagingBuffer;
+        transfer.dstBuffer = dstBuffer;
+        transfer.callback = std::move(onComplete);
+
+        // Sync: the async timeline orders release→acquire across queues and
+        // serves CPU completion polling. Fallback path creates one semaphore
+        // for the ordering and one fence per submission for polling.
+        auto destroySyncObjects = [&]() {
+            if (transfer.ownershipSemaphore) vkDestroySemaphore(m_device, transfer.ownershipSemaphore, nullptr);
+            if (transfer.transferFence) vkDestroyFence(m_device, transfer.transferFence, nullptr);
+            if (transfer.acquireFence) vkDestroyFence(m_device, transfer.acquireFence, nullptr);
+        };
+
+        if (m_asyncTimeline) {
+            transfer.releaseValue = m_asyncTimeline->reserveValue();
+            transfer.acquireValue = m_asyncTimeline->reserveValue();
+        } else {
+            VkSemaphoreCreateInfo semaphoreInfo{};
+            semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            VkFenceCreateInfo fenceInfo{};
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+            if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &transfer.ownershipSemaphore) != VK_SUCCESS ||
+                vkCreateFence(m_device, &fenceInfo, nullptr, &transfer.transferFence) != VK_SUCCESS ||
+                vkCreateFence(m_device, &fenceInfo, nullptr, &transfer.acquireFence) != VK_SUCCESS) {
+                destroySyncObjects();
+                return Result<void>(Error("Failed to create async transfer sync objects"));
+            }
+        }
+
+        // Transfer-queue command buffer: copy, then release ownership.
+        auto transferCmdResult = m_asyncCommandPool->allocateCommandBuffers(1);
+        auto acquireCmdResult = m_transferCommandPool->allocateCommandBuffers(1);
+        if (!transferCmdResult || !acquireCmdResult) {
+            destroySyncObjects();
+            return Result<void>(Error("Failed to allocate async transfer command buffers"));
+        }
+        transfer.transferCmd = transferCmdResult.getValue()[0];
+        transfer.acquireCmd = acquireCmdResult.getValue()[0];
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkBeginCommandBuffer(transfer.transferCmd, &beginInfo);
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = 0;
+        copyRegion.dstOffset = offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(transfer.transferCmd, stagingBuffer->getHandle(),
+                        dstBuffer->getHandle(), 1, &copyRegion);
+
+        // Release the written range to the graphics family.
+        VkBufferMemoryBarrier release{};
+        release.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        release.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        release.dstAccessMask = 0; // Ignored for a release operation
+        release.srcQueueFamilyIndex = transferFamily;
+        release.dstQueueFamilyIndex = graphicsFamily;
+        release.buffer = dstBuffer->getHandle();
+        release.offset = offset;
+        release.size = size;
+        vkCmdPipelineBarrier(transfer.transferCmd,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 1, &release, 0, nullptr);
+
+        vkEndCommandBuffer(transfer.transferCmd);
+
+        // Graphics-queue command buffer: matching acquire barrier.
+        vkBeginCommandBuffer(transfer.acquireCmd, &beginInfo);
+
+        VkBufferMemoryBarrier acquire = release;
+        acquire.srcAccessMask = 0; // Ignored for an acquire operation
+        acquire.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                                VK_ACCESS_INDEX_READ_BIT |
+                                VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(transfer.acquireCmd,
+                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                             VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 1, &acquire, 0, nullptr);
+
+        vkEndCommandBuffer(transfer.acquireCmd);
+
+        // Submit the copy on the transfer queue, signaling the release value
+        // (or the binary ownership semaphore on the fallback path).
+        VkTimelineSemaphoreSubmitInfo transferTimelineInfo{};
+        VkSemaphore asyncTimelineHandle =
+            m_asyncTimeline ? m_asyncTimeline->getHandle() : VK_NULL_HANDLE;
+        VkSubmitInfo transferSubmit{};
+        transferSubmit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        transferSubmit.commandBufferCount = 1;
+        transferSubmit.pCommandBuffers = &transfer.transferCmd;
+        transferSubmit.signalSemaphoreCount = 1;
+        if (m_asyncTimeline) {
+            transferTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            transferTimelineInfo.signalSemaphoreValueCount = 1;
+            transferTimelineInfo.pSignalSemaphoreValues = &transfer.releaseValue;
+            transferSubmit.pNext = &transferTimelineInfo;
+            transferSubmit.pSignalSemaphores = &asyncTimelineHandle;
+        } else {
+            transferSubmit.pSignalSemaphores = &transfer.ownershipSemaphore;
+        }
+
+        if (vkQueueSubmit(m_deviceRef->getTransferQueue(), 1, &transferSubmit,
+                          transfer.transferFence) != VK_SUCCESS) {
+            destroySyncObjects();
+            return Result<void>(Error("Failed to submit async transfer"));
+        }
+
+        // Submit the acquire on the graphics queue, waiting on the release
+        // value (timelines allow wait-before-signal, so the two submits need
+        // no CPU-side ordering) and signaling the acquire value completion
+        // polling observes. Queue ordering makes the buffer valid for all
+        // later graphics work.
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        VkTimelineSemaphoreSubmitInfo acquireTimelineInfo{};
+        VkSubmitInfo acquireSubmit{};
+        acquireSubmit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        acquireSubmit.waitSemaphoreCount = 1;
+        acquireSubmit.pWaitDstStageMask = &waitStage;
+        acquireSubmit.commandBufferCount = 1;
+        acquireSubmit.pCommandBuffers = &transfer.acquireCmd;
+        if (m_asyncTimeline) {
+            acquireTimelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            acquireTimelineInfo.waitSemaphoreValueCount = 1;
+            acquireTimelineInfo.pWaitSemaphoreValues = &transfer.releaseValue;
+            acquireTimelineInfo.signalSemaphoreValueCount = 1;
+            acquireTimelineInfo.pSignalSemaphoreValues = &transfer.acquireValue;
+            acquireSubmit.pNext = &acquireTimelineInfo;
+            acquireSubmit.pWaitSemaphores = &asyncTimelineHandle;
+            acquireSubmit.signalSemaphoreCount = 1;
+            acquireSubmit.pSignalSemaphores = &asyncTimelineHandle;
+        } else {
+            acquireSubmit.pWaitSemaphores = &transfer.ownershipSemaphore;
+        }
+
+        if (vkQueueSubmit(m_deviceRef->getGraphicsQueue(), 1, &acquireSubmit,
+                          transfer.acquireFence) != VK_SUCCESS) {
+            // The transfer submission is already in flight; let the GPU finish
+            // before tearing its objects down.
+            if (m_asyncTimeline) {
+                m_asyncTimeline->wait(transfer.releaseValue);
+            } else {
+                vkWaitForFences(m_device, 1, &transfer.transferFence, VK_TRUE, UINT64_MAX);
+            }
+            destroySyncObjects();
+            return Result<void>(Error("Failed to submit async transfer acquire"));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_asyncMutex);
+            m_asyncInFlight.push_back(std::move(transfer));
+        }
+        return Result<void>();
+    }
+
+    /**
+     * @brief Fires callbacks for completed async transfers and recycles resources.
+     */
+    void MemoryManager::pollAsyncTransfers() {
+        std::vector<AsyncTransfer> completed;
+        {
+            std::lock_guard<std::mutex> lock(m_asyncMutex);
+            // One counter read covers every timeline-tracked transfer
+            const uint64_t timelineCompleted =
+                m_asyncTimeline ? m_asyncTimeline->getCompletedValue() : 0;
+            for (auto it = m_asyncInFlight.begin(); it != m_asyncInFlight.end();) {
+                const bool done = it->acquireValue != 0
+                    ? timelineCompleted >= it->acquireValue
+                    : vkGetFenceStatus(m_device, it->transferFence) == VK_SUCCESS &&
+                      vkGetFenceStatus(m_device, it->acquireFence) == VK_SUCCESS;
+                if (done) {
+                    completed.push_back(std::move(*it));
+                    it = m_asyncInFlight.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        for (auto& transfer : completed) {
+            vkFreeCommandBuffers(m_device, m_asyncCommandPool->getPool(), 1, &transfer.transferCmd);
+            vkFreeCommandBuffers(m_device, m_transferCommandPool->getPool(), 1, &transfer.acquireCmd);
+            if (transfer.transferFence) vkDestroyFence(m_device, transfer.transferFence, nullptr);
+            if (transfer.acquireFence) vkDestroyFence(m_device, transfer.acquireFence, nullptr);
+            if (transfer.ownershipSemaphore) vkDestroySemaphore(m_device, transfer.ownershipSemaphore, nullptr);
+            if (transfer.callback) {
+                transfer.callback(); // Resource is now visible to the graphics queue
+            }
+        }
+    }
+
+    /**
+     * @brief Begins a batched transfer; uploads record into one command buffer.
+     */
+    void MemoryManager::beginTransferBatch() {
+        m_batchActive = true;
+    }
+
+    /**
+     * @brief Submits all batched transfer commands in one queue submission.
+     */
+    Result<void> MemoryManager::flushTransferBatch() {
+        m_batchActive = false;
+        if (!m_slotRecording) {
+            return Result<void>(); // Nothing was recorded through the ring
+        }
+        return submitTransferSlot();
+    }
+
+    /**
+     * @brief Acquires the current transfer slot, recycling its previous submission.
+     */
+    Result<uint32_t> MemoryManager::acquireTransferSlot() {
+        TransferSlot& slot = m_transferSlots[m_currentSlot];
+
+        if (slot.submitted) {
+            // This slot's previous submission may still be in flight. Waiting
+            // here only stalls if all TRANSFER_SLOT_COUNT submissions are
+            // outstanding at once.
+            if (m_transferTimeline) {
+                auto waitResult = m_transferTimeline->wait(slot.timelineValue);
+                if (!waitResult.isSuccess()) {
+                    return Result<uint32_t>(waitResult.getError());
+                }
+            } else {
+                VkResult waitResult = vkWaitForFences(m_device, 1, &slot.fence, VK_TRUE, UINT64_MAX);
+                if (waitResult != VK_SUCCESS) {
+                    return Result<uint32_t>(Error("Failed to wait for transfer slot fence", waitResult));
+                }
+                vkResetFences(m_device, 1, &slot.fence);
+            }
+            m_stagingRing->retireCompleted();
+            slot.submitted = false;
+        }
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        VkResult beginResult = vkBeginCommandBuffer(slot.commandBuffer, &beginInfo);
+        if (beginResult != VK_SUCCESS) {
+            return Result<uint32_t>(Error("Failed to begin transfer slot command buffer", beginResult));
+        }
+
+        m_slotRecording = true;
+        return Result<uint32_t>(m_currentSlot);
+    }
+
+    /**
+     * @brief Ends and submits the active transfer slot without waiting.
+     * @details Correctness relies on same-queue submission ordering: any later
+     * work submitted to the graphics queue observes these copies. The slot's
+     * timeline value (or fallback fence) guards reuse of both the command
+     * buffer and the ring regions.
+     */
+    Result<void> MemoryManager::submitTransferSlot() {
+        TransferSlot& slot = m_transferSlots[m_currentSlot];
+        m_slotRecording = false;
+
+        VkResult endResult = vkEndCommandBuffer(slot.commandBuffer);
+        if (endResult != VK_SUCCESS) {
+            return Result<void>(Error("Failed to end transfer slot command buffer", endResult));
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &slot.commandBuffer;
+
+        VkTimelineSemaphoreSubmitInfo timelineInfo{};
+        VkSemaphore timelineHandle = VK_NULL_HANDLE;
+        VkFence submitFence = slot.fence;
+        if (m_transferTimeline) {
+            slot.timelineValue = m_transferTimeline->reserveValue();
+            timelineHandle = m_transferTimeline->getHandle();
+            timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineInfo.signalSemaphoreValueCount = 1;
+            timelineInfo.pSignalSemaphoreValues = &slot.timelineValue;
+            submitInfo.pNext = &timelineInfo;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &timelineHandle;
+            submitFence = VK_NULL_HANDLE;
+        }
+
+        VkResult submitResult = vkQueueSubmit(m_deviceRef->getGraphicsQueue(), 1, &submitInfo, submitFence);
+        if (submitResult != VK_SUCCESS) {
+            return Result<void>(Error("Failed to submit transfer slot", submitResult));
+        }
+
+        if (m_transferTimeline) {
+            m_stagingRing->onSubmit(slot.timelineValue);
+        } else {
+            m_stagingRing->onSubmit(slot.fence);
+        }
+        slot.submitted = true;
+        m_currentSlot = (m_currentSlot + 1) % TRANSFER_SLOT_COUNT;
+        return Result<void>();
+    }
+
+    /**
+     * @brief Uploads to a device-local buffer through the staging ring.
+     */
+    Result<void> MemoryManager::ringUploadToBuffer(
+        std::shared_ptr<Buffer> dstBuffer,
+        const void* data,
+        VkDeviceSize size,
+        VkDeviceSize offset) {
+
+        if (!m_stagingRing) {
+            return Result<void>(Error("Staging ring not available"));
+        }
+
+        auto allocResult = m_stagingRing->allocate(size);
+        if (!allocResult) {
+            return Result<void>(allocResult.getError());
+        }
+        auto alloc = allocResult.getValue();
+
+        std::memcpy(alloc.mappedPtr, data, static_cast<size_t>(size));
+
+        if (!m_slotRecording) {
+            auto slotResult = acquireTransferSlot();
+            if (!slotResult) {
+                return Result<void>(slotResult.getError());
+            }
+        }
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = alloc.offset;
+        copyRegion.dstOffset = offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(m_transferSlots[m_currentSlot].commandBuffer,
+                        alloc.buffer, dstBuffer->getHandle(), 1, &copyRegion);
+
+        if (m_batchActive) {
+            return Result<void>(); // Submitted later by flushTransferBatch()
+        }
+        return submitTransferSlot();
+    }
+
+    /**
+     * @brief Uploads to a device-local image through the staging ring.
+     * @details Records the same barrier/copy/barrier sequence as the one-shot
+     * uploadToImage path, but into the active transfer slot so a whole batch
+     * of image uploads flushes as a single queue submission.
+     */
+    Result<void> MemoryManager::ringUploadToImage(
+        std::shared_ptr<Image> dstImage,
+        const void* data,
+        VkDeviceSize size,
+        uint32_t width, uint32_t height) {
+
+        if (!m_stagingRing) {
+            return Result<void>(Error("Staging ring not available"));
+        }
+
+        auto allocResult = m_stagingRing->allocate(size);
+        if (!allocResult) {
+            return Result<void>(allocResult.getError());
+        }
+        auto alloc = allocResult.getValue();
+
+        std::memcpy(alloc.mappedPtr, data, static_cast<size_t>(size));
+
+        if (!m_slotRecording) {
+            auto slotResult = acquireTransferSlot();
+            if (!slotResult) {
+                return Result<void>(slotResult.getError());
+            }
+        }
+        VkCommandBuffer cmd = m_transferSlots[m_currentSlot].commandBuffer;
+
+        // Transition mip 0 to TRANSFER_DST_OPTIMAL (matches uploadToImage;
+        // generateMipmaps owns the remaining levels' transitions)
+        VkImageMemoryBarrier toTransferDst{};
+        toTransferDst.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        toTransferDst.srcAccessMask = 0;
+        toTransferDst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toTransferDst.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        toTransferDst.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        toTransferDst.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransferDst.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransferDst.image = dstImage->getHandle();
+        toTransferDst.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        toTransferDst.subresourceRange.baseMipLevel = 0;
+        toTransferDst.subresourceRange.levelCount = 1;
+        toTransferDst.subresourceRange.baseArrayLayer = 0;
+        toTransferDst.subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &toTransferDst);
+
+        VkBufferImageCopy region{};
+        region.bufferOffset = alloc.offset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {width, height, 1};
+        vkCmdCopyBufferToImage(cmd, alloc.buffer, dstImage->getHandle(),
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        VkImageMemoryBarrier toShaderRead{};
+        toShaderRead.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        toShaderRead.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toShaderRead.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        toShaderRead.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        toShaderRead.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        toShaderRead.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toShaderRead.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toShaderRead.image = dstImage->getHandle();
+        toShaderRead.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        toShaderRead.subresourceRange.levelCount = 1;
+        toShaderRead.subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &toShaderRead);
+
+        if (m_batchActive) {
+            return Result<void>(); // Submitted later by flushTransferBatch()
+        }
+        return submitTransferSlot();
     }
 
     /**
@@ -307,7 +963,17 @@ namespace vkeng {
 
             return Result<void>();
         } else {
-            // For device-local buffers, we must use a staging buffer.
+            // Preferred path: sub-allocate from the persistent staging ring and
+            // submit without waiting (see submitTransferSlot for why that's safe).
+            if (m_stagingRing) {
+                auto ringResult = ringUploadToBuffer(dstBuffer, data, size, offset);
+                if (ringResult) {
+                    return ringResult;
+                }
+                // Ring full or upload oversized: fall through to one-shot staging.
+            }
+
+            // Fallback: one-shot staging buffer with a synchronous transfer.
             auto stagingBufferResult = createStagingBufferInternal(size);
             if (!stagingBufferResult) {
                 return Result<void>(stagingBufferResult.getError());
@@ -349,6 +1015,17 @@ namespace vkeng {
         VkDeviceSize size,
         uint32_t width, uint32_t height) {
 
+        // During a transfer batch, prefer the staging ring: the copy and
+        // both layout transitions join the batch's single submission. Ring
+        // exhaustion (images larger than the ring) falls through to the
+        // fenced one-shot path below.
+        if (m_batchActive && m_stagingRing) {
+            auto ringResult = ringUploadToImage(dstImage, data, size, width, height);
+            if (ringResult) {
+                return ringResult;
+            }
+        }
+
         // 1. Create staging buffer and copy data to it
         auto stagingBufferResult = createStagingBuffer(size);
         if (!stagingBufferResult) {
@@ -410,6 +1087,328 @@ namespace vkeng {
         });
     }
 
+    /**
+     * @brief Uploads data into a sub-rectangle of an image.
+     * @details Same staging scheme as uploadToImage, but the copy targets
+     * an offset region and — after the first upload — the inbound barrier
+     * transitions from SHADER_READ_ONLY_OPTIMAL instead of UNDEFINED so the
+     * rest of the image (other atlas regions) is preserved.
+     */
+    Result<void> MemoryManager::uploadToImageRegion(
+        std::shared_ptr<Image> dstImage,
+        const void* data,
+        VkDeviceSize size,
+        uint32_t x, uint32_t y,
+        uint32_t width, uint32_t height,
+        bool firstUpload) {
+
+        auto stagingBufferResult = createStagingBuffer(size);
+        if (!stagingBufferResult) {
+            return Result<void>(stagingBufferResult.getError());
+        }
+        auto stagingBuffer = stagingBufferResult.getValue();
+        auto copyResult = stagingBuffer->copyData(data, size);
+        if (!copyResult) {
+            return copyResult;
+        }
+
+        return executeTransfer([=](VkCommandBuffer cmd) {
+            // Transition to TRANSFER_DST_OPTIMAL. UNDEFINED as the old
+            // layout is only legal on the first upload; it lets the driver
+            // discard contents, which would wipe previously packed regions.
+            VkImageMemoryBarrier toTransferDst = {};
+            toTransferDst.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            toTransferDst.srcAccessMask = firstUpload ? 0 : VK_ACCESS_SHADER_READ_BIT;
+            toTransferDst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toTransferDst.oldLayout = firstUpload ? VK_IMAGE_LAYOUT_UNDEFINED
+                                                  : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            toTransferDst.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            toTransferDst.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toTransferDst.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toTransferDst.image = dstImage->getHandle();
+            toTransferDst.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            toTransferDst.subresourceRange.baseMipLevel = 0;
+            toTransferDst.subresourceRange.levelCount = 1;
+            toTransferDst.subresourceRange.baseArrayLayer = 0;
+            toTransferDst.subresourceRange.layerCount = 1;
+
+            VkPipelineStageFlags srcStage = firstUpload ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT
+                                                        : VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            vkCmdPipelineBarrier(cmd, srcStage, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toTransferDst);
+
+            // Copy into the destination rectangle
+            VkBufferImageCopy region{};
+            region.bufferOffset = 0;
+            region.bufferRowLength = 0;
+            region.bufferImageHeight = 0;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {static_cast<int32_t>(x), static_cast<int32_t>(y), 0};
+            region.imageExtent = {width, height, 1};
+
+            vkCmdCopyBufferToImage(cmd, stagingBuffer->getHandle(), dstImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+            // Transition back to SHADER_READ_ONLY_OPTIMAL
+            VkImageMemoryBarrier toShaderRead = {};
+            toShaderRead.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            toShaderRead.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toShaderRead.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            toShaderRead.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            toShaderRead.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            toShaderRead.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toShaderRead.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toShaderRead.image = dstImage->getHandle();
+            toShaderRead.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            toShaderRead.subresourceRange.levelCount = 1;
+            toShaderRead.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toShaderRead);
+        });
+    }
+
+    /**
+     * @brief Uploads a full pre-generated mip chain in one transfer.
+     * @details Same staging scheme as uploadToImage, but the copy records one
+     * VkBufferImageCopy per level and both layout barriers span the whole
+     * mip chain, so the GPU sees a single transition in and out.
+     */
+    Result<void> MemoryManager::uploadToImageMips(
+        std::shared_ptr<Image> dstImage,
+        const void* data,
+        VkDeviceSize size,
+        const std::vector<MipUploadRegion>& regions) {
+
+        if (regions.empty()) {
+            return Result<void>(Error("No mip regions to upload"));
+        }
+
+        auto stagingBufferResult = createStagingBuffer(size);
+        if (!stagingBufferResult) {
+            return Result<void>(stagingBufferResult.getError());
+        }
+        auto stagingBuffer = stagingBufferResult.getValue();
+        auto copyResult = stagingBuffer->copyData(data, size);
+        if (!copyResult) {
+            return copyResult;
+        }
+
+        const uint32_t mipLevels = dstImage->getMipLevels();
+        return executeTransfer([=](VkCommandBuffer cmd) {
+            VkImageMemoryBarrier toTransferDst = {};
+            toTransferDst.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            toTransferDst.srcAccessMask = 0;
+            toTransferDst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toTransferDst.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            toTransferDst.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            toTransferDst.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toTransferDst.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toTransferDst.image = dstImage->getHandle();
+            toTransferDst.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            toTransferDst.subresourceRange.baseMipLevel = 0;
+            toTransferDst.subresourceRange.levelCount = mipLevels;
+            toTransferDst.subresourceRange.baseArrayLayer = 0;
+            toTransferDst.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toTransferDst);
+
+            std::vector<VkBufferImageCopy> copies;
+            copies.reserve(regions.size());
+            for (const auto& mip : regions) {
+                VkBufferImageCopy region{};
+                region.bufferOffset = mip.bufferOffset;
+                region.bufferRowLength = 0;
+                region.bufferImageHeight = 0;
+                region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                region.imageSubresource.mipLevel = mip.mipLevel;
+                region.imageSubresource.layerCount = 1;
+                region.imageOffset = {0, 0, 0};
+                region.imageExtent = {mip.width, mip.height, 1};
+                copies.push_back(region);
+            }
+
+            vkCmdCopyBufferToImage(cmd, stagingBuffer->getHandle(), dstImage->getHandle(),
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                   static_cast<uint32_t>(copies.size()), copies.data());
+
+            VkImageMemoryBarrier toShaderRead = {};
+            toShaderRead.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            toShaderRead.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            toShaderRead.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            toShaderRead.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            toShaderRead.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            toShaderRead.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toShaderRead.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            toShaderRead.image = dstImage->getHandle();
+            toShaderRead.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            toShaderRead.subresourceRange.levelCount = mipLevels;
+            toShaderRead.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toShaderRead);
+        });
+    }
+
+    namespace {
+        /**
+         * @brief Records a single-level layout transition barrier.
+         */
+        void recordMipBarrier(VkCommandBuffer cmd, VkImage image, uint32_t baseLevel,
+                              uint32_t levelCount,
+                              VkImageLayout oldLayout, VkImageLayout newLayout,
+                              VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+                              VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) {
+            VkImageMemoryBarrier barrier = {};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask = srcAccess;
+            barrier.dstAccessMask = dstAccess;
+            barrier.oldLayout = oldLayout;
+            barrier.newLayout = newLayout;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image;
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.baseMipLevel = baseLevel;
+            barrier.subresourceRange.levelCount = levelCount;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        }
+    }
+
+    /**
+     * @brief Generates a full mip chain by blitting each level from the previous.
+     */
+    Result<void> MemoryManager::generateMipmaps(std::shared_ptr<Image> image) {
+        const uint32_t mipLevels = image->getMipLevels();
+        if (mipLevels <= 1) {
+            return Result<void>();
+        }
+
+        return executeTransfer([=](VkCommandBuffer cmd) {
+            const VkImage handle = image->getHandle();
+
+            // Level 0 arrives in SHADER_READ_ONLY from uploadToImage
+            recordMipBarrier(cmd, handle, 0, 1,
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                             VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+            int32_t mipWidth = static_cast<int32_t>(image->getWidth());
+            int32_t mipHeight = static_cast<int32_t>(image->getHeight());
+
+            for (uint32_t level = 1; level < mipLevels; ++level) {
+                recordMipBarrier(cmd, handle, level, 1,
+                                 VK_IMAGE_LAYOUT_UNDEFINED,
+                                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                VkImageBlit blit{};
+                blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                blit.srcSubresource.mipLevel = level - 1;
+                blit.srcSubresource.layerCount = 1;
+                blit.srcOffsets[1] = {mipWidth, mipHeight, 1};
+                blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                blit.dstSubresource.mipLevel = level;
+                blit.dstSubresource.layerCount = 1;
+                blit.dstOffsets[1] = {std::max(mipWidth / 2, 1), std::max(mipHeight / 2, 1), 1};
+
+                vkCmdBlitImage(cmd, handle, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                               handle, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               1, &blit, VK_FILTER_LINEAR);
+
+                // This level becomes the blit source for the next one
+                recordMipBarrier(cmd, handle, level, 1,
+                                 VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                 VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                mipWidth = std::max(mipWidth / 2, 1);
+                mipHeight = std::max(mipHeight / 2, 1);
+            }
+
+            recordMipBarrier(cmd, handle, 0, mipLevels,
+                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                             VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        });
+    }
+
+    /**
+     * @brief Copies the tail of a mip chain into a new, smaller image.
+     */
+    Result<std::shared_ptr<Image>> MemoryManager::createMipTailImage(
+        std::shared_ptr<Image> srcImage,
+        uint32_t baseLevel) {
+
+        const uint32_t srcMips = srcImage->getMipLevels();
+        if (baseLevel == 0 || baseLevel >= srcMips) {
+            return Result<std::shared_ptr<Image>>(Error("Invalid mip tail base level"));
+        }
+
+        const uint32_t tailWidth = std::max(1u, srcImage->getWidth() >> baseLevel);
+        const uint32_t tailHeight = std::max(1u, srcImage->getHeight() >> baseLevel);
+        const uint32_t tailMips = srcMips - baseLevel;
+
+        auto tailResult = createImage(
+            tailWidth, tailHeight, srcImage->getFormat(),
+            VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                VK_IMAGE_USAGE_SAMPLED_BIT,
+            false, tailMips);
+        if (!tailResult) {
+            return tailResult;
+        }
+        auto tailImage = tailResult.getValue();
+
+        auto transferResult = executeTransfer([=](VkCommandBuffer cmd) {
+            recordMipBarrier(cmd, srcImage->getHandle(), baseLevel, tailMips,
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                             VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            recordMipBarrier(cmd, tailImage->getHandle(), 0, tailMips,
+                             VK_IMAGE_LAYOUT_UNDEFINED,
+                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                             0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+            for (uint32_t level = 0; level < tailMips; ++level) {
+                VkImageCopy copy{};
+                copy.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                copy.srcSubresource.mipLevel = baseLevel + level;
+                copy.srcSubresource.layerCount = 1;
+                copy.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                copy.dstSubresource.mipLevel = level;
+                copy.dstSubresource.layerCount = 1;
+                copy.extent = {std::max(1u, tailWidth >> level),
+                               std::max(1u, tailHeight >> level), 1};
+
+                vkCmdCopyImage(cmd, srcImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                               tailImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               1, &copy);
+            }
+
+            recordMipBarrier(cmd, srcImage->getHandle(), baseLevel, tailMips,
+                             VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                             VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+            recordMipBarrier(cmd, tailImage->getHandle(), 0, tailMips,
+                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                             VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        });
+
+        if (!transferResult) {
+            return Result<std::shared_ptr<Image>>(transferResult.getError());
+        }
+        return Result<std::shared_ptr<Image>>(tailImage);
+    }
+
     /**
      * @brief Internal method to update memory usage statistics.
      */
@@ -419,12 +1418,228 @@ namespace vkeng {
         if (isAllocation) {
             m_stats.totalAllocated += size;
             m_stats.allocationCount++;
-            if (isBuffer) m_stats.bufferCount++; else m_stats.imageCount++;
+            if (isBuffer) {
+                m_stats.bufferCount++;
+                m_stats.bufferBytes += size;
+            } else {
+                m_stats.imageCount++;
+                m_stats.imageBytes += size;
+            }
         } else {
             m_stats.totalAllocated -= size;
             m_stats.allocationCount--;
-            if (isBuffer) m_stats.bufferCount--; else m_stats.imageCount--;
+            if (isBuffer) {
+                m_stats.bufferCount--;
+                m_stats.bufferBytes -= size;
+            } else {
+                m_stats.imageCount--;
+                m_stats.imageBytes -= size;
+            }
+        }
+    }
+
+    // ================================================================
+    // Defragmentation Service
+    // ================================================================
+
+    /**
+     * @brief Registers a buffer as a defragmentation move candidate.
+     */
+    void MemoryManager::markRelocatable(const std::shared_ptr<Buffer>& buffer) {
+        if (!buffer) {
+            return;
         }
+        std::lock_guard<std::mutex> lock(m_relocatableMutex);
+        m_relocatable[buffer->m_allocation] = buffer;
+    }
+
+    /**
+     * @brief Recomputes the fragmentation fields of the tracked statistics.
+     */
+    void MemoryManager::refreshFragmentationStats() {
+        VmaTotalStatistics vmaStats;
+        vmaCalculateStatistics(m_allocator, &vmaStats);
+        const VmaDetailedStatistics& total = vmaStats.total;
+
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        m_stats.unusedBytes = total.statistics.blockBytes - total.statistics.allocationBytes;
+        m_stats.largestFreeRange = total.unusedRangeSizeMax;
+        // 0 when all free space is one contiguous range, approaching 1 as
+        // it shatters into ranges too small to satisfy large allocations
+        m_stats.fragmentation = (m_stats.unusedBytes > 0)
+            ? 1.0f - static_cast<float>(total.unusedRangeSizeMax) / static_cast<float>(m_stats.unusedBytes)
+            : 0.0f;
+    }
+
+    /**
+     * @brief Runs one incremental defragmentation step.
+     */
+    Result<uint32_t> MemoryManager::defragmentStep(uint32_t maxMoves, VkDeviceSize maxBytes) {
+        // Retirement phase: a pass's copies are done, but command buffers
+        // submitted before the swap may still read the old locations. Count
+        // down steps (one per frame) before letting VMA free the sources.
+        if (m_defrag.passOpen) {
+            if (m_defrag.framesUntilRetire > 0) {
+                m_defrag.framesUntilRetire--;
+                return Result<uint32_t>(0u);
+            }
+
+            VkResult passResult = vmaEndDefragmentationPass(m_allocator, m_defrag.context, &m_defrag.passInfo);
+            for (VkBuffer oldBuffer : m_defrag.retiredBuffers) {
+                vkDestroyBuffer(m_device, oldBuffer, nullptr);
+            }
+            m_defrag.retiredBuffers.clear();
+            m_defrag.movedBuffers.clear();
+            m_defrag.passOpen = false;
+
+            if (passResult == VK_SUCCESS) {
+                // Nothing left to move — close out the whole defragmentation
+                VmaDefragmentationStats defragStats{};
+                vmaEndDefragmentation(m_allocator, m_defrag.context, &defragStats);
+                m_defrag.context = VK_NULL_HANDLE;
+                {
+                    std::lock_guard<std::mutex> lock(m_statsMutex);
+                    m_stats.defragMoves += defragStats.allocationsMoved;
+                    m_stats.defragMovedBytes += defragStats.bytesMoved;
+                }
+                refreshFragmentationStats();
+            }
+            return Result<uint32_t>(0u);
+        }
+
+        if (m_defrag.context == VK_NULL_HANDLE) {
+            refreshFragmentationStats();
+
+            VmaDefragmentationInfo info{};
+            info.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+            info.maxAllocationsPerPass = maxMoves;
+            info.maxBytesPerPass = maxBytes;
+            VkResult result = vmaBeginDefragmentation(m_allocator, &info, &m_defrag.context);
+            if (result != VK_SUCCESS) {
+                return Result<uint32_t>(Error("Failed to begin defragmentation", result));
+            }
+        }
+
+        VkResult result = vmaBeginDefragmentationPass(m_allocator, m_defrag.context, &m_defrag.passInfo);
+        if (result == VK_SUCCESS) {
+            // Heaps are already as compact as the algorithm can make them
+            VmaDefragmentationStats defragStats{};
+            vmaEndDefragmentation(m_allocator, m_defrag.context, &defragStats);
+            m_defrag.context = VK_NULL_HANDLE;
+            {
+                std::lock_guard<std::mutex> lock(m_statsMutex);
+                m_stats.defragMoves += defragStats.allocationsMoved;
+                m_stats.defragMovedBytes += defragStats.bytesMoved;
+            }
+            refreshFragmentationStats();
+            return Result<uint32_t>(0u);
+        }
+
+        // VK_INCOMPLETE: VMA proposed moves. Accept only registered buffers;
+        // everything else (images, unregistered buffers) is ignored so its
+        // handles can never go stale.
+        struct PendingCopy {
+            VkBuffer src = VK_NULL_HANDLE;
+            VkBuffer dst = VK_NULL_HANDLE;
+            VkDeviceSize size = 0;
+        };
+        std::vector<PendingCopy> gpuCopies;
+        uint32_t accepted = 0;
+
+        for (uint32_t i = 0; i < m_defrag.passInfo.moveCount; ++i) {
+            VmaDefragmentationMove& move = m_defrag.passInfo.pMoves[i];
+
+            std::shared_ptr<Buffer> owner;
+            {
+                std::lock_guard<std::mutex> lock(m_relocatableMutex);
+                auto it = m_relocatable.find(move.srcAllocation);
+                if (it != m_relocatable.end()) {
+                    owner = it->second.lock();
+                    if (!owner) {
+                        m_relocatable.erase(it);
+                    }
+                }
+            }
+            if (!owner) {
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                continue;
+            }
+
+            // Replacement buffer bound to the destination memory VMA picked
+            VkBufferCreateInfo bufferInfo{};
+            bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size = owner->m_size;
+            bufferInfo.usage = owner->m_usageFlags;
+            bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+            VkBuffer newBuffer = VK_NULL_HANDLE;
+            if (vkCreateBuffer(m_device, &bufferInfo, nullptr, &newBuffer) != VK_SUCCESS ||
+                vmaBindBufferMemory(m_allocator, move.dstTmpAllocation, newBuffer) != VK_SUCCESS) {
+                if (newBuffer != VK_NULL_HANDLE) {
+                    vkDestroyBuffer(m_device, newBuffer, nullptr);
+                }
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                continue;
+            }
+
+            VmaAllocationInfo dstInfo{};
+            vmaGetAllocationInfo(m_allocator, move.dstTmpAllocation, &dstInfo);
+
+            if (owner->m_mappedData && dstInfo.pMappedData) {
+                // Host-visible: copy on the CPU — no GPU work at all
+                std::memcpy(dstInfo.pMappedData, owner->m_mappedData, static_cast<size_t>(owner->m_size));
+            } else {
+                gpuCopies.push_back({owner->m_buffer, newBuffer, owner->m_size});
+            }
+
+            // Swap in place: every holder of the Buffer records against the
+            // new location from the next frame on. The old handle/memory
+            // stay alive until retirement for frames already submitted.
+            m_defrag.retiredBuffers.push_back(owner->m_buffer);
+            {
+                std::lock_guard<std::mutex> lock(m_relocatableMutex);
+                m_relocatable.erase(move.srcAllocation);
+                m_relocatable[move.dstTmpAllocation] = owner;
+            }
+            owner->m_buffer = newBuffer;
+            owner->m_allocation = move.dstTmpAllocation;
+            owner->m_mappedData = dstInfo.pMappedData;
+            m_defrag.movedBuffers.push_back(std::move(owner));
+            accepted++;
+        }
+
+        if (accepted == 0) {
+            // Every proposed move was unregistered; end the run rather than
+            // re-proposing the same candidates forever
+            vmaEndDefragmentationPass(m_allocator, m_defrag.context, &m_defrag.passInfo);
+            VmaDefragmentationStats defragStats{};
+            vmaEndDefragmentation(m_allocator, m_defrag.context, &defragStats);
+            m_defrag.context = VK_NULL_HANDLE;
+            refreshFragmentationStats();
+            return Result<uint32_t>(0u);
+        }
+
+        // The pass now awaits retirement whatever happens below, so the
+        // bookkeeping stays consistent even if the copy submission fails
+        m_defrag.passOpen = true;
+        m_defrag.framesUntilRetire = DEFRAG_RETIRE_STEPS;
+
+        if (!gpuCopies.empty()) {
+            // Blocking copy: acceptable inside an idle window, and it
+            // guarantees destination contents before any later submission
+            auto copyResult = executeTransfer([&gpuCopies](VkCommandBuffer cmd) {
+                for (const PendingCopy& copy : gpuCopies) {
+                    VkBufferCopy region{0, 0, copy.size};
+                    vkCmdCopyBuffer(cmd, copy.src, copy.dst, 1, &region);
+                }
+            });
+            if (!copyResult) {
+                return Result<uint32_t>(copyResult.getError());
+            }
+        }
+
+        LOG_DEBUG(MEMORY, "Defragmentation step relocated {} buffer(s)", accepted);
+        return Result<uint32_t>(accepted);
     }
 
     /**
@@ -467,8 +1682,8 @@ namespace vkeng {
         LOG_INFO(MEMORY, "Tracked Allocations:");
         LOG_INFO(MEMORY, "  Total Allocated: {}", MemoryUtils::formatMemorySize(stats.totalAllocated));
         LOG_INFO(MEMORY, "  Allocation Count: {}", stats.allocationCount);
-        LOG_INFO(MEMORY, "  Buffer Count: {}", stats.bufferCount);
-        LOG_INFO(MEMORY, "  Image Count: {}", stats.imageCount);
+        LOG_INFO(MEMORY, "  Buffer Count: {} ({})", stats.bufferCount, MemoryUtils::formatMemorySize(stats.bufferBytes));
+        LOG_INFO(MEMORY, "  Image Count: {} ({})", stats.imageCount, MemoryUtils::formatMemorySize(stats.imageBytes));
         
         LOG_INFO(MEMORY, "VMA Statistics:");
         LOG_INFO(MEMORY, "  Total Memory: {}", MemoryUtils::formatMemorySize(detailedStats.total.statistics.blockBytes));
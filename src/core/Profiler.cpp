@@ -0,0 +1,137 @@
+#include "vulkan-engine/core/Profiler.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+namespace vkeng {
+
+    CpuProfiler& CpuProfiler::get() {
+        static CpuProfiler instance;
+        return instance;
+    }
+
+    uint64_t CpuProfiler::nowMicros() {
+        using namespace std::chrono;
+        return static_cast<uint64_t>(
+            duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+    }
+
+    CpuProfiler::ThreadBuffer& CpuProfiler::threadBuffer() {
+        // One registration lock per thread lifetime; the hot path only
+        // dereferences the cached pointer
+        thread_local ThreadBuffer* buffer = [this] {
+            auto owned = std::make_unique<ThreadBuffer>();
+            owned->threadId = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            ThreadBuffer* raw = owned.get();
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            m_buffers.push_back(std::move(owned));
+            return raw;
+        }();
+        return *buffer;
+    }
+
+    void CpuProfiler::record(const char* name, uint64_t startUs, uint64_t endUs) {
+        if (!isRecording()) {
+            return;
+        }
+
+        ThreadBuffer& buffer = threadBuffer();
+        const uint64_t slot = buffer.head.fetch_add(1, std::memory_order_relaxed);
+        Event& event = buffer.events[slot % kEventsPerThread];
+        event.name = name;
+        event.startUs = startUs;
+        event.endUs = endUs;
+    }
+
+    std::vector<CpuProfiler::Sample> CpuProfiler::snapshotRecent(uint64_t sinceUs, size_t maxEvents) {
+        std::vector<Sample> samples;
+
+        {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            for (const auto& buffer : m_buffers) {
+                const uint64_t written = buffer->head.load(std::memory_order_relaxed);
+                const uint64_t count = std::min<uint64_t>(written, kEventsPerThread);
+                // Walk backwards from the newest slot; per-thread events are
+                // time-ordered, so the first one older than the window ends
+                // this thread's contribution
+                for (uint64_t i = 0; i < count; ++i) {
+                    const Event& event = buffer->events[(written - 1 - i) % kEventsPerThread];
+                    if (!event.name) {
+                        continue;
+                    }
+                    if (event.endUs < sinceUs) {
+                        break;
+                    }
+                    samples.push_back({event.name, event.startUs, event.endUs, buffer->threadId});
+                }
+            }
+        }
+
+        std::sort(samples.begin(), samples.end(),
+                  [](const Sample& a, const Sample& b) { return a.startUs < b.startUs; });
+        if (samples.size() > maxEvents) {
+            samples.erase(samples.begin(),
+                          samples.begin() + static_cast<ptrdiff_t>(samples.size() - maxEvents));
+        }
+        return samples;
+    }
+
+    void CpuProfiler::beginCapture() {
+        {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            for (auto& buffer : m_buffers) {
+                buffer->head.store(0, std::memory_order_relaxed);
+            }
+        }
+        m_capturing.store(true, std::memory_order_release);
+        LOG_INFO(GENERAL, "CpuProfiler: capture started");
+    }
+
+    Result<void> CpuProfiler::endCapture(const std::string& path) {
+        m_capturing.store(false, std::memory_order_release);
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            return Result<void>(Error("Failed to open trace file: " + path));
+        }
+
+        // Chrome trace-event format: a JSON array of complete ("X") events
+        // with microsecond timestamps; open it in chrome://tracing/Perfetto
+        file << "[\n";
+        bool first = true;
+
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        size_t eventCount = 0;
+        for (const auto& buffer : m_buffers) {
+            const uint64_t written = buffer->head.load(std::memory_order_relaxed);
+            const uint64_t count = std::min<uint64_t>(written, kEventsPerThread);
+            for (uint64_t i = 0; i < count; ++i) {
+                const Event& event = buffer->events[i];
+                if (!event.name) {
+                    continue;
+                }
+                if (!first) {
+                    file << ",\n";
+                }
+                first = false;
+                file << "{\"name\":\"" << event.name
+                     << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << (buffer->threadId & 0xFFFFFF)
+                     << ",\"ts\":" << event.startUs
+                     << ",\"dur\":" << (event.endUs - event.startUs) << "}";
+                ++eventCount;
+            }
+        }
+        file << "\n]\n";
+
+        if (!file.good()) {
+            return Result<void>(Error("Failed writing trace file: " + path));
+        }
+
+        LOG_INFO(GENERAL, "CpuProfiler: wrote {} events to {}", eventCount, path);
+        return Result<void>();
+    }
+
+} // namespace vkeng
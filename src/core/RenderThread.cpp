@@ -0,0 +1,85 @@
+#include "vulkan-engine/core/RenderThread.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+
+#include <utility>
+
+namespace vkeng {
+
+    RenderThread::RenderThread() {
+        m_thread = std::thread(&RenderThread::threadMain, this);
+        LOG_INFO(RENDERING, "Render thread started");
+    }
+
+    RenderThread::~RenderThread() {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // Let the in-flight item finish, but swallow a stored exception:
+            // throwing from a destructor would terminate during teardown
+            while (m_hasWork) {
+                m_workDone.wait(lock);
+            }
+            if (m_pendingException) {
+                LOG_WARN(RENDERING, "Render thread: discarding exception during shutdown");
+                m_pendingException = nullptr;
+            }
+            m_running = false;
+        }
+        m_workAvailable.notify_one();
+        m_thread.join();
+        LOG_INFO(RENDERING, "Render thread stopped");
+    }
+
+    void RenderThread::submit(std::function<void()> work) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitIdle(lock);
+        m_pending = std::move(work);
+        m_hasWork = true;
+        lock.unlock();
+        m_workAvailable.notify_one();
+    }
+
+    void RenderThread::flush() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        waitIdle(lock);
+    }
+
+    void RenderThread::waitIdle(std::unique_lock<std::mutex>& lock) {
+        PROFILE_SCOPE("RenderThread::waitIdle");
+        while (m_hasWork) {
+            m_workDone.wait(lock);
+        }
+        if (m_pendingException) {
+            std::exception_ptr error = std::exchange(m_pendingException, nullptr);
+            std::rethrow_exception(error);
+        }
+    }
+
+    void RenderThread::threadMain() {
+        for (;;) {
+            std::function<void()> work;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workAvailable.wait(lock, [this] { return m_hasWork || !m_running; });
+                if (!m_running) {
+                    return;
+                }
+                work = std::move(m_pending);
+            }
+
+            try {
+                work();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_pendingException = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_hasWork = false;
+            }
+            m_workDone.notify_all();
+        }
+    }
+
+} // namespace vkeng
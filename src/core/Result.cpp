@@ -11,12 +11,28 @@ namespace vkeng {
      */
     Error::Error(const std::string& msg) : message(msg), vkResult(std::nullopt) {}
 
+    /**
+     * @brief Constructs an Error from a literal message.
+     */
+    Error::Error(const char* msg) : message(msg), vkResult(std::nullopt) {}
+
     /**
      * @brief Constructs an Error with a message and an associated Vulkan result code.
      */
-    Error::Error(const std::string& msg, VkResult result) 
+    Error::Error(const std::string& msg, VkResult result)
         : message(msg), vkResult(result) {
-        
+
+        if (result != VK_SUCCESS) {
+            message += " (VkResult: " + std::to_string(static_cast<int>(result)) + ")";
+        }
+    }
+
+    /**
+     * @brief Constructs an Error from a literal message and a Vulkan result code.
+     */
+    Error::Error(const char* msg, VkResult result)
+        : message(msg), vkResult(result) {
+
         if (result != VK_SUCCESS) {
             message += " (VkResult: " + std::to_string(static_cast<int>(result)) + ")";
         }
@@ -62,12 +78,15 @@ namespace vkeng {
      * @param result The Vulkan result code to check.
      * @param operation A description of the operation that was performed.
      * @return A successful Result<void> or a Result containing an Error.
+     *
+     * Success builds no string: the operation name is only spliced into a
+     * message once the result is known to be a failure.
      */
-    Result<void> checkVkResult(VkResult result, const std::string& operation) {
+    Result<void> checkVkResult(VkResult result, const char* operation) {
         if (result == VK_SUCCESS) {
             return Result<void>();
         } else {
-            return Result<void>(Error("Failed to " + operation, result));
+            return Result<void>(Error(std::string("Failed to ") + operation, result));
         }
     }
 
@@ -80,11 +99,11 @@ namespace vkeng {
      * @return A Result containing the value or an Error.
      */
     template<typename T>
-    Result<T> wrapVkResult(VkResult result, const T& value, const std::string& operation) {
+    Result<T> wrapVkResult(VkResult result, const T& value, const char* operation) {
         if (result == VK_SUCCESS) {
             return Result<T>(value);
         } else {
-            return Result<T>(Error("Failed to " + operation, result));
+            return Result<T>(Error(std::string("Failed to ") + operation, result));
         }
     }
 
@@ -0,0 +1,50 @@
+#include "vulkan-engine/core/StringId.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#ifndef NDEBUG
+#include <mutex>
+#include <unordered_map>
+#endif
+
+namespace vkeng {
+
+#ifndef NDEBUG
+namespace {
+    /// @brief Debug-only hash -> source string registry for id printing
+    /// and collision detection. Release builds carry no strings at all.
+    std::mutex s_registryMutex;
+    std::unordered_map<uint64_t, std::string>& registry() {
+        static std::unordered_map<uint64_t, std::string> instance;
+        return instance;
+    }
+}
+#endif
+
+StringId::StringId(const std::string& str)
+    : m_hash(hash(str.data(), str.length())) {
+#ifndef NDEBUG
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    auto [it, inserted] = registry().emplace(m_hash, str);
+    if (!inserted && it->second != str) {
+        // 64-bit FNV-1a collisions are astronomically unlikely; if one
+        // ever happens we want a name, not silently aliased lookups
+        LOG_WARN(GENERAL, "StringId collision: \"{}\" and \"{}\" share hash {}",
+                 it->second, str, m_hash);
+    }
+#endif
+}
+
+std::string StringId::getDebugString() const {
+#ifndef NDEBUG
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    auto it = registry().find(m_hash);
+    if (it != registry().end()) {
+        return it->second;
+    }
+    return "<unknown>";
+#else
+    return std::to_string(m_hash);
+#endif
+}
+
+} // namespace vkeng
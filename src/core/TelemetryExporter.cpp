@@ -0,0 +1,400 @@
+#include "vulkan-engine/core/TelemetryExporter.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+
+#include <sys/stat.h>
+
+// The scrape endpoint uses BSD sockets; on platforms without them the
+// exporter still aggregates and writes CSV, it just cannot serve HTTP
+#ifndef _WIN32
+#define VKENG_TELEMETRY_HTTP 1
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+namespace vkeng {
+
+    namespace {
+        /// Exporter thread poll period — bounds both scrape latency after a
+        /// connection arrives and shutdown latency
+        constexpr auto POLL_PERIOD = std::chrono::milliseconds(50);
+
+#ifdef VKENG_TELEMETRY_HTTP
+        /// Scrape connections answered per poll iteration; a scraper opens
+        /// one, so this only matters when several fleets probe at once
+        constexpr int MAX_ACCEPTS_PER_POLL = 4;
+#endif
+
+        /** @brief Value of the sorted window at the given fraction (0..1]. */
+        float percentile(float* sorted, uint32_t count, double fraction) {
+            if (count == 0) return 0.0f;
+            uint32_t index = static_cast<uint32_t>(fraction * static_cast<double>(count));
+            if (index >= count) index = count - 1;
+            std::nth_element(sorted, sorted + index, sorted + count);
+            return sorted[index];
+        }
+
+        /** @brief Appends one printf-formatted line to the exposition. */
+        void appendLine(std::string& out, const char* format, ...) {
+            char line[256];
+            va_list args;
+            va_start(args, format);
+            std::vsnprintf(line, sizeof(line), format, args);
+            va_end(args);
+            out += line;
+        }
+    }
+
+    TelemetryExporter::TelemetryExporter(std::shared_ptr<MemoryManager> memoryManager,
+                                         const Config::Telemetry& config)
+        : m_config(config)
+        , m_memoryManager(std::move(memoryManager)) {
+
+        if (m_config.intervalSeconds < 1.0f) {
+            m_config.intervalSeconds = 1.0f;
+        }
+        if (m_config.csvMaxFiles == 0) {
+            m_config.csvMaxFiles = 1;
+        }
+
+        if (m_config.httpPort != 0) {
+#ifdef VKENG_TELEMETRY_HTTP
+            m_listenFd = openListenSocket(m_config.httpPort);
+            if (m_listenFd < 0) {
+                LOG_WARN(GENERAL, "Telemetry: failed to bind port {} ({}); HTTP endpoint disabled",
+                         m_config.httpPort, std::strerror(errno));
+            }
+#else
+            LOG_WARN(GENERAL, "Telemetry: HTTP endpoint not supported on this platform; "
+                              "CSV export still runs");
+#endif
+        }
+
+        m_running = true;
+        m_thread = std::thread(&TelemetryExporter::run, this);
+
+        LOG_INFO(GENERAL, "Telemetry exporter started: interval {} s, port {}, csv {}",
+                 m_config.intervalSeconds,
+                 m_listenFd >= 0 ? std::to_string(m_config.httpPort) : std::string("off"),
+                 m_config.csvPath.empty() ? std::string("off") : m_config.csvPath);
+    }
+
+    TelemetryExporter::~TelemetryExporter() {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_running = false;
+        }
+        m_wake.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+#ifdef VKENG_TELEMETRY_HTTP
+        if (m_listenFd >= 0) {
+            ::close(m_listenFd);
+            m_listenFd = -1;
+        }
+#endif
+        LOG_INFO(GENERAL, "Telemetry exporter stopped after {} snapshot(s)", m_intervalsPublished);
+    }
+
+    void TelemetryExporter::recordFrame(double frameMs, double fixedUpdateMs, double audioMs) {
+        // Sample sources on the frame path: the draw provider reads
+        // renderer counters, and GpuProfiler rebuilds its resolved table
+        // on this thread each frame, so neither may be read from the
+        // exporter thread
+        const DrawStats draws = m_drawStatsProvider ? m_drawStatsProvider() : DrawStats{};
+        const auto& gpuTimings = GpuProfiler::get().getTimings();
+        const auto memory = m_memoryManager->getMemoryStats();
+
+        std::lock_guard<std::mutex> lock(m_sampleMutex);
+        Accumulator& acc = m_accumulator;
+
+        acc.frameMs[acc.frameHead] = static_cast<float>(frameMs);
+        acc.frameHead = (acc.frameHead + 1) % kFrameWindow;
+        acc.frameCount++;
+        acc.frameMsSum += frameMs;
+        acc.fixedUpdateMsSum += fixedUpdateMs;
+        acc.audioMsSum += audioMs;
+        acc.drawCallSum += draws.drawCalls;
+        acc.culledDrawSum += draws.culledDraws;
+        acc.instancedBatchSum += draws.instancedBatches;
+        acc.memory = memory;
+
+        // Accumulate GPU passes into the fixed table by name; names are
+        // copied once into fixed storage, so steady state never allocates
+        for (const auto& pass : gpuTimings) {
+            uint32_t slot = 0;
+            for (; slot < acc.passCount; slot++) {
+                if (std::strncmp(acc.passes[slot].name, pass.name.c_str(),
+                                 kPassNameLength - 1) == 0) {
+                    break;
+                }
+            }
+            if (slot == acc.passCount) {
+                if (acc.passCount == kMaxPasses) {
+                    continue; // table full; surplus passes drop from telemetry
+                }
+                std::strncpy(acc.passes[slot].name, pass.name.c_str(), kPassNameLength - 1);
+                acc.passCount++;
+            }
+            acc.passes[slot].totalMs += pass.milliseconds;
+            acc.passes[slot].samples++;
+        }
+    }
+
+    std::string TelemetryExporter::getExposition() const {
+        std::lock_guard<std::mutex> lock(m_expositionMutex);
+        return m_exposition;
+    }
+
+    // ============================================================================
+    // Exporter thread
+    // ============================================================================
+
+    void TelemetryExporter::run() {
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(m_config.intervalSeconds)));
+        auto nextPublish = std::chrono::steady_clock::now() + interval;
+
+        std::unique_lock<std::mutex> wakeLock(m_wakeMutex);
+        while (m_running) {
+            m_wake.wait_for(wakeLock, POLL_PERIOD);
+            if (!m_running) {
+                break;
+            }
+
+            servePendingConnections();
+
+            if (std::chrono::steady_clock::now() >= nextPublish) {
+                publishInterval();
+                nextPublish += interval;
+            }
+        }
+
+        // Final partial interval so short sessions still leave a CSV trail
+        publishInterval();
+    }
+
+    void TelemetryExporter::publishInterval() {
+        Accumulator snapshot;
+        {
+            std::lock_guard<std::mutex> lock(m_sampleMutex);
+            snapshot = m_accumulator;
+            m_accumulator = Accumulator{};
+        }
+        if (snapshot.frameCount == 0) {
+            return; // paused or minimized; keep serving the last exposition
+        }
+
+        const uint32_t windowCount = static_cast<uint32_t>(
+            std::min<uint64_t>(snapshot.frameCount, kFrameWindow));
+        const double frames = static_cast<double>(snapshot.frameCount);
+
+        float window[kFrameWindow];
+        std::memcpy(window, snapshot.frameMs, windowCount * sizeof(float));
+        const float p50 = percentile(window, windowCount, 0.50);
+        const float p95 = percentile(window, windowCount, 0.95);
+        const float p99 = percentile(window, windowCount, 0.99);
+        const float maxMs = *std::max_element(window, window + windowCount);
+        const double avgMs = snapshot.frameMsSum / frames;
+
+        std::string text;
+        text.reserve(2048);
+        appendLine(text, "# HELP vkeng_frame_time_milliseconds Frame workload time over the last interval\n");
+        appendLine(text, "# TYPE vkeng_frame_time_milliseconds summary\n");
+        appendLine(text, "vkeng_frame_time_milliseconds{quantile=\"0.5\"} %.3f\n", p50);
+        appendLine(text, "vkeng_frame_time_milliseconds{quantile=\"0.95\"} %.3f\n", p95);
+        appendLine(text, "vkeng_frame_time_milliseconds{quantile=\"0.99\"} %.3f\n", p99);
+        appendLine(text, "vkeng_frame_time_milliseconds_sum %.3f\n", snapshot.frameMsSum);
+        appendLine(text, "vkeng_frame_time_milliseconds_count %llu\n",
+                   static_cast<unsigned long long>(snapshot.frameCount));
+        appendLine(text, "# HELP vkeng_frame_time_max_milliseconds Slowest frame in the window\n");
+        appendLine(text, "# TYPE vkeng_frame_time_max_milliseconds gauge\n");
+        appendLine(text, "vkeng_frame_time_max_milliseconds %.3f\n", maxMs);
+
+        appendLine(text, "# HELP vkeng_subsystem_milliseconds Mean per-frame subsystem update time\n");
+        appendLine(text, "# TYPE vkeng_subsystem_milliseconds gauge\n");
+        appendLine(text, "vkeng_subsystem_milliseconds{subsystem=\"fixed_update\"} %.3f\n",
+                   snapshot.fixedUpdateMsSum / frames);
+        appendLine(text, "vkeng_subsystem_milliseconds{subsystem=\"audio\"} %.3f\n",
+                   snapshot.audioMsSum / frames);
+
+        appendLine(text, "# HELP vkeng_draw_calls Mean draws issued per frame\n");
+        appendLine(text, "# TYPE vkeng_draw_calls gauge\n");
+        appendLine(text, "vkeng_draw_calls %.1f\n",
+                   static_cast<double>(snapshot.drawCallSum) / frames);
+        appendLine(text, "# HELP vkeng_culled_draws Mean draws rejected by culling per frame\n");
+        appendLine(text, "# TYPE vkeng_culled_draws gauge\n");
+        appendLine(text, "vkeng_culled_draws %.1f\n",
+                   static_cast<double>(snapshot.culledDrawSum) / frames);
+        appendLine(text, "# HELP vkeng_instanced_batches Mean instanced batches per frame\n");
+        appendLine(text, "# TYPE vkeng_instanced_batches gauge\n");
+        appendLine(text, "vkeng_instanced_batches %.1f\n",
+                   static_cast<double>(snapshot.instancedBatchSum) / frames);
+
+        appendLine(text, "# HELP vkeng_gpu_pass_milliseconds Mean GPU pass time per resolved frame\n");
+        appendLine(text, "# TYPE vkeng_gpu_pass_milliseconds gauge\n");
+        for (uint32_t i = 0; i < snapshot.passCount; i++) {
+            const PassAccumulator& pass = snapshot.passes[i];
+            if (pass.samples == 0) continue;
+            appendLine(text, "vkeng_gpu_pass_milliseconds{pass=\"%s\"} %.3f\n",
+                       pass.name, pass.totalMs / static_cast<double>(pass.samples));
+        }
+
+        const auto& mem = snapshot.memory;
+        appendLine(text, "# HELP vkeng_vram_bytes Tracked device memory by category\n");
+        appendLine(text, "# TYPE vkeng_vram_bytes gauge\n");
+        appendLine(text, "vkeng_vram_bytes{kind=\"total\"} %llu\n",
+                   static_cast<unsigned long long>(mem.totalAllocated));
+        appendLine(text, "vkeng_vram_bytes{kind=\"buffers\"} %llu\n",
+                   static_cast<unsigned long long>(mem.bufferBytes));
+        appendLine(text, "vkeng_vram_bytes{kind=\"images\"} %llu\n",
+                   static_cast<unsigned long long>(mem.imageBytes));
+        appendLine(text, "vkeng_vram_bytes{kind=\"unused\"} %llu\n",
+                   static_cast<unsigned long long>(mem.unusedBytes));
+        appendLine(text, "# HELP vkeng_vram_allocations Live tracked allocations\n");
+        appendLine(text, "# TYPE vkeng_vram_allocations gauge\n");
+        appendLine(text, "vkeng_vram_allocations %u\n", mem.allocationCount);
+        appendLine(text, "# HELP vkeng_vram_fragmentation Free-space fragmentation, 0 = contiguous\n");
+        appendLine(text, "# TYPE vkeng_vram_fragmentation gauge\n");
+        appendLine(text, "vkeng_vram_fragmentation %.3f\n", mem.fragmentation);
+
+        {
+            std::lock_guard<std::mutex> lock(m_expositionMutex);
+            m_exposition.swap(text);
+        }
+
+        if (!m_config.csvPath.empty()) {
+            char row[512];
+            std::snprintf(row, sizeof(row),
+                          "%lld,%llu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%.1f,%llu,%llu,%llu,%.3f\n",
+                          static_cast<long long>(std::time(nullptr)),
+                          static_cast<unsigned long long>(snapshot.frameCount),
+                          avgMs, p50, p95, p99, maxMs,
+                          snapshot.fixedUpdateMsSum / frames,
+                          snapshot.audioMsSum / frames,
+                          static_cast<double>(snapshot.drawCallSum) / frames,
+                          static_cast<double>(snapshot.culledDrawSum) / frames,
+                          static_cast<double>(snapshot.instancedBatchSum) / frames,
+                          static_cast<unsigned long long>(mem.totalAllocated),
+                          static_cast<unsigned long long>(mem.bufferBytes),
+                          static_cast<unsigned long long>(mem.imageBytes),
+                          mem.fragmentation);
+            appendCsvRow(row);
+        }
+
+        m_intervalsPublished++;
+    }
+
+    void TelemetryExporter::appendCsvRow(const std::string& row) {
+        // Rotate before the append that would overflow: path -> path.1 -> ...
+        // with the oldest file dropped off the end
+        struct stat info {};
+        if (::stat(m_config.csvPath.c_str(), &info) == 0 &&
+            static_cast<uint64_t>(info.st_size) + row.size() > m_config.csvMaxBytes) {
+            if (m_config.csvMaxFiles == 1) {
+                std::remove(m_config.csvPath.c_str());
+            }
+            for (uint32_t i = m_config.csvMaxFiles - 1; i >= 1; i--) {
+                const std::string from = i == 1 ? m_config.csvPath
+                                                : m_config.csvPath + "." + std::to_string(i - 1);
+                const std::string to = m_config.csvPath + "." + std::to_string(i);
+                std::rename(from.c_str(), to.c_str());
+            }
+        }
+
+        const bool fileExists = ::stat(m_config.csvPath.c_str(), &info) == 0 && info.st_size > 0;
+        std::ofstream file(m_config.csvPath, std::ios::app);
+        if (!file.is_open()) {
+            LOG_WARN(GENERAL, "Telemetry: failed to open CSV {}", m_config.csvPath);
+            return;
+        }
+        if (!fileExists) {
+            file << "timestamp,frames,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,"
+                    "fixed_update_ms,audio_ms,draw_calls,culled_draws,instanced_batches,"
+                    "vram_total_bytes,vram_buffer_bytes,vram_image_bytes,vram_fragmentation\n";
+        }
+        file << row;
+    }
+
+    // ============================================================================
+    // HTTP endpoint
+    // ============================================================================
+
+    int TelemetryExporter::openListenSocket(uint16_t port) {
+#ifndef VKENG_TELEMETRY_HTTP
+        (void)port;
+        return -1;
+#else
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            return -1;
+        }
+
+        int reuse = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(fd, 4) != 0) {
+            ::close(fd);
+            return -1;
+        }
+
+        // Non-blocking accept lets the exporter thread poll the socket on
+        // the same loop that publishes intervals
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        return fd;
+#endif
+    }
+
+    void TelemetryExporter::servePendingConnections() {
+        if (m_listenFd < 0) {
+            return;
+        }
+
+#ifdef VKENG_TELEMETRY_HTTP
+        for (int i = 0; i < MAX_ACCEPTS_PER_POLL; i++) {
+            const int client = ::accept(m_listenFd, nullptr, nullptr);
+            if (client < 0) {
+                return; // EAGAIN: nothing pending
+            }
+
+            // Best-effort request drain; whatever the scraper asked for,
+            // the answer is the latest exposition
+            char request[512];
+            ::recv(client, request, sizeof(request), MSG_DONTWAIT);
+
+            const std::string body = getExposition();
+            char header[160];
+            const int headerLength = std::snprintf(
+                header, sizeof(header),
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Type: text/plain; version=0.0.4\r\n"
+                "Content-Length: %zu\r\n"
+                "Connection: close\r\n\r\n",
+                body.size());
+            ::send(client, header, static_cast<size_t>(headerLength), MSG_NOSIGNAL);
+            if (!body.empty()) {
+                ::send(client, body.data(), body.size(), MSG_NOSIGNAL);
+            }
+            ::close(client);
+        }
+#endif
+    }
+
+} // namespace vkeng
@@ -0,0 +1,57 @@
+/**
+ * @file TimelineSemaphore.cpp
+ * @brief Implementation of the timeline semaphore wrapper
+ */
+
+#include "vulkan-engine/core/TimelineSemaphore.hpp"
+
+namespace vkeng {
+
+    Result<std::shared_ptr<TimelineSemaphore>> TimelineSemaphore::create(VkDevice device) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = &typeInfo;
+
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, &semaphore);
+        if (result != VK_SUCCESS) {
+            return Result<std::shared_ptr<TimelineSemaphore>>(
+                Error("Failed to create timeline semaphore", result));
+        }
+
+        return Result<std::shared_ptr<TimelineSemaphore>>(
+            std::shared_ptr<TimelineSemaphore>(new TimelineSemaphore(device, semaphore)));
+    }
+
+    TimelineSemaphore::~TimelineSemaphore() {
+        if (m_semaphore != VK_NULL_HANDLE) {
+            vkDestroySemaphore(m_device, m_semaphore, nullptr);
+        }
+    }
+
+    Result<void> TimelineSemaphore::wait(uint64_t value, uint64_t timeoutNs) const {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_semaphore;
+        waitInfo.pValues = &value;
+
+        VkResult result = vkWaitSemaphores(m_device, &waitInfo, timeoutNs);
+        if (result != VK_SUCCESS) {
+            return Result<void>(Error("Timeline semaphore wait failed", result));
+        }
+        return Result<void>();
+    }
+
+    uint64_t TimelineSemaphore::getCompletedValue() const {
+        uint64_t value = 0;
+        vkGetSemaphoreCounterValue(m_device, m_semaphore, &value);
+        return value;
+    }
+
+} // namespace vkeng
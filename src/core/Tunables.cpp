@@ -0,0 +1,248 @@
+#include "vulkan-engine/core/Tunables.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    /// Frames between control-file timestamp checks; one stat() every half
+    /// second at 60 Hz is invisible, and tuning by hand never notices the lag
+    constexpr uint32_t CONTROL_FILE_POLL_FRAMES = 30;
+
+    /// Strips leading/trailing whitespace for control-file parsing
+    std::string trimmed(const std::string& text) {
+        size_t begin = text.find_first_not_of(" \t\r");
+        if (begin == std::string::npos) return {};
+        size_t end = text.find_last_not_of(" \t\r");
+        return text.substr(begin, end - begin + 1);
+    }
+}
+
+namespace vkeng {
+
+    Tunables& Tunables::get() {
+        static Tunables instance;
+        return instance;
+    }
+
+    void Tunables::registerEntry(const std::string& name, Entry entry) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.count(name)) {
+            LOG_WARN(GENERAL, "Tunable {} registered twice; keeping the first registration", name);
+            return;
+        }
+        m_entries.emplace(name, std::move(entry));
+    }
+
+    void Tunables::registerBool(const std::string& name, bool initial,
+                                std::function<void(bool)> apply, std::string description) {
+        Entry entry;
+        entry.type = TunableType::Bool;
+        entry.value = initial ? 1.0f : 0.0f;
+        entry.minValue = 0.0f;
+        entry.maxValue = 1.0f;
+        entry.apply = [callback = std::move(apply)](float v) { callback(v != 0.0f); };
+        entry.description = std::move(description);
+        registerEntry(name, std::move(entry));
+    }
+
+    void Tunables::registerInt(const std::string& name, int initial, int minValue, int maxValue,
+                               std::function<void(int)> apply, std::string description) {
+        Entry entry;
+        entry.type = TunableType::Int;
+        entry.value = static_cast<float>(initial);
+        entry.minValue = static_cast<float>(minValue);
+        entry.maxValue = static_cast<float>(maxValue);
+        entry.apply = [callback = std::move(apply)](float v) { callback(static_cast<int>(v)); };
+        entry.description = std::move(description);
+        registerEntry(name, std::move(entry));
+    }
+
+    void Tunables::registerFloat(const std::string& name, float initial, float minValue, float maxValue,
+                                 std::function<void(float)> apply, std::string description) {
+        Entry entry;
+        entry.type = TunableType::Float;
+        entry.value = initial;
+        entry.minValue = minValue;
+        entry.maxValue = maxValue;
+        entry.apply = std::move(apply);
+        entry.description = std::move(description);
+        registerEntry(name, std::move(entry));
+    }
+
+    void Tunables::unregister(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(name);
+    }
+
+    bool Tunables::set(const std::string& name, const std::string& value) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(name);
+        if (it == m_entries.end()) {
+            return false;
+        }
+
+        float parsed = 0.0f;
+        if (it->second.type == TunableType::Bool) {
+            if (value == "true" || value == "1") {
+                parsed = 1.0f;
+            } else if (value == "false" || value == "0") {
+                parsed = 0.0f;
+            } else {
+                return false;
+            }
+        } else {
+            char* end = nullptr;
+            parsed = std::strtof(value.c_str(), &end);
+            if (end == value.c_str()) {
+                return false;
+            }
+        }
+
+        it->second.pending = parsed;
+        it->second.hasPending = true;
+        return true;
+    }
+
+    void Tunables::applyPending() {
+        pollControlFile();
+
+        // Collect staged changes under the lock, run callbacks outside it:
+        // an apply callback is free to log, query, or even set() again
+        struct Staged {
+            std::function<void(float)>* apply;
+            std::string name;
+            float value;
+        };
+        std::vector<Staged> staged;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& [name, entry] : m_entries) {
+                if (!entry.hasPending) {
+                    continue;
+                }
+                entry.hasPending = false;
+                float clamped = std::clamp(entry.pending, entry.minValue, entry.maxValue);
+                if (entry.type != TunableType::Float) {
+                    clamped = static_cast<float>(static_cast<int>(clamped));
+                }
+                if (clamped == entry.value) {
+                    continue;
+                }
+                entry.value = clamped;
+                staged.push_back({&entry.apply, name, clamped});
+            }
+        }
+
+        for (const auto& change : staged) {
+            (*change.apply)(change.value);
+            LOG_INFO(GENERAL, "Tunable {} = {}", change.name, change.value);
+        }
+    }
+
+    void Tunables::enableFileControl(const std::filesystem::path& path) {
+        m_controlFile = path;
+        m_pollCountdown = 0;
+
+        std::error_code ec;
+        if (!std::filesystem::exists(m_controlFile, ec)) {
+            writeControlFileTemplate();
+        } else {
+            // Adopt the existing file's values, then track its timestamp
+            parseControlFile();
+        }
+        m_controlFileTime = std::filesystem::last_write_time(m_controlFile, ec);
+        LOG_INFO(GENERAL, "Tunables control file: {}", m_controlFile.string());
+    }
+
+    void Tunables::pollControlFile() {
+        if (m_controlFile.empty()) {
+            return;
+        }
+        if (m_pollCountdown > 0) {
+            m_pollCountdown--;
+            return;
+        }
+        m_pollCountdown = CONTROL_FILE_POLL_FRAMES;
+
+        std::error_code ec;
+        auto writeTime = std::filesystem::last_write_time(m_controlFile, ec);
+        if (ec || writeTime == m_controlFileTime) {
+            return;
+        }
+        m_controlFileTime = writeTime;
+        parseControlFile();
+    }
+
+    void Tunables::parseControlFile() {
+        std::ifstream file(m_controlFile);
+        if (!file) {
+            LOG_WARN(GENERAL, "Failed to read tunables control file: {}", m_controlFile.string());
+            return;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            std::string text = trimmed(line);
+            if (text.empty() || text[0] == '#') {
+                continue;
+            }
+            size_t equals = text.find('=');
+            if (equals == std::string::npos) {
+                LOG_WARN(GENERAL, "Skipping malformed tunables line: {}", line);
+                continue;
+            }
+            std::string name = trimmed(text.substr(0, equals));
+            std::string value = trimmed(text.substr(equals + 1));
+            if (!set(name, value)) {
+                LOG_WARN(GENERAL, "Unknown tunable or bad value: {} = {}", name, value);
+            }
+        }
+    }
+
+    void Tunables::writeControlFileTemplate() const {
+        std::ofstream file(m_controlFile);
+        if (!file) {
+            LOG_WARN(GENERAL, "Failed to create tunables control file: {}", m_controlFile.string());
+            return;
+        }
+
+        file << "# Live engine tunables: edit a value and save; it applies at\n"
+             << "# the next frame boundary. Lines starting with # are ignored.\n";
+        for (const Info& info : snapshot()) {
+            file << "# " << info.description;
+            if (info.type != TunableType::Bool) {
+                file << " [" << info.minValue << ", " << info.maxValue << "]";
+            }
+            file << "\n" << info.name << " = ";
+            if (info.type == TunableType::Bool) {
+                file << (info.value != 0.0f ? "true" : "false");
+            } else if (info.type == TunableType::Int) {
+                file << static_cast<int>(info.value);
+            } else {
+                file << info.value;
+            }
+            file << "\n\n";
+        }
+    }
+
+    std::vector<Tunables::Info> Tunables::snapshot() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<Info> result;
+        result.reserve(m_entries.size());
+        for (const auto& [name, entry] : m_entries) {
+            result.push_back({name, entry.type, entry.value,
+                              entry.minValue, entry.maxValue, entry.description});
+        }
+        return result;
+    }
+
+    void Tunables::logAll() const {
+        for (const Info& info : snapshot()) {
+            LOG_INFO(GENERAL, "Tunable {} = {} ({})", info.name, info.value, info.description);
+        }
+    }
+
+} // namespace vkeng
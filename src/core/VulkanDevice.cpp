@@ -9,27 +9,27 @@ namespace vkeng {
             VK_KHR_SWAPCHAIN_EXTENSION_NAME
         };
 
-        bool hasRequiredExtensions(VkPhysicalDevice device) {
+        bool hasDeviceExtension(VkPhysicalDevice device, const char* name) {
             uint32_t extensionCount = 0;
             vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
 
             std::vector<VkExtensionProperties> availableExtensions(extensionCount);
             vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
-            for (const char* requiredExtension : kRequiredDeviceExtensions) {
-                bool found = false;
-                for (const auto& extension : availableExtensions) {
-                    if (std::strcmp(requiredExtension, extension.extensionName) == 0) {
-                        found = true;
-                        break;
-                    }
+            for (const auto& extension : availableExtensions) {
+                if (std::strcmp(name, extension.extensionName) == 0) {
+                    return true;
                 }
+            }
+            return false;
+        }
 
-                if (!found) {
+        bool hasRequiredExtensions(VkPhysicalDevice device) {
+            for (const char* requiredExtension : kRequiredDeviceExtensions) {
+                if (!hasDeviceExtension(device, requiredExtension)) {
                     return false;
                 }
             }
-
             return true;
         }
 
@@ -45,6 +45,12 @@ namespace vkeng {
                     continue;
                 }
 
+                // Headless mode has no surface; any graphics family works.
+                if (surface == VK_NULL_HANDLE) {
+                    graphicsFamily = i;
+                    return true;
+                }
+
                 VkBool32 presentSupport = false;
                 vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
                 if (presentSupport) {
@@ -56,6 +62,37 @@ namespace vkeng {
             return false;
         }
 
+        uint32_t findDedicatedTransferFamily(VkPhysicalDevice device) {
+            uint32_t queueFamilyCount = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
+
+            std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+            vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
+
+            // First choice: transfer-only family (typically maps to the DMA
+            // engine, fully parallel with graphics work).
+            for (uint32_t i = 0; i < queueFamilies.size(); i++) {
+                VkQueueFlags flags = queueFamilies[i].queueFlags;
+                if ((flags & VK_QUEUE_TRANSFER_BIT) &&
+                    !(flags & VK_QUEUE_GRAPHICS_BIT) &&
+                    !(flags & VK_QUEUE_COMPUTE_BIT)) {
+                    return i;
+                }
+            }
+
+            // Second choice: any non-graphics family that can transfer
+            // (compute families implicitly support transfer).
+            for (uint32_t i = 0; i < queueFamilies.size(); i++) {
+                VkQueueFlags flags = queueFamilies[i].queueFlags;
+                if ((flags & (VK_QUEUE_TRANSFER_BIT | VK_QUEUE_COMPUTE_BIT)) &&
+                    !(flags & VK_QUEUE_GRAPHICS_BIT)) {
+                    return i;
+                }
+            }
+
+            return UINT32_MAX;
+        }
+
         bool hasSwapChainSupport(VkPhysicalDevice device, VkSurfaceKHR surface) {
             uint32_t formatCount = 0;
             vkGetPhysicalDeviceSurfaceFormatsKHR(device, surface, &formatCount, nullptr);
@@ -71,6 +108,7 @@ namespace vkeng {
      * @brief Constructor that orchestrates the device setup process.
      */
     VulkanDevice::VulkanDevice(VkInstance instance, VkSurfaceKHR surface) {
+        headless_ = (surface == VK_NULL_HANDLE);
         pickPhysicalDevice(instance, surface);
         createLogicalDevice();
     }
@@ -102,7 +140,9 @@ namespace vkeng {
         
         for (const auto& device : devices) {
             uint32_t graphicsFamily = UINT32_MAX;
-            if (!hasRequiredExtensions(device)) {
+            // Swapchain extension and surface support only matter when
+            // presenting; headless rendering targets offscreen images.
+            if (!headless_ && !hasRequiredExtensions(device)) {
                 continue;
             }
 
@@ -110,12 +150,19 @@ namespace vkeng {
                 continue;
             }
 
-            if (!hasSwapChainSupport(device, surface)) {
+            if (!headless_ && !hasSwapChainSupport(device, surface)) {
                 continue;
             }
 
             physicalDevice_ = device;
             graphicsFamily_ = graphicsFamily;
+
+            // Prefer a dedicated transfer family so uploads don't serialize
+            // with rendering; fall back to the graphics family otherwise.
+            transferFamily_ = findDedicatedTransferFamily(device);
+            if (transferFamily_ == UINT32_MAX) {
+                transferFamily_ = graphicsFamily_;
+            }
             return;
         }
         
@@ -126,32 +173,198 @@ namespace vkeng {
      * @brief Creates the logical device interface and retrieves the graphics queue.
      */
     void VulkanDevice::createLogicalDevice() {
-        VkDeviceQueueCreateInfo queueCreateInfo{};
-        queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-        queueCreateInfo.queueFamilyIndex = graphicsFamily_;
-        queueCreateInfo.queueCount = 1;
-        
         float queuePriority = 1.0f;
-        queueCreateInfo.pQueuePriorities = &queuePriority;
-        
+        std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
+
+        VkDeviceQueueCreateInfo graphicsQueueInfo{};
+        graphicsQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        graphicsQueueInfo.queueFamilyIndex = graphicsFamily_;
+        graphicsQueueInfo.queueCount = 1;
+        graphicsQueueInfo.pQueuePriorities = &queuePriority;
+        queueCreateInfos.push_back(graphicsQueueInfo);
+
+        // Request a queue from the dedicated transfer family when one exists.
+        if (transferFamily_ != graphicsFamily_) {
+            VkDeviceQueueCreateInfo transferQueueInfo{};
+            transferQueueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            transferQueueInfo.queueFamilyIndex = transferFamily_;
+            transferQueueInfo.queueCount = 1;
+            transferQueueInfo.pQueuePriorities = &queuePriority;
+            queueCreateInfos.push_back(transferQueueInfo);
+        }
+
         // Specify device features to enable (none for this basic example).
         VkPhysicalDeviceFeatures deviceFeatures{};
-        
+
+        // Descriptor indexing (core in the Vulkan 1.2 instance we create):
+        // query what the device offers and enable the subset needed for a
+        // variable-count, update-after-bind sampled image array. Bindless
+        // also needs room past the base 144-byte push constant block for
+        // the per-draw texture indices. The Vulkan 1.1 feature block is
+        // chained in for shaderDrawParameters (gl_DrawID), which together
+        // with multiDrawIndirect gates the indirect multi-draw path, and
+        // the 1.2 block for timelineSemaphore, the engine's sync backbone.
+        VkPhysicalDeviceDescriptorIndexingFeatures indexingQuery{};
+        indexingQuery.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        VkPhysicalDeviceVulkan11Features vk11Query{};
+        vk11Query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+        vk11Query.pNext = &indexingQuery;
+        VkPhysicalDeviceVulkan12Features vk12Query{};
+        vk12Query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vk12Query.pNext = &vk11Query;
+        VkPhysicalDevicePresentIdFeaturesKHR presentIdQuery{};
+        presentIdQuery.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        presentIdQuery.pNext = &vk12Query;
+        VkPhysicalDevicePresentWaitFeaturesKHR presentWaitQuery{};
+        presentWaitQuery.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        presentWaitQuery.pNext = &presentIdQuery;
+        VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderQuery{};
+        meshShaderQuery.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+        meshShaderQuery.pNext = &presentWaitQuery;
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &meshShaderQuery;
+        vkGetPhysicalDeviceFeatures2(physicalDevice_, &features2);
+
+        VkPhysicalDeviceProperties properties{};
+        vkGetPhysicalDeviceProperties(physicalDevice_, &properties);
+
+        bindlessTexturesSupported_ =
+            indexingQuery.shaderSampledImageArrayNonUniformIndexing &&
+            indexingQuery.runtimeDescriptorArray &&
+            indexingQuery.descriptorBindingPartiallyBound &&
+            indexingQuery.descriptorBindingSampledImageUpdateAfterBind &&
+            indexingQuery.descriptorBindingVariableDescriptorCount &&
+            properties.limits.maxPushConstantsSize >= 160;
+
+        indirectDrawsSupported_ =
+            features2.features.multiDrawIndirect &&
+            vk11Query.shaderDrawParameters;
+        if (indirectDrawsSupported_) {
+            deviceFeatures.multiDrawIndirect = VK_TRUE;
+        }
+
+        timelineSemaphoresSupported_ = vk12Query.timelineSemaphore;
+
+        // Present-wait needs both extensions (present_wait builds on the
+        // IDs present_id attaches) and their feature bits; meaningless
+        // without a surface to present to
+        presentWaitSupported_ = !headless_ &&
+            presentIdQuery.presentId && presentWaitQuery.presentWait &&
+            hasDeviceExtension(physicalDevice_, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+            hasDeviceExtension(physicalDevice_, VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+
+        // Push descriptors have no feature struct; extension presence is the
+        // whole query. Gates creating PUSH_DESCRIPTOR_BIT set layouts.
+        pushDescriptorsSupported_ =
+            hasDeviceExtension(physicalDevice_, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
+        // The meshlet path needs both stages: the task shader does the
+        // per-cluster culling, the mesh shader the cluster expansion
+        meshShadingSupported_ =
+            meshShaderQuery.taskShader && meshShaderQuery.meshShader &&
+            hasDeviceExtension(physicalDevice_, VK_EXT_MESH_SHADER_EXTENSION_NAME);
+
+        // Core-in-1.1 multiview: one render pass instance writes several
+        // array layers (shadow cascades record casters once)
+        multiviewSupported_ = vk11Query.multiview;
+
+        // The 1.1 block carries both shaderDrawParameters (indirect draws)
+        // and multiview (layered shadow passes); enable only what the
+        // device reported so the block can be chained for either
+        VkPhysicalDeviceVulkan11Features vk11Enable{};
+        vk11Enable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES;
+        vk11Enable.shaderDrawParameters = indirectDrawsSupported_ ? VK_TRUE : VK_FALSE;
+        vk11Enable.multiview = multiviewSupported_ ? VK_TRUE : VK_FALSE;
+
+        VkPhysicalDeviceVulkan12Features vk12Enable{};
+        vk12Enable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vk12Enable.timelineSemaphore = VK_TRUE;
+
+        VkPhysicalDeviceDescriptorIndexingFeatures indexingEnable{};
+        indexingEnable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        indexingEnable.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        indexingEnable.runtimeDescriptorArray = VK_TRUE;
+        indexingEnable.descriptorBindingPartiallyBound = VK_TRUE;
+        indexingEnable.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        indexingEnable.descriptorBindingVariableDescriptorCount = VK_TRUE;
+
+        VkPhysicalDevicePresentIdFeaturesKHR presentIdEnable{};
+        presentIdEnable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        presentIdEnable.presentId = VK_TRUE;
+
+        VkPhysicalDevicePresentWaitFeaturesKHR presentWaitEnable{};
+        presentWaitEnable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        presentWaitEnable.presentWait = VK_TRUE;
+
+        VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderEnable{};
+        meshShaderEnable.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+        meshShaderEnable.taskShader = VK_TRUE;
+        meshShaderEnable.meshShader = VK_TRUE;
+
         VkDeviceCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pQueueCreateInfos = &queueCreateInfo;
-        createInfo.queueCreateInfoCount = 1;
+        createInfo.pQueueCreateInfos = queueCreateInfos.data();
+        createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
         createInfo.pEnabledFeatures = &deviceFeatures;
-        
-        // Enable necessary device extensions. The swapchain extension is essential for rendering.
-        createInfo.enabledExtensionCount = static_cast<uint32_t>(kRequiredDeviceExtensions.size());
-        createInfo.ppEnabledExtensionNames = kRequiredDeviceExtensions.data();
-        
+
+        // Chain only the feature blocks the device actually supports
+        void* featureChain = nullptr;
+        if (bindlessTexturesSupported_) {
+            featureChain = &indexingEnable;
+        }
+        if (indirectDrawsSupported_ || multiviewSupported_) {
+            vk11Enable.pNext = featureChain;
+            featureChain = &vk11Enable;
+        }
+        if (timelineSemaphoresSupported_) {
+            vk12Enable.pNext = featureChain;
+            featureChain = &vk12Enable;
+        }
+        if (presentWaitSupported_) {
+            presentIdEnable.pNext = featureChain;
+            presentWaitEnable.pNext = &presentIdEnable;
+            featureChain = &presentWaitEnable;
+        }
+        if (meshShadingSupported_) {
+            meshShaderEnable.pNext = featureChain;
+            featureChain = &meshShaderEnable;
+        }
+        createInfo.pNext = featureChain;
+
+        // Enable necessary device extensions. The swapchain extension is
+        // essential for presentation but invalid without a surface, so the
+        // headless path enables no extensions. Present-ID/wait ride along
+        // when the device offers them.
+        std::vector<const char*> enabledExtensions;
+        if (!headless_) {
+            enabledExtensions = kRequiredDeviceExtensions;
+            if (presentWaitSupported_) {
+                enabledExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+                enabledExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+            }
+        }
+        // Push descriptors work without a surface, so headless keeps them
+        if (pushDescriptorsSupported_) {
+            enabledExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+        }
+        // Mesh shading is likewise surface-independent
+        if (meshShadingSupported_) {
+            enabledExtensions.push_back(VK_EXT_MESH_SHADER_EXTENSION_NAME);
+        }
+        createInfo.enabledExtensionCount = static_cast<uint32_t>(enabledExtensions.size());
+        createInfo.ppEnabledExtensionNames = enabledExtensions.empty() ? nullptr : enabledExtensions.data();
+
         if (vkCreateDevice(physicalDevice_, &createInfo, nullptr, &device_) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create logical device!");
         }
-        
-        // Retrieve a handle to the newly created graphics queue.
+
+        // Retrieve handles to the newly created queues.
         vkGetDeviceQueue(device_, graphicsFamily_, 0, &graphicsQueue_);
+        if (transferFamily_ != graphicsFamily_) {
+            vkGetDeviceQueue(device_, transferFamily_, 0, &transferQueue_);
+        } else {
+            transferQueue_ = graphicsQueue_;
+        }
     }
 } // namespace vkeng
\ No newline at end of file
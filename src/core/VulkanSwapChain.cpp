@@ -5,6 +5,10 @@
 
 namespace vkeng {
     namespace {
+        // Headless mode has no driver-owned image queue; three offscreen
+        // images match the typical windowed minImageCount + 1.
+        constexpr uint32_t kHeadlessImageCount = 3;
+
         VkSurfaceFormatKHR chooseSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats) {
             for (const auto& availableFormat : formats) {
                 if (availableFormat.format == VK_FORMAT_B8G8R8A8_SRGB &&
@@ -16,13 +20,44 @@ namespace vkeng {
             return formats.front();
         }
 
-        VkPresentModeKHR choosePresentMode(const std::vector<VkPresentModeKHR>& presentModes) {
-            for (const auto& availablePresentMode : presentModes) {
-                if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-                    return availablePresentMode;
+        const char* presentModeName(VkPresentModeKHR mode) {
+            switch (mode) {
+                case VK_PRESENT_MODE_IMMEDIATE_KHR:    return "IMMEDIATE";
+                case VK_PRESENT_MODE_MAILBOX_KHR:      return "MAILBOX";
+                case VK_PRESENT_MODE_FIFO_KHR:         return "FIFO";
+                case VK_PRESENT_MODE_FIFO_RELAXED_KHR: return "FIFO_RELAXED";
+                default:                               return "UNKNOWN";
+            }
+        }
+
+        VkPresentModeKHR choosePresentMode(const std::vector<VkPresentModeKHR>& presentModes,
+                                           PresentMode preferred) {
+            auto supported = [&presentModes](VkPresentModeKHR mode) {
+                return std::find(presentModes.begin(), presentModes.end(), mode) != presentModes.end();
+            };
+
+            // Explicit preference first; FIFO is the only mode the spec
+            // guarantees, so anything else may fall through
+            VkPresentModeKHR wanted = VK_PRESENT_MODE_FIFO_KHR;
+            switch (preferred) {
+                case PresentMode::Auto:        break;
+                case PresentMode::Fifo:        return VK_PRESENT_MODE_FIFO_KHR;
+                case PresentMode::FifoRelaxed: wanted = VK_PRESENT_MODE_FIFO_RELAXED_KHR; break;
+                case PresentMode::Mailbox:     wanted = VK_PRESENT_MODE_MAILBOX_KHR; break;
+                case PresentMode::Immediate:   wanted = VK_PRESENT_MODE_IMMEDIATE_KHR; break;
+            }
+            if (preferred != PresentMode::Auto) {
+                if (supported(wanted)) {
+                    return wanted;
                 }
+                LOG_WARN(VULKAN, "Requested present mode {} not supported; falling back to automatic selection",
+                         presentModeName(wanted));
             }
 
+            // Auto: MAILBOX when available, otherwise the guaranteed FIFO
+            if (supported(VK_PRESENT_MODE_MAILBOX_KHR)) {
+                return VK_PRESENT_MODE_MAILBOX_KHR;
+            }
             return VK_PRESENT_MODE_FIFO_KHR;
         }
 
@@ -52,6 +87,18 @@ namespace vkeng {
         createDepthResources();
     }
 
+    /**
+     * @brief Constructs a headless swap chain substitute over offscreen images.
+     */
+    VulkanSwapChain::VulkanSwapChain(VkDevice device, VkPhysicalDevice phys,
+                                     uint32_t width, uint32_t height, std::shared_ptr<MemoryManager> memoryManager)
+        : device_(device), physicalDevice_(phys), surface_(VK_NULL_HANDLE), memoryManager_(memoryManager) {
+        createOffscreenImages(width, height);
+        createDepthResources();
+        LOG_INFO(VULKAN, "Created headless swapchain: {}x{}, {} offscreen images",
+                 extent_.width, extent_.height, images_.size());
+    }
+
     /**
      * @brief Destroys the swap chain and its associated image views.
      */
@@ -59,9 +106,13 @@ namespace vkeng {
         // Note: depthImageView_ is owned by depthImage_ (shared_ptr<Image>),
         // so it will be automatically destroyed when depthImage_ goes out of scope.
         // We should NOT manually destroy it here.
-        
-        for (auto imageView : imageViews_) {
-            vkDestroyImageView(device_, imageView, nullptr);
+        // In headless mode the image views are owned by offscreenImages_ too.
+
+        destroyRetired();
+        if (!isHeadless()) {
+            for (auto imageView : imageViews_) {
+                vkDestroyImageView(device_, imageView, nullptr);
+            }
         }
         if (swapChain_ != VK_NULL_HANDLE) {
             vkDestroySwapchainKHR(device_, swapChain_, nullptr);
@@ -108,7 +159,7 @@ namespace vkeng {
         }
 
         VkSurfaceFormatKHR surfaceFormat = chooseSurfaceFormat(support_.formats);
-        VkPresentModeKHR presentMode = choosePresentMode(support_.presentModes);
+        VkPresentModeKHR presentMode = choosePresentMode(support_.presentModes, preferredPresentMode_);
         extent_ = chooseExtent(support_.capabilities, width, height);
 
         uint32_t imageCount = support_.capabilities.minImageCount + 1;
@@ -125,6 +176,16 @@ namespace vkeng {
         createInfo.imageExtent = extent_;
         createInfo.imageArrayLayers = 1;
         createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT; // For rendering directly to the image
+        if (support_.capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) {
+            // Lets the screenshot capture path copy presented images to a
+            // readback buffer; universally supported on desktop surfaces
+            createInfo.imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        }
+        if (support_.capabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT) {
+            // Lets the dynamic resolution path blit its internal target
+            // into the presented image
+            createInfo.imageUsage |= VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        }
         createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
         createInfo.preTransform = support_.capabilities.currentTransform;
         createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
@@ -137,6 +198,9 @@ namespace vkeng {
         }
 
         format_ = surfaceFormat.format;
+        activePresentMode_ = presentMode;
+        presentModeDirty_ = false;
+        LOG_INFO(VULKAN, "Swapchain present mode: {}", presentModeName(presentMode));
 
         vkGetSwapchainImagesKHR(device_, swapChain_, &imageCount, nullptr);
         images_.resize(imageCount);
@@ -176,17 +240,32 @@ namespace vkeng {
      * @brief Recreates the swap chain with new dimensions.
      */
     void VulkanSwapChain::recreate(uint32_t width, uint32_t height) {
-        // Clean up old swap chain resources
-        // Reset depth image - this properly destroys both the image and its view
+        // Retire the outgoing resources instead of destroying them: the
+        // presentation engine may still hold the old images, and in-flight
+        // frames may reference the old views. The caller destroys the
+        // bundle via destroyRetired() once both have drained — this is
+        // what lets recreation skip vkDeviceWaitIdle.
+        RetiredSwapchain outgoing;
+        outgoing.depthImage = std::move(depthImage_);
         depthImage_.reset();
         depthImageView_ = VK_NULL_HANDLE;
-        
-        for (auto imageView : imageViews_) {
-            vkDestroyImageView(device_, imageView, nullptr);
+
+        // Headless mode: the offscreen images have a fixed size and no
+        // surface to re-query; just rebuild them at the requested extent.
+        if (isHeadless()) {
+            imageViews_.clear();
+            images_.clear();
+            offscreenImages_.clear();
+            createOffscreenImages(width, height);
+            createDepthResources();
+            return;
         }
+
+        outgoing.imageViews = std::move(imageViews_);
         imageViews_.clear();
 
         VkSwapchainKHR oldSwapChain = swapChain_;
+        outgoing.swapchain = oldSwapChain;
 
         // Re-query support to get updated surface capabilities (like new size)
         querySupport(physicalDevice_, surface_);
@@ -206,9 +285,10 @@ namespace vkeng {
 
         LOG_INFO(VULKAN, "Selected Swapchain Extent: {}x{}", extent_.width, extent_.height);
 
-        // Destroy the old swapchain now that the new one is created
-        if (oldSwapChain != VK_NULL_HANDLE) {
-            vkDestroySwapchainKHR(device_, oldSwapChain, nullptr);
+        // Park the old swapchain and its views for deferred destruction
+        if (outgoing.swapchain != VK_NULL_HANDLE || !outgoing.imageViews.empty() ||
+            outgoing.depthImage) {
+            retired_.push_back(std::move(outgoing));
         }
 
         // Recreate image views
@@ -216,6 +296,22 @@ namespace vkeng {
         createDepthResources();
     }
 
+    /**
+     * @brief Destroys every swapchain bundle retired by recreate().
+     */
+    void VulkanSwapChain::destroyRetired() {
+        for (auto& retired : retired_) {
+            for (auto imageView : retired.imageViews) {
+                vkDestroyImageView(device_, imageView, nullptr);
+            }
+            if (retired.swapchain != VK_NULL_HANDLE) {
+                vkDestroySwapchainKHR(device_, retired.swapchain, nullptr);
+            }
+            // depthImage destroys itself (and its view) when the bundle drops
+        }
+        retired_.clear();
+    }
+
     void VulkanSwapChain::createDepthResources() {
         depthFormat_ = findDepthFormat();
         auto result = memoryManager_->createDepthBuffer(extent_.width, extent_.height, depthFormat_);
@@ -226,6 +322,167 @@ namespace vkeng {
         depthImageView_ = depthImage_->getImageView();
     }
 
+    /**
+     * @brief Creates the offscreen color images backing headless mode.
+     * @details Uses the same format the windowed path prefers
+     * (B8G8R8A8_SRGB) so render passes and pipelines are identical in both
+     * modes. TRANSFER_SRC usage allows readback for image dumps.
+     */
+    void VulkanSwapChain::createOffscreenImages(uint32_t width, uint32_t height) {
+        format_ = VK_FORMAT_B8G8R8A8_SRGB;
+        extent_ = {width, height};
+
+        offscreenImages_.reserve(kHeadlessImageCount);
+        images_.reserve(kHeadlessImageCount);
+        imageViews_.reserve(kHeadlessImageCount);
+
+        for (uint32_t i = 0; i < kHeadlessImageCount; i++) {
+            auto result = memoryManager_->createImage(
+                width, height, format_,
+                VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+            if (!result) {
+                throw std::runtime_error("Failed to create offscreen image: " + result.getError().message);
+            }
+
+            auto image = result.getValue();
+            offscreenImages_.push_back(image);
+            images_.push_back(image->getHandle());
+            imageViews_.push_back(image->getImageView());
+        }
+    }
+
+    VkResult VulkanSwapChain::acquireNextImage(VkQueue queue, VkSemaphore imageAvailable, uint32_t& imageIndex) {
+        if (!isHeadless()) {
+            // A pending present-mode change rides the caller's existing
+            // out-of-date handling: it recreates the swapchain, which picks
+            // up the new preferred mode
+            if (presentModeDirty_) {
+                return VK_ERROR_OUT_OF_DATE_KHR;
+            }
+            return vkAcquireNextImageKHR(device_, swapChain_, UINT64_MAX,
+                                         imageAvailable, VK_NULL_HANDLE, &imageIndex);
+        }
+
+        // Emulated acquire: hand out images round-robin. The caller's
+        // in-flight fence already guarantees the image's previous frame
+        // finished, so an empty submission is enough to signal the
+        // semaphore the caller will wait on.
+        imageIndex = nextHeadlessImage_;
+        nextHeadlessImage_ = (nextHeadlessImage_ + 1) % static_cast<uint32_t>(images_.size());
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &imageAvailable;
+        return vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+    }
+
+    VkResult VulkanSwapChain::present(VkQueue queue, VkSemaphore renderFinished, uint32_t imageIndex) {
+        if (!isHeadless()) {
+            VkPresentInfoKHR presentInfo{};
+            presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+            presentInfo.waitSemaphoreCount = 1;
+            presentInfo.pWaitSemaphores = &renderFinished;
+            presentInfo.swapchainCount = 1;
+            presentInfo.pSwapchains = &swapChain_;
+            presentInfo.pImageIndices = &imageIndex;
+
+            // Tag the present so waitForPresent() can block on its actual
+            // completion on the display (see enablePresentIds())
+            VkPresentIdKHR presentId{};
+            uint64_t idValue = 0;
+            if (waitForPresentFn_) {
+                idValue = ++presentIdCounter_;
+                presentId.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+                presentId.swapchainCount = 1;
+                presentId.pPresentIds = &idValue;
+                presentInfo.pNext = &presentId;
+            }
+
+            VkResult result = vkQueuePresentKHR(queue, &presentInfo);
+            if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) {
+                recordPresentInterval();
+            }
+            return result;
+        }
+
+        // Emulated present: nothing to display, but the render-finished
+        // semaphore must be consumed so the frame's sync objects can cycle.
+        (void)imageIndex;
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &renderFinished;
+        submitInfo.pWaitDstStageMask = &waitStage;
+        return vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
+    }
+
+    void VulkanSwapChain::setPresentMode(PresentMode mode) {
+        preferredPresentMode_ = mode;
+        if (isHeadless()) {
+            return; // Nothing is presented; keep the preference for symmetry
+        }
+        VkPresentModeKHR wanted = choosePresentMode(support_.presentModes, preferredPresentMode_);
+        if (wanted != activePresentMode_) {
+            presentModeDirty_ = true;
+        }
+    }
+
+    void VulkanSwapChain::recordPresentInterval() {
+        auto now = std::chrono::steady_clock::now();
+        if (presentCount_ > 0) {
+            double intervalMs = std::chrono::duration<double, std::milli>(now - lastPresentTime_).count();
+            if (presentIntervalsMs_.size() < PRESENT_STATS_WINDOW) {
+                presentIntervalsMs_.push_back(intervalMs);
+            } else {
+                presentIntervalsMs_[presentIntervalCursor_] = intervalMs;
+                presentIntervalCursor_ = (presentIntervalCursor_ + 1) % PRESENT_STATS_WINDOW;
+            }
+        }
+        lastPresentTime_ = now;
+        presentCount_++;
+    }
+
+    PresentStats VulkanSwapChain::getPresentStats() const {
+        PresentStats stats;
+        stats.presentCount = presentCount_;
+        if (presentIntervalsMs_.empty()) {
+            return stats;
+        }
+
+        double sum = 0.0;
+        stats.minIntervalMs = presentIntervalsMs_.front();
+        stats.maxIntervalMs = presentIntervalsMs_.front();
+        for (double interval : presentIntervalsMs_) {
+            sum += interval;
+            stats.minIntervalMs = std::min(stats.minIntervalMs, interval);
+            stats.maxIntervalMs = std::max(stats.maxIntervalMs, interval);
+        }
+        stats.averageIntervalMs = sum / static_cast<double>(presentIntervalsMs_.size());
+        return stats;
+    }
+
+    void VulkanSwapChain::enablePresentIds() {
+        if (isHeadless()) {
+            return;
+        }
+        waitForPresentFn_ = reinterpret_cast<PFN_vkWaitForPresentKHR>(
+            vkGetDeviceProcAddr(device_, "vkWaitForPresentKHR"));
+        if (waitForPresentFn_) {
+            LOG_INFO(VULKAN, "Present-wait feedback enabled (VK_KHR_present_wait)");
+        } else {
+            LOG_WARN(VULKAN, "Present-wait requested but vkWaitForPresentKHR did not resolve");
+        }
+    }
+
+    VkResult VulkanSwapChain::waitForPresent(uint64_t presentId, uint64_t timeoutNs) {
+        if (!waitForPresentFn_ || presentId == 0) {
+            return VK_SUCCESS;
+        }
+        return waitForPresentFn_(device_, swapChain_, presentId, timeoutNs);
+    }
+
     VkFormat VulkanSwapChain::findDepthFormat() {
         std::vector<VkFormat> candidates = {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT};
         for (VkFormat format : candidates) {
@@ -1,31 +1,111 @@
 #include "vulkan-engine/examples/HelloTriangleApp.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 #include "vulkan-engine/core/Config.hpp"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
-int main() {
+namespace {
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "With no options runs the interactive demo scene. Stress mode:\n"
+              << "  --stress N        Render an NxNxN cube grid instead of the demo scene\n"
+              << "  --instanced       Fold repeated draws into instanced batches\n"
+              << "  --per-draw MODE   Per-draw data path: push (default) or storage\n"
+              << "                    (storage = bindless + indirect multi-draw backend)\n"
+              << "  --unsorted        Skip the renderer's per-frame draw sort\n"
+              << "  --materials N     Distinct materials cycled across the grid (default 8)\n"
+              << "  --frames N        Stop after N frames (default: run until closed)\n"
+              << "  --csv PATH        Write per-frame drawFrame CPU times as CSV\n"
+              << "  --headless        Render offscreen (no window or input)\n"
+              << "  --width N         Framebuffer width (default 1280)\n"
+              << "  --height N        Framebuffer height (default 720)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
     // Initialize logging system
     vkeng::Logger::getInstance().setLogLevel(vkeng::LogLevel::DEBUG);
 
+    vkeng::Config config;
+    config.window.title = "Vulkan Engine - Phase 1";
+    config.window.width = 1280;
+    config.window.height = 720;
+    config.window.resizable = true;
+
+    vkeng::StressOptions stress;
+
+    for (int i = 1; i < argc; i++) {
+        auto nextValue = [&](const char* flag) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << flag << "\n";
+                std::exit(EXIT_FAILURE);
+            }
+            return argv[++i];
+        };
+
+        if (std::strcmp(argv[i], "--stress") == 0) {
+            stress.gridSize = static_cast<uint32_t>(std::stoul(nextValue("--stress")));
+        } else if (std::strcmp(argv[i], "--instanced") == 0) {
+            stress.instanced = true;
+        } else if (std::strcmp(argv[i], "--per-draw") == 0) {
+            const std::string mode = nextValue("--per-draw");
+            if (mode == "storage") {
+                // The storage-buffer per-draw path is the indirect multi-draw
+                // backend: GpuDrawData indexed by gl_DrawID, which requires
+                // bindless texturing (one texture set for every draw)
+                config.render.bindlessTextures = true;
+                config.render.indirectDraws = true;
+            } else if (mode != "push") {
+                std::cerr << "Unknown --per-draw mode: " << mode << " (expected push or storage)\n";
+                return EXIT_FAILURE;
+            }
+        } else if (std::strcmp(argv[i], "--unsorted") == 0) {
+            stress.sorted = false;
+        } else if (std::strcmp(argv[i], "--materials") == 0) {
+            stress.materialCount = static_cast<uint32_t>(std::stoul(nextValue("--materials")));
+        } else if (std::strcmp(argv[i], "--frames") == 0) {
+            stress.frameLimit = static_cast<uint32_t>(std::stoul(nextValue("--frames")));
+        } else if (std::strcmp(argv[i], "--csv") == 0) {
+            stress.csvPath = nextValue("--csv");
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            config.headless.enabled = true;
+        } else if (std::strcmp(argv[i], "--width") == 0) {
+            config.window.width = static_cast<uint32_t>(std::stoul(nextValue("--width")));
+        } else if (std::strcmp(argv[i], "--height") == 0) {
+            config.window.height = static_cast<uint32_t>(std::stoul(nextValue("--height")));
+        } else if (std::strcmp(argv[i], "--help") == 0) {
+            printUsage(argv[0]);
+            return EXIT_SUCCESS;
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << "\n";
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // The headless loop counts frames itself; windowed runs close via the
+    // app's own frame limit
+    if (config.headless.enabled) {
+        config.headless.frameCount = stress.frameLimit;
+    }
+
     LOG_INFO(GENERAL, "=== Vulkan Engine Phase 1 Test ===");
     LOG_INFO(GENERAL, "Starting HelloTriangleApp...");
 
     try {
-        vkeng::Config config;
-        config.window.title = "Vulkan Engine - Phase 1";
-        config.window.width = 1280;
-        config.window.height = 720;
-        config.window.resizable = true;
-
         LOG_INFO(GENERAL, "Initializing Vulkan systems...");
-        vkeng::HelloTriangleApp app(config);
+        vkeng::HelloTriangleApp app(config, stress);
         app.run();
         LOG_INFO(GENERAL, "Application completed successfully!");
     } catch (const std::exception& e) {
         LOG_CRITICAL(GENERAL, "Fatal error: {}", e.what());
         return EXIT_FAILURE;
     }
-    
+
     LOG_INFO(GENERAL, "=== Phase 1 Test Complete ===");
     return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
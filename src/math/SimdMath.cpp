@@ -0,0 +1,108 @@
+#include "vulkan-engine/math/SimdMath.hpp"
+
+#include <cmath>
+
+namespace vkeng {
+    namespace simd {
+
+        /**
+         * @brief Composes a batch of TRS matrices from SoA component arrays.
+         */
+        void composeTrsBatch(const float* px, const float* py, const float* pz,
+                             const float* qx, const float* qy, const float* qz, const float* qw,
+                             const float* sx, const float* sy, const float* sz,
+                             size_t count, glm::mat4* outMatrices) {
+            for (size_t i = 0; i < count; i++) {
+                outMatrices[i] = composeTrs(
+                    glm::vec3(px[i], py[i], pz[i]),
+                    glm::quat(qw[i], qx[i], qy[i], qz[i]),
+                    glm::vec3(sx[i], sy[i], sz[i]));
+            }
+        }
+
+        /**
+         * @brief Batched parent * local multiply over parallel matrix arrays.
+         */
+        void multiplyBatch(const glm::mat4* parents, const glm::mat4* locals,
+                           glm::mat4* out, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                out[i] = multiply(parents[i], locals[i]);
+            }
+        }
+
+        /**
+         * @brief Culls a range of AABBs against six frustum planes.
+         */
+        size_t cullAabbs(const FrustumPlanesSoa& planes,
+                         const float* cx, const float* cy, const float* cz,
+                         const float* ex, const float* ey, const float* ez,
+                         size_t begin, size_t end, uint32_t* outVisible) {
+            size_t visible = 0;
+            size_t i = begin;
+
+#ifdef VKENG_SIMD_MATH_SSE
+            // Splat each plane equation once; the inner loop is then pure
+            // multiply-add over the SoA streams. absN is |normal| for the
+            // p-vertex projection of the half-extents.
+            __m128 pnx[6], pny[6], pnz[6], pd[6], pax[6], pay[6], paz[6];
+            const __m128 signMask = _mm_set1_ps(-0.0f);
+            for (int p = 0; p < 6; p++) {
+                pnx[p] = _mm_set1_ps(planes.nx[p]);
+                pny[p] = _mm_set1_ps(planes.ny[p]);
+                pnz[p] = _mm_set1_ps(planes.nz[p]);
+                pd[p] = _mm_set1_ps(planes.d[p]);
+                pax[p] = _mm_andnot_ps(signMask, pnx[p]);
+                pay[p] = _mm_andnot_ps(signMask, pny[p]);
+                paz[p] = _mm_andnot_ps(signMask, pnz[p]);
+            }
+
+            const __m128 zero = _mm_setzero_ps();
+            for (; i + 4 <= end; i += 4) {
+                const __m128 bcx = _mm_loadu_ps(cx + i);
+                const __m128 bcy = _mm_loadu_ps(cy + i);
+                const __m128 bcz = _mm_loadu_ps(cz + i);
+                const __m128 bex = _mm_loadu_ps(ex + i);
+                const __m128 bey = _mm_loadu_ps(ey + i);
+                const __m128 bez = _mm_loadu_ps(ez + i);
+
+                // inside &= dot(n, center) + d + dot(|n|, extents) >= 0
+                int insideMask = 0xF;
+                for (int p = 0; p < 6 && insideMask != 0; p++) {
+                    __m128 dist = _mm_add_ps(_mm_mul_ps(pnx[p], bcx), pd[p]);
+                    dist = _mm_add_ps(dist, _mm_mul_ps(pny[p], bcy));
+                    dist = _mm_add_ps(dist, _mm_mul_ps(pnz[p], bcz));
+                    dist = _mm_add_ps(dist, _mm_mul_ps(pax[p], bex));
+                    dist = _mm_add_ps(dist, _mm_mul_ps(pay[p], bey));
+                    dist = _mm_add_ps(dist, _mm_mul_ps(paz[p], bez));
+                    insideMask &= _mm_movemask_ps(_mm_cmpge_ps(dist, zero));
+                }
+
+                for (int lane = 0; lane < 4; lane++) {
+                    if (insideMask & (1 << lane)) {
+                        outVisible[visible++] = static_cast<uint32_t>(i + lane);
+                    }
+                }
+            }
+#endif
+
+            // Scalar path: full loop without SSE, tail (< 4 boxes) with it
+            for (; i < end; i++) {
+                bool inside = true;
+                for (int p = 0; p < 6 && inside; p++) {
+                    const float dist = planes.nx[p] * cx[i] + planes.ny[p] * cy[i] +
+                                       planes.nz[p] * cz[i] + planes.d[p] +
+                                       std::fabs(planes.nx[p]) * ex[i] +
+                                       std::fabs(planes.ny[p]) * ey[i] +
+                                       std::fabs(planes.nz[p]) * ez[i];
+                    inside = dist >= 0.0f;
+                }
+                if (inside) {
+                    outVisible[visible++] = static_cast<uint32_t>(i);
+                }
+            }
+
+            return visible;
+        }
+
+    } // namespace simd
+} // namespace vkeng
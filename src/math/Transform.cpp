@@ -1,4 +1,5 @@
 #include "vulkan-engine/math/Transform.hpp"
+#include "vulkan-engine/math/SimdMath.hpp"
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/gtx/euler_angles.hpp>
 
@@ -224,11 +225,10 @@ namespace vkeng {
      * @brief Recalculates the cached local transformation matrix and its inverse.
      */
     void Transform::updateMatrices() const {
-        glm::mat4 T = glm::translate(glm::mat4(1.0f), m_position);
-        glm::mat4 R = glm::mat4_cast(m_rotation);
-        glm::mat4 S = glm::scale(glm::mat4(1.0f), m_scale);
-        m_cachedMatrix = T * R * S;
-        m_cachedInverseMatrix = glm::inverse(m_cachedMatrix);
+        // Direct composition and analytic inverse — no T * R * S multiplies
+        // and no general cofactor inverse (see SimdMath.hpp)
+        m_cachedMatrix = simd::composeTrs(m_position, m_rotation, m_scale);
+        m_cachedInverseMatrix = simd::inverseTrs(m_position, m_rotation, m_scale);
         m_dirty = false;
     }
 
@@ -251,7 +251,7 @@ namespace vkeng {
      */
     glm::mat4 Transform::getWorldMatrix() const {
         if (m_parent) {
-            return m_parent->getWorldMatrix() * getMatrix();
+            return simd::multiply(m_parent->getWorldMatrix(), getMatrix());
         }
         return getMatrix();
     }
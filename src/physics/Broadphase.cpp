@@ -0,0 +1,129 @@
+#include "vulkan-engine/physics/Broadphase.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vkeng {
+
+    Broadphase::Broadphase(float cellSize, float fatMargin)
+        : m_cellSize(cellSize)
+        , m_fatMargin(fatMargin) {
+    }
+
+    /**
+     * @brief Packs signed cell coordinates into 21 bits each.
+     *
+     * Covers roughly ±1M cells per axis, far beyond any playable world at
+     * sane cell sizes.
+     */
+    uint64_t Broadphase::cellKey(int32_t x, int32_t y, int32_t z) {
+        constexpr uint64_t mask = 0x1FFFFF;
+        return ((static_cast<uint64_t>(x) & mask) << 42)
+             | ((static_cast<uint64_t>(y) & mask) << 21)
+             |  (static_cast<uint64_t>(z) & mask);
+    }
+
+    void Broadphase::update(SceneNode* node, const glm::vec3& tightMin, const glm::vec3& tightMax) {
+        Proxy& proxy = m_proxies[node];
+        proxy.tightMin = tightMin;
+        proxy.tightMax = tightMax;
+
+        // Resting / slow bodies stay inside their fat bounds: nothing to do
+        bool inside = !proxy.cells.empty()
+            && glm::all(glm::greaterThanEqual(tightMin, proxy.fatMin))
+            && glm::all(glm::lessThanEqual(tightMax, proxy.fatMax));
+        if (inside) {
+            return;
+        }
+
+        removeFromGrid(node, proxy);
+        proxy.fatMin = tightMin - glm::vec3(m_fatMargin);
+        proxy.fatMax = tightMax + glm::vec3(m_fatMargin);
+        insertIntoGrid(node, proxy);
+    }
+
+    void Broadphase::remove(SceneNode* node) {
+        auto it = m_proxies.find(node);
+        if (it == m_proxies.end()) {
+            return;
+        }
+        removeFromGrid(node, it->second);
+        m_proxies.erase(it);
+    }
+
+    void Broadphase::clear() {
+        m_proxies.clear();
+        m_grid.clear();
+    }
+
+    void Broadphase::insertIntoGrid(SceneNode* node, Proxy& proxy) {
+        int32_t minX = static_cast<int32_t>(std::floor(proxy.fatMin.x / m_cellSize));
+        int32_t minY = static_cast<int32_t>(std::floor(proxy.fatMin.y / m_cellSize));
+        int32_t minZ = static_cast<int32_t>(std::floor(proxy.fatMin.z / m_cellSize));
+        int32_t maxX = static_cast<int32_t>(std::floor(proxy.fatMax.x / m_cellSize));
+        int32_t maxY = static_cast<int32_t>(std::floor(proxy.fatMax.y / m_cellSize));
+        int32_t maxZ = static_cast<int32_t>(std::floor(proxy.fatMax.z / m_cellSize));
+
+        for (int32_t x = minX; x <= maxX; ++x) {
+            for (int32_t y = minY; y <= maxY; ++y) {
+                for (int32_t z = minZ; z <= maxZ; ++z) {
+                    uint64_t key = cellKey(x, y, z);
+                    m_grid[key].push_back(node);
+                    proxy.cells.push_back(key);
+                }
+            }
+        }
+    }
+
+    void Broadphase::removeFromGrid(SceneNode* node, Proxy& proxy) {
+        for (uint64_t key : proxy.cells) {
+            auto it = m_grid.find(key);
+            if (it == m_grid.end()) continue;
+
+            auto& occupants = it->second;
+            occupants.erase(std::remove(occupants.begin(), occupants.end(), node), occupants.end());
+            if (occupants.empty()) {
+                m_grid.erase(it);
+            }
+        }
+        proxy.cells.clear();
+    }
+
+    void Broadphase::computePairs(std::vector<std::pair<SceneNode*, SceneNode*>>& outPairs) const {
+        outPairs.clear();
+
+        // A pair sharing several cells would be reported once per cell;
+        // dedupe on the pointer-ordered pair identity.
+        std::unordered_set<uint64_t> seen;
+        seen.reserve(m_proxies.size() * 2);
+
+        for (const auto& [key, occupants] : m_grid) {
+            for (size_t i = 0; i + 1 < occupants.size(); ++i) {
+                for (size_t j = i + 1; j < occupants.size(); ++j) {
+                    SceneNode* a = occupants[i];
+                    SceneNode* b = occupants[j];
+                    if (a == b) continue;
+                    if (b < a) std::swap(a, b);
+
+                    uint64_t pairId = reinterpret_cast<uintptr_t>(a)
+                                    ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(b)) << 17);
+                    if (!seen.insert(pairId).second) {
+                        continue;
+                    }
+
+                    // Fat bounds put them in one cell; only emit the pair if
+                    // the tight bounds actually overlap.
+                    const Proxy& pa = m_proxies.at(a);
+                    const Proxy& pb = m_proxies.at(b);
+                    bool overlap = glm::all(glm::lessThanEqual(pa.tightMin, pb.tightMax))
+                                && glm::all(glm::lessThanEqual(pb.tightMin, pa.tightMax));
+                    if (overlap) {
+                        outPairs.emplace_back(a, b);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace vkeng
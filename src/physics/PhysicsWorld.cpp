@@ -1,47 +1,201 @@
 #include "vulkan-engine/physics/PhysicsWorld.hpp"
 #include "vulkan-engine/physics/RigidBody.hpp"
+#include "vulkan-engine/scene/SceneQueryIndex.hpp"
 #include "vulkan-engine/physics/Collider.hpp"
 #include "vulkan-engine/core/EventSystem.hpp"
 #include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+#include "vulkan-engine/core/Tunables.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    /** @brief Bodies below this integrate serially; threads don't pay off. */
+    constexpr size_t kParallelBodyThreshold = 1024;
+
+    /** @brief Contacts below this solve serially even with multiple islands. */
+    constexpr size_t kParallelContactThreshold = 64;
+
+    /** @brief Velocity restored along the normal after impact [0,1]. */
+    constexpr float kRestitution = 0.2f;
+
+    /** @brief Fraction of penetration corrected per step (Baumgarte). */
+    constexpr float kCorrectionPercent = 0.8f;
+
+    /** @brief Penetration tolerated without correction, prevents jitter. */
+    constexpr float kCorrectionSlop = 0.01f;
+
+    /** @brief Solver iterations per island per step (warm starting keeps this low). */
+    constexpr int kSolverIterations = 4;
+
+    /** @brief Speed below which a body accumulates low-motion steps (m/s). */
+    constexpr float kSleepVelocityThreshold = 0.05f;
+    constexpr float kSleepVelocityThresholdSq = kSleepVelocityThreshold * kSleepVelocityThreshold;
+
+    /** @brief Consecutive low-motion steps before a body sleeps (~1s at 60Hz). */
+    constexpr uint32_t kSleepStepsRequired = 60;
+
+    /** @brief Order-independent identity for a node pair (trigger edge tracking). */
+    uint64_t pairId(const vkeng::SceneNode* a, const vkeng::SceneNode* b) {
+        if (b < a) std::swap(a, b);
+        return reinterpret_cast<uintptr_t>(a)
+             ^ (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(b)) << 17);
+    }
+}
 
 namespace vkeng {
 
     PhysicsWorld::PhysicsWorld() {
+        // Bodies register themselves when their RigidBody component attaches,
+        // so step() never has to re-walk the scene graph.
+        m_attachListener = EventSystem::get().subscribe<RigidBodyAttachedEvent>(
+            [this](const RigidBodyAttachedEvent& e) { registerBody(e.node); });
+        m_detachListener = EventSystem::get().subscribe<RigidBodyDetachedEvent>(
+            [this](const RigidBodyDetachedEvent& e) { unregisterBody(e.node); });
+
+        // Live tunables: gravity changes apply at the next frame boundary,
+        // before the fixed-step loop reads m_gravity
+        Tunables::get().registerBool("physics.enabled", m_enabled,
+            [this](bool enabled) { m_enabled = enabled; },
+            "Physics stepping (off freezes all bodies)");
+        Tunables::get().registerFloat("physics.gravityY", m_gravity.y, -50.0f, 50.0f,
+            [this](float gravityY) { m_gravity.y = gravityY; },
+            "Vertical gravity (m/s^2, negative = down)");
+
         LOG_INFO(PHYSICS, "PhysicsWorld created (gravity: 0, -9.81, 0)");
     }
 
+    PhysicsWorld::~PhysicsWorld() {
+        Tunables::get().unregister("physics.enabled");
+        Tunables::get().unregister("physics.gravityY");
+        EventSystem::get().unsubscribe<RigidBodyAttachedEvent>(m_attachListener);
+        EventSystem::get().unsubscribe<RigidBodyDetachedEvent>(m_detachListener);
+    }
+
     void PhysicsWorld::step(float dt, SceneNode* sceneRoot) {
+        PROFILE_SCOPE("PhysicsWorld::step");
         if (!m_enabled || !sceneRoot) return;
 
-        m_bodies.clear();
-        collectBodies(sceneRoot);
+        // Settle any pending transform edits in one pass before bodies
+        // read world matrices (no-op if the renderer already flushed)
+        SceneNode::flushDirtyTransforms();
 
+        // Pick up bodies whose components attached before this world was
+        // created (and thus published events nobody heard).
+        if (!m_initialScanDone) {
+            collectBodies();
+            m_initialScanDone = true;
+            LOG_INFO(PHYSICS, "PhysicsWorld: initial scan registered {} bodies", m_bodies.size());
+        }
+
+        beginStepStates();
         integrate(dt);
         detectCollisions();
         resolveCollisions();
+        captureStepStates();
     }
 
     // ============================================================================
-    // Private helpers — stubs for now
+    // Fixed-Step Interpolation
     // ============================================================================
 
-    void PhysicsWorld::collectBodies(SceneNode* node) {
-        if (!node || !node->isActive()) return;
+    void PhysicsWorld::beginStepStates() {
+        // Transforms may hold an interpolated render pose from last frame's
+        // applyRenderInterpolation. Restore each body's true end-of-step
+        // position first so the simulation never integrates from a blended
+        // pose, then snapshot it as this step's "previous" state.
+        for (SceneNode* node : m_bodies) {
+            auto* rb = node->getComponent<RigidBody>();
+            if (!rb || rb->getBodyType() != BodyType::Dynamic) continue;
 
-        if (node->getComponent<RigidBody>() != nullptr) {
-            m_bodies.push_back(node);
+            if (rb->hasStepStates()) {
+                node->getTransform().setPosition(rb->getCurrentStepPosition());
+            }
+            rb->setPreviousStepPosition(node->getTransform().getPosition());
         }
+    }
 
-        for (auto& child : node->getChildren()) {
-            collectBodies(child.get());
+    void PhysicsWorld::captureStepStates() {
+        // Transforms now hold the authoritative post-integration,
+        // post-resolution pose; latch it as the interpolation target.
+        for (SceneNode* node : m_bodies) {
+            auto* rb = node->getComponent<RigidBody>();
+            if (!rb || rb->getBodyType() != BodyType::Dynamic) continue;
+            rb->setCurrentStepPosition(node->getTransform().getPosition());
         }
     }
 
-    void PhysicsWorld::integrate(float dt) {
-        for (auto* node : m_bodies) {
+    void PhysicsWorld::applyRenderInterpolation(float alpha) {
+        PROFILE_SCOPE("PhysicsWorld::applyRenderInterpolation");
+        if (!m_enabled || !m_interpolationEnabled) return;
+
+        alpha = glm::clamp(alpha, 0.0f, 1.0f);
+        for (SceneNode* node : m_bodies) {
+            auto* rb = node->getComponent<RigidBody>();
+            if (!rb || rb->getBodyType() != BodyType::Dynamic || !rb->hasStepStates()) continue;
+
+            node->getTransform().setPosition(
+                glm::mix(rb->getPreviousStepPosition(), rb->getCurrentStepPosition(), alpha));
+        }
+    }
+
+    // ============================================================================
+    // Body Registry
+    // ============================================================================
+
+    void PhysicsWorld::collectBodies() {
+        // Packed scan over the RigidBody pool via the query index — no
+        // tree traversal, and bodies on detached subtrees are found too
+        SceneQueryIndex::get().forEachNodeWith<RigidBody>(
+            [this](SceneNode& node, RigidBody&) {
+                registerBody(&node);
+            });
+    }
+
+    void PhysicsWorld::registerBody(SceneNode* node) {
+        if (!node) return;
+        if (std::find(m_bodies.begin(), m_bodies.end(), node) != m_bodies.end()) {
+            return;
+        }
+        m_bodies.push_back(node);
+    }
+
+    void PhysicsWorld::unregisterBody(SceneNode* node) {
+        m_bodies.erase(std::remove(m_bodies.begin(), m_bodies.end(), node), m_bodies.end());
+        m_broadphase.remove(node);
+    }
+
+    // ============================================================================
+    // Integration
+    // ============================================================================
+
+    /**
+     * @brief Integrates one contiguous range of the body registry.
+     *
+     * Writes only RigidBody state (each body belongs to exactly one range)
+     * and stashes the new position in m_integrationScratch instead of the
+     * Transform: setPosition() walks the scene graph marking caches dirty,
+     * which is not safe from worker threads.
+     */
+    void PhysicsWorld::integrateRange(float dt, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            SceneNode* node = m_bodies[i];
+            m_integrationScratch[i] = {nullptr, glm::vec3(0.0f)};
+
+            if (!node->isActive()) continue;
+
             auto rb = node->getComponent<RigidBody>();
             if (!rb || rb->getBodyType() != BodyType::Dynamic) continue;
 
+            if (m_sleepingEnabled && rb->isSleeping()) {
+                m_sleepingBodyCount.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            m_activeBodyCount.fetch_add(1, std::memory_order_relaxed);
+
             // Apply gravity
             if (rb->useGravity()) {
                 rb->addForce(m_gravity * rb->getMass());
@@ -56,25 +210,494 @@ namespace vkeng {
             velocity *= (1.0f - rb->getLinearDamping());
 
             rb->setVelocity(velocity);
+            rb->clearForces();
 
-            // Update node position
-            auto& transform = node->getTransform();
-            glm::vec3 position = transform.getPosition() + velocity * dt;
-            transform.setPosition(position);
+            // Sleep countdown: bodies that stay below the velocity threshold
+            // long enough stop integrating until something wakes them.
+            if (m_sleepingEnabled) {
+                if (glm::dot(velocity, velocity) < kSleepVelocityThresholdSq) {
+                    uint32_t lowMotionSteps = rb->getLowMotionSteps() + 1;
+                    rb->setLowMotionSteps(lowMotionSteps);
+                    if (lowMotionSteps >= kSleepStepsRequired) {
+                        rb->sleep();
+                        continue; // position unchanged; scratch entry stays null
+                    }
+                } else {
+                    rb->setLowMotionSteps(0);
+                }
+            }
 
-            rb->clearForces();
+            // Read through the const accessor: no dirty-marking, no races
+            const Transform& transform = static_cast<const SceneNode*>(node)->getTransform();
+            m_integrationScratch[i] = {node, transform.getPosition() + velocity * dt};
+        }
+    }
+
+    void PhysicsWorld::integrate(float dt) {
+        m_integrationScratch.resize(m_bodies.size());
+        m_activeBodyCount.store(0, std::memory_order_relaxed);
+        m_sleepingBodyCount.store(0, std::memory_order_relaxed);
+
+        uint32_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+        if (m_parallelEnabled && m_bodies.size() >= kParallelBodyThreshold && workerCount >= 2) {
+            size_t chunk = (m_bodies.size() + workerCount - 1) / workerCount;
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount);
+            for (size_t begin = 0; begin < m_bodies.size(); begin += chunk) {
+                size_t end = std::min(begin + chunk, m_bodies.size());
+                workers.emplace_back(&PhysicsWorld::integrateRange, this, dt, begin, end);
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        } else {
+            integrateRange(dt, 0, m_bodies.size());
+        }
+
+        // Batch write-back: all Transform (and dirty-flag) mutation is serial
+        for (const auto& [node, position] : m_integrationScratch) {
+            if (node) {
+                node->getTransform().setPosition(position);
+            }
         }
     }
 
+    // ============================================================================
+    // Collision Detection
+    // ============================================================================
+
+    /**
+     * @brief Computes a world-space AABB that encloses the node's collider.
+     *
+     * AABB colliders use the center/extent formulation (world extent is the
+     * absolute upper 3x3 applied to the half-extents); spheres conservatively
+     * scale the radius by the largest world axis length.
+     */
+    bool PhysicsWorld::computeWorldAABB(SceneNode* node, glm::vec3& outMin, glm::vec3& outMax) const {
+        auto collider = node->getComponent<Collider>();
+        if (!collider) {
+            return false;
+        }
+
+        glm::mat4 world = node->getWorldMatrix();
+        glm::vec3 center = glm::vec3(world * glm::vec4(collider->getOffset(), 1.0f));
+
+        if (collider->getShape() == ColliderShape::AABB) {
+            glm::mat3 absRotation(
+                glm::abs(glm::vec3(world[0])),
+                glm::abs(glm::vec3(world[1])),
+                glm::abs(glm::vec3(world[2])));
+            glm::vec3 extent = absRotation * collider->getHalfExtents();
+            outMin = center - extent;
+            outMax = center + extent;
+        } else {
+            float maxScale = std::max({glm::length(glm::vec3(world[0])),
+                                       glm::length(glm::vec3(world[1])),
+                                       glm::length(glm::vec3(world[2]))});
+            glm::vec3 extent(collider->getRadius() * maxScale);
+            outMin = center - extent;
+            outMax = center + extent;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Exact shape overlap test producing a contact.
+     *
+     * Box-box uses the minimum-penetration axis of the world AABBs;
+     * sphere-box tests the closest point on the box. Normal points A -> B.
+     */
+    bool PhysicsWorld::testPair(SceneNode* a, SceneNode* b, Contact& outContact) const {
+        auto colliderA = a->getComponent<Collider>();
+        auto colliderB = b->getComponent<Collider>();
+        if (!colliderA || !colliderB) return false;
+
+        // World-space sphere for a node (center, conservative radius)
+        auto worldSphere = [](SceneNode* node, const Collider& c, glm::vec3& center, float& radius) {
+            glm::mat4 world = node->getWorldMatrix();
+            center = glm::vec3(world * glm::vec4(c.getOffset(), 1.0f));
+            float maxScale = std::max({glm::length(glm::vec3(world[0])),
+                                       glm::length(glm::vec3(world[1])),
+                                       glm::length(glm::vec3(world[2]))});
+            radius = c.getRadius() * maxScale;
+        };
+
+        bool aIsSphere = colliderA->getShape() == ColliderShape::Sphere;
+        bool bIsSphere = colliderB->getShape() == ColliderShape::Sphere;
+
+        if (aIsSphere && bIsSphere) {
+            glm::vec3 centerA, centerB;
+            float radiusA, radiusB;
+            worldSphere(a, *colliderA, centerA, radiusA);
+            worldSphere(b, *colliderB, centerB, radiusB);
+
+            glm::vec3 delta = centerB - centerA;
+            float dist = glm::length(delta);
+            float radiusSum = radiusA + radiusB;
+            if (dist >= radiusSum) return false;
+
+            outContact.normal = dist > 1e-6f ? delta / dist : glm::vec3(0, 1, 0);
+            outContact.depth = radiusSum - dist;
+            outContact.point = centerA + outContact.normal * radiusA;
+        } else if (!aIsSphere && !bIsSphere) {
+            glm::vec3 minA, maxA, minB, maxB;
+            computeWorldAABB(a, minA, maxA);
+            computeWorldAABB(b, minB, maxB);
+
+            glm::vec3 overlap = glm::min(maxA, maxB) - glm::max(minA, minB);
+            if (overlap.x <= 0.0f || overlap.y <= 0.0f || overlap.z <= 0.0f) return false;
+
+            // Separate along the axis of least penetration
+            glm::vec3 centerDelta = (minB + maxB) * 0.5f - (minA + maxA) * 0.5f;
+            if (overlap.x <= overlap.y && overlap.x <= overlap.z) {
+                outContact.normal = glm::vec3(centerDelta.x < 0 ? -1 : 1, 0, 0);
+                outContact.depth = overlap.x;
+            } else if (overlap.y <= overlap.z) {
+                outContact.normal = glm::vec3(0, centerDelta.y < 0 ? -1 : 1, 0);
+                outContact.depth = overlap.y;
+            } else {
+                outContact.normal = glm::vec3(0, 0, centerDelta.z < 0 ? -1 : 1);
+                outContact.depth = overlap.z;
+            }
+            outContact.point = glm::max(minA, minB) + overlap * 0.5f;
+        } else {
+            // Normalize to sphere = A, box = B; flip the normal back if swapped
+            SceneNode* sphereNode = aIsSphere ? a : b;
+            SceneNode* boxNode = aIsSphere ? b : a;
+            const Collider& sphereCol = aIsSphere ? *colliderA : *colliderB;
+
+            glm::vec3 center;
+            float radius;
+            worldSphere(sphereNode, sphereCol, center, radius);
+
+            glm::vec3 boxMin, boxMax;
+            computeWorldAABB(boxNode, boxMin, boxMax);
+
+            glm::vec3 closest = glm::clamp(center, boxMin, boxMax);
+            glm::vec3 delta = closest - center;
+            float dist = glm::length(delta);
+            if (dist >= radius) return false;
+
+            glm::vec3 normal = dist > 1e-6f ? delta / dist : glm::vec3(0, 1, 0);
+            if (!aIsSphere) normal = -normal;
+
+            outContact.normal = normal;
+            outContact.depth = radius - dist;
+            outContact.point = closest;
+        }
+
+        outContact.nodeA = a;
+        outContact.nodeB = b;
+        return true;
+    }
+
+    /**
+     * @brief Refreshes broadphase proxies and runs the narrowphase.
+     *
+     * The uniform grid replaces the O(n²) all-pairs test; only bodies whose
+     * bounds escaped their fattened proxy get reinserted, so resting bodies
+     * cost a single containment check per step. Trigger overlaps are tracked
+     * as a pair set to produce enter/exit edges instead of contacts.
+     */
     void PhysicsWorld::detectCollisions() {
-        // TODO: Implement broadphase (spatial hash or sweep-and-prune)
-        //       followed by narrowphase (AABB-AABB, sphere-sphere, AABB-sphere)
-        //       For now this is a stub — no collision detection yet.
+        for (auto* node : m_bodies) {
+            if (!node->isActive()) {
+                m_broadphase.remove(node);
+                continue;
+            }
+
+            // Sleeping bodies don't move: keep the existing proxy so awake
+            // bodies can still collide with (and wake) them, skip the refresh.
+            auto rb = node->getComponent<RigidBody>();
+            if (rb && rb->isSleeping()) continue;
+
+            glm::vec3 aabbMin, aabbMax;
+            if (computeWorldAABB(node, aabbMin, aabbMax)) {
+                m_broadphase.update(node, aabbMin, aabbMax);
+            }
+        }
+
+        m_broadphase.computePairs(m_candidatePairs);
+
+        m_contacts.clear();
+        m_pendingTriggerEvents.clear();
+        std::unordered_map<uint64_t, std::pair<SceneNode*, SceneNode*>> currentTriggerPairs;
+
+        for (const auto& [a, b] : m_candidatePairs) {
+            auto colliderA = a->getComponent<Collider>();
+            auto colliderB = b->getComponent<Collider>();
+            if (!colliderA || !colliderB) continue;
+
+            auto rbA = a->getComponent<RigidBody>();
+            auto rbB = b->getComponent<RigidBody>();
+
+            // Two immovable bodies never produce a resolvable contact; a
+            // sleeping body counts as immovable until something awake reaches
+            // it, so settled pairs skip the narrowphase entirely.
+            bool aMoves = rbA && rbA->getBodyType() == BodyType::Dynamic && !rbA->isSleeping();
+            bool bMoves = rbB && rbB->getBodyType() == BodyType::Dynamic && !rbB->isSleeping();
+
+            if (colliderA->isTrigger() || colliderB->isTrigger()) {
+                Contact contact;
+                if (testPair(a, b, contact)) {
+                    uint64_t id = pairId(a, b);
+                    SceneNode* trigger = colliderA->isTrigger() ? a : b;
+                    SceneNode* other = colliderA->isTrigger() ? b : a;
+                    currentTriggerPairs.emplace(id, std::make_pair(trigger, other));
+                    if (m_activeTriggerPairs.find(id) == m_activeTriggerPairs.end()) {
+                        m_pendingTriggerEvents.push_back({trigger, other, true});
+                    }
+                }
+                continue;
+            }
+
+            if (!aMoves && !bMoves) continue;
+
+            Contact contact;
+            if (testPair(a, b, contact)) {
+                // Manifold cache: seed the solver with last step's impulse
+                auto cached = m_cachedImpulses.find(pairId(a, b));
+                if (cached != m_cachedImpulses.end()) {
+                    contact.accumulatedImpulse = cached->second;
+                }
+                m_contacts.push_back(contact);
+            }
+        }
+
+        // Exit edges: pairs that overlapped last step but not this one
+        for (const auto& [id, nodes] : m_activeTriggerPairs) {
+            if (currentTriggerPairs.find(id) == currentTriggerPairs.end()) {
+                m_pendingTriggerEvents.push_back({nodes.first, nodes.second, false});
+            }
+        }
+        m_activeTriggerPairs = std::move(currentTriggerPairs);
     }
 
+    // ============================================================================
+    // Collision Resolution
+    // ============================================================================
+
+    /**
+     * @brief Impulse-solves one island's contacts with warm starting.
+     *
+     * Sequential-impulse scheme: each contact carries an accumulated normal
+     * impulse which last step's value seeds (warm start), and iterations
+     * apply clamped deltas so the total never pulls bodies together. On
+     * stable stacks the warm-start impulse is already near the converged
+     * answer, so the fixed iteration count settles instead of jittering.
+     */
+    void PhysicsWorld::solveIsland(const std::vector<uint32_t>& contactIndices,
+                                   std::vector<std::pair<SceneNode*, glm::vec3>>& outCorrections) {
+        // Restitution bias from pre-solve velocities (target separating
+        // speed), computed for all contacts before any impulse is applied.
+        for (uint32_t index : contactIndices) {
+            Contact& contact = m_contacts[index];
+            auto rbA = contact.nodeA->getComponent<RigidBody>();
+            auto rbB = contact.nodeB->getComponent<RigidBody>();
+
+            glm::vec3 velocityA = rbA ? rbA->getVelocity() : glm::vec3(0.0f);
+            glm::vec3 velocityB = rbB ? rbB->getVelocity() : glm::vec3(0.0f);
+            float velAlongNormal = glm::dot(velocityB - velocityA, contact.normal);
+            contact.restitutionBias = kRestitution * std::max(-velAlongNormal, 0.0f);
+        }
+
+        // Warm start: re-apply the cached impulse along this step's normal
+        for (uint32_t index : contactIndices) {
+            const Contact& contact = m_contacts[index];
+            if (contact.accumulatedImpulse <= 0.0f) continue;
+
+            auto rbA = contact.nodeA->getComponent<RigidBody>();
+            auto rbB = contact.nodeB->getComponent<RigidBody>();
+            float invMassA = rbA ? rbA->getInverseMass() : 0.0f;
+            float invMassB = rbB ? rbB->getInverseMass() : 0.0f;
+
+            glm::vec3 impulse = contact.accumulatedImpulse * contact.normal;
+            if (rbA && invMassA > 0.0f) rbA->setVelocity(rbA->getVelocity() - impulse * invMassA);
+            if (rbB && invMassB > 0.0f) rbB->setVelocity(rbB->getVelocity() + impulse * invMassB);
+        }
+
+        for (int iteration = 0; iteration < kSolverIterations; ++iteration) {
+            for (uint32_t index : contactIndices) {
+                Contact& contact = m_contacts[index];
+                auto rbA = contact.nodeA->getComponent<RigidBody>();
+                auto rbB = contact.nodeB->getComponent<RigidBody>();
+
+                float invMassA = rbA ? rbA->getInverseMass() : 0.0f;
+                float invMassB = rbB ? rbB->getInverseMass() : 0.0f;
+                float invMassSum = invMassA + invMassB;
+                if (invMassSum <= 0.0f) continue;
+
+                glm::vec3 velocityA = rbA ? rbA->getVelocity() : glm::vec3(0.0f);
+                glm::vec3 velocityB = rbB ? rbB->getVelocity() : glm::vec3(0.0f);
+
+                float velAlongNormal = glm::dot(velocityB - velocityA, contact.normal);
+
+                // Clamp on the accumulated total, not the delta: a separating
+                // contact may unwind warm-start impulse but never attract
+                float delta = -(velAlongNormal - contact.restitutionBias) / invMassSum;
+                float newAccumulated = std::max(contact.accumulatedImpulse + delta, 0.0f);
+                delta = newAccumulated - contact.accumulatedImpulse;
+                contact.accumulatedImpulse = newAccumulated;
+                if (delta == 0.0f) continue;
+
+                glm::vec3 impulse = delta * contact.normal;
+                if (rbA && invMassA > 0.0f) rbA->setVelocity(velocityA - impulse * invMassA);
+                if (rbB && invMassB > 0.0f) rbB->setVelocity(velocityB + impulse * invMassB);
+            }
+        }
+
+        // Positional correction, deferred to the serial batch
+        for (uint32_t index : contactIndices) {
+            const Contact& contact = m_contacts[index];
+            auto rbA = contact.nodeA->getComponent<RigidBody>();
+            auto rbB = contact.nodeB->getComponent<RigidBody>();
+
+            float invMassA = rbA ? rbA->getInverseMass() : 0.0f;
+            float invMassB = rbB ? rbB->getInverseMass() : 0.0f;
+            float invMassSum = invMassA + invMassB;
+            if (invMassSum <= 0.0f) continue;
+
+            float magnitude = std::max(contact.depth - kCorrectionSlop, 0.0f)
+                            / invMassSum * kCorrectionPercent;
+            glm::vec3 correction = magnitude * contact.normal;
+
+            if (invMassA > 0.0f) outCorrections.emplace_back(contact.nodeA, -correction * invMassA);
+            if (invMassB > 0.0f) outCorrections.emplace_back(contact.nodeB, correction * invMassB);
+        }
+    }
+
+    /**
+     * @brief Partitions contacts into islands and solves them.
+     *
+     * Islands are connected components of the contact graph (union-find).
+     * Bodies in different islands share no contacts, so island solves are
+     * independent and run on worker threads for large contact counts. All
+     * Transform writes and event publishes happen serially afterwards.
+     *
+     * Before solving, each island is checked for disturbance: if any member
+     * is awake and moving, every sleeping body in the island is woken. Newly
+     * woken bodies make their own resting contacts eligible next step, so a
+     * wake-up front propagates through settled stacks layer by layer.
+     *
+     * After solving, each contact's accumulated impulse is written back to
+     * the manifold cache keyed by node pair; next step's matching contacts
+     * start from it instead of solving cold.
+     */
     void PhysicsWorld::resolveCollisions() {
-        // TODO: Impulse-based collision response
-        //       Publish CollisionEvent / TriggerEvent via EventSystem::get().publish()
+        m_islands.clear();
+
+        if (!m_contacts.empty()) {
+            // Union-find over bodies touched by contacts
+            std::unordered_map<SceneNode*, uint32_t> bodySlot;
+            std::vector<uint32_t> parent;
+            auto slotOf = [&](SceneNode* node) {
+                auto [it, inserted] = bodySlot.try_emplace(node, static_cast<uint32_t>(parent.size()));
+                if (inserted) parent.push_back(it->second);
+                return it->second;
+            };
+            std::function<uint32_t(uint32_t)> findRoot = [&](uint32_t i) {
+                while (parent[i] != i) {
+                    parent[i] = parent[parent[i]]; // path halving
+                    i = parent[i];
+                }
+                return i;
+            };
+
+            for (const auto& contact : m_contacts) {
+                uint32_t rootA = findRoot(slotOf(contact.nodeA));
+                uint32_t rootB = findRoot(slotOf(contact.nodeB));
+                if (rootA != rootB) parent[rootB] = rootA;
+            }
+
+            std::unordered_map<uint32_t, uint32_t> islandOfRoot;
+            for (uint32_t i = 0; i < m_contacts.size(); ++i) {
+                uint32_t root = findRoot(bodySlot.at(m_contacts[i].nodeA));
+                auto [it, inserted] = islandOfRoot.try_emplace(root, static_cast<uint32_t>(m_islands.size()));
+                if (inserted) m_islands.emplace_back();
+                m_islands[it->second].push_back(i);
+            }
+        }
+
+        // Wake-on-contact propagation: wake an island's sleepers only when
+        // something in it is actually moving — bodies in persistent resting
+        // contact (a box on the floor) must still be allowed to fall asleep.
+        for (const auto& island : m_islands) {
+            bool disturbed = false;
+            for (uint32_t index : island) {
+                const Contact& contact = m_contacts[index];
+                for (SceneNode* node : {contact.nodeA, contact.nodeB}) {
+                    auto rb = node->getComponent<RigidBody>();
+                    if (rb && rb->getBodyType() == BodyType::Dynamic && !rb->isSleeping()
+                        && glm::dot(rb->getVelocity(), rb->getVelocity()) > kSleepVelocityThresholdSq) {
+                        disturbed = true;
+                        break;
+                    }
+                }
+                if (disturbed) break;
+            }
+            if (!disturbed) continue;
+
+            for (uint32_t index : island) {
+                const Contact& contact = m_contacts[index];
+                for (SceneNode* node : {contact.nodeA, contact.nodeB}) {
+                    auto rb = node->getComponent<RigidBody>();
+                    if (rb && rb->isSleeping()) rb->wake();
+                }
+            }
+        }
+
+        // Solve islands, each into its own correction list
+        std::vector<std::vector<std::pair<SceneNode*, glm::vec3>>> corrections(m_islands.size());
+
+        uint32_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+        bool parallel = m_parallelEnabled && workerCount >= 2
+                     && m_islands.size() >= 2 && m_contacts.size() >= kParallelContactThreshold;
+
+        if (parallel) {
+            std::vector<std::thread> workers;
+            uint32_t threads = std::min<uint32_t>(workerCount, static_cast<uint32_t>(m_islands.size()));
+            workers.reserve(threads);
+            for (uint32_t w = 0; w < threads; ++w) {
+                workers.emplace_back([this, w, threads, &corrections]() {
+                    for (size_t island = w; island < m_islands.size(); island += threads) {
+                        solveIsland(m_islands[island], corrections[island]);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        } else {
+            for (size_t island = 0; island < m_islands.size(); ++island) {
+                solveIsland(m_islands[island], corrections[island]);
+            }
+        }
+
+        // Serial batch: Transform writes and event publishes
+        for (const auto& islandCorrections : corrections) {
+            for (const auto& [node, delta] : islandCorrections) {
+                auto& transform = node->getTransform();
+                transform.setPosition(transform.getPosition() + delta);
+            }
+        }
+
+        // Persist accumulated impulses for next step's warm start; pairs
+        // that separated this step simply drop out of the cache.
+        m_cachedImpulses.clear();
+        for (const auto& contact : m_contacts) {
+            m_cachedImpulses.emplace(pairId(contact.nodeA, contact.nodeB),
+                                     contact.accumulatedImpulse);
+        }
+
+        // Deferred: contact bursts would otherwise run every listener
+        // mid-step. Engine::run drains the queue after fixed updates.
+        for (const auto& contact : m_contacts) {
+            EventSystem::get().publishDeferred(CollisionEvent{
+                contact.nodeA, contact.nodeB, contact.point, contact.normal, contact.depth});
+        }
+        for (const auto& event : m_pendingTriggerEvents) {
+            EventSystem::get().publishDeferred(event);
+        }
     }
 
 } // namespace vkeng
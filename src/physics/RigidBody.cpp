@@ -1,4 +1,5 @@
 #include "vulkan-engine/physics/RigidBody.hpp"
+#include "vulkan-engine/core/EventSystem.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 
 namespace vkeng {
@@ -7,6 +8,18 @@ namespace vkeng {
         : m_bodyType(type)
         , m_mass(mass) {}
 
+    void RigidBody::initialize(SceneNode* owner) {
+        Component::initialize(owner);
+        EventSystem::get().publish(RigidBodyAttachedEvent{owner});
+    }
+
+    void RigidBody::destroy() {
+        if (getOwner()) {
+            EventSystem::get().publish(RigidBodyDetachedEvent{getOwner()});
+        }
+        Component::destroy();
+    }
+
     void RigidBody::update(float /*deltaTime*/) {
         // Integration is handled by PhysicsWorld::step(), not per-component update.
         // This is intentionally empty — RigidBody state is read/written by PhysicsWorld.
@@ -21,11 +34,13 @@ namespace vkeng {
 
     void RigidBody::addForce(const glm::vec3& force) {
         if (m_bodyType != BodyType::Dynamic) return;
+        if (m_sleeping) wake();
         m_accumulatedForce += force;
     }
 
     void RigidBody::addImpulse(const glm::vec3& impulse) {
         if (m_bodyType != BodyType::Dynamic) return;
+        if (m_sleeping) wake();
         float invMass = getInverseMass();
         m_velocity += impulse * invMass;
     }
@@ -34,4 +49,12 @@ namespace vkeng {
         m_accumulatedForce = glm::vec3(0.0f);
     }
 
+    void RigidBody::sleep() {
+        // Only dynamic bodies sleep; static/kinematic are never integrated.
+        if (m_bodyType != BodyType::Dynamic) return;
+        m_sleeping = true;
+        m_velocity = glm::vec3(0.0f);
+        m_accumulatedForce = glm::vec3(0.0f);
+    }
+
 } // namespace vkeng
@@ -0,0 +1,314 @@
+/**
+ * @file AnimationSystem.cpp
+ * @brief Implementation of skeletal pose evaluation and GPU skinning
+ */
+
+#include "vulkan-engine/rendering/AnimationSystem.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/math/SimdMath.hpp"
+
+#include <array>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    const std::vector<DescriptorBinding> kSkinnedBindings = {
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1,
+         VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT},
+    };
+}
+
+AnimationSystem::AnimationSystem(VulkanDevice& device,
+                                 std::shared_ptr<MemoryManager> memoryManager,
+                                 PipelineManager& pipelineManager,
+                                 uint32_t framesInFlight,
+                                 const std::filesystem::path& shaderDir)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager) {
+
+    VkDevice vkDevice = m_device.getDevice();
+
+    auto layoutResult = DescriptorSetLayout::create(vkDevice, kSkinnedBindings);
+    if (!layoutResult.isSuccess()) {
+        throw std::runtime_error("AnimationSystem: failed to create set layout: " +
+                                 layoutResult.getError().message);
+    }
+    m_setLayout = layoutResult.getValue();
+
+    auto poolResult = DescriptorPool::create(vkDevice, framesInFlight, {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, framesInFlight},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, framesInFlight},
+    });
+    if (!poolResult.isSuccess()) {
+        throw std::runtime_error("AnimationSystem: failed to create descriptor pool: " +
+                                 poolResult.getError().message);
+    }
+    m_descriptorPool = poolResult.getValue();
+
+    VkDescriptorSetLayout setLayout = m_setLayout->getHandle();
+
+    VkPushConstantRange pushRange{};
+    pushRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushRange.offset = 0;
+    pushRange.size = sizeof(SkinnedPush);
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &setLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushRange;
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("AnimationSystem: failed to create pipeline layout");
+    }
+
+    m_drawConfig.vertShaderPath = shaderDir / "skinned_vert.spv";
+    m_drawConfig.fragShaderPath = shaderDir / "skinned_frag.spv";
+    m_drawConfig.skinned = true;
+
+    m_frames.resize(framesInFlight);
+    for (auto& frame : m_frames) {
+        auto uboResult = m_memoryManager->createUniformBuffer(sizeof(FrameUbo));
+        auto paletteResult = m_memoryManager->createStorageBuffer(
+            VkDeviceSize(kMaxPaletteJoints) * sizeof(glm::mat4), true);
+        if (!uboResult.isSuccess() || !paletteResult.isSuccess()) {
+            throw std::runtime_error("AnimationSystem: failed to create frame buffers");
+        }
+        frame.ubo = uboResult.getValue();
+        frame.palettes = paletteResult.getValue();
+
+        auto setResult = m_descriptorPool->allocateDescriptorSet(m_setLayout);
+        if (!setResult.isSuccess()) {
+            throw std::runtime_error("AnimationSystem: failed to allocate descriptor set: " +
+                                     setResult.getError().message);
+        }
+        frame.set = setResult.getValue();
+
+        VkDescriptorBufferInfo uboInfo{frame.ubo->getHandle(), 0, sizeof(FrameUbo)};
+        VkDescriptorBufferInfo paletteInfo{frame.palettes->getHandle(), 0, VK_WHOLE_SIZE};
+
+        std::array<VkWriteDescriptorSet, 2> writes{};
+        std::array<VkDescriptorBufferInfo*, 2> infos = {&uboInfo, &paletteInfo};
+        const std::array<VkDescriptorType, 2> types = {
+            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER};
+        for (uint32_t i = 0; i < writes.size(); i++) {
+            writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[i].dstSet = frame.set;
+            writes[i].dstBinding = i;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = types[i];
+            writes[i].pBufferInfo = infos[i];
+        }
+        vkUpdateDescriptorSets(vkDevice, static_cast<uint32_t>(writes.size()),
+                               writes.data(), 0, nullptr);
+    }
+
+    LOG_INFO(RENDERING, "AnimationSystem created ({} palette joints per frame)",
+             kMaxPaletteJoints);
+}
+
+AnimationSystem::~AnimationSystem() {
+    if (m_pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_device.getDevice(), m_pipelineLayout, nullptr);
+    }
+}
+
+uint32_t AnimationSystem::addInstance(std::shared_ptr<Mesh> mesh,
+                                      const std::vector<SkinVertex>& skinStream,
+                                      std::shared_ptr<Skeleton> skeleton,
+                                      std::shared_ptr<AnimationClip> clip) {
+    if (!mesh || !skeleton || !clip) {
+        LOG_WARN(RENDERING, "AnimationSystem: addInstance with null resources");
+        return kInvalidInstance;
+    }
+    if (clip->jointCount() != skeleton->jointCount()) {
+        LOG_WARN(RENDERING, "AnimationSystem: clip joints ({}) do not match skeleton ({})",
+                 clip->jointCount(), skeleton->jointCount());
+        return kInvalidInstance;
+    }
+    if (mesh->hasCpuData() && skinStream.size() != mesh->getCpuVertices().size()) {
+        LOG_WARN(RENDERING, "AnimationSystem: skin stream has {} entries for {} vertices",
+                 skinStream.size(), mesh->getCpuVertices().size());
+        return kInvalidInstance;
+    }
+
+    const uint32_t joints = skeleton->jointCount();
+    if (m_paletteCursor + joints > kMaxPaletteJoints) {
+        LOG_WARN(RENDERING, "AnimationSystem: palette full ({} joints), instance rejected",
+                 kMaxPaletteJoints);
+        return kInvalidInstance;
+    }
+
+    auto bufferResult = m_memoryManager->createVertexBuffer(
+        skinStream.size() * sizeof(SkinVertex), true);
+    if (!bufferResult.isSuccess()) {
+        LOG_WARN(RENDERING, "AnimationSystem: failed to create skin buffer: {}",
+                 bufferResult.getError().message);
+        return kInvalidInstance;
+    }
+
+    auto instance = std::make_unique<Instance>();
+    instance->mesh = std::move(mesh);
+    instance->skinBuffer = bufferResult.getValue();
+    instance->skinBuffer->copyData(skinStream.data(),
+                                   skinStream.size() * sizeof(SkinVertex));
+    instance->skeleton = std::move(skeleton);
+    instance->clip = std::move(clip);
+    instance->paletteOffset = m_paletteCursor;
+    m_paletteCursor += joints;
+
+    instance->px.resize(joints);
+    instance->py.resize(joints);
+    instance->pz.resize(joints);
+    instance->qx.resize(joints);
+    instance->qy.resize(joints);
+    instance->qz.resize(joints);
+    instance->qw.resize(joints);
+    instance->sx.resize(joints);
+    instance->sy.resize(joints);
+    instance->sz.resize(joints);
+    instance->locals.resize(joints);
+    instance->palette.resize(joints, glm::mat4(1.0f));
+
+    m_instances.push_back(std::move(instance));
+    m_activeInstances++;
+    LOG_DEBUG(RENDERING, "AnimationSystem: instance {} registered ({} joints at offset {})",
+              m_instances.size() - 1, joints, m_instances.back()->paletteOffset);
+    return static_cast<uint32_t>(m_instances.size() - 1);
+}
+
+void AnimationSystem::removeInstance(uint32_t id) {
+    if (id >= m_instances.size() || !m_instances[id]->alive) {
+        return;
+    }
+    // The slot stays (ids are stable indices) but drops its GPU references;
+    // palette slices are allocated bump-style and not reclaimed — character
+    // sets are expected to be stable across a level's lifetime
+    m_instances[id]->alive = false;
+    m_instances[id]->mesh.reset();
+    m_instances[id]->skinBuffer.reset();
+    m_activeInstances--;
+}
+
+void AnimationSystem::setModelMatrix(uint32_t id, const glm::mat4& model) {
+    if (id < m_instances.size() && m_instances[id]->alive) {
+        m_instances[id]->model = model;
+    }
+}
+
+void AnimationSystem::setPlayback(uint32_t id, float speed, bool looping) {
+    if (id < m_instances.size() && m_instances[id]->alive) {
+        m_instances[id]->speed = speed;
+        m_instances[id]->looping = looping;
+    }
+}
+
+void AnimationSystem::update(float deltaTime) {
+    if (m_instances.empty()) {
+        return;
+    }
+
+    // One instance per job grain: a 100+ joint evaluation is comfortably
+    // past the scheduling overhead, and instances touch disjoint scratch
+    auto handle = JobSystem::get().parallelFor(m_instances.size(), 1,
+        [this, deltaTime](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Instance& inst = *m_instances[i];
+                if (!inst.alive) {
+                    continue;
+                }
+                inst.time += deltaTime * inst.speed;
+
+                const uint32_t joints = inst.skeleton->jointCount();
+                inst.clip->samplePose(inst.time, inst.looping,
+                    inst.px.data(), inst.py.data(), inst.pz.data(),
+                    inst.qx.data(), inst.qy.data(), inst.qz.data(), inst.qw.data(),
+                    inst.sx.data(), inst.sy.data(), inst.sz.data());
+
+                // SoA pose -> local joint matrices in one SIMD batch
+                simd::composeTrsBatch(
+                    inst.px.data(), inst.py.data(), inst.pz.data(),
+                    inst.qx.data(), inst.qy.data(), inst.qz.data(), inst.qw.data(),
+                    inst.sx.data(), inst.sy.data(), inst.sz.data(),
+                    joints, inst.locals.data());
+
+                // Forward pass over the parents-first array: locals become
+                // globals in place, then the palette folds in the inverse
+                // bind. No recursion, no node lookups.
+                const auto& parents = inst.skeleton->parents();
+                const auto& inverseBinds = inst.skeleton->inverseBinds();
+                for (uint32_t j = 0; j < joints; j++) {
+                    if (parents[j] >= 0) {
+                        inst.locals[j] = simd::multiply(inst.locals[parents[j]], inst.locals[j]);
+                    }
+                    inst.palette[j] = simd::multiply(inst.locals[j], inverseBinds[j]);
+                }
+            }
+        });
+    JobSystem::get().wait(handle);
+}
+
+void AnimationSystem::prepare(uint32_t frameIndex, const glm::mat4& viewProj,
+                              const glm::vec3& cameraPos) {
+    FrameUbo ubo{};
+    ubo.viewProj = viewProj;
+    ubo.cameraPos = glm::vec4(cameraPos, 1.0f);
+    m_frames[frameIndex].ubo->copyData(&ubo, sizeof(ubo));
+
+    for (const auto& instance : m_instances) {
+        if (!instance->alive) {
+            continue;
+        }
+        m_frames[frameIndex].palettes->copyData(
+            instance->palette.data(),
+            instance->palette.size() * sizeof(glm::mat4),
+            VkDeviceSize(instance->paletteOffset) * sizeof(glm::mat4));
+    }
+}
+
+void AnimationSystem::ensurePipeline(VkRenderPass renderPass, VkExtent2D extent) {
+    if (renderPass != m_builtRenderPass) {
+        m_pipeline = std::make_shared<Pipeline>(
+            m_device.getDevice(), renderPass, m_pipelineLayout, extent,
+            m_drawConfig, m_pipelineManager.getPipelineCacheHandle());
+        m_builtRenderPass = renderPass;
+    }
+}
+
+void AnimationSystem::recordDraws(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                                  VkExtent2D extent, uint32_t frameIndex) {
+    if (m_activeInstances == 0) {
+        return;
+    }
+
+    ensurePipeline(renderPass, extent);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->getPipeline());
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            m_pipelineLayout, 0, 1, &m_frames[frameIndex].set, 0, nullptr);
+
+    for (const auto& instance : m_instances) {
+        if (!instance->alive) {
+            continue;
+        }
+
+        instance->mesh->bind(commandBuffer);
+        VkBuffer skinBuffer = instance->skinBuffer->getHandle();
+        VkDeviceSize skinOffset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, 1, 1, &skinBuffer, &skinOffset);
+
+        SkinnedPush push{};
+        push.model = instance->model;
+        push.paletteOffset = instance->paletteOffset;
+        vkCmdPushConstants(commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
+                           0, sizeof(push), &push);
+
+        vkCmdDrawIndexed(commandBuffer, instance->mesh->getIndexCount(), 1, 0, 0, 0);
+    }
+}
+
+} // namespace vkeng
@@ -0,0 +1,150 @@
+#include "vulkan-engine/rendering/BindlessTextures.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <stdexcept>
+
+namespace vkeng {
+
+    BindlessTextureManager& BindlessTextureManager::get() {
+        static BindlessTextureManager instance;
+        return instance;
+    }
+
+    void BindlessTextureManager::initialize(VkDevice device, uint32_t capacity) {
+        if (isInitialized()) {
+            LOG_WARN(RENDERING, "BindlessTextureManager already initialized");
+            return;
+        }
+
+        m_device = device;
+        m_capacity = capacity;
+
+        // Single binding: a runtime-sized sampler2D array. PARTIALLY_BOUND
+        // lets draws run with unwritten slots (they must not index them),
+        // UPDATE_AFTER_BIND lets loader threads register textures while
+        // frames using the set are in flight.
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = capacity;
+        binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        VkDescriptorBindingFlags bindingFlags =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+        flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        flagsInfo.bindingCount = 1;
+        flagsInfo.pBindingFlags = &bindingFlags;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &binding;
+        layoutInfo.pNext = &flagsInfo;
+
+        if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_layout) != VK_SUCCESS) {
+            throw std::runtime_error("BindlessTextureManager: failed to create set layout");
+        }
+
+        VkDescriptorPoolSize poolSize{};
+        poolSize.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        poolSize.descriptorCount = capacity;
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        poolInfo.maxSets = 1;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+
+        if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_pool) != VK_SUCCESS) {
+            throw std::runtime_error("BindlessTextureManager: failed to create descriptor pool");
+        }
+
+        // Allocate the one set with the variable count fixed at capacity
+        VkDescriptorSetVariableDescriptorCountAllocateInfo countInfo{};
+        countInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+        countInfo.descriptorSetCount = 1;
+        countInfo.pDescriptorCounts = &capacity;
+
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorPool = m_pool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_layout;
+        allocInfo.pNext = &countInfo;
+
+        if (vkAllocateDescriptorSets(m_device, &allocInfo, &m_set) != VK_SUCCESS) {
+            throw std::runtime_error("BindlessTextureManager: failed to allocate descriptor set");
+        }
+
+        LOG_INFO(RENDERING, "BindlessTextureManager initialized ({} texture slots)", capacity);
+    }
+
+    uint32_t BindlessTextureManager::registerTexture(VkImageView imageView, VkSampler sampler) {
+        uint32_t index;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_freeIndices.empty()) {
+                index = m_freeIndices.back();
+                m_freeIndices.pop_back();
+            } else if (m_nextIndex < m_capacity) {
+                index = m_nextIndex++;
+            } else {
+                LOG_ERROR(RENDERING, "BindlessTextureManager: texture array full ({} slots)", m_capacity);
+                return UINT32_MAX;
+            }
+        }
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.imageView = imageView;
+        imageInfo.sampler = sampler;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_set;
+        write.dstBinding = 0;
+        write.dstArrayElement = index;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &imageInfo;
+
+        // UPDATE_AFTER_BIND: legal while the set is bound in pending command
+        // buffers, as long as those frames never index this fresh slot
+        vkUpdateDescriptorSets(m_device, 1, &write, 0, nullptr);
+
+        return index;
+    }
+
+    void BindlessTextureManager::unregisterTexture(uint32_t index) {
+        if (index == UINT32_MAX) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_freeIndices.push_back(index);
+    }
+
+    void BindlessTextureManager::cleanup() {
+        if (m_device == VK_NULL_HANDLE) {
+            return;
+        }
+        if (m_pool != VK_NULL_HANDLE) {
+            vkDestroyDescriptorPool(m_device, m_pool, nullptr);
+            m_pool = VK_NULL_HANDLE;
+        }
+        if (m_layout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(m_device, m_layout, nullptr);
+            m_layout = VK_NULL_HANDLE;
+        }
+        m_set = VK_NULL_HANDLE;
+        m_device = VK_NULL_HANDLE;
+        m_nextIndex = 0;
+        m_freeIndices.clear();
+    }
+
+} // namespace vkeng
@@ -22,6 +22,7 @@ namespace vkeng {
         m_right = glm::normalize(glm::cross(m_forward, up));
         m_up = glm::cross(m_right, m_forward);
         m_viewMatrix = glm::lookAt(eye, center, up);
+        invalidateDerivedState();
         syncTransform();
     }
 
@@ -49,7 +50,31 @@ namespace vkeng {
     }
 
     glm::mat4 Camera::getViewProjectionMatrix() const {
-        return getProjectionMatrix() * getViewMatrix();
+        if (m_derivedDirty) {
+            refreshDerivedState();
+        }
+        return m_viewProjMatrix;
+    }
+
+    glm::mat4 Camera::getInverseViewMatrix() const {
+        if (m_derivedDirty) {
+            refreshDerivedState();
+        }
+        return m_invViewMatrix;
+    }
+
+    glm::mat4 Camera::getInverseProjectionMatrix() const {
+        if (m_derivedDirty) {
+            refreshDerivedState();
+        }
+        return m_invProjMatrix;
+    }
+
+    const Frustum& Camera::getFrustum() const {
+        if (m_derivedDirty) {
+            refreshDerivedState();
+        }
+        return m_frustum;
     }
 
     void Camera::lookAt(const glm::vec3& target, const glm::vec3& up) {
@@ -64,12 +89,10 @@ namespace vkeng {
             1.0f
         );
 
-        glm::mat4 invProj = glm::inverse(getProjectionMatrix());
-        glm::vec4 eyeCoords = invProj * clipCoords;
+        glm::vec4 eyeCoords = getInverseProjectionMatrix() * clipCoords;
         eyeCoords = glm::vec4(eyeCoords.x, eyeCoords.y, -1.0f, 0.0f);
 
-        glm::mat4 invView = glm::inverse(getViewMatrix());
-        glm::vec4 worldCoords = invView * eyeCoords;
+        glm::vec4 worldCoords = getInverseViewMatrix() * eyeCoords;
 
         Ray ray;
         ray.origin = getPosition();
@@ -84,6 +107,18 @@ namespace vkeng {
 
     void Camera::rebuildViewMatrix() {
         m_viewMatrix = glm::lookAt(m_position, m_position + m_forward, m_up);
+        invalidateDerivedState();
+    }
+
+    void Camera::refreshDerivedState() const {
+        // One matrix multiply, two inversions, and one plane extraction per
+        // camera change — every getter afterwards is a cached read
+        glm::mat4 proj = getProjectionMatrix();
+        m_viewProjMatrix = proj * m_viewMatrix;
+        m_invViewMatrix = glm::inverse(m_viewMatrix);
+        m_invProjMatrix = glm::inverse(proj);
+        m_frustum = Frustum::fromMatrix(m_viewProjMatrix);
+        m_derivedDirty = false;
     }
 
     void Camera::syncTransform() {
@@ -102,21 +137,25 @@ namespace vkeng {
     void PerspectiveCamera::setFieldOfView(float fov) {
         m_fov = fov;
         m_projectionDirty = true;
+        invalidateDerivedState();
     }
 
     void PerspectiveCamera::setAspectRatio(float aspect) {
         m_aspect = aspect;
         m_projectionDirty = true;
+        invalidateDerivedState();
     }
 
     void PerspectiveCamera::setNearPlane(float near) {
         m_near = near;
         m_projectionDirty = true;
+        invalidateDerivedState();
     }
 
     void PerspectiveCamera::setFarPlane(float far) {
         m_far = far;
         m_projectionDirty = true;
+        invalidateDerivedState();
     }
 
     void PerspectiveCamera::setPerspective(float fov, float aspect, float near, float far) {
@@ -125,6 +164,7 @@ namespace vkeng {
         m_near = near;
         m_far = far;
         m_projectionDirty = true;
+        invalidateDerivedState();
     }
 
     glm::mat4 PerspectiveCamera::getProjectionMatrix() const {
@@ -137,10 +177,6 @@ namespace vkeng {
         return m_projectionMatrix;
     }
 
-    Frustum PerspectiveCamera::getFrustum() const {
-        return Frustum::fromMatrix(getViewProjectionMatrix());
-    }
-
     // ============================================================================
     // Frustum
     // ============================================================================
@@ -0,0 +1,186 @@
+/**
+ * @file ClusteredLighting.cpp
+ * @brief Implementation of clustered forward lighting (froxel binning)
+ */
+
+#include "vulkan-engine/rendering/ClusteredLighting.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    const std::vector<DescriptorBinding> kClusterBindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_FRAGMENT_BIT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_FRAGMENT_BIT},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_FRAGMENT_BIT},
+        {3, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_FRAGMENT_BIT},
+    };
+}
+
+std::shared_ptr<DescriptorSetLayout> ClusteredLighting::createSetLayout(VkDevice device) {
+    auto result = DescriptorSetLayout::create(device, kClusterBindings);
+    if (!result.isSuccess()) {
+        throw std::runtime_error("ClusteredLighting: failed to create set layout: " +
+                                 result.getError().message);
+    }
+    return result.getValue();
+}
+
+ClusteredLighting::ClusteredLighting(VulkanDevice& device,
+                                     std::shared_ptr<MemoryManager> memoryManager,
+                                     PipelineManager& pipelineManager,
+                                     uint32_t framesInFlight,
+                                     const std::filesystem::path& shaderDir)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager) {
+
+    VkDevice vkDevice = m_device.getDevice();
+
+    m_setLayout = createSetLayout(vkDevice);
+
+    auto poolResult = DescriptorPool::create(vkDevice, framesInFlight, {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 3 * framesInFlight},
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, framesInFlight},
+    });
+    if (!poolResult.isSuccess()) {
+        throw std::runtime_error("ClusteredLighting: failed to create descriptor pool: " +
+                                 poolResult.getError().message);
+    }
+    m_descriptorPool = poolResult.getValue();
+
+    VkDescriptorSetLayout setLayout = m_setLayout->getHandle();
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &setLayout;
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("ClusteredLighting: failed to create pipeline layout");
+    }
+
+    m_binPipeline = m_pipelineManager.getComputePipeline(
+        shaderDir / "light_cluster.spv", m_pipelineLayout);
+
+    // Cluster buffers are fixed-capacity: the grid never changes and the
+    // light SSBO is sized for kMaxLights up front, so frames never allocate.
+    m_frames.resize(framesInFlight);
+    for (auto& frame : m_frames) {
+        auto lightsResult = m_memoryManager->createStorageBuffer(
+            VkDeviceSize(kMaxLights) * sizeof(GpuLight), true);
+        auto countsResult = m_memoryManager->createStorageBuffer(
+            VkDeviceSize(kClusterCount) * sizeof(uint32_t), false);
+        auto indicesResult = m_memoryManager->createStorageBuffer(
+            VkDeviceSize(kClusterCount) * kMaxLightsPerCluster * sizeof(uint32_t), false);
+        auto paramsResult = m_memoryManager->createUniformBuffer(sizeof(ClusterParams));
+        if (!lightsResult.isSuccess() || !countsResult.isSuccess() ||
+            !indicesResult.isSuccess() || !paramsResult.isSuccess()) {
+            throw std::runtime_error("ClusteredLighting: failed to create cluster buffers");
+        }
+        frame.lights = lightsResult.getValue();
+        frame.counts = countsResult.getValue();
+        frame.indices = indicesResult.getValue();
+        frame.params = paramsResult.getValue();
+
+        auto setResult = m_descriptorPool->allocateDescriptorSet(m_setLayout);
+        if (!setResult.isSuccess()) {
+            throw std::runtime_error("ClusteredLighting: failed to allocate descriptor set: " +
+                                     setResult.getError().message);
+        }
+        frame.set = setResult.getValue();
+
+        VkDescriptorBufferInfo lightInfo{frame.lights->getHandle(), 0, VK_WHOLE_SIZE};
+        VkDescriptorBufferInfo countInfo{frame.counts->getHandle(), 0, VK_WHOLE_SIZE};
+        VkDescriptorBufferInfo indexInfo{frame.indices->getHandle(), 0, VK_WHOLE_SIZE};
+        VkDescriptorBufferInfo paramInfo{frame.params->getHandle(), 0, sizeof(ClusterParams)};
+
+        std::array<VkWriteDescriptorSet, 4> writes{};
+        std::array<VkDescriptorBufferInfo*, 4> infos = {&lightInfo, &countInfo, &indexInfo, &paramInfo};
+        for (uint32_t i = 0; i < writes.size(); i++) {
+            writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[i].dstSet = frame.set;
+            writes[i].dstBinding = i;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = (i < 3) ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+                                               : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[i].pBufferInfo = infos[i];
+        }
+        vkUpdateDescriptorSets(vkDevice, static_cast<uint32_t>(writes.size()),
+                               writes.data(), 0, nullptr);
+    }
+
+    LOG_INFO(RENDERING, "ClusteredLighting created ({}x{}x{} grid, {} lights max, {} per cluster)",
+             kGridX, kGridY, kGridZ, kMaxLights, kMaxLightsPerCluster);
+}
+
+ClusteredLighting::~ClusteredLighting() {
+    if (m_pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_device.getDevice(), m_pipelineLayout, nullptr);
+    }
+}
+
+void ClusteredLighting::prepare(uint32_t frameIndex,
+                                const GpuLight* lights, uint32_t lightCount,
+                                const glm::mat4& view, const glm::mat4& proj,
+                                float nearPlane, float farPlane,
+                                VkExtent2D framebufferExtent) {
+    FrameResources& frame = m_frames[frameIndex];
+
+    if (lightCount > kMaxLights) {
+        LOG_WARN(RENDERING, "ClusteredLighting: {} lights exceed capacity {}, extra lights dropped",
+                 lightCount, kMaxLights);
+        lightCount = kMaxLights;
+    }
+    frame.lightCount = lightCount;
+
+    if (lightCount > 0) {
+        frame.lights->copyData(lights, VkDeviceSize(lightCount) * sizeof(GpuLight));
+    }
+
+    ClusterParams params{};
+    params.view = view;
+    params.gridSize = glm::vec4(float(kGridX), float(kGridY), float(kGridZ),
+                                static_cast<float>(lightCount));
+    params.zPlanes = glm::vec4(nearPlane, farPlane,
+                               static_cast<float>(framebufferExtent.width),
+                               static_cast<float>(framebufferExtent.height));
+    params.projFactors = glm::vec4(proj[0][0], proj[1][1], 0.0f, 0.0f);
+    frame.params->copyData(&params, sizeof(params));
+}
+
+void ClusteredLighting::recordBuild(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    FrameResources& frame = m_frames[frameIndex];
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                      m_binPipeline->getPipeline());
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                            m_pipelineLayout, 0, 1, &frame.set, 0, nullptr);
+
+    uint32_t groups = (kClusterCount + 63) / 64;
+    vkCmdDispatch(commandBuffer, groups, 1, 1);
+
+    // Make the cluster counts and index lists visible to fragment shading
+    std::array<VkBufferMemoryBarrier, 2> barriers{};
+    for (auto& barrier : barriers) {
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.offset = 0;
+        barrier.size = VK_WHOLE_SIZE;
+    }
+    barriers[0].buffer = frame.counts->getHandle();
+    barriers[1].buffer = frame.indices->getHandle();
+
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        0, 0, nullptr,
+        static_cast<uint32_t>(barriers.size()), barriers.data(), 0, nullptr);
+}
+
+} // namespace vkeng
@@ -1,8 +1,12 @@
 #include "vulkan-engine/rendering/CommandBuffer.hpp"
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+#include "vulkan-engine/rendering/Pipeline.hpp"
 #include "vulkan-engine/core/Buffer.hpp"
 #include "vulkan-engine/core/Result.hpp"
 #include <iostream>
 #include <cassert>
+#include <cstring>
+#include <string>
 
 namespace vkeng {
 
@@ -97,6 +101,8 @@ namespace vkeng {
             return Result<void>(Error("Failed to begin command buffer recording", result));
         }
 
+        // A fresh recording starts with no GPU state bound
+        m_state.reset();
         m_isRecording = true;
         return Result<void>();
     }
@@ -131,6 +137,7 @@ namespace vkeng {
             return Result<void>(Error("Failed to reset command buffer", result));
         }
 
+        m_state.reset();
         return Result<void>();
     }
 
@@ -181,16 +188,45 @@ namespace vkeng {
     // Pipeline Commands
     // ============================================================================
 
+    namespace {
+        /// Maps a bind point to its TrackedState::pipelines/sets index;
+        /// -1 for bind points the tracker does not cover (ray tracing)
+        int trackedBindPointIndex(VkPipelineBindPoint bindPoint) {
+            switch (bindPoint) {
+                case VK_PIPELINE_BIND_POINT_GRAPHICS: return 0;
+                case VK_PIPELINE_BIND_POINT_COMPUTE:  return 1;
+                default:                              return -1;
+            }
+        }
+    }
+
     /**
      * @brief Binds a graphics or compute pipeline.
+     * @details With state tracking enabled, re-binding the pipeline already
+     * bound at this bind point is a no-op.
      */
     void CommandBuffer::bindPipeline(VkPipelineBindPoint bindPoint, VkPipeline pipeline) {
         assert(m_isRecording && "Command buffer must be recording");
+
+        const int slot = trackedBindPointIndex(bindPoint);
+        if (m_stateTracking && slot >= 0) {
+            if (m_state.pipelines[slot] == pipeline) {
+                return;
+            }
+            m_state.pipelines[slot] = pipeline;
+        }
+
         vkCmdBindPipeline(m_commandBuffer, bindPoint, pipeline);
     }
 
     /**
      * @brief Binds descriptor sets to the command buffer.
+     * @details With state tracking enabled (and no dynamic offsets, which
+     * make an identical-looking bind meaningful), slots already holding the
+     * same set under the same layout are trimmed from both ends of the
+     * range; a fully redundant call records nothing. Layouts are part of
+     * the comparison because the same set bound under an incompatible
+     * layout is a real state change.
      */
     void CommandBuffer::bindDescriptorSets(
         VkPipelineBindPoint bindPoint,
@@ -198,16 +234,38 @@ namespace vkeng {
         uint32_t firstSet,
         const std::vector<VkDescriptorSet>& descriptorSets,
         const std::vector<uint32_t>& dynamicOffsets) {
-        
+
         assert(m_isRecording && "Command buffer must be recording");
-        
+
+        uint32_t first = firstSet;
+        uint32_t count = static_cast<uint32_t>(descriptorSets.size());
+        uint32_t begin = 0;
+
+        const int slot = trackedBindPointIndex(bindPoint);
+        const bool track = m_stateTracking && slot >= 0 && dynamicOffsets.empty() &&
+                           firstSet + count <= kTrackedSets;
+        if (track) {
+            auto matches = [&](uint32_t i) {
+                const TrackedState::SetSlot& tracked = m_state.sets[slot][firstSet + i];
+                return tracked.layout == layout && tracked.set == descriptorSets[i];
+            };
+            while (count > 0 && matches(begin)) { begin++; first++; count--; }
+            while (count > 0 && matches(begin + count - 1)) { count--; }
+            if (count == 0) {
+                return;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                m_state.sets[slot][first + i] = {layout, descriptorSets[begin + i]};
+            }
+        }
+
         vkCmdBindDescriptorSets(
             m_commandBuffer,
             bindPoint,
             layout,
-            firstSet,
-            static_cast<uint32_t>(descriptorSets.size()),
-            descriptorSets.data(),
+            first,
+            count,
+            descriptorSets.data() + begin,
             static_cast<uint32_t>(dynamicOffsets.size()),
             dynamicOffsets.empty() ? nullptr : dynamicOffsets.data()
         );
@@ -219,25 +277,46 @@ namespace vkeng {
 
     /**
      * @brief Binds vertex buffers to the command buffer.
+     * @details With state tracking enabled, a call re-binding exactly the
+     * buffers and offsets already bound over the whole range is dropped.
      */
     void CommandBuffer::bindVertexBuffers(
         uint32_t firstBinding,
         const std::vector<VkBuffer>& buffers,
         const std::vector<VkDeviceSize>& offsets) {
-        
+
         assert(m_isRecording && "Command buffer must be recording");
-        
+
         std::vector<VkDeviceSize> actualOffsets = offsets;
         if (actualOffsets.empty()) {
             actualOffsets.resize(buffers.size(), 0);
         }
-        
+
         assert(buffers.size() == actualOffsets.size() && "Buffer and offset count must match");
-        
+
+        const uint32_t count = static_cast<uint32_t>(buffers.size());
+        if (m_stateTracking && firstBinding + count <= kTrackedVertexBindings) {
+            bool redundant = true;
+            for (uint32_t i = 0; i < count; i++) {
+                if (m_state.vertexBuffers[firstBinding + i] != buffers[i] ||
+                    m_state.vertexOffsets[firstBinding + i] != actualOffsets[i]) {
+                    redundant = false;
+                    break;
+                }
+            }
+            if (redundant) {
+                return;
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                m_state.vertexBuffers[firstBinding + i] = buffers[i];
+                m_state.vertexOffsets[firstBinding + i] = actualOffsets[i];
+            }
+        }
+
         vkCmdBindVertexBuffers(
             m_commandBuffer,
             firstBinding,
-            static_cast<uint32_t>(buffers.size()),
+            count,
             buffers.data(),
             actualOffsets.data()
         );
@@ -245,9 +324,22 @@ namespace vkeng {
 
     /**
      * @brief Binds an index buffer to the command buffer.
+     * @details With state tracking enabled, re-binding the same buffer,
+     * offset, and index type is a no-op.
      */
     void CommandBuffer::bindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
         assert(m_isRecording && "Command buffer must be recording");
+
+        if (m_stateTracking) {
+            if (m_state.indexBuffer == buffer && m_state.indexOffset == offset &&
+                m_state.indexType == indexType) {
+                return;
+            }
+            m_state.indexBuffer = buffer;
+            m_state.indexOffset = offset;
+            m_state.indexType = indexType;
+        }
+
         vkCmdBindIndexBuffer(m_commandBuffer, buffer, offset, indexType);
     }
 
@@ -275,6 +367,35 @@ namespace vkeng {
                         vertexOffset, firstInstance);
     }
 
+    // ============================================================================
+    // Compute Commands
+    // ============================================================================
+
+    /**
+     * @brief Binds a compute pipeline at the COMPUTE bind point.
+     */
+    void CommandBuffer::bindComputePipeline(const ComputePipeline& pipeline) {
+        // Routed through bindPipeline so the tracker covers it too
+        bindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline.getPipeline());
+    }
+
+    /**
+     * @brief Records a compute dispatch.
+     */
+    void CommandBuffer::dispatch(uint32_t groupCountX, uint32_t groupCountY,
+                                uint32_t groupCountZ) {
+        assert(m_isRecording && "Command buffer must be recording");
+        vkCmdDispatch(m_commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+
+    /**
+     * @brief Records an indirect dispatch (workgroup counts read from a buffer).
+     */
+    void CommandBuffer::dispatchIndirect(VkBuffer buffer, VkDeviceSize offset) {
+        assert(m_isRecording && "Command buffer must be recording");
+        vkCmdDispatchIndirect(m_commandBuffer, buffer, offset);
+    }
+
     // ============================================================================
     // Push Constants
     // ============================================================================
@@ -361,9 +482,26 @@ namespace vkeng {
 
     /**
      * @brief Sets the viewport dynamically.
+     * @details Tracking covers the single-viewport case only (all the
+     * engine's passes); multi-viewport calls record unconditionally and
+     * drop the tracked value.
      */
     void CommandBuffer::setViewport(uint32_t firstViewport, const std::vector<VkViewport>& viewports) {
         assert(m_isRecording && "Command buffer must be recording");
+
+        if (m_stateTracking) {
+            if (firstViewport == 0 && viewports.size() == 1) {
+                if (m_state.viewportValid &&
+                    std::memcmp(&m_state.viewport, &viewports[0], sizeof(VkViewport)) == 0) {
+                    return;
+                }
+                m_state.viewport = viewports[0];
+                m_state.viewportValid = true;
+            } else {
+                m_state.viewportValid = false;
+            }
+        }
+
         vkCmdSetViewport(
             m_commandBuffer,
             firstViewport,
@@ -374,9 +512,24 @@ namespace vkeng {
 
     /**
      * @brief Sets the scissor rectangle dynamically.
+     * @details Same single-rect tracking rule as setViewport().
      */
     void CommandBuffer::setScissor(uint32_t firstScissor, const std::vector<VkRect2D>& scissors) {
         assert(m_isRecording && "Command buffer must be recording");
+
+        if (m_stateTracking) {
+            if (firstScissor == 0 && scissors.size() == 1) {
+                if (m_state.scissorValid &&
+                    std::memcmp(&m_state.scissor, &scissors[0], sizeof(VkRect2D)) == 0) {
+                    return;
+                }
+                m_state.scissor = scissors[0];
+                m_state.scissorValid = true;
+            } else {
+                m_state.scissorValid = false;
+            }
+        }
+
         vkCmdSetScissor(
             m_commandBuffer,
             firstScissor,
@@ -449,6 +602,22 @@ namespace vkeng {
         }
     }
 
+    /**
+     * @brief Opens a GPU timestamp scope on this buffer.
+     */
+    void CommandBuffer::beginGpuScope(const char* scopeName) {
+        assert(m_isRecording && "Command buffer must be recording");
+        GpuProfiler::get().beginScope(m_commandBuffer, scopeName);
+    }
+
+    /**
+     * @brief Closes the innermost GPU timestamp scope.
+     */
+    void CommandBuffer::endGpuScope() {
+        assert(m_isRecording && "Command buffer must be recording");
+        GpuProfiler::get().endScope(m_commandBuffer);
+    }
+
     // ============================================================================
     // Queue Implementation
     // ============================================================================
@@ -523,6 +692,104 @@ namespace vkeng {
         return fence->wait();
     }
 
+    // ============================================================================
+    // SubmissionBatch Implementation
+    // ============================================================================
+
+    /**
+     * @brief Queues one submission entry for a later single vkQueueSubmit.
+     * @details Validates the same invariants as Queue::submit() at add time,
+     * so a flush never fails halfway through building the submit array.
+     */
+    Result<void> SubmissionBatch::add(
+        const std::vector<std::shared_ptr<CommandBuffer>>& commandBuffers,
+        const std::vector<VkSemaphore>& waitSemaphores,
+        const std::vector<VkPipelineStageFlags>& waitStages,
+        const std::vector<uint64_t>& waitValues,
+        const std::vector<VkSemaphore>& signalSemaphores,
+        const std::vector<uint64_t>& signalValues) {
+
+        if (commandBuffers.empty()) {
+            return Result<void>(Error("No command buffers provided for batch entry"));
+        }
+        if (!waitSemaphores.empty() && waitSemaphores.size() != waitStages.size()) {
+            return Result<void>(Error("Wait semaphore and stage count mismatch"));
+        }
+        if (!waitValues.empty() && waitValues.size() != waitSemaphores.size()) {
+            return Result<void>(Error("Wait semaphore and timeline value count mismatch"));
+        }
+        if (!signalValues.empty() && signalValues.size() != signalSemaphores.size()) {
+            return Result<void>(Error("Signal semaphore and timeline value count mismatch"));
+        }
+
+        Entry entry;
+        entry.commandBuffers.reserve(commandBuffers.size());
+        for (const auto& cmdBuffer : commandBuffers) {
+            if (!cmdBuffer) return Result<void>(Error("Null command buffer in batch entry"));
+            if (cmdBuffer->isRecording()) return Result<void>(Error("Cannot batch command buffer that is still recording"));
+            entry.commandBuffers.push_back(cmdBuffer->getHandle());
+        }
+        entry.waitSemaphores = waitSemaphores;
+        entry.waitStages = waitStages;
+        entry.waitValues = waitValues;
+        entry.signalSemaphores = signalSemaphores;
+        entry.signalValues = signalValues;
+        entry.usesTimeline = !waitValues.empty() || !signalValues.empty();
+
+        m_entries.push_back(std::move(entry));
+        return Result<void>();
+    }
+
+    /**
+     * @brief Flushes every batched entry in one vkQueueSubmit.
+     * @details Builds one VkSubmitInfo per entry (chaining a
+     * VkTimelineSemaphoreSubmitInfo for entries with timeline values) and
+     * submits them all with a single call. Entries execute in add() order;
+     * the optional fence signals when the last one retires.
+     */
+    Result<void> Queue::submitBatch(const SubmissionBatch& batch, VkFence fence) {
+        if (batch.empty()) {
+            return Result<void>(Error("No submissions batched"));
+        }
+
+        // Both vectors are sized up front so the pNext pointers into
+        // timelineInfos stay stable while the array is built
+        std::vector<VkSubmitInfo> submitInfos(batch.m_entries.size());
+        std::vector<VkTimelineSemaphoreSubmitInfo> timelineInfos(batch.m_entries.size());
+
+        for (size_t i = 0; i < batch.m_entries.size(); i++) {
+            const SubmissionBatch::Entry& entry = batch.m_entries[i];
+
+            VkSubmitInfo& submitInfo = submitInfos[i];
+            submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.waitSemaphoreCount = static_cast<uint32_t>(entry.waitSemaphores.size());
+            submitInfo.pWaitSemaphores = entry.waitSemaphores.empty() ? nullptr : entry.waitSemaphores.data();
+            submitInfo.pWaitDstStageMask = entry.waitStages.empty() ? nullptr : entry.waitStages.data();
+            submitInfo.commandBufferCount = static_cast<uint32_t>(entry.commandBuffers.size());
+            submitInfo.pCommandBuffers = entry.commandBuffers.data();
+            submitInfo.signalSemaphoreCount = static_cast<uint32_t>(entry.signalSemaphores.size());
+            submitInfo.pSignalSemaphores = entry.signalSemaphores.empty() ? nullptr : entry.signalSemaphores.data();
+
+            if (entry.usesTimeline) {
+                VkTimelineSemaphoreSubmitInfo& timelineInfo = timelineInfos[i];
+                timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+                timelineInfo.waitSemaphoreValueCount = static_cast<uint32_t>(entry.waitValues.size());
+                timelineInfo.pWaitSemaphoreValues = entry.waitValues.empty() ? nullptr : entry.waitValues.data();
+                timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(entry.signalValues.size());
+                timelineInfo.pSignalSemaphoreValues = entry.signalValues.empty() ? nullptr : entry.signalValues.data();
+                submitInfo.pNext = &timelineInfo;
+            }
+        }
+
+        VkResult result = vkQueueSubmit(m_queue, static_cast<uint32_t>(submitInfos.size()),
+                                        submitInfos.data(), fence);
+        if (result != VK_SUCCESS) {
+            return Result<void>(Error("Failed to submit batch to queue", result));
+        }
+
+        return Result<void>();
+    }
+
     /**
      * @brief Presents a swap chain image to the screen.
      */
@@ -535,6 +802,11 @@ namespace vkeng {
             return Result<void>(Error("Swapchain and image index count mismatch"));
         }
         
+        // Per-swapchain results: with several windows in one present call
+        // the aggregate VkResult only reports the worst case, so collect
+        // the individual outcomes to pin failures to a swapchain
+        std::vector<VkResult> results(swapchains.size(), VK_SUCCESS);
+
         VkPresentInfoKHR presentInfo = {};
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
@@ -542,12 +814,20 @@ namespace vkeng {
         presentInfo.swapchainCount = static_cast<uint32_t>(swapchains.size());
         presentInfo.pSwapchains = swapchains.data();
         presentInfo.pImageIndices = imageIndices.data();
-        
+        presentInfo.pResults = results.data();
+
         VkResult result = vkQueuePresentKHR(m_queue, &presentInfo);
         if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+            for (size_t i = 0; i < results.size(); i++) {
+                if (results[i] != VK_SUCCESS && results[i] != VK_SUBOPTIMAL_KHR) {
+                    return Result<void>(Error(
+                        "Failed to present swapchain image (swapchain " +
+                        std::to_string(i) + ")", results[i]));
+                }
+            }
             return Result<void>(Error("Failed to present swapchain image", result));
         }
-        
+
         return Result<void>();
     }
 
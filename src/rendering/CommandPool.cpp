@@ -34,6 +34,28 @@ namespace vkeng {
         }
     }
 
+    /**
+     * @brief Allocates command buffers from this pool.
+     * @param count Number of command buffers to allocate.
+     * @param level Command buffer level (primary or secondary).
+     */
+    Result<std::vector<VkCommandBuffer>> CommandPool::allocateCommandBuffers(
+            uint32_t count, VkCommandBufferLevel level) {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = commandPool_;
+        allocInfo.level = level;
+        allocInfo.commandBufferCount = count;
+
+        std::vector<VkCommandBuffer> buffers(count, VK_NULL_HANDLE);
+        VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, buffers.data());
+        if (result != VK_SUCCESS) {
+            return Result<std::vector<VkCommandBuffer>>(
+                Error("Failed to allocate command buffers from pool", result));
+        }
+        return Result<std::vector<VkCommandBuffer>>(std::move(buffers));
+    }
+
     /**
      * @brief A utility function to begin recording a command buffer for a single-time submission.
      * @return The allocated and begun command buffer.
@@ -113,4 +135,22 @@ namespace vkeng {
         return Result<void>();
     }
 
+    // ============================================================================
+    // PerThreadCommandPools Implementation
+    // ============================================================================
+
+    /**
+     * @brief Creates one command pool per worker thread.
+     *
+     * Vulkan command pools are externally synchronized, so each worker thread
+     * that records command buffers concurrently must allocate from its own pool.
+     */
+    PerThreadCommandPools::PerThreadCommandPools(VkDevice device, uint32_t queueFamilyIndex,
+                                                 uint32_t threadCount) {
+        pools_.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; i++) {
+            pools_.push_back(std::make_unique<CommandPool>(device, queueFamilyIndex));
+        }
+    }
+
 } // namespace vkeng
\ No newline at end of file
@@ -1,11 +1,86 @@
 #include "vulkan-engine/rendering/DescriptorSet.hpp"
 #include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/core/DeletionQueue.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 #include <cassert>
+#include <cstddef>
 #include <functional>
 
 namespace vkeng {
 
+    namespace {
+        /** @brief Whether a descriptor type sources from VkDescriptorBufferInfo. */
+        bool isBufferDescriptor(VkDescriptorType type) {
+            return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+                   type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+                   type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+                   type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        }
+
+        /** @brief Whether a descriptor type sources from VkDescriptorImageInfo. */
+        bool isImageDescriptor(VkDescriptorType type) {
+            return type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+                   type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
+                   type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+                   type == VK_DESCRIPTOR_TYPE_SAMPLER ||
+                   type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+        }
+
+        /**
+         * @brief Builds an update template for a layout, or VK_NULL_HANDLE.
+         *
+         * Templates describe one DescriptorTemplateData element per binding
+         * in declaration order, with each entry's offset selecting the
+         * buffer or image member. Array bindings (count > 1), texel buffer
+         * views, and push layouts stay on the VkWriteDescriptorSet path.
+         */
+        VkDescriptorUpdateTemplate buildUpdateTemplate(
+            VkDevice device, VkDescriptorSetLayout layout,
+            const std::vector<DescriptorBinding>& bindings) {
+
+            std::vector<VkDescriptorUpdateTemplateEntry> entries;
+            entries.reserve(bindings.size());
+            for (size_t i = 0; i < bindings.size(); ++i) {
+                const auto& binding = bindings[i];
+                if (binding.count != 1) {
+                    return VK_NULL_HANDLE;
+                }
+                size_t memberOffset = 0;
+                if (isBufferDescriptor(binding.type)) {
+                    memberOffset = offsetof(DescriptorTemplateData, buffer);
+                } else if (isImageDescriptor(binding.type)) {
+                    memberOffset = offsetof(DescriptorTemplateData, image);
+                } else {
+                    return VK_NULL_HANDLE;
+                }
+
+                VkDescriptorUpdateTemplateEntry entry = {};
+                entry.dstBinding = binding.binding;
+                entry.dstArrayElement = 0;
+                entry.descriptorCount = 1;
+                entry.descriptorType = binding.type;
+                entry.offset = i * sizeof(DescriptorTemplateData) + memberOffset;
+                entry.stride = sizeof(DescriptorTemplateData);
+                entries.push_back(entry);
+            }
+
+            VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+            createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+            createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+            createInfo.pDescriptorUpdateEntries = entries.data();
+            createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+            createInfo.descriptorSetLayout = layout;
+
+            VkDescriptorUpdateTemplate updateTemplate = VK_NULL_HANDLE;
+            VkResult result = vkCreateDescriptorUpdateTemplate(device, &createInfo, nullptr, &updateTemplate);
+            if (result != VK_SUCCESS) {
+                LOG_WARN(RENDERING, "Failed to create descriptor update template ({}); using write-struct updates", static_cast<int>(result));
+                return VK_NULL_HANDLE;
+            }
+            return updateTemplate;
+        }
+    }
+
     // ============================================================================
     // DescriptorSetLayout Implementation
     // ============================================================================
@@ -13,17 +88,23 @@ namespace vkeng {
     /**
      * @brief Private constructor for the DescriptorSetLayout.
      */
-    DescriptorSetLayout::DescriptorSetLayout(VkDevice device, VkDescriptorSetLayout layout, 
-                                        const std::vector<DescriptorBinding>& bindings)
+    DescriptorSetLayout::DescriptorSetLayout(VkDevice device, VkDescriptorSetLayout layout,
+                                        const std::vector<DescriptorBinding>& bindings,
+                                        bool pushDescriptor, VkDescriptorUpdateTemplate updateTemplate)
         : m_device(device)
         , m_layout(layout)
-        , m_bindings(bindings) {
+        , m_bindings(bindings)
+        , m_pushDescriptor(pushDescriptor)
+        , m_updateTemplate(updateTemplate) {
     }
 
     /**
      * @brief Destructor that destroys the Vulkan descriptor set layout object.
      */
     DescriptorSetLayout::~DescriptorSetLayout() {
+        if (m_updateTemplate != VK_NULL_HANDLE && m_device != VK_NULL_HANDLE) {
+            vkDestroyDescriptorUpdateTemplate(m_device, m_updateTemplate, nullptr);
+        }
         if (m_layout != VK_NULL_HANDLE && m_device != VK_NULL_HANDLE) {
             vkDestroyDescriptorSetLayout(m_device, m_layout, nullptr);
         }
@@ -34,8 +115,9 @@ namespace vkeng {
      */
     Result<std::shared_ptr<DescriptorSetLayout>> DescriptorSetLayout::create(
         VkDevice device,
-        const std::vector<DescriptorBinding>& bindings) {
-        
+        const std::vector<DescriptorBinding>& bindings,
+        bool pushDescriptor) {
+
         if (device == VK_NULL_HANDLE) {
             return Result<std::shared_ptr<DescriptorSetLayout>>(Error("Device handle is null"));
         }
@@ -57,6 +139,7 @@ namespace vkeng {
 
         VkDescriptorSetLayoutCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.flags = pushDescriptor ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
         createInfo.bindingCount = static_cast<uint32_t>(vkBindings.size());
         createInfo.pBindings = vkBindings.data();
 
@@ -66,7 +149,11 @@ namespace vkeng {
             return Result<std::shared_ptr<DescriptorSetLayout>>(Error("Failed to create descriptor set layout", result));
         }
 
-        auto layoutObj = std::shared_ptr<DescriptorSetLayout>(new DescriptorSetLayout(device, layout, bindings));
+        // Push layouts are written through the command buffer, never updated
+        VkDescriptorUpdateTemplate updateTemplate =
+            pushDescriptor ? VK_NULL_HANDLE : buildUpdateTemplate(device, layout, bindings);
+
+        auto layoutObj = std::shared_ptr<DescriptorSetLayout>(new DescriptorSetLayout(device, layout, bindings, pushDescriptor, updateTemplate));
         return Result<std::shared_ptr<DescriptorSetLayout>>(layoutObj);
     }
 
@@ -84,10 +171,16 @@ namespace vkeng {
 
     /**
      * @brief Destructor that destroys the Vulkan descriptor pool object.
+     *
+     * Deferred through the DeletionQueue: sets allocated from the pool may
+     * still be bound by in-flight frames when the owner drops it.
      */
     DescriptorPool::~DescriptorPool() {
         if (m_pool != VK_NULL_HANDLE && m_device != VK_NULL_HANDLE) {
-            vkDestroyDescriptorPool(m_device, m_pool, nullptr);
+            DeletionQueue::get().defer([device = m_device, pool = m_pool]() {
+                vkDestroyDescriptorPool(device, pool, nullptr);
+            });
+            m_pool = VK_NULL_HANDLE;
         }
     }
 
@@ -97,8 +190,9 @@ namespace vkeng {
     Result<std::shared_ptr<DescriptorPool>> DescriptorPool::create(
         VkDevice device,
         uint32_t maxSets,
-        const std::vector<VkDescriptorPoolSize>& poolSizes) {
-        
+        const std::vector<VkDescriptorPoolSize>& poolSizes,
+        bool allowFreeIndividualSets) {
+
         if (device == VK_NULL_HANDLE) {
             return Result<std::shared_ptr<DescriptorPool>>(Error("Device handle is null"));
         }
@@ -111,7 +205,7 @@ namespace vkeng {
 
         VkDescriptorPoolCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        createInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+        createInfo.flags = allowFreeIndividualSets ? VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT : 0;
         createInfo.maxSets = maxSets;
         createInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
         createInfo.pPoolSizes = poolSizes.data();
@@ -275,12 +369,61 @@ namespace vkeng {
         });
     }
 
+    /**
+     * @brief Applies staged writes via the layout's update template.
+     * @return False when the writes don't fit the template (partial update,
+     *         array write, or no template) — caller uses the write-struct path.
+     */
+    bool DescriptorSet::updateWithTemplate() {
+        VkDescriptorUpdateTemplate updateTemplate = m_layout->getUpdateTemplate();
+        const auto& bindings = m_layout->getBindings();
+        if (updateTemplate == VK_NULL_HANDLE || m_pendingWrites.size() != bindings.size()) {
+            return false;
+        }
+
+        // One data element per layout binding, in declaration order; every
+        // binding must be covered exactly once
+        std::vector<DescriptorTemplateData> data(bindings.size());
+        std::vector<bool> filled(bindings.size(), false);
+        for (const auto& pendingWrite : m_pendingWrites) {
+            if (pendingWrite.descriptorCount != 1) {
+                return false;
+            }
+            size_t slot = bindings.size();
+            for (size_t i = 0; i < bindings.size(); ++i) {
+                if (bindings[i].binding == pendingWrite.binding) {
+                    slot = i;
+                    break;
+                }
+            }
+            if (slot == bindings.size() || filled[slot]) {
+                return false;
+            }
+            if (pendingWrite.kind == PendingWriteKind::Buffer) {
+                data[slot].buffer = m_bufferInfos[pendingWrite.infoIndex];
+            } else {
+                data[slot].image = m_imageInfos[pendingWrite.infoIndex];
+            }
+            filled[slot] = true;
+        }
+
+        vkUpdateDescriptorSetWithTemplate(m_device, m_descriptorSet, updateTemplate, data.data());
+        return true;
+    }
+
     /**
      * @brief Submits all staged writes to the GPU.
      */
     void DescriptorSet::update() {
         if (m_pendingWrites.empty()) return;
 
+        if (updateWithTemplate()) {
+            m_pendingWrites.clear();
+            m_bufferInfos.clear();
+            m_imageInfos.clear();
+            return;
+        }
+
         std::vector<VkWriteDescriptorSet> writes;
         writes.reserve(m_pendingWrites.size());
 
@@ -309,6 +452,171 @@ namespace vkeng {
         m_imageInfos.clear();
     }
 
+    // ============================================================================
+    // DescriptorSetCache Implementation
+    // ============================================================================
+
+    /**
+     * @brief Hashes a cache key over the layout and all bound resources.
+     */
+    size_t DescriptorSetCache::CacheKeyHash::operator()(const CacheKey& key) const {
+        size_t hash = std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(key.layout));
+        for (const auto& write : key.writes) {
+            hash ^= std::hash<uint32_t>{}(write.binding) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uint32_t>{}(static_cast<uint32_t>(write.type)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(write.buffer)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uint64_t>{}(write.offset) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uint64_t>{}(write.range) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(write.imageView)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(write.sampler)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Private constructor for the DescriptorSetCache.
+     */
+    DescriptorSetCache::DescriptorSetCache(VkDevice device, std::vector<std::shared_ptr<DescriptorPool>> pools)
+        : m_device(device)
+        , m_pools(std::move(pools))
+        , m_frameCaches(m_pools.size()) {
+    }
+
+    /**
+     * @brief Factory method to create a new DescriptorSetCache.
+     */
+    Result<std::shared_ptr<DescriptorSetCache>> DescriptorSetCache::create(
+        VkDevice device, uint32_t frameCount, uint32_t maxSetsPerFrame) {
+
+        if (frameCount == 0) {
+            return Result<std::shared_ptr<DescriptorSetCache>>(Error("Frame count must be greater than 0"));
+        }
+
+        std::vector<VkDescriptorPoolSize> poolSizes = {
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, maxSetsPerFrame * 2},
+            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxSetsPerFrame * 6},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, maxSetsPerFrame},
+            {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, maxSetsPerFrame}
+        };
+
+        std::vector<std::shared_ptr<DescriptorPool>> pools;
+        pools.reserve(frameCount);
+        for (uint32_t i = 0; i < frameCount; ++i) {
+            // Bulk-reset pools: individual frees are never needed.
+            auto poolResult = DescriptorPool::create(device, maxSetsPerFrame, poolSizes, false);
+            if (!poolResult) {
+                return Result<std::shared_ptr<DescriptorSetCache>>(poolResult.getError());
+            }
+            pools.push_back(poolResult.getValue());
+        }
+
+        auto cache = std::shared_ptr<DescriptorSetCache>(
+            new DescriptorSetCache(device, std::move(pools)));
+        return Result<std::shared_ptr<DescriptorSetCache>>(cache);
+    }
+
+    /**
+     * @brief Starts a new frame: bulk-resets the frame's pool and clears its cache.
+     * @details All sets handed out for this frame slot become invalid; they were
+     * last used MAX_FRAMES_IN_FLIGHT frames ago, so the GPU is done with them.
+     */
+    void DescriptorSetCache::beginFrame(uint32_t frameIndex) {
+        m_currentFrame = frameIndex % static_cast<uint32_t>(m_pools.size());
+
+        auto resetResult = m_pools[m_currentFrame]->reset();
+        if (!resetResult) {
+            LOG_ERROR(RENDERING, "Failed to reset per-frame descriptor pool: {}",
+                      resetResult.getError().message);
+        }
+        m_frameCaches[m_currentFrame].clear();
+        m_frameCacheHits = 0;
+        m_frameAllocations = 0;
+    }
+
+    /**
+     * @brief Gets a descriptor set bound to the given resources, allocating on miss.
+     */
+    Result<VkDescriptorSet> DescriptorSetCache::getOrAllocate(
+        std::shared_ptr<DescriptorSetLayout> layout,
+        const std::vector<CachedDescriptorWrite>& writes) {
+
+        if (!layout) {
+            return Result<VkDescriptorSet>(Error("Layout is null"));
+        }
+
+        CacheKey key{layout->getHandle(), writes};
+        auto& cache = m_frameCaches[m_currentFrame];
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            m_frameCacheHits++;
+            return Result<VkDescriptorSet>(it->second);
+        }
+
+        auto setResult = m_pools[m_currentFrame]->allocateDescriptorSet(layout);
+        if (!setResult) {
+            return setResult; // Pool exhausted: caller decides how to degrade
+        }
+        VkDescriptorSet descriptorSet = setResult.getValue();
+        m_frameAllocations++;
+
+        // Populate the new set in one update call — through the layout's
+        // template when the writes cover every binding exactly once.
+        const auto& bindings = layout->getBindings();
+        VkDescriptorUpdateTemplate updateTemplate = layout->getUpdateTemplate();
+        if (updateTemplate != VK_NULL_HANDLE && writes.size() == bindings.size()) {
+            std::vector<DescriptorTemplateData> data(bindings.size());
+            size_t matched = 0;
+            for (const auto& write : writes) {
+                for (size_t i = 0; i < bindings.size(); ++i) {
+                    if (bindings[i].binding != write.binding) continue;
+                    if (write.buffer != VK_NULL_HANDLE) {
+                        data[i].buffer = {write.buffer, write.offset, write.range};
+                    } else {
+                        data[i].image = {write.sampler, write.imageView, write.imageLayout};
+                    }
+                    matched++;
+                    break;
+                }
+            }
+            if (matched == bindings.size()) {
+                vkUpdateDescriptorSetWithTemplate(m_device, descriptorSet, updateTemplate, data.data());
+                cache.emplace(std::move(key), descriptorSet);
+                return Result<VkDescriptorSet>(descriptorSet);
+            }
+        }
+
+        std::vector<VkWriteDescriptorSet> vkWrites;
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        std::vector<VkDescriptorImageInfo> imageInfos;
+        vkWrites.reserve(writes.size());
+        bufferInfos.reserve(writes.size());
+        imageInfos.reserve(writes.size());
+
+        for (const auto& write : writes) {
+            VkWriteDescriptorSet vkWrite = {};
+            vkWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            vkWrite.dstSet = descriptorSet;
+            vkWrite.dstBinding = write.binding;
+            vkWrite.dstArrayElement = 0;
+            vkWrite.descriptorCount = 1;
+            vkWrite.descriptorType = write.type;
+
+            if (write.buffer != VK_NULL_HANDLE) {
+                bufferInfos.push_back({write.buffer, write.offset, write.range});
+                vkWrite.pBufferInfo = &bufferInfos.back();
+            } else {
+                imageInfos.push_back({write.sampler, write.imageView, write.imageLayout});
+                vkWrite.pImageInfo = &imageInfos.back();
+            }
+            vkWrites.push_back(vkWrite);
+        }
+
+        vkUpdateDescriptorSets(m_device, static_cast<uint32_t>(vkWrites.size()), vkWrites.data(), 0, nullptr);
+
+        cache.emplace(std::move(key), descriptorSet);
+        return Result<VkDescriptorSet>(descriptorSet);
+    }
+
     // ============================================================================
     // DescriptorManager Implementation
     // ============================================================================
@@ -394,22 +702,22 @@ namespace vkeng {
      * @brief Creates or retrieves a cached layout for a custom combination of bindings.
      */
     std::shared_ptr<DescriptorSetLayout> DescriptorManager::createCombinedLayout(
-        const std::vector<DescriptorBinding>& bindings) {
-        
-        size_t hash = 0;
+        const std::vector<DescriptorBinding>& bindings, bool pushDescriptor) {
+
+        size_t hash = std::hash<bool>{}(pushDescriptor);
         for (const auto& binding : bindings) {
             hash ^= std::hash<uint32_t>{}(binding.binding) ^
                     std::hash<VkDescriptorType>{}(binding.type) ^
                     std::hash<uint32_t>{}(binding.count) ^
                     std::hash<VkShaderStageFlags>{}(binding.stageFlags);
         }
-        
+
         auto it = m_layoutCache.find(hash);
         if (it != m_layoutCache.end()) {
             return it->second;
         }
-        
-        auto layoutResult = DescriptorSetLayout::create(m_device, bindings);
+
+        auto layoutResult = DescriptorSetLayout::create(m_device, bindings, pushDescriptor);
         if (!layoutResult) {
             LOG_ERROR(RENDERING, "Failed to create combined layout: {}", layoutResult.getError().message);
             return nullptr;
@@ -446,4 +754,18 @@ namespace vkeng {
         return pool;
     }
 
+    /**
+     * @brief Creates a per-frame descriptor set cache.
+     */
+    std::shared_ptr<DescriptorSetCache> DescriptorManager::createSetCache(
+        uint32_t frameCount, uint32_t maxSetsPerFrame) {
+
+        auto cacheResult = DescriptorSetCache::create(m_device, frameCount, maxSetsPerFrame);
+        if (!cacheResult) {
+            LOG_ERROR(RENDERING, "Failed to create descriptor set cache: {}", cacheResult.getError().message);
+            return nullptr;
+        }
+        return cacheResult.getValue();
+    }
+
 } // namespace vkeng
\ No newline at end of file
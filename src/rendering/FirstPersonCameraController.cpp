@@ -51,8 +51,14 @@ void FirstPersonCameraController::reset() {
 void FirstPersonCameraController::update(float deltaTime) {
     // --- 1. Mouse input → update yaw/pitch ---
     if (m_inputManager.isCursorCaptured()) {
+        // In late-latch mode consume (read-and-clear) so the same movement
+        // is never applied twice across update() and lateLatch()
         double deltaX, deltaY;
-        m_inputManager.getMouseDelta(deltaX, deltaY);
+        if (m_lateLatch) {
+            m_inputManager.consumeMouseDelta(deltaX, deltaY);
+        } else {
+            m_inputManager.getMouseDelta(deltaX, deltaY);
+        }
 
         m_yaw += static_cast<float>(deltaX) * m_mouseSensitivity;
         m_pitch += static_cast<float>(deltaY) * m_mouseSensitivity;
@@ -98,4 +104,28 @@ void FirstPersonCameraController::update(float deltaTime) {
     m_camera.setView(m_position, m_position + forward, worldUp);
 }
 
+// ============================================================================
+// Late Latch — Rotation Only
+// ============================================================================
+
+void FirstPersonCameraController::lateLatch() {
+    if (!m_lateLatch || !m_inputManager.isCursorCaptured()) return;
+
+    // Consume only what arrived since update() drained the delta
+    double deltaX, deltaY;
+    m_inputManager.consumeMouseDelta(deltaX, deltaY);
+    if (deltaX == 0.0 && deltaY == 0.0) return;
+
+    m_yaw += static_cast<float>(deltaX) * m_mouseSensitivity;
+    m_pitch += static_cast<float>(deltaY) * m_mouseSensitivity;
+    m_pitch = std::clamp(m_pitch, -89.0f, 89.0f);
+
+    // Rotation only — translation needs a delta time and stays in update()
+    float yawRad = glm::radians(m_yaw);
+    float pitchRad = glm::radians(m_pitch);
+    glm::vec3 forward{cos(yawRad) * cos(pitchRad), sin(pitchRad), sin(yawRad) * cos(pitchRad)};
+    forward = glm::normalize(forward);
+    m_camera.setView(m_position, m_position + forward, {0.0f, 1.0f, 0.0f});
+}
+
 } // namespace vkeng
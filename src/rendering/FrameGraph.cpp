@@ -0,0 +1,341 @@
+#include "vulkan-engine/rendering/FrameGraph.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace {
+    /**
+     * @brief Access bits that make prior contents visible to later accesses.
+     *
+     * srcAccessMask in a derived barrier only needs the write bits of the
+     * previous access; read bits generate no caches to flush.
+     */
+    constexpr VkAccessFlags kWriteAccessMask =
+        VK_ACCESS_SHADER_WRITE_BIT |
+        VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_TRANSFER_WRITE_BIT |
+        VK_ACCESS_HOST_WRITE_BIT |
+        VK_ACCESS_MEMORY_WRITE_BIT;
+}
+
+namespace vkeng {
+
+    // ============================================================================
+    // Builder
+    // ============================================================================
+
+    void FrameGraph::Builder::read(FrameGraphResource resource, const ResourceAccess& access) {
+        m_graph.m_passes[m_passIndex].accesses.push_back({resource, access, false, false});
+    }
+
+    void FrameGraph::Builder::write(FrameGraphResource resource, const ResourceAccess& access) {
+        m_graph.m_passes[m_passIndex].accesses.push_back({resource, access, true, false});
+    }
+
+    void FrameGraph::Builder::writeAsRenderPass(FrameGraphResource resource,
+                                                const ResourceAccess& layoutAfter) {
+        m_graph.m_passes[m_passIndex].accesses.push_back({resource, layoutAfter, true, true});
+    }
+
+    FrameGraphResource FrameGraph::Builder::createTransient(const std::string& name,
+                                                            const TransientImageDesc& desc,
+                                                            const ResourceAccess& firstUse) {
+        FrameGraphResource resource = static_cast<FrameGraphResource>(m_graph.m_resources.size());
+
+        ResourceEntry entry;
+        entry.name = name;
+        entry.desc = desc;
+        entry.isTransient = true;
+        // Depth formats need the depth aspect in derived barriers
+        entry.aspect = (desc.format == VK_FORMAT_D32_SFLOAT ||
+                        desc.format == VK_FORMAT_D32_SFLOAT_S8_UINT ||
+                        desc.format == VK_FORMAT_D24_UNORM_S8_UINT)
+            ? VK_IMAGE_ASPECT_DEPTH_BIT
+            : VK_IMAGE_ASPECT_COLOR_BIT;
+        m_graph.m_resources.push_back(std::move(entry));
+
+        write(resource, firstUse);
+        return resource;
+    }
+
+    // ============================================================================
+    // Graph Construction
+    // ============================================================================
+
+    FrameGraph::FrameGraph(std::shared_ptr<MemoryManager> memoryManager)
+        : m_memoryManager(std::move(memoryManager)) {
+    }
+
+    void FrameGraph::reset() {
+        m_resources.clear();
+        m_passes.clear();
+        m_culledPassCount = 0;
+        m_barrierCount = 0;
+        for (auto& pooled : m_pool) {
+            pooled.usedThisFrame = false;
+        }
+    }
+
+    FrameGraphResource FrameGraph::importImage(const std::string& name,
+                                               VkImage image,
+                                               VkImageAspectFlags aspect,
+                                               const ResourceAccess& current) {
+        FrameGraphResource resource = static_cast<FrameGraphResource>(m_resources.size());
+
+        ResourceEntry entry;
+        entry.name = name;
+        entry.image = image;
+        entry.aspect = aspect;
+        entry.state = current;
+        m_resources.push_back(std::move(entry));
+
+        return resource;
+    }
+
+    void FrameGraph::addPass(const std::string& name, const PassSetup& setup, PassExecute execute) {
+        uint32_t passIndex = static_cast<uint32_t>(m_passes.size());
+
+        Pass pass;
+        pass.name = name;
+        pass.execute = std::move(execute);
+        m_passes.push_back(std::move(pass));
+
+        Builder builder(*this, passIndex);
+        setup(builder);
+    }
+
+    void FrameGraph::markOutput(FrameGraphResource resource) {
+        if (resource < m_resources.size()) {
+            m_resources[resource].isOutput = true;
+        }
+    }
+
+    // ============================================================================
+    // Compilation
+    // ============================================================================
+
+    Result<void> FrameGraph::compile() {
+        cullPasses();
+
+        auto transientResult = assignTransients();
+        if (!transientResult.isSuccess()) {
+            return transientResult;
+        }
+
+        deriveBarriers();
+        return Result<void>();
+    }
+
+    /**
+     * @brief Drops passes whose writes never reach a marked output.
+     *
+     * Reverse sweep: a pass survives if it writes an output or a resource
+     * some surviving pass reads; its own reads then become needed, which is
+     * exactly transitive reachability from the outputs.
+     */
+    void FrameGraph::cullPasses() {
+        std::vector<bool> needed(m_resources.size(), false);
+        for (size_t i = 0; i < m_resources.size(); ++i) {
+            needed[i] = m_resources[i].isOutput;
+        }
+
+        for (auto it = m_passes.rbegin(); it != m_passes.rend(); ++it) {
+            bool live = false;
+            for (const auto& access : it->accesses) {
+                if (access.isWrite && needed[access.resource]) {
+                    live = true;
+                    break;
+                }
+            }
+
+            if (!live) {
+                it->culled = true;
+                ++m_culledPassCount;
+                continue;
+            }
+            for (const auto& access : it->accesses) {
+                if (!access.isWrite) {
+                    needed[access.resource] = true;
+                }
+            }
+        }
+
+        if (m_culledPassCount > 0) {
+            LOG_DEBUG(RENDERING, "FrameGraph: culled {} of {} passes",
+                      m_culledPassCount, m_passes.size());
+        }
+    }
+
+    /**
+     * @brief Assigns a VkImage to every transient resource still in use.
+     *
+     * Pooled images are reused when their description matches and their
+     * previous lifetime this frame ended before the new one begins, so two
+     * post-processing targets with disjoint pass ranges share one image.
+     * The pool persists across frames; steady state allocates nothing.
+     */
+    Result<void> FrameGraph::assignTransients() {
+        // Pass-index lifetime of every resource, over scheduled passes only
+        for (uint32_t passIndex = 0; passIndex < m_passes.size(); ++passIndex) {
+            const Pass& pass = m_passes[passIndex];
+            if (pass.culled) continue;
+            for (const auto& access : pass.accesses) {
+                ResourceEntry& entry = m_resources[access.resource];
+                entry.firstUse = std::min(entry.firstUse, passIndex);
+                entry.lastUse = std::max(entry.lastUse, passIndex);
+            }
+        }
+
+        for (auto& entry : m_resources) {
+            if (!entry.isTransient || entry.firstUse == UINT32_MAX) {
+                continue; // imported, or only used by culled passes
+            }
+
+            PooledImage* assigned = nullptr;
+            for (auto& pooled : m_pool) {
+                if (!(pooled.desc == entry.desc)) continue;
+                if (pooled.usedThisFrame && pooled.availableAfter >= entry.firstUse) continue;
+                assigned = &pooled;
+                break;
+            }
+
+            if (!assigned) {
+                if (!m_memoryManager) {
+                    return Result<void>(Error("FrameGraph: no MemoryManager for transient '" + entry.name + "'"));
+                }
+                auto imageResult = m_memoryManager->createImage(
+                    entry.desc.width, entry.desc.height, entry.desc.format, entry.desc.usage);
+                if (!imageResult.isSuccess()) {
+                    return Result<void>(imageResult.getError());
+                }
+
+                PooledImage pooled;
+                pooled.desc = entry.desc;
+                pooled.image = imageResult.getValue();
+                m_pool.push_back(std::move(pooled));
+                assigned = &m_pool.back();
+
+                LOG_DEBUG(RENDERING, "FrameGraph: allocated transient {}x{} for '{}' (pool size {})",
+                          entry.desc.width, entry.desc.height, entry.name, m_pool.size());
+            }
+
+            // Inherit the layout the image was actually left in, so the
+            // derived barrier transitions from real state, not a guess.
+            entry.transientImage = assigned->image;
+            entry.image = assigned->image->getHandle();
+            entry.state = assigned->state;
+            assigned->availableAfter = entry.lastUse;
+            assigned->usedThisFrame = true;
+        }
+        return Result<void>();
+    }
+
+    /**
+     * @brief Walks the scheduled access chain and precomputes one barrier
+     *        batch per pass.
+     *
+     * A barrier is emitted only when the access actually hazards against the
+     * tracked state: a layout change, a read or write after a write, or a
+     * write after a read (execution-only dependency). Back-to-back reads in
+     * the same layout merge scopes and emit nothing.
+     */
+    void FrameGraph::deriveBarriers() {
+        for (auto& pass : m_passes) {
+            if (pass.culled) continue;
+
+            for (const auto& access : pass.accesses) {
+                ResourceEntry& entry = m_resources[access.resource];
+
+                if (access.renderPassManaged) {
+                    // The VkRenderPass transitions the attachment itself and
+                    // carries external subpass dependencies; just track the
+                    // layout it leaves behind.
+                    entry.state = access.access;
+                    continue;
+                }
+
+                const ResourceAccess& cur = entry.state;
+                bool layoutChange = access.access.layout != cur.layout
+                                 && access.access.layout != VK_IMAGE_LAYOUT_UNDEFINED;
+                bool afterWrite = (cur.access & kWriteAccessMask) != 0;
+                bool writeAfterRead = access.isWrite && cur.access != 0;
+
+                if (layoutChange || afterWrite || writeAfterRead) {
+                    VkImageMemoryBarrier barrier{};
+                    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                    barrier.oldLayout = cur.layout;
+                    barrier.newLayout = layoutChange ? access.access.layout : cur.layout;
+                    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                    barrier.image = entry.image;
+                    barrier.srcAccessMask = cur.access & kWriteAccessMask;
+                    barrier.dstAccessMask = access.access.access;
+                    barrier.subresourceRange.aspectMask = entry.aspect;
+                    barrier.subresourceRange.baseMipLevel = 0;
+                    barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+                    barrier.subresourceRange.baseArrayLayer = 0;
+                    barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+
+                    pass.barriers.push_back(barrier);
+                    pass.srcStageMask |= cur.stage;
+                    pass.dstStageMask |= access.access.stage;
+                    ++m_barrierCount;
+
+                    entry.state = access.access;
+                } else if (!access.isWrite) {
+                    // Read-after-read: widen the visible scope, no barrier
+                    entry.state.stage |= access.access.stage;
+                    entry.state.access |= access.access.access;
+                } else {
+                    entry.state = access.access;
+                }
+            }
+        }
+
+        // Remember what layout each pooled image ends the frame in
+        for (const auto& entry : m_resources) {
+            if (!entry.isTransient || !entry.transientImage) continue;
+            for (auto& pooled : m_pool) {
+                if (pooled.image == entry.transientImage) {
+                    pooled.state = entry.state;
+                    break;
+                }
+            }
+        }
+    }
+
+    // ============================================================================
+    // Execution
+    // ============================================================================
+
+    void FrameGraph::execute(VkCommandBuffer commandBuffer) {
+        for (const auto& pass : m_passes) {
+            if (pass.culled) continue;
+
+            if (!pass.barriers.empty()) {
+                VkPipelineStageFlags srcStage = pass.srcStageMask != 0
+                    ? pass.srcStageMask : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+                vkCmdPipelineBarrier(commandBuffer,
+                                     srcStage, pass.dstStageMask,
+                                     0,
+                                     0, nullptr,
+                                     0, nullptr,
+                                     static_cast<uint32_t>(pass.barriers.size()), pass.barriers.data());
+            }
+
+            if (pass.execute) {
+                pass.execute(commandBuffer);
+            }
+        }
+    }
+
+    std::shared_ptr<Image> FrameGraph::getImage(FrameGraphResource resource) const {
+        if (resource >= m_resources.size()) {
+            return nullptr;
+        }
+        return m_resources[resource].transientImage;
+    }
+
+} // namespace vkeng
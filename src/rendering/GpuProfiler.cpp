@@ -0,0 +1,141 @@
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+namespace vkeng {
+
+    GpuProfiler& GpuProfiler::get() {
+        static GpuProfiler instance;
+        return instance;
+    }
+
+    void GpuProfiler::initialize(VkDevice device, VkPhysicalDevice physicalDevice,
+                                 uint32_t framesInFlight) {
+        VkPhysicalDeviceProperties properties{};
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+        if (properties.limits.timestampPeriod == 0.0f ||
+            !properties.limits.timestampComputeAndGraphics) {
+            LOG_WARN(RENDERING, "GpuProfiler: device lacks timestamp support, disabled");
+            m_supported = false;
+            return;
+        }
+
+        m_device = device;
+        m_timestampPeriodNs = static_cast<double>(properties.limits.timestampPeriod);
+
+        m_frames.resize(framesInFlight);
+        for (auto& frame : m_frames) {
+            VkQueryPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            poolInfo.queryCount = kMaxScopes * 2;
+
+            if (vkCreateQueryPool(device, &poolInfo, nullptr, &frame.pool) != VK_SUCCESS) {
+                LOG_WARN(RENDERING, "GpuProfiler: query pool creation failed, disabled");
+                shutdown();
+                return;
+            }
+            frame.scopeNames.reserve(kMaxScopes);
+        }
+
+        m_supported = true;
+        LOG_INFO(RENDERING, "GpuProfiler: {} pools of {} timestamp scopes",
+                 framesInFlight, kMaxScopes);
+    }
+
+    void GpuProfiler::shutdown() {
+        for (auto& frame : m_frames) {
+            if (frame.pool != VK_NULL_HANDLE) {
+                vkDestroyQueryPool(m_device, frame.pool, nullptr);
+            }
+        }
+        m_frames.clear();
+        m_supported = false;
+    }
+
+    void GpuProfiler::resolve(FrameQueries& frame) {
+        if (!frame.hasResults || frame.scopeCount == 0) {
+            return;
+        }
+
+        // 2 uint64s per query: timestamp + availability word
+        uint64_t results[kMaxScopes * 2 * 2] = {};
+        VkResult status = vkGetQueryPoolResults(
+            m_device, frame.pool, 0, frame.scopeCount * 2,
+            sizeof(results), results, 2 * sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+        if (status != VK_SUCCESS) {
+            return; // NOT_READY: keep last frame's numbers
+        }
+
+        m_resolved.clear();
+        for (uint32_t scope = 0; scope < frame.scopeCount; ++scope) {
+            const uint64_t beginAvailable = results[scope * 4 + 1];
+            const uint64_t endAvailable = results[scope * 4 + 3];
+            if (!beginAvailable || !endAvailable) {
+                continue;
+            }
+
+            const uint64_t begin = results[scope * 4 + 0];
+            const uint64_t end = results[scope * 4 + 2];
+            PassTiming timing;
+            timing.name = frame.scopeNames[scope];
+            timing.milliseconds =
+                static_cast<double>(end - begin) * m_timestampPeriodNs / 1e6;
+            m_resolved.push_back(std::move(timing));
+        }
+    }
+
+    void GpuProfiler::beginFrame(VkCommandBuffer cmd, uint32_t frameIndex) {
+        if (!m_supported) {
+            return;
+        }
+
+        m_activeFrame = frameIndex % static_cast<uint32_t>(m_frames.size());
+        FrameQueries& frame = m_frames[m_activeFrame];
+
+        // The caller waited on this slot's fence, so the queries written
+        // framesInFlight frames ago are complete — read them, then recycle
+        resolve(frame);
+
+        vkCmdResetQueryPool(cmd, frame.pool, 0, kMaxScopes * 2);
+        frame.scopeNames.clear();
+        frame.scopeCount = 0;
+        frame.hasResults = false;
+        m_scopeStack.clear();
+    }
+
+    void GpuProfiler::beginScope(VkCommandBuffer cmd, const char* name) {
+        if (!m_supported) {
+            return;
+        }
+
+        FrameQueries& frame = m_frames[m_activeFrame];
+        if (frame.scopeCount >= kMaxScopes) {
+            return; // out of query slots this frame; silently drop
+        }
+
+        const uint32_t scope = frame.scopeCount++;
+        frame.scopeNames.emplace_back(name);
+        m_scopeStack.push_back(scope);
+
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                            frame.pool, scope * 2);
+    }
+
+    void GpuProfiler::endScope(VkCommandBuffer cmd) {
+        if (!m_supported || m_scopeStack.empty()) {
+            return;
+        }
+
+        FrameQueries& frame = m_frames[m_activeFrame];
+        const uint32_t scope = m_scopeStack.back();
+        m_scopeStack.pop_back();
+
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                            frame.pool, scope * 2 + 1);
+        frame.hasResults = true;
+    }
+
+} // namespace vkeng
@@ -0,0 +1,301 @@
+/**
+ * @file MeshletRenderer.cpp
+ * @brief Implementation of the experimental mesh-shading draw path
+ */
+
+#include "vulkan-engine/rendering/MeshletRenderer.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    const std::vector<DescriptorBinding> kFrameBindings = {
+        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1,
+         VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT | VK_SHADER_STAGE_FRAGMENT_BIT},
+    };
+
+    const std::vector<DescriptorBinding> kMeshBindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_MESH_BIT_EXT},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_MESH_BIT_EXT},
+        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_MESH_BIT_EXT},
+    };
+
+    /** @brief Largest axis scale of a model matrix (bounds-radius scaling). */
+    float largestAxisScale(const glm::mat4& model) {
+        float scale = glm::length(glm::vec3(model[0]));
+        scale = std::max(scale, glm::length(glm::vec3(model[1])));
+        scale = std::max(scale, glm::length(glm::vec3(model[2])));
+        return scale;
+    }
+}
+
+MeshletRenderer::MeshletRenderer(VulkanDevice& device,
+                                 std::shared_ptr<MemoryManager> memoryManager,
+                                 PipelineManager& pipelineManager,
+                                 uint32_t framesInFlight,
+                                 const std::filesystem::path& shaderDir)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager) {
+
+    VkDevice vkDevice = m_device.getDevice();
+
+    m_cmdDrawMeshTasks = reinterpret_cast<PFN_vkCmdDrawMeshTasksEXT>(
+        vkGetDeviceProcAddr(vkDevice, "vkCmdDrawMeshTasksEXT"));
+    if (!m_cmdDrawMeshTasks) {
+        throw std::runtime_error("MeshletRenderer: vkCmdDrawMeshTasksEXT not available "
+                                 "(device created without VK_EXT_mesh_shader?)");
+    }
+
+    auto frameLayoutResult = DescriptorSetLayout::create(vkDevice, kFrameBindings);
+    auto meshLayoutResult = DescriptorSetLayout::create(vkDevice, kMeshBindings);
+    if (!frameLayoutResult.isSuccess() || !meshLayoutResult.isSuccess()) {
+        throw std::runtime_error("MeshletRenderer: failed to create set layouts");
+    }
+    m_frameSetLayout = frameLayoutResult.getValue();
+    m_meshSetLayout = meshLayoutResult.getValue();
+
+    auto framePoolResult = DescriptorPool::create(vkDevice, framesInFlight, {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, framesInFlight},
+    });
+    auto meshPoolResult = DescriptorPool::create(vkDevice, kMaxMeshSets, {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4 * kMaxMeshSets},
+    });
+    if (!framePoolResult.isSuccess() || !meshPoolResult.isSuccess()) {
+        throw std::runtime_error("MeshletRenderer: failed to create descriptor pools");
+    }
+    m_framePool = framePoolResult.getValue();
+    m_meshPool = meshPoolResult.getValue();
+
+    VkDescriptorSetLayout setLayouts[2] = {
+        m_frameSetLayout->getHandle(),
+        m_meshSetLayout->getHandle(),
+    };
+
+    VkPushConstantRange pushRange{};
+    pushRange.stageFlags = VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT;
+    pushRange.offset = 0;
+    pushRange.size = sizeof(MeshletPush);
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 2;
+    layoutInfo.pSetLayouts = setLayouts;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushRange;
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("MeshletRenderer: failed to create pipeline layout");
+    }
+
+    // The pipeline itself builds lazily against the current render pass in
+    // recordDraws(); only the configuration is fixed here
+    m_drawConfig.taskShaderPath = shaderDir / "meshlet_task.spv";
+    m_drawConfig.meshShaderPath = shaderDir / "meshlet_mesh.spv";
+    m_drawConfig.fragShaderPath = shaderDir / "meshlet_frag.spv";
+
+    m_frames.resize(framesInFlight);
+    for (auto& frame : m_frames) {
+        auto uboResult = m_memoryManager->createUniformBuffer(sizeof(FrameUbo));
+        if (!uboResult.isSuccess()) {
+            throw std::runtime_error("MeshletRenderer: failed to create frame UBO");
+        }
+        frame.ubo = uboResult.getValue();
+
+        auto setResult = m_framePool->allocateDescriptorSet(m_frameSetLayout);
+        if (!setResult.isSuccess()) {
+            throw std::runtime_error("MeshletRenderer: failed to allocate frame set: " +
+                                     setResult.getError().message);
+        }
+        frame.set = setResult.getValue();
+
+        VkDescriptorBufferInfo uboInfo{frame.ubo->getHandle(), 0, sizeof(FrameUbo)};
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = frame.set;
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        write.pBufferInfo = &uboInfo;
+        vkUpdateDescriptorSets(vkDevice, 1, &write, 0, nullptr);
+    }
+
+    LOG_INFO(RENDERING, "MeshletRenderer created ({} verts / {} tris per meshlet, {} mesh slots)",
+             MeshletBuilder::kMaxVertices, MeshletBuilder::kMaxTriangles, kMaxMeshSets);
+}
+
+MeshletRenderer::~MeshletRenderer() {
+    if (m_pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_device.getDevice(), m_pipelineLayout, nullptr);
+    }
+}
+
+void MeshletRenderer::prepare(uint32_t frameIndex, const glm::mat4& viewProj,
+                              const Frustum& frustum, const glm::vec3& cameraPos) {
+    FrameUbo ubo{};
+    ubo.viewProj = viewProj;
+    for (int i = 0; i < 6; i++) {
+        ubo.frustumPlanes[i] = glm::vec4(frustum.planes[i].normal, frustum.planes[i].distance);
+    }
+    ubo.cameraPos = glm::vec4(cameraPos, 1.0f);
+    m_frames[frameIndex].ubo->copyData(&ubo, sizeof(ubo));
+}
+
+bool MeshletRenderer::ensureMeshData(MeshHandle handle) {
+    Mesh* mesh = handle.get();
+    if (!mesh) {
+        return false; // Stale handle; nothing to upload or cache
+    }
+
+    auto it = m_meshData.find(handle.value());
+    if (it != m_meshData.end()) {
+        return it->second.valid;
+    }
+
+    MeshData data;
+
+    // A negative entry is cached too, so rejected meshes cost one lookup
+    // per frame instead of re-checking their data every time
+    if (!mesh->hasMeshlets() || !mesh->hasCpuData()) {
+        m_meshData.emplace(handle.value(), std::move(data));
+        return false;
+    }
+    if (m_meshData.size() >= kMaxMeshSets) {
+        if (!m_meshPoolExhausted) {
+            LOG_WARN(RENDERING, "MeshletRenderer: mesh slot capacity ({}) exhausted; "
+                     "further meshes draw through the classic path", kMaxMeshSets);
+            m_meshPoolExhausted = true;
+        }
+        return false;
+    }
+
+    const MeshletData& meshlets = mesh->getMeshlets();
+    const std::vector<Vertex>& cpuVertices = mesh->getCpuVertices();
+
+    // Corners widen from uint8 to one uint each (std430 has no byte
+    // scalars), and vertices pack down to the position/normal pair the
+    // mesh stage actually reads
+    std::vector<uint32_t> corners(meshlets.triangles.begin(), meshlets.triangles.end());
+    std::vector<PackedVertex> packed(cpuVertices.size());
+    for (size_t i = 0; i < cpuVertices.size(); i++) {
+        packed[i].position = glm::vec4(cpuVertices[i].pos, 1.0f);
+        packed[i].normal = glm::vec4(cpuVertices[i].normal, 0.0f);
+    }
+
+    auto meshletResult = m_memoryManager->createStorageBuffer(
+        meshlets.meshlets.size() * sizeof(Meshlet), true);
+    auto indexResult = m_memoryManager->createStorageBuffer(
+        meshlets.vertexIndices.size() * sizeof(uint32_t), true);
+    auto triangleResult = m_memoryManager->createStorageBuffer(
+        corners.size() * sizeof(uint32_t), true);
+    auto vertexResult = m_memoryManager->createStorageBuffer(
+        packed.size() * sizeof(PackedVertex), true);
+    if (!meshletResult.isSuccess() || !indexResult.isSuccess() ||
+        !triangleResult.isSuccess() || !vertexResult.isSuccess()) {
+        LOG_WARN(RENDERING, "MeshletRenderer: failed to create meshlet buffers "
+                 "({} meshlets); falling back to the classic path",
+                 meshlets.meshlets.size());
+        m_meshData.emplace(handle.value(), std::move(data));
+        return false;
+    }
+    data.meshlets = meshletResult.getValue();
+    data.vertexIndices = indexResult.getValue();
+    data.triangles = triangleResult.getValue();
+    data.vertices = vertexResult.getValue();
+
+    data.meshlets->copyData(meshlets.meshlets.data(),
+                            meshlets.meshlets.size() * sizeof(Meshlet));
+    data.vertexIndices->copyData(meshlets.vertexIndices.data(),
+                                 meshlets.vertexIndices.size() * sizeof(uint32_t));
+    data.triangles->copyData(corners.data(), corners.size() * sizeof(uint32_t));
+    data.vertices->copyData(packed.data(), packed.size() * sizeof(PackedVertex));
+
+    auto setResult = m_meshPool->allocateDescriptorSet(m_meshSetLayout);
+    if (!setResult.isSuccess()) {
+        LOG_WARN(RENDERING, "MeshletRenderer: failed to allocate mesh set: {}",
+                 setResult.getError().message);
+        m_meshData.emplace(handle.value(), std::move(data));
+        return false;
+    }
+    data.set = setResult.getValue();
+
+    VkDescriptorBufferInfo meshletInfo{data.meshlets->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo indexInfo{data.vertexIndices->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo triangleInfo{data.triangles->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo vertexInfo{data.vertices->getHandle(), 0, VK_WHOLE_SIZE};
+
+    std::array<VkWriteDescriptorSet, 4> writes{};
+    std::array<VkDescriptorBufferInfo*, 4> infos = {&meshletInfo, &indexInfo, &triangleInfo, &vertexInfo};
+    for (uint32_t i = 0; i < writes.size(); i++) {
+        writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[i].dstSet = data.set;
+        writes[i].dstBinding = i;
+        writes[i].descriptorCount = 1;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo = infos[i];
+    }
+    vkUpdateDescriptorSets(m_device.getDevice(), static_cast<uint32_t>(writes.size()),
+                           writes.data(), 0, nullptr);
+
+    data.meshletCount = static_cast<uint32_t>(meshlets.meshlets.size());
+    data.valid = true;
+    LOG_DEBUG(RENDERING, "MeshletRenderer: uploaded {} meshlet(s), {} vertices",
+              data.meshletCount, packed.size());
+    m_meshData.emplace(handle.value(), std::move(data));
+    return true;
+}
+
+void MeshletRenderer::ensurePipeline(VkRenderPass renderPass, VkExtent2D extent) {
+    // Tied to the render pass like the overlay pipeline; viewport/scissor
+    // are dynamic so extent changes alone don't invalidate it
+    if (renderPass != m_builtRenderPass) {
+        m_pipeline = std::make_shared<Pipeline>(
+            m_device.getDevice(), renderPass, m_pipelineLayout, extent,
+            m_drawConfig, m_pipelineManager.getPipelineCacheHandle());
+        m_builtRenderPass = renderPass;
+    }
+}
+
+void MeshletRenderer::recordDraws(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                                  VkExtent2D extent, uint32_t frameIndex,
+                                  const MeshletDraw* draws, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    ensurePipeline(renderPass, extent);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->getPipeline());
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            m_pipelineLayout, 0, 1, &m_frames[frameIndex].set, 0, nullptr);
+
+    for (size_t i = 0; i < count; i++) {
+        const MeshletDraw& draw = draws[i];
+        auto it = m_meshData.find(draw.mesh.value());
+        if (it == m_meshData.end() || !it->second.valid) {
+            continue; // ensureMeshData() gates draws into the packet; stay safe anyway
+        }
+        const MeshData& data = it->second;
+
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                m_pipelineLayout, 1, 1, &data.set, 0, nullptr);
+
+        MeshletPush push{};
+        push.model = draw.model;
+        push.meshletCount = data.meshletCount;
+        push.radiusScale = largestAxisScale(draw.model);
+        vkCmdPushConstants(commandBuffer, m_pipelineLayout,
+                           VK_SHADER_STAGE_TASK_BIT_EXT | VK_SHADER_STAGE_MESH_BIT_EXT,
+                           0, sizeof(push), &push);
+
+        const uint32_t taskGroups =
+            (data.meshletCount + kTaskWorkgroupSize - 1) / kTaskWorkgroupSize;
+        m_cmdDrawMeshTasks(commandBuffer, taskGroups, 1, 1);
+    }
+}
+
+} // namespace vkeng
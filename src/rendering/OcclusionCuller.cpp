@@ -0,0 +1,583 @@
+/**
+ * @file OcclusionCuller.cpp
+ * @brief Implementation of GPU occlusion culling (depth pyramid + indirect compaction)
+ */
+
+#include "vulkan-engine/rendering/OcclusionCuller.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    /// The pyramid lives in GENERAL for its whole lifetime: storage-image
+    /// writes require it, sampling from it is legal, and skipping per-mip
+    /// layout ping-pong keeps the reduction loop to one memory barrier per mip.
+    constexpr VkImageLayout kPyramidLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    uint32_t mipCountFor(uint32_t width, uint32_t height) {
+        uint32_t dim = std::max(width, height);
+        uint32_t mips = 1;
+        while (dim > 1) { dim >>= 1; mips++; }
+        return mips;
+    }
+}
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+OcclusionCuller::OcclusionCuller(VulkanDevice& device,
+                                 std::shared_ptr<MemoryManager> memoryManager,
+                                 PipelineManager& pipelineManager,
+                                 uint32_t framesInFlight,
+                                 const std::filesystem::path& shaderDir,
+                                 uint32_t depthWidth, uint32_t depthHeight)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager)
+    , m_framesInFlight(framesInFlight) {
+
+    createLayoutsAndPipelines(shaderDir);
+    createPyramid(depthWidth, depthHeight);
+    m_frames.resize(m_framesInFlight);
+
+    LOG_INFO(RENDERING, "OcclusionCuller created ({} mips, {} frames in flight)",
+             m_pyramid->getMipLevels(), m_framesInFlight);
+}
+
+OcclusionCuller::~OcclusionCuller() {
+    destroyPyramid();
+
+    VkDevice device = m_device.getDevice();
+    if (m_reduceSampler != VK_NULL_HANDLE) {
+        vkDestroySampler(device, m_reduceSampler, nullptr);
+    }
+    if (m_reducePipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device, m_reducePipelineLayout, nullptr);
+    }
+    if (m_cullPipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device, m_cullPipelineLayout, nullptr);
+    }
+}
+
+void OcclusionCuller::createLayoutsAndPipelines(const std::filesystem::path& shaderDir) {
+    VkDevice device = m_device.getDevice();
+
+    // Reduction set: source level (sampled) + destination level (storage image)
+    auto reduceLayoutResult = DescriptorSetLayout::create(device, {
+        {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          1, VK_SHADER_STAGE_COMPUTE_BIT},
+    });
+    if (!reduceLayoutResult.isSuccess()) {
+        throw std::runtime_error("OcclusionCuller: failed to create reduce set layout: " +
+                                 reduceLayoutResult.getError().message);
+    }
+    m_reduceSetLayout = reduceLayoutResult.getValue();
+
+    // Cull set: candidates, commands, compacted transforms, pyramid, uniforms
+    auto cullLayoutResult = DescriptorSetLayout::create(device, {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {3, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {4, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         1, VK_SHADER_STAGE_COMPUTE_BIT},
+    });
+    if (!cullLayoutResult.isSuccess()) {
+        throw std::runtime_error("OcclusionCuller: failed to create cull set layout: " +
+                                 cullLayoutResult.getError().message);
+    }
+    m_cullSetLayout = cullLayoutResult.getValue();
+
+    // Pool sized for a deep pyramid (16 mips covers 64k textures) plus the
+    // per-frame cull sets. Reduce sets are freed and reallocated on resize.
+    uint32_t maxReduceSets = 16;
+    auto poolResult = DescriptorPool::create(device, maxReduceSets + m_framesInFlight, {
+        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maxReduceSets + m_framesInFlight},
+        {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          maxReduceSets},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         3 * m_framesInFlight},
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         m_framesInFlight},
+    });
+    if (!poolResult.isSuccess()) {
+        throw std::runtime_error("OcclusionCuller: failed to create descriptor pool: " +
+                                 poolResult.getError().message);
+    }
+    m_descriptorPool = poolResult.getValue();
+
+    // Nearest + clamp-to-edge: reduction must not blend depths, and edge
+    // clamping keeps odd-sized mips conservative. maxLod is open so the cull
+    // shader can textureLod any level.
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+    if (vkCreateSampler(device, &samplerInfo, nullptr, &m_reduceSampler) != VK_SUCCESS) {
+        throw std::runtime_error("OcclusionCuller: failed to create reduction sampler");
+    }
+
+    // Reduce layout carries the output size as push constants
+    VkPushConstantRange reducePush{};
+    reducePush.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    reducePush.offset = 0;
+    reducePush.size = 2 * sizeof(uint32_t);
+
+    VkDescriptorSetLayout reduceSetLayout = m_reduceSetLayout->getHandle();
+    VkPipelineLayoutCreateInfo reduceLayoutInfo{};
+    reduceLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    reduceLayoutInfo.setLayoutCount = 1;
+    reduceLayoutInfo.pSetLayouts = &reduceSetLayout;
+    reduceLayoutInfo.pushConstantRangeCount = 1;
+    reduceLayoutInfo.pPushConstantRanges = &reducePush;
+    if (vkCreatePipelineLayout(device, &reduceLayoutInfo, nullptr, &m_reducePipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("OcclusionCuller: failed to create reduce pipeline layout");
+    }
+
+    VkDescriptorSetLayout cullSetLayout = m_cullSetLayout->getHandle();
+    VkPipelineLayoutCreateInfo cullLayoutInfo{};
+    cullLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    cullLayoutInfo.setLayoutCount = 1;
+    cullLayoutInfo.pSetLayouts = &cullSetLayout;
+    if (vkCreatePipelineLayout(device, &cullLayoutInfo, nullptr, &m_cullPipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("OcclusionCuller: failed to create cull pipeline layout");
+    }
+
+    m_reducePipeline = m_pipelineManager.getComputePipeline(
+        shaderDir / "depth_pyramid.spv", m_reducePipelineLayout);
+    m_cullPipeline = m_pipelineManager.getComputePipeline(
+        shaderDir / "occlusion_cull.spv", m_cullPipelineLayout);
+}
+
+// ============================================================================
+// Depth Pyramid Resources
+// ============================================================================
+
+void OcclusionCuller::createPyramid(uint32_t depthWidth, uint32_t depthHeight) {
+    // Half-resolution mip 0: occlusion only needs conservative coverage, and
+    // halving cuts the reduction cost 4x before the chain even starts.
+    uint32_t width = std::max(depthWidth / 2, 1u);
+    uint32_t height = std::max(depthHeight / 2, 1u);
+    uint32_t mips = mipCountFor(width, height);
+
+    auto imageResult = m_memoryManager->createImage(
+        width, height, VK_FORMAT_R32_SFLOAT,
+        VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+        false, mips);
+    if (!imageResult.isSuccess()) {
+        throw std::runtime_error("OcclusionCuller: failed to create depth pyramid: " +
+                                 imageResult.getError().message);
+    }
+    m_pyramid = imageResult.getValue();
+
+    VkDevice device = m_device.getDevice();
+
+    // One single-mip view per level for storage-image writes. The composite
+    // view on the Image covers all mips and feeds the cull shader's sampler.
+    m_pyramidMipViews.resize(mips);
+    for (uint32_t mip = 0; mip < mips; mip++) {
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_pyramid->getHandle();
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R32_SFLOAT;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseMipLevel = mip;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+        if (vkCreateImageView(device, &viewInfo, nullptr, &m_pyramidMipViews[mip]) != VK_SUCCESS) {
+            throw std::runtime_error("OcclusionCuller: failed to create pyramid mip view");
+        }
+    }
+
+    // One reduce set per mip: input = previous level (or the scene depth for
+    // mip 0, written lazily in recordPyramidBuild), output = this level.
+    m_reduceSets.resize(mips);
+    for (uint32_t mip = 0; mip < mips; mip++) {
+        auto setResult = m_descriptorPool->allocateDescriptorSet(m_reduceSetLayout);
+        if (!setResult.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to allocate reduce set: " +
+                                     setResult.getError().message);
+        }
+        m_reduceSets[mip] = setResult.getValue();
+
+        VkDescriptorImageInfo outputInfo{};
+        outputInfo.imageView = m_pyramidMipViews[mip];
+        outputInfo.imageLayout = kPyramidLayout;
+
+        std::vector<VkWriteDescriptorSet> writes;
+
+        VkWriteDescriptorSet outputWrite{};
+        outputWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        outputWrite.dstSet = m_reduceSets[mip];
+        outputWrite.dstBinding = 1;
+        outputWrite.descriptorCount = 1;
+        outputWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        outputWrite.pImageInfo = &outputInfo;
+        writes.push_back(outputWrite);
+
+        VkDescriptorImageInfo inputInfo{};
+        if (mip > 0) {
+            inputInfo.sampler = m_reduceSampler;
+            inputInfo.imageView = m_pyramidMipViews[mip - 1];
+            inputInfo.imageLayout = kPyramidLayout;
+
+            VkWriteDescriptorSet inputWrite{};
+            inputWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            inputWrite.dstSet = m_reduceSets[mip];
+            inputWrite.dstBinding = 0;
+            inputWrite.descriptorCount = 1;
+            inputWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            inputWrite.pImageInfo = &inputInfo;
+            writes.push_back(inputWrite);
+        }
+
+        vkUpdateDescriptorSets(device, static_cast<uint32_t>(writes.size()),
+                               writes.data(), 0, nullptr);
+    }
+
+    m_pyramidReady = false;
+    m_lastDepthView = VK_NULL_HANDLE;
+
+    // Cull sets reference the (re)created pyramid view — rewrite them
+    for (auto& frame : m_frames) {
+        frame.setDirty = true;
+    }
+}
+
+void OcclusionCuller::destroyPyramid() {
+    VkDevice device = m_device.getDevice();
+
+    if (!m_reduceSets.empty()) {
+        vkFreeDescriptorSets(device, m_descriptorPool->getHandle(),
+                             static_cast<uint32_t>(m_reduceSets.size()), m_reduceSets.data());
+        m_reduceSets.clear();
+    }
+    for (VkImageView view : m_pyramidMipViews) {
+        vkDestroyImageView(device, view, nullptr);
+    }
+    m_pyramidMipViews.clear();
+    m_pyramid.reset();
+}
+
+void OcclusionCuller::resize(uint32_t depthWidth, uint32_t depthHeight) {
+    destroyPyramid();
+    createPyramid(depthWidth, depthHeight);
+    LOG_DEBUG(RENDERING, "OcclusionCuller: pyramid recreated ({}x{}, {} mips)",
+              m_pyramid->getWidth(), m_pyramid->getHeight(), m_pyramid->getMipLevels());
+}
+
+// ============================================================================
+// Per-Frame Buffers
+// ============================================================================
+
+void OcclusionCuller::growFrameBuffers(FrameResources& frame,
+                                       uint32_t candidateCount, uint32_t commandCount) {
+    VkDeviceSize candidateSize = VkDeviceSize(candidateCount) * sizeof(Candidate);
+    if (!frame.candidates || frame.candidates->getSize() < candidateSize) {
+        VkDeviceSize allocSize = std::max<VkDeviceSize>(candidateSize * 2, 256 * sizeof(Candidate));
+        auto result = m_memoryManager->createStorageBuffer(allocSize, true);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to create candidate buffer");
+        }
+        frame.candidates = result.getValue();
+
+        // Transforms mirror the candidate capacity: worst case every
+        // candidate is visible and scatters one mat4.
+        BufferCreateInfo transformInfo{};
+        transformInfo.size = (allocSize / sizeof(Candidate)) * sizeof(glm::mat4);
+        transformInfo.usage = BufferUsage::StorageVertex;
+        transformInfo.hostVisible = false;
+        transformInfo.debugName = "occlusionTransforms";
+        auto transformResult = m_memoryManager->createBuffer(transformInfo);
+        if (!transformResult.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to create transform buffer");
+        }
+        frame.transforms = transformResult.getValue();
+        frame.setDirty = true;
+    }
+
+    VkDeviceSize commandSize = VkDeviceSize(commandCount) * commandStride();
+    if (!frame.commands || frame.commands->getSize() < commandSize) {
+        BufferCreateInfo commandInfo{};
+        commandInfo.size = std::max<VkDeviceSize>(commandSize * 2, 64 * commandStride());
+        commandInfo.usage = BufferUsage::Indirect;
+        commandInfo.hostVisible = true;
+        commandInfo.debugName = "occlusionCommands";
+        auto result = m_memoryManager->createBuffer(commandInfo);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to create indirect command buffer");
+        }
+        frame.commands = result.getValue();
+        frame.setDirty = true;
+    }
+
+    if (!frame.uniforms) {
+        auto result = m_memoryManager->createUniformBuffer(sizeof(CullUniforms));
+        if (!result.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to create cull uniform buffer");
+        }
+        frame.uniforms = result.getValue();
+        frame.setDirty = true;
+    }
+}
+
+void OcclusionCuller::updateCullDescriptors(FrameResources& frame) {
+    if (frame.cullSet == VK_NULL_HANDLE) {
+        auto setResult = m_descriptorPool->allocateDescriptorSet(m_cullSetLayout);
+        if (!setResult.isSuccess()) {
+            throw std::runtime_error("OcclusionCuller: failed to allocate cull set: " +
+                                     setResult.getError().message);
+        }
+        frame.cullSet = setResult.getValue();
+    }
+
+    VkDescriptorBufferInfo candidateInfo{frame.candidates->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo commandInfo{frame.commands->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo transformInfo{frame.transforms->getHandle(), 0, VK_WHOLE_SIZE};
+    VkDescriptorBufferInfo uniformInfo{frame.uniforms->getHandle(), 0, sizeof(CullUniforms)};
+
+    VkDescriptorImageInfo pyramidInfo{};
+    pyramidInfo.sampler = m_reduceSampler;
+    pyramidInfo.imageView = m_pyramid->getImageView();
+    pyramidInfo.imageLayout = kPyramidLayout;
+
+    std::array<VkWriteDescriptorSet, 5> writes{};
+    for (auto& write : writes) {
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = frame.cullSet;
+        write.descriptorCount = 1;
+    }
+    writes[0].dstBinding = 0;
+    writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writes[0].pBufferInfo = &candidateInfo;
+    writes[1].dstBinding = 1;
+    writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writes[1].pBufferInfo = &commandInfo;
+    writes[2].dstBinding = 2;
+    writes[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writes[2].pBufferInfo = &transformInfo;
+    writes[3].dstBinding = 3;
+    writes[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writes[3].pImageInfo = &pyramidInfo;
+    writes[4].dstBinding = 4;
+    writes[4].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    writes[4].pBufferInfo = &uniformInfo;
+
+    vkUpdateDescriptorSets(m_device.getDevice(),
+                           static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    frame.setDirty = false;
+}
+
+void OcclusionCuller::prepare(uint32_t frameIndex,
+                              const Candidate* candidates, uint32_t candidateCount,
+                              const VkDrawIndexedIndirectCommand* commands, uint32_t commandCount,
+                              const glm::mat4& view, const glm::mat4& proj, float nearPlane) {
+    FrameResources& frame = m_frames[frameIndex];
+    frame.candidateCount = candidateCount;
+    frame.commandCount = commandCount;
+    if (candidateCount == 0) return;
+
+    growFrameBuffers(frame, candidateCount, commandCount);
+
+    frame.candidates->copyData(candidates, VkDeviceSize(candidateCount) * sizeof(Candidate));
+    frame.commands->copyData(commands, VkDeviceSize(commandCount) * commandStride());
+
+    CullUniforms uniforms{};
+    uniforms.view = view;
+    uniforms.proj = proj;
+    uniforms.pyramidInfo = glm::vec4(
+        static_cast<float>(m_pyramid->getWidth()),
+        static_cast<float>(m_pyramid->getHeight()),
+        static_cast<float>(m_pyramid->getMipLevels()),
+        m_pyramidReady ? 1.0f : 0.0f);
+    uniforms.params = glm::vec4(nearPlane, static_cast<float>(candidateCount), 0.0f, 0.0f);
+    frame.uniforms->copyData(&uniforms, sizeof(uniforms));
+
+    if (frame.setDirty) {
+        updateCullDescriptors(frame);
+    }
+}
+
+// ============================================================================
+// Command Recording
+// ============================================================================
+
+void OcclusionCuller::recordCull(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    FrameResources& frame = m_frames[frameIndex];
+    if (frame.candidateCount == 0) return;
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                      m_cullPipeline->getPipeline());
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                            m_cullPipelineLayout, 0, 1, &frame.cullSet, 0, nullptr);
+
+    uint32_t groups = (frame.candidateCount + 63) / 64;
+    vkCmdDispatch(commandBuffer, groups, 1, 1);
+
+    // Make the compacted commands visible to indirect fetch and the
+    // scattered transforms visible to vertex attribute reads.
+    std::array<VkBufferMemoryBarrier, 2> barriers{};
+    for (auto& barrier : barriers) {
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.offset = 0;
+        barrier.size = VK_WHOLE_SIZE;
+    }
+    barriers[0].dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    barriers[0].buffer = frame.commands->getHandle();
+    barriers[1].dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+    barriers[1].buffer = frame.transforms->getHandle();
+
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+        0, 0, nullptr,
+        static_cast<uint32_t>(barriers.size()), barriers.data(), 0, nullptr);
+}
+
+void OcclusionCuller::recordPyramidBuild(VkCommandBuffer commandBuffer,
+                                         const std::shared_ptr<Image>& depthImage) {
+    VkDevice device = m_device.getDevice();
+
+    // Mip 0 samples the scene depth buffer; rebind lazily when the depth
+    // buffer changes (swapchain recreation happens at device idle, so the
+    // set is not referenced by in-flight work at that point).
+    if (m_lastDepthView != depthImage->getImageView()) {
+        VkDescriptorImageInfo depthInfo{};
+        depthInfo.sampler = m_reduceSampler;
+        depthInfo.imageView = depthImage->getImageView();
+        depthInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_reduceSets[0];
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &depthInfo;
+        vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+        m_lastDepthView = depthImage->getImageView();
+    }
+
+    // Depth buffer: attachment write -> compute sample
+    VkImageMemoryBarrier depthToRead{};
+    depthToRead.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    depthToRead.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    depthToRead.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    depthToRead.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    depthToRead.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    depthToRead.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    depthToRead.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    depthToRead.image = depthImage->getHandle();
+    depthToRead.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1};
+
+    // Pyramid: previous contents are overwritten, so discard via UNDEFINED.
+    // Also waits for last frame's cull dispatch to finish sampling.
+    VkImageMemoryBarrier pyramidToWrite{};
+    pyramidToWrite.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    pyramidToWrite.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    pyramidToWrite.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+    pyramidToWrite.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    pyramidToWrite.newLayout = kPyramidLayout;
+    pyramidToWrite.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    pyramidToWrite.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    pyramidToWrite.image = m_pyramid->getHandle();
+    pyramidToWrite.subresourceRange =
+        {VK_IMAGE_ASPECT_COLOR_BIT, 0, m_pyramid->getMipLevels(), 0, 1};
+
+    std::array<VkImageMemoryBarrier, 2> preBarriers{depthToRead, pyramidToWrite};
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 0, nullptr, 0, nullptr,
+        static_cast<uint32_t>(preBarriers.size()), preBarriers.data());
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                      m_reducePipeline->getPipeline());
+
+    uint32_t mips = m_pyramid->getMipLevels();
+    uint32_t width = m_pyramid->getWidth();
+    uint32_t height = m_pyramid->getHeight();
+
+    for (uint32_t mip = 0; mip < mips; mip++) {
+        uint32_t mipWidth = std::max(width >> mip, 1u);
+        uint32_t mipHeight = std::max(height >> mip, 1u);
+
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                m_reducePipelineLayout, 0, 1, &m_reduceSets[mip], 0, nullptr);
+
+        uint32_t outputSize[2] = {mipWidth, mipHeight};
+        vkCmdPushConstants(commandBuffer, m_reducePipelineLayout,
+                           VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(outputSize), outputSize);
+
+        vkCmdDispatch(commandBuffer, (mipWidth + 7) / 8, (mipHeight + 7) / 8, 1);
+
+        // Next mip samples this one; layout stays GENERAL
+        if (mip + 1 < mips) {
+            VkImageMemoryBarrier mipBarrier{};
+            mipBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            mipBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            mipBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            mipBarrier.oldLayout = kPyramidLayout;
+            mipBarrier.newLayout = kPyramidLayout;
+            mipBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            mipBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            mipBarrier.image = m_pyramid->getHandle();
+            mipBarrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, 0, 1};
+
+            vkCmdPipelineBarrier(commandBuffer,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                0, 0, nullptr, 0, nullptr, 1, &mipBarrier);
+        }
+    }
+
+    // Return the depth buffer to the layout the next render pass expects and
+    // publish the finished pyramid for the next frame's cull dispatch.
+    VkImageMemoryBarrier depthToAttachment = depthToRead;
+    depthToAttachment.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    depthToAttachment.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                      VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    depthToAttachment.oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    depthToAttachment.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkImageMemoryBarrier pyramidToSample = pyramidToWrite;
+    pyramidToSample.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    pyramidToSample.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    pyramidToSample.oldLayout = kPyramidLayout;
+
+    std::array<VkImageMemoryBarrier, 2> postBarriers{depthToAttachment, pyramidToSample};
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 0, nullptr, 0, nullptr,
+        static_cast<uint32_t>(postBarriers.size()), postBarriers.data());
+
+    m_pyramidReady = true;
+}
+
+// ============================================================================
+// Accessors
+// ============================================================================
+
+VkBuffer OcclusionCuller::commandsBuffer(uint32_t frameIndex) const {
+    return m_frames[frameIndex].commands->getHandle();
+}
+
+VkBuffer OcclusionCuller::transformsBuffer(uint32_t frameIndex) const {
+    return m_frames[frameIndex].transforms->getHandle();
+}
+
+} // namespace vkeng
@@ -64,8 +64,14 @@ void OrbitCameraController::setHomeView(const glm::vec3& target, float distance,
 void OrbitCameraController::update(float deltaTime) {
     bool cursorCaptured = m_inputManager.isCursorCaptured();
 
+    // In late-latch mode consume (read-and-clear) so the same movement is
+    // never applied twice across update() and lateLatch()
     double deltaX, deltaY;
-    m_inputManager.getMouseDelta(deltaX, deltaY);
+    if (m_lateLatch) {
+        m_inputManager.consumeMouseDelta(deltaX, deltaY);
+    } else {
+        m_inputManager.getMouseDelta(deltaX, deltaY);
+    }
 
     if (cursorCaptured) {
         // Continuous orbit when cursor is captured
@@ -90,7 +96,41 @@ void OrbitCameraController::update(float deltaTime) {
 
     // Scroll zoom (always available)
     double scrollY;
-    m_inputManager.getScrollDelta(scrollY);
+    if (m_lateLatch) {
+        m_inputManager.consumeScrollDelta(scrollY);
+    } else {
+        m_inputManager.getScrollDelta(scrollY);
+    }
+    if (std::abs(scrollY) > 0.01) {
+        handleZoom(static_cast<float>(scrollY));
+    }
+}
+
+// ============================================================================
+// Late Latch — View-Affecting Input Only
+// ============================================================================
+
+void OrbitCameraController::lateLatch() {
+    if (!m_lateLatch) return;
+
+    bool cursorCaptured = m_inputManager.isCursorCaptured();
+
+    // Consume only what arrived since update() drained the deltas
+    double deltaX, deltaY;
+    m_inputManager.consumeMouseDelta(deltaX, deltaY);
+
+    if (std::abs(deltaX) > 0.01 || std::abs(deltaY) > 0.01) {
+        if (cursorCaptured || m_inputManager.isMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT)) {
+            handleOrbit(static_cast<float>(deltaX), static_cast<float>(deltaY));
+        } else if (m_inputManager.isMouseButtonPressed(GLFW_MOUSE_BUTTON_MIDDLE) ||
+                   m_inputManager.isMouseButtonPressed(GLFW_MOUSE_BUTTON_RIGHT)) {
+            handlePan(static_cast<float>(deltaX), static_cast<float>(deltaY));
+        }
+    }
+
+    // Keyboard movement needs a delta time and stays in update()
+    double scrollY;
+    m_inputManager.consumeScrollDelta(scrollY);
     if (std::abs(scrollY) > 0.01) {
         handleZoom(static_cast<float>(scrollY));
     }
@@ -0,0 +1,535 @@
+/**
+ * @file ParticleSystem.cpp
+ * @brief Implementation of particle simulation and rendering
+ */
+
+#include "vulkan-engine/rendering/ParticleSystem.hpp"
+#include "vulkan-engine/components/ComponentPool.hpp"
+#include "vulkan-engine/components/ParticleEmitter.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    // Sim set: binding 0 reads last frame's particles, binding 1 writes
+    // this frame's. Two sets per emitter cover both ping-pong directions.
+    const std::vector<DescriptorBinding> kSimBindings = {
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT},
+    };
+}
+
+ParticleSystem::ParticleSystem(VulkanDevice& device,
+                               std::shared_ptr<MemoryManager> memoryManager,
+                               PipelineManager& pipelineManager,
+                               uint32_t framesInFlight,
+                               const std::filesystem::path& shaderDir)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager)
+    , m_framesInFlight(framesInFlight) {
+
+    VkDevice vkDevice = m_device.getDevice();
+
+    auto layoutResult = DescriptorSetLayout::create(vkDevice, kSimBindings);
+    if (!layoutResult.isSuccess()) {
+        throw std::runtime_error("ParticleSystem: failed to create sim set layout: " +
+                                 layoutResult.getError().message);
+    }
+    m_simSetLayout = layoutResult.getValue();
+
+    // Two sets (one per ping-pong direction) for each possible GPU emitter
+    auto poolResult = DescriptorPool::create(vkDevice, 2 * kMaxGpuEmitters, {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4 * kMaxGpuEmitters},
+    });
+    if (!poolResult.isSuccess()) {
+        throw std::runtime_error("ParticleSystem: failed to create descriptor pool: " +
+                                 poolResult.getError().message);
+    }
+    m_descriptorPool = poolResult.getValue();
+
+    VkDescriptorSetLayout setLayout = m_simSetLayout->getHandle();
+    VkPushConstantRange pushRange{};
+    pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushRange.offset = 0;
+    pushRange.size = sizeof(SimPushConstants);
+
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &setLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushRange;
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, nullptr, &m_simPipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("ParticleSystem: failed to create sim pipeline layout");
+    }
+
+    // Workgroup size is a specialization constant so it can be tuned
+    // without editing the shader
+    ComputePipelineConfig simConfig;
+    simConfig.compShaderPath = shaderDir / "particle_sim.spv";
+    simConfig.layout = m_simPipelineLayout;
+    simConfig.specConstants = {{0, kSimWorkgroupSize}};
+    m_simPipeline = m_pipelineManager.getComputePipeline(simConfig);
+
+    // Draw variant: blended camera-facing quads that read depth but don't
+    // write it, so particles layer over the scene without sorting against it
+    m_drawConfig.vertShaderPath = shaderDir / "particle_vert.spv";
+    m_drawConfig.fragShaderPath = shaderDir / "particle_frag.spv";
+    m_drawConfig.blendMode = BlendMode::AlphaBlend;
+    m_drawConfig.cullMode = CullMode::None;
+    m_drawConfig.depthWriteEnable = false;
+    m_drawConfig.depthTestEnable = true;
+    m_drawConfig.vertexFormat = VertexFormat::Particle;
+
+    LOG_INFO(RENDERING, "ParticleSystem created (GPU threshold {}, workgroup {}, {} GPU emitters max)",
+             kGpuSimThreshold, kSimWorkgroupSize, kMaxGpuEmitters);
+}
+
+ParticleSystem::~ParticleSystem() {
+    if (m_simPipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_device.getDevice(), m_simPipelineLayout, nullptr);
+    }
+}
+
+// ============================================================================
+// Emitter Slot Pool
+// ============================================================================
+
+/**
+ * @brief Finds or builds a slot for a newly seen emitter.
+ *
+ * Free slots with identical capacity and path are reused as-is (buffers,
+ * descriptor sets and all); otherwise the first free index is rebuilt or a
+ * new slot is appended.
+ */
+uint32_t ParticleSystem::acquireSlot(const ParticleEmitter& emitter, const glm::vec3& origin) {
+    (void)origin;
+    uint32_t capacity = std::max(1u, emitter.getMaxParticles());
+    bool gpu = capacity >= kGpuSimThreshold && m_gpuEmitters < kMaxGpuEmitters;
+    if (capacity >= kGpuSimThreshold && !gpu) {
+        LOG_WARN(RENDERING, "ParticleSystem: GPU emitter cap ({}) reached, emitter with {} particles falls back to CPU",
+                 kMaxGpuEmitters, capacity);
+    }
+
+    // Prefer an exact-match recycled slot: no allocation, no descriptor work
+    uint32_t slotIndex = UINT32_MAX;
+    for (size_t i = 0; i < m_freeSlots.size(); ++i) {
+        EmitterSlot& candidate = *m_slots[m_freeSlots[i]];
+        if (candidate.capacity == capacity && candidate.gpu == gpu) {
+            slotIndex = m_freeSlots[i];
+            m_freeSlots.erase(m_freeSlots.begin() + i);
+            break;
+        }
+    }
+    if (slotIndex == UINT32_MAX) {
+        // Only rebuild free slots without GPU resources: descriptor sets
+        // can't be returned to the pool individually, so GPU slots are
+        // reused exact-match only (above) and otherwise left parked
+        for (size_t i = 0; i < m_freeSlots.size(); ++i) {
+            if (!m_slots[m_freeSlots[i]]->simBuffers[0]) {
+                slotIndex = m_freeSlots[i];
+                m_freeSlots.erase(m_freeSlots.begin() + i);
+                *m_slots[slotIndex] = EmitterSlot{};
+                break;
+            }
+        }
+    }
+    if (slotIndex == UINT32_MAX) {
+        slotIndex = static_cast<uint32_t>(m_slots.size());
+        m_slots.push_back(std::make_unique<EmitterSlot>());
+    }
+
+    EmitterSlot& slot = *m_slots[slotIndex];
+    slot.emitter = &emitter;
+    slot.capacity = capacity;
+    slot.gpu = gpu;
+    slot.aliveCount = 0;
+    slot.spawnAccum = 0.0f;
+    slot.readIndex = 0;
+    slot.gpuInitialized = false;
+
+    VkDeviceSize instanceBytes = VkDeviceSize(capacity) * sizeof(ParticleInstance);
+
+    if (gpu) {
+        if (!slot.simBuffers[0]) {
+            for (uint32_t i = 0; i < 2; ++i) {
+                BufferCreateInfo info{};
+                info.size = instanceBytes;
+                info.usage = BufferUsage::StorageVertex;
+                info.hostVisible = false;
+                info.debugName = "particleSim";
+                auto bufferResult = m_memoryManager->createBuffer(info);
+                if (!bufferResult.isSuccess()) {
+                    throw std::runtime_error("ParticleSystem: failed to create sim buffer: " +
+                                             bufferResult.getError().message);
+                }
+                slot.simBuffers[i] = bufferResult.getValue();
+
+                auto setResult = m_descriptorPool->allocateDescriptorSet(m_simSetLayout);
+                if (!setResult.isSuccess()) {
+                    throw std::runtime_error("ParticleSystem: failed to allocate sim descriptor set: " +
+                                             setResult.getError().message);
+                }
+                slot.sets[i] = setResult.getValue();
+            }
+
+            // sets[i] reads buffer i and writes buffer 1-i
+            for (uint32_t i = 0; i < 2; ++i) {
+                VkDescriptorBufferInfo readInfo{slot.simBuffers[i]->getHandle(), 0, VK_WHOLE_SIZE};
+                VkDescriptorBufferInfo writeInfo{slot.simBuffers[1 - i]->getHandle(), 0, VK_WHOLE_SIZE};
+
+                std::array<VkWriteDescriptorSet, 2> writes{};
+                std::array<VkDescriptorBufferInfo*, 2> infos = {&readInfo, &writeInfo};
+                for (uint32_t b = 0; b < writes.size(); b++) {
+                    writes[b].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                    writes[b].dstSet = slot.sets[i];
+                    writes[b].dstBinding = b;
+                    writes[b].descriptorCount = 1;
+                    writes[b].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                    writes[b].pBufferInfo = infos[b];
+                }
+                vkUpdateDescriptorSets(m_device.getDevice(),
+                                       static_cast<uint32_t>(writes.size()),
+                                       writes.data(), 0, nullptr);
+            }
+        }
+        m_gpuEmitters++;
+    } else {
+        slot.posX.resize(capacity);
+        slot.posY.resize(capacity);
+        slot.posZ.resize(capacity);
+        slot.velX.resize(capacity);
+        slot.velY.resize(capacity);
+        slot.velZ.resize(capacity);
+        slot.life.resize(capacity);
+        slot.maxLife.resize(capacity);
+        slot.scratch.resize(capacity);
+
+        if (slot.instanceBuffers.empty()) {
+            slot.instanceBuffers.resize(m_framesInFlight);
+            for (auto& buffer : slot.instanceBuffers) {
+                auto bufferResult = m_memoryManager->createVertexBuffer(instanceBytes, true);
+                if (!bufferResult.isSuccess()) {
+                    throw std::runtime_error("ParticleSystem: failed to create instance buffer: " +
+                                             bufferResult.getError().message);
+                }
+                buffer = bufferResult.getValue();
+            }
+        }
+    }
+
+    m_slotOf[&emitter] = slotIndex;
+    m_activeEmitters++;
+    LOG_DEBUG(RENDERING, "ParticleSystem: emitter slot {} acquired ({} particles, {} path)",
+              slotIndex, capacity, gpu ? "GPU" : "CPU");
+    return slotIndex;
+}
+
+/**
+ * @brief Returns a slot to the free list, keeping its storage for reuse.
+ */
+void ParticleSystem::releaseSlot(uint32_t slotIndex) {
+    EmitterSlot& slot = *m_slots[slotIndex];
+    m_slotOf.erase(slot.emitter);
+    if (slot.gpu) {
+        m_gpuEmitters--;
+    }
+    slot.emitter = nullptr;
+    slot.aliveCount = 0;
+    m_freeSlots.push_back(slotIndex);
+    m_activeEmitters--;
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+void ParticleSystem::update(float deltaTime) {
+    m_time += deltaTime;
+
+    for (auto& slot : m_slots) {
+        slot->seen = false;
+    }
+
+    ComponentPools::get().forEachComponent<ParticleEmitter>([&](ParticleEmitter& emitter) {
+        SceneNode* owner = emitter.getOwner();
+        if (!emitter.isEnabled() || !owner || !owner->isActiveInHierarchy()) {
+            return;
+        }
+        glm::vec3 origin = owner->getWorldPosition();
+
+        auto found = m_slotOf.find(&emitter);
+        uint32_t slotIndex;
+        if (found != m_slotOf.end()) {
+            slotIndex = found->second;
+            // Capacity edits re-allocate: release the old slot and take a
+            // fresh one sized for the new pool
+            if (m_slots[slotIndex]->capacity != std::max(1u, emitter.getMaxParticles())) {
+                releaseSlot(slotIndex);
+                slotIndex = acquireSlot(emitter, origin);
+            }
+        } else {
+            slotIndex = acquireSlot(emitter, origin);
+        }
+
+        EmitterSlot& slot = *m_slots[slotIndex];
+        slot.seen = true;
+
+        if (slot.gpu) {
+            // Latch this frame's inputs; the dispatch records later from
+            // the render thread
+            SimPushConstants& pc = slot.pushConstants;
+            pc.originAndDt = glm::vec4(origin, deltaTime);
+            pc.velocityAndSeed = glm::vec4(emitter.getInitialVelocity(), m_time);
+            pc.varianceAndSpawnRate = glm::vec4(emitter.getVelocityVariance(), emitter.getSpawnRate());
+            pc.gravityAndCapacity = glm::vec4(emitter.getGravity(), static_cast<float>(slot.capacity));
+            pc.startColor = emitter.getStartColor();
+            pc.endColor = emitter.getEndColor();
+            pc.sizeAndLifetime = glm::vec4(emitter.getStartSize(), emitter.getEndSize(),
+                                           emitter.getLifetimeMin(), emitter.getLifetimeMax());
+        } else {
+            simulateCpu(slot, emitter, origin, deltaTime);
+        }
+    });
+
+    // Sweep: emitters that vanished (or were disabled) release their slots.
+    // Iterate by index — releaseSlot edits the free list, not m_slots.
+    for (uint32_t i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i]->emitter && !m_slots[i]->seen) {
+            releaseSlot(i);
+        }
+    }
+}
+
+/**
+ * @brief Integrates, kills, and spawns one CPU emitter's particles.
+ *
+ * The SoA arrays keep the integrate loop streaming; deaths compact via
+ * swap-with-last so the live range stays dense and the draw can use
+ * aliveCount as the instance count directly.
+ */
+void ParticleSystem::simulateCpu(EmitterSlot& slot, const ParticleEmitter& emitter,
+                                 const glm::vec3& origin, float deltaTime) {
+    const glm::vec3 gravity = emitter.getGravity();
+
+    // Integrate and compact; the swapped-in particle re-runs at index i
+    for (uint32_t i = 0; i < slot.aliveCount;) {
+        slot.life[i] -= deltaTime;
+        if (slot.life[i] <= 0.0f) {
+            uint32_t last = --slot.aliveCount;
+            slot.posX[i] = slot.posX[last]; slot.posY[i] = slot.posY[last]; slot.posZ[i] = slot.posZ[last];
+            slot.velX[i] = slot.velX[last]; slot.velY[i] = slot.velY[last]; slot.velZ[i] = slot.velZ[last];
+            slot.life[i] = slot.life[last];
+            slot.maxLife[i] = slot.maxLife[last];
+            continue;
+        }
+        slot.velX[i] += gravity.x * deltaTime;
+        slot.velY[i] += gravity.y * deltaTime;
+        slot.velZ[i] += gravity.z * deltaTime;
+        slot.posX[i] += slot.velX[i] * deltaTime;
+        slot.posY[i] += slot.velY[i] * deltaTime;
+        slot.posZ[i] += slot.velZ[i] * deltaTime;
+        ++i;
+    }
+
+    // Spawn at the configured rate, carrying the fractional remainder
+    slot.spawnAccum += emitter.getSpawnRate() * deltaTime;
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> zeroOne(0.0f, 1.0f);
+    const glm::vec3 velocity = emitter.getInitialVelocity();
+    const glm::vec3 variance = emitter.getVelocityVariance();
+
+    while (slot.spawnAccum >= 1.0f && slot.aliveCount < slot.capacity) {
+        slot.spawnAccum -= 1.0f;
+        uint32_t i = slot.aliveCount++;
+        slot.posX[i] = origin.x;
+        slot.posY[i] = origin.y;
+        slot.posZ[i] = origin.z;
+        slot.velX[i] = velocity.x + variance.x * unit(m_rng);
+        slot.velY[i] = velocity.y + variance.y * unit(m_rng);
+        slot.velZ[i] = velocity.z + variance.z * unit(m_rng);
+        float lifetime = emitter.getLifetimeMin() +
+            (emitter.getLifetimeMax() - emitter.getLifetimeMin()) * zeroOne(m_rng);
+        slot.life[i] = lifetime;
+        slot.maxLife[i] = lifetime;
+    }
+    // Saturated pool: drop the backlog instead of bursting when slots free up
+    if (slot.spawnAccum > 1.0f) {
+        slot.spawnAccum = 1.0f;
+    }
+}
+
+// ============================================================================
+// Per-Frame GPU Work
+// ============================================================================
+
+void ParticleSystem::prepare(uint32_t frameIndex) {
+    for (auto& slotPtr : m_slots) {
+        EmitterSlot& slot = *slotPtr;
+        if (!slot.emitter || slot.gpu || slot.aliveCount == 0) {
+            continue;
+        }
+
+        const ParticleEmitter& emitter = *slot.emitter;
+        const glm::vec4 startColor = emitter.getStartColor();
+        const glm::vec4 endColor = emitter.getEndColor();
+        const float startSize = emitter.getStartSize();
+        const float endSize = emitter.getEndSize();
+
+        // Evaluate the ramps on upload rather than in simulate: a particle
+        // only needs its display color/size when it is actually drawn
+        for (uint32_t i = 0; i < slot.aliveCount; ++i) {
+            float t = 1.0f - slot.life[i] / slot.maxLife[i];
+            glm::vec4 color = glm::mix(startColor, endColor, t);
+            ParticleInstance& instance = slot.scratch[i];
+            instance.positionAndSize = glm::vec4(
+                slot.posX[i], slot.posY[i], slot.posZ[i],
+                startSize + (endSize - startSize) * t);
+            instance.velocityAndLife = glm::vec4(
+                slot.velX[i], slot.velY[i], slot.velZ[i], slot.life[i]);
+            instance.colorAndMaxLife = glm::vec4(glm::vec3(color) * color.a, slot.maxLife[i]);
+        }
+
+        slot.instanceBuffers[frameIndex]->copyData(
+            slot.scratch.data(), VkDeviceSize(slot.aliveCount) * sizeof(ParticleInstance));
+    }
+}
+
+void ParticleSystem::recordSimulate(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    (void)frameIndex;
+    if (m_gpuEmitters == 0) {
+        return;
+    }
+
+    // First use of a slot: mark every particle dead (zeroed life) so the
+    // shader's staggered-spawn logic takes over from a known state
+    bool filled = false;
+    for (auto& slotPtr : m_slots) {
+        EmitterSlot& slot = *slotPtr;
+        if (!slot.emitter || !slot.gpu || slot.gpuInitialized) {
+            continue;
+        }
+        vkCmdFillBuffer(commandBuffer, slot.simBuffers[0]->getHandle(), 0, VK_WHOLE_SIZE, 0);
+        vkCmdFillBuffer(commandBuffer, slot.simBuffers[1]->getHandle(), 0, VK_WHOLE_SIZE, 0);
+        slot.gpuInitialized = true;
+        filled = true;
+    }
+
+    // One barrier covers both hazards before the dispatches: the fills
+    // above (transfer write -> compute read) and the previous frame's
+    // vertex fetch of the buffer this frame writes (write-after-read)
+    VkMemoryBarrier preBarrier{};
+    preBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    preBarrier.srcAccessMask = filled ? VK_ACCESS_TRANSFER_WRITE_BIT : 0;
+    preBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+            (filled ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 1, &preBarrier, 0, nullptr, 0, nullptr);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                      m_simPipeline->getPipeline());
+
+    std::vector<VkBufferMemoryBarrier> postBarriers;
+    postBarriers.reserve(m_gpuEmitters);
+
+    for (auto& slotPtr : m_slots) {
+        EmitterSlot& slot = *slotPtr;
+        if (!slot.emitter || !slot.gpu) {
+            continue;
+        }
+
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                m_simPipelineLayout, 0, 1, &slot.sets[slot.readIndex],
+                                0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_simPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, sizeof(SimPushConstants), &slot.pushConstants);
+
+        uint32_t groups = (slot.capacity + kSimWorkgroupSize - 1) / kSimWorkgroupSize;
+        vkCmdDispatch(commandBuffer, groups, 1, 1);
+
+        // The dispatch wrote the other buffer; the draw (and next frame's
+        // sim read) use it from here on
+        slot.readIndex = 1 - slot.readIndex;
+
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = slot.simBuffers[slot.readIndex]->getHandle();
+        barrier.offset = 0;
+        barrier.size = VK_WHOLE_SIZE;
+        postBarriers.push_back(barrier);
+    }
+
+    // Make the written particles visible to this frame's vertex fetch and
+    // next frame's sim read
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 0, nullptr,
+        static_cast<uint32_t>(postBarriers.size()), postBarriers.data(), 0, nullptr);
+}
+
+// ============================================================================
+// Drawing
+// ============================================================================
+
+void ParticleSystem::recordDraw(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                                VkExtent2D extent, uint32_t frameIndex) {
+    if (m_activeEmitters == 0) {
+        return;
+    }
+
+    auto pipeline = m_pipelineManager.getPipeline(m_drawConfig, renderPass, extent);
+    if (!pipeline) {
+        return;
+    }
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->getPipeline());
+
+    for (auto& slotPtr : m_slots) {
+        EmitterSlot& slot = *slotPtr;
+        if (!slot.emitter) {
+            continue;
+        }
+
+        // GPU emitters draw their full pool — dead particles collapse to
+        // zero-size quads in the vertex shader and rasterize nothing
+        uint32_t instanceCount = slot.gpu ? slot.capacity : slot.aliveCount;
+        if (instanceCount == 0) {
+            continue;
+        }
+        if (slot.gpu && !slot.gpuInitialized) {
+            continue;  // No sim recorded yet; buffer contents are undefined
+        }
+
+        VkBuffer buffer = slot.gpu
+            ? slot.simBuffers[slot.readIndex]->getHandle()
+            : slot.instanceBuffers[frameIndex]->getHandle();
+        VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &buffer, &offset);
+        vkCmdDraw(commandBuffer, 6, instanceCount, 0, 0);
+    }
+}
+
+uint32_t ParticleSystem::particleCount() const {
+    uint32_t count = 0;
+    for (const auto& slot : m_slots) {
+        if (!slot->emitter) {
+            continue;
+        }
+        count += slot->gpu ? slot->capacity : slot->aliveCount;
+    }
+    return count;
+}
+
+} // namespace vkeng
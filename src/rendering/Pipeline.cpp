@@ -3,16 +3,36 @@
 #include "vulkan-engine/core/Logger.hpp"
 #include <stdexcept>
 #include <fstream>
+#include <cstring>
 #include <vulkan/vulkan_core.h>
 
 namespace vkeng {
 
+    namespace {
+        /**
+         * @brief Header prepended to the on-disk pipeline cache blob.
+         *
+         * The pipelineCacheUUID changes with GPU and driver version, so a
+         * mismatch means the blob cannot be reused and is discarded before it
+         * ever reaches the driver.
+         */
+        constexpr uint32_t kCacheFileMagic = 0x564B5043;   // 'VKPC'
+        constexpr uint32_t kCacheFileVersion = 1;
+
+        struct CacheFileHeader {
+            uint32_t magic = kCacheFileMagic;
+            uint32_t version = kCacheFileVersion;
+            uint8_t pipelineCacheUUID[VK_UUID_SIZE] = {};
+        };
+    }
+
     // ============================================================================
     // PipelineCache
     // ============================================================================
 
-    PipelineCache::PipelineCache(VkDevice device, const std::filesystem::path& cacheFilePath)
-        : m_device(device), m_cacheFilePath(cacheFilePath) {
+    PipelineCache::PipelineCache(VkDevice device, VkPhysicalDevice physicalDevice,
+                                 const std::filesystem::path& cacheFilePath)
+        : m_device(device), m_physicalDevice(physicalDevice), m_cacheFilePath(cacheFilePath) {
 
         // Attempt to load previously saved cache data from disk.
         std::vector<char> initialData;
@@ -23,7 +43,33 @@ namespace vkeng {
                 initialData.resize(fileSize);
                 cacheFile.seekg(0);
                 cacheFile.read(initialData.data(), static_cast<std::streamsize>(fileSize));
-                LOG_INFO(RENDERING, "Loaded pipeline cache from disk ({} bytes)", fileSize);
+            }
+        }
+
+        // Validate our versioned header (magic + format version + device UUID)
+        // and strip it, leaving only the raw driver blob.
+        if (!initialData.empty()) {
+            bool headerValid = initialData.size() >= sizeof(CacheFileHeader);
+            if (headerValid) {
+                CacheFileHeader header{};
+                std::memcpy(&header, initialData.data(), sizeof(header));
+                headerValid = header.magic == kCacheFileMagic &&
+                              header.version == kCacheFileVersion;
+
+                if (headerValid && m_physicalDevice != VK_NULL_HANDLE) {
+                    VkPhysicalDeviceProperties props{};
+                    vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+                    headerValid = std::memcmp(header.pipelineCacheUUID,
+                                              props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+                }
+            }
+
+            if (headerValid) {
+                initialData.erase(initialData.begin(), initialData.begin() + sizeof(CacheFileHeader));
+                LOG_INFO(RENDERING, "Loaded pipeline cache from disk ({} bytes)", initialData.size());
+            } else {
+                LOG_INFO(RENDERING, "Discarding pipeline cache file (different GPU/driver or format version)");
+                initialData.clear();
             }
         }
 
@@ -72,9 +118,20 @@ namespace vkeng {
                      m_cacheFilePath.string());
             return;
         }
+
+        // Prepend the versioned header so the next launch can reject blobs
+        // from a different GPU or driver without involving the driver at all.
+        CacheFileHeader header{};
+        if (m_physicalDevice != VK_NULL_HANDLE) {
+            VkPhysicalDeviceProperties props{};
+            vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+            std::memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+        }
+        outFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
         outFile.write(data.data(), static_cast<std::streamsize>(dataSize));
         LOG_INFO(RENDERING, "Saved pipeline cache to {} ({} bytes)",
-                 m_cacheFilePath.string(), dataSize);
+                 m_cacheFilePath.string(), sizeof(header) + dataSize);
     }
     /**
      * @brief Constructs the graphics pipeline.
@@ -86,6 +143,26 @@ namespace vkeng {
         : device_(device), layout_(pipelineLayout), renderPass_(rp), extent_(extent),
           config_(config), vertPath_(config.vertShaderPath), fragPath_(config.fragShaderPath) {
 
+        // Mesh-shading variants skip the vertex pipeline entirely
+        if (!config.meshShaderPath.empty()) {
+            VkShaderModule taskShaderModule = VK_NULL_HANDLE;
+            if (!config.taskShaderPath.empty()) {
+                taskShaderModule = createShaderModule(readFile(config.taskShaderPath));
+            }
+            VkShaderModule meshShaderModule = createShaderModule(readFile(config.meshShaderPath));
+            VkShaderModule fragShaderModule = createShaderModule(readFile(config.fragShaderPath));
+
+            createMeshShadingPipeline(taskShaderModule, meshShaderModule, fragShaderModule,
+                                      cache, config);
+
+            vkDestroyShaderModule(device_, fragShaderModule, nullptr);
+            vkDestroyShaderModule(device_, meshShaderModule, nullptr);
+            if (taskShaderModule != VK_NULL_HANDLE) {
+                vkDestroyShaderModule(device_, taskShaderModule, nullptr);
+            }
+            return;
+        }
+
         auto vertShaderCode = readFile(config.vertShaderPath);
         auto fragShaderCode = readFile(config.fragShaderPath);
 
@@ -126,6 +203,17 @@ namespace vkeng {
         createGraphicsPipeline(vertModule, fragModule, cache, config_);
     }
 
+    Pipeline::Pipeline(VkDevice device, VkRenderPass rp, VkPipelineLayout pipelineLayout, VkExtent2D extent,
+                   const PipelineConfig& config,
+                   VkShaderModule vertModule, VkShaderModule fragModule,
+                   VkPipelineCache cache)
+        : device_(device), layout_(pipelineLayout), renderPass_(rp), extent_(extent),
+          config_(config), vertPath_(config.vertShaderPath), fragPath_(config.fragShaderPath) {
+
+        // Modules are owned by the caller (ShaderModuleCache) — do not destroy them
+        createGraphicsPipeline(vertModule, fragModule, cache, config);
+    }
+
     void Pipeline::createGraphicsPipeline(VkShaderModule vertShaderModule, VkShaderModule fragShaderModule,
                                            VkPipelineCache cache, const PipelineConfig& config) {
         VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
@@ -134,23 +222,65 @@ namespace vkeng {
         vertShaderStageInfo.module = vertShaderModule;
         vertShaderStageInfo.pName = "main"; // Entry point function
 
+        // Fragment-stage specialization: debug mode, shadow toggle, and the
+        // light-loop bound compile in as constants so the driver folds the
+        // branches instead of every fragment paying for them at runtime.
+        // Shaders that do not declare the constant_ids ignore the entries.
+        const uint32_t specValues[3] = {
+            config.specDebugMode,
+            config.specShadowsEnabled ? 1u : 0u,
+            config.specMaxLights,
+        };
+        const VkSpecializationMapEntry specEntries[3] = {
+            {0, 0 * sizeof(uint32_t), sizeof(uint32_t)},
+            {1, 1 * sizeof(uint32_t), sizeof(uint32_t)},
+            {2, 2 * sizeof(uint32_t), sizeof(uint32_t)},
+        };
+        VkSpecializationInfo specInfo{};
+        specInfo.mapEntryCount = 3;
+        specInfo.pMapEntries = specEntries;
+        specInfo.dataSize = sizeof(specValues);
+        specInfo.pData = specValues;
+
         VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
         fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
         fragShaderStageInfo.module = fragShaderModule;
         fragShaderStageInfo.pName = "main";
+        fragShaderStageInfo.pSpecializationInfo = &specInfo;
 
         VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
         // --- 2. Vertex Input State ---
-        // Describes how vertex data is passed to the vertex shader.
-        auto bindingDescription = Vertex::getBindingDescription();
-        auto attributeDescriptions = Vertex::getAttributeDescriptions();
+        // Describes how vertex data is passed to the vertex shader. The
+        // format selects fat or compact attribute layouts; both feed the
+        // same shaders since quantized formats expand to float at fetch.
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions = {
+            getVertexBindingDescription(config.vertexFormat)
+        };
+        auto attributeDescriptions = getVertexAttributeDescriptions(config.vertexFormat);
+
+        // Instanced variants add the per-instance model matrix stream (binding 1)
+        if (config.instanced) {
+            bindingDescriptions.push_back(InstanceData::getBindingDescription());
+            auto instanceAttributes = InstanceData::getAttributeDescriptions();
+            attributeDescriptions.insert(attributeDescriptions.end(),
+                instanceAttributes.begin(), instanceAttributes.end());
+        }
+
+        // Skinned variants add the per-vertex joint/weight stream instead
+        // (binding 1 again — a draw is never skinned and instanced at once)
+        if (config.skinned) {
+            bindingDescriptions.push_back(SkinVertex::getBindingDescription());
+            auto skinAttributes = SkinVertex::getAttributeDescriptions();
+            attributeDescriptions.insert(attributeDescriptions.end(),
+                skinAttributes.begin(), skinAttributes.end());
+        }
 
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.vertexBindingDescriptionCount = 1;
-        vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+        vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+        vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
         vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
         vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
@@ -213,8 +343,12 @@ namespace vkeng {
 
         // --- 7. Color Blend State ---
         VkPipelineColorBlendAttachmentState colorBlendAttachment{};
-        colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
-                                              VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        // colorWriteEnable=false: attachment stays bound (render pass
+        // compatibility) but nothing is written — used by the depth pre-pass
+        colorBlendAttachment.colorWriteMask = config.colorWriteEnable
+            ? (VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+               VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT)
+            : 0;
 
         if (config.blendMode == BlendMode::AlphaBlend) {
             colorBlendAttachment.blendEnable = VK_TRUE;
@@ -244,7 +378,9 @@ namespace vkeng {
         depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
         depthStencil.depthTestEnable = config.depthTestEnable ? VK_TRUE : VK_FALSE;
         depthStencil.depthWriteEnable = config.depthWriteEnable ? VK_TRUE : VK_FALSE;
-        depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+        // EQUAL relies on the pre-pass using the identical vertex shader and
+        // state so both passes rasterize bit-identical depth values
+        depthStencil.depthCompareOp = config.depthCompareEqual ? VK_COMPARE_OP_EQUAL : VK_COMPARE_OP_LESS;
         depthStencil.depthBoundsTestEnable = VK_FALSE;
         depthStencil.minDepthBounds = 0.0f; // Optional
         depthStencil.maxDepthBounds = 1.0f; // Optional
@@ -286,6 +422,127 @@ namespace vkeng {
         }
     }
 
+    void Pipeline::createMeshShadingPipeline(VkShaderModule taskShaderModule,
+                                              VkShaderModule meshShaderModule,
+                                              VkShaderModule fragShaderModule,
+                                              VkPipelineCache cache, const PipelineConfig& config) {
+        // Task stage is optional: without one the mesh shader is dispatched
+        // directly and no GPU-side cluster culling happens
+        std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
+        if (taskShaderModule != VK_NULL_HANDLE) {
+            VkPipelineShaderStageCreateInfo taskStageInfo{};
+            taskStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            taskStageInfo.stage = VK_SHADER_STAGE_TASK_BIT_EXT;
+            taskStageInfo.module = taskShaderModule;
+            taskStageInfo.pName = "main";
+            shaderStages.push_back(taskStageInfo);
+        }
+
+        VkPipelineShaderStageCreateInfo meshStageInfo{};
+        meshStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        meshStageInfo.stage = VK_SHADER_STAGE_MESH_BIT_EXT;
+        meshStageInfo.module = meshShaderModule;
+        meshStageInfo.pName = "main";
+        shaderStages.push_back(meshStageInfo);
+
+        VkPipelineShaderStageCreateInfo fragStageInfo{};
+        fragStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        fragStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        fragStageInfo.module = fragShaderModule;
+        fragStageInfo.pName = "main";
+        shaderStages.push_back(fragStageInfo);
+
+        VkViewport viewport{};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = (float) extent_.width;
+        viewport.height = (float) extent_.height;
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+
+        VkRect2D scissor{};
+        scissor.offset = {0, 0};
+        scissor.extent = extent_;
+
+        VkPipelineViewportStateCreateInfo viewportState{};
+        viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewportState.viewportCount = 1;
+        viewportState.pViewports = &viewport;
+        viewportState.scissorCount = 1;
+        viewportState.pScissors = &scissor;
+
+        VkPipelineRasterizationStateCreateInfo rasterizer{};
+        rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterizer.depthClampEnable = VK_FALSE;
+        rasterizer.rasterizerDiscardEnable = VK_FALSE;
+        rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterizer.lineWidth = 1.0f;
+        rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        rasterizer.depthBiasEnable = VK_FALSE;
+
+        switch (config.cullMode) {
+            case CullMode::None:  rasterizer.cullMode = VK_CULL_MODE_NONE; break;
+            case CullMode::Back:  rasterizer.cullMode = VK_CULL_MODE_BACK_BIT; break;
+            case CullMode::Front: rasterizer.cullMode = VK_CULL_MODE_FRONT_BIT; break;
+        }
+
+        VkPipelineMultisampleStateCreateInfo multisampling{};
+        multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisampling.sampleShadingEnable = VK_FALSE;
+        multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+        colorBlendAttachment.colorWriteMask =
+            VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+            VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+        colorBlendAttachment.blendEnable = VK_FALSE;
+
+        VkPipelineColorBlendStateCreateInfo colorBlending{};
+        colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        colorBlending.logicOpEnable = VK_FALSE;
+        colorBlending.attachmentCount = 1;
+        colorBlending.pAttachments = &colorBlendAttachment;
+
+        VkPipelineDepthStencilStateCreateInfo depthStencil{};
+        depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        depthStencil.depthTestEnable = config.depthTestEnable ? VK_TRUE : VK_FALSE;
+        depthStencil.depthWriteEnable = config.depthWriteEnable ? VK_TRUE : VK_FALSE;
+        depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
+        depthStencil.depthBoundsTestEnable = VK_FALSE;
+        depthStencil.stencilTestEnable = VK_FALSE;
+
+        std::vector<VkDynamicState> dynamicStates = {
+            VK_DYNAMIC_STATE_VIEWPORT,
+            VK_DYNAMIC_STATE_SCISSOR
+        };
+
+        VkPipelineDynamicStateCreateInfo dynamicState{};
+        dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamicState.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+        dynamicState.pDynamicStates = dynamicStates.data();
+
+        // No vertex input or input assembly: the mesh stage emits vertices
+        // and primitives itself from storage-buffer reads
+        VkGraphicsPipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipelineInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+        pipelineInfo.pStages = shaderStages.data();
+        pipelineInfo.pViewportState = &viewportState;
+        pipelineInfo.pRasterizationState = &rasterizer;
+        pipelineInfo.pMultisampleState = &multisampling;
+        pipelineInfo.pDepthStencilState = &depthStencil;
+        pipelineInfo.pColorBlendState = &colorBlending;
+        pipelineInfo.pDynamicState = &dynamicState;
+        pipelineInfo.layout = layout_;
+        pipelineInfo.renderPass = renderPass_;
+        pipelineInfo.subpass = 0;
+        pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+
+        if (vkCreateGraphicsPipelines(device_, cache, 1, &pipelineInfo, nullptr, &pipeline_) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create mesh-shading pipeline!");
+        }
+    }
+
     /**
      * @brief Destroys the pipeline and its layout.
      */
@@ -341,4 +598,72 @@ namespace vkeng {
 
         return buffer;
     }
+
+    // ============================================================================
+    // ComputePipeline
+    // ============================================================================
+
+    /**
+     * @brief Builds the compute pipeline from a single SPIR-V shader stage.
+     */
+    ComputePipeline::ComputePipeline(VkDevice device,
+                                     VkPipelineLayout pipelineLayout,
+                                     const std::filesystem::path& compPath,
+                                     VkPipelineCache cache,
+                                     const std::vector<std::pair<uint32_t, uint32_t>>& specConstants)
+        : device_(device), layout_(pipelineLayout) {
+        auto compShaderCode = Pipeline::readFile(compPath);
+
+        VkShaderModuleCreateInfo moduleInfo{};
+        moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleInfo.codeSize = compShaderCode.size();
+        moduleInfo.pCode = reinterpret_cast<const uint32_t*>(compShaderCode.data());
+
+        VkShaderModule compModule;
+        if (vkCreateShaderModule(device_, &moduleInfo, nullptr, &compModule) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create compute shader module!");
+        }
+
+        // Bake specialization constants into the build: each (id, value)
+        // pair maps to one 32-bit slot in a tightly packed data block
+        std::vector<VkSpecializationMapEntry> specEntries;
+        std::vector<uint32_t> specData;
+        specEntries.reserve(specConstants.size());
+        specData.reserve(specConstants.size());
+        for (const auto& [constantId, value] : specConstants) {
+            specEntries.push_back(VkSpecializationMapEntry{
+                constantId,
+                static_cast<uint32_t>(specData.size() * sizeof(uint32_t)),
+                sizeof(uint32_t)});
+            specData.push_back(value);
+        }
+        VkSpecializationInfo specInfo{};
+        specInfo.mapEntryCount = static_cast<uint32_t>(specEntries.size());
+        specInfo.pMapEntries = specEntries.data();
+        specInfo.dataSize = specData.size() * sizeof(uint32_t);
+        specInfo.pData = specData.data();
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipelineInfo.stage.module = compModule;
+        pipelineInfo.stage.pName = "main";
+        pipelineInfo.stage.pSpecializationInfo = specEntries.empty() ? nullptr : &specInfo;
+        pipelineInfo.layout = layout_;
+
+        VkResult result = vkCreateComputePipelines(
+            device_, cache, 1, &pipelineInfo, nullptr, &pipeline_);
+        vkDestroyShaderModule(device_, compModule, nullptr);
+
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create compute pipeline: " + compPath.string());
+        }
+    }
+
+    ComputePipeline::~ComputePipeline() noexcept {
+        if (pipeline_ != VK_NULL_HANDLE) {
+            vkDestroyPipeline(device_, pipeline_, nullptr);
+        }
+    }
 } // namespace vkeng
\ No newline at end of file
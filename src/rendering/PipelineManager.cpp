@@ -1,26 +1,72 @@
 #include "vulkan-engine/rendering/PipelineManager.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 
+#include <chrono>
+#include <cstdlib>
 #include <stdexcept>
 
+namespace {
+    /**
+     * @brief GLSL source → SPIR-V output names, mirroring the build system.
+     *
+     * Hot reload watches the sources the build already compiles; keep this
+     * table in sync with the vkeng_compile_shader() calls in CMakeLists.txt.
+     */
+    struct ShaderTableEntry {
+        const char* source;
+        const char* output;
+    };
+
+    constexpr ShaderTableEntry kShaderTable[] = {
+        { "shader.vert",           "vert.spv" },
+        { "shader.frag",           "frag.spv" },
+        { "shader_instanced.vert", "vert_instanced.spv" },
+        { "shadow.vert",           "shadow_vert.spv" },
+        { "shadow_multiview.vert", "shadow_multiview_vert.spv" },
+        { "shadow.frag",           "shadow_frag.spv" },
+        { "depth_pyramid.comp",    "depth_pyramid.spv" },
+        { "occlusion_cull.comp",   "occlusion_cull.spv" },
+        { "light_cluster.comp",    "light_cluster.spv" },
+        { "shader_clustered.frag", "frag_clustered.spv" },
+        { "shader_bindless.frag",  "frag_bindless.spv" },
+        { "depth_prepass.frag",    "depth_prepass.spv" },
+    };
+
+    /// How often the watcher thread polls source modification times
+    constexpr auto kWatchPollInterval = std::chrono::milliseconds(500);
+}
+
 namespace vkeng {
 
     PipelineManager::PipelineManager(VkDevice device,
+                                     VkPhysicalDevice physicalDevice,
                                      VkDescriptorSetLayout uboSetLayout,
                                      VkDescriptorSetLayout textureSetLayout,
-                                     VkDescriptorSetLayout shadowSetLayout)
+                                     VkDescriptorSetLayout shadowSetLayout,
+                                     VkDescriptorSetLayout clusterSetLayout,
+                                     bool bindlessTextures)
         : m_device(device) {
 
-        // Create the shared pipeline layout: set 0 = UBO, set 1 = textures, set 2 = shadow map (optional)
+        // Create the shared pipeline layout: set 0 = UBO, set 1 = textures
+        // (or the bindless array), set 2 = shadow map (optional), set 3 =
+        // clustered lighting (optional). Bindless draws append their
+        // texture indices after the base push constant block.
         VkPushConstantRange pushConstantRange{};
         pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
         pushConstantRange.offset = 0;
-        pushConstantRange.size = sizeof(MeshPushConstants);
+        pushConstantRange.size = sizeof(MeshPushConstants)
+            + (bindlessTextures ? sizeof(BindlessPushConstants) : 0);
 
         std::vector<VkDescriptorSetLayout> setLayouts = { uboSetLayout, textureSetLayout };
         if (shadowSetLayout != VK_NULL_HANDLE) {
             setLayouts.push_back(shadowSetLayout);
         }
+        if (clusterSetLayout != VK_NULL_HANDLE) {
+            if (shadowSetLayout == VK_NULL_HANDLE) {
+                throw std::runtime_error("PipelineManager: clusterSetLayout (set 3) requires shadowSetLayout (set 2)");
+            }
+            setLayouts.push_back(clusterSetLayout);
+        }
 
         VkPipelineLayoutCreateInfo layoutInfo{};
         layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -33,14 +79,23 @@ namespace vkeng {
             throw std::runtime_error("PipelineManager: failed to create pipeline layout");
         }
 
-        // Create the shared pipeline cache (disk-persistent)
-        m_pipelineCache = std::make_unique<PipelineCache>(m_device, "pipeline.cache");
+        // Create the shared pipeline cache (disk-persistent, keyed by device UUID)
+        m_pipelineCache = std::make_unique<PipelineCache>(m_device, physicalDevice, "pipeline.cache");
+
+        // Shader modules are shared across variants and survive pipeline rebuilds
+        m_shaderModules = std::make_unique<ShaderModuleCache>(m_device);
 
         LOG_INFO(RENDERING, "PipelineManager created (layout + cache)");
     }
 
     PipelineManager::~PipelineManager() noexcept {
+        if (m_watchThread.joinable()) {
+            m_watchStop.store(true, std::memory_order_relaxed);
+            m_watchThread.join();
+        }
+        waitForPrewarm();
         m_pipelines.clear();
+        m_shaderModules.reset();
         m_pipelineCache.reset();
 
         if (m_pipelineLayout != VK_NULL_HANDLE) {
@@ -56,17 +111,29 @@ namespace vkeng {
         // main-pass pipelines, so there is no key collision in practice. If a future caller passes
         // the same PipelineConfig with a *different* renderPass, it will receive a stale pipeline.
         // To fix that case, add renderPass to the key (or use a composite key struct).
+        //
+        // The lock covers creation as well as lookup so the prewarm thread and
+        // render thread never compile the same variant twice. Contended compiles
+        // are rare: prewarming runs at startup, before the frame loop is hot.
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
         auto it = m_pipelines.find(config);
         if (it != m_pipelines.end()) {
-            return it->second;
+            return it->second.pipeline;
         }
 
-        // Create new pipeline for this config
+        // Create new pipeline for this config. Shader modules come from the
+        // shared cache, so variants that differ only in fixed-function state
+        // reuse the same VkShaderModules instead of re-reading SPIR-V.
+        VkShaderModule vertModule = m_shaderModules->getModule(config.vertShaderPath);
+        VkShaderModule fragModule = m_shaderModules->getModule(config.fragShaderPath);
+
         auto pipeline = std::make_shared<Pipeline>(
             m_device, renderPass, m_pipelineLayout, extent, config,
+            vertModule, fragModule,
             m_pipelineCache ? m_pipelineCache->get() : VK_NULL_HANDLE);
 
-        m_pipelines[config] = pipeline;
+        m_pipelines[config] = PipelineEntry{ pipeline, renderPass, extent };
 
         LOG_INFO(RENDERING, "PipelineManager: created pipeline variant (blend={}, cull={}, depthWrite={})",
                  static_cast<int>(config.blendMode),
@@ -76,9 +143,188 @@ namespace vkeng {
         return pipeline;
     }
 
+    std::shared_ptr<ComputePipeline> PipelineManager::getComputePipeline(
+        const std::filesystem::path& compShaderPath,
+        VkPipelineLayout layout) {
+        // Unspecialized convenience form
+        return getComputePipeline(ComputePipelineConfig{ compShaderPath, layout, {} });
+    }
+
+    std::shared_ptr<ComputePipeline> PipelineManager::getComputePipeline(
+        const ComputePipelineConfig& config) {
+
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
+        ComputeKey key{ config.compShaderPath.string(), config.layout, config.specConstants };
+        auto it = m_computePipelines.find(key);
+        if (it != m_computePipelines.end()) {
+            return it->second;
+        }
+
+        auto pipeline = std::make_shared<ComputePipeline>(
+            m_device, config.layout, config.compShaderPath,
+            m_pipelineCache ? m_pipelineCache->get() : VK_NULL_HANDLE,
+            config.specConstants);
+
+        m_computePipelines[key] = pipeline;
+
+        LOG_INFO(RENDERING, "PipelineManager: created compute pipeline '{}' ({} specialization constants)",
+                 config.compShaderPath.string(), config.specConstants.size());
+
+        return pipeline;
+    }
+
     void PipelineManager::invalidateAll() {
+        waitForPrewarm();
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
         m_pipelines.clear();
         LOG_DEBUG(RENDERING, "PipelineManager: all pipeline variants invalidated");
     }
 
+    void PipelineManager::prewarmAsync(std::vector<PipelineConfig> configs,
+                                       VkRenderPass renderPass,
+                                       VkExtent2D extent) {
+        waitForPrewarm(); // Only one prewarm pass at a time
+
+        m_prewarmThread = std::thread([this, configs = std::move(configs), renderPass, extent]() {
+            for (const auto& config : configs) {
+                getPipeline(config, renderPass, extent);
+            }
+            LOG_INFO(RENDERING, "PipelineManager: prewarmed {} pipeline variants", configs.size());
+        });
+    }
+
+    void PipelineManager::waitForPrewarm() {
+        if (m_prewarmThread.joinable()) {
+            m_prewarmThread.join();
+        }
+    }
+
+    void PipelineManager::enableHotReload(const std::filesystem::path& sourceDir,
+                                          const std::filesystem::path& outputDir) {
+        if (m_watchThread.joinable()) {
+            LOG_WARN(RENDERING, "PipelineManager: hot reload already enabled");
+            return;
+        }
+
+        // The compiler runs on the watcher thread via std::system
+        if (std::system("glslc --version > /dev/null 2>&1") != 0) {
+            LOG_WARN(RENDERING, "PipelineManager: glslc not found on PATH; shader hot reload disabled");
+            return;
+        }
+
+        std::error_code ec;
+        for (const auto& entry : kShaderTable) {
+            WatchedShader watched;
+            watched.source = sourceDir / entry.source;
+            watched.output = outputDir / entry.output;
+            watched.lastWrite = std::filesystem::last_write_time(watched.source, ec);
+            if (ec) {
+                // Source not present (e.g. a deployed build shipping only
+                // SPIR-V) — nothing to watch for this shader
+                continue;
+            }
+            m_watchedShaders.push_back(std::move(watched));
+        }
+
+        if (m_watchedShaders.empty()) {
+            LOG_WARN(RENDERING, "PipelineManager: no shader sources found under {}; hot reload disabled",
+                     sourceDir.string());
+            return;
+        }
+
+        m_watchStop.store(false, std::memory_order_relaxed);
+        m_watchThread = std::thread([this]() { watchShaderSources(); });
+
+        LOG_INFO(RENDERING, "PipelineManager: shader hot reload enabled ({} sources watched)",
+                 m_watchedShaders.size());
+    }
+
+    void PipelineManager::watchShaderSources() {
+        while (!m_watchStop.load(std::memory_order_relaxed)) {
+            std::this_thread::sleep_for(kWatchPollInterval);
+
+            for (auto& watched : m_watchedShaders) {
+                std::error_code ec;
+                auto writeTime = std::filesystem::last_write_time(watched.source, ec);
+                if (ec || writeTime == watched.lastWrite) {
+                    continue;
+                }
+                watched.lastWrite = writeTime;
+
+                // Compile here, off the frame loop; only queue on success so
+                // a shader with errors keeps the last good pipeline running
+                std::string command = "glslc \"" + watched.source.string() +
+                                      "\" -o \"" + watched.output.string() + "\"";
+                if (std::system(command.c_str()) != 0) {
+                    LOG_ERROR(RENDERING, "Shader hot reload: compilation failed for {} (keeping previous pipeline)",
+                              watched.source.string());
+                    continue;
+                }
+
+                LOG_INFO(RENDERING, "Shader hot reload: recompiled {}", watched.source.filename().string());
+                std::lock_guard<std::mutex> lock(m_reloadMutex);
+                m_dirtyOutputs.insert(watched.output.string());
+            }
+        }
+    }
+
+    bool PipelineManager::pumpShaderReloads() {
+        // Fast path: nothing recompiled since last frame
+        std::unordered_set<std::string> dirty;
+        {
+            std::lock_guard<std::mutex> lock(m_reloadMutex);
+            if (m_dirtyOutputs.empty()) {
+                return false;
+            }
+            dirty.swap(m_dirtyOutputs);
+        }
+
+        // Old pipelines may still be referenced by in-flight command buffers,
+        // so drain the GPU before the module cache destroys their shaders
+        vkDeviceWaitIdle(m_device);
+
+        for (const auto& path : dirty) {
+            m_shaderModules->invalidate(path);
+        }
+
+        std::lock_guard<std::mutex> lock(m_pipelinesMutex);
+
+        uint32_t rebuilt = 0;
+        for (auto& [config, entry] : m_pipelines) {
+            if (dirty.count(config.vertShaderPath.string()) == 0 &&
+                dirty.count(config.fragShaderPath.string()) == 0) {
+                continue;
+            }
+
+            // getModule() re-reads the invalidated file; content-hash check
+            // inside the cache keeps the module if the SPIR-V didn't change
+            VkShaderModule vertModule = m_shaderModules->getModule(config.vertShaderPath);
+            VkShaderModule fragModule = m_shaderModules->getModule(config.fragShaderPath);
+
+            entry.pipeline = std::make_shared<Pipeline>(
+                m_device, entry.renderPass, m_pipelineLayout, entry.extent, config,
+                vertModule, fragModule,
+                m_pipelineCache ? m_pipelineCache->get() : VK_NULL_HANDLE);
+            rebuilt++;
+        }
+
+        // Compute pipelines read their own SPIR-V, so a rebuild is just
+        // re-running the constructor against the same layout
+        for (auto& [key, pipeline] : m_computePipelines) {
+            if (dirty.count(key.path) == 0) {
+                continue;
+            }
+            pipeline = std::make_shared<ComputePipeline>(
+                m_device, key.layout, key.path,
+                m_pipelineCache ? m_pipelineCache->get() : VK_NULL_HANDLE,
+                key.specConstants);
+            rebuilt++;
+        }
+
+        LOG_INFO(RENDERING, "Shader hot reload: rebuilt {} pipeline variants from {} changed shaders",
+                 rebuilt, dirty.size());
+        return rebuilt > 0;
+    }
+
 } // namespace vkeng
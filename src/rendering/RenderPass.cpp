@@ -14,9 +14,11 @@ namespace vkeng {
      * and one subpass. It defines how the framebuffer attachments are used during rendering.
      * @param device The logical device.
      * @param colorFormat The format of the color attachment (e.g., the swap chain's format).
+     * @param colorFinalLayout Layout the color attachment ends the pass in.
      */
-    RenderPass::RenderPass(VkDevice device, VkFormat colorFormat, VkFormat depthFormat) 
-        : device_(device) {
+    RenderPass::RenderPass(VkDevice device, VkFormat colorFormat, VkFormat depthFormat,
+                           VkImageLayout colorFinalLayout)
+        : device_(device), colorFormat_(colorFormat), depthFormat_(depthFormat) {
         
         // 1. Define the color attachment.
         VkAttachmentDescription colorAttachment{};
@@ -27,7 +29,7 @@ namespace vkeng {
         colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
         colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;      // We don't care about the previous layout.
-        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR; // Transition to presentable layout at the end.
+        colorAttachment.finalLayout = colorFinalLayout; // Presentable (or blittable) layout at the end.
 
         VkAttachmentDescription depthAttachment{};
         depthAttachment.format = depthFormat;
@@ -67,6 +69,23 @@ namespace vkeng {
         dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
         dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
 
+        std::vector<VkSubpassDependency> dependencies = {dependency};
+
+        // When the pass ends in TRANSFER_SRC the implicit final-layout
+        // transition must also be made visible to the blit that follows;
+        // the PRESENT_SRC variant gets that ordering from the present
+        // semaphore instead.
+        if (colorFinalLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) {
+            VkSubpassDependency blitDependency{};
+            blitDependency.srcSubpass = 0;
+            blitDependency.dstSubpass = VK_SUBPASS_EXTERNAL;
+            blitDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            blitDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            blitDependency.dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            blitDependency.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            dependencies.push_back(blitDependency);
+        }
+
         // 5. Create the render pass.
         VkRenderPassCreateInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
@@ -75,8 +94,8 @@ namespace vkeng {
         renderPassInfo.pAttachments = attachments.data();
         renderPassInfo.subpassCount = 1;
         renderPassInfo.pSubpasses = &subpass;
-        renderPassInfo.dependencyCount = 1;
-        renderPassInfo.pDependencies = &dependency;
+        renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+        renderPassInfo.pDependencies = dependencies.data();
 
         if (vkCreateRenderPass(device_, &renderPassInfo, nullptr, &renderPass_) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create render pass!");
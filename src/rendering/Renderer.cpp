@@ -8,15 +8,26 @@
  */
 
 #include "vulkan-engine/rendering/Renderer.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+#include "vulkan-engine/core/Tunables.hpp"
 #include "vulkan-engine/scene/SceneNode.hpp"
+#include "vulkan-engine/components/ComponentPool.hpp"
 #include "vulkan-engine/components/MeshRenderer.hpp"
 #include "vulkan-engine/components/Light.hpp"
+#include "vulkan-engine/rendering/BindlessTextures.hpp"
 #include "vulkan-engine/rendering/Camera.hpp"
 #include "vulkan-engine/resources/Mesh.hpp"
+#include "vulkan-engine/resources/MeshBufferPool.hpp"
+#include "vulkan-engine/resources/MeshResidency.hpp"
 #include "vulkan-engine/resources/Material.hpp"
 #include "vulkan-engine/rendering/Uniforms.hpp"
 #include "vulkan-engine/core/Buffer.hpp"
+#include "vulkan-engine/core/DeletionQueue.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/MemoryManager.hpp"
+#include "vulkan-engine/math/SimdMath.hpp"
 #include "vulkan-engine/rendering/CommandPool.hpp"
+#include "vulkan-engine/rendering/Vertex.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 #include <glm/geometric.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -24,9 +35,30 @@
 #include <stdexcept>
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 namespace vkeng {
 
+namespace {
+    /// Cap on waiting for the previous present to reach the display; a
+    /// display that stalls longer than this should not wedge the frame loop
+    constexpr uint64_t PRESENT_WAIT_TIMEOUT_NS = 100'000'000; // 100 ms
+
+    /// Dynamic resolution controller tuning. The step is small and the hold
+    /// long so the scale creeps rather than flickers; the EMA weight keeps
+    /// one hitchy frame from dropping resolution on its own.
+    constexpr float RENDER_SCALE_STEP = 0.05f;
+    constexpr uint32_t RENDER_SCALE_HOLD_FRAMES = 30;
+    constexpr float GPU_MS_EMA_WEIGHT = 0.1f;
+    /// Scale back up only when comfortably under budget, not at the exact
+    /// target — the gap between the two thresholds is the hysteresis band
+    constexpr float SCALE_UP_HEADROOM = 0.85f;
+}
+
 // ============================================================================
 // Constructor and Destructor
 // ============================================================================
@@ -45,6 +77,10 @@ Renderer::Renderer(IWindow* window, VulkanDevice& device, VulkanSwapChain& swapC
     createCommandBuffers();  // Command buffers for multi-frame rendering
     createSyncObjects();     // Synchronization primitives for frame coordination
 
+    // Per-pass GPU timing (no-op on devices without timestamp support)
+    GpuProfiler::get().initialize(m_device.getDevice(), m_device.getPhysicalDevice(),
+                                  MAX_FRAMES_IN_FLIGHT);
+
     // Initialize size tracking for polling-based resize detection (WSL2 workaround)
     m_window->getFramebufferSize(m_lastKnownWidth, m_lastKnownHeight);
     LOG_INFO(VULKAN, "Initial window size: {}x{}", m_lastKnownWidth, m_lastKnownHeight);
@@ -55,6 +91,18 @@ Renderer::Renderer(IWindow* window, VulkanDevice& device, VulkanSwapChain& swapC
         m_lastResizeTime = std::chrono::steady_clock::now();
         LOG_INFO(VULKAN, "Window resize callback: {}x{}", width, height);
     });
+
+    // Live tunables: the toggles perf A/B runs flip most often. Applied at
+    // the frame boundary, before buildFramePacket reads them.
+    Tunables::get().registerBool("renderer.culling", m_cullingEnabled,
+        [this](bool enabled) { m_cullingEnabled = enabled; },
+        "CPU frustum culling");
+    Tunables::get().registerBool("renderer.drawSorting", m_drawSortingEnabled,
+        [this](bool enabled) { m_drawSortingEnabled = enabled; },
+        "Per-frame draw sort (state grouping, front-to-back opaques)");
+    Tunables::get().registerFloat("renderer.lodBias", MeshRenderer::getLodBias(), 0.25f, 4.0f,
+        [](float bias) { MeshRenderer::setLodBias(bias); },
+        "LOD switch-threshold multiplier (>1 = coarser sooner)");
 }
 
 /**
@@ -64,13 +112,20 @@ Renderer::Renderer(IWindow* window, VulkanDevice& device, VulkanSwapChain& swapC
  * Command pool cleanup is handled automatically by the unique_ptr.
  */
 Renderer::~Renderer() {
+    Tunables::get().unregister("renderer.culling");
+    Tunables::get().unregister("renderer.drawSorting");
+    Tunables::get().unregister("renderer.lodBias");
+    GpuProfiler::get().shutdown();
     for (auto framebuffer : m_swapChainFramebuffers) {
         vkDestroyFramebuffer(m_device.getDevice(), framebuffer, nullptr);
     }
+    destroyScaledTargets();
     for (auto& frame : m_frames) {
         vkDestroySemaphore(m_device.getDevice(), frame.imageAvailableSemaphore, nullptr);
         vkDestroySemaphore(m_device.getDevice(), frame.renderFinishedSemaphore, nullptr);
-        vkDestroyFence(m_device.getDevice(), frame.inFlightFence, nullptr);
+        if (frame.inFlightFence != VK_NULL_HANDLE) {
+            vkDestroyFence(m_device.getDevice(), frame.inFlightFence, nullptr);
+        }
     }
 }
 
@@ -93,17 +148,36 @@ Renderer::~Renderer() {
  * @param rootNode Root of the scene graph hierarchy to render
  * @param camera Camera providing view and projection matrices
  * @param descriptorSets Per-frame descriptor sets for shader resources
- * @param uniformBuffers Per-frame uniform buffers for shader constants
+ * @param globalUbo Persistently-mapped per-frame uniform buffer for shader constants
  */
 void Renderer::drawFrame(SceneNode& rootNode, Camera& camera,
                          const std::vector<VkDescriptorSet>& descriptorSets,
-                         const std::vector<std::shared_ptr<Buffer>>& uniformBuffers) {
+                         const PerFrameUniformBuffer& globalUbo) {
+    PROFILE_SCOPE("Renderer::drawFrame");
+
+    // Single-threaded path: build and submit back to back. Apps running a
+    // render thread call the two phases themselves (see FramePacket).
+    const FramePacket* packet = buildFramePacket(rootNode, camera, descriptorSets, globalUbo);
+    if (packet) {
+        submitFramePacket(*packet);
+    }
+}
+
+const Renderer::FramePacket* Renderer::buildFramePacket(
+        SceneNode& rootNode, Camera& camera,
+        const std::vector<VkDescriptorSet>& descriptorSets,
+        const PerFrameUniformBuffer& globalUbo) {
+    PROFILE_SCOPE("Renderer::buildFramePacket");
+
+    // Batch-recompute every world transform edited since last frame, so
+    // the collection below (and any later consumer) reads pure caches
+    SceneNode::flushDirtyTransforms();
 
     // Check for resize by polling (WSL2/WSLg workaround - callbacks may not fire)
     int currentWidth, currentHeight;
     m_window->getFramebufferSize(currentWidth, currentHeight);
     if (currentWidth != m_lastKnownWidth || currentHeight != m_lastKnownHeight) {
-        LOG_INFO(VULKAN, "Window size changed (polled): {}x{} -> {}x{}", 
+        LOG_INFO(VULKAN, "Window size changed (polled): {}x{} -> {}x{}",
                  m_lastKnownWidth, m_lastKnownHeight, currentWidth, currentHeight);
         m_lastKnownWidth = currentWidth;
         m_lastKnownHeight = currentHeight;
@@ -114,36 +188,229 @@ void Renderer::drawFrame(SceneNode& rootNode, Camera& camera,
     // (If we acquire then return early, the semaphore stays signaled causing validation errors)
     if (m_framebufferResized) {
         LOG_INFO(VULKAN, "Framebuffer resize detected, recreating swapchain...");
+        // A render thread may still be recording the previous packet;
+        // recreation tears down state it reads, so drain it first
+        if (m_recreateSyncCallback) {
+            m_recreateSyncCallback();
+        }
         m_framebufferResized = false;
         recreateSwapChain(camera);
-        return;
+        return nullptr;
     }
 
-    // 1. Get the command buffer and sync objects for the CURRENT FRAME IN FLIGHT.
+    // Wait for this slot's previous GPU work before touching its per-frame
+    // buffers (UBO, instance and indirect uploads below write slot memory).
+    // Timeline path waits on the exact value the slot's last submit
+    // signaled (0 = never submitted); fence path is the fallback.
     FrameData& frame = m_frames[m_currentFrame];
-    vkWaitForFences(m_device.getDevice(), 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+    if (m_frameTimeline) {
+        if (frame.timelineValue != 0) {
+            m_frameTimeline->wait(frame.timelineValue);
+        }
+    } else {
+        vkWaitForFences(m_device.getDevice(), 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+    }
+
+    // This frame slot's previous work is done on the GPU, so destruction
+    // deferred a full frames-in-flight ago is now safe to execute. (With a
+    // render thread the engine sizes the queue one frame deeper, covering
+    // the packet still being recorded.)
+    DeletionQueue::get().retire();
+
+    // Re-create the arena-backed per-frame containers; the engine rewound
+    // the arena at frame start, so clearing alone would leave them pointing
+    // at reclaimed memory
+    resetFrameContainers();
+
+    // Late-latch hook: let the app apply the freshest input to the camera
+    // before anything below derives state from it (shadow cascades, global
+    // UBO, culling) — cuts up to a frame of input-to-view latency
+    if (m_lateLatchCallback) {
+        m_lateLatchCallback();
+    }
+
+    // Step the dynamic resolution scale before anything derives state from
+    // the render extent (cluster binning below maps fragments by it)
+    if (m_dynamicResolution) {
+        updateRenderScale();
+    }
+    m_buildPacket->renderExtent = m_dynamicResolution ? scaledExtent() : m_swapChain.extent();
+
+    // Collect lights from the scene graph (before UBO upload)
+    collectLights(rootNode, m_collectedLights);
+
+    // Fit shadow cascades to the camera frustum and first directional light.
+    // A renderer sharing another's shadow map copies that renderer's fitted
+    // cascades instead, so its draws sample with the matrices the map was
+    // actually rendered with.
+    if (m_shadowSource) {
+        m_buildPacket->cascades = m_shadowSource->m_renderPacket->cascades;
+    } else {
+        computeShadowCascades(rootNode, camera);
+    }
+
+    // Use m_currentFrame (not imageIndex) for per-frame resources.
+    updateGlobalUbo(m_currentFrame, camera, globalUbo);
+
+    // Upload lights and froxel params for the cluster binning pass
+    if (m_clusteredLighting) {
+        float nearPlane = 0.1f;
+        float farPlane = 1000.0f;
+        if (camera.getType() == CameraType::Perspective) {
+            auto& perspectiveCamera = static_cast<PerspectiveCamera&>(camera);
+            nearPlane = perspectiveCamera.getNearPlane();
+            farPlane = perspectiveCamera.getFarPlane();
+        }
+        m_clusteredLighting->prepare(m_currentFrame,
+            m_collectedLights.data(), static_cast<uint32_t>(m_collectedLights.size()),
+            camera.getViewMatrix(), camera.getProjectionMatrix(),
+            nearPlane, farPlane, m_buildPacket->renderExtent);
+    }
+
+    // Upload CPU-simulated particle instances for this frame in flight
+    if (m_particleSystem) {
+        m_particleSystem->prepare(m_currentFrame);
+    }
+
+    // Upload evaluated joint palettes for this frame in flight
+    if (m_animationSystem) {
+        m_animationSystem->prepare(m_currentFrame,
+            camera.getProjectionMatrix() * camera.getViewMatrix(),
+            camera.getPosition());
+    }
+
+    // Snapshot the camera's cached frustum planes once per frame: culling
+    // below reads m_frustum, and the packet copy lets record-phase (or any
+    // other) consumers use the exact planes this frame was built with
+    m_frustum = camera.getFrustum();
+    m_buildPacket->frustum = m_frustum;
+    m_buildPacket->drawnCount = 0;
+    m_buildPacket->culledCount = 0;
+
+    // Retained draw list: rebuilt only when the scene structure version
+    // moved (node/component add/remove, mesh/material swaps); per-frame
+    // collection is a flat emit loop over the cached sources
+    if (!m_retainedValid || m_retainedVersion != SceneNode::getStructureVersion()) {
+        rebuildRetainedDraws(rootNode);
+    }
+    collectRetainedDraws(camera.getPosition());
+
+    // Meshlet path: opaque draws whose meshes carry import-time meshlets
+    // leave the classic stream entirely (no pre-pass, instancing, or
+    // indirect routing) and record through the mesh-shading pipeline
+    // instead. Parallel-recorded frames keep everything classic — the
+    // meshlet draws record inline, not through the secondary buffers.
+    if (m_meshletRenderer && !m_parallelRecordingEnabled) {
+        m_meshletRenderer->prepare(m_currentFrame,
+            camera.getProjectionMatrix() * camera.getViewMatrix(),
+            m_frustum, camera.getPosition());
+
+        auto& opaque = m_buildPacket->opaqueDrawCalls;
+        size_t kept = 0;
+        for (size_t i = 0; i < opaque.size(); i++) {
+            if (m_meshletRenderer->ensureMeshData(opaque[i].mesh)) {
+                m_buildPacket->meshletDraws.push_back(
+                    {opaque[i].mesh, opaque[i].pushConstants.modelMatrix});
+            } else {
+                opaque[kept++] = opaque[i];
+            }
+        }
+        opaque.resize(kept);
+    }
+
+    // Sort by packed keys: groups state changes, orders opaque front-to-back
+    // and transparent back-to-front. Also improves instance batch locality.
+    sortDrawCalls();
+
+    // Fold repeated (mesh, material) opaque draws into instanced batches
+    m_buildPacket->occlusionActiveThisFrame = false;
+    if (m_instancingEnabled) {
+        buildInstanceBatches();
+        // The depth pyramid samples by full-extent NDC, so it is only
+        // trustworthy while dynamic resolution renders at native size
+        bool pyramidValid = !m_dynamicResolution || m_renderScale >= 1.0f;
+        if (m_occlusionCuller && pyramidValid && !m_buildPacket->instanceBatches.empty()) {
+            // GPU path: the cull shader compacts instances into the indirect
+            // command and transform buffers; the CPU instance upload is skipped
+            m_buildPacket->occlusionActiveThisFrame = true;
+            prepareOcclusionCulling(camera);
+        } else {
+            uploadInstanceData(m_currentFrame);
+        }
+    }
+    m_buildPacket->instancedBatchCount =
+        static_cast<uint32_t>(m_buildPacket->instanceBatches.size());
+
+    // Pack the remaining singles into the mapped indirect buffers (no-op
+    // unless enabled); when active the main pass records one
+    // vkCmdDrawIndexedIndirect per bucket instead of per-draw commands
+    prepareIndirectDraws(m_currentFrame, descriptorSets[m_currentFrame]);
+
+    // Seal the packet and hand it to the record phase: from here on the
+    // scene graph and camera are no longer needed, so the caller may start
+    // the next update while this packet is recorded and submitted
+    m_buildPacket->frameIndex = m_currentFrame;
+    m_buildPacket->globalSet = descriptorSets[m_currentFrame];
+
+    const FramePacket* built = m_buildPacket;
+    m_renderPacket = built;
+    m_buildPacket = (built == &m_packetStorage[0]) ? &m_packetStorage[1] : &m_packetStorage[0];
+    m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    return built;
+}
+
+void Renderer::submitFramePacket(const FramePacket& packet) {
+    PROFILE_SCOPE("Renderer::submitFramePacket");
+
+    // Swap in pipelines for any shaders the hot-reload watcher recompiled.
+    // Done on the record side so the whole frame uses the new variants and
+    // the cache is never mutated while draws bind from it.
+    m_pipelineManager.pumpShaderReloads();
 
-    // 2. Acquire an available image from the swap chain.
+    FrameData& frame = m_frames[packet.frameIndex];
+
+    // 1. Acquire an available image from the swap chain (emulated in
+    //    headless mode, where the images are offscreen render targets).
+    //    Usually the acquire-ahead after the previous present already did
+    //    this, so recording starts immediately; otherwise the blocked time
+    //    is measured so the overlay shows where the frame actually waits.
     uint32_t imageIndex;
-    VkResult result = vkAcquireNextImageKHR(m_device.getDevice(), m_swapChain.swapChain(), UINT64_MAX,
-                                        frame.imageAvailableSemaphore, VK_NULL_HANDLE, &imageIndex);
+    VkResult result;
+    if (m_hasPreAcquiredImage && m_preAcquiredSlot == packet.frameIndex) {
+        imageIndex = m_preAcquiredImage;
+        m_hasPreAcquiredImage = false;
+        result = VK_SUCCESS;
+        m_lastAcquireWaitMs = 0.0f;
+    } else {
+        m_hasPreAcquiredImage = false;
+        const auto acquireStart = std::chrono::steady_clock::now();
+        result = m_swapChain.acquireNextImage(m_device.getGraphicsQueue(),
+                                              frame.imageAvailableSemaphore, imageIndex);
+        m_lastAcquireWaitMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - acquireStart).count();
+    }
 
-    // Handle swapchain out of date (semaphore is NOT signaled in this case per Vulkan spec)
+    // Handle swapchain out of date (semaphore is NOT signaled in this case
+    // per Vulkan spec). Recreation happens on the update thread at the next
+    // buildFramePacket(); this frame is dropped.
     if (result == VK_ERROR_OUT_OF_DATE_KHR) {
-        LOG_INFO(VULKAN, "Swapchain out of date on acquire, recreating...");
-        recreateSwapChain(camera);
+        LOG_INFO(VULKAN, "Swapchain out of date on acquire, deferring recreation...");
+        m_framebufferResized = true;
         return;
     } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
         throw std::runtime_error("failed to acquire swap chain image!");
     }
 
-    // 3. Record commands into the command buffer for the CURRENT FRAME IN FLIGHT,
-    //    telling it to draw to the acquired SWAPCHAIN IMAGE.
-    vkResetFences(m_device.getDevice(), 1, &frame.inFlightFence);
+    // 2. Record commands into the packet slot's command buffer, telling it
+    //    to draw to the acquired SWAPCHAIN IMAGE. The fence was left
+    //    signaled by the build phase's wait; reset it now that we submit.
+    if (!m_frameTimeline) {
+        vkResetFences(m_device.getDevice(), 1, &frame.inFlightFence);
+    }
     vkResetCommandBuffer(frame.commandBuffer, 0);
-    recordCommandBuffer(frame.commandBuffer, imageIndex, rootNode, camera, descriptorSets, uniformBuffers);
+    recordCommandBuffer(frame.commandBuffer, imageIndex, packet);
 
-    // 4. Submit the command buffer for the CURRENT FRAME IN FLIGHT.
+    // 3. Submit the command buffer for the packet's FRAME IN FLIGHT.
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     VkSemaphore waitSemaphores[] = {frame.imageAvailableSemaphore};
@@ -153,30 +420,56 @@ void Renderer::drawFrame(SceneNode& rootNode, Camera& camera,
     submitInfo.pWaitDstStageMask = waitStages;
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &frame.commandBuffer;
-    VkSemaphore signalSemaphores[] = {frame.renderFinishedSemaphore};
+    // Signal the binary present semaphore plus, on the timeline path, this
+    // frame's reserved timeline value (the value entry for the binary
+    // semaphore is ignored per spec).
+    VkSemaphore signalSemaphores[2] = {frame.renderFinishedSemaphore, VK_NULL_HANDLE};
+    uint64_t signalValues[2] = {0, 0};
+    uint64_t waitValues[1] = {0};
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    VkFence submitFence = frame.inFlightFence;
     submitInfo.signalSemaphoreCount = 1;
     submitInfo.pSignalSemaphores = signalSemaphores;
+    if (m_frameTimeline) {
+        frame.timelineValue = m_frameTimeline->reserveValue();
+        signalSemaphores[1] = m_frameTimeline->getHandle();
+        signalValues[1] = frame.timelineValue;
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.waitSemaphoreValueCount = 1;
+        timelineInfo.pWaitSemaphoreValues = waitValues;
+        timelineInfo.signalSemaphoreValueCount = 2;
+        timelineInfo.pSignalSemaphoreValues = signalValues;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 2;
+        submitFence = VK_NULL_HANDLE;
+    }
 
-    if (vkQueueSubmit(m_device.getGraphicsQueue(), 1, &submitInfo, frame.inFlightFence) != VK_SUCCESS) {
+    if (vkQueueSubmit(m_device.getGraphicsQueue(), 1, &submitInfo, submitFence) != VK_SUCCESS) {
         throw std::runtime_error("failed to submit draw command buffer!");
     }
 
-    // 5. Present the SWAPCHAIN IMAGE.
-    VkPresentInfoKHR presentInfo{};
-    presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-    presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = signalSemaphores;
-    VkSwapchainKHR swapChains[] = {m_swapChain.swapChain()};
-    presentInfo.swapchainCount = 1;
-    presentInfo.pSwapchains = swapChains;
-    presentInfo.pImageIndices = &imageIndex;
+    // 4. Present the SWAPCHAIN IMAGE (no-op wait in headless mode).
+    //    On capture frames an extra copy submission slots in between: it
+    //    waits the render-finished semaphore, copies the image to a
+    //    readback buffer, and present waits its semaphore instead.
+    VkSemaphore presentWait = frame.renderFinishedSemaphore;
+    if (m_screenshotCapture && m_screenshotCapture->wantsFrame()) {
+        VkSemaphore copyDone = m_screenshotCapture->recordCopy(
+            m_swapChain.images()[imageIndex], m_swapChain.extent(),
+            m_swapChain.imageFormat(), frame.renderFinishedSemaphore);
+        if (copyDone != VK_NULL_HANDLE) {
+            presentWait = copyDone;
+        }
+    }
+    const auto presentStart = std::chrono::steady_clock::now();
+    result = m_swapChain.present(m_device.getGraphicsQueue(),
+                                 presentWait, imageIndex);
 
-    result = vkQueuePresentKHR(m_device.getGraphicsQueue(), &presentInfo);
-    
-    // Handle present errors - OUT_OF_DATE requires recreation, SUBOPTIMAL can continue
+    // Handle present errors - OUT_OF_DATE requires recreation (done on the
+    // update thread at the next buildFramePacket), SUBOPTIMAL can continue
     if (result == VK_ERROR_OUT_OF_DATE_KHR) {
-        LOG_INFO(VULKAN, "Swapchain out of date on present, recreating...");
-        recreateSwapChain(camera);
+        LOG_INFO(VULKAN, "Swapchain out of date on present, deferring recreation...");
+        m_framebufferResized = true;
     } else if (result == VK_SUBOPTIMAL_KHR) {
         // Suboptimal is OK - we can continue rendering but should recreate soon
         LOG_DEBUG(VULKAN, "Swapchain suboptimal, will recreate on next resize");
@@ -186,57 +479,141 @@ void Renderer::drawFrame(SceneNode& rootNode, Camera& camera,
         throw std::runtime_error("failed to present swap chain image!");
     }
 
-    // 6. Advance to the next FRAME IN FLIGHT.
-    m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
-}
-
-void Renderer::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex, SceneNode& rootNode, Camera& camera,
-                                 const std::vector<VkDescriptorSet>& descriptorSets,
-                                 const std::vector<std::shared_ptr<Buffer>>& uniformBuffers) {
-    // Collect lights from the scene graph (before UBO upload)
-    m_collectedLights.clear();
-    collectLights(rootNode, m_collectedLights);
-
-    // Compute light-space matrix from first directional light
-    m_lightSpaceMatrix = computeLightSpaceMatrix(rootNode);
-
-    // Use m_currentFrame (not imageIndex) for per-frame resources.
-    updateGlobalUbo(m_currentFrame, camera, uniformBuffers);
+    // 5. Pipelined acquisition: with this frame's present queued, grab the
+    //    image the NEXT frame will render into right away. Any FIFO
+    //    backpressure is paid here at the tail — overlapping the update
+    //    thread's build of the next packet — instead of at the top of the
+    //    next frame, and the next submitFramePacket() starts recording
+    //    without touching vkAcquireNextImageKHR.
+    if (result == VK_SUCCESS && !m_framebufferResized) {
+        const uint32_t nextSlot = (packet.frameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+        uint32_t nextImage = 0;
+        const VkResult aheadResult = m_swapChain.acquireNextImage(
+            m_device.getGraphicsQueue(), m_frames[nextSlot].imageAvailableSemaphore, nextImage);
+        if (aheadResult == VK_SUCCESS || aheadResult == VK_SUBOPTIMAL_KHR) {
+            m_preAcquiredImage = nextImage;
+            m_preAcquiredSlot = nextSlot;
+            m_hasPreAcquiredImage = true;
+        } else if (aheadResult == VK_ERROR_OUT_OF_DATE_KHR) {
+            // Semaphore not signaled per spec — nothing to drain
+            m_framebufferResized = true;
+        } else {
+            throw std::runtime_error("failed to acquire swap chain image!");
+        }
+    }
 
-    // Extract frustum planes once per frame for culling during scene traversal
-    m_frustum = camera.getFrustum();
-    m_drawnCount = 0;
-    m_culledCount = 0;
-
-    // Collect draw calls from scene graph (deferred rendering)
-    m_opaqueDrawCalls.clear();
-    m_transparentDrawCalls.clear();
-    collectDrawCalls(rootNode, camera.getPosition());
-
-    // Sort transparent draw calls back-to-front
-    std::sort(m_transparentDrawCalls.begin(), m_transparentDrawCalls.end(),
-        [](const DrawCall& a, const DrawCall& b) {
-            return a.distanceToCamera > b.distanceToCamera;
-        });
+    // 6. Present-wait feedback: block until the PREVIOUS present actually
+    //    reached the display. This bounds how far the pipeline runs ahead
+    //    of the screen (at most one queued present) and makes display
+    //    backpressure measurable instead of hiding inside acquire. Without
+    //    VK_KHR_present_wait the timer still covers the present call above.
+    if (m_swapChain.presentWaitEnabled() && m_prevPresentId != 0) {
+        m_swapChain.waitForPresent(m_prevPresentId, PRESENT_WAIT_TIMEOUT_NS);
+    }
+    m_prevPresentId = m_swapChain.lastPresentId();
+    m_lastPresentWaitMs = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - presentStart).count();
+
+    // 7. Destroy swapchains retired by a recent recreation once enough
+    //    frames have cycled that their images cannot be in flight anymore.
+    if (m_retiredSwapchainFrames > 0 && --m_retiredSwapchainFrames == 0) {
+        m_swapChain.destroyRetired();
+    }
+}
 
+void Renderer::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex,
+                                   const FramePacket& packet) {
     VkCommandBufferBeginInfo beginInfo{};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
         throw std::runtime_error("failed to begin recording command buffer!");
     }
 
-    // ---- Pass 1: Shadow pass (depth-only) ----
-    if (m_shadowPass) {
-        recordShadowPass(commandBuffer, descriptorSets[m_currentFrame]);
+    // Resolve last round's timestamps for this slot and reset its pool;
+    // the in-flight fence wait above guarantees they are available
+    GpuProfiler::get().beginFrame(commandBuffer, packet.frameIndex);
+
+    // GPU occlusion cull runs before any render pass: it reads last frame's
+    // depth pyramid and writes this frame's indirect commands
+    if (packet.occlusionActiveThisFrame) {
+        m_occlusionCuller->recordCull(commandBuffer, packet.frameIndex);
     }
 
-    // ---- Pass 2: Main render pass ----
-    VkExtent2D extent = m_swapChain.extent();
+    // Bin this frame's lights into the froxel grid before any shading pass
+    if (m_clusteredLighting) {
+        m_clusteredLighting->recordBuild(commandBuffer, packet.frameIndex);
+    }
+
+    // Step GPU-simulated particle emitters before the main pass reads them
+    if (m_particleSystem) {
+        m_particleSystem->recordSimulate(commandBuffer, packet.frameIndex);
+    }
+
+    // Build this frame's graph. Passes declare what they read and write;
+    // the graph derives barrier scopes from consecutive accesses and culls
+    // passes whose results feed no marked output (e.g. the shadow pass when
+    // the main pass has no shadow descriptor set bound).
+    m_frameGraph.reset();
+
+    // A shared shadow map was rendered (and transitioned to READ_ONLY) by
+    // the primary renderer's earlier submission on this queue, so neither
+    // the write pass nor a read declaration is needed here.
+    FrameGraphResource shadowMapRes = kInvalidFrameGraphResource;
+    bool shadowMapConsumed = m_shadowPass && !m_shadowSource &&
+                             (m_shadowDescriptorSet != VK_NULL_HANDLE || m_pushShadowDescriptors);
+    if (m_shadowPass && !m_shadowSource) {
+        // Previous contents are discarded (render pass initialLayout UNDEFINED)
+        shadowMapRes = m_frameGraph.importImage(
+            "shadowMap", m_shadowPass->getDepthImage()->getHandle(),
+            VK_IMAGE_ASPECT_DEPTH_BIT, ResourceAccess{});
+
+        m_frameGraph.addPass("shadow",
+            [&](FrameGraph::Builder& builder) {
+                // The depth-only render pass transitions the map to
+                // READ_ONLY itself, and its external dependency already
+                // makes the write visible to fragment-shader reads — so
+                // declare the post-pass state the main pass relies on and
+                // no extra barrier is emitted between the two.
+                builder.writeAsRenderPass(shadowMapRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                    VK_ACCESS_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL});
+            },
+            [this, set = packet.globalSet](VkCommandBuffer cmd) {
+                GpuProfiler::get().beginScope(cmd, "shadow");
+                recordShadowPass(cmd, set);
+                GpuProfiler::get().endScope(cmd);
+            });
+    }
+
+    // With dynamic resolution the main pass renders into the internal
+    // target (at a sub-rect of its full allocation) and an upscale pass
+    // blits it to the swapchain image; otherwise it renders the swapchain
+    // image directly. Everything recorded below sizes by `extent`, so the
+    // viewport, scissor, particles, and HUD all follow the scale.
+    VkExtent2D presentExtent = m_swapChain.extent();
+    VkExtent2D extent = m_dynamicResolution ? packet.renderExtent : presentExtent;
+
+    // Acquire semaphore orders our access; contents start undefined
+    FrameGraphResource backbufferRes = m_frameGraph.importImage(
+        "backbuffer", m_swapChain.images()[imageIndex],
+        VK_IMAGE_ASPECT_COLOR_BIT, ResourceAccess{});
+
+    FrameGraphResource scaledRes = kInvalidFrameGraphResource;
+    if (m_dynamicResolution) {
+        // The render pass transitions from UNDEFINED itself (contents are
+        // cleared), so last frame's layout does not matter
+        scaledRes = m_frameGraph.importImage(
+            "scaledColor", m_scaledColorImages[packet.frameIndex]->getHandle(),
+            VK_IMAGE_ASPECT_COLOR_BIT, ResourceAccess{});
+    }
 
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = m_renderPass->get();
-    renderPassInfo.framebuffer = m_swapChainFramebuffers[imageIndex];
+    renderPassInfo.renderPass = m_dynamicResolution ? m_scaledRenderPass->get()
+                                                    : m_renderPass->get();
+    renderPassInfo.framebuffer = m_dynamicResolution ? m_scaledFramebuffers[packet.frameIndex]
+                                                     : m_swapChainFramebuffers[imageIndex];
     renderPassInfo.renderArea.offset = {0, 0};
     renderPassInfo.renderArea.extent = extent;
 
@@ -247,309 +624,1880 @@ void Renderer::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t image
     renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
     renderPassInfo.pClearValues = clearValues.data();
 
-    vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    // Parallel path: record draws into secondary buffers on worker threads.
+    // Only worth the thread dispatch overhead for large opaque draw lists.
+    // The indirect path records a handful of buckets, so there is nothing
+    // to partition when it is active.
+    bool useParallelRecording = m_parallelRecordingEnabled &&
+                                !packet.indirectActiveThisFrame &&
+                                packet.opaqueDrawCalls.size() >= PARALLEL_RECORD_THRESHOLD;
+
+    m_frameGraph.addPass("main",
+        [&](FrameGraph::Builder& builder) {
+            if (shadowMapConsumed) {
+                builder.read(shadowMapRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                    VK_ACCESS_SHADER_READ_BIT,
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL});
+            }
+            if (m_dynamicResolution) {
+                // The TRANSFER_SRC pass variant transitions the target and
+                // its extra external dependency already orders the blit's
+                // read — declaring that post-pass state here means the
+                // upscale pass below gets no redundant barrier.
+                builder.writeAsRenderPass(scaledRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    VK_ACCESS_TRANSFER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL});
+            } else {
+                builder.writeAsRenderPass(backbufferRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_PRESENT_SRC_KHR});
+            }
+        },
+        [&](VkCommandBuffer cmd) {
+            GpuProfiler::get().beginScope(cmd, "main");
+            if (useParallelRecording) {
+                vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+                recordSceneParallel(cmd, imageIndex, packet.globalSet);
+            } else {
+                vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+                // Set dynamic viewport and scissor
+                VkViewport viewport{};
+                viewport.x = 0.0f;
+                viewport.y = 0.0f;
+                viewport.width = static_cast<float>(extent.width);
+                viewport.height = static_cast<float>(extent.height);
+                viewport.minDepth = 0.0f;
+                viewport.maxDepth = 1.0f;
+                vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+                VkRect2D scissor{};
+                scissor.offset = {0, 0};
+                scissor.extent = extent;
+                vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+                // Meshlet draws first: their pipeline layout is incompatible
+                // with the shared graphics layout, so recording them before
+                // the classic set bindings means the binds below restore
+                // everything for the rest of the pass
+                if (m_meshletRenderer && !packet.meshletDraws.empty()) {
+                    m_meshletRenderer->recordDraws(cmd, m_renderPass->get(), extent,
+                        packet.frameIndex, packet.meshletDraws.data(),
+                        packet.meshletDraws.size());
+                }
+
+                // Skinned draws likewise record ahead of the classic binds
+                // (their layout is incompatible with the shared one too)
+                if (m_animationSystem) {
+                    m_animationSystem->recordDraws(cmd, m_renderPass->get(), extent,
+                                                   packet.frameIndex);
+                }
 
-    // Set dynamic viewport and scissor
-    VkViewport viewport{};
-    viewport.x = 0.0f;
-    viewport.y = 0.0f;
-    viewport.width = static_cast<float>(extent.width);
-    viewport.height = static_cast<float>(extent.height);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+                // Bind global UBO descriptor set (set 0)
+                VkPipelineLayout layout = m_pipelineManager.getLayout();
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &packet.globalSet, 0, nullptr);
 
-    VkRect2D scissor{};
-    scissor.offset = {0, 0};
-    scissor.extent = extent;
-    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+                // Bind or push shadow map descriptor (set 2) if available
+                bindShadowSet(cmd, layout);
 
-    // Bind global UBO descriptor set (set 0)
-    VkPipelineLayout layout = m_pipelineManager.getLayout();
-    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 1, &descriptorSets[m_currentFrame], 0, nullptr);
+                // Bind clustered light grid (set 3) if enabled
+                if (m_clusteredLighting) {
+                    VkDescriptorSet clusterSet = m_clusteredLighting->descriptorSet(packet.frameIndex);
+                    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 3, 1, &clusterSet, 0, nullptr);
+                }
+
+                // Depth pre-pass first so the shaded opaque draws below can
+                // use the EQUAL depth test
+                recordDepthPrePass(cmd);
+
+                // Instanced batches first (opaque), then remaining singles + transparent
+                recordInstancedBatches(cmd);
+                if (packet.indirectActiveThisFrame) {
+                    recordIndirectDraws(cmd);
+                } else {
+                    issueDrawCalls(cmd);
+                }
+
+                // Blended particle billboards last: they read depth but
+                // never write it, so they layer over the whole scene.
+                // (Not recorded on the parallel path above — its pass
+                // contents are secondary command buffers.)
+                if (m_particleSystem) {
+                    m_particleSystem->recordDraw(cmd, m_renderPass->get(), extent, packet.frameIndex);
+                }
+
+                // Stats HUD very last so it layers over everything
+                if (m_statsOverlay) {
+                    StatsOverlay::FrameStats overlayStats;
+                    overlayStats.drawCalls = packet.drawnCount;
+                    overlayStats.culledDraws = packet.culledCount;
+                    overlayStats.instancedBatches = packet.instancedBatchCount;
+                    // Acquire wait is this frame's; present wait is the
+                    // previous frame's (it happens after recording)
+                    overlayStats.acquireWaitMs = m_lastAcquireWaitMs;
+                    overlayStats.presentWaitMs = m_lastPresentWaitMs;
+                    m_statsOverlay->recordDraw(cmd, m_renderPass->get(), extent,
+                                               packet.frameIndex, overlayStats);
+                }
+            }
 
-    // Bind shadow map descriptor set (set 2) if available
-    if (m_shadowPass && m_shadowDescriptorSet != VK_NULL_HANDLE) {
-        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 2, 1, &m_shadowDescriptorSet, 0, nullptr);
+            vkCmdEndRenderPass(cmd);
+            GpuProfiler::get().endScope(cmd);
+        });
+
+    if (m_dynamicResolution) {
+        m_frameGraph.addPass("upscale",
+            [&](FrameGraph::Builder& builder) {
+                builder.read(scaledRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    VK_ACCESS_TRANSFER_READ_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL});
+                builder.write(backbufferRes, ResourceAccess{
+                    VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    VK_ACCESS_TRANSFER_WRITE_BIT,
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL});
+            },
+            [this, &packet, imageIndex, extent, presentExtent](VkCommandBuffer cmd) {
+                GpuProfiler::get().beginScope(cmd, "upscale");
+
+                VkImageBlit blit{};
+                blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+                blit.srcOffsets[1] = {static_cast<int32_t>(extent.width),
+                                      static_cast<int32_t>(extent.height), 1};
+                blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+                blit.dstOffsets[1] = {static_cast<int32_t>(presentExtent.width),
+                                      static_cast<int32_t>(presentExtent.height), 1};
+                vkCmdBlitImage(cmd,
+                    m_scaledColorImages[packet.frameIndex]->getHandle(),
+                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                    m_swapChain.images()[imageIndex],
+                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                    1, &blit, VK_FILTER_LINEAR);
+
+                // The graph only barriers before passes, so the hand-off to
+                // present is done here: no memory dependency needed, present
+                // visibility comes from the submit's semaphore signal
+                VkImageMemoryBarrier toPresent{};
+                toPresent.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                toPresent.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                toPresent.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                toPresent.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+                toPresent.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                toPresent.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                toPresent.image = m_swapChain.images()[imageIndex];
+                toPresent.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+                vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                    VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                    0, nullptr, 0, nullptr, 1, &toPresent);
+
+                GpuProfiler::get().endScope(cmd);
+            });
     }
 
-    // Issue draw calls with correct pipeline binding
-    issueDrawCalls(commandBuffer);
+    m_frameGraph.markOutput(backbufferRes);
+
+    auto compileResult = m_frameGraph.compile();
+    if (!compileResult.isSuccess()) {
+        throw std::runtime_error("FrameGraph compile failed: " + compileResult.getError().message);
+    }
+    m_frameGraph.execute(commandBuffer);
+
+    // Rebuild the depth pyramid from this frame's depth buffer; next frame's
+    // cull dispatch consumes it (one frame of latency). With dynamic
+    // resolution the depth lives in the internal target, and a sub-rect
+    // render would bake wrongly-placed depth into the pyramid — skip the
+    // rebuild until the scale returns to native (the cull gate in
+    // buildFramePacket sits out those frames too).
+    if (m_occlusionCuller) {
+        if (!m_dynamicResolution) {
+            m_occlusionCuller->recordPyramidBuild(commandBuffer, m_swapChain.depthImage());
+        } else if (packet.renderExtent.width == m_swapChain.extent().width &&
+                   packet.renderExtent.height == m_swapChain.extent().height) {
+            m_occlusionCuller->recordPyramidBuild(commandBuffer, m_scaledDepthImage);
+        }
+    }
 
-    vkCmdEndRenderPass(commandBuffer);
     if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
         throw std::runtime_error("failed to record command buffer!");
     }
 }
 
+void Renderer::enableShadowPushDescriptors() {
+    m_pushDescriptorFn = reinterpret_cast<PFN_vkCmdPushDescriptorSetKHR>(
+        vkGetDeviceProcAddr(m_device.getDevice(), "vkCmdPushDescriptorSetKHR"));
+    if (!m_pushDescriptorFn) {
+        LOG_WARN(RENDERING, "vkCmdPushDescriptorSetKHR not available; shadow set stays on bound descriptors");
+        return;
+    }
+    m_pushShadowDescriptors = true;
+    LOG_INFO(RENDERING, "Shadow map descriptor pushed per-draw (VK_KHR_push_descriptor)");
+}
+
+void Renderer::bindShadowSet(VkCommandBuffer commandBuffer, VkPipelineLayout layout) const {
+    if (m_pushShadowDescriptors && m_shadowPass) {
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.sampler = m_shadowPass->getSampler();
+        imageInfo.imageView = m_shadowPass->getDepthImageView();
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstBinding = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &imageInfo;
+        m_pushDescriptorFn(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 2, 1, &write);
+    } else if (m_shadowPass && m_shadowDescriptorSet != VK_NULL_HANDLE) {
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+            layout, 2, 1, &m_shadowDescriptorSet, 0, nullptr);
+    }
+}
+
 void Renderer::updateGlobalUbo(uint32_t currentImage, Camera& camera,
-                                 const std::vector<std::shared_ptr<Buffer>>& uniformBuffers) {
+                                 const PerFrameUniformBuffer& globalUbo) {
     GlobalUbo ubo{};
     ubo.view = camera.getViewMatrix();
     ubo.proj = camera.getProjectionMatrix();
-    ubo.lightSpaceMatrix = m_lightSpaceMatrix;
+    for (uint32_t c = 0; c < ShadowPass::CASCADE_COUNT; c++) {
+        ubo.lightSpaceMatrices[c] = m_buildPacket->cascades[c].viewProj;
+        ubo.cascadeSplits[static_cast<int>(c)] = m_buildPacket->cascades[c].splitFar;
+    }
     ubo.cameraPosition = glm::vec4(camera.getPosition(), 1.0f);
     ubo.ambientColor = glm::vec4(0.14f, 0.14f, 0.16f, 1.0f);
     float shadowsEnabled = (m_shadowPass != nullptr) ? 1.0f : 0.0f;
     ubo.debugView = glm::vec4(static_cast<float>(m_debugShadingMode), shadowsEnabled, 0.0f, 0.0f);
 
-    // Collect lights from the scene graph into the UBO
-    ubo.lightCount = static_cast<uint32_t>(m_collectedLights.size());
-    for (uint32_t i = 0; i < ubo.lightCount; i++) {
-        ubo.lights[i] = m_collectedLights[i];
+    // Collect lights from the scene graph into the UBO. With clustered
+    // lighting the full list lives in the cluster SSBO instead; the UBO array
+    // stays empty (zeroed) so any legacy-shader pipeline degrades to ambient
+    // rather than reading stale data.
+    if (m_clusteredLighting) {
+        ubo.lightCount = 0;
+    } else {
+        ubo.lightCount = static_cast<uint32_t>(m_collectedLights.size());
+        for (uint32_t i = 0; i < ubo.lightCount; i++) {
+            ubo.lights[i] = m_collectedLights[i];
+        }
     }
 
-    uniformBuffers[currentImage]->copyData(&ubo, sizeof(ubo));
+    // Direct write through the persistent mapping — no map/unmap per frame,
+    // and no flush where the memory type is host-coherent
+    globalUbo.write(currentImage, &ubo, sizeof(ubo));
 }
 
 // --- Private Methods ---
 
-void Renderer::collectDrawCalls(const SceneNode& node, const glm::vec3& cameraPos) {
-    if (!node.isActive()) return;
-
-    auto meshRenderer = node.getComponent<MeshRenderer>();
-    if (meshRenderer) {
-        auto mesh = meshRenderer->getMesh();
-        if (mesh) {
-            const glm::mat4& worldMatrix = node.getWorldMatrix();
-
-            // Frustum culling: test bounding sphere against camera frustum
-            if (m_cullingEnabled) {
-                glm::vec3 worldCenter = glm::vec3(
-                    worldMatrix * glm::vec4(mesh->getBoundsCenter(), 1.0f));
-
-                float maxScale = std::max({
-                    glm::length(glm::vec3(worldMatrix[0])),
-                    glm::length(glm::vec3(worldMatrix[1])),
-                    glm::length(glm::vec3(worldMatrix[2]))
-                });
-                float worldRadius = mesh->getBoundingRadius() * maxScale;
-
-                if (!m_frustum.intersectsSphere(worldCenter, worldRadius)) {
-                    m_culledCount++;
-                    // Still recurse into children (no aggregate bounding volumes yet)
-                    for (const auto& child : node.getChildren()) {
-                        collectDrawCalls(*child, cameraPos);
-                    }
-                    return;
-                }
-            }
-            m_drawnCount++;
-
-            DrawCall dc{};
-            dc.mesh = mesh;
-            dc.pushConstants.modelMatrix = worldMatrix;
-            dc.textureDescriptorSet = m_fallbackTextureDescriptorSet;
-            dc.blendMode = BlendMode::Opaque;
-            dc.cullMode = CullMode::Back;
-
-            if (auto material = meshRenderer->getMaterial()) {
-                const auto& factors = material->getFactors();
-                dc.pushConstants.baseColorFactor = factors.baseColorFactor;
-                float alphaCutoff = (material->getAlphaMode() == AlphaMode::Mask) ? factors.alphaCutoff : 0.0f;
-                dc.pushConstants.emissiveFactor = glm::vec4(factors.emissiveFactor, alphaCutoff);
-                dc.pushConstants.specularColorAndShininess = glm::vec4(factors.specularColor, factors.shininess);
-                dc.pushConstants.pbrFactors = glm::vec4(factors.metallicFactor, factors.roughnessFactor, factors.normalScale, factors.occlusionStrength);
-
-                if (material->getDescriptorSet() != VK_NULL_HANDLE) {
-                    dc.textureDescriptorSet = material->getDescriptorSet();
-                }
+namespace {
+    /**
+     * @brief Quantizes a non-negative distance into 24 monotonic bits.
+     *
+     * IEEE-754 bit patterns of non-negative floats compare the same way the
+     * floats do, so the top 24 bits preserve ordering at reduced precision.
+     */
+    uint32_t quantizeDepth24(float distance) {
+        uint32_t bits;
+        std::memcpy(&bits, &distance, sizeof(bits));
+        return bits >> 8;
+    }
 
-                // Determine pipeline variant from material alpha mode
-                switch (material->getAlphaMode()) {
-                    case AlphaMode::Opaque:
-                        dc.blendMode = BlendMode::Opaque;
-                        break;
-                    case AlphaMode::Mask:
-                        dc.blendMode = BlendMode::AlphaMask;
-                        break;
-                    case AlphaMode::Blend:
-                        dc.blendMode = BlendMode::AlphaBlend;
-                        break;
-                }
+    /**
+     * @brief Packs draw state and depth into a 64-bit radix-sortable key.
+     *
+     * Opaque layout (MSB→LSB): pipeline(8) | material(16) | mesh(16) | depth(24),
+     * grouping by expensive state first with front-to-back depth as tiebreaker.
+     * Transparent layout puts inverted depth in the top bits so the same
+     * ascending sort yields back-to-front order, with state as tiebreaker.
+     */
+    uint64_t makeDrawSortKey(BlendMode blendMode, CullMode cullMode,
+                             VkDescriptorSet materialSet, const void* mesh,
+                             float distance, bool backToFront) {
+        uint64_t pipelineId = (static_cast<uint64_t>(blendMode) << 2) |
+                              static_cast<uint64_t>(cullMode);
+        uint64_t materialId = std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(materialSet)) & 0xFFFF;
+        uint64_t meshId = std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(mesh)) & 0xFFFF;
+        uint64_t depth = quantizeDepth24(distance);
+
+        if (backToFront) {
+            return ((~depth & 0xFFFFFFull) << 40) | (pipelineId << 32) | (materialId << 16) | meshId;
+        }
+        return (pipelineId << 56) | (materialId << 40) | (meshId << 24) | depth;
+    }
 
-                if (factors.doubleSided) {
-                    dc.cullMode = CullMode::None;
-                }
+    /**
+     * @brief Stable LSD radix sort over 64-bit sort keys (8 passes of 8 bits).
+     *
+     * Passes whose digit is uniform across the list are skipped, which makes
+     * the common cases (few pipelines/materials) cost only the counting scan.
+     */
+    template <typename DrawVec>
+    void radixSortByKey(DrawVec& draws, DrawVec& scratch) {
+        if (draws.size() < 2) return;
+        scratch.resize(draws.size());
+
+        for (int shift = 0; shift < 64; shift += 8) {
+            size_t counts[256] = {};
+            for (const auto& draw : draws) {
+                counts[(draw.sortKey >> shift) & 0xFF]++;
+            }
+            if (counts[(draws[0].sortKey >> shift) & 0xFF] == draws.size()) {
+                continue; // All keys share this digit
             }
 
-            // Compute distance to camera for transparent sorting
-            glm::vec3 meshWorldPos = glm::vec3(worldMatrix[3]);
-            dc.distanceToCamera = glm::length(meshWorldPos - cameraPos);
+            size_t offsets[256];
+            size_t sum = 0;
+            for (int i = 0; i < 256; i++) {
+                offsets[i] = sum;
+                sum += counts[i];
+            }
 
-            if (dc.blendMode == BlendMode::AlphaBlend) {
-                m_transparentDrawCalls.push_back(std::move(dc));
-            } else {
-                m_opaqueDrawCalls.push_back(std::move(dc));
+            for (auto& draw : draws) {
+                scratch[offsets[(draw.sortKey >> shift) & 0xFF]++] = std::move(draw);
             }
+            draws.swap(scratch);
         }
     }
 
-    for (const auto& child : node.getChildren()) {
-        collectDrawCalls(*child, cameraPos);
-    }
 }
 
-void Renderer::issueDrawCalls(VkCommandBuffer commandBuffer) {
-    VkExtent2D extent = m_swapChain.extent();
-    VkPipelineLayout layout = m_pipelineManager.getLayout();
-    VkPipeline lastBoundPipeline = VK_NULL_HANDLE;
-
-    auto issueBatch = [&](const std::vector<DrawCall>& drawCalls) {
-        for (const auto& dc : drawCalls) {
-            // Determine the pipeline config for this draw call
-            PipelineConfig config = m_defaultConfig;
-            config.blendMode = dc.blendMode;
-            config.cullMode = dc.cullMode;
-            // Transparent objects: read depth but don't write (allows correct layering)
-            if (dc.blendMode == BlendMode::AlphaBlend) {
-                config.depthWriteEnable = false;
-            }
+void Renderer::rebuildRetainedDraws(const SceneNode& root) {
+    m_retainedVersion = SceneNode::getStructureVersion();
+    m_retainedDraws.clear();
+    appendRetainedDraws(root);
+    m_retainedValid = true;
+    LOG_DEBUG(RENDERING, "Retained draw list rebuilt: {} sources (structure version {})",
+              m_retainedDraws.size(), m_retainedVersion);
+}
 
-            auto pipeline = m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
-            VkPipeline vkPipeline = pipeline->getPipeline();
+void Renderer::appendRetainedDraws(const SceneNode& node) {
+    // Inactive nodes are cached too: the active flag is per-frame state
+    // and is checked at emit time, so toggling it never forces a rebuild
+    if (auto meshRenderer = node.getComponent<MeshRenderer>()) {
+        if (meshRenderer->getMesh()) {
+            RetainedDraw retained;
+            buildDrawPrototype(node, *meshRenderer, retained);
+            m_retainedDraws.push_back(std::move(retained));
+        }
+    }
+    for (const auto& child : node.getChildren()) {
+        appendRetainedDraws(*child);
+    }
+}
 
-            // Only rebind pipeline if it changed
-            if (vkPipeline != lastBoundPipeline) {
-                vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
-                lastBoundPipeline = vkPipeline;
-            }
+void Renderer::buildDrawPrototype(const SceneNode& node, MeshRenderer& meshRenderer,
+                                  RetainedDraw& out) {
+    out.node = &node;
+    out.renderer = &meshRenderer;
+
+    DrawCall& dc = out.prototype;
+    dc.textureDescriptorSet = m_fallbackTextureDescriptorSet;
+    dc.blendMode = BlendMode::Opaque;
+    dc.cullMode = CullMode::Back;
+    dc.isStatic = node.isStatic();
+
+    if (m_bindlessTextureSet != VK_NULL_HANDLE) {
+        // One set for every draw: the rebind filter reduces set 1 binds
+        // to a single one per frame. Untextured draws point at the
+        // reserved fallback slots.
+        dc.textureDescriptorSet = m_bindlessTextureSet;
+        dc.textureIndices.textureIndices = glm::uvec4(
+            BINDLESS_FALLBACK_WHITE | (BINDLESS_FALLBACK_FLAT_NORMAL << 16),
+            BINDLESS_FALLBACK_METALLIC_ROUGHNESS | (BINDLESS_FALLBACK_WHITE << 16),
+            BINDLESS_FALLBACK_WHITE,
+            0);
+    }
 
-            vkCmdPushConstants(commandBuffer, layout,
-                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                0, sizeof(MeshPushConstants), &dc.pushConstants);
+    if (auto material = meshRenderer.getMaterial()) {
+        // Copy the material's cached packed block; it is repacked only
+        // when a setter dirtied it, not per draw per frame
+        const MaterialParameterBlock& block = material->getParameterBlock();
+        dc.pushConstants.baseColorFactor = block.baseColorFactor;
+        dc.pushConstants.emissiveFactor = block.emissiveFactor;
+        dc.pushConstants.specularColorAndShininess = block.specularColorAndShininess;
+        dc.pushConstants.pbrFactors = block.pbrFactors;
+        dc.pushConstants.uvScaleOffset = block.uvScaleOffset;
+
+        if (m_bindlessTextureSet != VK_NULL_HANDLE) {
+            dc.textureIndices.textureIndices = material->getBindlessIndices();
+        } else if (material->getDescriptorSet() != VK_NULL_HANDLE) {
+            dc.textureDescriptorSet = material->getDescriptorSet();
+        }
 
-            if (dc.textureDescriptorSet != VK_NULL_HANDLE) {
-                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                    layout, 1, 1, &dc.textureDescriptorSet, 0, nullptr);
-            }
+        // Determine pipeline variant from material alpha mode
+        switch (material->getAlphaMode()) {
+            case AlphaMode::Opaque:
+                dc.blendMode = BlendMode::Opaque;
+                break;
+            case AlphaMode::Mask:
+                dc.blendMode = BlendMode::AlphaMask;
+                break;
+            case AlphaMode::Blend:
+                dc.blendMode = BlendMode::AlphaBlend;
+                break;
+        }
 
-            dc.mesh->bind(commandBuffer);
-            vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(), 1, 0, 0, 0);
+        if (std::as_const(*material).getFactors().doubleSided) {
+            dc.cullMode = CullMode::None;
         }
-    };
+    }
 
-    // Draw opaque objects first, then transparent (back-to-front, already sorted)
-    issueBatch(m_opaqueDrawCalls);
-    issueBatch(m_transparentDrawCalls);
+    out.transparent = (dc.blendMode == BlendMode::AlphaBlend);
 }
 
-// Legacy renderNode for backward compatibility (delegates to collectDrawCalls)
-void Renderer::renderNode(VkCommandBuffer /*commandBuffer*/, const SceneNode& /*node*/) {
-    // No longer used — draw calls are collected via collectDrawCalls() and issued via issueDrawCalls()
-}
+namespace {
+    /// Retained-draw count above which the vectorized frustum cull runs;
+    /// below it the SoA mirror copy costs more than the scalar tests
+    constexpr size_t SIMD_CULL_MIN_DRAWS = 1024;
 
+    /// Bounds per job-system chunk in the vectorized cull
+    constexpr size_t SIMD_CULL_GRAIN = 4096;
 
-void Renderer::collectLights(const SceneNode& root, std::vector<GpuLight>& outLights) {
-    if (!root.isActive()) return;
-    if (outLights.size() >= MAX_LIGHTS) return;
+    /// Half-extent standing in for draws without bounds: large enough to
+    /// pass every plane test, so they stay visible like the scalar path
+    constexpr float SIMD_CULL_UNBOUNDED_EXTENT = 1e30f;
+}
 
-    auto light = root.getComponent<Light>();
-    if (light && light->isEnabled()) {
-        GpuLight gpu{};
+void Renderer::collectRetainedDraws(const glm::vec3& cameraPos) {
+    const size_t drawCount = m_retainedDraws.size();
+
+    // Large scenes take the vectorized path: bounds mirrored into SoA
+    // arrays and tested 4 per SSE iteration across job-system chunks.
+    // The survivors' indices land in m_visibleRetained.
+    const bool simdCull = m_cullingEnabled && drawCount >= SIMD_CULL_MIN_DRAWS;
+    size_t iterCount = drawCount;
+    if (simdCull) {
+        iterCount = cullRetainedBounds();
+        m_buildPacket->culledCount += static_cast<uint32_t>(drawCount - iterCount);
+    }
 
-        glm::vec3 worldPos = root.getWorldPosition();
-        glm::quat worldRot = root.getWorldRotation();
-        // Forward vector is local -Z rotated by world rotation
-        glm::vec3 forward = glm::normalize(worldRot * glm::vec3(0.0f, 0.0f, -1.0f));
+    for (size_t vi = 0; vi < iterCount; vi++) {
+        const RetainedDraw& retained =
+            m_retainedDraws[simdCull ? m_visibleRetained[vi] : vi];
+        const SceneNode& node = *retained.node;
+        if (!node.isActiveInHierarchy()) continue;
+
+        // Per-mesh culling against the cached world-space AABB (refreshed
+        // only when the node's transform dirty flag was set)
+        if (m_cullingEnabled && !simdCull) {
+            glm::vec3 meshMin, meshMax;
+            if (node.getMeshWorldBounds(meshMin, meshMax) &&
+                !m_frustum.intersectsAABB(meshMin, meshMax)) {
+                m_buildPacket->culledCount++;
+                continue;
+            }
+        }
 
-        gpu.positionAndType = glm::vec4(worldPos, static_cast<float>(light->getType()));
-        gpu.directionAndRange = glm::vec4(forward, light->getRange());
-        gpu.colorAndIntensity = glm::vec4(light->getColor(), light->getIntensity());
+        glm::mat4 worldMatrix = node.getWorldMatrix();
+        m_buildPacket->drawnCount++;
+
+        // Distance drives both depth ordering and LOD selection
+        glm::vec3 meshWorldPos = glm::vec3(worldMatrix[3]);
+        float distanceToCamera = glm::length(meshWorldPos - cameraPos);
+
+        // Everything material-derived comes from the cached prototype;
+        // only the transform, LOD choice, and sort key are per-frame
+        DrawCall dc = retained.prototype;
+        const std::shared_ptr<Mesh>& lod = retained.renderer->selectLod(distanceToCamera);
+        dc.mesh = lod->getHandle();
+
+        // Stamp last use for LRU eviction; an evicted mesh is re-uploaded
+        // from its CPU copy before the draw is recorded. The residency
+        // manager keeps the shared_ptr signature — it sits at the
+        // ownership boundary, not on the per-draw copy path.
+        MeshResidencyManager::get().noteUsage(lod);
+        dc.pushConstants.modelMatrix = worldMatrix;
+        dc.distanceToCamera = distanceToCamera;
+        dc.sortKey = makeDrawSortKey(dc.blendMode, dc.cullMode,
+                                     dc.textureDescriptorSet, dc.mesh.get(),
+                                     dc.distanceToCamera, retained.transparent);
+
+        if (retained.transparent) {
+            m_buildPacket->transparentDrawCalls.push_back(std::move(dc));
+        } else {
+            m_buildPacket->opaqueDrawCalls.push_back(std::move(dc));
+        }
+    }
+}
 
-        if (light->getType() == LightType::Spot) {
-            gpu.spotParams = glm::vec4(
-                std::cos(light->getInnerConeAngle()),
-                std::cos(light->getOuterConeAngle()),
-                0.0f, 0.0f);
+size_t Renderer::cullRetainedBounds() {
+    const size_t count = m_retainedDraws.size();
+    m_boundsCx.resize(count);
+    m_boundsCy.resize(count);
+    m_boundsCz.resize(count);
+    m_boundsEx.resize(count);
+    m_boundsEy.resize(count);
+    m_boundsEz.resize(count);
+    m_visibleRetained.resize(count);
+
+    // Transpose the frustum planes once for the kernel
+    simd::FrustumPlanesSoa planes;
+    for (int p = 0; p < 6; p++) {
+        planes.nx[p] = m_frustum.planes[p].normal.x;
+        planes.ny[p] = m_frustum.planes[p].normal.y;
+        planes.nz[p] = m_frustum.planes[p].normal.z;
+        planes.d[p] = m_frustum.planes[p].distance;
+    }
+
+    // Mirror the cached AABBs into the SoA arrays on this thread: the
+    // lazy bounds refresh walks parents and children, so two chunks
+    // touching related nodes would race on the per-node caches. In
+    // steady state the caches are clean and this is a straight copy.
+    for (size_t i = 0; i < count; i++) {
+        glm::vec3 bmin, bmax;
+        if (m_retainedDraws[i].node->getMeshWorldBounds(bmin, bmax)) {
+            const glm::vec3 center = (bmin + bmax) * 0.5f;
+            const glm::vec3 extent = (bmax - bmin) * 0.5f;
+            m_boundsCx[i] = center.x;
+            m_boundsCy[i] = center.y;
+            m_boundsCz[i] = center.z;
+            m_boundsEx[i] = extent.x;
+            m_boundsEy[i] = extent.y;
+            m_boundsEz[i] = extent.z;
+        } else {
+            m_boundsCx[i] = 0.0f;
+            m_boundsCy[i] = 0.0f;
+            m_boundsCz[i] = 0.0f;
+            m_boundsEx[i] = SIMD_CULL_UNBOUNDED_EXTENT;
+            m_boundsEy[i] = SIMD_CULL_UNBOUNDED_EXTENT;
+            m_boundsEz[i] = SIMD_CULL_UNBOUNDED_EXTENT;
         }
+    }
 
-        outLights.push_back(gpu);
+    // Fan the kernel out in chunks; each chunk compacts its survivors
+    // into its own disjoint slice of m_visibleRetained
+    const size_t chunks = (count + SIMD_CULL_GRAIN - 1) / SIMD_CULL_GRAIN;
+    std::vector<size_t> chunkCounts(chunks, 0);
+    auto handle = JobSystem::get().parallelFor(
+        count, SIMD_CULL_GRAIN, [this, &planes, &chunkCounts](size_t begin, size_t end) {
+            chunkCounts[begin / SIMD_CULL_GRAIN] = simd::cullAabbs(
+                planes, m_boundsCx.data(), m_boundsCy.data(), m_boundsCz.data(),
+                m_boundsEx.data(), m_boundsEy.data(), m_boundsEz.data(),
+                begin, end, m_visibleRetained.data() + begin);
+        });
+    JobSystem::get().wait(handle);
+
+    // Stitch the per-chunk slices left into one contiguous ascending list
+    size_t visible = 0;
+    for (size_t c = 0; c < chunks; c++) {
+        const size_t src = c * SIMD_CULL_GRAIN;
+        if (chunkCounts[c] > 0 && visible != src) {
+            std::memmove(m_visibleRetained.data() + visible,
+                         m_visibleRetained.data() + src,
+                         chunkCounts[c] * sizeof(uint32_t));
+        }
+        visible += chunkCounts[c];
     }
+    return visible;
+}
 
-    for (const auto& child : root.getChildren()) {
-        if (outLights.size() >= MAX_LIGHTS) break;
-        collectLights(*child, outLights);
+void Renderer::resetFrameContainers() {
+    m_collectedLights = FrameVector<GpuLight>();
+    m_buildPacket->opaqueDrawCalls = FrameVector<DrawCall>();
+    m_buildPacket->transparentDrawCalls = FrameVector<DrawCall>();
+    m_drawSortScratch = FrameVector<DrawCall>();
+    m_buildPacket->instanceBatches = FrameVector<InstanceBatch>();
+    m_buildPacket->instanceScratch = FrameVector<glm::mat4>();
+    m_drawDataScratch = FrameVector<GpuDrawData>();
+    m_indirectCommandScratch = FrameVector<VkDrawIndexedIndirectCommand>();
+    m_buildPacket->indirectBuckets = FrameVector<IndirectBucket>();
+    m_buildPacket->meshletDraws = FrameVector<MeshletDraw>();
+}
+
+void Renderer::sortDrawCalls() {
+    if (!m_drawSortingEnabled) {
+        return;  // Benchmark knob: measure the collection-order draw stream
     }
+    radixSortByKey(m_buildPacket->opaqueDrawCalls, m_drawSortScratch);
+    radixSortByKey(m_buildPacket->transparentDrawCalls, m_drawSortScratch);
 }
 
-void Renderer::createFramebuffers() {
+void Renderer::recordDrawRange(VkCommandBuffer commandBuffer, const DrawCall* drawCalls,
+                               size_t count, RecordState& state) {
     VkExtent2D extent = m_swapChain.extent();
-    LOG_INFO(VULKAN, "Creating {} framebuffers at {}x{}", 
-              m_swapChain.imageViews().size(), extent.width, extent.height);
-    
-    m_swapChainFramebuffers.resize(m_swapChain.imageViews().size());
-    for (size_t i = 0; i < m_swapChain.imageViews().size(); i++) {
-        std::array<VkImageView, 2> attachments = {
-            m_swapChain.imageViews()[i],
-            m_swapChain.depthImageView()
-        };
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
 
-        VkFramebufferCreateInfo framebufferInfo{};
-        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-        framebufferInfo.renderPass = m_renderPass->get();
-        framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
-        framebufferInfo.pAttachments = attachments.data();
-        framebufferInfo.width = extent.width;
-        framebufferInfo.height = extent.height;
-        framebufferInfo.layers = 1;
-        if (vkCreateFramebuffer(m_device.getDevice(), &framebufferInfo, nullptr, &m_swapChainFramebuffers[i]) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create framebuffer!");
+    for (size_t i = 0; i < count; i++) {
+        const DrawCall& dc = drawCalls[i];
+
+        // Determine the pipeline config for this draw call
+        PipelineConfig config = m_defaultConfig;
+        config.blendMode = dc.blendMode;
+        config.cullMode = dc.cullMode;
+        config.vertexFormat = dc.mesh->getVertexFormat();
+        applyShadingSpecConstants(config);
+        // Transparent objects: read depth but don't write (allows correct layering)
+        if (dc.blendMode == BlendMode::AlphaBlend) {
+            config.depthWriteEnable = false;
+        }
+        // Pre-passed draws already wrote depth: shade only the surviving
+        // fragment per pixel. Alpha-mask draws skipped the pre-pass and
+        // keep the LESS test.
+        if (m_depthPrePassEnabled && dc.blendMode == BlendMode::Opaque) {
+            config.depthCompareEqual = true;
+            config.depthWriteEnable = false;
         }
-    }
-}
 
-void Renderer::createCommandBuffers() {
-    m_frames.resize(MAX_FRAMES_IN_FLIGHT);
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.commandPool = m_commandPool->getPool();
-    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandBufferCount = 1;
+        auto pipeline = m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
+        VkPipeline vkPipeline = pipeline->getPipeline();
 
-    for (size_t i = 0; i < m_frames.size(); i++) {
-        if (vkAllocateCommandBuffers(m_device.getDevice(), &allocInfo, &m_frames[i].commandBuffer) != VK_SUCCESS) {
-            throw std::runtime_error("failed to allocate command buffers!");
+        // Sorted input makes these comparisons eliminate most rebinds:
+        // draws sharing pipeline/material/mesh arrive as contiguous runs.
+        if (vkPipeline != state.pipeline) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+            state.pipeline = vkPipeline;
         }
-    }
-}
 
-void Renderer::createSyncObjects() {
-    VkSemaphoreCreateInfo semaphoreInfo{};
-    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-    VkFenceCreateInfo fenceInfo{};
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        vkCmdPushConstants(commandBuffer, layout,
+            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+            0, sizeof(MeshPushConstants), &dc.pushConstants);
 
-    for (size_t i = 0; i < m_frames.size(); i++) {
-        if (vkCreateSemaphore(m_device.getDevice(), &semaphoreInfo, nullptr, &m_frames[i].imageAvailableSemaphore) != VK_SUCCESS ||
-            vkCreateSemaphore(m_device.getDevice(), &semaphoreInfo, nullptr, &m_frames[i].renderFinishedSemaphore) != VK_SUCCESS ||
-            vkCreateFence(m_device.getDevice(), &fenceInfo, nullptr, &m_frames[i].inFlightFence) != VK_SUCCESS) {
-            throw std::runtime_error("failed to create synchronization objects for a frame!");
+        if (m_bindlessTextureSet != VK_NULL_HANDLE) {
+            vkCmdPushConstants(commandBuffer, layout,
+                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                sizeof(MeshPushConstants), sizeof(BindlessPushConstants), &dc.textureIndices);
+        }
+
+        if (dc.textureDescriptorSet != VK_NULL_HANDLE &&
+            dc.textureDescriptorSet != state.textureSet) {
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                layout, 1, 1, &dc.textureDescriptorSet, 0, nullptr);
+            state.textureSet = dc.textureDescriptorSet;
+        }
+
+        if (dc.mesh.get() != state.mesh) {
+            dc.mesh->bind(commandBuffer);
+            state.mesh = dc.mesh.get();
         }
+        vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(), 1, 0, 0, 0);
     }
 }
 
-void Renderer::recreateSwapChain(Camera& camera) {
-    int width = 0, height = 0;
-    m_window->getFramebufferSize(width, height);
-    while (width == 0 || height == 0) {
-        m_window->getFramebufferSize(width, height);
-        m_window->waitEvents();
-    }
+void Renderer::issueDrawCalls(VkCommandBuffer commandBuffer) {
+    RecordState state{};
 
-    vkDeviceWaitIdle(m_device.getDevice());
+    // Draw opaque objects first, then transparent (back-to-front, already sorted)
+    recordDrawRange(commandBuffer, m_renderPacket->opaqueDrawCalls.data(), m_renderPacket->opaqueDrawCalls.size(), state);
+    recordDrawRange(commandBuffer, m_renderPacket->transparentDrawCalls.data(), m_renderPacket->transparentDrawCalls.size(), state);
+}
 
-    for (auto framebuffer : m_swapChainFramebuffers) {
-        vkDestroyFramebuffer(m_device.getDevice(), framebuffer, nullptr);
-    }
+// ============================================================================
+// Depth Pre-Pass
+// ============================================================================
 
-    m_swapChain.recreate(width, height);
+void Renderer::enableDepthPrePass(const PipelineConfig& prePassConfig) {
+    m_prePassConfig = prePassConfig;
+    m_prePassConfig.colorWriteEnable = false;
+    m_prePassConfig.depthTestEnable = true;
+    m_prePassConfig.depthWriteEnable = true;
+    m_prePassConfig.depthCompareEqual = false;
+    m_depthPrePassEnabled = true;
+    LOG_INFO(RENDERING, "Depth pre-pass enabled (fragment shader: {})",
+             m_prePassConfig.fragShaderPath.string());
+}
 
-    // Get the actual extent from swapchain (this is the source of truth)
-    VkExtent2D extent = m_swapChain.extent();
-    LOG_INFO(VULKAN, "SwapChain recreated: {}x{} (requested {}x{})", 
-             extent.width, extent.height, width, height);
+void Renderer::recordDepthPrePass(VkCommandBuffer commandBuffer) {
+    if (!m_depthPrePassEnabled || m_renderPacket->opaqueDrawCalls.empty()) return;
+
+    // The indirect path shades singles with its own vertex shader; an EQUAL
+    // depth test against depth laid down here by shader.vert would not be
+    // guaranteed bit-exact, so the pre-pass stands down while it is active.
+    if (m_renderPacket->indirectActiveThisFrame) return;
+
+    VkExtent2D extent = m_swapChain.extent();
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
+    VkPipeline lastBoundPipeline = VK_NULL_HANDLE;
+    const Mesh* lastBoundMesh = nullptr;
+
+    // Only plain opaque draws participate: alpha-mask draws would need the
+    // material's base color texture to reproduce the cutoff, and instanced
+    // batches are recorded before the singles with depth writes anyway.
+    for (const DrawCall& dc : m_renderPacket->opaqueDrawCalls) {
+        if (dc.blendMode != BlendMode::Opaque) continue;
+
+        PipelineConfig config = m_prePassConfig;
+        config.cullMode = dc.cullMode;
+        config.vertexFormat = dc.mesh->getVertexFormat();
+
+        auto pipeline = m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
+        VkPipeline vkPipeline = pipeline->getPipeline();
+        if (vkPipeline != lastBoundPipeline) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+            lastBoundPipeline = vkPipeline;
+        }
+
+        // Only the model matrix is consumed, but pushing the full block keeps
+        // the layout identical to the shaded pass
+        vkCmdPushConstants(commandBuffer, layout,
+            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+            0, sizeof(MeshPushConstants), &dc.pushConstants);
+
+        if (dc.mesh.get() != lastBoundMesh) {
+            dc.mesh->bind(commandBuffer);
+            lastBoundMesh = dc.mesh.get();
+        }
+        vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(), 1, 0, 0, 0);
+    }
+}
+
+// ============================================================================
+// Indirect Multi-Draw
+// ============================================================================
+
+void Renderer::enableIndirectDraws(std::shared_ptr<MemoryManager> memoryManager,
+                                   const PipelineConfig& indirectConfig) {
+    if (!m_device.supportsIndirectDraws()) {
+        LOG_WARN(RENDERING, "Indirect draws requested but the device lacks multiDrawIndirect/shaderDrawParameters; using the push-constant path");
+        return;
+    }
+
+    m_memoryManager = std::move(memoryManager);
+    m_indirectConfig = indirectConfig;
+    m_indirectFrames.resize(MAX_FRAMES_IN_FLIGHT);
+    m_indirectEnabled = true;
+    LOG_INFO(RENDERING, "Indirect multi-draw enabled (shader: {})",
+             m_indirectConfig.vertShaderPath.string());
+}
+
+void Renderer::growIndirectBuffers(IndirectFrame& frame, uint32_t drawCount) {
+    VkDeviceSize dataSize = VkDeviceSize(drawCount) * sizeof(GpuDrawData);
+    if (!frame.drawData || frame.drawData->getSize() < dataSize) {
+        // Over-allocate so the buffers only regrow when the scene gets bigger
+        VkDeviceSize allocSize = std::max<VkDeviceSize>(dataSize * 2, 256 * sizeof(GpuDrawData));
+        auto result = m_memoryManager->createStorageBuffer(allocSize, true /* hostVisible */);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("failed to create indirect draw-data buffer!");
+        }
+        frame.drawData = result.getValue();
+        frame.writtenSet = VK_NULL_HANDLE; // Binding 1 must point at the new buffer
+    }
+
+    VkDeviceSize commandSize = VkDeviceSize(drawCount) * sizeof(VkDrawIndexedIndirectCommand);
+    if (!frame.commands || frame.commands->getSize() < commandSize) {
+        BufferCreateInfo commandInfo{};
+        commandInfo.size = std::max<VkDeviceSize>(commandSize * 2,
+                                                  256 * sizeof(VkDrawIndexedIndirectCommand));
+        commandInfo.usage = BufferUsage::Indirect;
+        commandInfo.hostVisible = true;
+        commandInfo.debugName = "indirectDrawCommands";
+        auto result = m_memoryManager->createBuffer(commandInfo);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("failed to create indirect command buffer!");
+        }
+        frame.commands = result.getValue();
+    }
+}
+
+void Renderer::prepareIndirectDraws(uint32_t frameIndex, VkDescriptorSet uboSet) {
+    m_buildPacket->indirectActiveThisFrame = false;
+    m_indirectBucketCount = 0;
+
+    // The path needs one texture set for every draw, so it activates only
+    // once the bindless array is wired up
+    if (!m_indirectEnabled || m_bindlessTextureSet == VK_NULL_HANDLE) return;
+
+    const uint32_t totalDraws =
+        static_cast<uint32_t>(m_buildPacket->opaqueDrawCalls.size() + m_buildPacket->transparentDrawCalls.size());
+    if (totalDraws == 0) return;
+
+    m_buildPacket->indirectActiveThisFrame = true;
+
+    IndirectFrame& frame = m_indirectFrames[frameIndex];
+    growIndirectBuffers(frame, totalDraws);
+
+    // (Re)point set-0 binding 1 at this frame's draw-data buffer. The
+    // frame's fence was waited before recording began, so the set is
+    // guaranteed not to be in flight.
+    if (frame.writtenSet != uboSet) {
+        VkDescriptorBufferInfo bufferInfo{};
+        bufferInfo.buffer = frame.drawData->getHandle();
+        bufferInfo.offset = 0;
+        bufferInfo.range = VK_WHOLE_SIZE;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = uboSet;
+        write.dstBinding = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        write.descriptorCount = 1;
+        write.pBufferInfo = &bufferInfo;
+        vkUpdateDescriptorSets(m_device.getDevice(), 1, &write, 0, nullptr);
+        frame.writtenSet = uboSet;
+    }
+
+    m_drawDataScratch.reserve(totalDraws);
+    m_indirectCommandScratch.reserve(totalDraws);
+
+    // Pack draws in issue order (opaque runs, then transparent back-to-front;
+    // commands within one indirect draw execute in array order, so the sort
+    // is preserved). A new bucket starts whenever the pipeline variant or
+    // the required vertex/index binding changes.
+    auto appendDraws = [&](const FrameVector<DrawCall>& drawCalls) {
+        for (const DrawCall& dc : drawCalls) {
+            const Mesh& mesh = *dc.mesh;
+
+            const VkDeviceSize stride = mesh.getVertexFormat() == VertexFormat::Compact
+                ? sizeof(CompactVertex) : sizeof(Vertex);
+            const VkDeviceSize indexSize =
+                mesh.getIndexType() == VK_INDEX_TYPE_UINT16 ? 2 : 4;
+
+            // Resolve the binding this draw needs. Pooled meshes on
+            // whole-vertex boundaries address their block bound at offset
+            // zero through firstIndex/vertexOffset, so every mesh in the
+            // block can share one bucket; anything else binds at its own
+            // offsets and caps the bucket at the mesh boundary.
+            VkBuffer vertexBuffer;
+            VkBuffer indexBuffer;
+            VkDeviceSize vertexBindOffset = 0;
+            VkDeviceSize indexBindOffset = 0;
+            uint32_t firstIndex = 0;
+            int32_t vertexOffset = 0;
+
+            if (mesh.isPooled()) {
+                auto& pool = MeshBufferPool::get();
+                vertexBuffer = pool.getVertexBuffer(mesh.getPoolBlock())->getHandle();
+                indexBuffer = pool.getIndexBuffer(mesh.getPoolBlock())->getHandle();
+                if (mesh.getVertexOffset() % stride == 0 &&
+                    mesh.getIndexOffset() % indexSize == 0) {
+                    firstIndex = static_cast<uint32_t>(mesh.getIndexOffset() / indexSize);
+                    vertexOffset = static_cast<int32_t>(mesh.getVertexOffset() / stride);
+                } else {
+                    // Allocated before stride alignment existed: per-mesh binding
+                    vertexBindOffset = mesh.getVertexOffset();
+                    indexBindOffset = mesh.getIndexOffset();
+                }
+            } else {
+                vertexBuffer = mesh.getVertexBuffer()->getHandle();
+                indexBuffer = mesh.getIndexBuffer()->getHandle();
+            }
+
+            bool compatible = !m_buildPacket->indirectBuckets.empty();
+            if (compatible) {
+                const IndirectBucket& bucket = m_buildPacket->indirectBuckets.back();
+                compatible = bucket.blendMode == dc.blendMode
+                    && bucket.cullMode == dc.cullMode
+                    && bucket.vertexFormat == mesh.getVertexFormat()
+                    && bucket.vertexBuffer == vertexBuffer
+                    && bucket.indexBuffer == indexBuffer
+                    && bucket.vertexBindOffset == vertexBindOffset
+                    && bucket.indexBindOffset == indexBindOffset
+                    && bucket.indexType == mesh.getIndexType();
+            }
+            if (!compatible) {
+                m_buildPacket->indirectBuckets.push_back(IndirectBucket{
+                    dc.blendMode, dc.cullMode, mesh.getVertexFormat(),
+                    vertexBuffer, indexBuffer, vertexBindOffset, indexBindOffset,
+                    mesh.getIndexType(),
+                    static_cast<uint32_t>(m_indirectCommandScratch.size()), 0});
+            }
+
+            VkDrawIndexedIndirectCommand command{};
+            command.indexCount = mesh.getIndexCount();
+            command.instanceCount = 1;
+            command.firstIndex = firstIndex;
+            command.vertexOffset = vertexOffset;
+            command.firstInstance = 0;
+            m_indirectCommandScratch.push_back(command);
+
+            GpuDrawData data{};
+            data.modelMatrix = dc.pushConstants.modelMatrix;
+            data.baseColorFactor = dc.pushConstants.baseColorFactor;
+            data.emissiveFactor = dc.pushConstants.emissiveFactor;
+            data.specularColorAndShininess = dc.pushConstants.specularColorAndShininess;
+            data.pbrFactors = dc.pushConstants.pbrFactors;
+            data.uvScaleOffset = dc.pushConstants.uvScaleOffset;
+            data.textureIndices = dc.textureIndices.textureIndices;
+            m_drawDataScratch.push_back(data);
+
+            m_buildPacket->indirectBuckets.back().drawCount++;
+        }
+    };
+
+    appendDraws(m_buildPacket->opaqueDrawCalls);
+    appendDraws(m_buildPacket->transparentDrawCalls);
+
+    frame.drawData->write(m_drawDataScratch.data(),
+                          m_drawDataScratch.size() * sizeof(GpuDrawData));
+    frame.commands->write(m_indirectCommandScratch.data(),
+                          m_indirectCommandScratch.size() * sizeof(VkDrawIndexedIndirectCommand));
+
+    m_indirectBucketCount = static_cast<uint32_t>(m_buildPacket->indirectBuckets.size());
+}
+
+void Renderer::recordIndirectDraws(VkCommandBuffer commandBuffer) {
+    if (m_renderPacket->indirectBuckets.empty()) return;
+
+    VkExtent2D extent = m_swapChain.extent();
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
+    VkPipeline lastBoundPipeline = VK_NULL_HANDLE;
+    const IndirectFrame& frame = m_indirectFrames[m_renderPacket->frameIndex];
+
+    // One texture set covers every draw (the path requires bindless)
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+        layout, 1, 1, &m_bindlessTextureSet, 0, nullptr);
+
+    for (const IndirectBucket& bucket : m_renderPacket->indirectBuckets) {
+        PipelineConfig config = m_indirectConfig;
+        config.blendMode = bucket.blendMode;
+        config.cullMode = bucket.cullMode;
+        config.vertexFormat = bucket.vertexFormat;
+        applyShadingSpecConstants(config);
+        // Transparent objects: read depth but don't write (allows correct layering)
+        if (bucket.blendMode == BlendMode::AlphaBlend) {
+            config.depthWriteEnable = false;
+        }
+
+        auto pipeline = m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
+        VkPipeline vkPipeline = pipeline->getPipeline();
+        if (vkPipeline != lastBoundPipeline) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+            lastBoundPipeline = vkPipeline;
+        }
+
+        // The bucket's base record index; gl_DrawID supplies the rest
+        vkCmdPushConstants(commandBuffer, layout,
+            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+            0, sizeof(uint32_t), &bucket.firstDraw);
+
+        VkDeviceSize vertexBindOffset = bucket.vertexBindOffset;
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &bucket.vertexBuffer, &vertexBindOffset);
+        vkCmdBindIndexBuffer(commandBuffer, bucket.indexBuffer, bucket.indexBindOffset,
+                             bucket.indexType);
+
+        vkCmdDrawIndexedIndirect(commandBuffer, frame.commands->getHandle(),
+            VkDeviceSize(bucket.firstDraw) * sizeof(VkDrawIndexedIndirectCommand),
+            bucket.drawCount, sizeof(VkDrawIndexedIndirectCommand));
+    }
+}
+
+// ============================================================================
+// Instanced Rendering
+// ============================================================================
+
+void Renderer::enableInstancing(std::shared_ptr<MemoryManager> memoryManager,
+                                const PipelineConfig& instancedConfig) {
+    m_memoryManager = std::move(memoryManager);
+    m_instancedConfig = instancedConfig;
+    m_instancedConfig.instanced = true;
+    m_instanceBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+    m_instancingEnabled = true;
+    LOG_INFO(RENDERING, "Instanced rendering enabled (shader: {})",
+             m_instancedConfig.vertShaderPath.string());
+}
+
+void Renderer::buildInstanceBatches() {
+    // Group opaque draws by everything that must match for a shared drawIndexed:
+    // mesh, texture descriptor set, pipeline state, and material push-constant
+    // factors. Bucket by the cheap pointer pair first, then verify factors.
+    struct Bucket {
+        std::vector<size_t> drawIndices;
+    };
+
+    auto bucketKey = [](const DrawCall& dc) {
+        size_t h = std::hash<const void*>{}(dc.mesh.get());
+        h ^= std::hash<uintptr_t>{}(reinterpret_cast<uintptr_t>(dc.textureDescriptorSet)) << 1;
+        h ^= std::hash<int>{}(static_cast<int>(dc.blendMode)) << 2;
+        h ^= std::hash<int>{}(static_cast<int>(dc.cullMode)) << 3;
+        return h;
+    };
+
+    auto sameBatchState = [](const DrawCall& a, const DrawCall& b) {
+        return a.mesh.get() == b.mesh.get()
+            && a.textureDescriptorSet == b.textureDescriptorSet
+            && a.textureIndices.textureIndices == b.textureIndices.textureIndices
+            && a.blendMode == b.blendMode
+            && a.cullMode == b.cullMode
+            && a.pushConstants.baseColorFactor == b.pushConstants.baseColorFactor
+            && a.pushConstants.emissiveFactor == b.pushConstants.emissiveFactor
+            && a.pushConstants.specularColorAndShininess == b.pushConstants.specularColorAndShininess
+            && a.pushConstants.pbrFactors == b.pushConstants.pbrFactors
+            && a.pushConstants.uvScaleOffset == b.pushConstants.uvScaleOffset;
+    };
+
+    std::unordered_map<size_t, std::vector<Bucket>> buckets;
+    buckets.reserve(m_buildPacket->opaqueDrawCalls.size());
+
+    for (size_t i = 0; i < m_buildPacket->opaqueDrawCalls.size(); i++) {
+        auto& bucketList = buckets[bucketKey(m_buildPacket->opaqueDrawCalls[i])];
+        bool placed = false;
+        for (auto& bucket : bucketList) {
+            if (sameBatchState(m_buildPacket->opaqueDrawCalls[bucket.drawIndices.front()], m_buildPacket->opaqueDrawCalls[i])) {
+                bucket.drawIndices.push_back(i);
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            bucketList.push_back(Bucket{{i}});
+        }
+    }
+
+    // Build batches for groups of 2+; keep singles in the regular draw list
+    std::vector<bool> batched(m_buildPacket->opaqueDrawCalls.size(), false);
+    m_buildPacket->instancedDrawCount = 0;
+
+    for (auto& [key, bucketList] : buckets) {
+        for (auto& bucket : bucketList) {
+            if (bucket.drawIndices.size() < 2) continue;
+
+            InstanceBatch batch{};
+            batch.prototype = m_buildPacket->opaqueDrawCalls[bucket.drawIndices.front()];
+            batch.firstInstance = static_cast<uint32_t>(m_buildPacket->instanceScratch.size());
+            batch.instanceCount = static_cast<uint32_t>(bucket.drawIndices.size());
+            batch.allStatic = true;
+
+            for (size_t idx : bucket.drawIndices) {
+                m_buildPacket->instanceScratch.push_back(m_buildPacket->opaqueDrawCalls[idx].pushConstants.modelMatrix);
+                batch.allStatic = batch.allStatic && m_buildPacket->opaqueDrawCalls[idx].isStatic;
+                batched[idx] = true;
+            }
+
+            m_buildPacket->instanceBatches.push_back(std::move(batch));
+            m_buildPacket->instancedDrawCount += static_cast<uint32_t>(bucket.drawIndices.size());
+        }
+    }
+
+    if (m_buildPacket->instanceBatches.empty()) return;
+
+    // Compact the opaque list down to the non-batched singles
+    size_t write = 0;
+    for (size_t i = 0; i < m_buildPacket->opaqueDrawCalls.size(); i++) {
+        if (!batched[i]) {
+            if (write != i) m_buildPacket->opaqueDrawCalls[write] = std::move(m_buildPacket->opaqueDrawCalls[i]);
+            write++;
+        }
+    }
+    m_buildPacket->opaqueDrawCalls.resize(write);
+}
+
+void Renderer::uploadInstanceData(uint32_t frameIndex) {
+    if (m_buildPacket->instanceScratch.empty()) return;
+
+    VkDeviceSize requiredSize = m_buildPacket->instanceScratch.size() * sizeof(glm::mat4);
+
+    // Grow the per-frame instance buffer if needed (host-visible vertex buffer)
+    auto& buffer = m_instanceBuffers[frameIndex];
+    if (!buffer || buffer->getSize() < requiredSize) {
+        // Over-allocate to avoid regrowing every time the instance count creeps up
+        VkDeviceSize allocSize = std::max<VkDeviceSize>(requiredSize * 2, 256 * sizeof(glm::mat4));
+        auto result = m_memoryManager->createVertexBuffer(allocSize, true);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("failed to create instance buffer!");
+        }
+        buffer = result.getValue();
+    }
+
+    buffer->write(m_buildPacket->instanceScratch.data(), requiredSize);
+}
+
+void Renderer::recordInstancedBatches(VkCommandBuffer commandBuffer) {
+    if (m_renderPacket->instanceBatches.empty()) return;
+
+    VkExtent2D extent = m_swapChain.extent();
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
+    VkPipeline lastBoundPipeline = VK_NULL_HANDLE;
+
+    // Bind the instance stream once; per-batch offsets use firstInstance.
+    // With GPU occlusion culling the stream is the compute-compacted
+    // transform buffer instead of the CPU-uploaded one.
+    VkBuffer instanceBuffer = m_renderPacket->occlusionActiveThisFrame
+        ? m_occlusionCuller->transformsBuffer(m_renderPacket->frameIndex)
+        : m_instanceBuffers[m_renderPacket->frameIndex]->getHandle();
+    VkDeviceSize zeroOffset = 0;
+    vkCmdBindVertexBuffers(commandBuffer, 1, 1, &instanceBuffer, &zeroOffset);
+
+    for (size_t batchIndex = 0; batchIndex < m_renderPacket->instanceBatches.size(); batchIndex++) {
+        const InstanceBatch& batch = m_renderPacket->instanceBatches[batchIndex];
+        const DrawCall& dc = batch.prototype;
+
+        PipelineConfig config = m_instancedConfig;
+        config.blendMode = dc.blendMode;
+        config.cullMode = dc.cullMode;
+        config.vertexFormat = dc.mesh->getVertexFormat();
+        applyShadingSpecConstants(config);
+
+        auto pipeline = m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
+        VkPipeline vkPipeline = pipeline->getPipeline();
+        if (vkPipeline != lastBoundPipeline) {
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+            lastBoundPipeline = vkPipeline;
+        }
+
+        // Material factors are uniform across the batch; the model matrix in
+        // the push constants is ignored by the instanced vertex shader.
+        vkCmdPushConstants(commandBuffer, layout,
+            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+            0, sizeof(MeshPushConstants), &dc.pushConstants);
+
+        if (m_bindlessTextureSet != VK_NULL_HANDLE) {
+            vkCmdPushConstants(commandBuffer, layout,
+                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                sizeof(MeshPushConstants), sizeof(BindlessPushConstants), &dc.textureIndices);
+        }
+
+        if (dc.textureDescriptorSet != VK_NULL_HANDLE) {
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                layout, 1, 1, &dc.textureDescriptorSet, 0, nullptr);
+        }
+
+        dc.mesh->bind(commandBuffer);
+        if (m_renderPacket->occlusionActiveThisFrame) {
+            // instanceCount comes from the cull shader; everything else in
+            // the command was written by prepareOcclusionCulling()
+            vkCmdDrawIndexedIndirect(commandBuffer,
+                m_occlusionCuller->commandsBuffer(m_renderPacket->frameIndex),
+                batchIndex * OcclusionCuller::commandStride(), 1,
+                static_cast<uint32_t>(OcclusionCuller::commandStride()));
+        } else {
+            vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(),
+                             batch.instanceCount, 0, 0, batch.firstInstance);
+        }
+    }
+}
+
+void Renderer::enableOcclusionCulling(const std::filesystem::path& shaderDir) {
+    if (!m_instancingEnabled) {
+        LOG_WARN(RENDERING, "Occlusion culling requires instancing; call enableInstancing() first");
+        return;
+    }
+
+    VkExtent2D extent = m_swapChain.extent();
+    m_occlusionCuller = std::make_unique<OcclusionCuller>(
+        m_device, m_memoryManager, m_pipelineManager, MAX_FRAMES_IN_FLIGHT,
+        shaderDir, extent.width, extent.height);
+    LOG_INFO(RENDERING, "GPU occlusion culling enabled");
+}
+
+void Renderer::enableClusteredLighting(std::shared_ptr<MemoryManager> memoryManager,
+                                       const std::filesystem::path& shaderDir) {
+    m_clusteredLighting = std::make_unique<ClusteredLighting>(
+        m_device, std::move(memoryManager), m_pipelineManager, MAX_FRAMES_IN_FLIGHT, shaderDir);
+    LOG_INFO(RENDERING, "Clustered lighting enabled");
+}
+
+void Renderer::enableMeshShading(std::shared_ptr<MemoryManager> memoryManager,
+                                 const std::filesystem::path& shaderDir) {
+    if (!m_device.supportsMeshShading()) {
+        LOG_WARN(RENDERING, "Mesh shading not supported by this device; "
+                 "meshlet draws fall back to the classic vertex path");
+        return;
+    }
+
+    m_meshletRenderer = std::make_unique<MeshletRenderer>(
+        m_device, std::move(memoryManager), m_pipelineManager, MAX_FRAMES_IN_FLIGHT, shaderDir);
+    LOG_INFO(RENDERING, "Mesh shading (meshlet path) enabled");
+}
+
+void Renderer::enableSkinning(std::shared_ptr<MemoryManager> memoryManager,
+                              const std::filesystem::path& shaderDir) {
+    m_animationSystem = std::make_unique<AnimationSystem>(
+        m_device, std::move(memoryManager), m_pipelineManager, MAX_FRAMES_IN_FLIGHT, shaderDir);
+    LOG_INFO(RENDERING, "Skeletal animation enabled");
+}
+
+void Renderer::enableParticles(std::shared_ptr<MemoryManager> memoryManager,
+                               const std::filesystem::path& shaderDir) {
+    m_particleSystem = std::make_unique<ParticleSystem>(
+        m_device, std::move(memoryManager), m_pipelineManager, MAX_FRAMES_IN_FLIGHT, shaderDir);
+    LOG_INFO(RENDERING, "Particles enabled");
+}
+
+void Renderer::enableStatsOverlay(std::shared_ptr<MemoryManager> memoryManager,
+                                  const std::filesystem::path& shaderDir) {
+    m_statsOverlay = std::make_unique<StatsOverlay>(
+        m_device, std::move(memoryManager), m_pipelineManager, MAX_FRAMES_IN_FLIGHT, shaderDir);
+    LOG_INFO(RENDERING, "Stats overlay enabled");
+}
+
+void Renderer::enableScreenshotCapture(std::shared_ptr<MemoryManager> memoryManager,
+                                       const std::filesystem::path& outputDir) {
+    m_screenshotCapture = std::make_unique<ScreenshotCapture>(
+        m_device, std::move(memoryManager), outputDir);
+}
+
+void Renderer::prepareOcclusionCulling(Camera& camera) {
+    m_cullCandidateScratch.clear();
+    m_cullCommandScratch.clear();
+    m_cullCandidateScratch.reserve(m_buildPacket->instanceScratch.size());
+    m_cullCommandScratch.reserve(m_buildPacket->instanceBatches.size());
+
+    for (size_t b = 0; b < m_buildPacket->instanceBatches.size(); b++) {
+        const InstanceBatch& batch = m_buildPacket->instanceBatches[b];
+        const auto& mesh = batch.prototype.mesh;
+
+        VkDrawIndexedIndirectCommand command{};
+        command.indexCount = mesh->getIndexCount();
+        command.instanceCount = 0; // cull shader counts the survivors
+        command.firstIndex = 0;
+        command.vertexOffset = 0;
+        command.firstInstance = batch.firstInstance;
+        m_cullCommandScratch.push_back(command);
+
+        glm::vec4 localSphere(mesh->getBoundsCenter(), mesh->getBoundingRadius());
+        for (uint32_t i = 0; i < batch.instanceCount; i++) {
+            OcclusionCuller::Candidate candidate{};
+            candidate.model = m_buildPacket->instanceScratch[batch.firstInstance + i];
+            candidate.localSphere = localSphere;
+            candidate.batch = glm::uvec4(static_cast<uint32_t>(b), batch.firstInstance, 0, 0);
+            m_cullCandidateScratch.push_back(candidate);
+        }
+    }
+
+    // Near plane drives the "sphere crosses the near plane" early-out; only
+    // perspective cameras expose it, so fall back to a conservative default
+    float nearPlane = 0.1f;
+    if (camera.getType() == CameraType::Perspective) {
+        nearPlane = static_cast<PerspectiveCamera&>(camera).getNearPlane();
+    }
+
+    m_occlusionCuller->prepare(m_currentFrame,
+        m_cullCandidateScratch.data(), static_cast<uint32_t>(m_cullCandidateScratch.size()),
+        m_cullCommandScratch.data(), static_cast<uint32_t>(m_cullCommandScratch.size()),
+        camera.getViewMatrix(), camera.getProjectionMatrix(), nearPlane);
+}
+
+// ============================================================================
+// Multi-threaded Recording
+// ============================================================================
+
+void Renderer::createWorkerResources() {
+    // One worker per hardware thread minus the main thread, clamped to a sane range
+    uint32_t hw = std::thread::hardware_concurrency();
+    m_workerCount = std::clamp(hw > 1 ? hw - 1 : 1u, 1u, 8u);
+
+    m_workerPools = std::make_unique<PerThreadCommandPools>(
+        m_device.getDevice(), m_device.getGraphicsFamily(), m_workerCount);
+
+    m_workerSecondaries.resize(m_workerCount);
+    for (uint32_t w = 0; w < m_workerCount; w++) {
+        auto result = m_workerPools->getPool(w).allocateCommandBuffers(
+            MAX_FRAMES_IN_FLIGHT, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        if (!result.isSuccess()) {
+            throw std::runtime_error("failed to allocate worker secondary command buffers!");
+        }
+        m_workerSecondaries[w] = result.getValue();
+    }
+
+    // Transparent draws keep their back-to-front order in one secondary
+    // recorded on the calling thread, allocated from the main pool.
+    auto result = m_commandPool->allocateCommandBuffers(
+        MAX_FRAMES_IN_FLIGHT, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    if (!result.isSuccess()) {
+        throw std::runtime_error("failed to allocate transparent secondary command buffer!");
+    }
+    m_transparentSecondaries = result.getValue();
+
+    // Depth pre-pass draws must precede every opaque partition, so they get
+    // their own secondary stitched in first.
+    auto prePassResult = m_commandPool->allocateCommandBuffers(
+        MAX_FRAMES_IN_FLIGHT, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    if (!prePassResult.isSuccess()) {
+        throw std::runtime_error("failed to allocate pre-pass secondary command buffer!");
+    }
+    m_prePassSecondaries = prePassResult.getValue();
+
+    LOG_INFO(RENDERING, "Parallel recording initialized: {} worker threads", m_workerCount);
+}
+
+void Renderer::beginSecondary(VkCommandBuffer secondary, uint32_t imageIndex) {
+    VkCommandBufferInheritanceInfo inheritance{};
+    inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritance.renderPass = m_dynamicResolution ? m_scaledRenderPass->get()
+                                                 : m_renderPass->get();
+    inheritance.subpass = 0;
+    inheritance.framebuffer = m_dynamicResolution
+        ? m_scaledFramebuffers[m_renderPacket->frameIndex]
+        : m_swapChainFramebuffers[imageIndex];
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                      VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritance;
+
+    if (vkBeginCommandBuffer(secondary, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin secondary command buffer!");
+    }
+}
+
+void Renderer::applyShadingSpecConstants(PipelineConfig& config) const {
+    config.specDebugMode = static_cast<uint32_t>(m_debugShadingMode);
+    config.specShadowsEnabled = (m_shadowPass != nullptr);
+    config.specMaxLights = MAX_LIGHTS;
+}
+
+void Renderer::prewarmPipelines() {
+    // PipelineManager::getPipeline creates pipelines lazily and is not
+    // synchronized, so make sure every variant used this frame exists in the
+    // cache before worker threads start issuing concurrent lookups.
+    VkExtent2D extent = m_swapChain.extent();
+    auto prewarm = [&](const FrameVector<DrawCall>& drawCalls) {
+        for (const auto& dc : drawCalls) {
+            PipelineConfig config = m_defaultConfig;
+            config.blendMode = dc.blendMode;
+            config.cullMode = dc.cullMode;
+            config.vertexFormat = dc.mesh->getVertexFormat();
+            applyShadingSpecConstants(config);
+            if (dc.blendMode == BlendMode::AlphaBlend) {
+                config.depthWriteEnable = false;
+            }
+            if (m_depthPrePassEnabled && dc.blendMode == BlendMode::Opaque) {
+                config.depthCompareEqual = true;
+                config.depthWriteEnable = false;
+
+                PipelineConfig prePass = m_prePassConfig;
+                prePass.cullMode = dc.cullMode;
+                prePass.vertexFormat = config.vertexFormat;
+                m_pipelineManager.getPipeline(prePass, m_renderPass->get(), extent);
+            }
+            m_pipelineManager.getPipeline(config, m_renderPass->get(), extent);
+        }
+    };
+    prewarm(m_renderPacket->opaqueDrawCalls);
+    prewarm(m_renderPacket->transparentDrawCalls);
+}
+
+void Renderer::prebakeScenePipelines(const SceneNode& subtree) {
+    // Collect the unique variant triples the subtree's draws will request.
+    // Scene sections carry a handful of variants at most, so a linear-scan
+    // dedup beats hashing here.
+    struct VariantKey {
+        BlendMode blendMode;
+        CullMode cullMode;
+        VertexFormat vertexFormat;
+        bool operator==(const VariantKey& o) const {
+            return blendMode == o.blendMode && cullMode == o.cullMode &&
+                   vertexFormat == o.vertexFormat;
+        }
+    };
+    std::vector<VariantKey> variants;
+
+    std::vector<const SceneNode*> stack{&subtree};
+    while (!stack.empty()) {
+        const SceneNode* node = stack.back();
+        stack.pop_back();
+        for (const auto& child : node->getChildren()) {
+            stack.push_back(child.get());
+        }
+
+        auto meshRenderer = node->getComponent<MeshRenderer>();
+        if (!meshRenderer || !meshRenderer->getMesh()) continue;
+
+        // Mirror buildDrawPrototype's material -> variant mapping
+        VariantKey key{BlendMode::Opaque, CullMode::Back,
+                       meshRenderer->getMesh()->getVertexFormat()};
+        if (auto material = meshRenderer->getMaterial()) {
+            switch (material->getAlphaMode()) {
+                case AlphaMode::Opaque: key.blendMode = BlendMode::Opaque; break;
+                case AlphaMode::Mask:   key.blendMode = BlendMode::AlphaMask; break;
+                case AlphaMode::Blend:  key.blendMode = BlendMode::AlphaBlend; break;
+            }
+            if (std::as_const(*material).getFactors().doubleSided) {
+                key.cullMode = CullMode::None;
+            }
+        }
+        if (std::find(variants.begin(), variants.end(), key) == variants.end()) {
+            variants.push_back(key);
+        }
+    }
+    if (variants.empty()) return;
+
+    // Expand each triple into the configs the draw paths derive from it,
+    // exactly as issueDrawCalls/recordDepthPrePass/drawInstancedBatches do
+    std::vector<PipelineConfig> configs;
+    configs.reserve(variants.size() * 3);
+    for (const VariantKey& key : variants) {
+        PipelineConfig config = m_defaultConfig;
+        config.blendMode = key.blendMode;
+        config.cullMode = key.cullMode;
+        config.vertexFormat = key.vertexFormat;
+        applyShadingSpecConstants(config);
+        if (key.blendMode == BlendMode::AlphaBlend) {
+            config.depthWriteEnable = false;
+        }
+        if (m_depthPrePassEnabled && key.blendMode == BlendMode::Opaque) {
+            config.depthCompareEqual = true;
+            config.depthWriteEnable = false;
+
+            PipelineConfig prePass = m_prePassConfig;
+            prePass.cullMode = key.cullMode;
+            prePass.vertexFormat = key.vertexFormat;
+            configs.push_back(prePass);
+        }
+        configs.push_back(config);
+
+        if (m_instancingEnabled) {
+            PipelineConfig instanced = m_instancedConfig;
+            instanced.blendMode = key.blendMode;
+            instanced.cullMode = key.cullMode;
+            instanced.vertexFormat = key.vertexFormat;
+            applyShadingSpecConstants(instanced);
+            configs.push_back(instanced);
+        }
+    }
+
+    LOG_INFO(RENDERING, "Pre-baking {} pipeline variants for loaded subtree ({} material combos)",
+             configs.size(), variants.size());
+    m_pipelineManager.prewarmAsync(std::move(configs), m_renderPass->get(), m_swapChain.extent());
+}
+
+void Renderer::recordSceneParallel(VkCommandBuffer primary, uint32_t imageIndex,
+                                   VkDescriptorSet uboDescriptorSet) {
+    if (!m_workerPools) {
+        createWorkerResources();
+    }
+    prewarmPipelines();
+
+    VkExtent2D extent = m_dynamicResolution ? m_renderPacket->renderExtent
+                                            : m_swapChain.extent();
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
+
+    // Each secondary buffer must re-establish dynamic and descriptor state;
+    // secondaries do not inherit bindings from the primary.
+    auto setupSecondaryState = [&](VkCommandBuffer secondary) {
+        VkViewport viewport{};
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(secondary, 0, 1, &viewport);
+
+        VkRect2D scissor{};
+        scissor.extent = extent;
+        vkCmdSetScissor(secondary, 0, 1, &scissor);
+
+        vkCmdBindDescriptorSets(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS,
+            layout, 0, 1, &uboDescriptorSet, 0, nullptr);
+        bindShadowSet(secondary, layout);
+        if (m_clusteredLighting) {
+            VkDescriptorSet clusterSet = m_clusteredLighting->descriptorSet(m_renderPacket->frameIndex);
+            vkCmdBindDescriptorSets(secondary, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                layout, 3, 1, &clusterSet, 0, nullptr);
+        }
+    };
+
+    // Partition the opaque list evenly across the workers
+    size_t drawCount = m_renderPacket->opaqueDrawCalls.size();
+    uint32_t activeWorkers = static_cast<uint32_t>(
+        std::min<size_t>(m_workerCount, (drawCount + PARALLEL_RECORD_THRESHOLD - 1) / PARALLEL_RECORD_THRESHOLD));
+    activeWorkers = std::max(activeWorkers, 1u);
+    size_t perWorker = (drawCount + activeWorkers - 1) / activeWorkers;
+
+    std::vector<std::thread> threads;
+    threads.reserve(activeWorkers);
+    for (uint32_t w = 0; w < activeWorkers; w++) {
+        size_t begin = w * perWorker;
+        size_t count = std::min(perWorker, drawCount - std::min(begin, drawCount));
+        VkCommandBuffer secondary = m_workerSecondaries[w][m_renderPacket->frameIndex];
+
+        threads.emplace_back([this, secondary, imageIndex, begin, count, &setupSecondaryState]() {
+            vkResetCommandBuffer(secondary, 0);
+            beginSecondary(secondary, imageIndex);
+            setupSecondaryState(secondary);
+            RecordState state{};
+            recordDrawRange(secondary, m_renderPacket->opaqueDrawCalls.data() + begin, count, state);
+            if (vkEndCommandBuffer(secondary) != VK_SUCCESS) {
+                LOG_ERROR(RENDERING, "Failed to end worker secondary command buffer");
+            }
+        });
+    }
+
+    // Depth pre-pass goes into its own secondary, executed before the opaque
+    // partitions (rasterization follows submission order within the pass)
+    VkCommandBuffer prePassSecondary = VK_NULL_HANDLE;
+    if (m_depthPrePassEnabled) {
+        prePassSecondary = m_prePassSecondaries[m_renderPacket->frameIndex];
+        vkResetCommandBuffer(prePassSecondary, 0);
+        beginSecondary(prePassSecondary, imageIndex);
+        setupSecondaryState(prePassSecondary);
+        recordDepthPrePass(prePassSecondary);
+        if (vkEndCommandBuffer(prePassSecondary) != VK_SUCCESS) {
+            throw std::runtime_error("failed to end pre-pass secondary command buffer!");
+        }
+    }
+
+    // Transparent draws are order-dependent; record them on this thread while
+    // the workers chew through the opaque list.
+    VkCommandBuffer transparentSecondary = m_transparentSecondaries[m_renderPacket->frameIndex];
+    vkResetCommandBuffer(transparentSecondary, 0);
+    beginSecondary(transparentSecondary, imageIndex);
+    setupSecondaryState(transparentSecondary);
+    recordInstancedBatches(transparentSecondary);
+    RecordState state{};
+    recordDrawRange(transparentSecondary, m_renderPacket->transparentDrawCalls.data(),
+                    m_renderPacket->transparentDrawCalls.size(), state);
+    if (vkEndCommandBuffer(transparentSecondary) != VK_SUCCESS) {
+        throw std::runtime_error("failed to end transparent secondary command buffer!");
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // Stitch: pre-pass first, opaque secondaries in partition order, then transparent
+    std::vector<VkCommandBuffer> executeList;
+    executeList.reserve(activeWorkers + 2);
+    if (prePassSecondary != VK_NULL_HANDLE) {
+        executeList.push_back(prePassSecondary);
+    }
+    for (uint32_t w = 0; w < activeWorkers; w++) {
+        executeList.push_back(m_workerSecondaries[w][m_renderPacket->frameIndex]);
+    }
+    executeList.push_back(transparentSecondary);
+
+    vkCmdExecuteCommands(primary, static_cast<uint32_t>(executeList.size()), executeList.data());
+}
+
+// Legacy renderNode for backward compatibility (superseded by the retained draw list)
+void Renderer::renderNode(VkCommandBuffer /*commandBuffer*/, const SceneNode& /*node*/) {
+    // No longer used — draw calls come from collectRetainedDraws() and are issued via issueDrawCalls()
+}
+
+
+void Renderer::collectLights(const SceneNode& root, FrameVector<GpuLight>& outLights) {
+    // The UBO path caps at MAX_LIGHTS; clustered lighting feeds a storage
+    // buffer and can take the whole venue
+    const size_t lightCap = m_clusteredLighting ? ClusteredLighting::kMaxLights : MAX_LIGHTS;
+    (void)root;  // Lights live in the global pool; kept for signature stability
+
+    // Change detection: lights change rarely, so the expensive per-light
+    // math (matrix decompose, quaternion rotate, cone cosines) shouldn't
+    // run per frame. The stamp folds the global light revision (bumped by
+    // every property edit, attach, and detach) with each light's
+    // enabled/active state and its owner's world-transform version —
+    // order-dependently, so swaps don't cancel out. If it matches, the
+    // cached gather is still exact.
+    uint64_t stamp = Light::getGlobalRevision();
+    ComponentPools::get().forEachComponent<Light>([&](Light& light) {
+        SceneNode* owner = light.getOwner();
+        const bool active = light.isEnabled() && owner && owner->isActiveInHierarchy();
+        stamp = stamp * 1099511628211ull ^ (active ? 1u : 0u);
+        if (active) {
+            stamp ^= owner->getWorldTransformVersion();
+        }
+    });
+
+    if (m_lightCacheValid && stamp == m_lightGatherStamp) {
+        for (const GpuLight& gpu : m_cachedLights) {
+            outLights.push_back(gpu);
+        }
+        return;
+    }
+
+    // Packed scan over the Light pool replaces the per-frame graph walk:
+    // a handful of contiguous slots instead of a map lookup at every node
+    m_cachedLights.clear();
+    ComponentPools::get().forEachComponent<Light>([&](Light& light) {
+        if (m_cachedLights.size() >= lightCap) return;
+        if (!light.isEnabled()) return;
+        SceneNode* owner = light.getOwner();
+        if (!owner || !owner->isActiveInHierarchy()) return;
+
+        GpuLight gpu{};
+
+        glm::vec3 worldPos = owner->getWorldPosition();
+        glm::quat worldRot = owner->getWorldRotation();
+        // Forward vector is local -Z rotated by world rotation
+        glm::vec3 forward = glm::normalize(worldRot * glm::vec3(0.0f, 0.0f, -1.0f));
+
+        gpu.positionAndType = glm::vec4(worldPos, static_cast<float>(light.getType()));
+        gpu.directionAndRange = glm::vec4(forward, light.getRange());
+        gpu.colorAndIntensity = glm::vec4(light.getColor(), light.getIntensity());
+
+        if (light.getType() == LightType::Spot) {
+            gpu.spotParams = glm::vec4(
+                std::cos(light.getInnerConeAngle()),
+                std::cos(light.getOuterConeAngle()),
+                0.0f, 0.0f);
+        }
+
+        m_cachedLights.push_back(gpu);
+    });
+    m_lightGatherStamp = stamp;
+    m_lightCacheValid = true;
+
+    for (const GpuLight& gpu : m_cachedLights) {
+        outLights.push_back(gpu);
+    }
+}
+
+void Renderer::createFramebuffers() {
+    VkExtent2D extent = m_swapChain.extent();
+    LOG_INFO(VULKAN, "Creating {} framebuffers at {}x{}", 
+              m_swapChain.imageViews().size(), extent.width, extent.height);
+    
+    m_swapChainFramebuffers.resize(m_swapChain.imageViews().size());
+    for (size_t i = 0; i < m_swapChain.imageViews().size(); i++) {
+        std::array<VkImageView, 2> attachments = {
+            m_swapChain.imageViews()[i],
+            m_swapChain.depthImageView()
+        };
+
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_renderPass->get();
+        framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+        framebufferInfo.pAttachments = attachments.data();
+        framebufferInfo.width = extent.width;
+        framebufferInfo.height = extent.height;
+        framebufferInfo.layers = 1;
+        if (vkCreateFramebuffer(m_device.getDevice(), &framebufferInfo, nullptr, &m_swapChainFramebuffers[i]) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create framebuffer!");
+        }
+    }
+}
+
+// ============================================================================
+// Dynamic Resolution Scaling
+// ============================================================================
+
+void Renderer::enableDynamicResolution(std::shared_ptr<MemoryManager> memoryManager,
+                                       float minScale, float targetGpuMs) {
+    m_memoryManager = std::move(memoryManager);
+    m_minRenderScale = std::clamp(minScale, 0.25f, 1.0f);
+    m_targetGpuMs = targetGpuMs;
+    m_dynamicResolution = true;
+    createScaledTargets();
+    LOG_INFO(RENDERING, "Dynamic resolution enabled: scale {}..1.0, target {} ms GPU",
+             m_minRenderScale, m_targetGpuMs);
+}
+
+void Renderer::createScaledTargets() {
+    VkExtent2D extent = m_swapChain.extent();
+
+    // Same formats as the swapchain path so every pipeline stays compatible;
+    // only the color attachment's final layout differs (blit source)
+    if (!m_scaledRenderPass) {
+        m_scaledRenderPass = std::make_unique<RenderPass>(
+            m_device.getDevice(), m_swapChain.imageFormat(), m_swapChain.depthFormat(),
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    }
+
+    // One color target per frame in flight: frame N's blit still reads its
+    // image while frame N+1 starts clearing the other. Depth is shared,
+    // matching how the swapchain's depth buffer is shared across frames.
+    for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        auto result = m_memoryManager->createImage(
+            extent.width, extent.height, m_swapChain.imageFormat(),
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+        if (!result) {
+            throw std::runtime_error("Failed to create dynamic resolution color target: " +
+                                     result.getError().message);
+        }
+        m_scaledColorImages.push_back(result.getValue());
+    }
+
+    auto depthResult = m_memoryManager->createDepthBuffer(
+        extent.width, extent.height, m_swapChain.depthFormat());
+    if (!depthResult) {
+        throw std::runtime_error("Failed to create dynamic resolution depth target: " +
+                                 depthResult.getError().message);
+    }
+    m_scaledDepthImage = depthResult.getValue();
+
+    m_scaledFramebuffers.resize(MAX_FRAMES_IN_FLIGHT);
+    for (uint32_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        std::array<VkImageView, 2> attachments = {
+            m_scaledColorImages[i]->getImageView(),
+            m_scaledDepthImage->getImageView()
+        };
+
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_scaledRenderPass->get();
+        framebufferInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+        framebufferInfo.pAttachments = attachments.data();
+        framebufferInfo.width = extent.width;
+        framebufferInfo.height = extent.height;
+        framebufferInfo.layers = 1;
+        if (vkCreateFramebuffer(m_device.getDevice(), &framebufferInfo, nullptr,
+                                &m_scaledFramebuffers[i]) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create dynamic resolution framebuffer!");
+        }
+    }
+}
+
+void Renderer::destroyScaledTargets() {
+    for (auto framebuffer : m_scaledFramebuffers) {
+        vkDestroyFramebuffer(m_device.getDevice(), framebuffer, nullptr);
+    }
+    m_scaledFramebuffers.clear();
+    m_scaledColorImages.clear();
+    m_scaledDepthImage.reset();
+    // The render pass is extent-independent and kept for recreation
+}
+
+void Renderer::updateRenderScale() {
+    // Total GPU time across all resolved scopes (shadow + main + upscale).
+    // The readings lag by the frames-in-flight count, which is fine for a
+    // controller that steps at most every RENDER_SCALE_HOLD_FRAMES frames.
+    double gpuMs = 0.0;
+    for (const auto& timing : GpuProfiler::get().getTimings()) {
+        gpuMs += timing.milliseconds;
+    }
+    if (gpuMs <= 0.0) {
+        return; // No timestamp support or nothing resolved yet
+    }
+
+    m_smoothedGpuMs = (m_smoothedGpuMs == 0.0f)
+        ? static_cast<float>(gpuMs)
+        : m_smoothedGpuMs + GPU_MS_EMA_WEIGHT * (static_cast<float>(gpuMs) - m_smoothedGpuMs);
+
+    if (m_scaleHoldFrames > 0) {
+        m_scaleHoldFrames--;
+        return;
+    }
+
+    float scale = m_renderScale;
+    if (m_smoothedGpuMs > m_targetGpuMs) {
+        scale -= RENDER_SCALE_STEP;
+    } else if (m_smoothedGpuMs < m_targetGpuMs * SCALE_UP_HEADROOM) {
+        scale += RENDER_SCALE_STEP;
+    }
+    scale = std::clamp(scale, m_minRenderScale, 1.0f);
+
+    if (scale != m_renderScale) {
+        LOG_DEBUG(RENDERING, "Render scale {} -> {} (GPU {} ms, target {} ms)",
+                  m_renderScale, scale, m_smoothedGpuMs, m_targetGpuMs);
+        m_renderScale = scale;
+        m_scaleHoldFrames = RENDER_SCALE_HOLD_FRAMES;
+    }
+}
+
+VkExtent2D Renderer::scaledExtent() const {
+    VkExtent2D extent = m_swapChain.extent();
+    if (m_renderScale >= 1.0f) {
+        return extent;
+    }
+    // Align down to even pixels so the 2:1 sampling patterns of the linear
+    // upscale stay stable; never below 2x2
+    auto scaleDim = [this](uint32_t dim) {
+        uint32_t scaled = static_cast<uint32_t>(static_cast<float>(dim) * m_renderScale) & ~1u;
+        return std::max(scaled, 2u);
+    };
+    return {scaleDim(extent.width), scaleDim(extent.height)};
+}
+
+void Renderer::createCommandBuffers() {
+    m_frames.resize(MAX_FRAMES_IN_FLIGHT);
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = m_commandPool->getPool();
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = 1;
+
+    for (size_t i = 0; i < m_frames.size(); i++) {
+        if (vkAllocateCommandBuffers(m_device.getDevice(), &allocInfo, &m_frames[i].commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate command buffers!");
+        }
+    }
+}
+
+void Renderer::createSyncObjects() {
+    // The frame timeline replaces per-frame fences: each submit signals the
+    // next value and the CPU waits on exact values, so nothing is ever
+    // reset. The swapchain's acquire/present semaphores stay binary — WSI
+    // does not accept timeline semaphores.
+    if (m_device.supportsTimelineSemaphores()) {
+        auto timelineResult = TimelineSemaphore::create(m_device.getDevice());
+        if (timelineResult.isSuccess()) {
+            m_frameTimeline = timelineResult.getValue();
+            LOG_INFO(VULKAN, "Frame synchronization using timeline semaphore");
+        } else {
+            LOG_WARN(VULKAN, "Failed to create frame timeline semaphore, falling back to fences: {}",
+                     timelineResult.getError().message);
+        }
+    }
+
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+    for (size_t i = 0; i < m_frames.size(); i++) {
+        if (vkCreateSemaphore(m_device.getDevice(), &semaphoreInfo, nullptr, &m_frames[i].imageAvailableSemaphore) != VK_SUCCESS ||
+            vkCreateSemaphore(m_device.getDevice(), &semaphoreInfo, nullptr, &m_frames[i].renderFinishedSemaphore) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create synchronization objects for a frame!");
+        }
+        if (!m_frameTimeline &&
+            vkCreateFence(m_device.getDevice(), &fenceInfo, nullptr, &m_frames[i].inFlightFence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create synchronization objects for a frame!");
+        }
+    }
+}
+
+void Renderer::drainPreAcquiredImage() {
+    if (!m_hasPreAcquiredImage) {
+        return;
+    }
+    m_hasPreAcquiredImage = false;
+
+    // Empty submission waiting the signaled semaphore unsignals it; the
+    // caller has already drained our frames, so the brief queue wait that
+    // makes the unsignal observable costs nothing extra here
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount = 1;
+    submitInfo.pWaitSemaphores = &m_frames[m_preAcquiredSlot].imageAvailableSemaphore;
+    submitInfo.pWaitDstStageMask = &waitStage;
+    if (vkQueueSubmit(m_device.getGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS ||
+        vkQueueWaitIdle(m_device.getGraphicsQueue()) != VK_SUCCESS) {
+        LOG_WARN(VULKAN, "Failed to drain pre-acquired swapchain image before recreation");
+    }
+}
+
+void Renderer::recreateSwapChain(Camera& camera) {
+    int width = 0, height = 0;
+    m_window->getFramebufferSize(width, height);
+    while (width == 0 || height == 0) {
+        m_window->getFramebufferSize(width, height);
+        m_window->waitEvents();
+    }
+
+    // Wait for our own in-flight frames only: unlike vkDeviceWaitIdle this
+    // leaves the transfer queue (and any async uploads) running, so a
+    // resize or display-mode toggle costs a frame drain, not a device
+    // stall. The old swapchain itself is retired below and destroyed once
+    // pending presents have cycled out.
+    for (auto& frame : m_frames) {
+        if (m_frameTimeline) {
+            if (frame.timelineValue != 0) {
+                m_frameTimeline->wait(frame.timelineValue);
+            }
+        } else if (frame.inFlightFence != VK_NULL_HANDLE) {
+            vkWaitForFences(m_device.getDevice(), 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+        }
+    }
+
+    // An acquire-ahead against the old swapchain left its slot's semaphore
+    // signaled; consume it so the semaphore is clean for the new one
+    drainPreAcquiredImage();
+    m_prevPresentId = 0;
+
+    // All our frames have retired, so everything in the deletion queue is
+    // safe to run before the swapchain-dependent resources are rebuilt.
+    DeletionQueue::get().flushAll();
+
+    for (auto framebuffer : m_swapChainFramebuffers) {
+        vkDestroyFramebuffer(m_device.getDevice(), framebuffer, nullptr);
+    }
+    destroyScaledTargets();
+
+    m_swapChain.recreate(width, height);
+
+    // The replaced swapchain (and its views) stay alive until every frame
+    // that could reference the old images has presented and retired
+    if (m_swapChain.hasRetired()) {
+        m_retiredSwapchainFrames = MAX_FRAMES_IN_FLIGHT;
+    }
+
+    // Get the actual extent from swapchain (this is the source of truth)
+    VkExtent2D extent = m_swapChain.extent();
+    LOG_INFO(VULKAN, "SwapChain recreated: {}x{} (requested {}x{})", 
+             extent.width, extent.height, width, height);
 
     if (m_recreateCallback) {
         m_recreateCallback(extent.width, extent.height);
@@ -563,114 +2511,339 @@ void Renderer::recreateSwapChain(Camera& camera) {
         LOG_INFO(VULKAN, "Camera aspect ratio updated: {}", aspectRatio);
     }
 
-    // Re-create framebuffers
+    // Re-create framebuffers (and the internal scaled targets, which track
+    // the swapchain extent)
     createFramebuffers();
+    if (m_dynamicResolution) {
+        createScaledTargets();
+    }
+
+    // Depth pyramid must match the new depth buffer extent (our graphics
+    // frames have drained above, so its old images are unreferenced)
+    if (m_occlusionCuller) {
+        m_occlusionCuller->resize(extent.width, extent.height);
+    }
 }
 
 // ============================================================================
 // Shadow Mapping
 // ============================================================================
 
-glm::mat4 Renderer::computeLightSpaceMatrix(const SceneNode& root) const {
+void Renderer::computeShadowCascades(const SceneNode& root, Camera& camera) {
     // Find the first directional light in the scene
     glm::vec3 lightDir(0.0f, -1.0f, 0.0f); // Default: straight down
     bool found = false;
 
-    std::function<void(const SceneNode&)> findDirLight = [&](const SceneNode& node) {
-        if (found || !node.isActive()) return;
-        auto light = node.getComponent<Light>();
-        if (light && light->isEnabled() && light->getType() == LightType::Directional) {
-            glm::quat worldRot = node.getWorldRotation();
-            lightDir = glm::normalize(worldRot * glm::vec3(0.0f, 0.0f, -1.0f));
-            found = true;
-            return;
-        }
-        for (const auto& child : node.getChildren()) {
-            findDirLight(*child);
-        }
-    };
-    findDirLight(root);
+    (void)root;
+    // Packed scan over the Light pool — typically a single cache line of
+    // candidates instead of a full graph traversal
+    ComponentPools::get().forEachComponent<Light>([&](Light& light) {
+        if (found || !light.isEnabled() || light.getType() != LightType::Directional) return;
+        SceneNode* owner = light.getOwner();
+        if (!owner || !owner->isActiveInHierarchy()) return;
+        glm::quat worldRot = owner->getWorldRotation();
+        lightDir = glm::normalize(worldRot * glm::vec3(0.0f, 0.0f, -1.0f));
+        found = true;
+    });
 
-    // Orthographic projection from light direction
-    // Scene-fitting: use a fixed bounding box for now (covers typical scenes)
-    constexpr float orthoSize = 20.0f;
-    constexpr float nearPlane = -30.0f;
-    constexpr float farPlane  =  30.0f;
+    // Shared light view: rotation-only basis looking along the light. Each
+    // cascade supplies its own ortho projection fitted in this space, so the
+    // CPU caster culling can reuse one world-to-light transform.
+    // Handle degenerate case: light pointing straight down/up
+    glm::vec3 up = (std::abs(glm::dot(lightDir, glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f)
+        ? glm::vec3(0.0f, 0.0f, 1.0f)
+        : glm::vec3(0.0f, 1.0f, 0.0f);
+    m_buildPacket->lightViewMatrix = glm::lookAt(-lightDir, glm::vec3(0.0f), up);
 
-    glm::mat4 lightView = glm::lookAt(
-        -lightDir * 15.0f,   // Eye: offset along opposite of light direction
-        glm::vec3(0.0f),     // Center: scene origin
-        glm::vec3(0.0f, 1.0f, 0.0f)
-    );
+    float nearPlane = 0.1f;
+    float farPlane = 1000.0f;
+    if (camera.getType() == CameraType::Perspective) {
+        auto& perspectiveCamera = static_cast<PerspectiveCamera&>(camera);
+        nearPlane = perspectiveCamera.getNearPlane();
+        farPlane = perspectiveCamera.getFarPlane();
+    }
 
-    // Handle degenerate case: light pointing straight down/up
-    if (std::abs(glm::dot(lightDir, glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f) {
-        lightView = glm::lookAt(
-            -lightDir * 15.0f,
-            glm::vec3(0.0f),
-            glm::vec3(0.0f, 0.0f, 1.0f)
-        );
+    // Shadows only cover the near portion of the view range; past this the
+    // cascades would be too coarse to matter
+    constexpr float kShadowDistance = 100.0f;
+    // Pull each cascade's near plane back toward the light so off-screen
+    // geometry between the light and the frustum slice still casts
+    constexpr float kCasterMargin = 40.0f;
+    // Blend between uniform and logarithmic split schemes (practical split)
+    constexpr float kSplitLambda = 0.75f;
+
+    const float shadowFar = std::min(farPlane, kShadowDistance);
+    std::array<float, ShadowPass::CASCADE_COUNT + 1> splits{};
+    splits[0] = nearPlane;
+    for (uint32_t i = 1; i <= ShadowPass::CASCADE_COUNT; i++) {
+        float f = static_cast<float>(i) / static_cast<float>(ShadowPass::CASCADE_COUNT);
+        float logSplit = nearPlane * std::pow(shadowFar / nearPlane, f);
+        float uniSplit = nearPlane + (shadowFar - nearPlane) * f;
+        splits[i] = glm::mix(uniSplit, logSplit, kSplitLambda);
     }
 
-    glm::mat4 lightProj = glm::ortho(-orthoSize, orthoSize, -orthoSize, orthoSize, nearPlane, farPlane);
+    // NDC depth of a view-space distance (handles any projection convention)
+    const glm::mat4 proj = camera.getProjectionMatrix();
+    const glm::mat4 invViewProj = glm::inverse(proj * camera.getViewMatrix());
+    auto ndcDepth = [&proj](float viewDistance) {
+        glm::vec4 clip = proj * glm::vec4(0.0f, 0.0f, -viewDistance, 1.0f);
+        return clip.z / clip.w;
+    };
 
-    return lightProj * lightView;
+    for (uint32_t c = 0; c < ShadowPass::CASCADE_COUNT; c++) {
+        // World-space corners of this frustum slice
+        const float z0 = ndcDepth(splits[c]);
+        const float z1 = ndcDepth(splits[c + 1]);
+        std::array<glm::vec3, 8> corners;
+        size_t corner = 0;
+        for (float x : {-1.0f, 1.0f}) {
+            for (float y : {-1.0f, 1.0f}) {
+                for (float z : {z0, z1}) {
+                    glm::vec4 world = invViewProj * glm::vec4(x, y, z, 1.0f);
+                    corners[corner++] = glm::vec3(world) / world.w;
+                }
+            }
+        }
+
+        // Bounding sphere of the slice: a rotation-invariant fit, so the ortho
+        // extent stays constant while the camera turns
+        glm::vec3 center(0.0f);
+        for (const auto& p : corners) center += p;
+        center /= 8.0f;
+        float radius = 0.0f;
+        for (const auto& p : corners) radius = std::max(radius, glm::length(p - center));
+
+        // Snap the ortho window to texel increments in light space: the
+        // cascade matrix then only changes when the camera crosses a texel
+        // boundary, which kills shimmer and keeps the static shadow cache warm
+        glm::vec3 centerLS = glm::vec3(m_buildPacket->lightViewMatrix * glm::vec4(center, 1.0f));
+        const float texelSize = (2.0f * radius) / static_cast<float>(ShadowPass::SHADOW_MAP_SIZE);
+        centerLS.x = std::floor(centerLS.x / texelSize) * texelSize;
+        centerLS.y = std::floor(centerLS.y / texelSize) * texelSize;
+
+        ShadowCascade& cascade = m_buildPacket->cascades[c];
+        cascade.boundsMin = glm::vec3(centerLS.x - radius, centerLS.y - radius, centerLS.z - radius);
+        cascade.boundsMax = glm::vec3(centerLS.x + radius, centerLS.y + radius, centerLS.z + radius + kCasterMargin);
+        cascade.splitFar = splits[c + 1];
+        // Light view looks down -z: near/far map to -maxZ/-minZ
+        cascade.viewProj = glm::ortho(
+            cascade.boundsMin.x, cascade.boundsMax.x,
+            cascade.boundsMin.y, cascade.boundsMax.y,
+            -cascade.boundsMax.z, -cascade.boundsMin.z) * m_buildPacket->lightViewMatrix;
+    }
 }
 
 void Renderer::recordShadowPass(VkCommandBuffer commandBuffer, VkDescriptorSet uboDescriptorSet) {
     VkExtent2D shadowExtent = m_shadowPass->getExtent();
+    VkPipelineLayout layout = m_pipelineManager.getLayout();
 
-    VkRenderPassBeginInfo rpInfo{};
-    rpInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    rpInfo.renderPass = m_shadowPass->getRenderPass();
-    rpInfo.framebuffer = m_shadowPass->getFramebuffer();
-    rpInfo.renderArea.offset = {0, 0};
-    rpInfo.renderArea.extent = shadowExtent;
-
-    VkClearValue depthClear{};
-    depthClear.depthStencil = {1.0f, 0};
-    rpInfo.clearValueCount = 1;
-    rpInfo.pClearValues = &depthClear;
-
-    vkCmdBeginRenderPass(commandBuffer, &rpInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-    // Set viewport and scissor to shadow map dimensions
-    VkViewport viewport{};
-    viewport.x = 0.0f;
-    viewport.y = 0.0f;
-    viewport.width = static_cast<float>(shadowExtent.width);
-    viewport.height = static_cast<float>(shadowExtent.height);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
-
-    VkRect2D scissor{};
-    scissor.offset = {0, 0};
-    scissor.extent = shadowExtent;
-    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
-
-    // Get shadow pipeline (depth-only, front-face culling to reduce peter-panning)
-    auto shadowPipeline = m_pipelineManager.getPipeline(
-        m_shadowConfig, m_shadowPass->getRenderPass(), shadowExtent);
-    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, shadowPipeline->getPipeline());
+    // Hash the cascade matrices and static caster set (mesh identity +
+    // transform bits, FNV-1a). Any change — a cascade shifting to a new texel
+    // window, an added/removed caster, or a moved "static" node — forces a
+    // re-render of the cached static layers.
+    constexpr size_t kFnvPrime = 1099511628211ull;
+    size_t staticHash = 14695981039346656037ull;
+    auto hashBytes = [&](const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            staticHash = (staticHash ^ bytes[i]) * kFnvPrime;
+        }
+    };
 
-    VkPipelineLayout layout = m_pipelineManager.getLayout();
+    for (const auto& cascade : m_renderPacket->cascades) {
+        hashBytes(&cascade.viewProj, sizeof(glm::mat4));
+    }
 
-    // Bind UBO descriptor set (set 0) — shadow.vert reads lightSpaceMatrix from here
-    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
-        layout, 0, 1, &uboDescriptorSet, 0, nullptr);
+    bool hasStaticCasters = false;
+    for (const auto& dc : m_renderPacket->opaqueDrawCalls) {
+        if (!dc.isStatic) continue;
+        hasStaticCasters = true;
+        const Mesh* mesh = dc.mesh.get();
+        hashBytes(&mesh, sizeof(mesh));
+        hashBytes(&dc.pushConstants.modelMatrix, sizeof(glm::mat4));
+    }
+    for (const auto& batch : m_renderPacket->instanceBatches) {
+        if (!batch.allStatic) continue;
+        hasStaticCasters = true;
+        const Mesh* mesh = batch.prototype.mesh.get();
+        hashBytes(&mesh, sizeof(mesh));
+        for (uint32_t i = 0; i < batch.instanceCount; i++) {
+            hashBytes(&m_renderPacket->instanceScratch[batch.firstInstance + i], sizeof(glm::mat4));
+        }
+    }
 
-    // Issue opaque draw calls only (transparent objects don't cast shadows)
-    for (const auto& dc : m_opaqueDrawCalls) {
-        vkCmdPushConstants(commandBuffer, layout,
-            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-            0, sizeof(MeshPushConstants), &dc.pushConstants);
+    auto beginPass = [&](VkRenderPass renderPass, VkFramebuffer framebuffer, bool clear) {
+        VkRenderPassBeginInfo rpInfo{};
+        rpInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        rpInfo.renderPass = renderPass;
+        rpInfo.framebuffer = framebuffer;
+        rpInfo.renderArea.offset = {0, 0};
+        rpInfo.renderArea.extent = shadowExtent;
+
+        VkClearValue depthClear{};
+        depthClear.depthStencil = {1.0f, 0};
+        if (clear) {
+            rpInfo.clearValueCount = 1;
+            rpInfo.pClearValues = &depthClear;
+        }
 
-        dc.mesh->bind(commandBuffer);
-        vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(), 1, 0, 0, 0);
+        vkCmdBeginRenderPass(commandBuffer, &rpInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+        // Set viewport and scissor to shadow map dimensions
+        VkViewport viewport{};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = static_cast<float>(shadowExtent.width);
+        viewport.height = static_cast<float>(shadowExtent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+        VkRect2D scissor{};
+        scissor.offset = {0, 0};
+        scissor.extent = shadowExtent;
+        vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+        // Get shadow pipeline (depth-only, front-face culling to reduce
+        // peter-panning). The clear and load passes are render-pass
+        // compatible (load ops are ignored), so the same pipeline works
+        // with both.
+        auto shadowPipeline = m_pipelineManager.getPipeline(
+            m_shadowConfig, m_shadowPass->getRenderPass(), shadowExtent);
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, shadowPipeline->getPipeline());
+
+        // Bind UBO descriptor set (set 0) for pipeline layout compatibility
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+            layout, 0, 1, &uboDescriptorSet, 0, nullptr);
+    };
+
+    // Per-cascade caster culling: world-space bounding sphere against the
+    // cascade's ortho window in light view space
+    auto castsIntoCascade = [&](const Mesh& mesh, const glm::mat4& model, const ShadowCascade& cascade) {
+        glm::vec3 center = glm::vec3(m_renderPacket->lightViewMatrix * model * glm::vec4(mesh.getBoundsCenter(), 1.0f));
+        float scale = std::sqrt(std::max({
+            glm::dot(glm::vec3(model[0]), glm::vec3(model[0])),
+            glm::dot(glm::vec3(model[1]), glm::vec3(model[1])),
+            glm::dot(glm::vec3(model[2]), glm::vec3(model[2]))}));
+        float radius = mesh.getBoundingRadius() * scale;
+        return center.x + radius >= cascade.boundsMin.x && center.x - radius <= cascade.boundsMax.x
+            && center.y + radius >= cascade.boundsMin.y && center.y - radius <= cascade.boundsMax.y
+            && center.z + radius >= cascade.boundsMin.z && center.z - radius <= cascade.boundsMax.z;
+    };
+
+    // Per-draw culling for the multiview path: one recording covers every
+    // cascade, so a caster survives if it falls into any cascade window
+    auto castsIntoAnyCascade = [&](const Mesh& mesh, const glm::mat4& model) {
+        for (const auto& cascade : m_renderPacket->cascades) {
+            if (castsIntoCascade(mesh, model, cascade)) return true;
+        }
+        return false;
+    };
+
+    // Issue opaque draw calls only (transparent objects don't cast shadows).
+    // Instanced batches still cast shadows: the shadow shader is not
+    // instanced, so expand each batch into per-instance push-constant draws.
+    // shadow.vert consumes modelMatrix as a full light-space MVP, so the
+    // cascade matrix is pre-multiplied here instead of read from the UBO.
+    // With a null cascade (multiview) the plain model matrix is pushed and
+    // shadow_multiview.vert applies ubo.lightSpaceMatrices[gl_ViewIndex].
+    auto drawCasters = [&](bool wantStatic, const ShadowCascade* cascade) {
+        // beginPass bound the default (fat-format) shadow pipeline; switch
+        // to the matching vertex-format variant when a compact mesh draws
+        VertexFormat boundFormat = m_shadowConfig.vertexFormat;
+        auto bindForFormat = [&](VertexFormat format) {
+            if (format == boundFormat) return;
+            PipelineConfig config = m_shadowConfig;
+            config.vertexFormat = format;
+            auto pipeline = m_pipelineManager.getPipeline(
+                config, m_shadowPass->getRenderPass(), shadowExtent);
+            vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->getPipeline());
+            boundFormat = format;
+        };
+
+        for (const auto& dc : m_renderPacket->opaqueDrawCalls) {
+            if (dc.isStatic != wantStatic) continue;
+            if (cascade ? !castsIntoCascade(*dc.mesh, dc.pushConstants.modelMatrix, *cascade)
+                        : !castsIntoAnyCascade(*dc.mesh, dc.pushConstants.modelMatrix)) continue;
+
+            bindForFormat(dc.mesh->getVertexFormat());
+            MeshPushConstants push = dc.pushConstants;
+            if (cascade) {
+                push.modelMatrix = cascade->viewProj * dc.pushConstants.modelMatrix;
+            }
+            vkCmdPushConstants(commandBuffer, layout,
+                VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                0, sizeof(MeshPushConstants), &push);
+
+            dc.mesh->bind(commandBuffer);
+            vkCmdDrawIndexed(commandBuffer, dc.mesh->getIndexCount(), 1, 0, 0, 0);
+        }
+
+        for (const auto& batch : m_renderPacket->instanceBatches) {
+            if (batch.allStatic != wantStatic) continue;
+            bindForFormat(batch.prototype.mesh->getVertexFormat());
+            MeshPushConstants push = batch.prototype.pushConstants;
+            batch.prototype.mesh->bind(commandBuffer);
+            for (uint32_t i = 0; i < batch.instanceCount; i++) {
+                const glm::mat4& model = m_renderPacket->instanceScratch[batch.firstInstance + i];
+                if (cascade ? !castsIntoCascade(*batch.prototype.mesh, model, *cascade)
+                            : !castsIntoAnyCascade(*batch.prototype.mesh, model)) continue;
+
+                push.modelMatrix = cascade ? cascade->viewProj * model : model;
+                vkCmdPushConstants(commandBuffer, layout,
+                    VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                    0, sizeof(MeshPushConstants), &push);
+                vkCmdDrawIndexed(commandBuffer, batch.prototype.mesh->getIndexCount(), 1, 0, 0, 0);
+            }
+        }
+    };
+
+    // Multiview collapses the per-cascade loops: one pass instance writes
+    // every cascade layer, so casters are recorded and vertex-fetched once
+    // and record cost stays flat as the view count grows
+    const bool multiview = m_shadowPass->isMultiview();
+    auto renderCasters = [&](VkRenderPass renderPass, bool staticTarget, bool clear) {
+        if (multiview) {
+            VkFramebuffer framebuffer = staticTarget
+                ? m_shadowPass->getStaticLayeredFramebuffer()
+                : m_shadowPass->getLayeredFramebuffer();
+            beginPass(renderPass, framebuffer, clear);
+            drawCasters(staticTarget, nullptr);
+            vkCmdEndRenderPass(commandBuffer);
+            return;
+        }
+        for (uint32_t c = 0; c < ShadowPass::CASCADE_COUNT; c++) {
+            VkFramebuffer framebuffer = staticTarget
+                ? m_shadowPass->getStaticFramebuffer(c)
+                : m_shadowPass->getFramebuffer(c);
+            beginPass(renderPass, framebuffer, clear);
+            drawCasters(staticTarget, &m_renderPacket->cascades[c]);
+            vkCmdEndRenderPass(commandBuffer);
+        }
+    };
+
+    if (!hasStaticCasters) {
+        // Nothing to cache — render every cascade into the shadow map directly
+        m_staticShadowValid = false;
+        renderCasters(m_shadowPass->getRenderPass(), false, true);
+        return;
     }
 
-    vkCmdEndRenderPass(commandBuffer);
+    bool staticStale = !m_staticShadowValid || m_staticShadowHash != staticHash;
+
+    if (staticStale) {
+        renderCasters(m_shadowPass->getRenderPass(), true, true);
+
+        m_staticShadowValid = true;
+        m_staticShadowHash = staticHash;
+        LOG_DEBUG(RENDERING, "Static shadow layers re-rendered (hash={})", staticHash);
+    }
+
+    // Composite: copy the cached static depth in, then draw only the dynamic
+    // casters on top through the LOAD render pass
+    m_shadowPass->recordStaticLayerCopy(commandBuffer, staticStale);
+
+    renderCasters(m_shadowPass->getLoadRenderPass(), false, false);
 }
 
 } // namespace vkeng
\ No newline at end of file
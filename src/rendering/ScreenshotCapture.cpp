@@ -0,0 +1,420 @@
+#include "vulkan-engine/rendering/ScreenshotCapture.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+    // ============================================================================
+    // Minimal PNG writer
+    // ============================================================================
+    // stb_image_write is not vendored (third_party carries only the decoder),
+    // and the capture path needs nothing beyond 8-bit RGBA, so the encoder is
+    // a self-contained writer using stored (uncompressed) deflate blocks.
+    // Files are larger than a real compressor would produce, but encoding is
+    // a straight memcpy — exactly what a per-frame video capture wants.
+
+    uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+        static uint32_t table[256];
+        static bool tableReady = false;
+        if (!tableReady) {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+                }
+                table[i] = c;
+            }
+            tableReady = true;
+        }
+        for (size_t i = 0; i < length; i++) {
+            crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    void putBe32(uint8_t* out, uint32_t value) {
+        out[0] = static_cast<uint8_t>(value >> 24);
+        out[1] = static_cast<uint8_t>(value >> 16);
+        out[2] = static_cast<uint8_t>(value >> 8);
+        out[3] = static_cast<uint8_t>(value);
+    }
+
+    bool writeChunk(FILE* file, const char type[4], const uint8_t* data, uint32_t length) {
+        uint8_t header[8];
+        putBe32(header, length);
+        std::memcpy(header + 4, type, 4);
+        if (std::fwrite(header, 1, 8, file) != 8) return false;
+        if (length > 0 && std::fwrite(data, 1, length, file) != length) return false;
+
+        uint32_t crc = crc32Update(0xFFFFFFFFu, header + 4, 4);
+        crc = crc32Update(crc, data, length) ^ 0xFFFFFFFFu;
+        uint8_t crcBytes[4];
+        putBe32(crcBytes, crc);
+        return std::fwrite(crcBytes, 1, 4, file) == 4;
+    }
+
+    /** @brief Write @p rgba (tightly packed, 4 bytes/pixel) as a PNG file. */
+    bool writePng(const std::string& path, uint32_t width, uint32_t height,
+                  const uint8_t* rgba) {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+
+        static const uint8_t kSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        bool ok = std::fwrite(kSignature, 1, 8, file) == 8;
+
+        uint8_t ihdr[13];
+        putBe32(ihdr, width);
+        putBe32(ihdr + 4, height);
+        ihdr[8] = 8;   // bit depth
+        ihdr[9] = 6;   // color type: RGBA
+        ihdr[10] = 0;  // compression
+        ihdr[11] = 0;  // filter
+        ihdr[12] = 0;  // interlace
+        ok = ok && writeChunk(file, "IHDR", ihdr, sizeof(ihdr));
+
+        // Raw PNG image data: each scanline prefixed with filter byte 0
+        const size_t stride = static_cast<size_t>(width) * 4;
+        std::vector<uint8_t> raw;
+        raw.reserve(height * (stride + 1));
+        for (uint32_t y = 0; y < height; y++) {
+            raw.push_back(0); // filter: none
+            raw.insert(raw.end(), rgba + y * stride, rgba + (y + 1) * stride);
+        }
+
+        // Wrap it in a zlib stream of stored deflate blocks (64K max each)
+        std::vector<uint8_t> idat;
+        idat.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+        idat.push_back(0x78); // zlib header: 32K window
+        idat.push_back(0x01); // fastest compression hint
+
+        size_t offset = 0;
+        while (offset < raw.size() || raw.empty()) {
+            const size_t blockLen = std::min<size_t>(raw.size() - offset, 65535);
+            const bool isFinal = (offset + blockLen == raw.size());
+            idat.push_back(isFinal ? 1 : 0);
+            idat.push_back(static_cast<uint8_t>(blockLen & 0xFF));
+            idat.push_back(static_cast<uint8_t>(blockLen >> 8));
+            idat.push_back(static_cast<uint8_t>(~blockLen & 0xFF));
+            idat.push_back(static_cast<uint8_t>((~blockLen >> 8) & 0xFF));
+            idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + blockLen);
+            offset += blockLen;
+            if (isFinal) break;
+        }
+
+        uint32_t adlerA = 1;
+        uint32_t adlerB = 0;
+        for (uint8_t byte : raw) {
+            adlerA = (adlerA + byte) % 65521;
+            adlerB = (adlerB + adlerA) % 65521;
+        }
+        uint8_t adler[4];
+        putBe32(adler, (adlerB << 16) | adlerA);
+        idat.insert(idat.end(), adler, adler + 4);
+
+        ok = ok && writeChunk(file, "IDAT", idat.data(), static_cast<uint32_t>(idat.size()));
+        ok = ok && writeChunk(file, "IEND", nullptr, 0);
+        ok = (std::fclose(file) == 0) && ok;
+        return ok;
+    }
+
+} // namespace
+
+namespace vkeng {
+
+    ScreenshotCapture::ScreenshotCapture(VulkanDevice& device,
+                                         std::shared_ptr<MemoryManager> memoryManager,
+                                         const std::filesystem::path& outputDir)
+        : m_device(device)
+        , m_memoryManager(std::move(memoryManager))
+        , m_outputDir(outputDir) {
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_outputDir, ec);
+        if (ec) {
+            throw std::runtime_error("ScreenshotCapture: cannot create output directory '" +
+                                     m_outputDir.string() + "': " + ec.message());
+        }
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        poolInfo.queueFamilyIndex = m_device.getGraphicsFamily();
+        if (vkCreateCommandPool(m_device.getDevice(), &poolInfo, nullptr, &m_commandPool) != VK_SUCCESS) {
+            throw std::runtime_error("ScreenshotCapture: failed to create command pool");
+        }
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+        for (Slot& slot : m_slots) {
+            if (vkAllocateCommandBuffers(m_device.getDevice(), &allocInfo, &slot.commandBuffer) != VK_SUCCESS ||
+                vkCreateFence(m_device.getDevice(), &fenceInfo, nullptr, &slot.fence) != VK_SUCCESS ||
+                vkCreateSemaphore(m_device.getDevice(), &semaphoreInfo, nullptr, &slot.copyDone) != VK_SUCCESS) {
+                throw std::runtime_error("ScreenshotCapture: failed to create capture slot");
+            }
+        }
+
+        m_encoderThread = std::thread([this]() { encoderMain(); });
+
+        LOG_INFO(RENDERING, "Screenshot capture enabled: {} slots, output '{}'",
+                 kSlotCount, m_outputDir.string());
+    }
+
+    ScreenshotCapture::~ScreenshotCapture() {
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_shutdown = true;
+        }
+        m_queueCv.notify_all();
+        if (m_encoderThread.joinable()) {
+            m_encoderThread.join();
+        }
+
+        for (Slot& slot : m_slots) {
+            if (slot.fence != VK_NULL_HANDLE) {
+                vkDestroyFence(m_device.getDevice(), slot.fence, nullptr);
+            }
+            if (slot.copyDone != VK_NULL_HANDLE) {
+                vkDestroySemaphore(m_device.getDevice(), slot.copyDone, nullptr);
+            }
+        }
+        if (m_commandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(m_device.getDevice(), m_commandPool, nullptr);
+        }
+    }
+
+    // ============================================================================
+    // Requests
+    // ============================================================================
+
+    void ScreenshotCapture::requestCapture(const std::string& filename) {
+        m_oneShotPending = true;
+        m_oneShotName = filename;
+    }
+
+    void ScreenshotCapture::beginContinuousCapture() {
+        m_continuous = true;
+        m_sequence = 0;
+        m_droppedFrames = 0;
+        LOG_INFO(RENDERING, "Continuous capture started -> '{}'", m_outputDir.string());
+    }
+
+    void ScreenshotCapture::endContinuousCapture() {
+        m_continuous = false;
+        LOG_INFO(RENDERING, "Continuous capture stopped: {} frames captured, {} dropped",
+                 m_sequence, m_droppedFrames);
+    }
+
+    // ============================================================================
+    // Renderer hook
+    // ============================================================================
+
+    VkSemaphore ScreenshotCapture::recordCopy(VkImage image, VkExtent2D extent, VkFormat format,
+                                              VkSemaphore renderFinished) {
+        // Claim a slot the encoder has finished with. Slot state is shared
+        // with the encoder thread, so the scan happens under the queue lock.
+        uint32_t slotIndex = kSlotCount;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (uint32_t i = 0; i < kSlotCount; i++) {
+                if (!m_slots[i].busy) {
+                    m_slots[i].busy = true;
+                    slotIndex = i;
+                    break;
+                }
+            }
+        }
+        if (slotIndex == kSlotCount) {
+            // Every slot is still encoding; skip this frame. A pending
+            // one-shot stays pending and retries next frame.
+            m_droppedFrames++;
+            return VK_NULL_HANDLE;
+        }
+
+        Slot& slot = m_slots[slotIndex];
+        slot.width = extent.width;
+        slot.height = extent.height;
+        slot.format = format;
+
+        if (m_oneShotPending) {
+            if (m_oneShotName.empty()) {
+                auto now = std::chrono::system_clock::now().time_since_epoch();
+                auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+                char name[64];
+                std::snprintf(name, sizeof(name), "screenshot_%lld.png",
+                              static_cast<long long>(millis));
+                slot.path = (m_outputDir / name).string();
+            } else {
+                slot.path = (m_outputDir / m_oneShotName).string();
+            }
+            m_oneShotPending = false;
+        } else {
+            char name[32];
+            std::snprintf(name, sizeof(name), "capture_%06llu.png",
+                          static_cast<unsigned long long>(m_sequence++));
+            slot.path = (m_outputDir / name).string();
+        }
+
+        // (Re)allocate the readback buffer on resolution change
+        const VkDeviceSize needed = VkDeviceSize(extent.width) * extent.height * 4;
+        if (!slot.readback || slot.readback->getSize() < needed) {
+            auto result = m_memoryManager->createBuffer(BufferCreateInfo{
+                needed, BufferUsage::TransferDst, true, "screenshot readback"});
+            if (!result) {
+                LOG_WARN(RENDERING, "Screenshot readback allocation failed: {}",
+                         result.getError().message);
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                slot.busy = false;
+                return VK_NULL_HANDLE;
+            }
+            slot.readback = result.getValue();
+        }
+
+        // Record: PRESENT -> TRANSFER_SRC, copy, back to PRESENT. Layout
+        // visibility is covered by the renderFinished semaphore wait.
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(slot.commandBuffer, &beginInfo);
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        VkBufferImageCopy region{};
+        region.bufferOffset = 0;
+        region.bufferRowLength = 0; // tightly packed
+        region.bufferImageHeight = 0;
+        region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {extent.width, extent.height, 1};
+        vkCmdCopyImageToBuffer(slot.commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                               slot.readback->getHandle(), 1, &region);
+
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = 0;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        vkCmdPipelineBarrier(slot.commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        vkEndCommandBuffer(slot.commandBuffer);
+
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &renderFinished;
+        submitInfo.pWaitDstStageMask = &waitStage;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &slot.commandBuffer;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &slot.copyDone;
+
+        if (vkQueueSubmit(m_device.getGraphicsQueue(), 1, &submitInfo, slot.fence) != VK_SUCCESS) {
+            LOG_WARN(RENDERING, "Screenshot copy submit failed, skipping frame");
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            slot.busy = false;
+            return VK_NULL_HANDLE;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_pendingSlots.push_back(slotIndex);
+        }
+        m_queueCv.notify_one();
+        return slot.copyDone;
+    }
+
+    // ============================================================================
+    // Encoder thread
+    // ============================================================================
+
+    void ScreenshotCapture::encoderMain() {
+        for (;;) {
+            uint32_t slotIndex;
+            {
+                std::unique_lock<std::mutex> lock(m_queueMutex);
+                m_queueCv.wait(lock, [this]() { return m_shutdown || !m_pendingSlots.empty(); });
+                if (m_pendingSlots.empty()) {
+                    // Shutdown with nothing left to drain
+                    return;
+                }
+                slotIndex = m_pendingSlots.front();
+                m_pendingSlots.pop_front();
+            }
+
+            Slot& slot = m_slots[slotIndex];
+            vkWaitForFences(m_device.getDevice(), 1, &slot.fence, VK_TRUE, UINT64_MAX);
+            vkResetFences(m_device.getDevice(), 1, &slot.fence);
+
+            encodeSlot(slot);
+
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                slot.busy = false;
+            }
+        }
+    }
+
+    void ScreenshotCapture::encodeSlot(Slot& slot) {
+        const auto* pixels = static_cast<const uint8_t*>(slot.readback->getMappedData());
+        if (!pixels) {
+            LOG_WARN(RENDERING, "Screenshot readback has no mapping, dropping '{}'", slot.path);
+            return;
+        }
+
+        const size_t pixelCount = static_cast<size_t>(slot.width) * slot.height;
+        m_encodeScratch.resize(pixelCount * 4);
+
+        // Swapchains here are B8G8R8A8 (SRGB or UNORM); swizzle to the RGBA
+        // byte order PNG expects. R8G8B8A8 passes through.
+        const bool bgra = (slot.format != VK_FORMAT_R8G8B8A8_SRGB &&
+                           slot.format != VK_FORMAT_R8G8B8A8_UNORM);
+        if (bgra) {
+            for (size_t i = 0; i < pixelCount; i++) {
+                m_encodeScratch[i * 4 + 0] = pixels[i * 4 + 2];
+                m_encodeScratch[i * 4 + 1] = pixels[i * 4 + 1];
+                m_encodeScratch[i * 4 + 2] = pixels[i * 4 + 0];
+                m_encodeScratch[i * 4 + 3] = 0xFF; // presented alpha is meaningless
+            }
+        } else {
+            std::memcpy(m_encodeScratch.data(), pixels, pixelCount * 4);
+            for (size_t i = 0; i < pixelCount; i++) {
+                m_encodeScratch[i * 4 + 3] = 0xFF;
+            }
+        }
+
+        if (!writePng(slot.path, slot.width, slot.height, m_encodeScratch.data())) {
+            LOG_WARN(RENDERING, "Failed to write screenshot '{}'", slot.path);
+        } else {
+            LOG_DEBUG(RENDERING, "Wrote capture '{}' ({}x{})", slot.path, slot.width, slot.height);
+        }
+    }
+
+} // namespace vkeng
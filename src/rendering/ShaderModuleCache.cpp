@@ -0,0 +1,110 @@
+#include "vulkan-engine/rendering/ShaderModuleCache.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace vkeng {
+
+    namespace {
+        /// FNV-1a over the raw SPIR-V bytes
+        uint64_t hashBytes(const std::vector<char>& data) {
+            uint64_t hash = 1469598103934665603ull;
+            for (char byte : data) {
+                hash ^= static_cast<uint8_t>(byte);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        std::vector<char> readSpirvFile(const std::filesystem::path& path) {
+            std::ifstream file(path, std::ios::ate | std::ios::binary);
+            if (!file.is_open()) {
+                throw std::runtime_error(
+                    "Failed to open shader file: " + path.string() +
+                    ". Build the project to compile shaders or run shaders/compile_shaders.sh manually.");
+            }
+
+            size_t fileSize = static_cast<size_t>(file.tellg());
+            std::vector<char> buffer(fileSize);
+            file.seekg(0);
+            file.read(buffer.data(), static_cast<std::streamsize>(fileSize));
+
+            if (buffer.empty() || (buffer.size() % sizeof(uint32_t)) != 0) {
+                throw std::runtime_error("Shader file is not valid SPIR-V: " + path.string());
+            }
+            return buffer;
+        }
+    }
+
+    ShaderModuleCache::ShaderModuleCache(VkDevice device) : m_device(device) {
+    }
+
+    ShaderModuleCache::~ShaderModuleCache() noexcept {
+        clear();
+    }
+
+    VkShaderModule ShaderModuleCache::getModule(const std::filesystem::path& path) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Entry& entry = m_entries[path.string()];
+        if (entry.module != VK_NULL_HANDLE && !entry.stale) {
+            return entry.module;
+        }
+
+        loadEntry(path, entry);
+        return entry.module;
+    }
+
+    void ShaderModuleCache::invalidate(const std::filesystem::path& path) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_entries.find(path.string());
+        if (it != m_entries.end()) {
+            it->second.stale = true;
+        }
+    }
+
+    void ShaderModuleCache::clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (auto& [path, entry] : m_entries) {
+            if (entry.module != VK_NULL_HANDLE) {
+                vkDestroyShaderModule(m_device, entry.module, nullptr);
+            }
+        }
+        m_entries.clear();
+    }
+
+    void ShaderModuleCache::loadEntry(const std::filesystem::path& path, Entry& entry) {
+        auto code = readSpirvFile(path);
+        uint64_t hash = hashBytes(code);
+
+        // Stale entry whose bytes didn't change (e.g. a comment-only edit
+        // recompiled to the same SPIR-V): keep the existing module
+        if (entry.module != VK_NULL_HANDLE && entry.contentHash == hash) {
+            entry.stale = false;
+            return;
+        }
+
+        if (entry.module != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(m_device, entry.module, nullptr);
+            entry.module = VK_NULL_HANDLE;
+        }
+
+        VkShaderModuleCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.codeSize = code.size();
+        createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
+
+        if (vkCreateShaderModule(m_device, &createInfo, nullptr, &entry.module) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create shader module: " + path.string());
+        }
+
+        entry.contentHash = hash;
+        entry.stale = false;
+        LOG_DEBUG(RENDERING, "ShaderModuleCache: loaded {} (hash={})", path.string(), hash);
+    }
+
+} // namespace vkeng
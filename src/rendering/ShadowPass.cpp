@@ -7,30 +7,56 @@
 namespace vkeng {
 
 ShadowPass::ShadowPass(VkDevice device, VkPhysicalDevice physicalDevice,
-                       std::shared_ptr<MemoryManager> memoryManager)
+                       std::shared_ptr<MemoryManager> memoryManager,
+                       bool useMultiview)
     : m_device(device)
     , m_physicalDevice(physicalDevice)
     , m_memoryManager(std::move(memoryManager))
+    , m_multiview(useMultiview)
 {
     m_depthFormat = findDepthFormat();
     createRenderPass();
+    createLoadRenderPass();
     createDepthResources();
-    createFramebuffer();
+    createFramebuffers();
     createSampler();
-    LOG_INFO(RENDERING, "ShadowPass created ({}x{}, format={})", SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, static_cast<int>(m_depthFormat));
+    LOG_INFO(RENDERING, "ShadowPass created ({} cascades, {}x{}, format={}, multiview={})",
+             CASCADE_COUNT, SHADOW_MAP_SIZE, SHADOW_MAP_SIZE,
+             static_cast<int>(m_depthFormat), m_multiview);
 }
 
 ShadowPass::~ShadowPass() noexcept {
     if (m_sampler != VK_NULL_HANDLE) {
         vkDestroySampler(m_device, m_sampler, nullptr);
     }
-    if (m_framebuffer != VK_NULL_HANDLE) {
-        vkDestroyFramebuffer(m_device, m_framebuffer, nullptr);
+    if (m_layeredFramebuffer != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(m_device, m_layeredFramebuffer, nullptr);
+    }
+    if (m_staticLayeredFramebuffer != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(m_device, m_staticLayeredFramebuffer, nullptr);
+    }
+    for (uint32_t c = 0; c < CASCADE_COUNT; c++) {
+        if (m_framebuffers[c] != VK_NULL_HANDLE) {
+            vkDestroyFramebuffer(m_device, m_framebuffers[c], nullptr);
+        }
+        if (m_staticFramebuffers[c] != VK_NULL_HANDLE) {
+            vkDestroyFramebuffer(m_device, m_staticFramebuffers[c], nullptr);
+        }
+        if (m_layerViews[c] != VK_NULL_HANDLE) {
+            vkDestroyImageView(m_device, m_layerViews[c], nullptr);
+        }
+        if (m_staticLayerViews[c] != VK_NULL_HANDLE) {
+            vkDestroyImageView(m_device, m_staticLayerViews[c], nullptr);
+        }
     }
     m_depthImage.reset();
+    m_staticDepthImage.reset();
     if (m_renderPass != VK_NULL_HANDLE) {
         vkDestroyRenderPass(m_device, m_renderPass, nullptr);
     }
+    if (m_loadRenderPass != VK_NULL_HANDLE) {
+        vkDestroyRenderPass(m_device, m_loadRenderPass, nullptr);
+    }
 }
 
 VkFormat ShadowPass::findDepthFormat() {
@@ -99,39 +125,236 @@ void ShadowPass::createRenderPass() {
     renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
     renderPassInfo.pDependencies = dependencies.data();
 
+    // Multiview: one pass instance broadcasts the subpass across every
+    // cascade layer, with gl_ViewIndex selecting the light matrix in the
+    // shader. The correlation mask tells the driver the views cover the
+    // same render area and may share tiling work.
+    VkRenderPassMultiviewCreateInfo multiviewInfo{};
+    const uint32_t viewMask = (1u << CASCADE_COUNT) - 1;
+    if (m_multiview) {
+        multiviewInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO;
+        multiviewInfo.subpassCount = 1;
+        multiviewInfo.pViewMasks = &viewMask;
+        multiviewInfo.correlationMaskCount = 1;
+        multiviewInfo.pCorrelationMasks = &viewMask;
+        renderPassInfo.pNext = &multiviewInfo;
+    }
+
     if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_renderPass) != VK_SUCCESS) {
         throw std::runtime_error("Failed to create shadow render pass");
     }
 }
 
+void ShadowPass::createLoadRenderPass() {
+    // Same single depth attachment as createRenderPass(), but LOADing the
+    // depth the static-layer copy left behind instead of clearing. The
+    // initialLayout also absorbs the TRANSFER_DST -> attachment transition.
+    VkAttachmentDescription depthAttachment{};
+    depthAttachment.format = m_depthFormat;
+    depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    depthAttachment.initialLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+
+    VkAttachmentReference depthRef{};
+    depthRef.attachment = 0;
+    depthRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 0;
+    subpass.pColorAttachments = nullptr;
+    subpass.pDepthStencilAttachment = &depthRef;
+
+    std::array<VkSubpassDependency, 2> dependencies{};
+
+    // External -> subpass: the static layer copy must land before depth tests
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    // Subpass -> external: depth writes must complete before fragment shader reads
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    dependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &depthAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+    renderPassInfo.pDependencies = dependencies.data();
+
+    // Same cascade-wide viewMask as the clear pass (the two must stay
+    // render-pass compatible so one pipeline serves both)
+    VkRenderPassMultiviewCreateInfo multiviewInfo{};
+    const uint32_t viewMask = (1u << CASCADE_COUNT) - 1;
+    if (m_multiview) {
+        multiviewInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO;
+        multiviewInfo.subpassCount = 1;
+        multiviewInfo.pViewMasks = &viewMask;
+        multiviewInfo.correlationMaskCount = 1;
+        multiviewInfo.pCorrelationMasks = &viewMask;
+        renderPassInfo.pNext = &multiviewInfo;
+    }
+
+    if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_loadRenderPass) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create shadow load render pass");
+    }
+}
+
 void ShadowPass::createDepthResources() {
-    // Need both DEPTH_STENCIL_ATTACHMENT (for rendering) and SAMPLED (for reading in main pass)
+    // Need both DEPTH_STENCIL_ATTACHMENT (for rendering) and SAMPLED (for
+    // reading in main pass); TRANSFER_DST receives the static layer copy.
+    // One array layer per cascade; the composite view is 2D_ARRAY.
     auto result = m_memoryManager->createImage(
         SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, m_depthFormat,
-        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+        VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        false, 1, CASCADE_COUNT);
     if (!result) {
         throw std::runtime_error("Failed to create shadow depth image: " + result.getError().message);
     }
     m_depthImage = result.getValue();
+
+    // Persistent static caster layers, copied into the main map each frame
+    auto staticResult = m_memoryManager->createImage(
+        SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, m_depthFormat,
+        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+        false, 1, CASCADE_COUNT);
+    if (!staticResult) {
+        throw std::runtime_error("Failed to create static shadow layer: " + staticResult.getError().message);
+    }
+    m_staticDepthImage = staticResult.getValue();
 }
 
-void ShadowPass::createFramebuffer() {
-    VkImageView depthView = m_depthImage->getImageView();
+VkImageView ShadowPass::createLayerView(VkImage image, uint32_t layer) const {
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = image;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = m_depthFormat;
+    viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+    viewInfo.subresourceRange.baseMipLevel = 0;
+    viewInfo.subresourceRange.levelCount = 1;
+    viewInfo.subresourceRange.baseArrayLayer = layer;
+    viewInfo.subresourceRange.layerCount = 1;
+
+    VkImageView view = VK_NULL_HANDLE;
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &view) != VK_SUCCESS) {
+        throw std::runtime_error("Failed to create shadow cascade layer view");
+    }
+    return view;
+}
 
+void ShadowPass::createFramebuffers() {
     VkFramebufferCreateInfo fbInfo{};
     fbInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
     fbInfo.renderPass = m_renderPass;
     fbInfo.attachmentCount = 1;
-    fbInfo.pAttachments = &depthView;
     fbInfo.width = SHADOW_MAP_SIZE;
     fbInfo.height = SHADOW_MAP_SIZE;
     fbInfo.layers = 1;
 
-    if (vkCreateFramebuffer(m_device, &fbInfo, nullptr, &m_framebuffer) != VK_SUCCESS) {
-        throw std::runtime_error("Failed to create shadow framebuffer");
+    if (m_multiview) {
+        // One framebuffer over the full 2D_ARRAY view per image; the
+        // viewMask routes each view to its layer (layers stays 1 — the
+        // mask, not the framebuffer, defines the layer count)
+        VkImageView attachment = m_depthImage->getImageView();
+        fbInfo.pAttachments = &attachment;
+        if (vkCreateFramebuffer(m_device, &fbInfo, nullptr, &m_layeredFramebuffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create layered shadow framebuffer");
+        }
+
+        attachment = m_staticDepthImage->getImageView();
+        fbInfo.pAttachments = &attachment;
+        if (vkCreateFramebuffer(m_device, &fbInfo, nullptr, &m_staticLayeredFramebuffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create layered static shadow framebuffer");
+        }
+        return;
+    }
+
+    // Each cascade renders through its own single-layer attachment view
+    for (uint32_t c = 0; c < CASCADE_COUNT; c++) {
+        m_layerViews[c] = createLayerView(m_depthImage->getHandle(), c);
+        fbInfo.pAttachments = &m_layerViews[c];
+        if (vkCreateFramebuffer(m_device, &fbInfo, nullptr, &m_framebuffers[c]) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create shadow framebuffer");
+        }
+
+        m_staticLayerViews[c] = createLayerView(m_staticDepthImage->getHandle(), c);
+        fbInfo.pAttachments = &m_staticLayerViews[c];
+        if (vkCreateFramebuffer(m_device, &fbInfo, nullptr, &m_staticFramebuffers[c]) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create static shadow framebuffer");
+        }
     }
 }
 
+void ShadowPass::recordStaticLayerCopy(VkCommandBuffer commandBuffer, bool justRenderedStatic) {
+    // Static layers: after a re-render they sit in the render pass's READ_ONLY
+    // final layout; otherwise they stayed in TRANSFER_SRC from the last copy
+    // (read-after-read needs no barrier).
+    std::array<VkImageMemoryBarrier, 2> preBarriers{};
+    uint32_t preCount = 0;
+
+    if (justRenderedStatic) {
+        VkImageMemoryBarrier& staticToSrc = preBarriers[preCount++];
+        staticToSrc.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        staticToSrc.srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        staticToSrc.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        staticToSrc.oldLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        staticToSrc.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        staticToSrc.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        staticToSrc.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        staticToSrc.image = m_staticDepthImage->getHandle();
+        staticToSrc.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, CASCADE_COUNT};
+    }
+
+    // Main map: previous contents are fully overwritten, discard via UNDEFINED
+    VkImageMemoryBarrier& mainToDst = preBarriers[preCount++];
+    mainToDst.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    mainToDst.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    mainToDst.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    mainToDst.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    mainToDst.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    mainToDst.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    mainToDst.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    mainToDst.image = m_depthImage->getHandle();
+    mainToDst.subresourceRange = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, CASCADE_COUNT};
+
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, 0, nullptr, 0, nullptr, preCount, preBarriers.data());
+
+    // One copy covers every cascade layer
+    VkImageCopy copy{};
+    copy.srcSubresource = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 0, CASCADE_COUNT};
+    copy.dstSubresource = {VK_IMAGE_ASPECT_DEPTH_BIT, 0, 0, CASCADE_COUNT};
+    copy.extent = {SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, 1};
+
+    vkCmdCopyImage(commandBuffer,
+        m_staticDepthImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        m_depthImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        1, &copy);
+
+    // The load render pass picks the main map up in TRANSFER_DST_OPTIMAL and
+    // its external dependency orders the copy against depth testing.
+}
+
 void ShadowPass::createSampler() {
     VkSamplerCreateInfo samplerInfo{};
     samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
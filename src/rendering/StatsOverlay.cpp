@@ -0,0 +1,455 @@
+/**
+ * @file StatsOverlay.cpp
+ * @brief Implementation of the in-engine stats HUD
+ */
+
+#include "vulkan-engine/rendering/StatsOverlay.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/rendering/GpuProfiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace vkeng {
+
+namespace {
+    // ========================================================================
+    // Embedded 8x8 Font
+    // ========================================================================
+    // Hand-packed glyph bitmaps, one byte per row, bit 0 = leftmost pixel.
+    // The charset covers what the HUD prints: digits, uppercase letters,
+    // and punctuation, plus a trailing solid block the graph bars sample.
+    // Lowercase maps to uppercase at lookup; unknown characters render as
+    // spaces.
+
+    constexpr char kGlyphChars[] = " !%()+,-./0123456789:<=>?ABCDEFGHIJKLMNOPQRSTUVWXYZ[]_";
+    constexpr uint32_t kGlyphCount = sizeof(kGlyphChars);  // charset + solid block
+    constexpr uint32_t kSolidGlyph = kGlyphCount - 1;
+
+    constexpr uint8_t kGlyphBitmaps[kGlyphCount][8] = {
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // ' '
+        {0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x0c, 0x00},  // '!'
+        {0x22, 0x15, 0x0a, 0x04, 0x0a, 0x51, 0x29, 0x00},  // '%'
+        {0x18, 0x0c, 0x06, 0x06, 0x06, 0x0c, 0x18, 0x00},  // '('
+        {0x0c, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0c, 0x00},  // ')'
+        {0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00},  // '+'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x0c},  // ','
+        {0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00},  // '-'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x00},  // '.'
+        {0x20, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x00},  // '/'
+        {0x3e, 0x63, 0x73, 0x6b, 0x67, 0x63, 0x3e, 0x00},  // '0'
+        {0x18, 0x1c, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00},  // '1'
+        {0x3e, 0x63, 0x60, 0x18, 0x0c, 0x06, 0x7f, 0x00},  // '2'
+        {0x3e, 0x63, 0x60, 0x3c, 0x60, 0x63, 0x3e, 0x00},  // '3'
+        {0x30, 0x38, 0x3c, 0x36, 0x7f, 0x30, 0x30, 0x00},  // '4'
+        {0x3f, 0x03, 0x3f, 0x60, 0x60, 0x63, 0x3e, 0x00},  // '5'
+        {0x3e, 0x03, 0x3f, 0x63, 0x63, 0x63, 0x3e, 0x00},  // '6'
+        {0x7f, 0x60, 0x30, 0x18, 0x0c, 0x0c, 0x0c, 0x00},  // '7'
+        {0x3e, 0x63, 0x63, 0x3e, 0x63, 0x63, 0x3e, 0x00},  // '8'
+        {0x3e, 0x63, 0x63, 0x7e, 0x60, 0x60, 0x3e, 0x00},  // '9'
+        {0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, 0x00},  // ':'
+        {0x30, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x30, 0x00},  // '<'
+        {0x00, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x00, 0x00},  // '='
+        {0x06, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x06, 0x00},  // '>'
+        {0x3e, 0x63, 0x60, 0x38, 0x18, 0x00, 0x18, 0x00},  // '?'
+        {0x1c, 0x36, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x00},  // 'A'
+        {0x3f, 0x63, 0x63, 0x3f, 0x63, 0x63, 0x3f, 0x00},  // 'B'
+        {0x3e, 0x63, 0x03, 0x03, 0x03, 0x63, 0x3e, 0x00},  // 'C'
+        {0x1f, 0x33, 0x63, 0x63, 0x63, 0x33, 0x1f, 0x00},  // 'D'
+        {0x7f, 0x03, 0x03, 0x3f, 0x03, 0x03, 0x7f, 0x00},  // 'E'
+        {0x7f, 0x03, 0x03, 0x3f, 0x03, 0x03, 0x03, 0x00},  // 'F'
+        {0x3e, 0x63, 0x03, 0x73, 0x63, 0x63, 0x3e, 0x00},  // 'G'
+        {0x63, 0x63, 0x63, 0x7f, 0x63, 0x63, 0x63, 0x00},  // 'H'
+        {0x7e, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x00},  // 'I'
+        {0x78, 0x30, 0x30, 0x30, 0x30, 0x33, 0x1e, 0x00},  // 'J'
+        {0x63, 0x33, 0x1b, 0x0f, 0x1b, 0x33, 0x63, 0x00},  // 'K'
+        {0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7f, 0x00},  // 'L'
+        {0x63, 0x77, 0x7f, 0x6b, 0x63, 0x63, 0x63, 0x00},  // 'M'
+        {0x63, 0x67, 0x6f, 0x7b, 0x73, 0x63, 0x63, 0x00},  // 'N'
+        {0x3e, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00},  // 'O'
+        {0x3f, 0x63, 0x63, 0x3f, 0x03, 0x03, 0x03, 0x00},  // 'P'
+        {0x3e, 0x63, 0x63, 0x63, 0x6b, 0x33, 0x5e, 0x00},  // 'Q'
+        {0x3f, 0x63, 0x63, 0x3f, 0x1b, 0x33, 0x63, 0x00},  // 'R'
+        {0x3e, 0x63, 0x03, 0x3e, 0x60, 0x63, 0x3e, 0x00},  // 'S'
+        {0x3f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00},  // 'T'
+        {0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x3e, 0x00},  // 'U'
+        {0x63, 0x63, 0x63, 0x63, 0x63, 0x36, 0x1c, 0x00},  // 'V'
+        {0x63, 0x63, 0x63, 0x6b, 0x7f, 0x77, 0x63, 0x00},  // 'W'
+        {0x63, 0x36, 0x1c, 0x08, 0x1c, 0x36, 0x63, 0x00},  // 'X'
+        {0x63, 0x63, 0x36, 0x1c, 0x08, 0x08, 0x08, 0x00},  // 'Y'
+        {0x7f, 0x60, 0x30, 0x1c, 0x06, 0x03, 0x7f, 0x00},  // 'Z'
+        {0x3c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x00},  // '['
+        {0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x00},  // ']'
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00},  // '_'
+        {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},  // solid block (graph bars)
+    };
+
+    /** @brief Maps a character to its glyph index (lowercase folds to uppercase). */
+    uint32_t glyphIndex(char c) {
+        if (c >= 'a' && c <= 'z') {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+        for (uint32_t i = 0; i + 1 < kGlyphCount; ++i) {
+            if (kGlyphChars[i] == c) {
+                return i;
+            }
+        }
+        return 0;  // space
+    }
+
+    // ========================================================================
+    // HUD Layout and Colors
+    // ========================================================================
+
+    constexpr float kMargin = 8.0f;       ///< HUD offset from the screen corner (pixels)
+    constexpr float kGlyphSize = 16.0f;   ///< On-screen glyph cell (8px atlas cell x2)
+    constexpr float kLineHeight = 18.0f;
+    constexpr float kGraphHeight = 48.0f; ///< Frame-time graph height (pixels)
+    constexpr float kGraphBarWidth = 2.0f;
+    constexpr float kGraphMaxMs = 33.3f;  ///< Graph full scale (two 60 Hz frames)
+    constexpr float kFrameMsSmoothing = 0.1f; ///< EMA factor for the FPS readout
+
+    constexpr uint32_t packColor(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+        return r | (g << 8) | (b << 16) | (a << 24);
+    }
+
+    constexpr uint32_t kColorText = packColor(255, 255, 255, 255);
+    constexpr uint32_t kColorDim = packColor(170, 170, 170, 255);
+    constexpr uint32_t kColorBackdrop = packColor(0, 0, 0, 160);
+    constexpr uint32_t kColorGood = packColor(90, 220, 90, 255);    ///< Under 60 Hz budget
+    constexpr uint32_t kColorWarn = packColor(235, 200, 60, 255);   ///< Under 30 Hz budget
+    constexpr uint32_t kColorBad = packColor(235, 80, 60, 255);     ///< Over 30 Hz budget
+}
+
+StatsOverlay::StatsOverlay(VulkanDevice& device,
+                           std::shared_ptr<MemoryManager> memoryManager,
+                           PipelineManager& pipelineManager,
+                           uint32_t framesInFlight,
+                           const std::filesystem::path& shaderDir)
+    : m_device(device)
+    , m_memoryManager(std::move(memoryManager))
+    , m_pipelineManager(pipelineManager) {
+
+    createFontAtlas();
+    createPipelineState(shaderDir);
+
+    // Persistently mapped vertex buffers: the per-frame refill is a plain
+    // write through the mapping, no allocation or staging
+    m_vertexBuffers.resize(framesInFlight);
+    for (auto& buffer : m_vertexBuffers) {
+        auto bufferResult = m_memoryManager->createVertexBuffer(
+            VkDeviceSize(kMaxVertices) * sizeof(OverlayVertex), true);
+        if (!bufferResult.isSuccess()) {
+            throw std::runtime_error("StatsOverlay: failed to create vertex buffer: " +
+                                     bufferResult.getError().message);
+        }
+        buffer = bufferResult.getValue();
+    }
+
+    LOG_INFO(RENDERING, "StatsOverlay created ({} glyphs, {} quad budget, {} history samples)",
+             kGlyphCount, kMaxQuads, kHistorySize);
+}
+
+StatsOverlay::~StatsOverlay() {
+    VkDevice vkDevice = m_device.getDevice();
+    if (m_pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(vkDevice, m_pipelineLayout, nullptr);
+    }
+    if (m_fontSampler != VK_NULL_HANDLE) {
+        vkDestroySampler(vkDevice, m_fontSampler, nullptr);
+    }
+}
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+/**
+ * @brief Expands the glyph bitmaps into an R8 atlas (one row of glyphs).
+ */
+void StatsOverlay::createFontAtlas() {
+    constexpr uint32_t atlasWidth = kGlyphCount * 8;
+    constexpr uint32_t atlasHeight = 8;
+    std::array<uint8_t, atlasWidth * atlasHeight> pixels{};
+
+    for (uint32_t glyph = 0; glyph < kGlyphCount; ++glyph) {
+        for (uint32_t row = 0; row < 8; ++row) {
+            uint8_t bits = kGlyphBitmaps[glyph][row];
+            for (uint32_t col = 0; col < 8; ++col) {
+                if (bits & (1u << col)) {
+                    pixels[row * atlasWidth + glyph * 8 + col] = 255;
+                }
+            }
+        }
+    }
+
+    auto atlasResult = m_memoryManager->createTexture2D(atlasWidth, atlasHeight, VK_FORMAT_R8_UNORM);
+    if (!atlasResult.isSuccess()) {
+        throw std::runtime_error("StatsOverlay: failed to create font atlas: " +
+                                 atlasResult.getError().message);
+    }
+    m_fontAtlas = atlasResult.getValue();
+
+    auto uploadResult = m_memoryManager->uploadToImage(
+        m_fontAtlas, pixels.data(), pixels.size(), atlasWidth, atlasHeight);
+    if (!uploadResult.isSuccess()) {
+        throw std::runtime_error("StatsOverlay: failed to upload font atlas: " +
+                                 uploadResult.getError().message);
+    }
+
+    // Nearest filtering keeps the pixel font crisp at the 2x on-screen scale
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    if (vkCreateSampler(m_device.getDevice(), &samplerInfo, nullptr, &m_fontSampler) != VK_SUCCESS) {
+        throw std::runtime_error("StatsOverlay: failed to create font sampler");
+    }
+}
+
+/**
+ * @brief Creates the overlay's descriptor set and pipeline layout.
+ *
+ * The overlay owns a tiny single-binding layout instead of riding the
+ * shared graphics layout — it needs no UBO, no push constants, just the
+ * atlas.
+ */
+void StatsOverlay::createPipelineState(const std::filesystem::path& shaderDir) {
+    VkDevice vkDevice = m_device.getDevice();
+
+    auto layoutResult = DescriptorSetLayout::create(vkDevice, {
+        {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT},
+    });
+    if (!layoutResult.isSuccess()) {
+        throw std::runtime_error("StatsOverlay: failed to create set layout: " +
+                                 layoutResult.getError().message);
+    }
+    m_setLayout = layoutResult.getValue();
+
+    auto poolResult = DescriptorPool::create(vkDevice, 1, {
+        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1},
+    });
+    if (!poolResult.isSuccess()) {
+        throw std::runtime_error("StatsOverlay: failed to create descriptor pool: " +
+                                 poolResult.getError().message);
+    }
+    m_descriptorPool = poolResult.getValue();
+
+    auto setResult = m_descriptorPool->allocateDescriptorSet(m_setLayout);
+    if (!setResult.isSuccess()) {
+        throw std::runtime_error("StatsOverlay: failed to allocate descriptor set: " +
+                                 setResult.getError().message);
+    }
+    m_fontSet = setResult.getValue();
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = m_fontSampler;
+    imageInfo.imageView = m_fontAtlas->getImageView();
+    imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_fontSet;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(vkDevice, 1, &write, 0, nullptr);
+
+    VkDescriptorSetLayout setLayout = m_setLayout->getHandle();
+    VkPipelineLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &setLayout;
+    if (vkCreatePipelineLayout(vkDevice, &layoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("StatsOverlay: failed to create pipeline layout");
+    }
+
+    m_drawConfig.vertShaderPath = shaderDir / "overlay_vert.spv";
+    m_drawConfig.fragShaderPath = shaderDir / "overlay_frag.spv";
+    m_drawConfig.blendMode = BlendMode::AlphaBlend;
+    m_drawConfig.cullMode = CullMode::None;
+    m_drawConfig.depthWriteEnable = false;
+    m_drawConfig.depthTestEnable = false;
+    m_drawConfig.vertexFormat = VertexFormat::Overlay;
+}
+
+// ============================================================================
+// Geometry Helpers
+// ============================================================================
+
+bool StatsOverlay::pushQuad(OverlayVertex* vertices, uint32_t& count,
+                            float x0, float y0, float x1, float y1,
+                            float u0, float v0, float u1, float v1, uint32_t color) const {
+    if (count + 6 > kMaxVertices) {
+        return false;
+    }
+
+    // Pixel coordinates to NDC (origin top-left; Vulkan NDC y points down)
+    float nx0 = x0 * m_ndcScaleX - 1.0f;
+    float ny0 = y0 * m_ndcScaleY - 1.0f;
+    float nx1 = x1 * m_ndcScaleX - 1.0f;
+    float ny1 = y1 * m_ndcScaleY - 1.0f;
+
+    OverlayVertex* v = vertices + count;
+    v[0] = {{nx0, ny0}, {u0, v0}, color};
+    v[1] = {{nx1, ny0}, {u1, v0}, color};
+    v[2] = {{nx1, ny1}, {u1, v1}, color};
+    v[3] = {{nx0, ny0}, {u0, v0}, color};
+    v[4] = {{nx1, ny1}, {u1, v1}, color};
+    v[5] = {{nx0, ny1}, {u0, v1}, color};
+    count += 6;
+    return true;
+}
+
+float StatsOverlay::pushText(OverlayVertex* vertices, uint32_t& count,
+                             float x, float y, const char* text, uint32_t color) const {
+    constexpr float glyphU = 1.0f / float(kGlyphCount);
+    for (const char* c = text; *c != '\0'; ++c) {
+        uint32_t glyph = glyphIndex(*c);
+        if (glyph != 0) {  // skip invisible quads for spaces
+            float u0 = float(glyph) * glyphU;
+            if (!pushQuad(vertices, count, x, y, x + kGlyphSize, y + kGlyphSize,
+                          u0, 0.0f, u0 + glyphU, 1.0f, color)) {
+                break;
+            }
+        }
+        x += kGlyphSize;
+    }
+    return x;
+}
+
+void StatsOverlay::pushRect(OverlayVertex* vertices, uint32_t& count,
+                            float x0, float y0, float x1, float y1, uint32_t color) const {
+    // Sample the middle of the solid glyph so filtering never bleeds a neighbor
+    constexpr float u = (float(kSolidGlyph) + 0.5f) / float(kGlyphCount);
+    pushQuad(vertices, count, x0, y0, x1, y1, u, 0.5f, u, 0.5f, color);
+}
+
+// ============================================================================
+// Per-Frame Draw
+// ============================================================================
+
+void StatsOverlay::recordDraw(VkCommandBuffer commandBuffer, VkRenderPass renderPass,
+                              VkExtent2D extent, uint32_t frameIndex, const FrameStats& stats) {
+    // Sample the frame clock even while hidden so the graph has no gap
+    // when the overlay toggles back on
+    auto now = std::chrono::steady_clock::now();
+    float frameMs = 16.7f;
+    if (m_clockStarted) {
+        frameMs = std::chrono::duration<float, std::milli>(now - m_lastFrameTime).count();
+    }
+    m_lastFrameTime = now;
+    m_clockStarted = true;
+
+    m_history[m_historyHead] = frameMs;
+    m_historyHead = (m_historyHead + 1) % kHistorySize;
+    m_smoothedFrameMs += (frameMs - m_smoothedFrameMs) *
+                         (m_smoothedFrameMs > 0.0f ? kFrameMsSmoothing : 1.0f);
+
+    if (!m_visible) {
+        return;
+    }
+
+    // The overlay pipeline is tied to the render pass; rebuild after a
+    // swapchain recreation handed us a new one (viewport is dynamic, so
+    // extent changes alone don't invalidate it)
+    if (renderPass != m_builtRenderPass) {
+        m_pipeline = std::make_shared<Pipeline>(
+            m_device.getDevice(), renderPass, m_pipelineLayout, extent,
+            m_drawConfig, m_pipelineManager.getPipelineCacheHandle());
+        m_builtRenderPass = renderPass;
+    }
+
+    m_ndcScaleX = 2.0f / float(extent.width);
+    m_ndcScaleY = 2.0f / float(extent.height);
+
+    auto* vertices = static_cast<OverlayVertex*>(m_vertexBuffers[frameIndex]->getMappedData());
+    uint32_t count = 0;
+
+    const auto& timings = GpuProfiler::get().getTimings();
+    MemoryManager::MemoryStats memory = m_memoryManager->getMemoryStats();
+
+    // Backdrop sized to the text block plus the graph
+    uint32_t lineCount = 4 + static_cast<uint32_t>(timings.size());
+    float graphWidth = float(kHistorySize) * kGraphBarWidth;
+    float blockWidth = std::max(42.0f * kGlyphSize / 2.0f, graphWidth) + 2.0f * kMargin;
+    float textBottom = kMargin + float(lineCount) * kLineHeight;
+    float graphTop = textBottom + kMargin;
+    pushRect(vertices, count, 0.0f, 0.0f,
+             blockWidth, graphTop + kGraphHeight + kMargin, kColorBackdrop);
+
+    // Text lines: FPS, draw counters, display waits, VRAM, then one line
+    // per GPU scope.
+    // Fixed stack buffers keep the refill allocation-free.
+    char line[96];
+    float y = kMargin;
+
+    float fps = m_smoothedFrameMs > 0.0f ? 1000.0f / m_smoothedFrameMs : 0.0f;
+    std::snprintf(line, sizeof(line), "FPS %.0f  %.2f MS", fps, m_smoothedFrameMs);
+    pushText(vertices, count, kMargin, y, line,
+             m_smoothedFrameMs < 16.7f ? kColorGood
+                 : (m_smoothedFrameMs < kGraphMaxMs ? kColorWarn : kColorBad));
+    y += kLineHeight;
+
+    std::snprintf(line, sizeof(line), "DRAWS %u  CULLED %u  BATCHES %u",
+                  stats.drawCalls, stats.culledDraws, stats.instancedBatches);
+    pushText(vertices, count, kMargin, y, line, kColorText);
+    y += kLineHeight;
+
+    // Where the frame actually waits on the display: acquire block (zero
+    // when the acquire-ahead covered it) and present/present-wait block
+    std::snprintf(line, sizeof(line), "WAIT ACQ %.2f  PRS %.2f MS",
+                  stats.acquireWaitMs, stats.presentWaitMs);
+    pushText(vertices, count, kMargin, y, line, kColorDim);
+    y += kLineHeight;
+
+    constexpr double mb = 1.0 / (1024.0 * 1024.0);
+    std::snprintf(line, sizeof(line), "VRAM %.1f MB  BUF %.1f  IMG %.1f",
+                  double(memory.totalAllocated) * mb,
+                  double(memory.bufferBytes) * mb,
+                  double(memory.imageBytes) * mb);
+    pushText(vertices, count, kMargin, y, line, kColorText);
+    y += kLineHeight;
+
+    for (const auto& timing : timings) {
+        std::snprintf(line, sizeof(line), "GPU %s %.2f MS",
+                      timing.name.c_str(), timing.milliseconds);
+        pushText(vertices, count, kMargin, y, line, kColorDim);
+        y += kLineHeight;
+    }
+
+    // Frame-time graph: one bar per history sample, oldest on the left,
+    // colored by frame budget
+    float graphBottom = graphTop + kGraphHeight;
+    for (uint32_t i = 0; i < kHistorySize; ++i) {
+        float sampleMs = m_history[(m_historyHead + i) % kHistorySize];
+        float height = std::min(sampleMs / kGraphMaxMs, 1.0f) * kGraphHeight;
+        uint32_t color = sampleMs < 16.7f ? kColorGood
+                             : (sampleMs < kGraphMaxMs ? kColorWarn : kColorBad);
+        float x = kMargin + float(i) * kGraphBarWidth;
+        pushRect(vertices, count, x, graphBottom - height,
+                 x + kGraphBarWidth, graphBottom, color);
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline->getPipeline());
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                            m_pipelineLayout, 0, 1, &m_fontSet, 0, nullptr);
+
+    VkBuffer buffer = m_vertexBuffers[frameIndex]->getHandle();
+    VkDeviceSize offset = 0;
+    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &buffer, &offset);
+    vkCmdDraw(commandBuffer, count, 1, 0, 0);
+}
+
+} // namespace vkeng
@@ -1,72 +1,228 @@
 #include "vulkan-engine/rendering/Vertex.hpp"
+#include "vulkan-engine/rendering/VertexFormatTraits.hpp"
 #include <glm/geometric.hpp>
+#include <glm/gtc/packing.hpp>
 #include <cmath>
 
 namespace vkeng {
 
+    namespace {
+        /** @brief Copies a format's constexpr attribute table into the vector API. */
+        template<VertexFormat Format>
+        std::vector<VkVertexInputAttributeDescription> attributesFromTraits() {
+            const auto* table = VertexFormatTraits<Format>::kAttributes;
+            return std::vector<VkVertexInputAttributeDescription>(
+                table, table + vertexAttributeCount<Format>());
+        }
+    }
+
+    // ============================================================================
+    // Vertex Format Descriptors
+    // ============================================================================
+
+    /**
+     * @brief Binding description for a vertex format.
+     * @details Thin lookup into the compile-time registry; the layouts
+     * themselves live in VertexFormatTraits.hpp.
+     */
+    VkVertexInputBindingDescription getVertexBindingDescription(VertexFormat format) {
+        switch (format) {
+            case VertexFormat::Fat:      return vertexBindingDescription<VertexFormat::Fat>();
+            case VertexFormat::Compact:  return vertexBindingDescription<VertexFormat::Compact>();
+            case VertexFormat::Particle: return vertexBindingDescription<VertexFormat::Particle>();
+            case VertexFormat::Overlay:  return vertexBindingDescription<VertexFormat::Overlay>();
+        }
+        return vertexBindingDescription<VertexFormat::Fat>();
+    }
+
+    /**
+     * @brief Attribute descriptions for a vertex format.
+     * @details The shaders declare float inputs; Vulkan expands
+     * unorm/snorm/half attribute formats to float at fetch time, so the
+     * compact layout feeds the same shaders as the fat one. The tables
+     * come precomputed from VertexFormatTraits.hpp.
+     */
+    std::vector<VkVertexInputAttributeDescription> getVertexAttributeDescriptions(VertexFormat format) {
+        switch (format) {
+            case VertexFormat::Fat:      return attributesFromTraits<VertexFormat::Fat>();
+            case VertexFormat::Compact:  return attributesFromTraits<VertexFormat::Compact>();
+            case VertexFormat::Particle: return attributesFromTraits<VertexFormat::Particle>();
+            case VertexFormat::Overlay:  return attributesFromTraits<VertexFormat::Overlay>();
+        }
+        return attributesFromTraits<VertexFormat::Fat>();
+    }
+
+    // ============================================================================
+    // CompactVertex Implementation
+    // ============================================================================
+
+    /**
+     * @brief Quantizes a fat vertex into the compact layout.
+     * @details Normals and tangents are unit-length, so 10-bit snorm keeps
+     * ~3 decimal digits of direction precision; half-float UVs are exact
+     * for the common 0..1 range at texture resolutions up to 2048.
+     */
+    CompactVertex CompactVertex::pack(const Vertex& vertex) {
+        CompactVertex compact;
+        compact.pos = vertex.pos;
+        compact.color = glm::packUnorm4x8(glm::vec4(vertex.color, 1.0f));
+        compact.texCoord = glm::packHalf2x16(vertex.texCoord);
+        compact.normal = glm::packSnorm3x10_1x2(glm::vec4(vertex.normal, 0.0f));
+        compact.tangent = glm::packSnorm3x10_1x2(vertex.tangent);
+        return compact;
+    }
+
     // ============================================================================
     // Vertex Implementation
     // ============================================================================
 
     /**
      * @brief Gets the binding description for the Vertex struct.
-     * @details This tells Vulkan how to pass an array of this struct to the vertex shader.
-     * It specifies the binding index, the stride (size of the struct), and whether
-     * the data is per-vertex or per-instance.
+     * @details Delegates to the fat layout's registry entry; the binding,
+     * stride, and rate are validated at compile time in VertexFormatTraits.hpp.
      * @return A Vulkan vertex input binding description.
      */
     VkVertexInputBindingDescription Vertex::getBindingDescription() {
+        return vertexBindingDescription<VertexFormat::Fat>();
+    }
+
+    /**
+     * @brief Gets the attribute descriptions for the Vertex struct.
+     * @details The locations match the `layout(location = ...)` declarations
+     * in shader.vert; the table itself lives in VertexFormatTraits.hpp.
+     * @return A vector of Vulkan vertex input attribute descriptions.
+     */
+    std::vector<VkVertexInputAttributeDescription> Vertex::getAttributeDescriptions() {
+        return attributesFromTraits<VertexFormat::Fat>();
+    }
+
+    // ============================================================================
+    // InstanceData Implementation
+    // ============================================================================
+
+    /**
+     * @brief Gets the binding description for the per-instance stream.
+     * @details Binding 1 advances once per instance rather than once per vertex.
+     * @return A Vulkan vertex input binding description for the instance stream.
+     */
+    VkVertexInputBindingDescription InstanceData::getBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 1;
+        bindingDescription.stride = sizeof(InstanceData);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+        return bindingDescription;
+    }
+
+    /**
+     * @brief Gets the attribute descriptions for the per-instance stream.
+     * @details A mat4 attribute consumes four consecutive locations, one vec4
+     * column each (locations 5-8, matching shader_instanced.vert).
+     * @return Attribute descriptions for the instance model matrix.
+     */
+    std::vector<VkVertexInputAttributeDescription> InstanceData::getAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(4);
+
+        for (uint32_t column = 0; column < 4; column++) {
+            attributeDescriptions[column].binding = 1;
+            attributeDescriptions[column].location = 5 + column;
+            attributeDescriptions[column].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            attributeDescriptions[column].offset = static_cast<uint32_t>(
+                offsetof(InstanceData, model) + column * sizeof(glm::vec4));
+        }
+
+        return attributeDescriptions;
+    }
+
+    // ============================================================================
+    // SkinVertex Implementation
+    // ============================================================================
+
+    /**
+     * @brief Gets the binding description for the skinning stream.
+     * @details Binding 1 at per-vertex rate, paired with the mesh's regular
+     * stream on binding 0.
+     * @return A Vulkan vertex input binding description for the skin stream.
+     */
+    VkVertexInputBindingDescription SkinVertex::getBindingDescription() {
         VkVertexInputBindingDescription bindingDescription{};
-        bindingDescription.binding = 0;
-        bindingDescription.stride = sizeof(Vertex);
+        bindingDescription.binding = 1;
+        bindingDescription.stride = sizeof(SkinVertex);
         bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
 
         return bindingDescription;
     }
 
     /**
-     * @brief Gets the attribute descriptions for the Vertex struct.
-     * @details This describes each member of the struct to Vulkan, including its
-     * location (matching the `layout(location = ...)` in the shader), its format
-     * (e.g., vec3 is VK_FORMAT_R32G32B32_SFLOAT), and its offset within the struct.
-     * @return A vector of Vulkan vertex input attribute descriptions.
+     * @brief Gets the attribute descriptions for the skinning stream.
+     * @details Joint indices as an integer attribute (no float conversion)
+     * and blend weights as a vec4, locations 5-6 matching skinned.vert.
+     * @return Attribute descriptions for the joint/weight pair.
      */
-    std::vector<VkVertexInputAttributeDescription> Vertex::getAttributeDescriptions() {
-        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(5);
-
-        // Position attribute
-        attributeDescriptions[0].binding = 0;
-        attributeDescriptions[0].location = 0;
-        attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
-        attributeDescriptions[0].offset = offsetof(Vertex, pos);
-
-        // Color attribute
-        attributeDescriptions[1].binding = 0;
-        attributeDescriptions[1].location = 1;
-        attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-        attributeDescriptions[1].offset = offsetof(Vertex, color);
-
-        // Texture coordinate attribute
-        attributeDescriptions[2].binding = 0;
-        attributeDescriptions[2].location = 2;
-        attributeDescriptions[2].format = VK_FORMAT_R32G32_SFLOAT;
-        attributeDescriptions[2].offset = offsetof(Vertex, texCoord);
-
-        // Normal attribute
-        attributeDescriptions[3].binding = 0;
-        attributeDescriptions[3].location = 3;
-        attributeDescriptions[3].format = VK_FORMAT_R32G32B32_SFLOAT;
-        attributeDescriptions[3].offset = offsetof(Vertex, normal);
-
-        // Tangent attribute (vec4: xyz = tangent direction, w = bitangent sign)
-        attributeDescriptions[4].binding = 0;
-        attributeDescriptions[4].location = 4;
-        attributeDescriptions[4].format = VK_FORMAT_R32G32B32A32_SFLOAT;
-        attributeDescriptions[4].offset = offsetof(Vertex, tangent);
+    std::vector<VkVertexInputAttributeDescription> SkinVertex::getAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(2);
+
+        attributeDescriptions[0].binding = 1;
+        attributeDescriptions[0].location = 5;
+        attributeDescriptions[0].format = VK_FORMAT_R32G32B32A32_UINT;
+        attributeDescriptions[0].offset = offsetof(SkinVertex, joints);
+
+        attributeDescriptions[1].binding = 1;
+        attributeDescriptions[1].location = 6;
+        attributeDescriptions[1].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+        attributeDescriptions[1].offset = offsetof(SkinVertex, weights);
 
         return attributeDescriptions;
     }
 
+    // ============================================================================
+    // OverlayVertex Implementation
+    // ============================================================================
+
+    /**
+     * @brief Gets the binding description for the overlay stream.
+     * @return A Vulkan vertex input binding description for HUD vertices.
+     */
+    VkVertexInputBindingDescription OverlayVertex::getBindingDescription() {
+        return vertexBindingDescription<VertexFormat::Overlay>();
+    }
+
+    /**
+     * @brief Gets the attribute descriptions for the overlay stream.
+     * @details NDC position and UV as float pairs, color as RGBA8 unorm
+     * expanded to float at fetch; see the registry entry for the layout.
+     * @return Attribute descriptions for the overlay vertex.
+     */
+    std::vector<VkVertexInputAttributeDescription> OverlayVertex::getAttributeDescriptions() {
+        return attributesFromTraits<VertexFormat::Overlay>();
+    }
+
+    // ============================================================================
+    // ParticleInstance Implementation
+    // ============================================================================
+
+    /**
+     * @brief Gets the binding description for the particle stream.
+     * @details Binding 0 at per-instance rate: each particle quad reads one
+     * ParticleInstance, and the six quad corners are derived from
+     * gl_VertexIndex inside particle.vert.
+     * @return A Vulkan vertex input binding description for the particle stream.
+     */
+    VkVertexInputBindingDescription ParticleInstance::getBindingDescription() {
+        return vertexBindingDescription<VertexFormat::Particle>();
+    }
+
+    /**
+     * @brief Gets the attribute descriptions for the particle stream.
+     * @details Three vec4 attributes at locations 0-2 (position+size,
+     * velocity+life, color+max life), matching particle.vert; see the
+     * registry entry for the layout.
+     * @return Attribute descriptions for the per-particle data.
+     */
+    std::vector<VkVertexInputAttributeDescription> ParticleInstance::getAttributeDescriptions() {
+        return attributesFromTraits<VertexFormat::Particle>();
+    }
+
     void Vertex::computeTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
         // Accumulate per-vertex tangent and bitangent from triangle UV gradients
         std::vector<glm::vec3> tan1(vertices.size(), glm::vec3(0.0f));
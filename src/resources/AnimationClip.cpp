@@ -0,0 +1,114 @@
+/**
+ * @file AnimationClip.cpp
+ * @brief Implementation of uniformly sampled animation tracks
+ */
+
+#include "vulkan-engine/resources/AnimationClip.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vkeng {
+
+AnimationClip::AnimationClip(uint32_t jointCount, uint32_t frameCount, float sampleRate)
+    : m_jointCount(jointCount)
+    , m_frameCount(frameCount > 0 ? frameCount : 1)
+    , m_sampleRate(sampleRate > 0.0f ? sampleRate : 30.0f) {
+    const size_t total = size_t(m_jointCount) * m_frameCount;
+    m_px.resize(total, 0.0f);
+    m_py.resize(total, 0.0f);
+    m_pz.resize(total, 0.0f);
+    m_qx.resize(total, 0.0f);
+    m_qy.resize(total, 0.0f);
+    m_qz.resize(total, 0.0f);
+    m_qw.resize(total, 1.0f);
+    m_sx.resize(total, 1.0f);
+    m_sy.resize(total, 1.0f);
+    m_sz.resize(total, 1.0f);
+}
+
+void AnimationClip::setJointSample(uint32_t frame, uint32_t joint,
+                                   const glm::vec3& translation,
+                                   const glm::quat& rotation,
+                                   const glm::vec3& scale) {
+    if (frame >= m_frameCount || joint >= m_jointCount) {
+        LOG_WARN(GENERAL, "AnimationClip: sample ({}, {}) out of range, ignored", frame, joint);
+        return;
+    }
+    const size_t i = size_t(frame) * m_jointCount + joint;
+
+    glm::quat q = rotation;
+    // Hemisphere correction against the previous frame so runtime nlerp
+    // always interpolates the short way
+    if (frame > 0) {
+        const size_t prev = i - m_jointCount;
+        const float dot = q.x * m_qx[prev] + q.y * m_qy[prev] +
+                          q.z * m_qz[prev] + q.w * m_qw[prev];
+        if (dot < 0.0f) {
+            q = -q;
+        }
+    }
+
+    m_px[i] = translation.x;
+    m_py[i] = translation.y;
+    m_pz[i] = translation.z;
+    m_qx[i] = q.x;
+    m_qy[i] = q.y;
+    m_qz[i] = q.z;
+    m_qw[i] = q.w;
+    m_sx[i] = scale.x;
+    m_sy[i] = scale.y;
+    m_sz[i] = scale.z;
+}
+
+void AnimationClip::samplePose(float time, bool looping,
+                               float* px, float* py, float* pz,
+                               float* qx, float* qy, float* qz, float* qw,
+                               float* sx, float* sy, float* sz) const {
+    const float lastFrame = static_cast<float>(m_frameCount - 1);
+    float framePos = time * m_sampleRate;
+    if (looping && lastFrame > 0.0f) {
+        framePos = std::fmod(framePos, lastFrame);
+        if (framePos < 0.0f) {
+            framePos += lastFrame;
+        }
+    } else {
+        framePos = std::clamp(framePos, 0.0f, lastFrame);
+    }
+
+    const uint32_t frame0 = static_cast<uint32_t>(framePos);
+    const uint32_t frame1 = (frame0 + 1 < m_frameCount) ? frame0 + 1 : frame0;
+    const float t = framePos - static_cast<float>(frame0);
+
+    const size_t a = size_t(frame0) * m_jointCount;
+    const size_t b = size_t(frame1) * m_jointCount;
+    const uint32_t n = m_jointCount;
+
+    // Plain per-channel lerps over contiguous runs — one fused loop per
+    // channel pair keeps this trivially auto-vectorizable
+    for (uint32_t j = 0; j < n; j++) {
+        px[j] = m_px[a + j] + (m_px[b + j] - m_px[a + j]) * t;
+        py[j] = m_py[a + j] + (m_py[b + j] - m_py[a + j]) * t;
+        pz[j] = m_pz[a + j] + (m_pz[b + j] - m_pz[a + j]) * t;
+        sx[j] = m_sx[a + j] + (m_sx[b + j] - m_sx[a + j]) * t;
+        sy[j] = m_sy[a + j] + (m_sy[b + j] - m_sy[a + j]) * t;
+        sz[j] = m_sz[a + j] + (m_sz[b + j] - m_sz[a + j]) * t;
+    }
+
+    // Nlerp + renormalize (hemisphere was fixed at bake time)
+    for (uint32_t j = 0; j < n; j++) {
+        float x = m_qx[a + j] + (m_qx[b + j] - m_qx[a + j]) * t;
+        float y = m_qy[a + j] + (m_qy[b + j] - m_qy[a + j]) * t;
+        float z = m_qz[a + j] + (m_qz[b + j] - m_qz[a + j]) * t;
+        float w = m_qw[a + j] + (m_qw[b + j] - m_qw[a + j]) * t;
+        const float len = std::sqrt(x * x + y * y + z * z + w * w);
+        const float inv = (len > 0.0f) ? 1.0f / len : 1.0f;
+        qx[j] = x * inv;
+        qy[j] = y * inv;
+        qz[j] = z * inv;
+        qw[j] = w * inv;
+    }
+}
+
+} // namespace vkeng
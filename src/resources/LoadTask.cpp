@@ -0,0 +1,58 @@
+#include "vulkan-engine/resources/LoadTask.hpp"
+
+#include <iterator>
+
+namespace vkeng {
+
+    LoadTaskScheduler& LoadTaskScheduler::get() {
+        static LoadTaskScheduler instance;
+        return instance;
+    }
+
+    void LoadTaskScheduler::dispatch(TaskThread thread, std::function<void()> fn) {
+        if (thread == TaskThread::Worker) {
+            JobSystem::get().schedule(std::move(fn));
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_mainQueue.push_back(std::move(fn));
+    }
+
+    void LoadTaskScheduler::addPoll(std::function<bool()> poll) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_polls.push_back(std::move(poll));
+    }
+
+    void LoadTaskScheduler::pumpMainThread() {
+        // Move the work out before running it: completions fired from these
+        // steps re-enter dispatch()/addPoll() and must not deadlock.
+        std::vector<std::function<void()>> steps;
+        std::vector<std::function<bool()>> polls;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            steps.swap(m_mainQueue);
+            polls.swap(m_polls);
+        }
+
+        for (auto& step : steps) {
+            step();
+        }
+
+        std::vector<std::function<bool()>> unfinished;
+        unfinished.reserve(polls.size());
+        for (auto& poll : polls) {
+            if (!poll()) {
+                unfinished.push_back(std::move(poll));
+            }
+        }
+        if (!unfinished.empty()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Polls registered while pumping were appended to m_polls;
+            // put the survivors back alongside them
+            m_polls.insert(m_polls.end(),
+                           std::make_move_iterator(unfinished.begin()),
+                           std::make_move_iterator(unfinished.end()));
+        }
+    }
+
+} // namespace vkeng
@@ -1,4 +1,5 @@
 #include "vulkan-engine/resources/Material.hpp"
+#include "vulkan-engine/rendering/BindlessTextures.hpp"
 #include "vulkan-engine/rendering/DescriptorSet.hpp"
 #include "vulkan-engine/resources/Texture.hpp"
 #include "vulkan-engine/core/Logger.hpp"
@@ -57,4 +58,61 @@ void Material::createDescriptorSet(VkDevice device,
               m_textures.emissive ? "custom" : "fallback");
 }
 
+glm::uvec4 Material::getBindlessIndices() {
+    if (m_bindlessRegistered) {
+        return m_bindlessIndices;
+    }
+
+    auto& bindless = BindlessTextureManager::get();
+
+    // Register each present texture; missing slots use the reserved
+    // fallback indices the app registered at initialization
+    auto slot = [&bindless](const std::shared_ptr<Texture>& texture, uint32_t fallbackIndex) {
+        if (!texture) {
+            return fallbackIndex;
+        }
+        uint32_t index = bindless.registerTexture(texture->getImageView(), texture->getSampler());
+        return (index != UINT32_MAX) ? index : fallbackIndex;
+    };
+
+    uint32_t baseColor         = slot(m_textures.baseColor, BINDLESS_FALLBACK_WHITE);
+    uint32_t normal            = slot(m_textures.normal, BINDLESS_FALLBACK_FLAT_NORMAL);
+    uint32_t metallicRoughness = slot(m_textures.metallicRoughness, BINDLESS_FALLBACK_METALLIC_ROUGHNESS);
+    uint32_t occlusion         = slot(m_textures.occlusion, BINDLESS_FALLBACK_WHITE);
+    uint32_t emissive          = slot(m_textures.emissive, BINDLESS_FALLBACK_WHITE);
+
+    // Packing convention documented on BindlessPushConstants
+    m_bindlessIndices = glm::uvec4(
+        baseColor | (normal << 16),
+        metallicRoughness | (occlusion << 16),
+        emissive,
+        0);
+    m_bindlessRegistered = true;
+    return m_bindlessIndices;
+}
+
+const MaterialParameterBlock& Material::getParameterBlock() const {
+    if (m_parametersDirty) {
+        m_parameterBlock.baseColorFactor = m_factors.baseColorFactor;
+        // Cutoff only participates in Mask mode; 0 disables the shader test
+        float alphaCutoff = (m_alphaMode == AlphaMode::Mask) ? m_factors.alphaCutoff : 0.0f;
+        m_parameterBlock.emissiveFactor = glm::vec4(m_factors.emissiveFactor, alphaCutoff);
+        m_parameterBlock.specularColorAndShininess = glm::vec4(m_factors.specularColor, m_factors.shininess);
+        m_parameterBlock.pbrFactors = glm::vec4(m_factors.metallicFactor, m_factors.roughnessFactor,
+                                                m_factors.normalScale, m_factors.occlusionStrength);
+        m_parameterBlock.uvScaleOffset = getUvScaleOffset();
+        m_parametersDirty = false;
+    }
+    return m_parameterBlock;
+}
+
+glm::vec4 Material::getUvScaleOffset() const {
+    // Atlased materials are packed with all their textures sharing one
+    // region layout, so the base color texture's remap covers every slot.
+    if (m_textures.baseColor && m_textures.baseColor->isAtlasRegion()) {
+        return m_textures.baseColor->getUvScaleOffset();
+    }
+    return glm::vec4(1.f, 1.f, 0.f, 0.f);
+}
+
 } // namespace vkeng
\ No newline at end of file
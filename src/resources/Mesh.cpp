@@ -12,17 +12,59 @@ namespace vkeng {
            std::shared_ptr<MemoryManager> memoryManager, 
            const std::vector<Vertex>& vertices, 
               const std::vector<uint32_t>& indices,
-              MeshNormalSource normalSource)
+              MeshNormalSource normalSource,
+              VertexFormat vertexFormat)
         : Resource(name), // <-- Call the base class constructor
           m_memoryManager(memoryManager),
-          m_normalSource(normalSource) {
+          m_normalSource(normalSource),
+          m_vertexFormat(vertexFormat) {
 
         m_vertexCount = static_cast<uint32_t>(vertices.size());
         m_indexCount = static_cast<uint32_t>(indices.size());
 
         calculateBounds(vertices);
-        createVertexBuffers(vertices);
-        createIndexBuffers(indices);
+        createBuffers(vertices.data(), vertices.size(), indices.data(), indices.size());
+
+        // Retained so StaticBatcher can bake this mesh into a merged buffer;
+        // apps that never batch can call releaseCpuData() to reclaim it
+        m_cpuVertices = vertices;
+        m_cpuIndices = indices;
+
+        m_handle = HandlePool<Mesh>::get().add(this);
+    }
+
+    /**
+     * @brief Constructs a Mesh from raw pre-baked data with precomputed bounds.
+     *
+     * Used by the mesh cache path: the blobs come straight out of a mapped
+     * file, so no bounds pass or intermediate build vectors are needed.
+     */
+    Mesh::Mesh(const std::string& name,
+           std::shared_ptr<MemoryManager> memoryManager,
+           const Vertex* vertices, size_t vertexCount,
+           const uint32_t* indices, size_t indexCount,
+           MeshNormalSource normalSource,
+           const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+           float boundingRadius,
+           VertexFormat vertexFormat)
+        : Resource(name),
+          m_memoryManager(memoryManager),
+          m_boundsMin(boundsMin),
+          m_boundsMax(boundsMax),
+          m_boundingRadius(boundingRadius),
+          m_normalSource(normalSource),
+          m_vertexFormat(vertexFormat) {
+
+        m_vertexCount = static_cast<uint32_t>(vertexCount);
+        m_indexCount = static_cast<uint32_t>(indexCount);
+
+        createBuffers(vertices, vertexCount, indices, indexCount);
+
+        // Keep a CPU copy for static batching, same as the vector constructor
+        m_cpuVertices.assign(vertices, vertices + vertexCount);
+        m_cpuIndices.assign(indices, indices + indexCount);
+
+        m_handle = HandlePool<Mesh>::get().add(this);
     }
 
     void Mesh::calculateBounds(const std::vector<Vertex>& vertices) {
@@ -51,46 +93,167 @@ namespace vkeng {
         m_boundingRadius = std::sqrt(maxRadiusSquared);
     }
 
+    Mesh::~Mesh() {
+        // Stale outstanding handles first, so draw-path lookups can never
+        // resolve to a mesh that is mid-destruction
+        HandlePool<Mesh>::get().remove(m_handle);
+
+        // Pool ranges are returned explicitly; dedicated buffers release
+        // through their shared_ptrs as before
+        MeshBufferPool::get().free(m_poolAllocation);
+    }
+
     /**
-     * @brief Creates the vertex buffer and uploads data, potentially via a staging buffer.
+     * @brief Uploads geometry into the shared pool, or dedicated buffers as fallback.
+     *
+     * When the MeshBufferPool is wired up, the mesh becomes a pair of byte
+     * ranges inside a large shared buffer: draws sorted by pool block can
+     * share vertex/index bindings, and the offsets enable indirect draws.
+     * Meshes created before the pool exists (or if the pool is full and
+     * cannot grow) keep their own VkBuffer pair.
      */
-    void Mesh::createVertexBuffers(const std::vector<Vertex>& vertices) {
-        VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
+    void Mesh::createBuffers(const Vertex* vertices, size_t vertexCount,
+                             const uint32_t* indices, size_t indexCount) {
+        // Compact meshes quantize into the 28-byte layout before upload;
+        // the fat CPU copy kept for static batching is unaffected
+        std::vector<CompactVertex> compactVertices;
+        const void* vertexData = vertices;
+        VkDeviceSize vertexBytes = sizeof(Vertex) * vertexCount;
+        if (m_vertexFormat == VertexFormat::Compact) {
+            compactVertices.reserve(vertexCount);
+            for (size_t i = 0; i < vertexCount; i++) {
+                compactVertices.push_back(CompactVertex::pack(vertices[i]));
+            }
+            vertexData = compactVertices.data();
+            vertexBytes = sizeof(CompactVertex) * vertexCount;
+        }
+
+        // Small meshes (the common case for props) halve their index
+        // bandwidth with 16-bit indices; the type is bound per-mesh so no
+        // pipeline state depends on it
+        std::vector<uint16_t> narrowIndices;
+        const void* indexData = indices;
+        VkDeviceSize indexBytes = sizeof(uint32_t) * indexCount;
+        if (vertexCount <= UINT16_MAX) {
+            narrowIndices.reserve(indexCount);
+            for (size_t i = 0; i < indexCount; i++) {
+                narrowIndices.push_back(static_cast<uint16_t>(indices[i]));
+            }
+            indexData = narrowIndices.data();
+            indexBytes = sizeof(uint16_t) * indexCount;
+            m_indexType = VK_INDEX_TYPE_UINT16;
+        }
+
+        m_gpuBytes = vertexBytes + indexBytes;
+
+        auto& pool = MeshBufferPool::get();
+        if (pool.isInitialized()) {
+            // Stride-aligned so the mesh sits on a whole-vertex boundary:
+            // indirect multi-draw buckets address pooled meshes via
+            // firstIndex/vertexOffset from a block bound at offset zero
+            const VkDeviceSize vertexStride = m_vertexFormat == VertexFormat::Compact
+                ? sizeof(CompactVertex) : sizeof(Vertex);
+            auto allocResult = pool.allocate(vertexBytes, indexBytes, vertexStride);
+            if (allocResult) {
+                m_poolAllocation = allocResult.getValue();
+
+                auto vertexBuffer = pool.getVertexBuffer(m_poolAllocation.blockIndex);
+                auto indexBuffer = pool.getIndexBuffer(m_poolAllocation.blockIndex);
+                m_memoryManager->uploadToBuffer(vertexBuffer, vertexData, vertexBytes,
+                                                m_poolAllocation.vertexOffset);
+                m_memoryManager->uploadToBuffer(indexBuffer, indexData, indexBytes,
+                                                m_poolAllocation.indexOffset);
+                return;
+            }
+        }
+
+        createVertexBuffers(vertexData, vertexBytes);
+        createIndexBuffers(indexData, indexBytes);
+    }
 
-        auto vertexBufferResult = m_memoryManager->createVertexBuffer(bufferSize, true /* hostVisible */);
+    /**
+     * @brief Creates the vertex buffer and uploads data, potentially via a staging buffer.
+     * @details Takes pre-sized bytes so the same path serves fat and compact layouts.
+     */
+    void Mesh::createVertexBuffers(const void* vertexData, VkDeviceSize vertexBytes) {
+        auto vertexBufferResult = m_memoryManager->createVertexBuffer(vertexBytes, true /* hostVisible */);
         if (!vertexBufferResult) {
             throw std::runtime_error("Failed to create vertex buffer for mesh!");
         }
         m_vertexBuffer = vertexBufferResult.getValue();
 
-        m_memoryManager->uploadToBuffer(m_vertexBuffer, vertices.data(), bufferSize);
+        m_memoryManager->uploadToBuffer(m_vertexBuffer, vertexData, vertexBytes);
+        // Bound by handle every draw — safe to relocate during defragmentation
+        m_memoryManager->markRelocatable(m_vertexBuffer);
     }
 
     /**
      * @brief Creates the index buffer and uploads data.
+     * @details Takes pre-sized bytes so the same path serves 16- and 32-bit indices.
      */
-    void Mesh::createIndexBuffers(const std::vector<uint32_t>& indices) {
-        VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
-
-        auto indexBufferResult = m_memoryManager->createIndexBuffer(bufferSize, true /* hostVisible */);
+    void Mesh::createIndexBuffers(const void* indexData, VkDeviceSize indexBytes) {
+        auto indexBufferResult = m_memoryManager->createIndexBuffer(indexBytes, true /* hostVisible */);
         if (!indexBufferResult) {
             throw std::runtime_error("Failed to create index buffer for mesh!");
         }
         m_indexBuffer = indexBufferResult.getValue();
 
-        m_memoryManager->uploadToBuffer(m_indexBuffer, indices.data(), bufferSize);
+        m_memoryManager->uploadToBuffer(m_indexBuffer, indexData, indexBytes);
+        m_memoryManager->markRelocatable(m_indexBuffer);
+    }
+
+    /**
+     * @brief Drops the GPU-side geometry, keeping the CPU copy for reload.
+     *
+     * Pool ranges go back to the pool's free lists; dedicated buffers
+     * release through their shared_ptrs. The mesh stays usable — the next
+     * ensureResident() re-runs the upload path from the CPU copy.
+     */
+    void Mesh::evictGpuData() {
+        if (!hasCpuData() || !isResident()) {
+            return;
+        }
+        MeshBufferPool::get().free(m_poolAllocation);
+        m_poolAllocation = MeshPoolAllocation{};
+        m_vertexBuffer.reset();
+        m_indexBuffer.reset();
+    }
+
+    /**
+     * @brief Re-uploads evicted geometry from the retained CPU copy.
+     */
+    void Mesh::ensureResident() {
+        if (isResident() || !hasCpuData()) {
+            return;
+        }
+        createBuffers(m_cpuVertices.data(), m_cpuVertices.size(),
+                      m_cpuIndices.data(), m_cpuIndices.size());
     }
 
     /**
      * @brief Binds the mesh's vertex and index buffers to the command buffer for a draw call.
      */
     void Mesh::bind(VkCommandBuffer commandBuffer) {
+        if (m_poolAllocation.isValid()) {
+            // Pooled: bind the shared block buffers at this mesh's offsets.
+            // Consecutive draws from the same block bind identical buffers,
+            // which the driver (and any redundant-bind filter) can elide.
+            auto& pool = MeshBufferPool::get();
+            VkBuffer vertexBuffers[] = {pool.getVertexBuffer(m_poolAllocation.blockIndex)->getHandle()};
+            VkDeviceSize offsets[] = {m_poolAllocation.vertexOffset};
+            vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+            vkCmdBindIndexBuffer(commandBuffer,
+                                 pool.getIndexBuffer(m_poolAllocation.blockIndex)->getHandle(),
+                                 m_poolAllocation.indexOffset, m_indexType);
+            return;
+        }
+
         VkBuffer vertexBuffers[] = {m_vertexBuffer->getHandle()};
         VkDeviceSize offsets[] = {0};
         // Bind the vertex buffer to binding point 0.
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
         // Bind the index buffer.
-        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer->getHandle(), 0, m_indexType);
     }
 
 } // namespace vkeng
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include "vulkan-engine/resources/MeshBufferPool.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace vkeng {
+
+    namespace {
+        /**
+         * Suballocation alignment. 16 bytes satisfies vertex attribute
+         * alignment for every format the engine uses and is a multiple of
+         * the 4-byte uint32 index type requirement. Vertex ranges are
+         * additionally aligned to lcm(stride, 16) when the caller passes
+         * a stride, so pooled meshes sit on whole-vertex boundaries.
+         */
+        constexpr VkDeviceSize kPoolAlignment = 16;
+
+        VkDeviceSize alignUp(VkDeviceSize value) {
+            return (value + kPoolAlignment - 1) & ~(kPoolAlignment - 1);
+        }
+    }
+
+    MeshBufferPool& MeshBufferPool::get() {
+        static MeshBufferPool instance;
+        return instance;
+    }
+
+    void MeshBufferPool::initialize(std::shared_ptr<MemoryManager> memoryManager,
+                                    VkDeviceSize vertexBlockBytes,
+                                    VkDeviceSize indexBlockBytes) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memoryManager = std::move(memoryManager);
+        m_vertexBlockBytes = vertexBlockBytes;
+        m_indexBlockBytes = indexBlockBytes;
+
+        LOG_INFO(MEMORY, "MeshBufferPool initialized ({} MB vertex / {} MB index per block)",
+                 vertexBlockBytes / (1024 * 1024), indexBlockBytes / (1024 * 1024));
+    }
+
+    Result<MeshPoolAllocation> MeshBufferPool::allocate(VkDeviceSize vertexBytes,
+                                                        VkDeviceSize indexBytes,
+                                                        VkDeviceSize vertexStride) {
+        if (vertexBytes == 0 || indexBytes == 0) {
+            return Result<MeshPoolAllocation>(Error("MeshBufferPool: zero-size allocation"));
+        }
+
+        const VkDeviceSize vertexSize = alignUp(vertexBytes);
+        const VkDeviceSize indexSize = alignUp(indexBytes);
+        const VkDeviceSize vertexAlign = vertexStride > 0
+            ? std::lcm(vertexStride, kPoolAlignment)
+            : kPoolAlignment;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_memoryManager) {
+            return Result<MeshPoolAllocation>(Error("MeshBufferPool: not initialized"));
+        }
+
+        // First fit: both ranges must come from the same block so a mesh is
+        // addressable with one buffer pair. If carving the index range fails
+        // after the vertex range succeeded, hand the vertex range back.
+        for (uint32_t blockIndex = 0; blockIndex < m_blocks.size(); blockIndex++) {
+            Block& block = m_blocks[blockIndex];
+
+            VkDeviceSize vertexOffset = 0;
+            if (!carveRange(block.vertexFree, vertexSize, vertexAlign, vertexOffset)) {
+                continue;
+            }
+
+            VkDeviceSize indexOffset = 0;
+            if (!carveRange(block.indexFree, indexSize, kPoolAlignment, indexOffset)) {
+                returnRange(block.vertexFree, vertexOffset, vertexSize);
+                continue;
+            }
+
+            return Result<MeshPoolAllocation>(
+                MeshPoolAllocation{ blockIndex, vertexOffset, vertexSize, indexOffset, indexSize });
+        }
+
+        // Nothing fits — add a block (sized up for oversized meshes)
+        auto blockResult = addBlock(vertexSize + vertexAlign, indexSize);
+        if (!blockResult) {
+            return Result<MeshPoolAllocation>(blockResult.getError());
+        }
+
+        uint32_t blockIndex = blockResult.getValue();
+        Block& block = m_blocks[blockIndex];
+
+        VkDeviceSize vertexOffset = 0;
+        VkDeviceSize indexOffset = 0;
+        if (!carveRange(block.vertexFree, vertexSize, vertexAlign, vertexOffset) ||
+            !carveRange(block.indexFree, indexSize, kPoolAlignment, indexOffset)) {
+            return Result<MeshPoolAllocation>(
+                Error("MeshBufferPool: fresh block cannot hold allocation"));
+        }
+
+        return Result<MeshPoolAllocation>(
+            MeshPoolAllocation{ blockIndex, vertexOffset, vertexSize, indexOffset, indexSize });
+    }
+
+    void MeshBufferPool::free(const MeshPoolAllocation& allocation) {
+        if (!allocation.isValid()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Meshes may outlive the pool during shutdown; their ranges died
+        // with the blocks, so there is nothing to return
+        if (allocation.blockIndex >= m_blocks.size()) {
+            return;
+        }
+
+        Block& block = m_blocks[allocation.blockIndex];
+        returnRange(block.vertexFree, allocation.vertexOffset, allocation.vertexSize);
+        returnRange(block.indexFree, allocation.indexOffset, allocation.indexSize);
+    }
+
+    std::shared_ptr<Buffer> MeshBufferPool::getVertexBuffer(uint32_t blockIndex) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return blockIndex < m_blocks.size() ? m_blocks[blockIndex].vertexBuffer : nullptr;
+    }
+
+    std::shared_ptr<Buffer> MeshBufferPool::getIndexBuffer(uint32_t blockIndex) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return blockIndex < m_blocks.size() ? m_blocks[blockIndex].indexBuffer : nullptr;
+    }
+
+    size_t MeshBufferPool::getBlockCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_blocks.size();
+    }
+
+    void MeshBufferPool::clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_blocks.clear();
+        m_memoryManager.reset();
+    }
+
+    bool MeshBufferPool::carveRange(std::vector<FreeRange>& freeList, VkDeviceSize size,
+                                    VkDeviceSize alignment, VkDeviceSize& outOffset) {
+        for (auto it = freeList.begin(); it != freeList.end(); ++it) {
+            // Aligning up may need front padding; the padding stays free
+            const VkDeviceSize alignedOffset =
+                ((it->offset + alignment - 1) / alignment) * alignment;
+            const VkDeviceSize padding = alignedOffset - it->offset;
+            if (it->size < size + padding) {
+                continue;
+            }
+
+            outOffset = alignedOffset;
+            const VkDeviceSize tailOffset = alignedOffset + size;
+            const VkDeviceSize tailSize = it->size - padding - size;
+
+            if (padding > 0) {
+                // Keep the front padding as its own free range
+                it->size = padding;
+                if (tailSize > 0) {
+                    freeList.insert(it + 1, FreeRange{ tailOffset, tailSize });
+                }
+            } else if (tailSize > 0) {
+                it->offset = tailOffset;
+                it->size = tailSize;
+            } else {
+                freeList.erase(it);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void MeshBufferPool::returnRange(std::vector<FreeRange>& freeList, VkDeviceSize offset,
+                                     VkDeviceSize size) {
+        // Insert sorted by offset, then merge with whichever neighbours
+        // touch the new range — freed mesh space compacts back into large
+        // contiguous spans instead of accumulating as fragments
+        auto it = std::lower_bound(freeList.begin(), freeList.end(), offset,
+            [](const FreeRange& range, VkDeviceSize value) { return range.offset < value; });
+        it = freeList.insert(it, FreeRange{ offset, size });
+
+        // Merge with the next range
+        auto next = it + 1;
+        if (next != freeList.end() && it->offset + it->size == next->offset) {
+            it->size += next->size;
+            it = freeList.erase(next) - 1;
+        }
+
+        // Merge with the previous range
+        if (it != freeList.begin()) {
+            auto prev = it - 1;
+            if (prev->offset + prev->size == it->offset) {
+                prev->size += it->size;
+                freeList.erase(it);
+            }
+        }
+    }
+
+    Result<uint32_t> MeshBufferPool::addBlock(VkDeviceSize vertexBytes, VkDeviceSize indexBytes) {
+        const VkDeviceSize vertexCapacity = std::max(m_vertexBlockBytes, vertexBytes);
+        const VkDeviceSize indexCapacity = std::max(m_indexBlockBytes, indexBytes);
+
+        auto vertexResult = m_memoryManager->createVertexBuffer(vertexCapacity, true /* hostVisible */);
+        if (!vertexResult) {
+            return Result<uint32_t>(vertexResult.getError());
+        }
+
+        auto indexResult = m_memoryManager->createIndexBuffer(indexCapacity, true /* hostVisible */);
+        if (!indexResult) {
+            return Result<uint32_t>(indexResult.getError());
+        }
+
+        Block block;
+        block.vertexBuffer = vertexResult.getValue();
+        block.indexBuffer = indexResult.getValue();
+        block.vertexFree.push_back(FreeRange{ 0, vertexCapacity });
+        block.indexFree.push_back(FreeRange{ 0, indexCapacity });
+
+        // Block buffers qualify for defragmentation: meshes bind them by
+        // handle at record time and no descriptor set ever references them
+        m_memoryManager->markRelocatable(block.vertexBuffer);
+        m_memoryManager->markRelocatable(block.indexBuffer);
+
+        m_blocks.push_back(std::move(block));
+
+        LOG_INFO(MEMORY, "MeshBufferPool: added block {} ({} MB vertex / {} MB index)",
+                 m_blocks.size() - 1,
+                 vertexCapacity / (1024 * 1024), indexCapacity / (1024 * 1024));
+
+        return Result<uint32_t>(static_cast<uint32_t>(m_blocks.size() - 1));
+    }
+
+} // namespace vkeng
@@ -0,0 +1,193 @@
+#include "vulkan-engine/resources/MeshCache.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace {
+    constexpr uint32_t kMeshCacheMagic = 0x564B4D48;  // 'VKMH'
+    // Version 2: meshlet blobs appended after the index blob
+    constexpr uint32_t kMeshCacheVersion = 2;
+
+    /**
+     * @brief On-disk header, followed by the vertex blob, the index blob,
+     *        then (version 2) the meshlet descriptor/vertex-list/triangle blobs.
+     *
+     * vertexStride guards against Vertex layout changes: a rebuilt engine
+     * with a different struct silently invalidates every cache file.
+     */
+    struct MeshCacheHeader {
+        uint32_t magic = kMeshCacheMagic;
+        uint32_t version = kMeshCacheVersion;
+        uint64_t sourceHash = 0;
+        uint32_t vertexStride = 0;
+        uint32_t normalSource = 0;
+        uint32_t missingNormalMode = 0;
+        uint32_t padding = 0;
+        uint64_t vertexCount = 0;
+        uint64_t indexCount = 0;
+        float boundsMin[3] = {0, 0, 0};
+        float boundsMax[3] = {0, 0, 0};
+        float boundingRadius = 0;
+        uint32_t padding2 = 0;                 // Keeps the uint64 fields below 8-aligned
+        uint64_t meshletCount = 0;             ///< Meshlet descriptors (0 = no meshlets baked)
+        uint64_t meshletVertexIndexCount = 0;  ///< Entries in the meshlet vertex lists
+        uint64_t meshletTriangleBytes = 0;     ///< Corner bytes in the meshlet triangle lists
+    };
+}
+
+namespace vkeng {
+
+    // ============================================================================
+    // MeshCache
+    // ============================================================================
+
+    std::string MeshCache::cachePathFor(const std::string& sourcePath) {
+        return sourcePath + ".vkmesh";
+    }
+
+    uint64_t MeshCache::hashFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return 0;
+        }
+
+        // FNV-1a, streamed in chunks: no parsing, just a linear read
+        uint64_t hash = 14695981039346656037ull;
+        char buffer[64 * 1024];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i) {
+                hash ^= static_cast<unsigned char>(buffer[i]);
+                hash *= 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    Result<MappedMesh> MeshCache::open(const std::string& cachePath,
+                                       uint64_t expectedSourceHash,
+                                       MissingNormalMode missingNormalMode) {
+        auto fileResult = FileMapping::open(cachePath);
+        if (!fileResult) {
+            return Result<MappedMesh>(Error("Mesh cache not found: " + cachePath));
+        }
+        FileMapping file = std::move(fileResult.getValue());
+        if (file.size() < sizeof(MeshCacheHeader)) {
+            return Result<MappedMesh>(Error("Mesh cache truncated: " + cachePath));
+        }
+        const size_t fileSize = file.size();
+
+        MeshCacheHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        bool valid = header.magic == kMeshCacheMagic
+                  && header.version == kMeshCacheVersion
+                  && header.sourceHash == expectedSourceHash
+                  && header.vertexStride == sizeof(Vertex)
+                  && header.missingNormalMode == static_cast<uint32_t>(missingNormalMode);
+
+        size_t expectedSize = sizeof(MeshCacheHeader)
+                            + header.vertexCount * sizeof(Vertex)
+                            + header.indexCount * sizeof(uint32_t)
+                            + header.meshletCount * sizeof(Meshlet)
+                            + header.meshletVertexIndexCount * sizeof(uint32_t)
+                            + header.meshletTriangleBytes;
+        if (!valid || fileSize < expectedSize) {
+            return Result<MappedMesh>(Error("Mesh cache stale or incompatible: " + cachePath));
+        }
+
+        const char* blob = static_cast<const char*>(file.data()) + sizeof(MeshCacheHeader);
+
+        MappedMesh mapped;
+        mapped.m_file = std::move(file);
+        mapped.m_vertices = reinterpret_cast<const Vertex*>(blob);
+        mapped.m_indices = reinterpret_cast<const uint32_t*>(blob + header.vertexCount * sizeof(Vertex));
+        mapped.m_vertexCount = header.vertexCount;
+        mapped.m_indexCount = header.indexCount;
+        if (header.meshletCount > 0) {
+            const char* meshletBlob = blob + header.vertexCount * sizeof(Vertex)
+                                           + header.indexCount * sizeof(uint32_t);
+            mapped.m_meshlets = reinterpret_cast<const Meshlet*>(meshletBlob);
+            mapped.m_meshletVertexIndices = reinterpret_cast<const uint32_t*>(
+                meshletBlob + header.meshletCount * sizeof(Meshlet));
+            mapped.m_meshletTriangles = reinterpret_cast<const uint8_t*>(
+                meshletBlob + header.meshletCount * sizeof(Meshlet)
+                            + header.meshletVertexIndexCount * sizeof(uint32_t));
+            mapped.m_meshletCount = header.meshletCount;
+            mapped.m_meshletVertexIndexCount = header.meshletVertexIndexCount;
+            mapped.m_meshletTriangleBytes = header.meshletTriangleBytes;
+        }
+        mapped.m_normalSource = static_cast<MeshNormalSource>(header.normalSource);
+        mapped.m_boundsMin = {header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]};
+        mapped.m_boundsMax = {header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]};
+        mapped.m_boundingRadius = header.boundingRadius;
+
+        return Result<MappedMesh>(std::move(mapped));
+    }
+
+    Result<void> MeshCache::write(const std::string& cachePath,
+                                  uint64_t sourceHash,
+                                  MissingNormalMode missingNormalMode,
+                                  const std::vector<Vertex>& vertices,
+                                  const std::vector<uint32_t>& indices,
+                                  MeshNormalSource normalSource,
+                                  const glm::vec3& boundsMin,
+                                  const glm::vec3& boundsMax,
+                                  float boundingRadius,
+                                  const MeshletData* meshlets) {
+        // Write to a temp file and rename, so a crash mid-write never
+        // leaves a plausible-looking half cache behind
+        std::string tempPath = cachePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return Result<void>(Error("Failed to open mesh cache for writing: " + tempPath));
+            }
+
+            MeshCacheHeader header;
+            header.sourceHash = sourceHash;
+            header.vertexStride = sizeof(Vertex);
+            header.normalSource = static_cast<uint32_t>(normalSource);
+            header.missingNormalMode = static_cast<uint32_t>(missingNormalMode);
+            header.vertexCount = vertices.size();
+            header.indexCount = indices.size();
+            std::memcpy(header.boundsMin, &boundsMin, sizeof(header.boundsMin));
+            std::memcpy(header.boundsMax, &boundsMax, sizeof(header.boundsMax));
+            header.boundingRadius = boundingRadius;
+            if (meshlets && !meshlets->empty()) {
+                header.meshletCount = meshlets->meshlets.size();
+                header.meshletVertexIndexCount = meshlets->vertexIndices.size();
+                header.meshletTriangleBytes = meshlets->triangles.size();
+            }
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(vertices.data()),
+                       static_cast<std::streamsize>(vertices.size() * sizeof(Vertex)));
+            file.write(reinterpret_cast<const char*>(indices.data()),
+                       static_cast<std::streamsize>(indices.size() * sizeof(uint32_t)));
+            if (meshlets && !meshlets->empty()) {
+                file.write(reinterpret_cast<const char*>(meshlets->meshlets.data()),
+                           static_cast<std::streamsize>(meshlets->meshlets.size() * sizeof(Meshlet)));
+                file.write(reinterpret_cast<const char*>(meshlets->vertexIndices.data()),
+                           static_cast<std::streamsize>(meshlets->vertexIndices.size() * sizeof(uint32_t)));
+                file.write(reinterpret_cast<const char*>(meshlets->triangles.data()),
+                           static_cast<std::streamsize>(meshlets->triangles.size()));
+            }
+            if (!file.good()) {
+                return Result<void>(Error("Failed writing mesh cache: " + tempPath));
+            }
+        }
+
+        if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+            return Result<void>(Error("Failed to move mesh cache into place: " + cachePath));
+        }
+
+        LOG_INFO(GENERAL, "MeshCache: wrote {} ({} vertices, {} indices)",
+                 cachePath, vertices.size(), indices.size());
+        return Result<void>();
+    }
+
+} // namespace vkeng
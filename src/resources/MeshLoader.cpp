@@ -1,5 +1,11 @@
 #include "vulkan-engine/resources/MeshLoader.hpp"
+#include "vulkan-engine/resources/MeshCache.hpp"
+#include "vulkan-engine/resources/ObjParser.hpp"
+#include "vulkan-engine/resources/MeshOptimizer.hpp"
+#include "vulkan-engine/resources/MeshSimplifier.hpp"
+#include "vulkan-engine/resources/MeshletBuilder.hpp"
 #include "vulkan-engine/rendering/Vertex.hpp"
+#include "vulkan-engine/core/Logger.hpp"
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tiny_obj_loader.h>
 #include <glm/geometric.hpp>
@@ -11,6 +17,10 @@ namespace vkeng {
     namespace {
         constexpr float kNormalEpsilon = 1e-6f;
 
+        // Below this the per-cluster dispatch overhead of the mesh-shading
+        // path outweighs what meshlet culling saves; small meshes stay classic
+        constexpr size_t kMinIndicesForMeshlets = 768;
+
         struct ObjVertexKey {
             int vertexIndex = -1;
             int texcoordIndex = -1;
@@ -164,13 +174,57 @@ namespace vkeng {
     }
 
     Result<std::shared_ptr<Mesh>> MeshLoader::loadWithOptions(const std::string& path, MissingNormalMode missingNormalMode) {
+        // Fast path: a valid binary cache skips OBJ parsing entirely. The
+        // mapped blobs match the Vertex layout byte-for-byte and go straight
+        // to the upload path; the hash check invalidates edited sources.
+        const std::string cachePath = MeshCache::cachePathFor(path);
+        const uint64_t sourceHash = MeshCache::hashFile(path);
+
+        if (sourceHash != 0) {
+            auto mappedResult = MeshCache::open(cachePath, sourceHash, missingNormalMode);
+            if (mappedResult.isSuccess()) {
+                const MappedMesh& mapped = mappedResult.getValue();
+                LOG_INFO(GENERAL, "MeshLoader: loading {} from binary cache ({} vertices)",
+                         path, mapped.vertexCount());
+                auto mesh = std::make_shared<Mesh>(
+                    path, m_memoryManager,
+                    mapped.vertices(), mapped.vertexCount(),
+                    mapped.indices(), mapped.indexCount(),
+                    mapped.normalSource(),
+                    mapped.boundsMin(), mapped.boundsMax(), mapped.boundingRadius());
+                if (mapped.hasMeshlets()) {
+                    // The mapping dies with this scope, so the meshlet blobs
+                    // are copied out (unlike the zero-copy geometry upload)
+                    MeshletData meshlets;
+                    meshlets.meshlets.assign(mapped.meshlets(),
+                                             mapped.meshlets() + mapped.meshletCount());
+                    meshlets.vertexIndices.assign(mapped.meshletVertexIndices(),
+                                                  mapped.meshletVertexIndices() + mapped.meshletVertexIndexCount());
+                    meshlets.triangles.assign(mapped.meshletTriangles(),
+                                              mapped.meshletTriangles() + mapped.meshletTriangleBytes());
+                    mesh->setMeshlets(std::move(meshlets));
+                }
+                generateLodChain(mesh);
+                return Result(mesh);
+            }
+        }
+
         tinyobj::attrib_t attrib;
         std::vector<tinyobj::shape_t> shapes;
         std::vector<tinyobj::material_t> materials;
         std::string warn, err;
 
-        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), nullptr, true)) {
-            return Result<std::shared_ptr<Mesh>>(Error(warn + err));
+        // Chunked parallel parse first — it scales with cores on the large
+        // scans this path exists for. Files it declines (relative indices,
+        // line continuations) take the single-threaded tinyobj path.
+        if (!ObjParser::parse(path, attrib, shapes, &warn)) {
+            if (!warn.empty()) {
+                LOG_DEBUG(GENERAL, "MeshLoader: chunked parse declined ({}), using tinyobj", warn);
+            }
+            warn.clear();
+            if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), nullptr, true)) {
+                return Result<std::shared_ptr<Mesh>>(Error(warn + err));
+            }
         }
 
         std::vector<Vertex> vertices;
@@ -212,7 +266,8 @@ namespace vkeng {
             }
 
             Vertex::computeTangents(vertices, indices);
-            return Result(std::make_shared<Mesh>(path, m_memoryManager, vertices, indices, MeshNormalSource::GeneratedFlat));
+            return createAndCache(path, cachePath, sourceHash, missingNormalMode,
+                                  vertices, indices, MeshNormalSource::GeneratedFlat);
         }
 
         for (const auto& shape : shapes) {
@@ -237,7 +292,115 @@ namespace vkeng {
             ? MeshNormalSource::Authored
             : MeshNormalSource::GeneratedSmooth;
 
+        // Deduplicated index buffers visit vertices in authoring order, so
+        // reorder for post-transform cache reuse and linear fetch. The flat
+        // path above skips this: its indices are already sequential.
+        MeshOptimizer::optimizeVertexCacheOrder(indices, vertices.size());
+        MeshOptimizer::optimizeVertexFetchOrder(vertices, indices);
+
         Vertex::computeTangents(vertices, indices);
-        return Result(std::make_shared<Mesh>(path, m_memoryManager, vertices, indices, normalSource));
+        return createAndCache(path, cachePath, sourceHash, missingNormalMode,
+                              vertices, indices, normalSource);
+    }
+
+    /**
+     * @brief Creates the Mesh from freshly parsed data and writes the cache.
+     *
+     * Cache-write failures are logged and ignored: the parse already
+     * succeeded, the next run just parses again.
+     */
+    Result<std::shared_ptr<Mesh>> MeshLoader::createAndCache(
+            const std::string& path, const std::string& cachePath,
+            uint64_t sourceHash, MissingNormalMode missingNormalMode,
+            const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+            MeshNormalSource normalSource) {
+        auto mesh = std::make_shared<Mesh>(path, m_memoryManager, vertices, indices, normalSource);
+
+        // Meshlet clustering for the mesh-shading path: built once here and
+        // baked into the cache below. Meshes under the threshold draw faster
+        // through the classic pipeline than through per-cluster dispatch.
+        if (indices.size() >= kMinIndicesForMeshlets) {
+            MeshletData meshlets = MeshletBuilder::build(vertices, indices);
+            LOG_INFO(GENERAL, "MeshLoader: built {} meshlet(s) for {} ({} triangles)",
+                     meshlets.meshlets.size(), path, indices.size() / 3);
+            mesh->setMeshlets(std::move(meshlets));
+        }
+
+        generateLodChain(mesh);
+
+        if (sourceHash != 0) {
+            auto writeResult = MeshCache::write(cachePath, sourceHash, missingNormalMode,
+                                                vertices, indices, normalSource,
+                                                mesh->getBoundsMin(), mesh->getBoundsMax(),
+                                                mesh->getBoundingRadius(),
+                                                mesh->hasMeshlets() ? &mesh->getMeshlets() : nullptr);
+            if (!writeResult.isSuccess()) {
+                LOG_WARN(GENERAL, "MeshLoader: failed to write mesh cache for {}: {}",
+                         path, writeResult.getError().message);
+            }
+        }
+
+        return Result(mesh);
+    }
+
+    /**
+     * @brief Generates halving reduction levels and attaches them to the mesh.
+     *
+     * Each level targets half the previous level's index count; generation
+     * stops once the simplifier stalls (achieved count within 90% of its
+     * input), since further levels would pay upload cost for no reduction.
+     * The LOD meshes drop their CPU copies immediately — only the base mesh
+     * participates in static batching.
+     */
+    void MeshLoader::generateLodChain(const std::shared_ptr<Mesh>& mesh) {
+        // Three levels of halving caps the chain at 12.5% of base detail
+        constexpr int kLodLevels = 3;
+        // Below this the base mesh is cheap enough to draw at any distance
+        constexpr size_t kMinIndicesForLods = 768;
+
+        const std::vector<Vertex>& baseVertices = mesh->getCpuVertices();
+        const std::vector<uint32_t>& baseIndices = mesh->getCpuIndices();
+        if (baseIndices.size() < kMinIndicesForLods) {
+            return;
+        }
+
+        std::vector<std::shared_ptr<Mesh>> lods;
+        std::vector<Vertex> levelVertices;
+        std::vector<uint32_t> levelIndices;
+        const std::vector<Vertex>* sourceVertices = &baseVertices;
+        const std::vector<uint32_t>* sourceIndices = &baseIndices;
+        size_t target = baseIndices.size();
+
+        for (int level = 1; level <= kLodLevels; ++level) {
+            target /= 2;
+            std::vector<Vertex> outVertices;
+            std::vector<uint32_t> outIndices;
+            const size_t achieved = MeshSimplifier::simplify(
+                *sourceVertices, *sourceIndices, target, outVertices, outIndices);
+            if (outIndices.empty() || achieved * 10 >= sourceIndices->size() * 9) {
+                break; // Simplification stalled; deeper levels won't shrink
+            }
+
+            // LOD geometry goes through the same reordering as parsed meshes
+            MeshOptimizer::optimizeVertexCacheOrder(outIndices, outVertices.size());
+            MeshOptimizer::optimizeVertexFetchOrder(outVertices, outIndices);
+
+            auto lod = std::make_shared<Mesh>(
+                mesh->getName() + "#lod" + std::to_string(level),
+                m_memoryManager, outVertices, outIndices, mesh->getNormalSource());
+            lod->releaseCpuData();
+            lods.push_back(std::move(lod));
+
+            levelVertices = std::move(outVertices);
+            levelIndices = std::move(outIndices);
+            sourceVertices = &levelVertices;
+            sourceIndices = &levelIndices;
+        }
+
+        if (!lods.empty()) {
+            LOG_INFO(GENERAL, "MeshLoader: built {} LOD level(s) for {} ({} -> {} indices)",
+                     lods.size(), mesh->getName(), baseIndices.size(), sourceIndices->size());
+            mesh->setLodChain(std::move(lods));
+        }
     }
 } // namespace vkeng
\ No newline at end of file
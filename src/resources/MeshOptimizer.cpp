@@ -0,0 +1,203 @@
+#include "vulkan-engine/resources/MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // Forsyth's published constants: a modelled 32-entry FIFO cache with a
+    // boost for the three most recent vertices, plus a valence term that
+    // pulls in vertices with few remaining triangles so they retire early.
+    constexpr int kCacheSize = 32;
+    constexpr float kCacheDecayPower = 1.5f;
+    constexpr float kLastTriScore = 0.75f;
+    constexpr float kValenceBoostScale = 2.0f;
+    constexpr float kValenceBoostPower = 0.5f;
+
+    struct VertexScoreData {
+        float score = 0.0f;
+        int cachePosition = -1;
+        uint32_t remainingTriangles = 0;
+        uint32_t triangleListOffset = 0;
+        uint32_t triangleListCount = 0;
+    };
+
+    float computeVertexScore(const VertexScoreData& vertex) {
+        if (vertex.remainingTriangles == 0) {
+            return -1.0f;
+        }
+
+        float score = 0.0f;
+        if (vertex.cachePosition >= 0) {
+            if (vertex.cachePosition < 3) {
+                // The three most recent vertices all share one fixed score:
+                // ranking them would just favour re-emitting the last triangle
+                score = kLastTriScore;
+            } else {
+                const float scaled = 1.0f - static_cast<float>(vertex.cachePosition - 3)
+                                          / static_cast<float>(kCacheSize - 3);
+                score = std::pow(scaled, kCacheDecayPower);
+            }
+        }
+
+        score += kValenceBoostScale
+               * std::pow(static_cast<float>(vertex.remainingTriangles), -kValenceBoostPower);
+        return score;
+    }
+}
+
+namespace vkeng {
+
+    void MeshOptimizer::optimizeVertexCacheOrder(std::vector<uint32_t>& indices,
+                                                 size_t vertexCount) {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2 || vertexCount == 0) {
+            return;
+        }
+
+        // Build per-vertex triangle adjacency in one flat array
+        std::vector<VertexScoreData> vertexData(vertexCount);
+        for (uint32_t index : indices) {
+            vertexData[index].remainingTriangles++;
+        }
+
+        uint32_t offset = 0;
+        for (auto& vertex : vertexData) {
+            vertex.triangleListOffset = offset;
+            offset += vertex.remainingTriangles;
+        }
+
+        std::vector<uint32_t> vertexTriangles(indices.size());
+        for (size_t tri = 0; tri < triangleCount; ++tri) {
+            for (size_t corner = 0; corner < 3; ++corner) {
+                auto& vertex = vertexData[indices[tri * 3 + corner]];
+                vertexTriangles[vertex.triangleListOffset + vertex.triangleListCount] =
+                    static_cast<uint32_t>(tri);
+                vertex.triangleListCount++;
+            }
+        }
+
+        for (auto& vertex : vertexData) {
+            vertex.score = computeVertexScore(vertex);
+        }
+
+        std::vector<float> triangleScores(triangleCount, 0.0f);
+        std::vector<bool> triangleEmitted(triangleCount, false);
+        for (size_t tri = 0; tri < triangleCount; ++tri) {
+            triangleScores[tri] = vertexData[indices[tri * 3 + 0]].score
+                                + vertexData[indices[tri * 3 + 1]].score
+                                + vertexData[indices[tri * 3 + 2]].score;
+        }
+
+        std::vector<uint32_t> newIndices;
+        newIndices.reserve(indices.size());
+
+        // Modelled FIFO cache, one slot larger so an insertion can push the
+        // oldest entry out before the list is truncated back to kCacheSize
+        std::vector<uint32_t> cache;
+        cache.reserve(kCacheSize + 3);
+
+        size_t emittedCount = 0;
+        size_t scanCursor = 0;
+        int bestTriangle = -1;
+
+        while (emittedCount < triangleCount) {
+            if (bestTriangle < 0) {
+                // Cold start or cache went stale: scan forward for any
+                // un-emitted triangle. The cursor never rewinds, so this
+                // stays linear over the whole run.
+                while (scanCursor < triangleCount && triangleEmitted[scanCursor]) {
+                    ++scanCursor;
+                }
+                bestTriangle = static_cast<int>(scanCursor);
+            }
+
+            const size_t tri = static_cast<size_t>(bestTriangle);
+            triangleEmitted[tri] = true;
+            ++emittedCount;
+
+            for (size_t corner = 0; corner < 3; ++corner) {
+                const uint32_t index = indices[tri * 3 + corner];
+                newIndices.push_back(index);
+
+                auto& vertex = vertexData[index];
+                vertex.remainingTriangles--;
+
+                // Compact this triangle out of the vertex's adjacency list
+                for (uint32_t slot = 0; slot < vertex.triangleListCount; ++slot) {
+                    if (vertexTriangles[vertex.triangleListOffset + slot] == tri) {
+                        vertex.triangleListCount--;
+                        std::swap(vertexTriangles[vertex.triangleListOffset + slot],
+                                  vertexTriangles[vertex.triangleListOffset + vertex.triangleListCount]);
+                        break;
+                    }
+                }
+
+                // Move to the front of the modelled cache
+                auto cached = std::find(cache.begin(), cache.end(), index);
+                if (cached != cache.end()) {
+                    cache.erase(cached);
+                }
+                cache.insert(cache.begin(), index);
+            }
+
+            if (cache.size() > static_cast<size_t>(kCacheSize)) {
+                for (size_t i = kCacheSize; i < cache.size(); ++i) {
+                    vertexData[cache[i]].cachePosition = -1;
+                }
+                cache.resize(kCacheSize);
+            }
+
+            // Rescore cached vertices and pick the next triangle from their
+            // remaining adjacency — the whole point of the greedy pass
+            bestTriangle = -1;
+            float bestScore = -1.0f;
+            for (size_t pos = 0; pos < cache.size(); ++pos) {
+                auto& vertex = vertexData[cache[pos]];
+                vertex.cachePosition = static_cast<int>(pos);
+                vertex.score = computeVertexScore(vertex);
+            }
+            for (uint32_t cachedIndex : cache) {
+                const auto& vertex = vertexData[cachedIndex];
+                for (uint32_t slot = 0; slot < vertex.triangleListCount; ++slot) {
+                    const uint32_t candidate = vertexTriangles[vertex.triangleListOffset + slot];
+                    if (triangleEmitted[candidate]) {
+                        continue;
+                    }
+                    const float score = vertexData[indices[candidate * 3 + 0]].score
+                                      + vertexData[indices[candidate * 3 + 1]].score
+                                      + vertexData[indices[candidate * 3 + 2]].score;
+                    if (score > bestScore) {
+                        bestScore = score;
+                        bestTriangle = static_cast<int>(candidate);
+                    }
+                }
+            }
+        }
+
+        indices = std::move(newIndices);
+    }
+
+    void MeshOptimizer::optimizeVertexFetchOrder(std::vector<Vertex>& vertices,
+                                                 std::vector<uint32_t>& indices) {
+        constexpr uint32_t kUnmapped = UINT32_MAX;
+        std::vector<uint32_t> remap(vertices.size(), kUnmapped);
+
+        uint32_t nextSlot = 0;
+        for (uint32_t& index : indices) {
+            if (remap[index] == kUnmapped) {
+                remap[index] = nextSlot++;
+            }
+            index = remap[index];
+        }
+
+        std::vector<Vertex> reordered(vertices.size());
+        for (size_t old = 0; old < vertices.size(); ++old) {
+            // Vertices never referenced by an index get appended at the end
+            const uint32_t target = (remap[old] != kUnmapped) ? remap[old] : nextSlot++;
+            reordered[target] = vertices[old];
+        }
+        vertices = std::move(reordered);
+    }
+
+} // namespace vkeng
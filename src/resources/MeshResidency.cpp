@@ -0,0 +1,112 @@
+#include "vulkan-engine/resources/MeshResidency.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace {
+    // A mesh must be undrawn for at least this many frames before its
+    // buffers may be freed: frames-in-flight plus one, so no submitted
+    // command buffer can still bind them
+    constexpr uint64_t kMinIdleFrames = 3;
+}
+
+namespace vkeng {
+
+    MeshResidencyManager& MeshResidencyManager::get() {
+        static MeshResidencyManager instance;
+        return instance;
+    }
+
+    void MeshResidencyManager::configure(uint64_t budgetBytes) {
+        m_budgetBytes = budgetBytes;
+        LOG_INFO(RENDERING, "MeshResidency: budget {} MB",
+                 budgetBytes / (1024 * 1024));
+    }
+
+    void MeshResidencyManager::noteUsage(const std::shared_ptr<Mesh>& mesh) {
+        if (!mesh) {
+            return;
+        }
+
+        // A stamp of 0 means the mesh has never been seen — the frame
+        // counter starts at 1, so every real stamp is nonzero
+        if (mesh->getLastUsedFrame() == 0) {
+            m_entries.push_back({mesh});
+        }
+        mesh->noteUsed(m_frame);
+
+        // Reload on demand: the draw being collected needs the geometry
+        // this frame. Synchronous, like texture promotion — a one-frame
+        // hitch beats drawing nothing.
+        if (!mesh->isResident()) {
+            mesh->ensureResident();
+            LOG_DEBUG(RENDERING, "MeshResidency: reloaded {} ({} KB)",
+                      mesh->getName(), mesh->getGpuBytes() / 1024);
+        }
+    }
+
+    size_t MeshResidencyManager::getEvictedCount() const {
+        return static_cast<size_t>(
+            std::count_if(m_entries.begin(), m_entries.end(),
+                          [](const Entry& entry) {
+                              auto mesh = entry.mesh.lock();
+                              return mesh && !mesh->isResident();
+                          }));
+    }
+
+    void MeshResidencyManager::update() {
+        ++m_frame;
+
+        // Drop entries whose meshes were released elsewhere
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                       [](const Entry& entry) {
+                                           return entry.mesh.expired();
+                                       }),
+                        m_entries.end());
+
+        m_residentBytes = 0;
+        for (const auto& entry : m_entries) {
+            if (auto mesh = entry.mesh.lock(); mesh && mesh->isResident()) {
+                m_residentBytes += mesh->getGpuBytes();
+            }
+        }
+
+        if (m_budgetBytes == 0) {
+            return;
+        }
+
+        // Evict least-recently-drawn meshes until back under budget.
+        // Eviction is just a free — no transfer — so unlike texture
+        // demotion there is no need to spread it across frames.
+        while (m_residentBytes > m_budgetBytes) {
+            std::shared_ptr<Mesh> oldest;
+            for (const auto& entry : m_entries) {
+                auto mesh = entry.mesh.lock();
+                if (!mesh || !mesh->isResident() || !mesh->hasCpuData()) {
+                    continue;
+                }
+                if (m_frame - mesh->getLastUsedFrame() < kMinIdleFrames) {
+                    continue; // Possibly referenced by an in-flight frame
+                }
+                if (!oldest || mesh->getLastUsedFrame() < oldest->getLastUsedFrame()) {
+                    oldest = std::move(mesh);
+                }
+            }
+            if (!oldest) {
+                return; // Everything left is recently drawn or has no CPU copy
+            }
+
+            m_residentBytes -= oldest->getGpuBytes();
+            oldest->evictGpuData();
+            LOG_DEBUG(RENDERING, "MeshResidency: evicted {} ({} MB resident)",
+                      oldest->getName(), m_residentBytes / (1024 * 1024));
+        }
+    }
+
+    void MeshResidencyManager::clear() {
+        m_entries.clear();
+        m_residentBytes = 0;
+        m_frame = 1;
+    }
+
+} // namespace vkeng
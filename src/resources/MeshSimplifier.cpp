@@ -0,0 +1,262 @@
+#include "vulkan-engine/resources/MeshSimplifier.hpp"
+
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace vkeng {
+
+    namespace {
+
+        /// Passes are cheap; this bound only guards degenerate inputs
+        constexpr int kMaxPasses = 12;
+
+        /// Weight of the constraint planes added along open (boundary) edges
+        constexpr double kBoundaryWeight = 1000.0;
+
+        /**
+         * @brief Symmetric 4x4 quadric form, upper triangle only
+         *
+         * error(v) = v^T Q v for homogeneous v = (x, y, z, 1); accumulated
+         * from plane equations (a, b, c, d) with a^2+b^2+c^2 = 1.
+         */
+        struct Quadric {
+            double a2 = 0, ab = 0, ac = 0, ad = 0;
+            double b2 = 0, bc = 0, bd = 0;
+            double c2 = 0, cd = 0;
+            double d2 = 0;
+
+            void addPlane(const glm::dvec3& n, double d, double weight) {
+                a2 += weight * n.x * n.x; ab += weight * n.x * n.y;
+                ac += weight * n.x * n.z; ad += weight * n.x * d;
+                b2 += weight * n.y * n.y; bc += weight * n.y * n.z;
+                bd += weight * n.y * d;
+                c2 += weight * n.z * n.z; cd += weight * n.z * d;
+                d2 += weight * d * d;
+            }
+
+            void add(const Quadric& other) {
+                a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+                b2 += other.b2; bc += other.bc; bd += other.bd;
+                c2 += other.c2; cd += other.cd;
+                d2 += other.d2;
+            }
+
+            double error(const glm::dvec3& v) const {
+                return a2 * v.x * v.x + 2.0 * ab * v.x * v.y + 2.0 * ac * v.x * v.z +
+                       2.0 * ad * v.x +
+                       b2 * v.y * v.y + 2.0 * bc * v.y * v.z + 2.0 * bd * v.y +
+                       c2 * v.z * v.z + 2.0 * cd * v.z +
+                       d2;
+            }
+        };
+
+        /// Canonical undirected edge key for adjacency counting
+        struct EdgeKey {
+            uint32_t a, b; // a < b
+
+            bool operator==(const EdgeKey& other) const {
+                return a == other.a && b == other.b;
+            }
+        };
+
+        struct EdgeKeyHash {
+            size_t operator()(const EdgeKey& key) const {
+                return std::hash<uint64_t>{}(
+                    (static_cast<uint64_t>(key.a) << 32) | key.b);
+            }
+        };
+
+        /// A candidate collapse of vertex `from` onto surviving vertex `to`
+        struct Collapse {
+            double cost;
+            uint32_t from;
+            uint32_t to;
+        };
+
+        /// Follows the collapse chain to the surviving vertex, compressing paths
+        uint32_t resolve(std::vector<uint32_t>& remap, uint32_t index) {
+            uint32_t root = index;
+            while (remap[root] != root) {
+                root = remap[root];
+            }
+            while (remap[index] != root) {
+                uint32_t next = remap[index];
+                remap[index] = root;
+                index = next;
+            }
+            return root;
+        }
+
+    }
+
+    size_t MeshSimplifier::simplify(const std::vector<Vertex>& vertices,
+                                    const std::vector<uint32_t>& indices,
+                                    size_t targetIndexCount,
+                                    std::vector<Vertex>& outVertices,
+                                    std::vector<uint32_t>& outIndices) {
+        outVertices.clear();
+        outIndices.clear();
+
+        targetIndexCount -= targetIndexCount % 3;
+        if (indices.size() <= targetIndexCount || indices.size() < 12 || vertices.empty()) {
+            outVertices = vertices;
+            outIndices = indices;
+            return outIndices.size();
+        }
+
+        // ====================================================================
+        // Initial quadrics from triangle planes (+ boundary constraints)
+        // ====================================================================
+
+        std::vector<Quadric> quadrics(vertices.size());
+        std::unordered_map<EdgeKey, uint32_t, EdgeKeyHash> edgeTriangleCount;
+        edgeTriangleCount.reserve(indices.size());
+
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const uint32_t i0 = indices[i], i1 = indices[i + 1], i2 = indices[i + 2];
+            const glm::dvec3 p0(vertices[i0].pos), p1(vertices[i1].pos), p2(vertices[i2].pos);
+
+            glm::dvec3 n = glm::cross(p1 - p0, p2 - p0);
+            const double area = glm::length(n);
+            if (area < 1e-12) continue;
+            n /= area;
+
+            // Area-weighted so large faces dominate the error metric
+            const double d = -glm::dot(n, p0);
+            quadrics[i0].addPlane(n, d, area);
+            quadrics[i1].addPlane(n, d, area);
+            quadrics[i2].addPlane(n, d, area);
+
+            const uint32_t tri[3] = {i0, i1, i2};
+            for (int e = 0; e < 3; ++e) {
+                uint32_t a = tri[e], b = tri[(e + 1) % 3];
+                if (a > b) std::swap(a, b);
+                edgeTriangleCount[EdgeKey{a, b}]++;
+            }
+        }
+
+        // Open edges get a constraint plane perpendicular to the surface so
+        // mesh borders and holes keep their shape until the very end
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const uint32_t tri[3] = {indices[i], indices[i + 1], indices[i + 2]};
+            for (int e = 0; e < 3; ++e) {
+                uint32_t a = tri[e], b = tri[(e + 1) % 3];
+                uint32_t ka = a, kb = b;
+                if (ka > kb) std::swap(ka, kb);
+                if (edgeTriangleCount[EdgeKey{ka, kb}] != 1) continue;
+
+                const glm::dvec3 pa(vertices[a].pos), pb(vertices[b].pos);
+                const glm::dvec3 pc(vertices[tri[(e + 2) % 3]].pos);
+                const glm::dvec3 edge = pb - pa;
+                glm::dvec3 faceNormal = glm::cross(edge, pc - pa);
+                glm::dvec3 constraint = glm::cross(edge, faceNormal);
+                const double len = glm::length(constraint);
+                if (len < 1e-12) continue;
+                constraint /= len;
+
+                const double d = -glm::dot(constraint, pa);
+                quadrics[a].addPlane(constraint, d, kBoundaryWeight);
+                quadrics[b].addPlane(constraint, d, kBoundaryWeight);
+            }
+        }
+
+        // ====================================================================
+        // Greedy collapse passes
+        // ====================================================================
+
+        std::vector<uint32_t> remap(vertices.size());
+        for (uint32_t i = 0; i < remap.size(); ++i) remap[i] = i;
+
+        std::vector<uint32_t> current = indices;
+        std::vector<Collapse> candidates;
+        std::vector<bool> touched(vertices.size());
+
+        for (int pass = 0; pass < kMaxPasses && current.size() > targetIndexCount; ++pass) {
+            // Gather unique edges of the current topology
+            std::unordered_map<EdgeKey, bool, EdgeKeyHash> seen;
+            seen.reserve(current.size());
+            candidates.clear();
+
+            for (size_t i = 0; i + 2 < current.size(); i += 3) {
+                const uint32_t tri[3] = {current[i], current[i + 1], current[i + 2]};
+                for (int e = 0; e < 3; ++e) {
+                    uint32_t a = tri[e], b = tri[(e + 1) % 3];
+                    if (a == b) continue;
+                    uint32_t ka = a, kb = b;
+                    if (ka > kb) std::swap(ka, kb);
+                    if (!seen.emplace(EdgeKey{ka, kb}, true).second) continue;
+
+                    // Collapse onto whichever endpoint yields less error
+                    Quadric combined = quadrics[ka];
+                    combined.add(quadrics[kb]);
+                    const double costToB = combined.error(glm::dvec3(vertices[kb].pos));
+                    const double costToA = combined.error(glm::dvec3(vertices[ka].pos));
+                    if (costToB <= costToA) {
+                        candidates.push_back(Collapse{costToB, ka, kb});
+                    } else {
+                        candidates.push_back(Collapse{costToA, kb, ka});
+                    }
+                }
+            }
+            if (candidates.empty()) break;
+
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const Collapse& lhs, const Collapse& rhs) {
+                          return lhs.cost < rhs.cost;
+                      });
+
+            // Each collapse removes roughly two triangles; capping the pass
+            // keeps us from overshooting far below the target
+            const size_t trianglesOver = (current.size() - targetIndexCount) / 3;
+            const size_t maxCollapses = (trianglesOver + 1) / 2;
+
+            std::fill(touched.begin(), touched.end(), false);
+            size_t applied = 0;
+            for (const Collapse& collapse : candidates) {
+                if (applied >= maxCollapses) break;
+                if (touched[collapse.from] || touched[collapse.to]) continue;
+
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to].add(quadrics[collapse.from]);
+                touched[collapse.from] = true;
+                touched[collapse.to] = true;
+                applied++;
+            }
+            if (applied == 0) break;
+
+            // Rewrite the index buffer through the remap, dropping triangles
+            // that became degenerate
+            size_t write = 0;
+            for (size_t i = 0; i + 2 < current.size(); i += 3) {
+                const uint32_t i0 = resolve(remap, current[i]);
+                const uint32_t i1 = resolve(remap, current[i + 1]);
+                const uint32_t i2 = resolve(remap, current[i + 2]);
+                if (i0 == i1 || i1 == i2 || i0 == i2) continue;
+                current[write++] = i0;
+                current[write++] = i1;
+                current[write++] = i2;
+            }
+            current.resize(write);
+        }
+
+        // ====================================================================
+        // Compact surviving vertices
+        // ====================================================================
+
+        constexpr uint32_t kUnmapped = UINT32_MAX;
+        std::vector<uint32_t> compact(vertices.size(), kUnmapped);
+        outIndices.reserve(current.size());
+        for (uint32_t index : current) {
+            if (compact[index] == kUnmapped) {
+                compact[index] = static_cast<uint32_t>(outVertices.size());
+                outVertices.push_back(vertices[index]);
+            }
+            outIndices.push_back(compact[index]);
+        }
+
+        return outIndices.size();
+    }
+
+} // namespace vkeng
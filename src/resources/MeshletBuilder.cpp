@@ -0,0 +1,143 @@
+#include "vulkan-engine/resources/MeshletBuilder.hpp"
+
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace vkeng {
+
+    namespace {
+        constexpr uint8_t kUnmappedSlot = 0xff;
+
+        /**
+         * @brief Finalizes the open meshlet's bounding sphere and backface cone.
+         *
+         * The sphere is centered on the referenced vertices' AABB center (a
+         * tight-enough fit for culling, computed in one pass). The cone axis
+         * is the normalized sum of the triangle face normals; the cutoff is
+         * derived from the worst-aligned face so the culling test
+         *     dot(view, axis) >= cutoff * |view| + radius
+         * is conservative. Degenerate or wide-spread clusters get a cutoff
+         * of 1.0, which the task shader treats as "never cone-cull".
+         */
+        void finalizeMeshlet(Meshlet& meshlet,
+                             const std::vector<Vertex>& vertices,
+                             const std::vector<uint32_t>& vertexIndices,
+                             const std::vector<uint8_t>& triangles,
+                             const glm::vec3& normalSum) {
+            glm::vec3 boundsMin(std::numeric_limits<float>::max());
+            glm::vec3 boundsMax(std::numeric_limits<float>::lowest());
+            for (uint32_t v = 0; v < meshlet.vertexCount; v++) {
+                const glm::vec3& pos = vertices[vertexIndices[meshlet.vertexOffset + v]].pos;
+                boundsMin = glm::min(boundsMin, pos);
+                boundsMax = glm::max(boundsMax, pos);
+            }
+            const glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+            float radius = 0.0f;
+            for (uint32_t v = 0; v < meshlet.vertexCount; v++) {
+                const glm::vec3& pos = vertices[vertexIndices[meshlet.vertexOffset + v]].pos;
+                radius = std::max(radius, glm::length(pos - center));
+            }
+            meshlet.boundsSphere = glm::vec4(center, radius);
+
+            const float axisLength = glm::length(normalSum);
+            if (axisLength < 1e-6f) {
+                meshlet.coneAxisCutoff = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+                return;
+            }
+            const glm::vec3 axis = normalSum / axisLength;
+
+            // Worst alignment of any face with the average axis bounds the
+            // cone's half angle; a hemisphere or wider can never be culled
+            float minDot = 1.0f;
+            for (uint32_t t = 0; t < meshlet.triangleCount; t++) {
+                const size_t corner = meshlet.triangleOffset + size_t(t) * 3;
+                const glm::vec3& a = vertices[vertexIndices[meshlet.vertexOffset + triangles[corner + 0]]].pos;
+                const glm::vec3& b = vertices[vertexIndices[meshlet.vertexOffset + triangles[corner + 1]]].pos;
+                const glm::vec3& c = vertices[vertexIndices[meshlet.vertexOffset + triangles[corner + 2]]].pos;
+                const glm::vec3 faceNormal = glm::cross(b - a, c - a);
+                const float faceLength = glm::length(faceNormal);
+                if (faceLength < 1e-12f) {
+                    continue;
+                }
+                minDot = std::min(minDot, glm::dot(faceNormal / faceLength, axis));
+            }
+
+            if (minDot <= 0.0f) {
+                meshlet.coneAxisCutoff = glm::vec4(axis, 1.0f);
+            } else {
+                meshlet.coneAxisCutoff = glm::vec4(axis, std::sqrt(1.0f - minDot * minDot));
+            }
+        }
+    }
+
+    MeshletData MeshletBuilder::build(const std::vector<Vertex>& vertices,
+                                      const std::vector<uint32_t>& indices) {
+        MeshletData data;
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0) {
+            return data;
+        }
+
+        data.meshlets.reserve(triangleCount / kMaxTriangles + 1);
+        data.vertexIndices.reserve(indices.size() / 2);
+        data.triangles.reserve(triangleCount * 3);
+
+        // Maps global vertex index -> slot in the open meshlet's vertex
+        // list; reset lazily per meshlet by walking only the used entries
+        std::vector<uint8_t> slots(vertices.size(), kUnmappedSlot);
+
+        Meshlet current{};
+        glm::vec3 normalSum(0.0f);
+
+        auto flush = [&]() {
+            if (current.triangleCount == 0) {
+                return;
+            }
+            finalizeMeshlet(current, vertices, data.vertexIndices, data.triangles, normalSum);
+            for (uint32_t v = 0; v < current.vertexCount; v++) {
+                slots[data.vertexIndices[current.vertexOffset + v]] = kUnmappedSlot;
+            }
+            data.meshlets.push_back(current);
+
+            current = Meshlet{};
+            current.vertexOffset = static_cast<uint32_t>(data.vertexIndices.size());
+            current.triangleOffset = static_cast<uint32_t>(data.triangles.size());
+            normalSum = glm::vec3(0.0f);
+        };
+
+        for (size_t t = 0; t < triangleCount; t++) {
+            const uint32_t corners[3] = {indices[3 * t + 0], indices[3 * t + 1], indices[3 * t + 2]};
+
+            uint32_t newVertices = 0;
+            for (uint32_t corner : corners) {
+                if (slots[corner] == kUnmappedSlot) {
+                    newVertices++;
+                }
+            }
+
+            if (current.vertexCount + newVertices > kMaxVertices ||
+                current.triangleCount + 1 > kMaxTriangles) {
+                flush();
+            }
+
+            for (uint32_t corner : corners) {
+                if (slots[corner] == kUnmappedSlot) {
+                    slots[corner] = static_cast<uint8_t>(current.vertexCount++);
+                    data.vertexIndices.push_back(corner);
+                }
+                data.triangles.push_back(slots[corner]);
+            }
+            current.triangleCount++;
+
+            const glm::vec3& a = vertices[corners[0]].pos;
+            const glm::vec3& b = vertices[corners[1]].pos;
+            const glm::vec3& c = vertices[corners[2]].pos;
+            normalSum += glm::cross(b - a, c - a);
+        }
+        flush();
+
+        return data;
+    }
+
+} // namespace vkeng
@@ -0,0 +1,373 @@
+#include "vulkan-engine/resources/ObjParser.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/core/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace vkeng {
+
+    namespace {
+        /// Below this a chunk's thread-dispatch overhead exceeds its parse
+        /// cost, so small files parse as a single chunk
+        constexpr size_t MIN_CHUNK_BYTES = 1u << 20;
+
+        /// Fan triangulation scratch cap; OBJ polygons beyond this are
+        /// pathological and routed to the tinyobj fallback
+        constexpr size_t MAX_FACE_CORNERS = 64;
+
+        /// Powers of ten for the fast float path; exponents beyond the
+        /// table fall back to strtod (never hit by mesh data in practice)
+        constexpr int POW10_RANGE = 38;
+
+        double pow10Table(int exponent) {
+            static const auto table = [] {
+                std::array<double, 2 * POW10_RANGE + 1> values{};
+                for (int i = -POW10_RANGE; i <= POW10_RANGE; ++i) {
+                    values[static_cast<size_t>(i + POW10_RANGE)] = std::pow(10.0, i);
+                }
+                return values;
+            }();
+            return table[static_cast<size_t>(exponent + POW10_RANGE)];
+        }
+
+        const char* skipBlanks(const char* p, const char* end) {
+            while (p < end && (*p == ' ' || *p == '\t')) ++p;
+            return p;
+        }
+
+        /**
+         * @brief Locale-free float parse via integer accumulation
+         *
+         * Digits accumulate into a uint64 mantissa with a decimal exponent;
+         * one multiply by a table power of ten replaces strtof's general
+         * machinery. Overlong or out-of-range inputs defer to strtod for
+         * exactness.
+         */
+        const char* parseFloat(const char* p, const char* end, float& out) {
+            p = skipBlanks(p, end);
+            const char* start = p;
+
+            bool negative = false;
+            if (p < end && (*p == '-' || *p == '+')) {
+                negative = (*p == '-');
+                ++p;
+            }
+
+            uint64_t mantissa = 0;
+            int digits = 0;
+            int fracDigits = 0;
+
+            while (p < end && *p >= '0' && *p <= '9') {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                ++digits;
+                ++p;
+            }
+            if (p < end && *p == '.') {
+                ++p;
+                while (p < end && *p >= '0' && *p <= '9') {
+                    mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                    ++digits;
+                    ++fracDigits;
+                    ++p;
+                }
+            }
+            if (digits == 0) {
+                return nullptr; // Not a number
+            }
+
+            int exponent = 0;
+            if (p < end && (*p == 'e' || *p == 'E')) {
+                ++p;
+                bool expNegative = false;
+                if (p < end && (*p == '-' || *p == '+')) {
+                    expNegative = (*p == '-');
+                    ++p;
+                }
+                int expDigits = 0;
+                while (p < end && *p >= '0' && *p <= '9') {
+                    exponent = exponent * 10 + (*p - '0');
+                    ++expDigits;
+                    ++p;
+                }
+                if (expDigits == 0) {
+                    return nullptr;
+                }
+                if (expNegative) {
+                    exponent = -exponent;
+                }
+            }
+
+            const int totalExponent = exponent - fracDigits;
+            if (digits > 19 || totalExponent < -POW10_RANGE || totalExponent > POW10_RANGE) {
+                // Rare slow path: let the C library get the rounding right
+                char* slowEnd = nullptr;
+                out = static_cast<float>(std::strtod(start, &slowEnd));
+                return slowEnd > start ? slowEnd : nullptr;
+            }
+
+            double value = static_cast<double>(mantissa) * pow10Table(totalExponent);
+            out = static_cast<float>(negative ? -value : value);
+            return p;
+        }
+
+        /** @brief Parses a positive decimal integer (OBJ index). */
+        const char* parseIndex(const char* p, const char* end, int& out) {
+            int value = 0;
+            int digits = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                value = value * 10 + (*p - '0');
+                ++digits;
+                ++p;
+            }
+            if (digits == 0) {
+                return nullptr;
+            }
+            out = value;
+            return p;
+        }
+
+        /** @brief One chunk's private parse output, merged after the join. */
+        struct ChunkResult {
+            std::vector<float> positions;              ///< xyz triples, file order
+            std::vector<float> normals;                ///< xyz triples, file order
+            std::vector<float> texcoords;              ///< uv pairs, file order
+            std::vector<tinyobj::index_t> triangles;   ///< Fan-triangulated corners, raw 1-based indices (0 = absent)
+            bool unsupported = false;                  ///< Needs the tinyobj fallback
+        };
+
+        /**
+         * @brief Parses [begin, end) — whole lines only (see chunk split)
+         *
+         * Indices are kept exactly as written (1-based, file-global); the
+         * merge converts them. Negative/relative indices and backslash line
+         * continuations flag the chunk unsupported.
+         */
+        void parseChunk(const char* begin, const char* end, ChunkResult& result) {
+            tinyobj::index_t corners[MAX_FACE_CORNERS];
+            const char* p = begin;
+
+            while (p < end) {
+                const char* lineEnd = static_cast<const char*>(
+                    std::memchr(p, '\n', static_cast<size_t>(end - p)));
+                if (!lineEnd) lineEnd = end;
+
+                const char* cursor = skipBlanks(p, lineEnd);
+                const size_t lineLength = static_cast<size_t>(lineEnd - cursor);
+
+                if (lineLength >= 2 && cursor[0] == 'v' &&
+                    (cursor[1] == ' ' || cursor[1] == '\t')) {
+                    float x, y, z;
+                    const char* q = parseFloat(cursor + 2, lineEnd, x);
+                    if (q) q = parseFloat(q, lineEnd, y);
+                    if (q) q = parseFloat(q, lineEnd, z);
+                    if (!q) { result.unsupported = true; return; }
+                    result.positions.push_back(x);
+                    result.positions.push_back(y);
+                    result.positions.push_back(z);
+                } else if (lineLength >= 3 && cursor[0] == 'v' && cursor[1] == 'n' &&
+                           (cursor[2] == ' ' || cursor[2] == '\t')) {
+                    float x, y, z;
+                    const char* q = parseFloat(cursor + 3, lineEnd, x);
+                    if (q) q = parseFloat(q, lineEnd, y);
+                    if (q) q = parseFloat(q, lineEnd, z);
+                    if (!q) { result.unsupported = true; return; }
+                    result.normals.push_back(x);
+                    result.normals.push_back(y);
+                    result.normals.push_back(z);
+                } else if (lineLength >= 3 && cursor[0] == 'v' && cursor[1] == 't' &&
+                           (cursor[2] == ' ' || cursor[2] == '\t')) {
+                    float u, v;
+                    const char* q = parseFloat(cursor + 3, lineEnd, u);
+                    if (q) q = parseFloat(q, lineEnd, v);
+                    if (!q) { result.unsupported = true; return; }
+                    result.texcoords.push_back(u);
+                    result.texcoords.push_back(v);
+                } else if (lineLength >= 2 && cursor[0] == 'f' &&
+                           (cursor[1] == ' ' || cursor[1] == '\t')) {
+                    // Corners are v[/vt][/vn]; raw values stay 1-based so the
+                    // merge can distinguish "absent" (0) from index 1
+                    size_t cornerCount = 0;
+                    const char* q = cursor + 2;
+                    while (true) {
+                        q = skipBlanks(q, lineEnd);
+                        if (q >= lineEnd) break;
+                        if (*q == '\\') { result.unsupported = true; return; }
+                        if (*q == '-') { result.unsupported = true; return; }
+                        if (cornerCount >= MAX_FACE_CORNERS) { result.unsupported = true; return; }
+
+                        tinyobj::index_t corner{};
+                        int value = 0;
+                        q = parseIndex(q, lineEnd, value);
+                        if (!q) { result.unsupported = true; return; }
+                        corner.vertex_index = value;
+                        corner.texcoord_index = 0;
+                        corner.normal_index = 0;
+
+                        if (q < lineEnd && *q == '/') {
+                            ++q;
+                            if (q < lineEnd && *q >= '0' && *q <= '9') {
+                                q = parseIndex(q, lineEnd, value);
+                                corner.texcoord_index = value;
+                            } else if (q < lineEnd && *q == '-') {
+                                result.unsupported = true; return;
+                            }
+                            if (q < lineEnd && *q == '/') {
+                                ++q;
+                                if (q < lineEnd && *q == '-') { result.unsupported = true; return; }
+                                q = parseIndex(q, lineEnd, value);
+                                if (!q) { result.unsupported = true; return; }
+                                corner.normal_index = value;
+                            }
+                        }
+                        corners[cornerCount++] = corner;
+                    }
+
+                    // Fan triangulation, matching tinyobj's triangulate flag
+                    for (size_t i = 1; i + 1 < cornerCount; ++i) {
+                        result.triangles.push_back(corners[0]);
+                        result.triangles.push_back(corners[i]);
+                        result.triangles.push_back(corners[i + 1]);
+                    }
+                }
+                // Everything else (comments, o/g/s/usemtl/mtllib) is ignored
+
+                p = lineEnd < end ? lineEnd + 1 : end;
+            }
+        }
+
+        /** @brief Converts a raw 1-based index, range-checked; 0 maps to -1 (absent). */
+        bool remapIndex(int raw, size_t count, int& out) {
+            if (raw == 0) {
+                out = -1;
+                return true;
+            }
+            if (static_cast<size_t>(raw) > count) {
+                return false;
+            }
+            out = raw - 1;
+            return true;
+        }
+
+        bool declineParse(std::string* warn, const std::string& reason) {
+            if (warn) *warn = reason;
+            return false;
+        }
+    }
+
+    bool ObjParser::parse(const std::string& path,
+                          tinyobj::attrib_t& attrib,
+                          std::vector<tinyobj::shape_t>& shapes,
+                          std::string* warn) {
+        PROFILE_SCOPE("ObjParser::parse");
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return declineParse(warn, "cannot open " + path);
+        }
+        const std::streamsize size = file.tellg();
+        if (size <= 0) {
+            return declineParse(warn, "empty file " + path);
+        }
+        std::vector<char> text(static_cast<size_t>(size));
+        file.seekg(0);
+        if (!file.read(text.data(), size)) {
+            return declineParse(warn, "read failed for " + path);
+        }
+
+        // One chunk per worker, but never so many that chunks drop below
+        // MIN_CHUNK_BYTES — small files parse inline in a single chunk
+        const size_t workerCount = std::max<size_t>(JobSystem::get().getWorkerCount(), 1);
+        const size_t byBytes = (text.size() + MIN_CHUNK_BYTES - 1) / MIN_CHUNK_BYTES;
+        const size_t chunkCount = std::max<size_t>(1, std::min(workerCount, byBytes));
+
+        // Split at line boundaries: each edge advances to the character
+        // after the next newline, so records never straddle chunks
+        std::vector<const char*> edges(chunkCount + 1);
+        const char* base = text.data();
+        const char* fileEnd = base + text.size();
+        edges[0] = base;
+        edges[chunkCount] = fileEnd;
+        for (size_t i = 1; i < chunkCount; ++i) {
+            const char* candidate = base + (text.size() * i) / chunkCount;
+            if (candidate < edges[i - 1]) candidate = edges[i - 1];
+            const char* newline = static_cast<const char*>(
+                std::memchr(candidate, '\n', static_cast<size_t>(fileEnd - candidate)));
+            edges[i] = newline ? newline + 1 : fileEnd;
+        }
+
+        std::vector<ChunkResult> results(chunkCount);
+        auto handle = JobSystem::get().parallelFor(chunkCount, 1,
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    parseChunk(edges[i], edges[i + 1], results[i]);
+                }
+            });
+        JobSystem::get().wait(handle);
+
+        size_t positionFloats = 0, normalFloats = 0, texcoordFloats = 0, cornerCount = 0;
+        for (const ChunkResult& chunk : results) {
+            if (chunk.unsupported) {
+                return declineParse(warn, path + " uses features the chunked parser skips");
+            }
+            positionFloats += chunk.positions.size();
+            normalFloats += chunk.normals.size();
+            texcoordFloats += chunk.texcoords.size();
+            cornerCount += chunk.triangles.size();
+        }
+        if (positionFloats == 0 || cornerCount == 0) {
+            return declineParse(warn, path + " has no geometry");
+        }
+
+        // Merge in chunk (= file) order; the concatenated attribute arrays
+        // are byte-identical to a sequential parse, so the absolute indices
+        // faces carry are already correct
+        attrib.vertices.clear();
+        attrib.normals.clear();
+        attrib.texcoords.clear();
+        attrib.vertices.reserve(positionFloats);
+        attrib.normals.reserve(normalFloats);
+        attrib.texcoords.reserve(texcoordFloats);
+        for (const ChunkResult& chunk : results) {
+            attrib.vertices.insert(attrib.vertices.end(),
+                                   chunk.positions.begin(), chunk.positions.end());
+            attrib.normals.insert(attrib.normals.end(),
+                                  chunk.normals.begin(), chunk.normals.end());
+            attrib.texcoords.insert(attrib.texcoords.end(),
+                                    chunk.texcoords.begin(), chunk.texcoords.end());
+        }
+
+        const size_t positionCount = attrib.vertices.size() / 3;
+        const size_t normalCount = attrib.normals.size() / 3;
+        const size_t texcoordCount = attrib.texcoords.size() / 2;
+
+        shapes.clear();
+        shapes.resize(1);
+        tinyobj::mesh_t& mesh = shapes[0].mesh;
+        mesh.indices.reserve(cornerCount);
+        mesh.num_face_vertices.assign(cornerCount / 3, 3);
+        for (const ChunkResult& chunk : results) {
+            for (const tinyobj::index_t& raw : chunk.triangles) {
+                tinyobj::index_t corner{};
+                if (!remapIndex(raw.vertex_index, positionCount, corner.vertex_index) ||
+                    !remapIndex(raw.texcoord_index, texcoordCount, corner.texcoord_index) ||
+                    !remapIndex(raw.normal_index, normalCount, corner.normal_index) ||
+                    corner.vertex_index < 0) {
+                    return declineParse(warn, path + " has out-of-range face indices");
+                }
+                mesh.indices.push_back(corner);
+            }
+        }
+
+        LOG_INFO(GENERAL, "ObjParser: parsed {} ({} vertices, {} triangles, {} chunk(s))",
+                 path, positionCount, mesh.indices.size() / 3, chunkCount);
+        return true;
+    }
+
+} // namespace vkeng
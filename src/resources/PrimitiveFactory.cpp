@@ -3,6 +3,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace vkeng {
 
@@ -10,7 +14,43 @@ static constexpr float PI = 3.14159265358979323846f;
 static constexpr float TWO_PI = PI * 2.0f;
 static constexpr glm::vec3 WHITE{1.0f, 1.0f, 1.0f};
 
+namespace {
+    // Dedup cache keyed by (type, tessellation parameters): procedural
+    // scenes that request thousands of identical primitives share one Mesh
+    // (and thus one MeshBufferPool suballocation) per unique shape. Weak
+    // references mean the cache never pins GPU memory — a shape regenerates
+    // only after every user of it is gone. Guarded for loads running on job
+    // threads. Floats are keyed with %.9g, which round-trips exactly.
+    std::mutex g_primitiveCacheMutex;
+    std::unordered_map<std::string, std::weak_ptr<Mesh>> g_primitiveCache;
+
+    std::shared_ptr<Mesh> lookupPrimitive(const std::string& key) {
+        std::lock_guard<std::mutex> lock(g_primitiveCacheMutex);
+        auto it = g_primitiveCache.find(key);
+        if (it != g_primitiveCache.end()) {
+            if (auto mesh = it->second.lock()) {
+                return mesh;
+            }
+            g_primitiveCache.erase(it);
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<Mesh> storePrimitive(const std::string& key, std::shared_ptr<Mesh> mesh) {
+        std::lock_guard<std::mutex> lock(g_primitiveCacheMutex);
+        // Two threads may have raced the same miss; keep the first result
+        // so both callers share one mesh and the loser's copy is dropped
+        auto& slot = g_primitiveCache[key];
+        if (auto existing = slot.lock()) {
+            return existing;
+        }
+        slot = mesh;
+        return mesh;
+    }
+}
+
 std::shared_ptr<Mesh> PrimitiveFactory::createQuad(std::shared_ptr<MemoryManager> memoryManager) {
+    if (auto cached = lookupPrimitive("quad")) return cached;
     const std::vector<Vertex> vertices = {
         {{-0.5f, -0.5f, 0.0f}, WHITE, {0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
         {{ 0.5f, -0.5f, 0.0f}, WHITE, {1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},
@@ -23,10 +63,12 @@ std::shared_ptr<Mesh> PrimitiveFactory::createQuad(std::shared_ptr<MemoryManager
     auto verts = vertices;
     auto inds = indices;
     Vertex::computeTangents(verts, inds);
-    return std::make_shared<Mesh>("primitive_quad", memoryManager, verts, inds);
+    return storePrimitive("quad",
+        std::make_shared<Mesh>("primitive_quad", memoryManager, verts, inds));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createCube(std::shared_ptr<MemoryManager> memoryManager) {
+    if (auto cached = lookupPrimitive("cube")) return cached;
     // 24 vertices (4 per face) with per-face normals and UVs
     const std::vector<Vertex> vertices = {
         // Front face (+Z)
@@ -72,7 +114,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createCube(std::shared_ptr<MemoryManager
     auto verts = vertices;
     auto inds = indices;
     Vertex::computeTangents(verts, inds);
-    return std::make_shared<Mesh>("primitive_cube", memoryManager, verts, inds);
+    return storePrimitive("cube",
+        std::make_shared<Mesh>("primitive_cube", memoryManager, verts, inds));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createPlane(std::shared_ptr<MemoryManager> memoryManager,
@@ -81,6 +124,10 @@ std::shared_ptr<Mesh> PrimitiveFactory::createPlane(std::shared_ptr<MemoryManage
     subdivisionsX = std::max(subdivisionsX, 1u);
     subdivisionsZ = std::max(subdivisionsZ, 1u);
 
+    char key[96];
+    std::snprintf(key, sizeof(key), "plane|%.9g|%.9g|%u|%u", width, depth, subdivisionsX, subdivisionsZ);
+    if (auto cached = lookupPrimitive(key)) return cached;
+
     const uint32_t vertsX = subdivisionsX + 1;
     const uint32_t vertsZ = subdivisionsZ + 1;
 
@@ -126,7 +173,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createPlane(std::shared_ptr<MemoryManage
     }
 
     Vertex::computeTangents(vertices, indices);
-    return std::make_shared<Mesh>("primitive_plane", memoryManager, vertices, indices);
+    return storePrimitive(key,
+        std::make_shared<Mesh>("primitive_plane", memoryManager, vertices, indices));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createCylinder(std::shared_ptr<MemoryManager> memoryManager,
@@ -134,6 +182,10 @@ std::shared_ptr<Mesh> PrimitiveFactory::createCylinder(std::shared_ptr<MemoryMan
                                                         uint32_t segments) {
     segments = std::max(segments, 3u);
 
+    char key[96];
+    std::snprintf(key, sizeof(key), "cylinder|%.9g|%.9g|%u", radius, height, segments);
+    if (auto cached = lookupPrimitive(key)) return cached;
+
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
 
@@ -241,7 +293,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createCylinder(std::shared_ptr<MemoryMan
     }
 
     Vertex::computeTangents(vertices, indices);
-    return std::make_shared<Mesh>("primitive_cylinder", memoryManager, vertices, indices);
+    return storePrimitive(key,
+        std::make_shared<Mesh>("primitive_cylinder", memoryManager, vertices, indices));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createCone(std::shared_ptr<MemoryManager> memoryManager,
@@ -249,6 +302,10 @@ std::shared_ptr<Mesh> PrimitiveFactory::createCone(std::shared_ptr<MemoryManager
                                                     uint32_t segments) {
     segments = std::max(segments, 3u);
 
+    char key[96];
+    std::snprintf(key, sizeof(key), "cone|%.9g|%.9g|%u", radius, height, segments);
+    if (auto cached = lookupPrimitive(key)) return cached;
+
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
 
@@ -325,7 +382,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createCone(std::shared_ptr<MemoryManager
     }
 
     Vertex::computeTangents(vertices, indices);
-    return std::make_shared<Mesh>("primitive_cone", memoryManager, vertices, indices);
+    return storePrimitive(key,
+        std::make_shared<Mesh>("primitive_cone", memoryManager, vertices, indices));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createTorus(std::shared_ptr<MemoryManager> memoryManager,
@@ -334,6 +392,10 @@ std::shared_ptr<Mesh> PrimitiveFactory::createTorus(std::shared_ptr<MemoryManage
     majorSegments = std::max(majorSegments, 3u);
     minorSegments = std::max(minorSegments, 3u);
 
+    char key[96];
+    std::snprintf(key, sizeof(key), "torus|%.9g|%.9g|%u|%u", majorRadius, minorRadius, majorSegments, minorSegments);
+    if (auto cached = lookupPrimitive(key)) return cached;
+
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
     vertices.reserve(static_cast<size_t>(majorSegments + 1) * (minorSegments + 1));
@@ -387,7 +449,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createTorus(std::shared_ptr<MemoryManage
     }
 
     Vertex::computeTangents(vertices, indices);
-    return std::make_shared<Mesh>("primitive_torus", memoryManager, vertices, indices, MeshNormalSource::Authored);
+    return storePrimitive(key,
+        std::make_shared<Mesh>("primitive_torus", memoryManager, vertices, indices, MeshNormalSource::Authored));
 }
 
 std::shared_ptr<Mesh> PrimitiveFactory::createUvSphere(std::shared_ptr<MemoryManager> memoryManager,
@@ -397,6 +460,10 @@ std::shared_ptr<Mesh> PrimitiveFactory::createUvSphere(std::shared_ptr<MemoryMan
     latitudeSegments = std::max(latitudeSegments, 3u);
     longitudeSegments = std::max(longitudeSegments, 3u);
 
+    char key[96];
+    std::snprintf(key, sizeof(key), "sphere|%.9g|%u|%u", radius, latitudeSegments, longitudeSegments);
+    if (auto cached = lookupPrimitive(key)) return cached;
+
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
     vertices.reserve(static_cast<size_t>(latitudeSegments + 1) * static_cast<size_t>(longitudeSegments + 1));
@@ -450,7 +517,8 @@ std::shared_ptr<Mesh> PrimitiveFactory::createUvSphere(std::shared_ptr<MemoryMan
     }
 
     Vertex::computeTangents(vertices, indices);
-    return std::make_shared<Mesh>("primitive_uv_sphere", memoryManager, vertices, indices, MeshNormalSource::Authored);
+    return storePrimitive(key,
+        std::make_shared<Mesh>("primitive_uv_sphere", memoryManager, vertices, indices, MeshNormalSource::Authored));
 }
 
 } // namespace vkeng
@@ -1,4 +1,16 @@
 #include "vulkan-engine/resources/ResourceManager.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace {
+    // Enough workers to overlap disk I/O with decode, without starving the
+    // render and physics threads of cores
+    uint32_t workerCount() {
+        const uint32_t hardware = std::thread::hardware_concurrency();
+        return std::max(1u, std::min(4u, hardware > 1 ? hardware - 1 : 1u));
+    }
+}
 
 namespace vkeng {
 
@@ -7,12 +19,182 @@ ResourceManager& ResourceManager::get() {
     return instance;
 }
 
+ResourceManager::~ResourceManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopWorkers = true;
+    }
+    m_jobCv.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // Workers are joined, so no reader can touch the slot table anymore
+    for (auto& blockPtr : m_slotBlocks) {
+        delete[] blockPtr.load(std::memory_order_relaxed);
+    }
+}
+
 void ResourceManager::clearResources() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_resourcesById.clear();
+
+    // Retire every reserved slot: drop the resource and bump the generation
+    // so outstanding handles fail the compare instead of aliasing whatever
+    // gets published into a reused slot later.
+    const uint32_t count = m_slotCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        Slot* block = m_slotBlocks[i >> kSlotBlockShift].load(std::memory_order_relaxed);
+        Slot& slot = block[i & (kSlotBlockSize - 1)];
+        std::atomic_store(&slot.resource, std::shared_ptr<Resource>());
+        slot.generation.fetch_add(1, std::memory_order_release);
+    }
+    m_slotCount.store(0, std::memory_order_release);
+
     m_resourcesByName.clear();
     m_loaders.clear();
-    m_nextId = 1;
 }
 
-} // namespace vkeng
\ No newline at end of file
+// ============================================================================
+// Slot table (lock-free read path)
+// ============================================================================
+
+/**
+ * @brief Reserves the next slot and encodes its handle id.
+ *
+ * Caller holds m_mutex. The handle's generation is one past the slot's
+ * current generation — the value publishSlot() will store — so the handle
+ * resolves to null until publication and forever after retirement.
+ */
+uint64_t ResourceManager::reserveSlot() {
+    const uint32_t index = m_slotCount.load(std::memory_order_relaxed);
+    const uint32_t blockIndex = index >> kSlotBlockShift;
+    if (blockIndex >= kMaxSlotBlocks) {
+        LOG_WARN(GENERAL, "ResourceManager: slot table exhausted ({} slots)", index);
+        return 0;
+    }
+
+    if (m_slotBlocks[blockIndex].load(std::memory_order_relaxed) == nullptr) {
+        // Blocks are never freed or moved while the manager lives, so a
+        // reader that saw this pointer can use it without coordination
+        m_slotBlocks[blockIndex].store(new Slot[kSlotBlockSize], std::memory_order_release);
+    }
+    m_slotCount.store(index + 1, std::memory_order_release);
+
+    Slot* block = m_slotBlocks[blockIndex].load(std::memory_order_relaxed);
+    const uint32_t generation = block[index & (kSlotBlockSize - 1)].generation
+                                    .load(std::memory_order_relaxed) + 1;
+    return (static_cast<uint64_t>(generation) << 32) | index;
+}
+
+/**
+ * @brief Publishes a resource into its reserved slot.
+ *
+ * Caller holds m_mutex. The resource pointer is stored first, then the
+ * generation with release ordering — a reader that observes the matching
+ * generation is guaranteed to see the resource.
+ */
+void ResourceManager::publishSlot(uint64_t id, std::shared_ptr<Resource> resource) {
+    const uint32_t index = static_cast<uint32_t>(id);
+    const uint32_t generation = static_cast<uint32_t>(id >> 32);
+
+    Slot* block = m_slotBlocks[index >> kSlotBlockShift].load(std::memory_order_relaxed);
+    Slot& slot = block[index & (kSlotBlockSize - 1)];
+    std::atomic_store(&slot.resource, std::move(resource));
+    slot.generation.store(generation, std::memory_order_release);
+}
+
+std::shared_ptr<Resource> ResourceManager::resolveSlot(uint64_t id) const {
+    const uint32_t index = static_cast<uint32_t>(id);
+    const uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (generation == 0 || index >= m_slotCount.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    Slot* block = m_slotBlocks[index >> kSlotBlockShift].load(std::memory_order_acquire);
+    if (block == nullptr) {
+        return nullptr;
+    }
+
+    Slot& slot = block[index & (kSlotBlockSize - 1)];
+    if (slot.generation.load(std::memory_order_acquire) != generation) {
+        return nullptr; // Pending async load, or the handle outlived the resource
+    }
+    return std::atomic_load(&slot.resource);
+}
+
+// ============================================================================
+// Async loading
+// ============================================================================
+
+void ResourceManager::startWorkers() {
+    const uint32_t count = workerCount();
+    m_workers.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_workers.emplace_back(&ResourceManager::workerLoop, this);
+    }
+    LOG_INFO(GENERAL, "ResourceManager: started {} async load workers", count);
+}
+
+void ResourceManager::workerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobCv.wait(lock, [this] { return m_stopWorkers || !m_jobQueue.empty(); });
+            if (m_stopWorkers && m_jobQueue.empty()) {
+                return;
+            }
+            job = std::move(m_jobQueue.front());
+            m_jobQueue.pop_front();
+        }
+        job();
+    }
+}
+
+void ResourceManager::enqueueAsyncJob(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        // Pool is started lazily so purely synchronous apps never spawn it
+        if (m_workers.empty() && !m_stopWorkers) {
+            startWorkers();
+        }
+        m_jobQueue.push_back(std::move(job));
+    }
+    m_jobCv.notify_one();
+}
+
+void ResourceManager::pushCompleted(CompletedLoad completed) {
+    std::lock_guard<std::mutex> lock(m_completedMutex);
+    m_completed.push_back(std::move(completed));
+}
+
+void ResourceManager::pumpCompletedLoads() {
+    std::vector<CompletedLoad> batch;
+    {
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        batch.swap(m_completed);
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& completed : batch) {
+        if (completed.resource) {
+            completed.resource->m_id = completed.id;
+            publishSlot(completed.id, std::move(completed.resource));
+        } else {
+            // Drop the reservation so the path can be requested again
+            auto it = m_resourcesByName.find(StringId(completed.path));
+            if (it != m_resourcesByName.end() && it->second == completed.id) {
+                m_resourcesByName.erase(it);
+            }
+            LOG_WARN(GENERAL, "ResourceManager: async load of {} failed: {}",
+                     completed.path, completed.error);
+        }
+    }
+}
+
+} // namespace vkeng
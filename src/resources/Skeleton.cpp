@@ -0,0 +1,44 @@
+/**
+ * @file Skeleton.cpp
+ * @brief Implementation of the flat joint hierarchy
+ */
+
+#include "vulkan-engine/resources/Skeleton.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+namespace vkeng {
+
+uint32_t Skeleton::addJoint(int32_t parent,
+                            const glm::vec3& translation,
+                            const glm::quat& rotation,
+                            const glm::vec3& scale,
+                            const glm::mat4& inverseBind) {
+    const uint32_t index = jointCount();
+    if (index >= kMaxJoints) {
+        LOG_WARN(GENERAL, "Skeleton: joint cap ({}) reached, joint dropped", kMaxJoints);
+        return kMaxJoints;
+    }
+    if (parent != kNoParent && (parent < 0 || static_cast<uint32_t>(parent) >= index)) {
+        LOG_WARN(GENERAL, "Skeleton: joint {} references parent {} out of order, joint dropped",
+                 index, parent);
+        return kMaxJoints;
+    }
+
+    m_parents.push_back(parent);
+    m_inverseBinds.push_back(inverseBind);
+
+    m_px.push_back(translation.x);
+    m_py.push_back(translation.y);
+    m_pz.push_back(translation.z);
+    m_qx.push_back(rotation.x);
+    m_qy.push_back(rotation.y);
+    m_qz.push_back(rotation.z);
+    m_qw.push_back(rotation.w);
+    m_sx.push_back(scale.x);
+    m_sy.push_back(scale.y);
+    m_sz.push_back(scale.z);
+
+    return index;
+}
+
+} // namespace vkeng
@@ -0,0 +1,159 @@
+#include "vulkan-engine/resources/TextureAtlas.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+namespace {
+    /// @brief Atlas page dimensions in pixels (square).
+    constexpr uint32_t kPageSize = 4096;
+
+    /// @brief Largest dimension a texture may have and still be atlased.
+    constexpr uint32_t kMaxRegionSize = 512;
+
+    /// @brief Empty pixels kept between regions so linear filtering at a
+    /// region's edge cannot sample a neighbour.
+    constexpr uint32_t kRegionPadding = 2;
+}
+
+namespace vkeng {
+
+    TextureAtlas& TextureAtlas::get() {
+        static TextureAtlas instance;
+        return instance;
+    }
+
+    void TextureAtlas::initialize(std::shared_ptr<MemoryManager> memoryManager, VkDevice device) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memoryManager = std::move(memoryManager);
+        m_device = device;
+        LOG_INFO(RENDERING, "Texture atlas enabled ({}x{} pages, regions up to {}px)",
+                 kPageSize, kPageSize, kMaxRegionSize);
+    }
+
+    bool TextureAtlas::shouldAtlas(uint32_t width, uint32_t height) {
+        return width > 0 && height > 0 &&
+               width <= kMaxRegionSize && height <= kMaxRegionSize;
+    }
+
+    bool TextureAtlas::placeRegion(Page& page, uint32_t width, uint32_t height,
+                                   uint32_t& outX, uint32_t& outY) {
+        const uint32_t paddedWidth = width + kRegionPadding;
+        const uint32_t paddedHeight = height + kRegionPadding;
+
+        // Reuse the first existing shelf the region fits on. Shelves only
+        // accept regions no taller than their founder, which keeps the
+        // wasted vertical slack bounded by the sorted-enough load order.
+        for (auto& shelf : page.shelves) {
+            if (paddedHeight <= shelf.height && shelf.cursorX + paddedWidth <= kPageSize) {
+                outX = shelf.cursorX;
+                outY = shelf.y;
+                shelf.cursorX += paddedWidth;
+                return true;
+            }
+        }
+
+        // Open a new shelf sized to this region
+        if (page.nextShelfY + paddedHeight <= kPageSize) {
+            Shelf shelf;
+            shelf.y = page.nextShelfY;
+            shelf.height = paddedHeight;
+            shelf.cursorX = paddedWidth;
+            page.nextShelfY += paddedHeight;
+            outX = 0;
+            outY = shelf.y;
+            page.shelves.push_back(shelf);
+            return true;
+        }
+
+        return false;
+    }
+
+    Result<uint32_t> TextureAtlas::addPage() {
+        // Single mip: per-region mip chains would bleed across neighbours.
+        // sRGB to match the decoded color textures the atlas accepts.
+        auto imageResult = m_memoryManager->createImage(
+            kPageSize, kPageSize,
+            VK_FORMAT_R8G8B8A8_SRGB,
+            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+        if (!imageResult) {
+            return Result<uint32_t>(imageResult.getError());
+        }
+
+        Page page;
+        page.image = imageResult.getValue();
+        m_pages.push_back(std::move(page));
+
+        LOG_INFO(RENDERING, "Opened texture atlas page {} ({}x{})",
+                 m_pages.size() - 1, kPageSize, kPageSize);
+        return Result(static_cast<uint32_t>(m_pages.size() - 1));
+    }
+
+    Result<std::shared_ptr<Texture>> TextureAtlas::addTexture(const std::string& name,
+                                                              const void* pixels,
+                                                              VkDeviceSize size,
+                                                              uint32_t width, uint32_t height) {
+        if (!shouldAtlas(width, height)) {
+            return Result<std::shared_ptr<Texture>>(
+                Error("Texture too large for atlas: " + name));
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_memoryManager) {
+            return Result<std::shared_ptr<Texture>>(Error("TextureAtlas not initialized"));
+        }
+
+        // Find a page with room; open a new one when all are full
+        uint32_t pageIndex = 0;
+        uint32_t x = 0, y = 0;
+        bool placed = false;
+        for (uint32_t i = 0; i < m_pages.size(); ++i) {
+            if (placeRegion(m_pages[i], width, height, x, y)) {
+                pageIndex = i;
+                placed = true;
+                break;
+            }
+        }
+        if (!placed) {
+            auto pageResult = addPage();
+            if (!pageResult) {
+                return Result<std::shared_ptr<Texture>>(pageResult.getError());
+            }
+            pageIndex = pageResult.getValue();
+            // A fresh page always fits a shouldAtlas-sized region
+            placeRegion(m_pages[pageIndex], width, height, x, y);
+        }
+
+        Page& page = m_pages[pageIndex];
+        auto uploadResult = m_memoryManager->uploadToImageRegion(
+            page.image, pixels, size, x, y, width, height, !page.uploaded);
+        if (!uploadResult) {
+            return Result<std::shared_ptr<Texture>>(uploadResult.getError());
+        }
+        page.uploaded = true;
+
+        // Wrap the shared page image; the region's UV remap makes the
+        // texture sample only its own rectangle
+        auto texture = std::make_shared<Texture>(name, m_device, page.image);
+        const float pageSize = static_cast<float>(kPageSize);
+        texture->setUvRegion(glm::vec4(
+            static_cast<float>(width) / pageSize,
+            static_cast<float>(height) / pageSize,
+            static_cast<float>(x) / pageSize,
+            static_cast<float>(y) / pageSize));
+
+        LOG_DEBUG(RENDERING, "Atlased texture {} ({}x{}) into page {} at ({}, {})",
+                  name, width, height, pageIndex, x, y);
+        return Result(texture);
+    }
+
+    size_t TextureAtlas::getPageCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pages.size();
+    }
+
+    void TextureAtlas::clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pages.clear();
+        m_memoryManager.reset();
+        m_device = VK_NULL_HANDLE;
+    }
+
+} // namespace vkeng
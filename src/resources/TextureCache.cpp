@@ -0,0 +1,389 @@
+#include "vulkan-engine/resources/TextureCache.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace {
+    constexpr uint32_t kTextureCacheMagic = 0x564B5458;  // 'VKTX'
+    constexpr uint32_t kTextureCacheVersion = 1;
+
+    /**
+     * @brief On-disk header, followed by the level table
+     *        (mipLevels x TextureCacheLevel) and the compressed payload.
+     *
+     * vkFormat is part of the identity: if the format heuristic or the
+     * encoder changes what it bakes, old files stop validating.
+     */
+    struct TextureCacheHeader {
+        uint32_t magic = kTextureCacheMagic;
+        uint32_t version = kTextureCacheVersion;
+        uint64_t sourceHash = 0;
+        uint32_t vkFormat = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t mipLevels = 0;
+        uint64_t payloadSize = 0;
+    };
+
+    // ------------------------------------------------------------------------
+    // Block compression (BC1 / BC3)
+    //
+    // Fast bounding-box encoder: endpoints are the per-block channel extents
+    // pulled inward by 1/16th of the range, indices pick the nearest palette
+    // entry. No endpoint search — bake speed matters more than the last dB
+    // of PSNR for a first-load cache.
+    // ------------------------------------------------------------------------
+
+    inline uint16_t packRgb565(int r, int g, int b) {
+        return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+
+    /** @brief Compress one 4x4 RGBA block into an 8-byte BC1 color block. */
+    void encodeBc1Block(const unsigned char block[16][4], uint8_t* out) {
+        int minC[3] = {255, 255, 255};
+        int maxC[3] = {0, 0, 0};
+        for (int i = 0; i < 16; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                minC[c] = std::min(minC[c], static_cast<int>(block[i][c]));
+                maxC[c] = std::max(maxC[c], static_cast<int>(block[i][c]));
+            }
+        }
+
+        // Inset the box to soften the error from outlier pixels
+        for (int c = 0; c < 3; ++c) {
+            int inset = (maxC[c] - minC[c]) >> 4;
+            minC[c] = std::min(minC[c] + inset, 255);
+            maxC[c] = std::max(maxC[c] - inset, 0);
+        }
+
+        uint16_t c0 = packRgb565(maxC[0], maxC[1], maxC[2]);
+        uint16_t c1 = packRgb565(minC[0], minC[1], minC[2]);
+        if (c0 < c1) {
+            std::swap(c0, c1);
+            std::swap(minC, maxC);
+        }
+
+        // Palette in full precision: endpoints plus the two 1/3 blend points
+        // (c0 > c1 selects BC1's opaque 4-color mode; equal endpoints make
+        // every index resolve to the same color, so the mode doesn't matter)
+        int palette[4][3];
+        for (int c = 0; c < 3; ++c) {
+            palette[0][c] = maxC[c];
+            palette[1][c] = minC[c];
+            palette[2][c] = (2 * maxC[c] + minC[c]) / 3;
+            palette[3][c] = (maxC[c] + 2 * minC[c]) / 3;
+        }
+
+        uint32_t indices = 0;
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestDist = INT32_MAX;
+            for (int p = 0; p < 4; ++p) {
+                int dr = block[i][0] - palette[p][0];
+                int dg = block[i][1] - palette[p][1];
+                int db = block[i][2] - palette[p][2];
+                int dist = dr * dr + dg * dg + db * db;
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint32_t>(best) << (i * 2);
+        }
+
+        out[0] = static_cast<uint8_t>(c0 & 0xFF);
+        out[1] = static_cast<uint8_t>(c0 >> 8);
+        out[2] = static_cast<uint8_t>(c1 & 0xFF);
+        out[3] = static_cast<uint8_t>(c1 >> 8);
+        std::memcpy(out + 4, &indices, sizeof(indices));
+    }
+
+    /** @brief Compress one 4x4 block's alpha into an 8-byte BC3 alpha block. */
+    void encodeBc3AlphaBlock(const unsigned char block[16][4], uint8_t* out) {
+        int minA = 255;
+        int maxA = 0;
+        for (int i = 0; i < 16; ++i) {
+            minA = std::min(minA, static_cast<int>(block[i][3]));
+            maxA = std::max(maxA, static_cast<int>(block[i][3]));
+        }
+
+        // a0 > a1 selects the 8-value interpolated mode
+        int a0 = maxA;
+        int a1 = minA;
+        int palette[8];
+        palette[0] = a0;
+        palette[1] = a1;
+        for (int p = 1; p < 7; ++p) {
+            palette[p + 1] = ((7 - p) * a0 + p * a1) / 7;
+        }
+
+        uint64_t indices = 0;
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestDist = INT32_MAX;
+            for (int p = 0; p < 8; ++p) {
+                int d = block[i][3] - palette[p];
+                int dist = d * d;
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(best) << (i * 3);
+        }
+
+        out[0] = static_cast<uint8_t>(a0);
+        out[1] = static_cast<uint8_t>(a1);
+        for (int byte = 0; byte < 6; ++byte) {
+            out[2 + byte] = static_cast<uint8_t>((indices >> (byte * 8)) & 0xFF);
+        }
+    }
+
+    /** @brief Fetch a 4x4 block, clamping edge texels for non-multiple-of-4 sizes. */
+    void fetchBlock(const unsigned char* rgba, uint32_t width, uint32_t height,
+                    uint32_t blockX, uint32_t blockY, unsigned char block[16][4]) {
+        for (uint32_t y = 0; y < 4; ++y) {
+            uint32_t srcY = std::min(blockY * 4 + y, height - 1);
+            for (uint32_t x = 0; x < 4; ++x) {
+                uint32_t srcX = std::min(blockX * 4 + x, width - 1);
+                const unsigned char* texel = rgba + (srcY * width + srcX) * 4;
+                std::memcpy(block[y * 4 + x], texel, 4);
+            }
+        }
+    }
+
+    /** @brief Compress one full RGBA level into BC1 or BC3 blocks. */
+    void encodeLevel(const unsigned char* rgba, uint32_t width, uint32_t height,
+                     bool withAlpha, uint8_t* out) {
+        uint32_t blocksX = (width + 3) / 4;
+        uint32_t blocksY = (height + 3) / 4;
+        size_t blockSize = withAlpha ? 16 : 8;
+        for (uint32_t by = 0; by < blocksY; ++by) {
+            for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                unsigned char block[16][4];
+                fetchBlock(rgba, width, height, bx, by, block);
+                uint8_t* dst = out + (by * blocksX + bx) * blockSize;
+                if (withAlpha) {
+                    encodeBc3AlphaBlock(block, dst);
+                    dst += 8;
+                }
+                encodeBc1Block(block, dst);
+            }
+        }
+    }
+
+    /** @brief Compressed size of one level ((w/4)*(h/4) blocks, rounded up). */
+    uint64_t levelByteSize(uint32_t width, uint32_t height, bool withAlpha) {
+        uint64_t blocks = static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+        return blocks * (withAlpha ? 16 : 8);
+    }
+
+    /**
+     * @brief Box-filter one RGBA level down to the next (half size, min 1).
+     *
+     * Averaging in sRGB space is slightly dark but matches what the GPU blit
+     * path has always produced, so cached and uncached textures agree.
+     */
+    std::vector<unsigned char> downsampleRgba(const unsigned char* src,
+                                              uint32_t width, uint32_t height) {
+        uint32_t dstW = std::max(width / 2, 1u);
+        uint32_t dstH = std::max(height / 2, 1u);
+        std::vector<unsigned char> dst(static_cast<size_t>(dstW) * dstH * 4);
+        for (uint32_t y = 0; y < dstH; ++y) {
+            uint32_t y0 = std::min(y * 2, height - 1);
+            uint32_t y1 = std::min(y * 2 + 1, height - 1);
+            for (uint32_t x = 0; x < dstW; ++x) {
+                uint32_t x0 = std::min(x * 2, width - 1);
+                uint32_t x1 = std::min(x * 2 + 1, width - 1);
+                for (uint32_t c = 0; c < 4; ++c) {
+                    uint32_t sum = src[(y0 * width + x0) * 4 + c]
+                                 + src[(y0 * width + x1) * 4 + c]
+                                 + src[(y1 * width + x0) * 4 + c]
+                                 + src[(y1 * width + x1) * 4 + c];
+                    dst[(y * dstW + x) * 4 + c] = static_cast<unsigned char>((sum + 2) / 4);
+                }
+            }
+        }
+        return dst;
+    }
+}
+
+namespace vkeng {
+
+    // ============================================================================
+    // TextureCache
+    // ============================================================================
+
+    std::string TextureCache::cachePathFor(const std::string& sourcePath) {
+        return sourcePath + ".vktex";
+    }
+
+    uint64_t TextureCache::hashFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return 0;
+        }
+
+        // FNV-1a, streamed in chunks: no parsing, just a linear read
+        uint64_t hash = 14695981039346656037ull;
+        char buffer[64 * 1024];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+            std::streamsize count = file.gcount();
+            for (std::streamsize i = 0; i < count; ++i) {
+                hash ^= static_cast<unsigned char>(buffer[i]);
+                hash *= 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    VkFormat TextureCache::chooseFormat(const unsigned char* rgba,
+                                        uint32_t width, uint32_t height) {
+        size_t pixelCount = static_cast<size_t>(width) * height;
+        for (size_t i = 0; i < pixelCount; ++i) {
+            if (rgba[i * 4 + 3] != 255) {
+                return VK_FORMAT_BC3_SRGB_BLOCK;
+            }
+        }
+        return VK_FORMAT_BC1_RGB_SRGB_BLOCK;
+    }
+
+    TextureCache::Transcoded TextureCache::transcode(const unsigned char* rgba,
+                                                     uint32_t width, uint32_t height,
+                                                     VkFormat format, bool generateMips) {
+        bool withAlpha = (format == VK_FORMAT_BC3_SRGB_BLOCK);
+
+        Transcoded result;
+        result.format = format;
+        result.width = width;
+        result.height = height;
+
+        uint32_t mipLevels = 1;
+        if (generateMips) {
+            mipLevels = static_cast<uint32_t>(
+                std::floor(std::log2(std::max(width, height)))) + 1;
+        }
+
+        // Lay out the level table first so each level lands at a stable offset
+        uint64_t offset = 0;
+        uint32_t levelW = width;
+        uint32_t levelH = height;
+        for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+            TextureCacheLevel level;
+            level.offset = offset;
+            level.size = levelByteSize(levelW, levelH, withAlpha);
+            level.width = levelW;
+            level.height = levelH;
+            result.levels.push_back(level);
+            offset += level.size;
+            levelW = std::max(levelW / 2, 1u);
+            levelH = std::max(levelH / 2, 1u);
+        }
+        result.payload.resize(offset);
+
+        // Level 0 straight from the source, then successive box-filter halves
+        std::vector<unsigned char> mipPixels;
+        const unsigned char* levelPixels = rgba;
+        for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+            const TextureCacheLevel& level = result.levels[mip];
+            if (mip > 0) {
+                mipPixels = downsampleRgba(levelPixels,
+                                           result.levels[mip - 1].width,
+                                           result.levels[mip - 1].height);
+                levelPixels = mipPixels.data();
+            }
+            encodeLevel(levelPixels, level.width, level.height, withAlpha,
+                        result.payload.data() + level.offset);
+        }
+
+        return result;
+    }
+
+    Result<MappedTexture> TextureCache::open(const std::string& cachePath,
+                                             uint64_t expectedSourceHash) {
+        auto fileResult = FileMapping::open(cachePath);
+        if (!fileResult) {
+            return Result<MappedTexture>(Error("Texture cache not found: " + cachePath));
+        }
+        FileMapping file = std::move(fileResult.getValue());
+        if (file.size() < sizeof(TextureCacheHeader)) {
+            return Result<MappedTexture>(Error("Texture cache truncated: " + cachePath));
+        }
+        const size_t fileSize = file.size();
+
+        TextureCacheHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        bool valid = header.magic == kTextureCacheMagic
+                  && header.version == kTextureCacheVersion
+                  && header.sourceHash == expectedSourceHash
+                  && header.mipLevels > 0;
+
+        size_t expectedSize = sizeof(TextureCacheHeader)
+                            + header.mipLevels * sizeof(TextureCacheLevel)
+                            + header.payloadSize;
+        if (!valid || fileSize < expectedSize) {
+            return Result<MappedTexture>(Error("Texture cache stale or incompatible: " + cachePath));
+        }
+
+        const char* blob = static_cast<const char*>(file.data()) + sizeof(TextureCacheHeader);
+
+        MappedTexture mapped;
+        mapped.m_file = std::move(file);
+        mapped.m_format = static_cast<VkFormat>(header.vkFormat);
+        mapped.m_width = header.width;
+        mapped.m_height = header.height;
+        mapped.m_mipLevels = header.mipLevels;
+        mapped.m_levels = reinterpret_cast<const TextureCacheLevel*>(blob);
+        mapped.m_payload = blob + header.mipLevels * sizeof(TextureCacheLevel);
+        mapped.m_payloadSize = header.payloadSize;
+
+        return Result<MappedTexture>(std::move(mapped));
+    }
+
+    Result<void> TextureCache::write(const std::string& cachePath,
+                                     uint64_t sourceHash,
+                                     const Transcoded& transcoded) {
+        // Write to a temp file and rename, so a crash mid-write never
+        // leaves a plausible-looking half cache behind
+        std::string tempPath = cachePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return Result<void>(Error("Failed to open texture cache for writing: " + tempPath));
+            }
+
+            TextureCacheHeader header;
+            header.sourceHash = sourceHash;
+            header.vkFormat = static_cast<uint32_t>(transcoded.format);
+            header.width = transcoded.width;
+            header.height = transcoded.height;
+            header.mipLevels = static_cast<uint32_t>(transcoded.levels.size());
+            header.payloadSize = transcoded.payload.size();
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(transcoded.levels.data()),
+                       static_cast<std::streamsize>(transcoded.levels.size() * sizeof(TextureCacheLevel)));
+            file.write(reinterpret_cast<const char*>(transcoded.payload.data()),
+                       static_cast<std::streamsize>(transcoded.payload.size()));
+            if (!file.good()) {
+                return Result<void>(Error("Failed writing texture cache: " + tempPath));
+            }
+        }
+
+        if (std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+            return Result<void>(Error("Failed to move texture cache into place: " + cachePath));
+        }
+
+        LOG_INFO(GENERAL, "TextureCache: wrote {} ({}x{}, {} mips, {} bytes)",
+                 cachePath, transcoded.width, transcoded.height,
+                 transcoded.levels.size(), transcoded.payload.size());
+        return Result<void>();
+    }
+
+} // namespace vkeng
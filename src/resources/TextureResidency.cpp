@@ -0,0 +1,212 @@
+#include "vulkan-engine/resources/TextureResidency.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace {
+    // Drop the top two mip levels on demotion: 1/16th the memory, and the
+    // texture still looks correct beyond the demote distance
+    constexpr uint32_t kDemoteMipBias = 2;
+
+    // Hysteresis between the two thresholds avoids demote/promote cycling
+    // when the camera hovers at the boundary
+    constexpr float kDemoteDistance = 50.0f;
+    constexpr float kPromoteDistance = 35.0f;
+
+    // Frames a replaced image survives so in-flight command buffers finish
+    constexpr uint32_t kRetireFrames = 3;
+
+    float bytesPerPixel(VkFormat format) {
+        switch (format) {
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC4_UNORM_BLOCK:
+            case VK_FORMAT_BC4_SNORM_BLOCK:
+                return 0.5f;
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC5_UNORM_BLOCK:
+            case VK_FORMAT_BC5_SNORM_BLOCK:
+            case VK_FORMAT_BC7_SRGB_BLOCK:
+            case VK_FORMAT_BC7_UNORM_BLOCK:
+                return 1.0f;
+            default:
+                return 4.0f; // uncompressed RGBA8 and friends
+        }
+    }
+}
+
+namespace vkeng {
+
+    TextureResidencyManager& TextureResidencyManager::get() {
+        static TextureResidencyManager instance;
+        return instance;
+    }
+
+    void TextureResidencyManager::configure(std::shared_ptr<MemoryManager> memoryManager,
+                                            uint64_t budgetBytes,
+                                            ReloadFn reload) {
+        m_memoryManager = std::move(memoryManager);
+        m_budgetBytes = budgetBytes;
+        m_reload = std::move(reload);
+        LOG_INFO(RENDERING, "TextureResidency: budget {} MB",
+                 budgetBytes / (1024 * 1024));
+    }
+
+    uint64_t TextureResidencyManager::estimateImageBytes(const Image& image) {
+        // Geometric series over the mip chain: full chain costs ~4/3 of
+        // the base level
+        double bytes = 0.0;
+        uint32_t width = image.getWidth();
+        uint32_t height = image.getHeight();
+        for (uint32_t level = 0; level < image.getMipLevels(); ++level) {
+            bytes += static_cast<double>(width) * height * bytesPerPixel(image.getFormat());
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+        }
+        return static_cast<uint64_t>(bytes);
+    }
+
+    void TextureResidencyManager::registerTexture(std::shared_ptr<Texture> texture,
+                                                  const std::string& sourcePath) {
+        if (!texture || !texture->getImage()) {
+            return;
+        }
+
+        Entry entry;
+        entry.texture = texture;
+        entry.sourcePath = sourcePath;
+        entry.residentBytes = estimateImageBytes(*texture->getImage());
+        m_entries.push_back(std::move(entry));
+        m_residentBytes += m_entries.back().residentBytes;
+    }
+
+    void TextureResidencyManager::noteUsage(const std::shared_ptr<Texture>& texture,
+                                            float cameraDistance) {
+        for (auto& entry : m_entries) {
+            if (entry.texture.lock() == texture) {
+                entry.lastDistance = cameraDistance;
+                return;
+            }
+        }
+    }
+
+    size_t TextureResidencyManager::getDemotedCount() const {
+        return static_cast<size_t>(
+            std::count_if(m_entries.begin(), m_entries.end(),
+                          [](const Entry& entry) { return entry.demoted; }));
+    }
+
+    void TextureResidencyManager::recomputeResidentBytes() {
+        m_residentBytes = 0;
+        for (const auto& entry : m_entries) {
+            m_residentBytes += entry.residentBytes;
+        }
+    }
+
+    void TextureResidencyManager::update() {
+        // Age out retired images now that another frame has completed
+        for (auto& retired : m_retired) {
+            if (retired.framesLeft > 0) {
+                --retired.framesLeft;
+            }
+        }
+        m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                       [](const RetiredImage& retired) {
+                                           return retired.framesLeft == 0;
+                                       }),
+                        m_retired.end());
+
+        // Drop entries whose textures were released elsewhere
+        const size_t before = m_entries.size();
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                       [](const Entry& entry) {
+                                           return entry.texture.expired();
+                                       }),
+                        m_entries.end());
+        if (m_entries.size() != before) {
+            recomputeResidentBytes();
+        }
+
+        if (!m_memoryManager) {
+            return;
+        }
+
+        // Promote at most one near texture per frame
+        if (m_reload) {
+            for (auto& entry : m_entries) {
+                if (!entry.demoted || entry.lastDistance >= kPromoteDistance) {
+                    continue;
+                }
+                auto texture = entry.texture.lock();
+                if (!texture) {
+                    continue;
+                }
+
+                auto reloadResult = m_reload(entry.sourcePath);
+                if (!reloadResult.isSuccess()) {
+                    LOG_WARN(RENDERING, "TextureResidency: promote of {} failed: {}",
+                             entry.sourcePath, reloadResult.getError().message);
+                    break;
+                }
+
+                m_residentBytes -= entry.residentBytes;
+                m_retired.push_back({texture->replaceImage(reloadResult.getValue()), kRetireFrames});
+                entry.residentBytes = estimateImageBytes(*texture->getImage());
+                entry.demoted = false;
+                m_residentBytes += entry.residentBytes;
+                LOG_DEBUG(RENDERING, "TextureResidency: promoted {}", entry.sourcePath);
+                break;
+            }
+        }
+
+        // Demote the most distant eligible texture while over budget
+        if (m_budgetBytes == 0 || m_residentBytes <= m_budgetBytes) {
+            return;
+        }
+
+        Entry* farthest = nullptr;
+        for (auto& entry : m_entries) {
+            if (entry.demoted || entry.lastDistance < kDemoteDistance) {
+                continue;
+            }
+            auto texture = entry.texture.lock();
+            if (!texture || texture->getImage()->getMipLevels() <= kDemoteMipBias) {
+                continue;
+            }
+            if (!farthest || entry.lastDistance > farthest->lastDistance) {
+                farthest = &entry;
+            }
+        }
+        if (!farthest) {
+            return;
+        }
+
+        auto texture = farthest->texture.lock();
+        auto tailResult = m_memoryManager->createMipTailImage(texture->getImage(), kDemoteMipBias);
+        if (!tailResult.isSuccess()) {
+            LOG_WARN(RENDERING, "TextureResidency: demote of {} failed: {}",
+                     farthest->sourcePath, tailResult.getError().message);
+            return;
+        }
+
+        m_residentBytes -= farthest->residentBytes;
+        m_retired.push_back({texture->replaceImage(tailResult.getValue()), kRetireFrames});
+        farthest->residentBytes = estimateImageBytes(*texture->getImage());
+        farthest->demoted = true;
+        m_residentBytes += farthest->residentBytes;
+        LOG_DEBUG(RENDERING, "TextureResidency: demoted {} ({} MB resident)",
+                  farthest->sourcePath, m_residentBytes / (1024 * 1024));
+    }
+
+    void TextureResidencyManager::clear() {
+        m_entries.clear();
+        m_retired.clear();
+        m_residentBytes = 0;
+        m_reload = {};
+        m_memoryManager.reset();
+    }
+
+} // namespace vkeng
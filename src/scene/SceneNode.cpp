@@ -1,5 +1,36 @@
 #include "vulkan-engine/scene/SceneNode.hpp"
+#include "vulkan-engine/scene/SceneQueryIndex.hpp"
+#include "vulkan-engine/components/MeshRenderer.hpp"
+#include "vulkan-engine/math/SimdMath.hpp"
+#include "vulkan-engine/resources/Mesh.hpp"
 #include <glm/gtx/matrix_decompose.hpp>
+#include <algorithm>
+
+namespace {
+    /**
+     * @brief Transforms a local-space AABB by a matrix, producing a world-space AABB.
+     *
+     * Uses the center/extent formulation: the world extent is the absolute
+     * value of the upper 3x3 applied to the local extent, which avoids
+     * transforming all eight corners.
+     */
+    void transformAABB(const glm::mat4& matrix,
+                       const glm::vec3& localMin, const glm::vec3& localMax,
+                       glm::vec3& outMin, glm::vec3& outMax) {
+        glm::vec3 center = (localMin + localMax) * 0.5f;
+        glm::vec3 extent = (localMax - localMin) * 0.5f;
+
+        glm::vec3 worldCenter = glm::vec3(matrix * glm::vec4(center, 1.0f));
+        glm::mat3 absRotation(
+            glm::abs(glm::vec3(matrix[0])),
+            glm::abs(glm::vec3(matrix[1])),
+            glm::abs(glm::vec3(matrix[2])));
+        glm::vec3 worldExtent = absRotation * extent;
+
+        outMin = worldCenter - worldExtent;
+        outMax = worldCenter + worldExtent;
+    }
+}
 
 namespace vkeng {
 
@@ -8,6 +39,8 @@ namespace vkeng {
     // ============================================================================
 
     std::atomic<uint32_t> SceneNode::s_nodeCounter{0};
+    std::atomic<uint64_t> SceneNode::s_structureVersion{0};
+    std::vector<const SceneNode*> SceneNode::s_dirtySubtrees;
 
     // ============================================================================
     // Constructor & Destructor
@@ -22,12 +55,27 @@ namespace vkeng {
         if (m_name.empty()) {
             m_name = "SceneNode_" + std::to_string(s_nodeCounter++);
         }
+        m_nameId = StringId(m_name);
+        SceneQueryIndex::get().registerNode(this);
     }
 
     /**
      * @brief Destructor that cleans up children and components.
      */
     SceneNode::~SceneNode() {
+        // Leave the query index first so a lookup can never resolve to a
+        // node whose shared ownership has already expired
+        SceneQueryIndex::get().unregisterNode(this, m_nameId);
+
+        // Drop any pending dirty-list entry (a listed node may have been
+        // lazily cleaned since, so the scan can't be gated on the flag);
+        // the list is empty in the common steady-state case.
+        if (!s_dirtySubtrees.empty()) {
+            s_dirtySubtrees.erase(
+                std::remove(s_dirtySubtrees.begin(), s_dirtySubtrees.end(), this),
+                s_dirtySubtrees.end());
+        }
+
         removeAllChildren();
         for (auto& [typeId, component] : m_components) {
             component->destroy();
@@ -63,6 +111,8 @@ namespace vkeng {
         child->m_transform.setParent(&m_transform);
         child->markWorldTransformDirty();
         m_children.push_back(child);
+        markWorldBoundsDirty(); // New descendant geometry affects aggregate bounds
+        bumpStructureVersion();
         return true;
     }
 
@@ -77,6 +127,8 @@ namespace vkeng {
             (*it)->m_transform.setParent(nullptr);
             (*it)->markWorldTransformDirty();
             m_children.erase(it);
+            markWorldBoundsDirty(); // Removed geometry shrinks aggregate bounds
+            bumpStructureVersion();
             return true;
         }
         return false;
@@ -91,6 +143,8 @@ namespace vkeng {
         m_children[index]->m_transform.setParent(nullptr);
         m_children[index]->markWorldTransformDirty();
         m_children.erase(m_children.begin() + index);
+        markWorldBoundsDirty();
+        bumpStructureVersion();
         return true;
     }
 
@@ -104,6 +158,8 @@ namespace vkeng {
             child->markWorldTransformDirty();
         }
         m_children.clear();
+        markWorldBoundsDirty();
+        bumpStructureVersion();
     }
 
     /**
@@ -132,6 +188,37 @@ namespace vkeng {
         return nullptr;
     }
 
+    /**
+     * @brief Finds a descendant by name hash with a depth-first walk.
+     * @details Every comparison is a single integer op against the cached
+     * name hash, so deep trees cost no string work at all.
+     */
+    std::shared_ptr<SceneNode> SceneNode::findChild(StringId nameId, bool recursive) const {
+        for (const auto& child : m_children) {
+            if (child->m_nameId == nameId) {
+                return child;
+            }
+        }
+        if (recursive) {
+            for (const auto& child : m_children) {
+                if (auto found = child->findChild(nameId, true)) {
+                    return found;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Renames the node and re-files its query-index entry.
+     */
+    void SceneNode::setName(const std::string& name) {
+        SceneQueryIndex::get().unregisterNode(this, m_nameId);
+        m_name = name;
+        m_nameId = StringId(name);
+        SceneQueryIndex::get().registerNode(this);
+    }
+
     // ============================================================================
     // Transform Management
     // ============================================================================
@@ -177,6 +264,72 @@ namespace vkeng {
         return m_parent->getWorldScale() * m_transform.getScale();
     }
 
+    // ============================================================================
+    // World-Space Bounding Volumes
+    // ============================================================================
+
+    /**
+     * @brief Gets the cached world-space AABB of this node's own mesh.
+     * @details Rebuilds the cache (own mesh + subtree aggregate) if dirty.
+     */
+    bool SceneNode::getMeshWorldBounds(glm::vec3& outMin, glm::vec3& outMax) const {
+        if (m_worldBoundsDirty) {
+            glm::vec3 unusedMin, unusedMax;
+            getSubtreeWorldBounds(unusedMin, unusedMax);
+        }
+        if (!m_meshBoundsValid) return false;
+        outMin = m_cachedMeshBoundsMin;
+        outMax = m_cachedMeshBoundsMax;
+        return true;
+    }
+
+    /**
+     * @brief Gets the cached world-space AABB of this node and all descendants.
+     * @details Recomputes lazily: the own-mesh AABB is the mesh's local bounds
+     * transformed by the world matrix; the subtree AABB is the union of that
+     * with every child's subtree AABB.
+     */
+    bool SceneNode::getSubtreeWorldBounds(glm::vec3& outMin, glm::vec3& outMax) const {
+        if (m_worldBoundsDirty) {
+            // Own mesh contribution
+            m_meshBoundsValid = false;
+            if (auto meshRenderer = getComponent<MeshRenderer>()) {
+                if (auto mesh = meshRenderer->getMesh()) {
+                    transformAABB(getWorldMatrix(),
+                                  mesh->getBoundsMin(), mesh->getBoundsMax(),
+                                  m_cachedMeshBoundsMin, m_cachedMeshBoundsMax);
+                    m_meshBoundsValid = true;
+                }
+            }
+
+            // Aggregate with children
+            m_subtreeBoundsValid = m_meshBoundsValid;
+            m_cachedSubtreeBoundsMin = m_cachedMeshBoundsMin;
+            m_cachedSubtreeBoundsMax = m_cachedMeshBoundsMax;
+
+            for (const auto& child : m_children) {
+                glm::vec3 childMin, childMax;
+                if (child->getSubtreeWorldBounds(childMin, childMax)) {
+                    if (m_subtreeBoundsValid) {
+                        m_cachedSubtreeBoundsMin = glm::min(m_cachedSubtreeBoundsMin, childMin);
+                        m_cachedSubtreeBoundsMax = glm::max(m_cachedSubtreeBoundsMax, childMax);
+                    } else {
+                        m_cachedSubtreeBoundsMin = childMin;
+                        m_cachedSubtreeBoundsMax = childMax;
+                        m_subtreeBoundsValid = true;
+                    }
+                }
+            }
+
+            m_worldBoundsDirty = false;
+        }
+
+        if (!m_subtreeBoundsValid) return false;
+        outMin = m_cachedSubtreeBoundsMin;
+        outMax = m_cachedSubtreeBoundsMax;
+        return true;
+    }
+
     // ============================================================================
     // Scene Traversal & Updates
     // ============================================================================
@@ -219,7 +372,14 @@ namespace vkeng {
             for (const auto& child : m_children) {
                 child->markWorldTransformDirtyRecursive();
             }
+            // The clean→dirty transition dedupes the list: a node under an
+            // already-dirty ancestor was marked recursively above and never
+            // transitions here, so its subtree is covered by the ancestor.
+            s_dirtySubtrees.push_back(this);
         }
+        // World-space bounds depend on the world transform; invalidate them
+        // (and ancestor aggregates) even if the transform was already dirty.
+        markWorldBoundsDirty();
     }
 
     /**
@@ -227,21 +387,68 @@ namespace vkeng {
      */
     void SceneNode::markWorldTransformDirtyRecursive() const {
         m_worldTransformDirty = true;
+        m_worldBoundsDirty = true;
         for (const auto& child : m_children) {
             child->markWorldTransformDirtyRecursive();
         }
     }
 
+    /**
+     * @brief Marks cached world bounds dirty on this node and all ancestors.
+     */
+    void SceneNode::markWorldBoundsDirty() const {
+        // Invariant: a dirty node implies all its ancestors are dirty, so the
+        // upward walk can stop at the first already-dirty node.
+        for (const SceneNode* node = this; node != nullptr; node = node->m_parent) {
+            if (node->m_worldBoundsDirty) break;
+            node->m_worldBoundsDirty = true;
+        }
+    }
+
     /**
      * @brief Recalculates the cached world transform matrix from its parent and local transform.
      */
     void SceneNode::updateWorldTransform() const {
         if (m_parent) {
-            m_cachedWorldMatrix = m_parent->getWorldMatrix() * m_transform.getMatrix();
+            m_cachedWorldMatrix = simd::multiply(m_parent->getWorldMatrix(), m_transform.getMatrix());
         } else {
             m_cachedWorldMatrix = m_transform.getMatrix();
         }
         m_worldTransformDirty = false;
+        m_worldTransformVersion++;
+    }
+
+    /**
+     * @brief Recomputes this subtree's dirty world transforms top-down.
+     */
+    void SceneNode::updateWorldTransformRecursive() const {
+        if (m_worldTransformDirty) {
+            updateWorldTransform();
+        }
+        for (const auto& child : m_children) {
+            // Dirtiness propagates downward at mark time, so a clean child
+            // cannot have dirty descendants — prune the recursion there
+            if (child->m_worldTransformDirty) {
+                child->updateWorldTransformRecursive();
+            }
+        }
+    }
+
+    /**
+     * @brief Recomputes every dirty world transform recorded this frame.
+     */
+    void SceneNode::flushDirtyTransforms() {
+        if (s_dirtySubtrees.empty()) return;
+
+        // Entries are in mark order. A subtree listed before one of its
+        // ancestors is simply recomputed when its own entry runs (resolving
+        // the dirty ancestor chain lazily through getWorldMatrix); the
+        // ancestor's later entry then covers its remaining children, whose
+        // recursion prunes the already-clean branch.
+        for (const SceneNode* root : s_dirtySubtrees) {
+            root->updateWorldTransformRecursive();
+        }
+        s_dirtySubtrees.clear();
     }
 
 } // namespace vkeng
\ No newline at end of file
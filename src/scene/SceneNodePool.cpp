@@ -0,0 +1,126 @@
+#include "vulkan-engine/scene/SceneNodePool.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+
+namespace vkeng {
+
+    SceneNodePool& SceneNodePool::get() {
+        static SceneNodePool instance;
+        return instance;
+    }
+
+    SceneNodePool::~SceneNodePool() {
+        // Live nodes are owned by shared_ptrs elsewhere; by static
+        // teardown they must be gone. Destroy stragglers defensively so
+        // destructors never leak (mirrors TypedComponentPool teardown).
+        for (size_t slot = 0; slot < m_slotCount; slot++) {
+            auto& block = m_blocks[slot / BLOCK_SIZE];
+            if (!block) continue;
+            size_t offset = slot % BLOCK_SIZE;
+            if (block->live[offset]) {
+                block->at(offset)->~SceneNode();
+                block->live[offset] = false;
+            }
+        }
+    }
+
+    std::shared_ptr<SceneNode> SceneNodePool::createNode(const std::string& name) {
+        size_t slot;
+        if (!m_freeList.empty()) {
+            slot = m_freeList.back();
+            m_freeList.pop_back();
+        } else {
+            // Regrow a trimmed slab position before extending the pool,
+            // so slab count tracks the live working set across streaming
+            size_t trimmedBlock = m_blocks.size();
+            for (size_t b = 0; b < m_blocks.size(); b++) {
+                if (!m_blocks[b]) {
+                    trimmedBlock = b;
+                    break;
+                }
+            }
+            if (trimmedBlock < m_blocks.size()) {
+                m_blocks[trimmedBlock] = std::make_unique<Block>();
+                slot = trimmedBlock * BLOCK_SIZE;
+                for (size_t offset = BLOCK_SIZE; offset > 1; offset--) {
+                    m_freeList.push_back(trimmedBlock * BLOCK_SIZE + offset - 1);
+                }
+                m_slotCount = std::max(m_slotCount, (trimmedBlock + 1) * BLOCK_SIZE);
+            } else {
+                slot = m_slotCount++;
+                if (slot / BLOCK_SIZE >= m_blocks.size()) {
+                    m_blocks.push_back(std::make_unique<Block>());
+                }
+            }
+        }
+
+        auto& block = m_blocks[slot / BLOCK_SIZE];
+        size_t offset = slot % BLOCK_SIZE;
+        SceneNode* node = new (block->at(offset)) SceneNode(name);
+        block->live[offset] = true;
+        block->liveInBlock++;
+        m_liveCount++;
+
+        // The shared_ptr aliases pool storage; its deleter returns the
+        // slot instead of freeing heap memory
+        return std::shared_ptr<SceneNode>(node, [](SceneNode* n) {
+            SceneNodePool::get().release(n);
+        });
+    }
+
+    void SceneNodePool::release(SceneNode* node) {
+        for (size_t b = 0; b < m_blocks.size(); b++) {
+            Block* block = m_blocks[b].get();
+            if (!block) continue;
+            SceneNode* first = block->at(0);
+            if (node < first || node >= first + BLOCK_SIZE) continue;
+
+            size_t offset = static_cast<size_t>(node - first);
+            node->~SceneNode();
+            block->live[offset] = false;
+            block->liveInBlock--;
+            m_freeList.push_back(b * BLOCK_SIZE + offset);
+            m_liveCount--;
+            return;
+        }
+        LOG_WARN(GENERAL, "SceneNodePool::release called with a node it does not own");
+    }
+
+    void SceneNodePool::trim() {
+        size_t freed = 0;
+        for (size_t b = 0; b < m_blocks.size(); b++) {
+            Block* block = m_blocks[b].get();
+            if (!block || block->liveInBlock != 0) continue;
+
+            // Drop the slab's slots from the free list before freeing it;
+            // createNode regrows the slab if the position is reused
+            const size_t begin = b * BLOCK_SIZE;
+            const size_t end = begin + BLOCK_SIZE;
+            m_freeList.erase(std::remove_if(m_freeList.begin(), m_freeList.end(),
+                                            [begin, end](size_t slot) {
+                                                return slot >= begin && slot < end;
+                                            }),
+                             m_freeList.end());
+            m_blocks[b].reset();
+            freed++;
+        }
+        if (freed > 0) {
+            LOG_DEBUG(GENERAL, "SceneNodePool trimmed {} empty slab(s)", freed);
+        }
+    }
+
+    size_t SceneNodePool::blockCount() const {
+        size_t count = 0;
+        for (const auto& block : m_blocks) {
+            if (block) count++;
+        }
+        return count;
+    }
+
+    // Defined here so SceneNode.cpp does not need the pool header
+    std::shared_ptr<SceneNode> SceneNode::create(const std::string& name) {
+        return SceneNodePool::get().createNode(name);
+    }
+
+} // namespace vkeng
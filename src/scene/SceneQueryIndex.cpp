@@ -0,0 +1,57 @@
+#include "vulkan-engine/scene/SceneQueryIndex.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+namespace vkeng {
+
+    /**
+     * @brief Looks up one live node by name hash.
+     * @details shared_from_this() re-enters the node's existing ownership;
+     * entries are removed at the top of ~SceneNode, so an indexed node is
+     * always safely shareable.
+     */
+    std::shared_ptr<SceneNode> SceneQueryIndex::findNode(StringId nameId) const {
+        auto it = m_byName.find(nameId);
+        if (it == m_byName.end()) {
+            return nullptr;
+        }
+        return it->second->shared_from_this();
+    }
+
+    /**
+     * @brief Collects every node registered under the given name hash.
+     */
+    size_t SceneQueryIndex::findNodes(StringId nameId,
+                                      std::vector<std::shared_ptr<SceneNode>>& out) const {
+        auto range = m_byName.equal_range(nameId);
+        size_t appended = 0;
+        for (auto it = range.first; it != range.second; ++it) {
+            out.push_back(it->second->shared_from_this());
+            appended++;
+        }
+        return appended;
+    }
+
+    /**
+     * @brief Files a node under its current name hash.
+     */
+    void SceneQueryIndex::registerNode(SceneNode* node) {
+        m_byName.emplace(node->getNameId(), node);
+    }
+
+    /**
+     * @brief Removes a node's entry under the hash it was filed at.
+     * @param nameId The hash the node registered with — passed explicitly
+     *        because a rename must unregister under the old hash before
+     *        re-filing under the new one.
+     */
+    void SceneQueryIndex::unregisterNode(SceneNode* node, StringId nameId) {
+        auto range = m_byName.equal_range(nameId);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == node) {
+                m_byName.erase(it);
+                return;
+            }
+        }
+    }
+
+} // namespace vkeng
@@ -1,10 +1,111 @@
 #include "vulkan-engine/scene/SceneSerializer.hpp"
+#include "vulkan-engine/core/JobSystem.hpp"
 #include "vulkan-engine/core/Logger.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <mutex>
 
 namespace vkeng {
 
+    // ============================================================================
+    // Binary Format Constants
+    // ============================================================================
+
+    namespace {
+
+        // File layout (all multi-byte fields little-endian):
+        //   Header: magic u32, version u32, nodeCount u32, chunkCount u32
+        //   Chunks: type u32, byteLength u32, payload[byteLength]
+        //     StringTable (must be first): count u32, per string u32 len + bytes
+        //     Nodes: count u32, per node:
+        //       parentIndex u32, nameId u32, flags u8,
+        //       position 3*f32, rotation 4*f32 (xyzw), scale 3*f32,
+        //       componentCount u16, per component: typeNameId u32,
+        //       dataLength u32, data bytes
+        constexpr uint32_t kSceneMagic = 0x42534B56;    // 'VKSB'
+        constexpr uint32_t kSceneVersion = 1;
+        constexpr uint32_t kChunkStringTable = 1;
+        constexpr uint32_t kChunkNodes = 2;
+        constexpr uint32_t kRootParentIndex = UINT32_MAX;
+
+        /** @brief Nodes per chunk — small enough to attach within a frame. */
+        constexpr uint32_t SCENE_NODES_PER_CHUNK = 512;
+
+        // --- Write helpers (append to an in-memory chunk payload) ---
+
+        template <typename T>
+        void writePod(std::vector<char>& buf, const T& value) {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buf.insert(buf.end(), bytes, bytes + sizeof(T));
+        }
+
+        void writeBytes(std::vector<char>& buf, const std::string& data) {
+            writePod(buf, static_cast<uint32_t>(data.size()));
+            buf.insert(buf.end(), data.begin(), data.end());
+        }
+
+        // --- Read helpers (bounds-checked cursor over a chunk payload) ---
+
+        struct PayloadReader {
+            const char* cursor;
+            size_t remaining;
+
+            explicit PayloadReader(const std::vector<char>& payload)
+                : cursor(payload.data()), remaining(payload.size()) {}
+
+            template <typename T>
+            bool read(T& out) {
+                if (remaining < sizeof(T)) return false;
+                std::memcpy(&out, cursor, sizeof(T));
+                cursor += sizeof(T);
+                remaining -= sizeof(T);
+                return true;
+            }
+
+            bool readBytes(std::string& out) {
+                uint32_t length = 0;
+                if (!read(length) || remaining < length) return false;
+                out.assign(cursor, length);
+                cursor += length;
+                remaining -= length;
+                return true;
+            }
+        };
+
+        /** @brief Interns strings into a table of unique entries. */
+        struct StringTable {
+            std::vector<std::string> strings;
+            std::unordered_map<std::string, uint32_t> indices;
+
+            uint32_t intern(const std::string& value) {
+                auto it = indices.find(value);
+                if (it != indices.end()) return it->second;
+                uint32_t id = static_cast<uint32_t>(strings.size());
+                strings.push_back(value);
+                indices.emplace(value, id);
+                return id;
+            }
+        };
+
+        /** @brief Reads one chunk header + payload; false on EOF or error. */
+        bool readChunk(std::ifstream& file, uint32_t& type, std::vector<char>& payload) {
+            uint32_t header[2];  // type, byteLength
+            if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+            type = header[0];
+            payload.resize(header[1]);
+            return static_cast<bool>(file.read(payload.data(), payload.size()));
+        }
+
+    } // namespace
+
+    // ============================================================================
+    // JSON Format (debug/interchange)
+    // ============================================================================
+
     bool SceneSerializer::saveScene(const SceneNode* root, const std::string& filepath) const {
         if (!root) {
             LOG_ERROR(GENERAL, "SceneSerializer::saveScene() — null root node");
@@ -40,4 +141,412 @@ namespace vkeng {
         return nullptr;
     }
 
+    // ============================================================================
+    // Binary Format — Save
+    // ============================================================================
+
+    bool SceneSerializer::saveSceneBinary(const SceneNode* root, const std::string& filepath) const {
+        if (!root) {
+            LOG_ERROR(GENERAL, "SceneSerializer::saveSceneBinary() — null root node");
+            return false;
+        }
+
+        // Flatten depth-first so every parent precedes its children; the
+        // parent index a node stores is simply the flat index of its parent
+        std::vector<std::pair<const SceneNode*, uint32_t>> flat;
+        std::function<void(const SceneNode*, uint32_t)> flatten =
+            [&](const SceneNode* node, uint32_t parentIndex) {
+                uint32_t myIndex = static_cast<uint32_t>(flat.size());
+                flat.emplace_back(node, parentIndex);
+                for (const auto& child : node->getChildren()) {
+                    flatten(child.get(), myIndex);
+                }
+            };
+        flatten(root, kRootParentIndex);
+
+        // Serialize nodes into chunk payloads, interning names as we go
+        StringTable table;
+        std::vector<std::vector<char>> nodeChunks;
+        uint32_t skippedComponents = 0;
+
+        for (size_t begin = 0; begin < flat.size(); begin += SCENE_NODES_PER_CHUNK) {
+            size_t end = std::min(flat.size(), begin + SCENE_NODES_PER_CHUNK);
+            std::vector<char>& payload = nodeChunks.emplace_back();
+            writePod(payload, static_cast<uint32_t>(end - begin));
+
+            for (size_t i = begin; i < end; i++) {
+                const SceneNode* node = flat[i].first;
+                writePod(payload, flat[i].second);
+                writePod(payload, table.intern(node->getName()));
+
+                uint8_t flags = 0;
+                if (node->isActive()) flags |= 1;
+                if (node->isStatic()) flags |= 2;
+                writePod(payload, flags);
+
+                const Transform& transform = node->getTransform();
+                writePod(payload, transform.getPosition());
+                writePod(payload, transform.getRotation());
+                writePod(payload, transform.getScale());
+
+                // Only registered component types are saved; the rest are
+                // counted so the log makes silent data loss visible
+                std::vector<std::pair<uint32_t, std::string>> serialized;
+                for (const auto& [typeId, component] : node->getComponents()) {
+                    auto it = m_serializers.find(typeId);
+                    if (it == m_serializers.end()) {
+                        skippedComponents++;
+                        continue;
+                    }
+                    serialized.emplace_back(table.intern(it->second.typeName),
+                                            it->second.fn(component.get()));
+                }
+                writePod(payload, static_cast<uint16_t>(serialized.size()));
+                for (const auto& [typeNameId, data] : serialized) {
+                    writePod(payload, typeNameId);
+                    writeBytes(payload, data);
+                }
+            }
+        }
+
+        // String table payload (written before node chunks in the file)
+        std::vector<char> stringPayload;
+        writePod(stringPayload, static_cast<uint32_t>(table.strings.size()));
+        for (const auto& value : table.strings) {
+            writeBytes(stringPayload, value);
+        }
+
+        std::ofstream file(filepath, std::ios::binary);
+        if (!file.is_open()) {
+            LOG_ERROR(GENERAL, "SceneSerializer::saveSceneBinary() — cannot open '{}'", filepath);
+            return false;
+        }
+
+        uint32_t header[4] = {kSceneMagic, kSceneVersion,
+                              static_cast<uint32_t>(flat.size()),
+                              static_cast<uint32_t>(1 + nodeChunks.size())};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        auto writeChunk = [&file](uint32_t type, const std::vector<char>& payload) {
+            uint32_t chunkHeader[2] = {type, static_cast<uint32_t>(payload.size())};
+            file.write(reinterpret_cast<const char*>(chunkHeader), sizeof(chunkHeader));
+            file.write(payload.data(), payload.size());
+        };
+        writeChunk(kChunkStringTable, stringPayload);
+        for (const auto& payload : nodeChunks) {
+            writeChunk(kChunkNodes, payload);
+        }
+
+        if (!file) {
+            LOG_ERROR(GENERAL, "SceneSerializer::saveSceneBinary() — write failed for '{}'", filepath);
+            return false;
+        }
+        if (skippedComponents > 0) {
+            LOG_WARN(GENERAL, "Binary scene save skipped {} components with no registered serializer",
+                     skippedComponents);
+        }
+        LOG_INFO(GENERAL, "Saved binary scene '{}': {} nodes in {} chunks, {} interned strings",
+                 filepath, flat.size(), nodeChunks.size(), table.strings.size());
+        return true;
+    }
+
+    // ============================================================================
+    // Binary Format — Decode and Attach
+    // ============================================================================
+
+    bool SceneSerializer::decodeNodeChunk(const std::vector<char>& payload,
+                                          const std::vector<std::string>& strings,
+                                          std::vector<DecodedNode>& out) {
+        PayloadReader reader(payload);
+        uint32_t count = 0;
+        if (!reader.read(count)) return false;
+        out.reserve(out.size() + count);
+
+        auto resolve = [&strings](uint32_t id, std::string& value) {
+            if (id >= strings.size()) return false;
+            value = strings[id];
+            return true;
+        };
+
+        for (uint32_t i = 0; i < count; i++) {
+            DecodedNode& node = out.emplace_back();
+            uint32_t nameId = 0;
+            if (!reader.read(node.parentIndex) || !reader.read(nameId) ||
+                !reader.read(node.flags) || !reader.read(node.position) ||
+                !reader.read(node.rotation) || !reader.read(node.scale) ||
+                !resolve(nameId, node.name)) {
+                return false;
+            }
+
+            uint16_t componentCount = 0;
+            if (!reader.read(componentCount)) return false;
+            node.components.resize(componentCount);
+            for (auto& component : node.components) {
+                uint32_t typeNameId = 0;
+                if (!reader.read(typeNameId) || !resolve(typeNameId, component.typeName) ||
+                    !reader.readBytes(component.data)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<SceneNode> SceneSerializer::applyDecodedNodes(
+            const std::vector<DecodedNode>& nodes,
+            std::vector<std::shared_ptr<SceneNode>>& nodesByIndex) const {
+        std::shared_ptr<SceneNode> root;
+
+        for (const DecodedNode& record : nodes) {
+            auto node = SceneNode::create(record.name);
+            node->setActive((record.flags & 1) != 0);
+            node->setStatic((record.flags & 2) != 0);
+
+            Transform& transform = node->getTransform();
+            transform.setPosition(record.position);
+            transform.setRotation(record.rotation);
+            transform.setScale(record.scale);
+
+            for (const DecodedComponent& component : record.components) {
+                auto it = m_deserializers.find(component.typeName);
+                if (it == m_deserializers.end()) {
+                    LOG_WARN(GENERAL, "Binary scene references unregistered component type '{}' — skipped",
+                             component.typeName);
+                    continue;
+                }
+                it->second(node.get(), component.data);
+            }
+
+            if (record.parentIndex == kRootParentIndex) {
+                root = node;
+            } else if (record.parentIndex < nodesByIndex.size()) {
+                nodesByIndex[record.parentIndex]->addChild(node);
+            } else {
+                // Depth-first order guarantees parents precede children, so
+                // this only fires on a corrupt or truncated file
+                LOG_ERROR(GENERAL, "Binary scene node '{}' references unknown parent index {}",
+                          record.name, record.parentIndex);
+            }
+            nodesByIndex.push_back(std::move(node));
+        }
+        return root;
+    }
+
+    // ============================================================================
+    // Binary Format — Synchronous Load
+    // ============================================================================
+
+    std::shared_ptr<SceneNode> SceneSerializer::loadSceneBinary(const std::string& filepath) const {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open()) {
+            LOG_ERROR(GENERAL, "SceneSerializer::loadSceneBinary() — cannot open '{}'", filepath);
+            return nullptr;
+        }
+
+        uint32_t header[4];  // magic, version, nodeCount, chunkCount
+        if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+            header[0] != kSceneMagic || header[1] != kSceneVersion) {
+            LOG_ERROR(GENERAL, "SceneSerializer::loadSceneBinary() — '{}' is not a version {} binary scene",
+                      filepath, kSceneVersion);
+            return nullptr;
+        }
+
+        std::vector<std::string> strings;
+        std::vector<std::shared_ptr<SceneNode>> nodesByIndex;
+        nodesByIndex.reserve(header[2]);
+        std::shared_ptr<SceneNode> root;
+
+        uint32_t type = 0;
+        std::vector<char> payload;
+        while (readChunk(file, type, payload)) {
+            if (type == kChunkStringTable) {
+                PayloadReader reader(payload);
+                uint32_t count = 0;
+                if (!reader.read(count)) break;
+                strings.resize(count);
+                for (auto& value : strings) {
+                    if (!reader.readBytes(value)) {
+                        LOG_ERROR(GENERAL, "Binary scene '{}' has a corrupt string table", filepath);
+                        return nullptr;
+                    }
+                }
+            } else if (type == kChunkNodes) {
+                // Decode and attach one chunk at a time; the decoded records
+                // are discarded before the next chunk is read, so peak memory
+                // never holds the whole file as an intermediate representation
+                std::vector<DecodedNode> decoded;
+                if (!decodeNodeChunk(payload, strings, decoded)) {
+                    LOG_ERROR(GENERAL, "Binary scene '{}' has a corrupt node chunk", filepath);
+                    return nullptr;
+                }
+                auto chunkRoot = applyDecodedNodes(decoded, nodesByIndex);
+                if (chunkRoot) root = chunkRoot;
+            } else {
+                LOG_WARN(GENERAL, "Binary scene '{}' contains unknown chunk type {} — skipped",
+                         filepath, type);
+            }
+        }
+
+        if (!root) {
+            LOG_ERROR(GENERAL, "Binary scene '{}' contained no root node", filepath);
+            return nullptr;
+        }
+        LOG_INFO(GENERAL, "Loaded binary scene '{}': {} nodes", filepath, nodesByIndex.size());
+        return root;
+    }
+
+    // ============================================================================
+    // Binary Format — Streaming Load
+    // ============================================================================
+
+    /**
+     * @brief State shared between the background reader job and the pump.
+     *
+     * The reader thread only touches the file, the string table (read-only
+     * after construction), and the ready queue under the mutex; SceneNode
+     * construction happens exclusively on the pumping thread.
+     */
+    struct SceneSerializer::StreamingState {
+        std::ifstream file;                             ///< Owned by the reader job after launch
+        std::string filepath;                           ///< For log messages
+        std::vector<std::string> strings;               ///< Interned names (immutable once read)
+        std::vector<std::shared_ptr<SceneNode>> nodesByIndex;  ///< Pump-thread only
+        std::shared_ptr<SceneNode> root;                ///< Pump-thread only
+
+        std::mutex mutex;                               ///< Guards readyChunks
+        std::deque<std::vector<DecodedNode>> readyChunks;  ///< Decoded, awaiting attach
+        std::atomic<bool> readerDone{false};
+        std::atomic<bool> failed{false};
+        uint32_t totalNodes = 0;
+        std::atomic<uint32_t> appliedNodes{0};
+    };
+
+    std::shared_ptr<SceneNode> SceneSerializer::loadSceneBinaryStreaming(const std::string& filepath) {
+        if (m_streaming) {
+            LOG_WARN(GENERAL, "Streaming scene load already in progress ('{}') — ignoring '{}'",
+                     m_streaming->filepath, filepath);
+            return nullptr;
+        }
+
+        auto state = std::make_shared<StreamingState>();
+        state->filepath = filepath;
+        state->file.open(filepath, std::ios::binary);
+        if (!state->file.is_open()) {
+            LOG_ERROR(GENERAL, "SceneSerializer::loadSceneBinaryStreaming() — cannot open '{}'", filepath);
+            return nullptr;
+        }
+
+        uint32_t header[4];  // magic, version, nodeCount, chunkCount
+        if (!state->file.read(reinterpret_cast<char*>(header), sizeof(header)) ||
+            header[0] != kSceneMagic || header[1] != kSceneVersion) {
+            LOG_ERROR(GENERAL, "SceneSerializer::loadSceneBinaryStreaming() — '{}' is not a version {} binary scene",
+                      filepath, kSceneVersion);
+            return nullptr;
+        }
+        state->totalNodes = header[2];
+        state->nodesByIndex.reserve(state->totalNodes);
+
+        // String table and first node chunk load synchronously so the caller
+        // has a renderable partial scene the moment this returns
+        uint32_t type = 0;
+        std::vector<char> payload;
+        if (!readChunk(state->file, type, payload) || type != kChunkStringTable) {
+            LOG_ERROR(GENERAL, "Binary scene '{}' does not start with a string table", filepath);
+            return nullptr;
+        }
+        {
+            PayloadReader reader(payload);
+            uint32_t count = 0;
+            if (!reader.read(count)) return nullptr;
+            state->strings.resize(count);
+            for (auto& value : state->strings) {
+                if (!reader.readBytes(value)) {
+                    LOG_ERROR(GENERAL, "Binary scene '{}' has a corrupt string table", filepath);
+                    return nullptr;
+                }
+            }
+        }
+
+        if (readChunk(state->file, type, payload) && type == kChunkNodes) {
+            std::vector<DecodedNode> decoded;
+            if (!decodeNodeChunk(payload, state->strings, decoded)) {
+                LOG_ERROR(GENERAL, "Binary scene '{}' has a corrupt node chunk", filepath);
+                return nullptr;
+            }
+            state->root = applyDecodedNodes(decoded, state->nodesByIndex);
+            state->appliedNodes.store(static_cast<uint32_t>(state->nodesByIndex.size()));
+        }
+        if (!state->root) {
+            LOG_ERROR(GENERAL, "Binary scene '{}' contained no root node in its first chunk", filepath);
+            return nullptr;
+        }
+
+        // Remaining chunks decode on the worker pool; the shared_ptr keeps
+        // the state alive even if the serializer is destroyed mid-stream
+        m_streaming = state;
+        JobSystem::get().schedule([state]() {
+            uint32_t type = 0;
+            std::vector<char> payload;
+            while (readChunk(state->file, type, payload)) {
+                if (type != kChunkNodes) continue;
+                std::vector<DecodedNode> decoded;
+                if (!decodeNodeChunk(payload, state->strings, decoded)) {
+                    state->failed.store(true);
+                    break;
+                }
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->readyChunks.push_back(std::move(decoded));
+            }
+            state->readerDone.store(true);
+        });
+
+        LOG_INFO(GENERAL, "Streaming binary scene '{}': {} of {} nodes attached, rest loading in background",
+                 filepath, state->appliedNodes.load(), state->totalNodes);
+        return state->root;
+    }
+
+    bool SceneSerializer::pumpStreamedChunks(uint32_t maxChunks) {
+        if (!m_streaming) return false;
+        StreamingState& state = *m_streaming;
+
+        uint32_t applied = 0;
+        while (maxChunks == 0 || applied < maxChunks) {
+            std::vector<DecodedNode> decoded;
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (state.readyChunks.empty()) break;
+                decoded = std::move(state.readyChunks.front());
+                state.readyChunks.pop_front();
+            }
+            applyDecodedNodes(decoded, state.nodesByIndex);
+            state.appliedNodes.store(static_cast<uint32_t>(state.nodesByIndex.size()));
+            applied++;
+        }
+
+        // Done only when the reader has finished AND the queue is drained
+        bool queueEmpty;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            queueEmpty = state.readyChunks.empty();
+        }
+        if (state.readerDone.load() && queueEmpty) {
+            if (state.failed.load()) {
+                LOG_ERROR(GENERAL, "Streaming binary scene '{}' failed: corrupt chunk after {} nodes",
+                          state.filepath, state.appliedNodes.load());
+            } else {
+                LOG_INFO(GENERAL, "Streaming binary scene '{}' complete: {} nodes",
+                         state.filepath, state.appliedNodes.load());
+            }
+            m_streaming.reset();
+            return false;
+        }
+        return true;
+    }
+
+    float SceneSerializer::getStreamingProgress() const {
+        if (!m_streaming || m_streaming->totalNodes == 0) return 1.0f;
+        return static_cast<float>(m_streaming->appliedNodes.load()) /
+               static_cast<float>(m_streaming->totalNodes);
+    }
+
 } // namespace vkeng
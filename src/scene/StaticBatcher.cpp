@@ -0,0 +1,138 @@
+#include "vulkan-engine/scene/StaticBatcher.hpp"
+#include "vulkan-engine/components/MeshRenderer.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+#include "vulkan-engine/resources/Material.hpp"
+#include "vulkan-engine/resources/Mesh.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+
+#include <glm/gtc/matrix_inverse.hpp>
+#include <map>
+#include <vector>
+
+namespace vkeng {
+
+    namespace {
+
+        /// One static mesh instance gathered during the scene walk
+        struct BatchCandidate {
+            std::shared_ptr<MeshRenderer> renderer;
+            std::shared_ptr<Mesh> mesh;
+            glm::mat4 worldMatrix;
+        };
+
+        /**
+         * @brief Collects batchable renderers from static nodes in the subtree
+         *
+         * A candidate needs a static node, a mesh with its CPU copy still
+         * retained, and is grouped by exact Material instance so every draw
+         * in a batch shares pipeline state and texture bindings. Null-material
+         * renderers batch together (they all render with the fallback set).
+         */
+        void collectCandidates(SceneNode& node,
+                               std::map<Material*, std::vector<BatchCandidate>>& groups) {
+            if (!node.isActive()) return;
+
+            if (node.isStatic()) {
+                if (auto renderer = node.getComponent<MeshRenderer>()) {
+                    auto mesh = renderer->getMesh();
+                    if (mesh && mesh->hasCpuData()) {
+                        groups[renderer->getMaterial().get()].push_back(
+                            BatchCandidate{renderer, mesh, node.getWorldMatrix()});
+                    } else if (mesh) {
+                        LOG_DEBUG(RENDERING,
+                                  "Static mesh '{}' skipped by batcher (CPU data released)",
+                                  mesh->getName());
+                    }
+                }
+            }
+
+            for (const auto& child : node.getChildren()) {
+                collectCandidates(*child, groups);
+            }
+        }
+
+    }
+
+    StaticBatcher::Stats StaticBatcher::batch(SceneNode& root,
+                                              std::shared_ptr<MemoryManager> memoryManager) {
+        Stats stats{};
+
+        // Group candidates by material identity; std::map keeps the batch
+        // order deterministic across runs
+        std::map<Material*, std::vector<BatchCandidate>> groups;
+        collectCandidates(root, groups);
+
+        uint32_t batchIndex = 0;
+        for (auto& [material, candidates] : groups) {
+            if (candidates.size() < 2) {
+                continue; // Nothing to merge — a lone draw stays as-is
+            }
+
+            size_t totalVertices = 0;
+            size_t totalIndices = 0;
+            for (const auto& candidate : candidates) {
+                totalVertices += candidate.mesh->getCpuVertices().size();
+                totalIndices += candidate.mesh->getCpuIndices().size();
+            }
+
+            std::vector<Vertex> mergedVertices;
+            std::vector<uint32_t> mergedIndices;
+            mergedVertices.reserve(totalVertices);
+            mergedIndices.reserve(totalIndices);
+
+            for (const auto& candidate : candidates) {
+                const glm::mat4& world = candidate.worldMatrix;
+                // Inverse-transpose handles non-uniform scale on normals
+                const glm::mat3 normalMatrix = glm::inverseTranspose(glm::mat3(world));
+                const uint32_t baseVertex = static_cast<uint32_t>(mergedVertices.size());
+
+                for (const Vertex& src : candidate.mesh->getCpuVertices()) {
+                    Vertex baked = src;
+                    baked.pos = glm::vec3(world * glm::vec4(src.pos, 1.0f));
+                    baked.normal = glm::normalize(normalMatrix * src.normal);
+                    baked.tangent = glm::vec4(
+                        glm::normalize(glm::mat3(world) * glm::vec3(src.tangent)),
+                        src.tangent.w);
+                    mergedVertices.push_back(baked);
+                }
+                for (uint32_t index : candidate.mesh->getCpuIndices()) {
+                    mergedIndices.push_back(baseVertex + index);
+                }
+            }
+
+            auto mergedMesh = std::make_shared<Mesh>(
+                "__static_batch_" + std::to_string(batchIndex),
+                memoryManager, mergedVertices, mergedIndices);
+            // The merged copy only exists for this batch; free it immediately
+            mergedMesh->releaseCpuData();
+
+            // One identity-transform node per batch, attached to the root so
+            // the regular collectDrawCalls path picks it up
+            auto batchNode = SceneNode::create(mergedMesh->getName());
+            batchNode->setStatic(true);
+            batchNode->addComponent<MeshRenderer>(
+                mergedMesh,
+                material ? candidates.front().renderer->getMaterial() : nullptr);
+            root.addChild(batchNode);
+
+            // Clear the source renderers; their nodes (and children) remain
+            for (auto& candidate : candidates) {
+                candidate.renderer->setMesh(nullptr);
+            }
+
+            stats.batchesCreated++;
+            stats.meshesMerged += static_cast<uint32_t>(candidates.size());
+            stats.verticesBaked += static_cast<uint32_t>(mergedVertices.size());
+            batchIndex++;
+        }
+
+        if (stats.batchesCreated > 0) {
+            LOG_INFO(RENDERING,
+                     "Static batching merged {} meshes into {} batches ({} vertices baked)",
+                     stats.meshesMerged, stats.batchesCreated, stats.verticesBaked);
+        }
+
+        return stats;
+    }
+
+} // namespace vkeng
@@ -0,0 +1,177 @@
+#include "vulkan-engine/scene/TransformSystem.hpp"
+#include "vulkan-engine/scene/SceneNode.hpp"
+#include "vulkan-engine/core/Logger.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+    /**
+     * @brief Minimum nodes in a depth level before the update is split
+     *        across worker threads.
+     *
+     * Below this, thread launch overhead exceeds the matrix work saved.
+     */
+    constexpr uint32_t kParallelGrain = 4096;
+}
+
+namespace vkeng {
+
+    TransformSystem::~TransformSystem() {
+        clear();
+    }
+
+    // ============================================================================
+    // Hierarchy Flattening
+    // ============================================================================
+
+    /**
+     * @brief Flattens the hierarchy breadth-first into the SoA arrays.
+     */
+    void TransformSystem::build(const std::shared_ptr<SceneNode>& root) {
+        clear();
+        if (!root) {
+            return;
+        }
+
+        // Breadth-first traversal yields a topological order (parents before
+        // children) where each depth level occupies a contiguous index range.
+        std::deque<SceneNode*> frontier;
+        frontier.push_back(root.get());
+        uint32_t levelBegin = 0;
+
+        while (!frontier.empty()) {
+            size_t levelCount = frontier.size();
+            for (size_t i = 0; i < levelCount; ++i) {
+                SceneNode* node = frontier.front();
+                frontier.pop_front();
+
+                uint32_t index = static_cast<uint32_t>(m_nodes.size());
+                node->m_transformIndex = index;
+
+                const Transform& local = node->getTransform();
+                m_localPositions.push_back(local.getPosition());
+                m_localRotations.push_back(local.getRotation());
+                m_localScales.push_back(local.getScale());
+
+                SceneNode* parent = node->getParent();
+                m_parentIndices.push_back(parent ? parent->m_transformIndex : kInvalidIndex);
+                m_worldMatrices.push_back(glm::mat4(1.0f));
+                m_nodes.push_back(node);
+
+                for (const auto& child : node->getChildren()) {
+                    frontier.push_back(child.get());
+                }
+            }
+
+            uint32_t levelEnd = static_cast<uint32_t>(m_nodes.size());
+            m_levelRanges.emplace_back(levelBegin, levelEnd);
+            levelBegin = levelEnd;
+        }
+
+        LOG_DEBUG(GENERAL, "TransformSystem: flattened {} nodes across {} depth levels",
+                  m_nodes.size(), m_levelRanges.size());
+    }
+
+    /**
+     * @brief Unregisters all nodes and releases the flat arrays.
+     */
+    void TransformSystem::clear() {
+        for (SceneNode* node : m_nodes) {
+            node->m_transformIndex = kInvalidIndex;
+        }
+        m_localPositions.clear();
+        m_localRotations.clear();
+        m_localScales.clear();
+        m_parentIndices.clear();
+        m_worldMatrices.clear();
+        m_nodes.clear();
+        m_levelRanges.clear();
+    }
+
+    // ============================================================================
+    // World Matrix Update
+    // ============================================================================
+
+    /**
+     * @brief Copies local TRS back from nodes whose Transform changed.
+     *
+     * The Transform dirty flag is only cleared by its own lazy matrix
+     * rebuild, so an edited-then-untouched transform stays flagged; the
+     * re-copy is three small vector stores, cheaper than resolving it.
+     */
+    void TransformSystem::refreshDirtyLocals() {
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            const Transform& local = m_nodes[i]->getTransform();
+            if (local.isDirty()) {
+                m_localPositions[i] = local.getPosition();
+                m_localRotations[i] = local.getRotation();
+                m_localScales[i] = local.getScale();
+            }
+        }
+    }
+
+    /**
+     * @brief Computes world matrices for one contiguous index range.
+     *
+     * Parent indices always reference earlier depth levels, so ranges within
+     * a level never read matrices written by a concurrent worker.
+     */
+    void TransformSystem::updateRange(uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; ++i) {
+            // Same TRS composition order as Transform::updateMatrices()
+            glm::mat4 local = glm::translate(glm::mat4(1.0f), m_localPositions[i])
+                            * glm::mat4_cast(m_localRotations[i])
+                            * glm::scale(glm::mat4(1.0f), m_localScales[i]);
+
+            uint32_t parent = m_parentIndices[i];
+            m_worldMatrices[i] = (parent != kInvalidIndex)
+                ? m_worldMatrices[parent] * local
+                : local;
+
+            // Keep the node's lazy cache coherent so existing
+            // getWorldMatrix() callers observe the bulk result. The version
+            // only moves when the matrix actually changed, so change
+            // detectors (light gather) aren't defeated by the full rewrite.
+            SceneNode* node = m_nodes[i];
+            if (node->m_cachedWorldMatrix != m_worldMatrices[i]) {
+                node->m_worldTransformVersion++;
+            }
+            node->m_cachedWorldMatrix = m_worldMatrices[i];
+            node->m_worldTransformDirty = false;
+        }
+    }
+
+    /**
+     * @brief Recomputes every world matrix in topological order.
+     */
+    void TransformSystem::updateWorldMatrices() {
+        refreshDirtyLocals();
+
+        uint32_t workerCount = std::max(1u, std::thread::hardware_concurrency());
+
+        for (const auto& [levelBegin, levelEnd] : m_levelRanges) {
+            uint32_t count = levelEnd - levelBegin;
+            if (count < kParallelGrain || workerCount < 2) {
+                updateRange(levelBegin, levelEnd);
+                continue;
+            }
+
+            // Split the level evenly; every worker only reads matrices from
+            // previous (already complete) levels.
+            uint32_t chunk = (count + workerCount - 1) / workerCount;
+            std::vector<std::thread> workers;
+            workers.reserve(workerCount);
+            for (uint32_t begin = levelBegin; begin < levelEnd; begin += chunk) {
+                uint32_t end = std::min(begin + chunk, levelEnd);
+                workers.emplace_back(&TransformSystem::updateRange, this, begin, end);
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+
+} // namespace vkeng